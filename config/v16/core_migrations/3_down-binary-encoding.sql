@@ -0,0 +1,8 @@
+-- Binary encoded documents can not be converted back to json text in SQL and can not be read by older versions, so the
+-- downgrade is refused while there are any instead of dropping them: inserting a count other than 0 fails the CHECK.
+CREATE TEMP TABLE BINARY_ENCODED_DOCUMENTS (DOCUMENT_COUNT INT CHECK (DOCUMENT_COUNT = 0));
+INSERT INTO BINARY_ENCODED_DOCUMENTS SELECT COUNT(*) FROM TRANSACTION_QUEUE WHERE MESSAGE_ENCODING != 0;
+INSERT INTO BINARY_ENCODED_DOCUMENTS SELECT COUNT(*) FROM CHARGING_PROFILES WHERE PROFILE_ENCODING != 0;
+DROP TABLE BINARY_ENCODED_DOCUMENTS;
+ALTER TABLE TRANSACTION_QUEUE DROP COLUMN MESSAGE_ENCODING;
+ALTER TABLE CHARGING_PROFILES DROP COLUMN PROFILE_ENCODING;
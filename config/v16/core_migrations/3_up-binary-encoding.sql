@@ -0,0 +1,4 @@
+-- Persisted json documents are stored together with the version of their encoding, see ocpp::common::JsonEncoding.
+-- Existing rows are json text (0) and are converted to the current binary encoding when the database is opened.
+ALTER TABLE TRANSACTION_QUEUE ADD COLUMN MESSAGE_ENCODING INT NOT NULL DEFAULT 0;
+ALTER TABLE CHARGING_PROFILES ADD COLUMN PROFILE_ENCODING INT NOT NULL DEFAULT 0;
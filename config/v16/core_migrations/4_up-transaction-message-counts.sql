@@ -0,0 +1,10 @@
+-- The transaction a queued message belongs to and its kind within the transaction (0: other, 1: update, 2: end, see
+-- ocpp::common::TransactionMessageKind), so the queued messages can be counted per transaction without reading them.
+ALTER TABLE TRANSACTION_QUEUE ADD COLUMN TRANSACTION_ID TEXT;
+ALTER TABLE TRANSACTION_QUEUE ADD COLUMN TRANSACTION_MESSAGE_KIND INT NOT NULL DEFAULT 0;
+-- Messages persisted by earlier versions are still json text here, they are converted to binary encoding afterwards
+UPDATE TRANSACTION_QUEUE SET
+    TRANSACTION_ID = CAST(json_extract(MESSAGE, '$[3].transactionId') AS TEXT),
+    TRANSACTION_MESSAGE_KIND = CASE MESSAGE_TYPE WHEN 'MeterValues' THEN 1 ELSE 2 END
+WHERE MESSAGE_TYPE IN ('MeterValues', 'StopTransaction') AND MESSAGE_ENCODING = 0 AND json_valid(MESSAGE) AND
+    json_type(MESSAGE, '$[3].transactionId') = 'integer';
@@ -0,0 +1,2 @@
+ALTER TABLE TRANSACTION_QUEUE DROP COLUMN TRANSACTION_MESSAGE_KIND;
+ALTER TABLE TRANSACTION_QUEUE DROP COLUMN TRANSACTION_ID;
@@ -14,6 +14,8 @@
 #include <string>
 
 #include <ocpp/common/cistring.hpp>
+#include <ocpp/common/json_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
 
 using json = nlohmann::json;
 
@@ -44,6 +46,12 @@ void to_json(json& j, const MessageId& k);
 /// \brief Conversion from a given json object \p j to a given MessageId \p k
 void from_json(const json& j, MessageId& k);
 
+/// \brief Writes the given MessageId \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MessageId& k);
+
+/// \brief Reads the given MessageId \p k from the given \p reader
+void read_json(JsonReader& reader, MessageId& k);
+
 /// \brief Contains the different message type ids
 enum class MessageTypeId {
     CALL = 2,
@@ -76,6 +84,16 @@ template <class T> struct Call {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given Call message \p c as json to the given \p writer
+    friend void write_json(JsonWriter& writer, const Call& c) {
+        writer.begin_array();
+        writer.value(static_cast<int32_t>(MessageTypeId::CALL));
+        writer.value(c.uniqueId);
+        writer.value(c.msg.get_type());
+        writer.value(c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given Call message \p c
     friend void from_json(const json& j, Call& c) {
         // the required parts of the message
@@ -83,6 +101,22 @@ template <class T> struct Call {
         c.uniqueId.set(j.at(MESSAGE_ID));
     }
 
+    /// \brief Reads the given Call message \p c from the given \p reader
+    friend void read_json(JsonReader& reader, Call& c) {
+        int index = 0;
+        reader.read_array([&reader, &c, &index]() {
+            if (index == MESSAGE_ID) {
+                reader.read(c.uniqueId);
+            } else if (index == CALL_PAYLOAD) {
+                reader.read(c.msg);
+            } else {
+                reader.skip();
+            }
+            index++;
+        });
+        reader.require_member(index > CALL_PAYLOAD, "payload");
+    }
+
     /// \brief Writes the given case Call \p c to the given output stream \p os
     /// \returns an output stream with the Call written to
     friend std::ostream& operator<<(std::ostream& os, const Call& c) {
@@ -114,6 +148,15 @@ template <class T> struct CallResult {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given CallResult message \p c as json to the given \p writer
+    friend void write_json(JsonWriter& writer, const CallResult& c) {
+        writer.begin_array();
+        writer.value(static_cast<int32_t>(MessageTypeId::CALLRESULT));
+        writer.value(c.uniqueId);
+        writer.value(c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given CallResult message \p c
     friend void from_json(const json& j, CallResult& c) {
         // the required parts of the message
@@ -121,6 +164,22 @@ template <class T> struct CallResult {
         c.uniqueId.set(j.at(MESSAGE_ID));
     }
 
+    /// \brief Reads the given CallResult message \p c from the given \p reader
+    friend void read_json(JsonReader& reader, CallResult& c) {
+        int index = 0;
+        reader.read_array([&reader, &c, &index]() {
+            if (index == MESSAGE_ID) {
+                reader.read(c.uniqueId);
+            } else if (index == CALLRESULT_PAYLOAD) {
+                reader.read(c.msg);
+            } else {
+                reader.skip();
+            }
+            index++;
+        });
+        reader.require_member(index > CALLRESULT_PAYLOAD, "payload");
+    }
+
     /// \brief Writes the given case CallResult \p c to the given output stream \p os
     /// \returns an output stream with the CallResult written to
     friend std::ostream& operator<<(std::ostream& os, const CallResult& c) {
@@ -151,6 +210,9 @@ void to_json(json& j, const CallError& c);
 /// \brief Conversion from a given json object \p j to a given CallError message \p c
 void from_json(const json& j, CallError& c);
 
+/// \brief Writes the given CallError message \p c as json to the given \p writer
+void write_json(JsonWriter& writer, const CallError& c);
+
 /// \brief Writes the given case CallError \p c to the given output stream \p os
 /// \returns an output stream with the CallError written to
 std::ostream& operator<<(std::ostream& os, const CallError& c);
@@ -3,6 +3,11 @@
 #ifndef OCPP_COMMON_CISTRING_HPP
 #define OCPP_COMMON_CISTRING_HPP
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
 #include <nlohmann/json.hpp>
 
 #include <ocpp/common/string.hpp>
@@ -12,31 +17,135 @@ using json = nlohmann::json;
 
 namespace ocpp {
 
+namespace detail {
+constexpr uint64_t EACH_BYTE_01 = 0x0101010101010101;
+constexpr uint64_t EACH_BYTE_7F = 0x7f7f7f7f7f7f7f7f;
+constexpr uint64_t EACH_BYTE_80 = 0x8080808080808080;
+
+inline uint64_t load_word(const char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+inline bool is_printable_ascii(char character) {
+    // printable ASCII starts at code 0x20 (space) and ends with code 0x7e (tilde) and 0xa (\n)
+    return (character >= 0x20 && character <= 0x7e) || character == 0xa;
+}
+
+inline char to_lower_ascii(char character) {
+    return character >= 'A' && character <= 'Z' ? static_cast<char>(character + ('a' - 'A')) : character;
+}
+
+/// \brief Converts the ASCII upper case letters of the 8 characters in \p word to lower case
+inline uint64_t to_lower_ascii(uint64_t word) {
+    const auto ascii = word & EACH_BYTE_7F;
+    // the high bit of a byte is set if the byte is >= 'A' or > 'Z' respectively, the additions never carry over
+    const auto at_least_a = ascii + EACH_BYTE_01 * (0x80 - 'A');
+    const auto above_z = ascii + EACH_BYTE_01 * (0x80 - 'Z' - 1);
+    const auto upper_case = at_least_a & ~above_z & ~word & EACH_BYTE_80;
+    return word | (upper_case >> 2);
+}
+
+/// \brief Checks if \p data only contains printable ASCII characters, testing 8 characters at a time
+inline bool is_printable_ascii(std::string_view data) {
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= data.size(); pos += sizeof(uint64_t)) {
+        const auto word = load_word(data.data() + pos);
+        // the high bit of a byte is set if the byte is < 0x20 or > 0x7e, see "Determine if a word has a byte less
+        // than n" in https://graphics.stanford.edu/~seander/bithacks.html
+        const auto below_space = (word - EACH_BYTE_01 * 0x20) & ~word;
+        const auto above_tilde = (word + EACH_BYTE_01 * (0x7f - 0x7e)) | word;
+        if (((below_space | above_tilde) & EACH_BYTE_80) != 0) {
+            // contains a line feed or an invalid character
+            for (size_t i = pos; i < pos + sizeof(uint64_t); i++) {
+                if (!is_printable_ascii(data[i])) {
+                    return false;
+                }
+            }
+        }
+    }
+    for (; pos < data.size(); pos++) {
+        if (!is_printable_ascii(data[pos])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Compares \p lhs and \p rhs ignoring the case of ASCII letters, testing 8 characters at a time
+inline bool iequals_ascii(std::string_view lhs, std::string_view rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= lhs.size(); pos += sizeof(uint64_t)) {
+        const auto lhs_word = load_word(lhs.data() + pos);
+        const auto rhs_word = load_word(rhs.data() + pos);
+        if (lhs_word != rhs_word && to_lower_ascii(lhs_word) != to_lower_ascii(rhs_word)) {
+            return false;
+        }
+    }
+    for (; pos < lhs.size(); pos++) {
+        if (to_lower_ascii(lhs[pos]) != to_lower_ascii(rhs[pos])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Calculates a hash of \p data that ignores the case of ASCII letters (FNV-1a)
+inline size_t ihash_ascii(std::string_view data) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (const auto character : data) {
+        hash ^= static_cast<unsigned char>(to_lower_ascii(character));
+        hash *= 0x100000001b3;
+    }
+    return static_cast<size_t>(hash);
+}
+} // namespace detail
+
 /// \brief Contains a CaseInsensitive string implementation that only allows printable ASCII characters
 template <size_t L> class CiString : public String<L> {
 
 public:
     /// \brief Creates a string from the given \p data
-    CiString(const std::string& data) : String<L>(data) {
+    CiString(const std::string& data) {
+        this->set(data);
     }
 
-    CiString(const char* data) : String<L>(data) {
+    CiString(std::string_view data) {
+        this->set(data);
     }
 
-    CiString(const CiString<L>& data) : String<L>(data.get()) {
+    CiString(const char* data) {
+        this->set(data);
     }
 
     /// \brief Creates a string
-    CiString() : String<L>() {
+    CiString() = default;
+
+    /// \brief Sets the content of the string to the given \p data after checking that it only contains printable ASCII
+    /// characters
+    void set(std::string_view data) {
+        if (data.length() <= L) {
+            this->is_valid(data);
+        }
+        String<L>::set(data);
+    }
+
+    void set(const std::string& data) {
+        this->set(std::string_view(data));
+    }
+
+    void set(const char* data) {
+        this->set(std::string_view(data));
     }
 
     /// \brief CaseInsensitive string implementation only allows printable ASCII characters
-    bool is_valid(const std::string& data) {
-        for (const char& character : data) {
-            // printable ASCII starts at code 0x20 (space) and ends with code 0x7e (tilde) and 0xa (\n)
-            if ((character < 0x20 || character > 0x7e) && character != 0xa) {
-                throw std::runtime_error("CiString can only contain printable ASCII characters");
-            }
+    bool is_valid(std::string_view data) {
+        if (!detail::is_printable_ascii(data)) {
+            throw std::runtime_error("CiString can only contain printable ASCII characters");
         }
         return true;
     }
@@ -49,33 +158,33 @@ public:
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const CiString<L>& lhs, const char* rhs) {
-    return iequals(lhs.get(), rhs);
+    return detail::iequals_ascii(lhs.view(), rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return iequals(lhs.get(), rhs.get());
+    return detail::iequals_ascii(lhs.view(), rhs.view());
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const CiString<L>& lhs, const char* rhs) {
-    return !(lhs.get() == rhs);
+    return !(lhs.view() == rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return !(lhs.get() == rhs.get());
+    return !(lhs.view() == rhs.view());
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator<(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return lhs.get() < rhs.get();
+    return lhs.view() < rhs.view();
 }
 
 /// \brief Writes the given string \p str to the given output stream \p os
 /// \returns an output stream with the case insensitive string written to
 template <size_t L> std::ostream& operator<<(std::ostream& os, const CiString<L>& str) {
-    os << str.get();
+    os << str.view();
     return os;
 }
 
@@ -89,4 +198,13 @@ template <size_t L> void from_json(const json& j, CiString<L>& k) {
 
 } // namespace ocpp
 
+namespace std {
+/// \brief Hashes a CiString consistently with its case insensitive operator==
+template <size_t L> struct hash<ocpp::CiString<L>> {
+    size_t operator()(const ocpp::CiString<L>& str) const noexcept {
+        return ocpp::detail::ihash_ascii(str.view());
+    }
+};
+} // namespace std
+
 #endif
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <sqlite3.h>
+#include <unordered_map>
 
 #include <ocpp/common/support_older_cpp_versions.hpp>
 
@@ -26,6 +30,12 @@ public:
     virtual void rollback() = 0;
 };
 
+/// \brief Counters of the prepared statement cache of a DatabaseConnection
+struct StatementCacheStatistics {
+    uint64_t hits = 0;   ///< number of statements that were reused from the cache
+    uint64_t misses = 0; ///< number of statements that had to be prepared
+};
+
 class DatabaseConnectionInterface {
 public:
     virtual ~DatabaseConnectionInterface() = default;
@@ -47,6 +57,9 @@ public:
     /// \note Will throw an std::runtime_error if the statement can't be prepared
     virtual std::unique_ptr<SQLiteStatementInterface> new_statement(const std::string& sql) = 0;
 
+    /// \brief Returns the hit and miss counters of the prepared statement cache used by new_statement
+    virtual StatementCacheStatistics get_statement_cache_statistics() = 0;
+
     /// \brief Returns the latest error message from sqlite3.
     virtual const char* get_error_message() = 0;
 
@@ -57,6 +70,9 @@ public:
     virtual int64_t get_last_inserted_rowid() = 0;
 };
 
+/// \brief Default number of prepared statements kept by a DatabaseConnection for reuse
+constexpr size_t DEFAULT_STATEMENT_CACHE_SIZE = 64;
+
 class DatabaseConnection : public DatabaseConnectionInterface {
 private:
     sqlite3* db;
@@ -64,10 +80,25 @@ private:
     std::atomic_uint32_t open_count;
     std::timed_mutex transaction_mutex;
 
+    /// \brief Prepared statements that are currently not in use. It is shared with the release callbacks of the
+    /// statements handed out by new_statement, which only hold a weak reference to it: a statement that outlives its
+    /// connection is not put back into a cache that no longer exists.
+    struct StatementCache;
+    std::shared_ptr<StatementCache> statement_cache;
+
     bool close_connection_internal(bool force_close);
 
+    /// \brief Resets \p stmt and puts it back into \p cache if it belongs to the current connection
+    static void release_statement(StatementCache& cache, const std::string& sql, sqlite3_stmt* stmt,
+                                  uint64_t generation);
+
 public:
-    explicit DatabaseConnection(const fs::path& database_file_path) noexcept;
+    /// \brief Creates a new database connection for \p database_file_path
+    /// \param database_file_path
+    /// \param statement_cache_size maximum number of prepared statements kept for reuse by new_statement. 0 disables
+    /// the cache
+    explicit DatabaseConnection(const fs::path& database_file_path,
+                                const size_t statement_cache_size = DEFAULT_STATEMENT_CACHE_SIZE) noexcept;
 
     virtual ~DatabaseConnection();
 
@@ -77,8 +108,16 @@ public:
     [[nodiscard]] std::unique_ptr<DatabaseTransactionInterface> begin_transaction() override;
 
     bool execute_statement(const std::string& statement) override;
+
+    /// \brief Returns a statement for \p sql. Statements are prepared once and reused from a cache keyed by the SQL
+    /// text. When the returned statement is destroyed it is reset, its bindings are cleared and it is put back into
+    /// the cache.
+    /// \note A statement should be destroyed before its connection is closed: closing the connection finalizes all of
+    /// its statements, so a statement that is still held afterwards must not be used anymore.
     std::unique_ptr<SQLiteStatementInterface> new_statement(const std::string& sql) override;
 
+    StatementCacheStatistics get_statement_cache_statistics() override;
+
     const char* get_error_message() override;
 
     bool clear_table(const std::string& table) override;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -49,23 +50,55 @@ public:
     }
 };
 
+/// \brief Kind of a queued transaction message within its transaction, stored as TRANSACTION_MESSAGE_KIND
+enum class TransactionMessageKind {
+    Other = 0,  ///< Any other message
+    Update = 1, ///< A message containing updates (measurements) of the transaction
+    End = 2,    ///< A message ending the transaction
+};
+
 struct DBTransactionMessage {
     json json_message;
     std::string message_type;
     int32_t message_attempts;
     DateTime timestamp;
     std::string unique_id;
+    /// Position of the message in the order the messages have been inserted, assigned by the database
+    int64_t sequence = 0;
+    /// The transaction the message belongs to and its kind within it. They are stored next to the message, so the
+    /// queued messages can be counted per transaction without reading them.
+    std::optional<std::string> transaction_id;
+    TransactionMessageKind kind = TransactionMessageKind::Other;
+};
+
+/// \brief Number of queued transaction messages of a transaction
+struct DBTransactionMessageCounts {
+    std::string transaction_id;
+    size_t messages = 0;
+    size_t update_messages = 0;
+    size_t end_messages = 0;
 };
 
 class DatabaseHandlerCommon {
 protected:
     std::unique_ptr<DatabaseConnectionInterface> database;
+    /// \brief Dedicated connection the transaction message queue is written with, so the transactions of its batches
+    /// do not include writes that other threads make through \p database at the same time. If not set, the queue is
+    /// written through \p database.
+    std::unique_ptr<DatabaseConnectionInterface> transaction_queue_database;
     const fs::path sql_migration_files_path;
     const uint32_t target_schema_version;
 
     /// \brief Perform the initialization needed to use the database. Will be called by open_connection()
     virtual void init_sql() = 0;
 
+private:
+    /// \brief Reads the transaction messages selected by \p stmt
+    std::vector<DBTransactionMessage> read_transaction_messages(SQLiteStatementInterface& stmt);
+
+    /// \brief Returns the connection the transaction message queue is written with
+    DatabaseConnectionInterface& get_transaction_queue_database();
+
 public:
     /// \brief Common database handler class
     /// Class handles some common database functionality like inserting and removing transaction messages.
@@ -73,8 +106,12 @@ public:
     /// \param database Interface for the database connection
     /// \param sql_migration_files_path Filesystem path to migration file folder
     /// \param target_schema_version The required schema version of the database
+    /// \param transaction_queue_database Optional second connection to the same database that is used to write the
+    /// transaction message queue
     explicit DatabaseHandlerCommon(std::unique_ptr<DatabaseConnectionInterface> database,
-                                   const fs::path& sql_migration_files_path, uint32_t target_schema_version) noexcept;
+                                   const fs::path& sql_migration_files_path, uint32_t target_schema_version,
+                                   std::unique_ptr<DatabaseConnectionInterface> transaction_queue_database =
+                                       nullptr) noexcept;
 
     ~DatabaseHandlerCommon() = default;
 
@@ -88,7 +125,27 @@ public:
     /// \return The transaction messages.
     virtual std::vector<DBTransactionMessage> get_transaction_messages();
 
-    /// \brief Insert a new transaction message that needs to be sent to the CSMS.
+    /// \brief Get a page of transaction messages from transaction messages queue table in the order they have been
+    /// inserted, so the queue can be read in pages without loading all of it.
+    /// \param after_sequence  Only messages inserted after the message with this sequence are returned.
+    /// \param until_sequence  Only messages inserted up to the message with this sequence are returned.
+    /// \param limit           Maximum number of messages that are returned.
+    /// \return The transaction messages.
+    virtual std::vector<DBTransactionMessage> get_transaction_messages(int64_t after_sequence, int64_t until_sequence,
+                                                                       size_t limit);
+
+    /// \brief Counts the transaction messages up to the one with the given sequence by their transaction, without
+    /// reading the messages themselves.
+    /// \param until_sequence  Only messages inserted up to the message with this sequence are counted.
+    /// \return The counts of every transaction that has queued messages.
+    virtual std::vector<DBTransactionMessageCounts> get_transaction_message_counts(int64_t until_sequence);
+
+    /// \brief Get the sequence of the transaction message that has been inserted last.
+    /// \return The sequence, or 0 if there are no transaction messages.
+    virtual int64_t get_last_transaction_message_sequence();
+
+    /// \brief Insert a new transaction message that needs to be sent to the CSMS. If a message with the same unique id
+    /// has already been stored, it is updated and keeps its position in insertion order.
     /// \param transaction_message  The message to be stored.
     virtual void insert_transaction_message(const DBTransactionMessage& transaction_message);
 
@@ -97,6 +154,13 @@ public:
     /// \return True on success.
     virtual void remove_transaction_message(const std::string& unique_id);
 
+    /// \brief Removes and inserts transaction messages within a single database transaction.
+    /// Removals are applied before insertions. Either all changes are committed or none of them.
+    /// \param inserted_messages   The messages to be stored.
+    /// \param removed_unique_ids  The unique ids of the messages to be removed.
+    virtual void update_transaction_messages(const std::vector<DBTransactionMessage>& inserted_messages,
+                                             const std::vector<std::string>& removed_unique_ids);
+
     /// \brief Deletes all entries from TRANSACTION_QUEUE table
     virtual void clear_transaction_queue();
 };
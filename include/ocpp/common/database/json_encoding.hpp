@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <string>
+
+#include <ocpp/common/database/database_connection.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp::common {
+
+/// \brief Versions of the encoding of json documents that are persisted in the database. Every document is stored
+/// together with the version of its encoding, so documents that have been written by older versions can still be read.
+enum class JsonEncoding {
+    Text = 0,   ///< json text, the encoding of documents that have been written before binary encodings were added
+    CborV1 = 1, ///< CBOR (RFC 8949) as written by nlohmann::json::to_cbor
+};
+
+/// \brief Encoding of newly persisted json documents
+constexpr JsonEncoding CURRENT_JSON_ENCODING = JsonEncoding::CborV1;
+
+/// \brief Binds \p document in the CURRENT_JSON_ENCODING to the parameter \p document_param of \p stmt and the
+/// encoding to the parameter \p encoding_param
+void bind_json(SQLiteStatementInterface& stmt, const std::string& document_param, const std::string& encoding_param,
+               const json& document);
+
+/// \brief Reads the json document in column \p document_column of the current row of \p stmt, whose encoding is
+/// stored in column \p encoding_column
+/// \return The document.
+/// \throws json::exception if the document can not be decoded and DatabaseException if its encoding is unknown
+json column_json(SQLiteStatementInterface& stmt, int document_column, int encoding_column);
+
+/// \brief Converts all json documents in \p document_column of \p table that are stored as json text to the
+/// CURRENT_JSON_ENCODING within a single database transaction. Documents that can not be parsed are kept as they are.
+/// \return The number of converted documents.
+size_t convert_json_text_documents(DatabaseConnectionInterface& database, const std::string& table,
+                                   const std::string& document_column, const std::string& encoding_column);
+
+} // namespace ocpp::common
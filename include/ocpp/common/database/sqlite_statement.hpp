@@ -4,6 +4,8 @@
 #ifndef SQLITE_STATEMENT_HPP
 #define SQLITE_STATEMENT_HPP
 
+#include <functional>
+#include <vector>
 #include <sqlite3.h>
 
 #include <everest/logging.hpp>
@@ -48,19 +50,25 @@ public:
                           SQLiteString lifetime = SQLiteString::Static) = 0;
     virtual int bind_int(const int idx, const int val) = 0;
     virtual int bind_int(const std::string& param, const int val) = 0;
+    virtual int bind_int64(const int idx, const int64_t val) = 0;
+    virtual int bind_int64(const std::string& param, const int64_t val) = 0;
     virtual int bind_datetime(const int idx, const ocpp::DateTime val) = 0;
     virtual int bind_datetime(const std::string& param, const ocpp::DateTime val) = 0;
     virtual int bind_double(const int idx, const double val) = 0;
     virtual int bind_double(const std::string& param, const double val) = 0;
     virtual int bind_null(const int idx) = 0;
     virtual int bind_null(const std::string& param) = 0;
+    virtual int bind_blob(const int idx, const std::vector<uint8_t>& val) = 0;
+    virtual int bind_blob(const std::string& param, const std::vector<uint8_t>& val) = 0;
 
     virtual int column_type(const int idx) = 0;
     virtual std::string column_text(const int idx) = 0;
     virtual std::optional<std::string> column_text_nullable(const int idx) = 0;
     virtual int column_int(const int idx) = 0;
+    virtual int64_t column_int64(const int idx) = 0;
     virtual ocpp::DateTime column_datetime(const int idx) = 0;
     virtual double column_double(const int idx) = 0;
+    virtual std::vector<uint8_t> column_blob(const int idx) = 0;
 };
 
 /// \brief RAII wrapper class that handles finalization, step, binding and column access of sqlite3_stmt
@@ -68,9 +76,13 @@ class SQLiteStatement : public SQLiteStatementInterface {
 private:
     sqlite3_stmt* stmt;
     sqlite3* db;
+    std::function<void(sqlite3_stmt*)> release;
 
 public:
     SQLiteStatement(sqlite3* db, const std::string& query);
+    /// \brief Wraps the already prepared \p stmt. On destruction \p release is called with the statement instead of
+    /// finalizing it, so that the owner of the statement can reuse it.
+    SQLiteStatement(sqlite3* db, sqlite3_stmt* stmt, std::function<void(sqlite3_stmt*)> release);
     ~SQLiteStatement();
 
     int step() override;
@@ -81,19 +93,25 @@ public:
                   SQLiteString lifetime = SQLiteString::Static) override;
     int bind_int(const int idx, const int val) override;
     int bind_int(const std::string& param, const int val) override;
+    int bind_int64(const int idx, const int64_t val) override;
+    int bind_int64(const std::string& param, const int64_t val) override;
     int bind_datetime(const int idx, const ocpp::DateTime val) override;
     int bind_datetime(const std::string& param, const ocpp::DateTime val) override;
     int bind_double(const int idx, const double val) override;
     int bind_double(const std::string& param, const double val) override;
     int bind_null(const int idx) override;
     int bind_null(const std::string& param) override;
+    int bind_blob(const int idx, const std::vector<uint8_t>& val) override;
+    int bind_blob(const std::string& param, const std::vector<uint8_t>& val) override;
 
     int column_type(const int idx) override;
     std::string column_text(const int idx) override;
     std::optional<std::string> column_text_nullable(const int idx) override;
     int column_int(const int idx) override;
+    int64_t column_int64(const int idx) override;
     ocpp::DateTime column_datetime(const int idx) override;
     double column_double(const int idx) override;
+    std::vector<uint8_t> column_blob(const int idx) override;
 };
 
 } // namespace ocpp::common
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ocpp/common/database/database_handler_common.hpp>
+
+namespace ocpp::common {
+
+constexpr size_t DEFAULT_TRANSACTION_QUEUE_COMMIT_BATCH_SIZE = 64;
+
+/// \brief Persists changes of the transaction message queue using group commits.
+///
+/// Inserted and removed transaction messages are staged in memory and written to the database in a single transaction
+/// once the commit interval elapsed or the batch size is reached. A message that is removed before its insertion was
+/// committed never reaches the database. With a commit interval of zero every change is written immediately.
+class TransactionQueueWriter {
+private:
+    /// \brief A staged insertion of a transaction message
+    struct StagedInsert {
+        DBTransactionMessage transaction_message;
+        /// true if the message updates a row that may already have been committed, so removing it before the commit
+        /// still has to delete the row
+        bool updates_committed_row;
+    };
+
+    std::shared_ptr<DatabaseHandlerCommon> database_handler;
+    const std::chrono::milliseconds commit_interval;
+    const size_t batch_size;
+
+    std::mutex write_mutex;
+    std::condition_variable staged_cv;
+    std::condition_variable committed_cv;
+    std::vector<StagedInsert> staged_inserts;
+    std::vector<std::string> staged_removals;
+    /// Number of changes that have been staged so far
+    uint64_t staged_sequence = 0;
+    /// Number of staged changes that have been handed over to the database
+    uint64_t taken_sequence = 0;
+    /// Number of staged changes that have been committed (or failed to be committed)
+    uint64_t committed_sequence = 0;
+    bool flush_requested = false;
+    bool running = true;
+    std::thread worker_thread;
+
+    void run();
+
+    /// \brief Writes all staged changes in one database transaction. Expects \p lk to hold the write_mutex, which is
+    /// released while the database is accessed.
+    void commit_staged(std::unique_lock<std::mutex>& lk);
+
+    /// \brief Stages the removal of the transaction message with the given \p unique_id. Expects the write_mutex to be
+    /// held.
+    void stage_removal(const std::string& unique_id);
+
+public:
+    /// \brief Creates a new TransactionQueueWriter
+    /// \param database_handler Database handler the staged changes are written to
+    /// \param commit_interval Maximum time a staged change is kept in memory. Zero disables group commits.
+    /// \param batch_size Number of staged changes that triggers a commit before the commit interval elapsed
+    TransactionQueueWriter(std::shared_ptr<DatabaseHandlerCommon> database_handler,
+                           std::chrono::milliseconds commit_interval,
+                           size_t batch_size = DEFAULT_TRANSACTION_QUEUE_COMMIT_BATCH_SIZE);
+
+    /// \brief Commits all staged changes and stops the writer
+    ~TransactionQueueWriter();
+
+    /// \brief Stages the insertion of \p transaction_message
+    void insert(const DBTransactionMessage& transaction_message);
+
+    /// \brief Stages the removal of the transaction message with the given \p unique_id
+    void remove(const std::string& unique_id);
+
+    /// \brief Stages the removal of the transaction messages with the given \p unique_ids and the insertion of
+    /// \p transaction_message, which replaces them. Both are committed in the same database transaction. If
+    /// \p transaction_message is one of the replaced messages, it is updated and keeps its position in the order of
+    /// insertion.
+    void replace(const std::vector<std::string>& unique_ids, const DBTransactionMessage& transaction_message);
+
+    /// \brief Durability barrier: blocks until all changes staged before this call have been committed
+    void flush();
+};
+
+} // namespace ocpp::common
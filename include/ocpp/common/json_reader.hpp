@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_READER_HPP
+#define OCPP_COMMON_JSON_READER_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <ocpp/common/cistring.hpp>
+
+namespace ocpp {
+
+class DateTime;
+
+/// \brief Pull parser that reads json text directly into typed objects without building a json object first.
+///
+/// Objects and arrays are read with read_object() and read_array() which hand every member / element to the given
+/// callback, that has to consume exactly one value using one of the read() overloads or skip(). Types that are not
+/// handled by one of the read() overloads are read by the read_json(JsonReader&, T&) function found for them via
+/// argument dependent lookup, which is provided by the generated OCPP types and messages. Errors are reported with
+/// the same nlohmann::json exceptions that converting a json object would throw.
+class JsonReader {
+private:
+    std::string_view input;
+    size_t pos = 0;
+    /// holds keys that contained escape sequences
+    std::string key_buffer;
+
+    [[noreturn]] void throw_parse_error(const std::string& message) const;
+    [[noreturn]] void throw_type_error(const char* expected) const;
+    void skip_whitespace();
+    void expect(char c);
+    bool consume(char c);
+    bool consume_literal(std::string_view literal);
+
+public:
+    /// \brief Creates a new JsonReader reading from \p input, which has to outlive the reader
+    explicit JsonReader(std::string_view input);
+
+    /// \brief Returns the first character of the next value without consuming it
+    char peek();
+
+    /// \brief Reads a string and returns it unescaped. The result references the input or \p buffer
+    std::string_view read_string_view(std::string& buffer);
+
+    /// \brief Reads a number and returns its text
+    std::string_view read_number_text();
+
+    /// \brief Reads an object and calls \p on_member with the key of every member. \p on_member has to consume the
+    /// value of the member. The key is only valid until the value has been read.
+    template <typename F> void read_object(F&& on_member) {
+        this->expect('{');
+        if (this->consume('}')) {
+            return;
+        }
+        do {
+            const auto key = this->read_string_view(this->key_buffer);
+            this->expect(':');
+            on_member(key);
+        } while (this->consume(','));
+        this->expect('}');
+    }
+
+    /// \brief Reads an array and calls \p on_element for every element, which has to consume the element
+    template <typename F> void read_array(F&& on_element) {
+        this->expect('[');
+        if (this->consume(']')) {
+            return;
+        }
+        do {
+            on_element();
+        } while (this->consume(','));
+        this->expect(']');
+    }
+
+    /// \brief Skips the next value
+    void skip();
+
+    /// \brief Checks that nothing but whitespace follows the last value
+    void end();
+
+    /// \brief Throws if the required member \p name has not been \p found
+    void require_member(bool found, const char* name) const;
+
+    std::string read_string();
+    void read(std::string& str);
+    void read(bool& b);
+    void read(int32_t& number);
+    void read(int64_t& number);
+    void read(uint64_t& number);
+    void read(float& number);
+    void read(double& number);
+    void read(DateTime& date_time);
+    void read(nlohmann::json& j);
+
+    template <size_t L> void read(CiString<L>& str) {
+        std::string buffer;
+        str.set(this->read_string_view(buffer));
+    }
+
+    template <typename T> void read(std::optional<T>& value) {
+        this->read(value.emplace());
+    }
+
+    template <typename T> void read(std::vector<T>& values) {
+        values.clear();
+        this->read_array([this, &values]() { this->read(values.emplace_back()); });
+    }
+
+    /// \brief Reads \p object using the read_json function that is provided for its type
+    template <typename T> void read(T& object) {
+        read_json(*this, object);
+    }
+};
+
+/// \brief Reads an object of type T from the given json \p text using its read_json function
+/// \returns the object
+template <typename T> T from_json_string(std::string_view text) {
+    T object;
+    JsonReader reader(text);
+    reader.read(object);
+    reader.end();
+    return object;
+}
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_READER_HPP
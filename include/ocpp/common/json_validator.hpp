@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_VALIDATOR_HPP
+#define OCPP_COMMON_JSON_VALIDATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <ocpp/common/json_reader.hpp>
+
+namespace ocpp {
+
+/// \brief Is thrown if json text does not match the schema it is validated against
+class JsonValidationError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/// \brief Checks json text against the schema of an OCPP type without reading it into any object.
+///
+/// The generated validate_* functions of the OCPP types and messages describe the schema of their type by calling
+/// object() and one of the value checks for every member they find. The first violation is reported by throwing a
+/// JsonValidationError that names the type and member it was found in.
+class JsonValidator {
+private:
+    JsonReader reader;
+    /// holds the current string value if it contained escape sequences or has to be converted to an enum
+    std::string buffer;
+    /// type and member that are currently validated, used in error messages
+    const char* type = "";
+    std::string_view key;
+
+    [[noreturn]] void fail(const std::string& reason) const;
+    void expect_value(char first, const char* expected);
+    std::string_view string_value();
+
+public:
+    /// \brief Passed as maximum number of items of an array that has no upper bound
+    static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+    /// \brief Creates a new JsonValidator reading from \p input, which has to outlive the validator
+    explicit JsonValidator(std::string_view input);
+
+    /// \brief Provides the underlying reader, e.g. to skip the parts of a message that are not validated
+    JsonReader& get_reader();
+
+    /// \brief Checks that the next value is an object of the given \p type and calls \p on_member with the key of
+    /// every member, which has to check or skip the value of the member
+    template <typename F> void object(const char* type, F&& on_member) {
+        this->expect_value('{', "object");
+        const auto outer_type = this->type;
+        const auto outer_key = this->key;
+        this->type = type;
+        this->reader.read_object([&](std::string_view key) {
+            this->key = key;
+            on_member(key);
+        });
+        this->type = outer_type;
+        this->key = outer_key;
+    }
+
+    /// \brief Checks that the next value is an array and calls \p on_element for every element, which has to check
+    /// the element
+    template <typename F> void array(F&& on_element) {
+        this->expect_value('[', "array");
+        this->reader.read_array(on_element);
+    }
+
+    /// \brief Checks that the next value is an array of at least \p min_items and at most \p max_items elements and
+    /// calls \p on_element for every element, which has to check the element
+    template <typename F> void array(size_t min_items, size_t max_items, F&& on_element) {
+        this->expect_value('[', "array");
+        size_t items = 0;
+        this->reader.read_array([&]() {
+            if (++items > max_items) {
+                this->fail("array exceeds the maximum of " + std::to_string(max_items) + " items");
+            }
+            on_element();
+        });
+        if (items < min_items) {
+            this->fail("array has less than the minimum of " + std::to_string(min_items) + " items");
+        }
+    }
+
+    /// \brief Throws if the required \p member (given as Type.member) has not been \p found
+    void require_member(bool found, const char* member) const;
+
+    /// \brief Throws because the current member is not part of the schema
+    void unknown_member() const;
+
+    /// \brief Checks that the next value is a string
+    void string();
+
+    /// \brief Checks that the next value is a string of at most \p max_length characters
+    void string(size_t max_length);
+
+    /// \brief Checks that the next value is an integer that fits into an int32_t
+    void integer();
+
+    /// \brief Checks that the next value is a number
+    void number();
+
+    /// \brief Checks that the next value is a boolean
+    void boolean();
+
+    /// \brief Checks that the next value is a date-time string as defined in RFC 3339
+    void date_time();
+
+    /// \brief Skips the next value, which may be of any type
+    void any();
+
+    /// \brief Checks that the next value is a string that \p to_enum converts to an enum value
+    template <typename F> void enumeration(F&& to_enum) {
+        const auto value = this->string_value();
+        if (value.data() != this->buffer.data()) {
+            this->buffer.assign(value);
+        }
+        try {
+            to_enum(this->buffer);
+        } catch (const std::out_of_range&) {
+            this->fail("\"" + this->buffer + "\" is not a valid enum value");
+        }
+    }
+
+    /// \brief Checks that nothing but whitespace follows the last value
+    void end();
+};
+
+/// \brief Checks if the given \p str is a date-time in the strict RFC 3339 format required by OCPP, this accepts the
+/// same strings as is_rfc3339_datetime
+bool is_rfc3339_date_time(std::string_view str);
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_VALIDATOR_HPP
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_WRITER_HPP
+#define OCPP_COMMON_JSON_WRITER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <ocpp/common/cistring.hpp>
+
+namespace ocpp {
+
+class DateTime;
+
+/// \brief Writes json text directly into a string buffer without building a json object first.
+///
+/// Separators are inserted automatically, so a json object is written by calling begin_object(), one key() and one
+/// value() (or a nested object / array) per member and end_object(). Types that are not handled by one of the value()
+/// overloads are written by the write_json(JsonWriter&, const T&) function found for them via argument dependent
+/// lookup, which is provided by the generated OCPP types and messages. Numbers are formatted like
+/// nlohmann::json::dump() does, so the output of both serializers can be used interchangeably.
+class JsonWriter {
+private:
+    std::string& buffer;
+    bool needs_separator = false;
+
+    void separate();
+    void write_escaped(std::string_view str);
+
+public:
+    /// \brief Creates a new JsonWriter that appends to the given \p buffer
+    explicit JsonWriter(std::string& buffer);
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    /// \brief Writes the given member \p name of the current object, has to be followed by exactly one value
+    void key(std::string_view name);
+
+    void value(std::string_view str);
+    void value(const char* str);
+    void value(const std::string& str);
+    void value(bool b);
+    void value(int32_t number);
+    void value(int64_t number);
+    void value(uint64_t number);
+    void value(float number);
+    void value(double number);
+    void value(const DateTime& date_time);
+    void value(const nlohmann::json& j);
+    void null();
+
+    /// \brief Writes the given \p json_text , which has to be a complete serialized json value, as the next value
+    void raw(std::string_view json_text);
+
+    template <size_t L> void value(const String<L>& str) {
+        this->value(str.view());
+    }
+
+    template <size_t L> void value(const CiString<L>& str) {
+        this->value(str.view());
+    }
+
+    template <typename T> void value(const std::vector<T>& values) {
+        this->begin_array();
+        for (const auto& v : values) {
+            this->value(v);
+        }
+        this->end_array();
+    }
+
+    /// \brief Writes \p object using the write_json function that is provided for its type
+    template <typename T> void value(const T& object) {
+        write_json(*this, object);
+    }
+
+    /// \brief Writes the member \p name with the given \p v to the current object
+    template <typename T> void member(std::string_view name, const T& v) {
+        this->key(name);
+        this->value(v);
+    }
+};
+
+/// \brief Writes a message to the given JsonWriter
+using JsonWriteFunction = std::function<void(JsonWriter& writer)>;
+
+/// \brief Serializes the given \p object to json text using its write_json function
+/// \returns the json text
+template <typename T> std::string to_json_string(const T& object) {
+    std::string buffer;
+    JsonWriter writer(buffer);
+    writer.value(object);
+    return buffer;
+}
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_WRITER_HPP
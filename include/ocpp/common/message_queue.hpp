@@ -3,13 +3,18 @@
 #ifndef OCPP_COMMON_MESSAGE_QUEUE_HPP
 #define OCPP_COMMON_MESSAGE_QUEUE_HPP
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <future>
+#include <limits>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -19,6 +24,8 @@
 
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/database/transaction_queue_writer.hpp>
+#include <ocpp/common/json_validator.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/messages/StopTransaction.hpp>
 #include <ocpp/v16/types.hpp>
@@ -29,6 +36,26 @@ namespace ocpp {
 
 using QueryExecutionException = common::QueryExecutionException;
 
+constexpr int DEFAULT_TRANSACTION_MESSAGE_REPLAY_WINDOW = 100;
+
+/// \brief Time after which a message that was rejected because the outbound queue of the websocket was full is handed
+/// over again, unless the websocket reported a written message before
+constexpr std::chrono::milliseconds SEND_RETRY_INTERVAL(100);
+
+/// \brief Hands \p message over to the websocket. If it is accepted, \p on_sent has to be called once the message has
+/// been written or dropped.
+using MessageSendCallback =
+    std::function<WebsocketSendResult(const json& message, const std::function<void(bool sent)>& on_sent)>;
+
+/// \brief Hands the message written by \p write over to the websocket, see MessageSendCallback
+using MessageWriteCallback =
+    std::function<WebsocketSendResult(const JsonWriteFunction& write, const std::function<void(bool sent)>& on_sent)>;
+
+/// \brief Takes back the sequence number \p seq_no of the transaction with the given \p transaction_id, so that it is
+/// assigned to the next message of the transaction again. Returns false if \p seq_no is not the last sequence number
+/// that has been assigned.
+using SequenceNumberRollback = std::function<bool(const std::string& transaction_id, int32_t seq_no)>;
+
 struct MessageQueueConfig {
     int transaction_message_attempts;
     int transaction_message_retry_interval; // seconds
@@ -43,17 +70,57 @@ struct MessageQueueConfig {
     int boot_notification_retry_interval_seconds =
         60; // interval for BootNotification.req in case response by CSMS is CALLERROR or CSMS does not respond at all
             // (within specified MessageTimeout)
+
+    // changes of the persisted transaction message queue are grouped and committed at most this many milliseconds
+    // after they have been made; 0 commits every change immediately
+    int transaction_message_commit_interval_ms = 0;
+    // number of staged changes that triggers a commit before the commit interval elapsed
+    int transaction_message_commit_batch_size = common::DEFAULT_TRANSACTION_QUEUE_COMMIT_BATCH_SIZE;
+
+    // received CALL and CALLRESULT messages are checked against the schema of their message type; invalid CALLRESULTs
+    // are handled like a CALLERROR
+    bool strict_message_validation = false;
+
+    // once the queues reach queues_total_size_threshold, a new transaction update message is merged into the last
+    // queued message of its transaction instead of being queued, if that is an update message that has not been sent.
+    // Messages with a sequence number (TransactionEvents of OCPP 2.0.1) are only merged if their sequence number can be
+    // taken back, see MessageQueue::set_sequence_number_rollback. 0 disables merging, otherwise a merged message
+    // carries at most this many meter values
+    int transaction_update_compaction_items_per_message = 0;
+    // maximum size in bytes of a merged transaction update message, 0 for no limit
+    int transaction_update_compaction_bytes_per_message = 0;
+
+    // number of persisted transaction messages that are kept in memory while they are replayed at startup, the
+    // following ones are read from the database as the queue drains; 0 reads all of them at once
+    int transaction_message_replay_window = DEFAULT_TRANSACTION_MESSAGE_REPLAY_WINDOW;
 };
 
 /// \brief Contains a OCPP message in json form with additional information
 template <typename M> struct EnhancedMessage {
-    json message;                     ///< The OCPP message as json
+    json message;                     ///< The OCPP message as json, empty if it is kept as raw_message
+    std::string raw_message;          ///< The OCPP message as received, if its type is read directly from text
     size_t message_size;              ///< size of the json message in bytes
     MessageId uniqueId;               ///< The unique ID of the json message
     M messageType = M::InternalError; ///< The OCPP message type
     MessageTypeId messageTypeId;      ///< The OCPP message type ID (CALL/CALLRESULT/CALLERROR)
     json call_message;    ///< If the message is a CALLRESULT or CALLERROR this can contain the original CALL message
     bool offline = false; ///< A flag indicating if the connection to the central system is offline
+    /// Describes why the payload does not match its schema, empty if it is valid or has not been validated
+    std::string validation_error;
+};
+
+/// \brief Describes how a message is coalesced with a queued message of the same type and coalescing key
+enum class CoalescingPolicy {
+    LatestWins, ///< The queued message is replaced by the new message, keeping its position in the queue
+    FirstWins,  ///< The new message is discarded, its sender receives the response to the queued message
+};
+
+/// \brief Describes which messages of a type are coalesced in the normal message queue and how
+struct CoalescingRule {
+    CoalescingPolicy policy;
+    /// Extracts the coalescing key from the payload of a message. Only messages with the same key are coalesced,
+    /// messages for which std::nullopt is returned are never coalesced
+    std::function<std::optional<std::string>(const json& payload)> key_extractor;
 };
 
 /// \brief This can be used to distinguish the different queue types
@@ -71,10 +138,24 @@ template <typename M> struct ControlMessage {
     std::promise<EnhancedMessage<M>> promise; ///< A promise used by the async send interface
     DateTime timestamp;                       ///< A timestamp that shows when this message can be sent
     MessageId initial_unique_id;
+    /// Promises of discarded messages that have been coalesced with this one and share its response
+    std::vector<std::promise<EnhancedMessage<M>>> coalesced_promises;
+    /// The payload of the message as json text if it has been serialized when it was pushed. The payload in message
+    /// is an empty object then
+    std::string serialized_payload;
 
     /// \brief Creates a new ControlMessage object from the provided \p message
     explicit ControlMessage(const json& message);
 
+    /// \brief Fulfills the promise of this message and of the messages coalesced with it with the given \p result
+    void set_result(const EnhancedMessage<M>& result) {
+        this->promise.set_value(result);
+        for (auto& coalesced_promise : this->coalesced_promises) {
+            coalesced_promise.set_value(result);
+        }
+        this->coalesced_promises.clear();
+    }
+
     /// \brief Provides the unique message ID stored in the message
     /// \returns the unique ID of the contained message
     [[nodiscard]] MessageId uniqueId() const {
@@ -89,6 +170,13 @@ template <typename M> struct ControlMessage {
 
     /// \brief Determine whether message is a BootNotification.
     bool isBootNotificationMessage() const;
+
+    /// \brief True for transactional messages that end a transaction. These are persisted before they are queued.
+    bool isTransactionEndMessage() const;
+
+    /// \brief Provides the id of the transaction this message belongs to
+    /// \returns the transaction id, or std::nullopt if the message does not contain one
+    std::optional<std::string> transactionId() const;
 };
 
 /// \brief contains a message queue that makes sure that OCPPs synchronicity requirements are met
@@ -96,6 +184,7 @@ template <typename M> class MessageQueue {
 private:
     MessageQueueConfig config;
     std::shared_ptr<ocpp::common::DatabaseHandlerCommon> database_handler;
+    common::TransactionQueueWriter transaction_queue_writer;
 
     std::thread worker_thread;
     /// message deque for transaction related messages
@@ -105,8 +194,30 @@ private:
     std::shared_ptr<ControlMessage<M>> in_flight;
     std::recursive_mutex message_mutex;
     std::condition_variable_any cv;
-    std::function<bool(json message)> send_callback;
+    MessageSendCallback send_callback;
+    MessageWriteCallback write_callback;
+    // CallResult and CallError messages that could not be handed over yet because the outbound queue of the websocket
+    // was full. They must not be dropped, so the worker sends them before any further CALL in the order they have been
+    // pushed.
+    std::deque<std::function<WebsocketSendResult()>> pending_replies;
+    std::mutex pending_replies_mutex;
+    std::atomic<bool> replies_pending;
+    // true while the outbound queue of the websocket is full, the worker then waits until the websocket reported a
+    // written message or SEND_RETRY_INTERVAL elapsed before it hands over further messages
+    bool send_blocked;
+    std::atomic<bool> message_written;
+    /// \brief Forwards the on_sent notifications of the websocket to the worker. Shared with the on_sent callbacks,
+    /// since they can be called after the queue has been stopped.
+    struct SendNotifier {
+        std::mutex mutex;
+        MessageQueue* queue = nullptr;
+    };
+    std::shared_ptr<SendNotifier> send_notifier;
+    std::function<void(bool sent)> on_sent;
     std::vector<M> external_notify;
+    /// CALL messages of these types are not parsed into json but passed on as text
+    std::set<M> raw_message_types;
+    SequenceNumberRollback sequence_number_rollback;
     bool paused;
     // Transiently true while the queue is paused, but is waiting to unpause
     bool resuming;
@@ -136,6 +247,57 @@ private:
     // was queued. This can happen when the CP has not received a StartTransaction.conf from the CSMS.
     std::map<std::string, std::vector<std::string>> start_transaction_mid_meter_values_mid_map;
 
+    std::map<M, CoalescingRule> coalescing_rules;
+    // key is the message type and coalescing key of a message in the normal_message_queue, value is the message
+    std::map<std::pair<M, std::string>, std::shared_ptr<ControlMessage<M>>> coalescing_index;
+
+    /// \brief Entry of a message of the transaction_message_queue in the transaction_message_index
+    struct IndexedTransactionMessage {
+        std::shared_ptr<ControlMessage<M>> message;
+        std::optional<std::string> transaction_id;
+        bool is_update_message;
+        bool is_end_message;
+    };
+
+    /// \brief Number of messages of a transaction in the transaction_message_queue
+    struct TransactionMessageCounts {
+        size_t messages = 0;
+        size_t update_messages = 0;
+        size_t end_messages = 0;
+    };
+
+    // Indexes over the transaction_message_queue, so looking up queued messages by their unique id or transaction id
+    // does not require a scan of the queue. They are kept up to date by index_transaction_message() and
+    // unindex_transaction_message() whenever a message is added to or removed from the queue.
+    // key is the unique id of a queued message
+    std::unordered_map<std::string, IndexedTransactionMessage> transaction_message_index;
+    // key is the transaction id of queued messages
+    std::unordered_map<std::string, TransactionMessageCounts> transaction_message_counts;
+    size_t transaction_update_message_count = 0;
+
+    /// \brief A queued transaction update message that following update messages of the same transaction are merged
+    /// into while the queues exceed their size threshold
+    struct CompactionTarget {
+        std::shared_ptr<ControlMessage<M>> message;
+        size_t items;
+        /// size in bytes of the message, determined when it is first needed
+        std::optional<size_t> bytes;
+    };
+    // key is a transaction id, value is its last queued message if that is an update message that has not been sent
+    std::unordered_map<std::string, CompactionTarget> compaction_targets;
+
+    // The persisted transaction messages are replayed page by page at startup. While a replay is in progress, the
+    // messages inserted after the one with replay_sequence and up to the one with replay_end_sequence have not been
+    // read yet. The first replayed_message_count messages of the transaction_message_queue have been replayed, the
+    // messages that have been queued during the replay follow them.
+    std::optional<int64_t> replay_end_sequence;
+    int64_t replay_sequence = 0;
+    size_t replayed_message_count = 0;
+    // key is the transaction id of persisted messages that have not been replayed yet, so looking them up does not
+    // require reading the database
+    std::unordered_map<std::string, TransactionMessageCounts> unreplayed_transaction_message_counts;
+    bool replay_ignore_security_event_notifications = false;
+
     MessageId getMessageId(const json::array_t& json_message) {
         return MessageId(json_message.at(MESSAGE_ID).get<std::string>());
     }
@@ -155,6 +317,68 @@ private:
 
         return MessageTypeId::UNKNOWN;
     }
+
+    /// \brief Reads only the envelope of the given \p message. If it is a CALL of one of the raw_message_types, the
+    /// message is kept as text in \p enhanced_message instead of being parsed into json
+    /// \returns true if the message has been kept as text
+    bool read_raw_call(const std::string& message, EnhancedMessage<M>& enhanced_message) {
+        if (this->raw_message_types.empty()) {
+            return false;
+        }
+
+        JsonReader reader(message);
+        int index = 0;
+        int32_t message_type_id = 0;
+        MessageId unique_id;
+        std::string action;
+        reader.read_array([&]() {
+            if (index == MESSAGE_TYPE_ID) {
+                reader.read(message_type_id);
+            } else if (index == MESSAGE_ID) {
+                reader.read(unique_id);
+            } else if (index == CALL_ACTION && message_type_id == static_cast<int32_t>(MessageTypeId::CALL)) {
+                action = reader.read_string();
+            } else {
+                reader.skip();
+            }
+            index++;
+        });
+        if (message_type_id != static_cast<int32_t>(MessageTypeId::CALL)) {
+            return false;
+        }
+        const auto message_type = this->string_to_messagetype(action);
+        if (this->raw_message_types.count(message_type) == 0) {
+            return false;
+        }
+
+        enhanced_message.uniqueId = unique_id;
+        enhanced_message.messageTypeId = MessageTypeId::CALL;
+        enhanced_message.messageType = message_type;
+        enhanced_message.raw_message = message;
+        return true;
+    }
+
+    /// \brief Checks the payload at \p payload_index of the given \p message against the schema of \p message_type
+    /// \returns a description of the first violation, or an empty string if the payload is valid
+    std::string validate(const std::string& message, M message_type, int payload_index) {
+        try {
+            JsonValidator validator(message);
+            int index = 0;
+            validator.get_reader().read_array([&]() {
+                if (index == payload_index) {
+                    this->validate_payload(message_type, validator);
+                } else {
+                    validator.any();
+                }
+                index++;
+            });
+            validator.end();
+        } catch (const std::exception& e) {
+            return e.what();
+        }
+        return "";
+    }
+
     bool isValidMessageType(const json::array_t& json_message) {
         if (this->getMessageTypeId(json_message) != MessageTypeId::UNKNOWN) {
             return true;
@@ -162,10 +386,326 @@ private:
         return false;
     }
 
+    /// \brief Adds the given \p message that has been put on the transaction_message_queue to the indexes
+    void index_transaction_message(const std::shared_ptr<ControlMessage<M>>& message) {
+        IndexedTransactionMessage entry{message, message->transactionId(), message->isTransactionUpdateMessage(),
+                                        message->isTransactionEndMessage()};
+        const auto [it, inserted] =
+            this->transaction_message_index.try_emplace(message->uniqueId().get(), std::move(entry));
+        if (!inserted) {
+            EVLOG_warning << "Message with id " << message->uniqueId()
+                          << " is already in the transaction message queue";
+            return;
+        }
+        const auto& indexed = it->second;
+        if (indexed.is_update_message) {
+            this->transaction_update_message_count++;
+        }
+        if (indexed.transaction_id.has_value()) {
+            // following update messages must not be merged across this message
+            this->compaction_targets.erase(indexed.transaction_id.value());
+            auto& counts = this->transaction_message_counts[indexed.transaction_id.value()];
+            counts.messages++;
+            counts.update_messages += indexed.is_update_message ? 1 : 0;
+            counts.end_messages += indexed.is_end_message ? 1 : 0;
+        }
+    }
+
+    /// \brief Removes the message with the given \p unique_id that has been taken from the transaction_message_queue
+    /// from the indexes
+    /// \returns true if the message was indexed
+    bool unindex_transaction_message(const std::string& unique_id) {
+        const auto it = this->transaction_message_index.find(unique_id);
+        if (it == this->transaction_message_index.end()) {
+            return false;
+        }
+        const auto& indexed = it->second;
+        if (indexed.is_update_message) {
+            this->transaction_update_message_count--;
+        }
+        if (indexed.transaction_id.has_value()) {
+            const auto target = this->compaction_targets.find(indexed.transaction_id.value());
+            if (target != this->compaction_targets.end() && target->second.message == indexed.message) {
+                this->compaction_targets.erase(target);
+            }
+            const auto counts_it = this->transaction_message_counts.find(indexed.transaction_id.value());
+            auto& counts = counts_it->second;
+            counts.messages--;
+            counts.update_messages -= indexed.is_update_message ? 1 : 0;
+            counts.end_messages -= indexed.is_end_message ? 1 : 0;
+            if (counts.messages == 0) {
+                this->transaction_message_counts.erase(counts_it);
+            }
+        }
+        this->transaction_message_index.erase(it);
+        return true;
+    }
+
+    /// \brief Updates the indexes after the payload of the given \p message has been changed
+    void reindex_transaction_message(const std::shared_ptr<ControlMessage<M>>& message) {
+        if (this->unindex_transaction_message(message->uniqueId().get())) {
+            this->index_transaction_message(message);
+        }
+    }
+
+    /// \brief Puts the given \p message back at the front of the transaction_message_queue
+    void requeue_transaction_message(const std::shared_ptr<ControlMessage<M>>& message) {
+        this->transaction_message_queue.push_front(message);
+        this->index_transaction_message(message);
+        if (this->replay_end_sequence.has_value()) {
+            // it is sent before the messages that have been queued during the replay
+            this->replayed_message_count++;
+        }
+    }
+
+    /// \brief Returns the number of persisted transaction messages that are read at once during a replay
+    size_t get_replay_page_size() const {
+        if (this->config.transaction_message_replay_window <= 0) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return static_cast<size_t>(this->config.transaction_message_replay_window);
+    }
+
+    /// \brief Creates the ControlMessage of the persisted \p transaction_message
+    std::shared_ptr<ControlMessage<M>>
+    to_control_message(const ocpp::common::DBTransactionMessage& transaction_message) {
+        auto message = std::make_shared<ControlMessage<M>>(transaction_message.json_message);
+        message->messageType = string_to_messagetype(transaction_message.message_type);
+        message->timestamp = transaction_message.timestamp;
+        message->message_attempts = transaction_message.message_attempts;
+        return message;
+    }
+
+    /// \brief Creates the DBTransactionMessage that persists the given \p message under the given \p unique_id
+    ocpp::common::DBTransactionMessage to_db_transaction_message(const ControlMessage<M>& message,
+                                                                 const std::string& unique_id) {
+        ocpp::common::DBTransactionMessage db_message{message.message,
+                                                      std::string(messagetype_to_string(message.messageType)),
+                                                      message.message_attempts, message.timestamp, unique_id};
+        db_message.transaction_id = message.transactionId();
+        if (message.isTransactionEndMessage()) {
+            db_message.kind = ocpp::common::TransactionMessageKind::End;
+        } else if (message.isTransactionUpdateMessage()) {
+            db_message.kind = ocpp::common::TransactionMessageKind::Update;
+        }
+        return db_message;
+    }
+
+    /// \brief Reads the next persisted transaction messages of a replay in progress until at least half of the replay
+    /// window is filled. They are queued in front of the messages that have been queued during the replay. The replay
+    /// is finished once all persisted messages have been read.
+    void replay_transaction_messages() {
+        const auto page_size = this->get_replay_page_size();
+        while (this->replay_end_sequence.has_value() && this->replayed_message_count <= page_size / 2) {
+            const auto limit = page_size - this->replayed_message_count;
+            std::vector<ocpp::common::DBTransactionMessage> transaction_messages;
+            try {
+                transaction_messages = this->database_handler->get_transaction_messages(
+                    this->replay_sequence, this->replay_end_sequence.value(), limit);
+            } catch (const std::exception& e) {
+                EVLOG_error << "Could not replay queued transaction messages from database: " << e.what();
+                this->replay_end_sequence.reset();
+                break;
+            }
+
+            std::vector<std::shared_ptr<ControlMessage<M>>> replayed_messages;
+            for (const auto& transaction_message : transaction_messages) {
+                this->replay_sequence = transaction_message.sequence;
+                if (this->replay_ignore_security_event_notifications &&
+                    transaction_message.message_type == "SecurityEventNotification") {
+                    // remove from database in case SecurityEventNotification.req should not be sent
+                    this->transaction_queue_writer.remove(transaction_message.unique_id);
+                } else {
+                    auto message = this->to_control_message(transaction_message);
+                    this->count_transaction_message(this->unreplayed_transaction_message_counts, *message, false);
+                    if (this->transaction_message_index.count(transaction_message.unique_id) == 0) {
+                        this->index_transaction_message(message);
+                        replayed_messages.push_back(std::move(message));
+                    }
+                }
+            }
+            this->transaction_message_queue.insert(this->transaction_message_queue.begin() +
+                                                       this->replayed_message_count,
+                                                   replayed_messages.begin(), replayed_messages.end());
+            this->replayed_message_count += replayed_messages.size();
+            if (!replayed_messages.empty()) {
+                this->new_message = true;
+            }
+
+            // messages that could not be read are skipped, so only an empty page tells that the replay is finished
+            if (transaction_messages.empty() || this->replay_sequence >= this->replay_end_sequence.value()) {
+                EVLOG_debug << "Replay of queued transaction messages finished";
+                this->replay_end_sequence.reset();
+            }
+        }
+        if (!this->replay_end_sequence.has_value()) {
+            this->replayed_message_count = 0;
+            this->unreplayed_transaction_message_counts.clear();
+        }
+    }
+
+    /// \brief Counts the given \p message in \p counts_by_transaction if it has been \p added , otherwise removes it
+    static void count_transaction_message(
+        std::unordered_map<std::string, TransactionMessageCounts>& counts_by_transaction,
+        const ControlMessage<M>& message, const bool added) {
+        const auto transaction_id = message.transactionId();
+        if (!transaction_id.has_value()) {
+            return;
+        }
+        const bool is_update_message = message.isTransactionUpdateMessage();
+        const bool is_end_message = message.isTransactionEndMessage();
+        if (added) {
+            auto& counts = counts_by_transaction[transaction_id.value()];
+            counts.messages++;
+            counts.update_messages += is_update_message ? 1 : 0;
+            counts.end_messages += is_end_message ? 1 : 0;
+            return;
+        }
+        const auto it = counts_by_transaction.find(transaction_id.value());
+        if (it == counts_by_transaction.end()) {
+            return;
+        }
+        auto& counts = it->second;
+        counts.messages--;
+        counts.update_messages -= is_update_message ? 1 : 0;
+        counts.end_messages -= is_end_message ? 1 : 0;
+        if (counts.messages == 0) {
+            counts_by_transaction.erase(it);
+        }
+    }
+
+    /// \brief Counts the persisted transaction messages up to \p end_sequence by their transaction, so the messages
+    /// that have not been replayed yet can be looked up without reading the database. The counts are aggregated by the
+    /// database from the transaction id and kind stored with every message, the messages themselves are not read.
+    std::unordered_map<std::string, TransactionMessageCounts>
+    count_persisted_transaction_messages(const int64_t end_sequence) {
+        std::unordered_map<std::string, TransactionMessageCounts> counts_by_transaction;
+        try {
+            for (auto& transaction_counts : this->database_handler->get_transaction_message_counts(end_sequence)) {
+                counts_by_transaction.emplace(std::move(transaction_counts.transaction_id),
+                                              TransactionMessageCounts{transaction_counts.messages,
+                                                                       transaction_counts.update_messages,
+                                                                       transaction_counts.end_messages});
+            }
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not count queued transaction messages in database: " << e.what();
+        }
+        return counts_by_transaction;
+    }
+
+    /// \brief Gets the coalescing key of the given \p message using the coalescing rule of its type
+    /// \returns the key, or std::nullopt if the message is not coalesced
+    std::optional<std::string> get_coalescing_key(const ControlMessage<M>& message) {
+        const auto rule = this->coalescing_rules.find(message.messageType);
+        if (rule == this->coalescing_rules.end()) {
+            return std::nullopt;
+        }
+        try {
+            return rule->second.key_extractor(message.message.at(CALL_PAYLOAD));
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not get coalescing key of " << message.messageType << ": " << e.what();
+            return std::nullopt;
+        }
+    }
+
+    /// \brief Coalesces the given \p message with a message of the same type and coalescing key in the
+    /// normal_message_queue. If there is none, the message is added to the coalescing_index.
+    /// \returns true if the message has been coalesced and must not be queued
+    bool coalesce_normal_message(const std::shared_ptr<ControlMessage<M>>& message) {
+        const auto key = this->get_coalescing_key(*message);
+        if (!key.has_value()) {
+            return false;
+        }
+        const auto [it, inserted] = this->coalescing_index.try_emplace({message->messageType, key.value()}, message);
+        if (inserted) {
+            return false;
+        }
+
+        auto& queued = it->second;
+        switch (this->coalescing_rules.at(message->messageType).policy) {
+        case CoalescingPolicy::LatestWins: {
+            EVLOG_debug << "Queued message " << queued->uniqueId() << " is replaced by " << message->uniqueId();
+            // the superseded message is reported like a message that could not be sent while offline
+            EnhancedMessage<M> superseded;
+            superseded.offline = true;
+            queued->set_result(superseded);
+            queued->message = std::move(message->message);
+            queued->promise = std::move(message->promise);
+            queued->message_attempts = 0;
+            queued->initial_unique_id = message->initial_unique_id;
+            break;
+        }
+        case CoalescingPolicy::FirstWins:
+            EVLOG_debug << "Message " << message->uniqueId() << " is discarded because " << queued->uniqueId()
+                        << " is queued";
+            queued->coalesced_promises.push_back(std::move(message->promise));
+            break;
+        }
+        return true;
+    }
+
+    /// \brief Removes the given \p message that has been taken from the normal_message_queue from the
+    /// coalescing_index
+    void remove_from_coalescing_index(const std::shared_ptr<ControlMessage<M>>& message) {
+        if (this->coalescing_index.empty()) {
+            return;
+        }
+        const auto key = this->get_coalescing_key(*message);
+        if (!key.has_value()) {
+            return;
+        }
+        const auto it = this->coalescing_index.find({message->messageType, key.value()});
+        if (it != this->coalescing_index.end() && it->second == message) {
+            this->coalescing_index.erase(it);
+        }
+    }
+
+    /// \brief Creates the ControlMessage of the given \p call. Its payload is serialized to json text right away,
+    /// only transaction messages and messages with a coalescing rule keep it as json object, since these are persisted,
+    /// compacted or looked up by their payload while they are queued.
+    template <class T> std::shared_ptr<ControlMessage<M>> make_call_message(const Call<T>& call) {
+        auto message = std::make_shared<ControlMessage<M>>(
+            json{MessageTypeId::CALL, call.uniqueId.get(), call.msg.get_type(), json::object()});
+        bool keep_json;
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            keep_json = message->isTransactionMessage() || this->coalescing_rules.count(message->messageType) > 0;
+        }
+        if (keep_json) {
+            message->message.at(CALL_PAYLOAD) = call.msg;
+        } else {
+            message->serialized_payload = to_json_string(call.msg);
+        }
+        return message;
+    }
+
+    /// \brief Adds the given CALL \p control_message to the transaction or normal message queue
+    void add_to_message_queue(std::shared_ptr<ControlMessage<M>> control_message) {
+        if (control_message->isTransactionMessage()) {
+            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
+            // MeterValues have to be delivered in chronological order
+
+            // intentionally break this message for testing...
+            // message->message[CALL_PAYLOAD]["broken"] = this->createMessageId();
+            this->add_to_transaction_message_queue(control_message);
+        } else {
+            // all other messages are allowed to "jump the queue" to improve user experience
+            // TODO: decide if we only want to allow this for a subset of messages
+            if (!this->paused || this->resuming || this->config.queue_all_messages ||
+                control_message->messageType == M::BootNotification) {
+                this->add_to_normal_message_queue(control_message);
+            }
+        }
+        this->cv.notify_all();
+    }
+
     void add_to_normal_message_queue(std::shared_ptr<ControlMessage<M>> message) {
         EVLOG_debug << "Adding message to normal message queue";
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            if (this->coalesce_normal_message(message)) {
+                return;
+            }
             // A BootNotification message should always jump the queue
             if (message->messageType == M::BootNotification) {
                 this->normal_message_queue.push_front(message);
@@ -182,18 +722,20 @@ private:
         EVLOG_debug << "Adding message to transaction message queue";
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-            this->transaction_message_queue.push_back(message);
-            ocpp::common::DBTransactionMessage db_message{message->message, messagetype_to_string(message->messageType),
-                                                          message->message_attempts, message->timestamp,
-                                                          message->uniqueId()};
-            try {
-                this->database_handler->insert_transaction_message(db_message);
-            } catch (const QueryExecutionException& e) {
-                EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
+            if (this->merge_into_compaction_target(*message)) {
+                return;
             }
+            this->transaction_message_queue.push_back(message);
+            this->index_transaction_message(message);
+            this->open_compaction_target(message);
+            this->transaction_queue_writer.insert(this->to_db_transaction_message(*message, message->uniqueId()));
             this->new_message = true;
             this->check_queue_sizes();
         }
+        if (message->isTransactionEndMessage()) {
+            // the end of a transaction must survive a power loss, wait until it has been committed
+            this->transaction_queue_writer.flush();
+        }
         this->cv.notify_all();
         EVLOG_debug << "Notified message queue worker";
     }
@@ -203,6 +745,7 @@ private:
             this->config.queues_total_size_threshold) {
             return;
         }
+
         EVLOG_warning << "Queue sizes exceed threshold (" << this->config.queues_total_size_threshold << ") with "
                       << this->transaction_message_queue.size() << " transaction and "
                       << this->normal_message_queue.size() << " normal messages in queue";
@@ -219,6 +762,143 @@ private:
         }
     }
 
+    /// \brief Returns the number of meter values in the payload of the given \p message
+    static size_t count_meter_values(const ControlMessage<M>& message) {
+        const auto& payload = message.message.at(CALL_PAYLOAD);
+        const auto meter_values = payload.find("meterValue");
+        if (meter_values == payload.end() || !meter_values->is_array()) {
+            return 0;
+        }
+        return meter_values->size();
+    }
+
+    /// \brief Checks if the payloads \p target_payload and \p payload of two transaction update messages only differ
+    /// in the members that are allowed to differ when they are merged: their meter values, sequence number, timestamp
+    /// and offline flag. A sequence number of \p payload must directly follow the one of \p target_payload.
+    static bool is_mergeable(const json& target_payload, const json& payload) {
+        static const std::set<std::string> merged_members = {"meterValue", "seqNo", "timestamp", "offline"};
+        if (!target_payload.is_object() || !payload.is_object()) {
+            return false;
+        }
+        const auto seq_no = payload.find("seqNo");
+        const auto target_seq_no = target_payload.find("seqNo");
+        if (seq_no != payload.end() || target_seq_no != target_payload.end()) {
+            if (seq_no == payload.end() || target_seq_no == target_payload.end() || !seq_no->is_number_integer() ||
+                !target_seq_no->is_number_integer() ||
+                seq_no->get<int64_t>() != target_seq_no->get<int64_t>() + 1) {
+                return false;
+            }
+        }
+        for (const auto& [key, value] : payload.items()) {
+            if (merged_members.count(key) == 0 && (!target_payload.contains(key) || target_payload.at(key) != value)) {
+                return false;
+            }
+        }
+        for (const auto& [key, value] : target_payload.items()) {
+            if (merged_members.count(key) == 0 && !payload.contains(key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Makes the given \p message that has just been queued the message following update messages of its
+    /// transaction are merged into, if it is an update message
+    void open_compaction_target(const std::shared_ptr<ControlMessage<M>>& message) {
+        if (this->config.transaction_update_compaction_items_per_message <= 0) {
+            return;
+        }
+        const auto indexed = this->transaction_message_index.find(message->uniqueId().get());
+        if (indexed == this->transaction_message_index.end() || indexed->second.message != message ||
+            !indexed->second.is_update_message || !indexed->second.transaction_id.has_value()) {
+            return;
+        }
+        this->compaction_targets[indexed->second.transaction_id.value()] = {message, count_meter_values(*message),
+                                                                           std::nullopt};
+    }
+
+    /// \brief Merges the meter values of the transaction update \p message into the last queued message of its
+    /// transaction instead of queueing it, if the queues are at their size threshold, that message is an update
+    /// message that has not been sent yet and the result stays within the configured limits. The persisted message is
+    /// updated in place. The promise of a merged \p message is fulfilled like that of a message that could not be sent.
+    /// The sequence number of a merged \p message is taken back, so the next message of the transaction gets it and
+    /// the CSMS sees no gap. Messages whose sequence number can not be taken back are not merged.
+    /// \returns true if the message has been merged
+    bool merge_into_compaction_target(ControlMessage<M>& message) {
+        const auto queued_messages = this->transaction_message_queue.size() + this->normal_message_queue.size();
+        if (this->compaction_targets.empty() || queued_messages < this->config.queues_total_size_threshold ||
+            !message.isTransactionUpdateMessage()) {
+            return false;
+        }
+        const auto transaction_id = message.transactionId();
+        if (!transaction_id.has_value()) {
+            return false;
+        }
+        const auto it = this->compaction_targets.find(transaction_id.value());
+        if (it == this->compaction_targets.end()) {
+            return false;
+        }
+        auto& target = it->second;
+        if (target.message->message_attempts > 0 || target.message == this->in_flight) {
+            // sent messages can not be changed anymore
+            this->compaction_targets.erase(it);
+            return false;
+        }
+
+        const auto items = count_meter_values(message);
+        if (items == 0 ||
+            target.items + items > static_cast<size_t>(this->config.transaction_update_compaction_items_per_message)) {
+            return false;
+        }
+        auto& target_payload = target.message->message.at(CALL_PAYLOAD);
+        const auto& payload = message.message.at(CALL_PAYLOAD);
+        if (!is_mergeable(target_payload, payload)) {
+            return false;
+        }
+
+        const auto& meter_values = payload.at("meterValue");
+        std::optional<size_t> bytes;
+        if (this->config.transaction_update_compaction_bytes_per_message > 0) {
+            if (!target.bytes.has_value()) {
+                target.bytes = json(target.message->message).dump().size();
+            }
+            bytes = target.bytes.value();
+            for (const auto& meter_value : meter_values) {
+                // the meter value and the separating comma
+                bytes.value() += meter_value.dump().size() + 1;
+            }
+            if (bytes.value() > static_cast<size_t>(this->config.transaction_update_compaction_bytes_per_message)) {
+                return false;
+            }
+        }
+
+        const auto seq_no = payload.find("seqNo");
+        if (seq_no != payload.end() &&
+            (!this->sequence_number_rollback ||
+             !this->sequence_number_rollback(transaction_id.value(), seq_no->template get<int32_t>()))) {
+            return false;
+        }
+
+        auto& target_meter_values = target_payload.at("meterValue");
+        target_meter_values.insert(target_meter_values.end(), meter_values.begin(), meter_values.end());
+        if (payload.value("offline", false)) {
+            target_payload["offline"] = true;
+        }
+        target.items += items;
+        target.bytes = bytes;
+
+        const auto& merged = *target.message;
+        this->transaction_queue_writer.replace({merged.initial_unique_id},
+                                               this->to_db_transaction_message(merged, merged.initial_unique_id));
+        EVLOG_debug << "Merged transactional update message " << message.initial_unique_id << " into "
+                    << merged.initial_unique_id << " to limit the queue size";
+        // the merged message is reported like a message that could not be sent while offline
+        EnhancedMessage<M> merged_away;
+        merged_away.offline = true;
+        message.promise.set_value(merged_away);
+        return true;
+    }
+
     void drop_messages_from_normal_message_queue() {
         // try to drop approx 10% of the allowed size (at least 1)
         int number_of_dropped_messages = std::min((int)this->normal_message_queue.size(),
@@ -227,6 +907,7 @@ private:
         EVLOG_warning << "Dropping " << number_of_dropped_messages << " messages from normal message queue.";
 
         for (int i = 0; i < number_of_dropped_messages; i++) {
+            this->remove_from_coalescing_index(this->normal_message_queue.front());
             this->normal_message_queue.pop_front();
         }
     }
@@ -238,24 +919,28 @@ private:
      * Cf. OCPP 2.0.1. specification 2.1.9 "QueueAllMessages"
      */
     bool drop_update_messages_from_transactional_message_queue() {
+        if (this->transaction_update_message_count == 0) {
+            EVLOG_warning << "There are no further transaction update messages to drop!";
+            return false;
+        }
+
         int drop_count = 0;
         std::deque<std::shared_ptr<ControlMessage<M>>> temporary_swap_queue;
         bool remove_next_update_message = true;
+        size_t position = 0;
+        size_t dropped_replayed_messages = 0;
         while (!transaction_message_queue.empty()) {
             auto element = transaction_message_queue.front();
             transaction_message_queue.pop_front();
+            const bool replayed = position++ < this->replayed_message_count;
             // drop every second update message (except last one)
             if (remove_next_update_message && element->isTransactionUpdateMessage() &&
                 transaction_message_queue.size() > 1) {
                 EVLOG_debug << "Drop transactional message " << element->initial_unique_id;
-                try {
-                    database_handler->remove_transaction_message(element->initial_unique_id);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
+                this->unindex_transaction_message(element->uniqueId().get());
+                this->transaction_queue_writer.remove(element->initial_unique_id);
                 drop_count++;
+                dropped_replayed_messages += replayed ? 1 : 0;
                 remove_next_update_message = false;
             } else {
                 remove_next_update_message = true;
@@ -264,6 +949,7 @@ private:
         }
 
         std::swap(transaction_message_queue, temporary_swap_queue);
+        this->replayed_message_count -= dropped_replayed_messages;
 
         if (drop_count > 0) {
             EVLOG_warning << "Dropped " << drop_count << " transactional update messages to reduce queue size.";
@@ -293,19 +979,34 @@ private:
 
 public:
     /// \brief Creates a new MessageQueue object with the provided \p configuration and \p send_callback
-    MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig& config,
+    MessageQueue(const MessageSendCallback& send_callback, const MessageQueueConfig& config,
                  const std::vector<M>& external_notify,
                  std::shared_ptr<common::DatabaseHandlerCommon> database_handler) :
         database_handler(std::move(database_handler)),
+        transaction_queue_writer(this->database_handler,
+                                 std::chrono::milliseconds(config.transaction_message_commit_interval_ms),
+                                 config.transaction_message_commit_batch_size),
         config(config),
         external_notify(external_notify),
         paused(true),
         resuming(false),
         running(true),
         new_message(false),
+        replies_pending(false),
+        send_blocked(false),
+        message_written(false),
         uuid_generator(boost::uuids::random_generator()) {
 
         this->send_callback = send_callback;
+        this->send_notifier = std::make_shared<SendNotifier>();
+        this->send_notifier->queue = this;
+        this->on_sent = [notifier = this->send_notifier](bool) {
+            std::lock_guard<std::mutex> lk(notifier->mutex);
+            if (notifier->queue != nullptr) {
+                notifier->queue->message_written = true;
+                notifier->queue->cv.notify_all();
+            }
+        };
         this->in_flight = nullptr;
         this->worker_thread = std::thread([this]() {
             // TODO(kai): implement message timeout
@@ -314,10 +1015,28 @@ public:
 
                 std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
                 using namespace std::chrono_literals;
+                if (this->send_blocked) {
+                    // the outbound queue of the websocket is full, wait until it has written one of our messages
+                    this->cv.wait_for(lk, SEND_RETRY_INTERVAL,
+                                      [this]() { return !this->running || this->message_written.load(); });
+                    this->send_blocked = false;
+                }
+                // only messages written after this point free up room for the messages handed over below
+                this->message_written = false;
+
                 // It's safe to wait on the cv here because we're guaranteed to only lock this->message_mutex once
                 this->cv.wait(lk, [this]() {
-                    return !this->running || (!this->paused && this->new_message && this->in_flight == nullptr);
+                    return !this->running ||
+                           (!this->paused && ((this->new_message && this->in_flight == nullptr) ||
+                                              this->replies_pending.load()));
                 });
+                if (!this->running) {
+                    continue;
+                }
+                if (!this->send_pending_replies()) {
+                    // The outbound queue of the websocket is full, not progressing further
+                    continue;
+                }
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     // There is nothing in the message queue, not progressing further
                     continue;
@@ -405,9 +1124,18 @@ public:
                     this->in_flight->message.at(3)["transactionId"] =
                         this->message_id_transaction_id_map.at(this->in_flight->message.at(1));
                     this->message_id_transaction_id_map.erase(this->in_flight->message.at(1));
+                    this->reindex_transaction_message(this->in_flight);
                 }
 
-                if (!this->send_callback(this->in_flight->message)) {
+                const auto send_result = this->hand_over_call(*this->in_flight);
+                if (send_result == WebsocketSendResult::WouldBlock) {
+                    // the message stays at the front of its queue and is handed over again once there is room
+                    EVLOG_debug << "Outbound queue of the websocket is full, message will be sent later. UID: "
+                                << this->in_flight->uniqueId();
+                    this->in_flight->message_attempts -= 1;
+                    this->reset_in_flight();
+                    this->send_blocked = true;
+                } else if (send_result == WebsocketSendResult::Failed) {
                     this->paused = true;
                     EVLOG_error << "Could not send message, this is most likely because the charge point is offline.";
                     if (this->in_flight && this->in_flight->isTransactionMessage()) {
@@ -424,7 +1152,8 @@ public:
                         if (queue_type == QueueType::Normal) {
                             EnhancedMessage<M> enhanced_message;
                             enhanced_message.offline = true;
-                            this->in_flight->promise.set_value(enhanced_message);
+                            this->in_flight->set_result(enhanced_message);
+                            this->remove_from_coalescing_index(this->normal_message_queue.front());
                             this->normal_message_queue.pop_front();
                         }
                     }
@@ -435,10 +1164,16 @@ public:
                                                           this->current_message_timeout(message->message_attempts));
                     switch (queue_type) {
                     case QueueType::Normal:
+                        this->remove_from_coalescing_index(this->normal_message_queue.front());
                         this->normal_message_queue.pop_front();
                         break;
                     case QueueType::Transaction:
+                        this->unindex_transaction_message(this->transaction_message_queue.front()->uniqueId().get());
                         this->transaction_message_queue.pop_front();
+                        if (this->replayed_message_count > 0) {
+                            this->replayed_message_count--;
+                        }
+                        this->replay_transaction_messages();
                         break;
 
                     default:
@@ -455,46 +1190,85 @@ public:
         });
     }
 
+    /// \brief Creates a new MessageQueue object with a \p send_callback that only reports if a message could be sent,
+    /// a message it did not send is handled as if the charging station is offline
+    MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig& config,
+                 const std::vector<M>& external_notify,
+                 std::shared_ptr<common::DatabaseHandlerCommon> database_handler) :
+        MessageQueue(
+            [send_callback](const json& message, const std::function<void(bool sent)>&) {
+                return send_callback(message) ? WebsocketSendResult::Accepted : WebsocketSendResult::Failed;
+            },
+            config, external_notify, std::move(database_handler)) {
+    }
+
     MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig& config,
                  std::shared_ptr<common::DatabaseHandlerCommon> databaseHandler) :
         MessageQueue(send_callback, config, {}, databaseHandler) {
     }
 
+    /// \brief Sets the \p write_callback that is used to send CallResult and CallError messages and calls whose payload
+    /// has been serialized when they were pushed. It receives a function writing the message using its generated
+    /// write_json, so it can be serialized straight into the outgoing buffer without creating a json object first.
+    /// Without this callback these messages are sent using the send_callback.
+    void set_write_callback(const MessageWriteCallback& write_callback) {
+        this->write_callback = write_callback;
+    }
+
+    /// \brief Sets the \p raw_message_types: received CALL messages of these types are not parsed into a json object,
+    /// but passed on in EnhancedMessage::raw_message so they can be read directly into their typed representation
+    void set_raw_message_types(const std::set<M>& raw_message_types) {
+        this->raw_message_types = raw_message_types;
+    }
+
+    /// \brief Sets the coalescing \p rule for messages of the given \p message_type . While a message of this type is
+    /// waiting in the normal message queue, further messages of this type with the same coalescing key are coalesced
+    /// with it instead of being queued. Should be set before messages are pushed.
+    void set_coalescing_rule(M message_type, const CoalescingRule& rule) {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->coalescing_rules[message_type] = rule;
+    }
+
+    /// \brief Sets the \p rollback that takes back the sequence number of a transaction update message that is merged
+    /// into the previous queued message of its transaction. Without it, messages carrying a sequence number are never
+    /// merged.
+    void set_sequence_number_rollback(const SequenceNumberRollback& rollback) {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->sequence_number_rollback = rollback;
+    }
+
     /// \brief Resets next message to send. Can be used in situation when we dont want to reply to a CALL message
     void reset_next_message_to_send() {
         std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
         this->next_message_to_send.reset();
     }
 
+    /// \brief Queues the persisted transaction messages in front of the transaction messages that are queued after
+    /// this call. They are read from the database in the order they have been persisted, at most
+    /// MessageQueueConfig::transaction_message_replay_window at a time, and the following ones as the queue drains.
     void get_transaction_messages_from_db(bool ignore_security_event_notifications = false) {
-        std::vector<ocpp::common::DBTransactionMessage> transaction_messages =
-            database_handler->get_transaction_messages();
-
-        if (!transaction_messages.empty()) {
-            for (auto& transaction_message : transaction_messages) {
-
-                if (ignore_security_event_notifications &&
-                    transaction_message.message_type == "SecurityEventNotification") {
-                    try {
-                        // remove from database in case SecurityEventNotification.req should not be sent
-                        this->database_handler->remove_transaction_message(transaction_message.unique_id);
-                    } catch (const QueryExecutionException& e) {
-                        EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                    } catch (const std::exception& e) {
-                        EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                    }
-                } else {
-                    std::shared_ptr<ControlMessage<M>> message =
-                        std::make_shared<ControlMessage<M>>(transaction_message.json_message);
-                    message->messageType = string_to_messagetype(transaction_message.message_type);
-                    message->timestamp = transaction_message.timestamp;
-                    message->message_attempts = transaction_message.message_attempts;
-                    transaction_message_queue.push_back(message);
-                }
-            }
-
-            this->new_message = true;
+        this->transaction_queue_writer.flush();
+        int64_t end_sequence = 0;
+        try {
+            end_sequence = this->database_handler->get_last_transaction_message_sequence();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not get queued transaction messages from database: " << e.what();
+        }
+        if (end_sequence <= 0) {
+            return;
+        }
+        // read without holding the message_mutex, messages queued meanwhile are persisted after end_sequence
+        auto unreplayed_counts = this->count_persisted_transaction_messages(end_sequence);
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            this->unreplayed_transaction_message_counts = std::move(unreplayed_counts);
+            this->replay_end_sequence = end_sequence;
+            this->replay_sequence = 0;
+            this->replayed_message_count = 0;
+            this->replay_ignore_security_event_notifications = ignore_security_event_notifications;
+            this->replay_transaction_messages();
         }
+        this->cv.notify_all();
     }
 
     /// \brief pushes a new \p call message onto the message queue
@@ -502,8 +1276,7 @@ public:
         if (!running) {
             return;
         }
-        json call_json = call;
-        push(call_json);
+        this->add_to_message_queue(this->make_call_message(call));
     }
 
     void push(const json& message) {
@@ -511,23 +1284,21 @@ public:
             return;
         }
 
-        auto control_message = std::make_shared<ControlMessage<M>>(message);
-        if (control_message->isTransactionMessage()) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
+        this->add_to_message_queue(std::make_shared<ControlMessage<M>>(message));
+    }
 
-            // intentionally break this message for testing...
-            // message->message[CALL_PAYLOAD]["broken"] = this->createMessageId();
-            this->add_to_transaction_message_queue(control_message);
-        } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (!this->paused || this->resuming || this->config.queue_all_messages ||
-                control_message->messageType == M::BootNotification) {
-                this->add_to_normal_message_queue(control_message);
-            }
+    /// \brief pushes a new non-transactional CALL message of the given \p message_type with the given \p unique_id
+    /// onto the message queue. Its \p payload has already been serialized to json text and is handed over to the
+    /// websocket as it is. The call_message of the EnhancedMessage of its response contains an empty payload.
+    void push_serialized(M message_type, const MessageId& unique_id, std::string&& payload) {
+        if (!running) {
+            return;
         }
-        this->cv.notify_all();
+
+        auto control_message = std::make_shared<ControlMessage<M>>(json{
+            MessageTypeId::CALL, unique_id, std::string(this->messagetype_to_string(message_type)), json::object()});
+        control_message->serialized_payload = std::move(payload);
+        this->add_to_message_queue(control_message);
     }
 
     /// \brief Sends a new \p call_result message over the websocket
@@ -536,7 +1307,7 @@ public:
             return;
         }
 
-        this->send_callback(call_result);
+        this->send_reply(call_result);
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -555,7 +1326,7 @@ public:
             return;
         }
 
-        this->send_callback(call_error);
+        this->send_reply(call_error);
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -571,7 +1342,9 @@ public:
     /// \brief pushes a new \p call message onto the message queue
     /// \returns a future from which the CallResult can be extracted
     template <class T> std::future<EnhancedMessage<M>> push_async(Call<T> call) {
-        auto message = std::make_shared<ControlMessage<M>>(call);
+        auto message = this->make_call_message(call);
+        // taken before the message is queued, since a coalesced message hands its promise over to the queued message
+        auto future = message->promise.get_future();
 
         if (!running) {
             auto enhanced_message = EnhancedMessage<M>();
@@ -593,7 +1366,7 @@ public:
                 this->add_to_normal_message_queue(message);
             }
         }
-        return message->promise.get_future();
+        return future;
     }
 
     /// \brief Enhances a received \p json_message with additional meta information, checks if it is a valid CallResult
@@ -603,14 +1376,21 @@ public:
         EnhancedMessage<M> enhanced_message;
 
         try {
-            enhanced_message.message = json::parse(message);
-            enhanced_message.uniqueId = this->getMessageId(enhanced_message.message);
-            enhanced_message.messageTypeId = this->getMessageTypeId(enhanced_message.message);
+            if (!this->read_raw_call(message, enhanced_message)) {
+                enhanced_message.message = json::parse(message);
+                enhanced_message.uniqueId = this->getMessageId(enhanced_message.message);
+                enhanced_message.messageTypeId = this->getMessageTypeId(enhanced_message.message);
+                if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
+                    enhanced_message.messageType =
+                        this->string_to_messagetype(enhanced_message.message.at(CALL_ACTION));
+                }
+            }
 
             if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
-                enhanced_message.messageType = this->string_to_messagetype(enhanced_message.message.at(CALL_ACTION));
-                enhanced_message.call_message = enhanced_message.message;
-
+                if (this->config.strict_message_validation) {
+                    enhanced_message.validation_error =
+                        this->validate(message, enhanced_message.messageType, CALL_PAYLOAD);
+                }
                 {
                     std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
                     // save the uid of the message we just received to ensure the next message we send is a response to
@@ -640,6 +1420,17 @@ public:
                                 << this->in_flight->uniqueId() << " != " << enhanced_message.uniqueId;
                     return enhanced_message;
                 }
+                if (this->config.strict_message_validation &&
+                    enhanced_message.messageTypeId == MessageTypeId::CALLRESULT) {
+                    const auto response_type = this->string_to_messagetype(
+                        this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
+                    enhanced_message.validation_error = this->validate(message, response_type, CALLRESULT_PAYLOAD);
+                    if (!enhanced_message.validation_error.empty()) {
+                        EVLOG_error << "Received an invalid CALLRESULT for message with UID: "
+                                    << enhanced_message.uniqueId << ": " << enhanced_message.validation_error;
+                        enhanced_message.messageTypeId = MessageTypeId::CALLERROR;
+                    }
+                }
                 if (enhanced_message.messageTypeId == MessageTypeId::CALLERROR) {
                     EVLOG_error << "Received a CALLERROR for message with UID: " << enhanced_message.uniqueId;
                     // make sure the original call message is attached to the callerror
@@ -659,6 +1450,79 @@ public:
         return enhanced_message;
     }
 
+    /// \brief Hands the \p reply to a CALL of the CSMS over to the websocket. Replies must not be dropped, so it is
+    /// queued for the worker if the outbound queue of the websocket is full or earlier replies are still waiting.
+    template <class R> void send_reply(const R& reply) {
+        {
+            std::lock_guard<std::mutex> lk(this->pending_replies_mutex);
+            if (this->pending_replies.empty()) {
+                const auto result = this->hand_over_reply(reply);
+                if (result == WebsocketSendResult::Failed) {
+                    EVLOG_warning << "Could not send reply with id " << reply.uniqueId
+                                  << ", the charging station is offline";
+                }
+                if (result != WebsocketSendResult::WouldBlock) {
+                    return;
+                }
+            }
+            this->pending_replies.push_back([this, reply]() { return this->hand_over_reply(reply); });
+            this->replies_pending = true;
+        }
+        // taken so the worker can not miss the notification between checking for pending replies and waiting
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->cv.notify_all();
+    }
+
+    template <class R> WebsocketSendResult hand_over_reply(const R& reply) {
+        if (this->write_callback != nullptr) {
+            return this->write_callback([&reply](JsonWriter& writer) { writer.value(reply); }, this->on_sent);
+        }
+        return this->send_callback(reply, this->on_sent);
+    }
+
+    /// \brief Hands the CALL \p message over to the websocket. A serialized payload is written as it is if there is a
+    /// write_callback, otherwise it has to be parsed again to be passed to the send_callback
+    WebsocketSendResult hand_over_call(const ControlMessage<M>& message) {
+        if (message.serialized_payload.empty()) {
+            return this->send_callback(message.message, this->on_sent);
+        }
+        if (this->write_callback != nullptr) {
+            return this->write_callback(
+                [&message](JsonWriter& writer) {
+                    writer.begin_array();
+                    for (size_t i = 0; i < CALL_PAYLOAD; i++) {
+                        writer.value(message.message.at(i));
+                    }
+                    writer.raw(message.serialized_payload);
+                    writer.end_array();
+                },
+                this->on_sent);
+        }
+        json call = message.message;
+        call.at(CALL_PAYLOAD) = json::parse(message.serialized_payload);
+        return this->send_callback(call, this->on_sent);
+    }
+
+    /// \brief Hands the pending replies over to the websocket in the order they have been pushed. Expects the
+    /// message_mutex to be held.
+    /// \returns false if the outbound queue of the websocket is full
+    bool send_pending_replies() {
+        std::lock_guard<std::mutex> lk(this->pending_replies_mutex);
+        while (!this->pending_replies.empty()) {
+            const auto result = this->pending_replies.front()();
+            if (result == WebsocketSendResult::WouldBlock) {
+                this->send_blocked = true;
+                return false;
+            }
+            if (result == WebsocketSendResult::Failed) {
+                EVLOG_warning << "Could not send reply, the charging station is offline";
+            }
+            this->pending_replies.pop_front();
+        }
+        this->replies_pending = false;
+        return true;
+    }
+
     void reset_in_flight() {
         this->in_flight = nullptr;
         this->in_flight_timeout_timer.stop();
@@ -669,18 +1533,12 @@ public:
             enhanced_message.call_message = this->in_flight->message;
             enhanced_message.messageType = this->string_to_messagetype(
                 this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
-            this->in_flight->promise.set_value(enhanced_message);
+            this->in_flight->set_result(enhanced_message);
 
             if (this->in_flight->isTransactionMessage()) {
-                try {
-                    // We only remove the message as soon as a response is received. Otherwise we might miss a message
-                    // if the charging station just boots after sending, but before receiving the result.
-                    this->database_handler->remove_transaction_message(this->in_flight->initial_unique_id);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
+                // We only remove the message as soon as a response is received. Otherwise we might miss a message
+                // if the charging station just boots after sending, but before receiving the result.
+                this->transaction_queue_writer.remove(this->in_flight->initial_unique_id);
             }
             this->reset_in_flight();
 
@@ -730,7 +1588,7 @@ public:
                               << this->config.transaction_message_attempts << " will be sent at "
                               << this->in_flight->timestamp;
 
-                this->transaction_message_queue.push_front(this->in_flight);
+                this->requeue_transaction_message(this->in_flight);
                 this->notify_queue_timer.at(
                     [this]() {
                         this->new_message = true;
@@ -741,20 +1599,14 @@ public:
                 EVLOG_error << "Could not deliver message within the configured amount of attempts, "
                                "dropping message";
                 if (enhanced_message_opt) {
-                    this->in_flight->promise.set_value(enhanced_message_opt.value());
+                    this->in_flight->set_result(enhanced_message_opt.value());
                 } else {
                     EnhancedMessage<M> enhanced_message;
                     enhanced_message.offline = true;
-                    this->in_flight->promise.set_value(enhanced_message);
-                }
-                try {
-                    // also drop the message from the database
-                    this->database_handler->remove_transaction_message(this->in_flight->initial_unique_id);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+                    this->in_flight->set_result(enhanced_message);
                 }
+                // also drop the message from the database
+                this->transaction_queue_writer.remove(this->in_flight->initial_unique_id);
             }
         } else if (this->in_flight->isBootNotificationMessage()) {
             EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
@@ -765,7 +1617,7 @@ public:
             this->in_flight->timestamp =
                 DateTime(this->in_flight->timestamp.to_time_point() +
                          std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
-            this->transaction_message_queue.push_front(this->in_flight);
+            this->requeue_transaction_message(this->in_flight);
             this->notify_queue_timer.at(
                 [this]() {
                     this->new_message = true;
@@ -775,11 +1627,11 @@ public:
         } else {
             EVLOG_warning << "Message is not transaction related, dropping it";
             if (enhanced_message_opt) {
-                this->in_flight->promise.set_value(enhanced_message_opt.value());
+                this->in_flight->set_result(enhanced_message_opt.value());
             } else {
                 EnhancedMessage<M> enhanced_message;
                 enhanced_message.offline = true;
-                this->in_flight->promise.set_value(enhanced_message);
+                this->in_flight->set_result(enhanced_message);
             }
         }
         this->reset_in_flight();
@@ -793,6 +1645,11 @@ public:
         this->running = false;
         this->cv.notify_one();
         this->worker_thread.join();
+        {
+            std::lock_guard<std::mutex> lk(this->send_notifier->mutex);
+            this->send_notifier->queue = nullptr;
+        }
+        this->transaction_queue_writer.flush();
         EVLOG_debug << "stop() notified message queue";
     }
 
@@ -804,6 +1661,16 @@ public:
         this->resume_timer.stop();
         this->paused = true;
         this->resuming = false;
+        {
+            // replies to CALLs of a closed connection can not be delivered anymore
+            std::lock_guard<std::mutex> replies_lk(this->pending_replies_mutex);
+            if (!this->pending_replies.empty()) {
+                EVLOG_warning << "Dropping " << this->pending_replies.size()
+                              << " replies that could not be sent before the connection was closed";
+                this->pending_replies.clear();
+                this->replies_pending = false;
+            }
+        }
         this->cv.notify_one();
         EVLOG_debug << "pause() notified message queue";
     }
@@ -830,33 +1697,23 @@ public:
 
     bool is_transaction_message_queue_empty() {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        return this->transaction_message_queue.empty();
+        return this->transaction_message_queue.empty() && !this->replay_end_sequence.has_value();
     }
 
     bool contains_transaction_messages(const CiString<36> transaction_id) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        for (const auto control_message : this->transaction_message_queue) {
-            if (control_message->messageType == v201::MessageType::TransactionEvent) {
-                v201::TransactionEventRequest req = control_message->message.at(CALL_PAYLOAD);
-                if (req.transactionInfo.transactionId == transaction_id) {
-                    return true;
-                }
-            }
-        }
-        return false;
+        return this->transaction_message_counts.count(transaction_id.get()) > 0 ||
+               this->unreplayed_transaction_message_counts.count(transaction_id.get()) > 0;
     }
 
     bool contains_stop_transaction_message(const int32_t transaction_id) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        for (const auto control_message : this->transaction_message_queue) {
-            if (control_message->messageType == v16::MessageType::StopTransaction) {
-                v16::StopTransactionRequest req = control_message->message.at(CALL_PAYLOAD);
-                if (req.transactionId == transaction_id) {
-                    return true;
-                }
-            }
-        }
-        return false;
+        const auto has_end_message = [key = std::to_string(transaction_id)](const auto& counts_by_transaction) {
+            const auto it = counts_by_transaction.find(key);
+            return it != counts_by_transaction.end() and it->second.end_messages > 0;
+        };
+        return has_end_message(this->transaction_message_counts) ||
+               has_end_message(this->unreplayed_transaction_message_counts);
     }
 
     /// \brief Set transaction_message_attempts to given \p transaction_message_attempts
@@ -909,22 +1766,25 @@ public:
         // this is necessary when the chargepoint queued MeterValue.req for a transaction with unknown transaction_id
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         if (this->start_transaction_mid_meter_values_mid_map.count(start_transaction_message_id)) {
-            for (auto it = this->transaction_message_queue.begin(); it != transaction_message_queue.end(); ++it) {
-                for (const auto& meter_value_message_id :
-                     this->start_transaction_mid_meter_values_mid_map.at(start_transaction_message_id)) {
-
-                    if (meter_value_message_id == (*it)->message.at(1)) {
-                        EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
-                        (*it)->message.at(3)["transactionId"] = transaction_id;
-                    }
+            for (const auto& meter_value_message_id :
+                 this->start_transaction_mid_meter_values_mid_map.at(start_transaction_message_id)) {
+                const auto it = this->transaction_message_index.find(meter_value_message_id);
+                if (it == this->transaction_message_index.end()) {
+                    continue;
                 }
+                const auto message = it->second.message;
+                EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
+                message->message.at(3)["transactionId"] = transaction_id;
+                this->reindex_transaction_message(message);
             }
         }
         this->start_transaction_mid_meter_values_mid_map.erase(start_transaction_message_id);
     }
 
     M string_to_messagetype(const std::string& s);
-    std::string messagetype_to_string(M m);
+    std::string_view messagetype_to_string(M m);
+    /// \brief Validates the next value of the given \p validator against the schema of the payload of \p message_type
+    void validate_payload(M message_type, JsonValidator& validator);
 };
 
 } // namespace ocpp
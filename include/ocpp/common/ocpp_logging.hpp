@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <ocpp/common/types.hpp>
+#include <string_view>
 #include <thread>
 
 namespace ocpp {
@@ -55,6 +56,8 @@ public:
     ~MessageLogging();
 
     void charge_point(const std::string& message_type, const std::string& json_str);
+    /// \brief Logs a message sent to the CSMS. The \p json_str is only copied if message logging is active
+    void charge_point(const std::string& message_type, std::string_view json_str);
     void central_system(const std::string& message_type, const std::string& json_str);
     void sys(const std::string& msg);
     void security(const std::string& msg);
@@ -62,6 +65,8 @@ public:
     void stop_session_logging(const std::string& session_id);
     std::string get_message_log_path();
     bool session_logging_active();
+    /// \brief Returns true if logged messages are written or passed to the message callback
+    bool message_logging_active();
 };
 
 } // namespace ocpp
@@ -3,56 +3,120 @@
 #ifndef OCPP_COMMON_STRING_HPP
 #define OCPP_COMMON_STRING_HPP
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 
+/// \brief Strings with a maximum length of up to this many characters are stored inline instead of on the heap
+constexpr size_t MAX_INLINE_STRING_LENGTH = 64;
+
+namespace detail {
+
+/// \brief Contains the characters of a String with a maximum length of \p L. Short strings are kept in a fixed-capacity
+/// buffer inside the object, so creating and copying them does not allocate.
+template <size_t L, bool Inline = (L <= MAX_INLINE_STRING_LENGTH)> class StringStorage {
+    static_assert(L <= UINT8_MAX, "the length of inline strings is stored in a uint8_t");
+
+private:
+    std::array<char, L> chars{};
+    uint8_t size = 0;
+
+public:
+    std::string_view view() const {
+        return std::string_view(this->chars.data(), this->size);
+    }
+
+    void assign(std::string_view data) {
+        if (!data.empty()) {
+            std::memcpy(this->chars.data(), data.data(), data.size());
+        }
+        this->size = static_cast<uint8_t>(data.size());
+    }
+};
+
+/// \brief Contains the characters of a long String on the heap
+template <size_t L> class StringStorage<L, false> {
+private:
+    std::string chars;
+
+public:
+    std::string_view view() const {
+        return this->chars;
+    }
+
+    void assign(std::string_view data) {
+        this->chars.assign(data.data(), data.size());
+    }
+};
+
+} // namespace detail
+
 /// \brief Contains a String impementation with a maximum length
 template <size_t L> class String {
 private:
-    std::string data;
-    size_t length;
+    detail::StringStorage<L> data;
 
 public:
     /// \brief Creates a string from the given \p data
-    String(const std::string& data) : length(L) {
+    String(const std::string& data) {
         this->set(data);
     }
 
-    String(const char* data) : length(L) {
+    String(std::string_view data) {
         this->set(data);
     }
 
-    /// \brief Creates a string
-    String() : length(L) {
+    String(const char* data) {
+        this->set(data);
     }
 
+    /// \brief Creates a string
+    String() = default;
+
     /// \brief Provides a std::string representation of the string
     /// \returns a std::string
     std::string get() const {
-        return data;
+        return std::string(this->data.view());
+    }
+
+    /// \brief Provides the content of the string without copying it
+    /// \returns a view that is valid until the string is modified or destroyed
+    std::string_view view() const {
+        return this->data.view();
     }
 
     /// \brief Sets the content of the string to the given \p data
-    void set(const std::string& data) {
-        if (data.length() <= this->length) {
+    void set(std::string_view data) {
+        if (data.length() <= L) {
             if (this->is_valid(data)) {
-                this->data = data;
+                this->data.assign(data);
             } else {
                 throw std::runtime_error("String has invalid format");
             }
         } else {
             throw std::runtime_error("String length (" + std::to_string(data.length()) +
-                                     ") exceeds permitted length (" + std::to_string(this->length) + ")");
+                                     ") exceeds permitted length (" + std::to_string(L) + ")");
         }
     }
 
+    void set(const std::string& data) {
+        this->set(std::string_view(data));
+    }
+
+    void set(const char* data) {
+        this->set(std::string_view(data));
+    }
+
     /// \brief Override this to check for a specific format
-    bool is_valid(const std::string& data) {
+    bool is_valid(std::string_view data) {
         (void)data; // not needed here
         return true;
     }
@@ -65,28 +129,28 @@ public:
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const String<L>& lhs, const char* rhs) {
-    return lhs.get() == rhs;
+    return lhs.view() == rhs;
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const String<L>& lhs, const String<L>& rhs) {
-    return lhs.get() == rhs.get();
+    return lhs.view() == rhs.view();
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const String<L>& lhs, const char* rhs) {
-    return !(lhs.get() == rhs);
+    return !(lhs.view() == rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const String<L>& lhs, const String<L>& rhs) {
-    return !(lhs.get() == rhs.get());
+    return !(lhs.view() == rhs.view());
 }
 
 /// \brief Writes the given string \p str to the given output stream \p os
 /// \returns an output stream with the case insensitive string written to
 template <size_t L> std::ostream& operator<<(std::ostream& os, const String<L>& str) {
-    os << str.get();
+    os << str.view();
     return os;
 }
 
@@ -5,11 +5,13 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <nlohmann/json_fwd.hpp>
 
@@ -32,6 +34,27 @@ struct Message {
     virtual std::string get_type() const = 0;
 };
 
+/// \brief Contains the fields of a RFC 3339 date-time string
+struct DateTimeFields {
+    int year;
+    int month;
+    int day;
+    int hour;
+    int minute;
+    int second;          ///< 60 during a leap second
+    int32_t nanoseconds; ///< fractional seconds, digits beyond nanosecond precision are ignored
+    int fraction_digits; ///< number of digits of the fractional seconds
+    bool has_offset;     ///< false if the time offset is missing
+    int offset_minutes;  ///< time offset to UTC in minutes
+};
+
+/// \brief Reads the fields of the RFC 3339 date-time \p str without allocating. Fractional seconds and the time offset
+/// are optional.
+/// \param strict if true, \p str also has to follow the stricter format required by OCPP: an uppercase 'T' and 'Z', at
+/// most three digits of fractional seconds, no leap second and a mandatory time offset
+/// \returns false if \p str is not a date-time or contains an invalid date or time
+bool parse_rfc3339(std::string_view str, DateTimeFields& fields, bool strict = false);
+
 /// \brief Contains a DateTime implementation that can parse and create RFC 3339 compatible strings
 class DateTimeImpl {
 private:
@@ -47,14 +70,23 @@ public:
     explicit DateTimeImpl(std::chrono::time_point<date::utc_clock> timepoint);
 
     /// \brief Creates a new DateTimeImpl object from the given \p timepoint_str
-    explicit DateTimeImpl(const std::string& timepoint_str);
+    explicit DateTimeImpl(std::string_view timepoint_str);
+
+    /// \brief Size of a buffer that can hold every string written by to_rfc3339(char*)
+    static constexpr size_t RFC3339_BUFFER_SIZE = 32;
 
     /// \brief Converts this DateTimeImpl to a RFC 3339 compatible string
     /// \returns a RFC 3339 compatible string representation of the stored DateTime
     std::string to_rfc3339() const;
 
-    /// \brief Sets the timepoint of this DateTimeImpl to the given \p timepoint_str
-    void from_rfc3339(const std::string& timepoint_str);
+    /// \brief Writes this DateTimeImpl as a RFC 3339 compatible string with millisecond precision in UTC to \p out,
+    /// which has to provide RFC3339_BUFFER_SIZE characters. No terminating null character is written.
+    /// \returns the number of characters written
+    size_t to_rfc3339(char* out) const;
+
+    /// \brief Sets the timepoint of this DateTimeImpl to the given \p timepoint_str. A missing time offset is read as
+    /// UTC. The timepoint is left unchanged if \p timepoint_str is not a valid date-time.
+    void from_rfc3339(std::string_view timepoint_str);
 
     /// \brief Converts this DateTimeImpl to a std::chrono::time_point
     /// \returns a std::chrono::time_point
@@ -101,7 +133,7 @@ public:
     explicit DateTime(std::chrono::time_point<date::utc_clock> timepoint);
 
     /// \brief Creates a new DateTime object from the given \p timepoint_str
-    explicit DateTime(const std::string& timepoint_str);
+    explicit DateTime(std::string_view timepoint_str);
 
     /// \brief Assignment operator= that converts a given string \p s into a DateTime
     DateTime& operator=(const std::string& s);
@@ -690,6 +722,30 @@ enum class WebsocketCloseReason : uint8_t {
     ServiceRestart
 };
 
+///
+/// \brief Outcome of handing a message over to a websocket for sending
+///
+enum class WebsocketSendResult {
+    /// The message has been queued for sending
+    Accepted,
+    /// The outbound queue is full, the message can be handed over again once queued messages have been written
+    WouldBlock,
+    /// The message can not be sent, e.g. because the websocket is not connected
+    Failed
+};
+
+///
+/// \brief Outcome of adding a received chunk to a websocket message that is being reassembled
+///
+enum class WebsocketReceiveResult {
+    /// More chunks of the message have to be received
+    Incomplete,
+    /// The message has been received completely
+    Complete,
+    /// The message exceeds the maximum message size and has been discarded
+    TooLarge
+};
+
 } // namespace ocpp
 
 #endif
@@ -58,15 +58,40 @@ public:
     /// \brief register a \p callback that is called when the websocket could not connect with a specific reason
     void register_connection_failed_callback(const std::function<void(ConnectionFailedReason)>& callback);
 
-    /// \brief send a \p message over the websocket
-    /// \returns true if the message was sent successfully
+    /// \brief send a \p message over the websocket. Blocks until the message has been written or dropped, use
+    /// send_async to hand a message over without waiting for it
+    /// \returns true if the message has been sent
     bool send(const std::string& message);
 
+    /// \brief serialize \p message directly into a websocket frame and queue it, see
+    /// send_async(const std::string&, ...)
+    WebsocketSendResult send(const json& message, const std::function<void(bool sent)>& on_sent = nullptr);
+
+    /// \brief let \p write serialize a message directly into a websocket frame and queue it, see
+    /// send_async(const std::string&, ...)
+    WebsocketSendResult send(const JsonWriteFunction& write, const std::function<void(bool sent)>& on_sent = nullptr);
+
+    /// \brief queue a \p message to be sent over the websocket. \p on_sent is called with the outcome once the
+    /// message has been written or dropped, see WebsocketBase::send_async
+    /// \returns Accepted if the message was queued, WouldBlock if the outbound queue is full and the message should be
+    /// handed over again later, Failed if the websocket is not connected
+    WebsocketSendResult send_async(const std::string& message, const std::function<void(bool sent)>& on_sent);
+
+    /// \brief queue a message whose payload is created by \p producer while it is being sent, see
+    /// WebsocketBase::send_stream_async. If message logging is active, the payload is collected while it is produced
+    /// and logged once it is complete.
+    /// \returns see send_async(const std::string&, ...)
+    WebsocketSendResult send_stream_async(WebsocketPayloadProducer&& producer,
+                                          const std::function<void(bool sent)>& on_sent);
+
     /// \brief set the websocket ping interval \p interval_s in seconds
     void set_websocket_ping_interval(int32_t interval_s);
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Provides the number of raw and wire bytes exchanged over the current connection
+    WebsocketTrafficStatistics get_traffic_statistics() const;
 };
 
 } // namespace ocpp
@@ -3,18 +3,116 @@
 #ifndef OCPP_WEBSOCKET_BASE_HPP
 #define OCPP_WEBSOCKET_BASE_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <thread>
 
 #include <everest/timer.hpp>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/common/websocket/websocket_uri.hpp>
 
 namespace ocpp {
 
+/// \brief Default number of outgoing messages that can be queued for sending before further messages are rejected
+constexpr int DEFAULT_MAX_OUTBOUND_QUEUE_SIZE = 64;
+
+/// \brief Default maximum payload size of a single websocket frame, larger messages are sent as continuation frames.
+/// Fits into an Ethernet MTU together with the websocket, TLS and TCP/IP headers.
+constexpr int DEFAULT_MAX_FRAGMENT_SIZE = 1400;
+
+/// \brief Default maximum size of a message received over the websocket. Larger messages close the connection.
+constexpr size_t DEFAULT_MAX_INBOUND_MESSAGE_SIZE = 8 * 1024 * 1024;
+
+/// \brief Produces the payload of a streamed message piece by piece. Writes at most \p capacity bytes of the next part
+/// of the payload to \p buffer and returns the number of bytes written. Sets \p is_last once the end of the payload has
+/// been written. It is called from the websocket thread and must not block, so the payload has to be available when the
+/// message is sent: returning no bytes without setting \p is_last fails the message.
+using WebsocketPayloadProducer = std::function<size_t(char* buffer, size_t capacity, bool& is_last)>;
+
+/// \brief Number of bytes reserved in front of an outgoing payload. Large enough for the frame header any websocket
+/// implementation has to put in front of the payload (e.g. LWS_PRE of libwebsockets)
+constexpr size_t WEBSOCKET_FRAME_HEADROOM = 16;
+
+/// \brief Contains an outgoing websocket payload stored behind WEBSOCKET_FRAME_HEADROOM reserved bytes, so that the
+/// frame can be handed to the websocket implementation without copying the payload
+class WebsocketFrameBuffer {
+private:
+    std::string buffer;
+
+    WebsocketFrameBuffer();
+
+public:
+    /// \brief Creates a buffer containing a copy of \p payload
+    explicit WebsocketFrameBuffer(std::string_view payload);
+
+    /// \brief Creates a buffer containing the serialized \p message, written directly behind the headroom
+    static WebsocketFrameBuffer from_json(const json& message);
+
+    /// \brief Creates a buffer containing the message written by \p write, written directly behind the headroom
+    static WebsocketFrameBuffer from_writer(const JsonWriteFunction& write);
+
+    /// \brief Provides the start of the payload. The WEBSOCKET_FRAME_HEADROOM bytes in front of it may be written to.
+    char* payload_data();
+
+    /// \brief Provides the payload without the headroom
+    std::string_view payload() const;
+
+    /// \brief Provides the number of payload bytes
+    size_t payload_size() const;
+};
+
+/// \brief Reassembles a received websocket message from the chunks of its frames. The size of the message is checked
+/// against a maximum before a chunk is added, taking the rest of the current frame into account.
+class WebsocketReceiveBuffer {
+private:
+    std::string message;
+
+public:
+    /// \brief Adds a received chunk of \p len bytes at \p data to the message. \p remaining_frame_len bytes of the
+    /// current frame follow this chunk and \p is_final_fragment indicates that the frame is the last one of the
+    /// message. Memory for the rest of the frame is reserved at once, growing geometrically across continuation frames.
+    /// \param max_message_size maximum size of the message in bytes, 0 means unlimited
+    /// \returns Complete if the message can be taken with take_message(), TooLarge if the message has been discarded
+    /// because it would exceed \p max_message_size
+    WebsocketReceiveResult append(const char* data, size_t len, size_t remaining_frame_len, bool is_final_fragment,
+                                  size_t max_message_size);
+
+    /// \brief Moves the completely received message out of the buffer, which starts empty for the next message
+    std::string take_message();
+
+    /// \brief Discards a partially received message and releases its memory
+    void clear();
+
+    /// \brief Provides the number of bytes received of the current message
+    size_t size() const;
+
+    /// \brief Provides the number of bytes reserved for the current message
+    size_t capacity() const;
+};
+
+/// \brief Settings of the permessage-deflate extension (RFC 7692)
+struct WebsocketCompressionOptions {
+    bool enabled = false; // Offer permessage-deflate to the server
+    int window_bits = 15; // Maximum LZ77 window size (9..15) used by both sides. Smaller values need less memory
+    int memory_level = 8; // zlib memory level (1..9) of the compressor
+    size_t min_message_size = 0; // Messages with a smaller payload are sent uncompressed
+};
+
+/// \brief Number of payload bytes of data messages exchanged over a websocket connection
+struct WebsocketTrafficStatistics {
+    uint64_t raw_bytes_sent = 0;      // Payload bytes of sent messages before compression
+    uint64_t wire_bytes_sent = 0;     // Payload bytes of sent messages as written to the connection
+    uint64_t raw_bytes_received = 0;  // Payload bytes of received messages after decompression
+    uint64_t wire_bytes_received = 0; // Payload bytes of received messages as read from the connection
+};
+
 struct WebsocketConnectionOptions {
     OcppProtocolVersion ocpp_version;
     Uri csms_uri;         // the URI of the CSMS
@@ -36,6 +134,13 @@ struct WebsocketConnectionOptions {
     bool use_tpm_tls;
     bool verify_csms_allow_wildcards;
     std::optional<std::string> iface; // Optional interface where the socket is created. Only usable for libwebsocket
+    int max_outbound_queue_size =
+        DEFAULT_MAX_OUTBOUND_QUEUE_SIZE; // Messages waiting to be written before send_async rejects further messages
+    WebsocketCompressionOptions compression; // Only supported by libwebsocket
+    int max_fragment_size =
+        DEFAULT_MAX_FRAGMENT_SIZE; // Maximum payload of a single frame, 0 disables fragmentation. Only libwebsocket
+    size_t max_inbound_message_size =
+        DEFAULT_MAX_INBOUND_MESSAGE_SIZE; // Maximum size of a received message in bytes, 0 means unlimited
 };
 
 ///
@@ -58,6 +163,10 @@ protected:
     std::atomic_int connection_attempts;
     std::atomic_bool shutting_down;
     std::atomic_bool reconnecting;
+    std::atomic_uint64_t raw_bytes_sent;
+    std::atomic_uint64_t wire_bytes_sent;
+    std::atomic_uint64_t raw_bytes_received;
+    std::atomic_uint64_t wire_bytes_received;
 
     /// \brief Indicates if the required callbacks are registered
     /// \returns true if the websocket is properly initialized
@@ -82,6 +191,12 @@ protected:
     /// \brief Called when a websocket pong timeout is received
     void on_pong_timeout(std::string msg);
 
+    /// \brief Resets the traffic statistics, called when a new connection is established
+    void reset_traffic_statistics();
+
+    /// \brief Logs the traffic statistics of the current connection
+    void log_traffic_statistics();
+
 public:
     /// \brief Creates a new WebsocketBase object. The `connection_options` must be initialised with
     /// `set_connection_options()`
@@ -128,11 +243,31 @@ public:
     /// \returns true if the message was sent successfully
     virtual bool send(const std::string& message) = 0;
 
+    /// \brief queue a \p frame to be sent over the websocket without waiting until it has been written
+    /// \param on_sent optional callback that is called exactly once: with true when the message has been written or
+    /// with false if it could not be sent. It can be called from the websocket thread and must not block.
+    /// \returns Accepted if the message was queued, in which case \p on_sent is called, WouldBlock if the outbound
+    /// queue is full and Failed if the websocket is not connected
+    virtual WebsocketSendResult send_async(WebsocketFrameBuffer&& frame, const std::function<void(bool sent)>& on_sent);
+
+    /// \brief queue a copy of \p message to be sent over the websocket, see send_async(WebsocketFrameBuffer&&, ...)
+    WebsocketSendResult send_async(const std::string& message, const std::function<void(bool sent)>& on_sent);
+
+    /// \brief queue a message whose payload is created by \p producer while it is being sent, so that it never has to
+    /// be held in memory as a whole. Implementations that can not stream collect the payload before sending it.
+    /// \param on_sent see send_async(WebsocketFrameBuffer&&, ...)
+    /// \returns see send_async(WebsocketFrameBuffer&&, ...)
+    virtual WebsocketSendResult send_stream_async(WebsocketPayloadProducer&& producer,
+                                                  const std::function<void(bool sent)>& on_sent);
+
     /// \brief starts a timer that sends a websocket ping at the given \p interval_s
     void set_websocket_ping_interval(int32_t interval_s);
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Provides the number of raw and wire bytes exchanged over the current connection
+    WebsocketTrafficStatistics get_traffic_statistics() const;
 };
 
 } // namespace ocpp
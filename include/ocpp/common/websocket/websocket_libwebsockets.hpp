@@ -6,7 +6,10 @@
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/websocket/websocket_base.hpp>
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -43,16 +46,33 @@ public:
     /// \brief closes the websocket
     void close(const WebsocketCloseReason code, const std::string& reason) override;
 
-    /// \brief send a \p message over the websocket
+    /// \brief send a \p message over the websocket and wait until it has been written
     /// \returns true if the message was sent successfully
     bool send(const std::string& message) override;
 
+    using WebsocketBase::send_async;
+
+    /// \brief queue a \p frame for the websocket thread without waiting until it has been written. The frame is
+    /// handed to libwebsockets without copying it.
+    /// \returns see WebsocketBase::send_async
+    WebsocketSendResult send_async(WebsocketFrameBuffer&& frame,
+                                   const std::function<void(bool sent)>& on_sent) override;
+
+    /// \brief queue a message whose payload is pulled from \p producer one fragment at a time by the websocket thread
+    /// \returns see WebsocketBase::send_async
+    WebsocketSendResult send_stream_async(WebsocketPayloadProducer&& producer,
+                                          const std::function<void(bool sent)>& on_sent) override;
+
     /// \brief send a websocket ping
     void ping() override;
 
 public:
     int process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len);
 
+    /// \brief Called by the permessage-deflate extension with the number of compressed payload bytes written to and
+    /// read from the connection
+    void on_compressed_traffic(size_t wire_bytes_sent, size_t wire_bytes_received);
+
 private:
     void tls_init(struct ssl_ctx_st* ctx, const std::string& path_chain, const std::string& path_key, bool tpm_key,
                   std::optional<std::string>& password);
@@ -69,14 +89,36 @@ private:
     void on_conn_fail();
 
     /// \brief When the connection can send data
-    void on_writable();
+    /// \returns false if a message could not be written completely and the connection has to be closed
+    bool on_writable();
 
     /// \brief Called when a message is received over the TLS websocket, calls the message callback
     void on_message(std::string&& message);
 
+    /// \brief Appends the \p len bytes at \p in to the message that is being received and passes the message on once it
+    /// is complete
+    /// \returns false if the message exceeds the maximum inbound message size, the connection has to be closed then
+    bool on_receive(void* wsi_ptr, const char* in, size_t len);
+
     void request_write();
 
-    void poll_message(const std::shared_ptr<WebsocketMessage>& msg);
+    /// \brief Appends \p msg to the outbound queue and wakes up the websocket thread
+    /// \returns WouldBlock if the outbound queue is full, Failed if the websocket is not connected
+    WebsocketSendResult queue_message(const std::shared_ptr<WebsocketMessage>& msg);
+
+    /// \brief Queues \p msg, \p on_sent is only called if it has been accepted
+    WebsocketSendResult queue_message_with_callback(const std::shared_ptr<WebsocketMessage>& msg,
+                                                    const std::function<void(bool sent)>& on_sent);
+
+    /// \brief Reports all queued messages as not sent
+    void fail_pending_messages();
+
+    /// \brief Checks the handshake response of the server for the negotiated permessage-deflate parameters
+    /// \returns true if the server accepted permessage-deflate
+    bool read_compression_response(void* wsi_ptr);
+
+    /// \brief Applies the configured compression options to the established connection
+    void apply_compression_options(void* wsi_ptr);
 
 private:
     std::shared_ptr<EvseSecurity> evse_security;
@@ -91,15 +133,18 @@ private:
 
     std::mutex queue_mutex;
 
-    std::queue<std::shared_ptr<WebsocketMessage>> message_queue;
-    std::condition_variable msg_send_cv;
-    std::mutex msg_send_cv_mutex;
+    std::deque<std::shared_ptr<WebsocketMessage>> message_queue;
 
     std::unique_ptr<std::thread> recv_message_thread;
     std::mutex recv_mutex;
     std::queue<std::string> recv_message_queue;
     std::condition_variable recv_message_cv;
-    std::string recv_buffered_message;
+    WebsocketReceiveBuffer recv_buffered_message;
+
+    // If permessage-deflate has been negotiated for the current connection
+    std::atomic_bool compression_active;
+    // Window bits of our compressor agreed on with the server
+    int compression_window_bits;
 };
 
 } // namespace ocpp
@@ -118,11 +118,25 @@ public:
     std::optional<std::string> getIFace();
     std::optional<KeyValue> getIFaceKeyValue();
 
+    std::optional<bool> getWebsocketPerMessageDeflate();
+    std::optional<KeyValue> getWebsocketPerMessageDeflateKeyValue();
+
+    std::optional<int> getMaxInboundMessageSize();
+    std::optional<KeyValue> getMaxInboundMessageSizeKeyValue();
+
     std::optional<bool> getQueueAllMessages();
     std::optional<KeyValue> getQueueAllMessagesKeyValue();
 
     std::optional<int> getMessageQueueSizeThreshold();
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue();
+    std::optional<int> getTransactionQueueCommitInterval();
+    std::optional<KeyValue> getTransactionQueueCommitIntervalKeyValue();
+    std::optional<bool> getStrictMessageValidation();
+    std::optional<KeyValue> getStrictMessageValidationKeyValue();
+    std::optional<int> getTransactionUpdateCompactionItemsPerMessage();
+    std::optional<KeyValue> getTransactionUpdateCompactionItemsPerMessageKeyValue();
+    std::optional<int> getTransactionUpdateCompactionBytesPerMessage();
+    std::optional<KeyValue> getTransactionUpdateCompactionBytesPerMessageKeyValue();
 
     // Core Profile - optional
     std::optional<bool> getAllowOfflineTxForUnknownId();
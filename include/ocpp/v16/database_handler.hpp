@@ -50,7 +50,8 @@ private:
 
 public:
     DatabaseHandler(std::unique_ptr<common::DatabaseConnectionInterface> database,
-                    const fs::path& sql_migration_files_path, int32_t number_of_connectors);
+                    const fs::path& sql_migration_files_path, int32_t number_of_connectors,
+                    std::unique_ptr<common::DatabaseConnectionInterface> transaction_queue_database = nullptr);
 
     // transactions
     /// \brief Inserts a transaction with the given parameter to the TRANSACTIONS table.
@@ -5,6 +5,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v16 {
@@ -20,8 +21,8 @@ enum class AuthorizationStatus {
 
 namespace conversions {
 /// \brief Converts the given AuthorizationStatus \p e to human readable string
-/// \returns a string representation of the AuthorizationStatus
-std::string authorization_status_to_string(AuthorizationStatus e);
+/// \returns a string representation of the AuthorizationStatus, which refers to a constant
+std::string_view authorization_status_to_string(AuthorizationStatus e);
 
 /// \brief Converts the given std::string \p s to AuthorizationStatus
 /// \returns a AuthorizationStatus from a string representation
@@ -41,8 +42,8 @@ enum class RegistrationStatus {
 
 namespace conversions {
 /// \brief Converts the given RegistrationStatus \p e to human readable string
-/// \returns a string representation of the RegistrationStatus
-std::string registration_status_to_string(RegistrationStatus e);
+/// \returns a string representation of the RegistrationStatus, which refers to a constant
+std::string_view registration_status_to_string(RegistrationStatus e);
 
 /// \brief Converts the given std::string \p s to RegistrationStatus
 /// \returns a RegistrationStatus from a string representation
@@ -61,8 +62,8 @@ enum class CancelReservationStatus {
 
 namespace conversions {
 /// \brief Converts the given CancelReservationStatus \p e to human readable string
-/// \returns a string representation of the CancelReservationStatus
-std::string cancel_reservation_status_to_string(CancelReservationStatus e);
+/// \returns a string representation of the CancelReservationStatus, which refers to a constant
+std::string_view cancel_reservation_status_to_string(CancelReservationStatus e);
 
 /// \brief Converts the given std::string \p s to CancelReservationStatus
 /// \returns a CancelReservationStatus from a string representation
@@ -81,8 +82,8 @@ enum class CertificateSignedStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given CertificateSignedStatusEnumType \p e to human readable string
-/// \returns a string representation of the CertificateSignedStatusEnumType
-std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e);
+/// \returns a string representation of the CertificateSignedStatusEnumType, which refers to a constant
+std::string_view certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to CertificateSignedStatusEnumType
 /// \returns a CertificateSignedStatusEnumType from a string representation
@@ -102,8 +103,8 @@ enum class AvailabilityType {
 
 namespace conversions {
 /// \brief Converts the given AvailabilityType \p e to human readable string
-/// \returns a string representation of the AvailabilityType
-std::string availability_type_to_string(AvailabilityType e);
+/// \returns a string representation of the AvailabilityType, which refers to a constant
+std::string_view availability_type_to_string(AvailabilityType e);
 
 /// \brief Converts the given std::string \p s to AvailabilityType
 /// \returns a AvailabilityType from a string representation
@@ -123,8 +124,8 @@ enum class AvailabilityStatus {
 
 namespace conversions {
 /// \brief Converts the given AvailabilityStatus \p e to human readable string
-/// \returns a string representation of the AvailabilityStatus
-std::string availability_status_to_string(AvailabilityStatus e);
+/// \returns a string representation of the AvailabilityStatus, which refers to a constant
+std::string_view availability_status_to_string(AvailabilityStatus e);
 
 /// \brief Converts the given std::string \p s to AvailabilityStatus
 /// \returns a AvailabilityStatus from a string representation
@@ -145,8 +146,8 @@ enum class ConfigurationStatus {
 
 namespace conversions {
 /// \brief Converts the given ConfigurationStatus \p e to human readable string
-/// \returns a string representation of the ConfigurationStatus
-std::string configuration_status_to_string(ConfigurationStatus e);
+/// \returns a string representation of the ConfigurationStatus, which refers to a constant
+std::string_view configuration_status_to_string(ConfigurationStatus e);
 
 /// \brief Converts the given std::string \p s to ConfigurationStatus
 /// \returns a ConfigurationStatus from a string representation
@@ -165,8 +166,8 @@ enum class ClearCacheStatus {
 
 namespace conversions {
 /// \brief Converts the given ClearCacheStatus \p e to human readable string
-/// \returns a string representation of the ClearCacheStatus
-std::string clear_cache_status_to_string(ClearCacheStatus e);
+/// \returns a string representation of the ClearCacheStatus, which refers to a constant
+std::string_view clear_cache_status_to_string(ClearCacheStatus e);
 
 /// \brief Converts the given std::string \p s to ClearCacheStatus
 /// \returns a ClearCacheStatus from a string representation
@@ -186,8 +187,8 @@ enum class ChargingProfilePurposeType {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfilePurposeType \p e to human readable string
-/// \returns a string representation of the ChargingProfilePurposeType
-std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e);
+/// \returns a string representation of the ChargingProfilePurposeType, which refers to a constant
+std::string_view charging_profile_purpose_type_to_string(ChargingProfilePurposeType e);
 
 /// \brief Converts the given std::string \p s to ChargingProfilePurposeType
 /// \returns a ChargingProfilePurposeType from a string representation
@@ -206,8 +207,8 @@ enum class ClearChargingProfileStatus {
 
 namespace conversions {
 /// \brief Converts the given ClearChargingProfileStatus \p e to human readable string
-/// \returns a string representation of the ClearChargingProfileStatus
-std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e);
+/// \returns a string representation of the ClearChargingProfileStatus, which refers to a constant
+std::string_view clear_charging_profile_status_to_string(ClearChargingProfileStatus e);
 
 /// \brief Converts the given std::string \p s to ClearChargingProfileStatus
 /// \returns a ClearChargingProfileStatus from a string representation
@@ -228,8 +229,8 @@ enum class DataTransferStatus {
 
 namespace conversions {
 /// \brief Converts the given DataTransferStatus \p e to human readable string
-/// \returns a string representation of the DataTransferStatus
-std::string data_transfer_status_to_string(DataTransferStatus e);
+/// \returns a string representation of the DataTransferStatus, which refers to a constant
+std::string_view data_transfer_status_to_string(DataTransferStatus e);
 
 /// \brief Converts the given std::string \p s to DataTransferStatus
 /// \returns a DataTransferStatus from a string representation
@@ -249,8 +250,8 @@ enum class HashAlgorithmEnumType {
 
 namespace conversions {
 /// \brief Converts the given HashAlgorithmEnumType \p e to human readable string
-/// \returns a string representation of the HashAlgorithmEnumType
-std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e);
+/// \returns a string representation of the HashAlgorithmEnumType, which refers to a constant
+std::string_view hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e);
 
 /// \brief Converts the given std::string \p s to HashAlgorithmEnumType
 /// \returns a HashAlgorithmEnumType from a string representation
@@ -270,8 +271,8 @@ enum class DeleteCertificateStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given DeleteCertificateStatusEnumType \p e to human readable string
-/// \returns a string representation of the DeleteCertificateStatusEnumType
-std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e);
+/// \returns a string representation of the DeleteCertificateStatusEnumType, which refers to a constant
+std::string_view delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to DeleteCertificateStatusEnumType
 /// \returns a DeleteCertificateStatusEnumType from a string representation
@@ -293,8 +294,8 @@ enum class DiagnosticsStatus {
 
 namespace conversions {
 /// \brief Converts the given DiagnosticsStatus \p e to human readable string
-/// \returns a string representation of the DiagnosticsStatus
-std::string diagnostics_status_to_string(DiagnosticsStatus e);
+/// \returns a string representation of the DiagnosticsStatus, which refers to a constant
+std::string_view diagnostics_status_to_string(DiagnosticsStatus e);
 
 /// \brief Converts the given std::string \p s to DiagnosticsStatus
 /// \returns a DiagnosticsStatus from a string representation
@@ -318,8 +319,8 @@ enum class MessageTriggerEnumType {
 
 namespace conversions {
 /// \brief Converts the given MessageTriggerEnumType \p e to human readable string
-/// \returns a string representation of the MessageTriggerEnumType
-std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e);
+/// \returns a string representation of the MessageTriggerEnumType, which refers to a constant
+std::string_view message_trigger_enum_type_to_string(MessageTriggerEnumType e);
 
 /// \brief Converts the given std::string \p s to MessageTriggerEnumType
 /// \returns a MessageTriggerEnumType from a string representation
@@ -339,8 +340,8 @@ enum class TriggerMessageStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given TriggerMessageStatusEnumType \p e to human readable string
-/// \returns a string representation of the TriggerMessageStatusEnumType
-std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e);
+/// \returns a string representation of the TriggerMessageStatusEnumType, which refers to a constant
+std::string_view trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to TriggerMessageStatusEnumType
 /// \returns a TriggerMessageStatusEnumType from a string representation
@@ -365,8 +366,8 @@ enum class FirmwareStatus {
 
 namespace conversions {
 /// \brief Converts the given FirmwareStatus \p e to human readable string
-/// \returns a string representation of the FirmwareStatus
-std::string firmware_status_to_string(FirmwareStatus e);
+/// \returns a string representation of the FirmwareStatus, which refers to a constant
+std::string_view firmware_status_to_string(FirmwareStatus e);
 
 /// \brief Converts the given std::string \p s to FirmwareStatus
 /// \returns a FirmwareStatus from a string representation
@@ -385,8 +386,8 @@ enum class ChargingRateUnit {
 
 namespace conversions {
 /// \brief Converts the given ChargingRateUnit \p e to human readable string
-/// \returns a string representation of the ChargingRateUnit
-std::string charging_rate_unit_to_string(ChargingRateUnit e);
+/// \returns a string representation of the ChargingRateUnit, which refers to a constant
+std::string_view charging_rate_unit_to_string(ChargingRateUnit e);
 
 /// \brief Converts the given std::string \p s to ChargingRateUnit
 /// \returns a ChargingRateUnit from a string representation
@@ -405,8 +406,8 @@ enum class GetCompositeScheduleStatus {
 
 namespace conversions {
 /// \brief Converts the given GetCompositeScheduleStatus \p e to human readable string
-/// \returns a string representation of the GetCompositeScheduleStatus
-std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e);
+/// \returns a string representation of the GetCompositeScheduleStatus, which refers to a constant
+std::string_view get_composite_schedule_status_to_string(GetCompositeScheduleStatus e);
 
 /// \brief Converts the given std::string \p s to GetCompositeScheduleStatus
 /// \returns a GetCompositeScheduleStatus from a string representation
@@ -425,8 +426,8 @@ enum class CertificateUseEnumType {
 
 namespace conversions {
 /// \brief Converts the given CertificateUseEnumType \p e to human readable string
-/// \returns a string representation of the CertificateUseEnumType
-std::string certificate_use_enum_type_to_string(CertificateUseEnumType e);
+/// \returns a string representation of the CertificateUseEnumType, which refers to a constant
+std::string_view certificate_use_enum_type_to_string(CertificateUseEnumType e);
 
 /// \brief Converts the given std::string \p s to CertificateUseEnumType
 /// \returns a CertificateUseEnumType from a string representation
@@ -445,8 +446,8 @@ enum class GetInstalledCertificateStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given GetInstalledCertificateStatusEnumType \p e to human readable string
-/// \returns a string representation of the GetInstalledCertificateStatusEnumType
-std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e);
+/// \returns a string representation of the GetInstalledCertificateStatusEnumType, which refers to a constant
+std::string_view get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to GetInstalledCertificateStatusEnumType
 /// \returns a GetInstalledCertificateStatusEnumType from a string representation
@@ -467,8 +468,8 @@ enum class LogEnumType {
 
 namespace conversions {
 /// \brief Converts the given LogEnumType \p e to human readable string
-/// \returns a string representation of the LogEnumType
-std::string log_enum_type_to_string(LogEnumType e);
+/// \returns a string representation of the LogEnumType, which refers to a constant
+std::string_view log_enum_type_to_string(LogEnumType e);
 
 /// \brief Converts the given std::string \p s to LogEnumType
 /// \returns a LogEnumType from a string representation
@@ -488,8 +489,8 @@ enum class LogStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given LogStatusEnumType \p e to human readable string
-/// \returns a string representation of the LogStatusEnumType
-std::string log_status_enum_type_to_string(LogStatusEnumType e);
+/// \returns a string representation of the LogStatusEnumType, which refers to a constant
+std::string_view log_status_enum_type_to_string(LogStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to LogStatusEnumType
 /// \returns a LogStatusEnumType from a string representation
@@ -509,8 +510,8 @@ enum class InstallCertificateStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given InstallCertificateStatusEnumType \p e to human readable string
-/// \returns a string representation of the InstallCertificateStatusEnumType
-std::string install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e);
+/// \returns a string representation of the InstallCertificateStatusEnumType, which refers to a constant
+std::string_view install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to InstallCertificateStatusEnumType
 /// \returns a InstallCertificateStatusEnumType from a string representation
@@ -536,8 +537,8 @@ enum class UploadLogStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given UploadLogStatusEnumType \p e to human readable string
-/// \returns a string representation of the UploadLogStatusEnumType
-std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e);
+/// \returns a string representation of the UploadLogStatusEnumType, which refers to a constant
+std::string_view upload_log_status_enum_type_to_string(UploadLogStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to UploadLogStatusEnumType
 /// \returns a UploadLogStatusEnumType from a string representation
@@ -562,8 +563,8 @@ enum class ReadingContext {
 
 namespace conversions {
 /// \brief Converts the given ReadingContext \p e to human readable string
-/// \returns a string representation of the ReadingContext
-std::string reading_context_to_string(ReadingContext e);
+/// \returns a string representation of the ReadingContext, which refers to a constant
+std::string_view reading_context_to_string(ReadingContext e);
 
 /// \brief Converts the given std::string \p s to ReadingContext
 /// \returns a ReadingContext from a string representation
@@ -582,8 +583,8 @@ enum class ValueFormat {
 
 namespace conversions {
 /// \brief Converts the given ValueFormat \p e to human readable string
-/// \returns a string representation of the ValueFormat
-std::string value_format_to_string(ValueFormat e);
+/// \returns a string representation of the ValueFormat, which refers to a constant
+std::string_view value_format_to_string(ValueFormat e);
 
 /// \brief Converts the given std::string \p s to ValueFormat
 /// \returns a ValueFormat from a string representation
@@ -622,8 +623,8 @@ enum class Measurand {
 
 namespace conversions {
 /// \brief Converts the given Measurand \p e to human readable string
-/// \returns a string representation of the Measurand
-std::string measurand_to_string(Measurand e);
+/// \returns a string representation of the Measurand, which refers to a constant
+std::string_view measurand_to_string(Measurand e);
 
 /// \brief Converts the given std::string \p s to Measurand
 /// \returns a Measurand from a string representation
@@ -650,8 +651,8 @@ enum class Phase {
 
 namespace conversions {
 /// \brief Converts the given Phase \p e to human readable string
-/// \returns a string representation of the Phase
-std::string phase_to_string(Phase e);
+/// \returns a string representation of the Phase, which refers to a constant
+std::string_view phase_to_string(Phase e);
 
 /// \brief Converts the given std::string \p s to Phase
 /// \returns a Phase from a string representation
@@ -673,8 +674,8 @@ enum class Location {
 
 namespace conversions {
 /// \brief Converts the given Location \p e to human readable string
-/// \returns a string representation of the Location
-std::string location_to_string(Location e);
+/// \returns a string representation of the Location, which refers to a constant
+std::string_view location_to_string(Location e);
 
 /// \brief Converts the given std::string \p s to Location
 /// \returns a Location from a string representation
@@ -709,8 +710,8 @@ enum class UnitOfMeasure {
 
 namespace conversions {
 /// \brief Converts the given UnitOfMeasure \p e to human readable string
-/// \returns a string representation of the UnitOfMeasure
-std::string unit_of_measure_to_string(UnitOfMeasure e);
+/// \returns a string representation of the UnitOfMeasure, which refers to a constant
+std::string_view unit_of_measure_to_string(UnitOfMeasure e);
 
 /// \brief Converts the given std::string \p s to UnitOfMeasure
 /// \returns a UnitOfMeasure from a string representation
@@ -730,8 +731,8 @@ enum class ChargingProfileKindType {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfileKindType \p e to human readable string
-/// \returns a string representation of the ChargingProfileKindType
-std::string charging_profile_kind_type_to_string(ChargingProfileKindType e);
+/// \returns a string representation of the ChargingProfileKindType, which refers to a constant
+std::string_view charging_profile_kind_type_to_string(ChargingProfileKindType e);
 
 /// \brief Converts the given std::string \p s to ChargingProfileKindType
 /// \returns a ChargingProfileKindType from a string representation
@@ -750,8 +751,8 @@ enum class RecurrencyKindType {
 
 namespace conversions {
 /// \brief Converts the given RecurrencyKindType \p e to human readable string
-/// \returns a string representation of the RecurrencyKindType
-std::string recurrency_kind_type_to_string(RecurrencyKindType e);
+/// \returns a string representation of the RecurrencyKindType, which refers to a constant
+std::string_view recurrency_kind_type_to_string(RecurrencyKindType e);
 
 /// \brief Converts the given std::string \p s to RecurrencyKindType
 /// \returns a RecurrencyKindType from a string representation
@@ -770,8 +771,8 @@ enum class RemoteStartStopStatus {
 
 namespace conversions {
 /// \brief Converts the given RemoteStartStopStatus \p e to human readable string
-/// \returns a string representation of the RemoteStartStopStatus
-std::string remote_start_stop_status_to_string(RemoteStartStopStatus e);
+/// \returns a string representation of the RemoteStartStopStatus, which refers to a constant
+std::string_view remote_start_stop_status_to_string(RemoteStartStopStatus e);
 
 /// \brief Converts the given std::string \p s to RemoteStartStopStatus
 /// \returns a RemoteStartStopStatus from a string representation
@@ -793,8 +794,8 @@ enum class ReservationStatus {
 
 namespace conversions {
 /// \brief Converts the given ReservationStatus \p e to human readable string
-/// \returns a string representation of the ReservationStatus
-std::string reservation_status_to_string(ReservationStatus e);
+/// \returns a string representation of the ReservationStatus, which refers to a constant
+std::string_view reservation_status_to_string(ReservationStatus e);
 
 /// \brief Converts the given std::string \p s to ReservationStatus
 /// \returns a ReservationStatus from a string representation
@@ -813,8 +814,8 @@ enum class ResetType {
 
 namespace conversions {
 /// \brief Converts the given ResetType \p e to human readable string
-/// \returns a string representation of the ResetType
-std::string reset_type_to_string(ResetType e);
+/// \returns a string representation of the ResetType, which refers to a constant
+std::string_view reset_type_to_string(ResetType e);
 
 /// \brief Converts the given std::string \p s to ResetType
 /// \returns a ResetType from a string representation
@@ -833,8 +834,8 @@ enum class ResetStatus {
 
 namespace conversions {
 /// \brief Converts the given ResetStatus \p e to human readable string
-/// \returns a string representation of the ResetStatus
-std::string reset_status_to_string(ResetStatus e);
+/// \returns a string representation of the ResetStatus, which refers to a constant
+std::string_view reset_status_to_string(ResetStatus e);
 
 /// \brief Converts the given std::string \p s to ResetStatus
 /// \returns a ResetStatus from a string representation
@@ -853,8 +854,8 @@ enum class UpdateType {
 
 namespace conversions {
 /// \brief Converts the given UpdateType \p e to human readable string
-/// \returns a string representation of the UpdateType
-std::string update_type_to_string(UpdateType e);
+/// \returns a string representation of the UpdateType, which refers to a constant
+std::string_view update_type_to_string(UpdateType e);
 
 /// \brief Converts the given std::string \p s to UpdateType
 /// \returns a UpdateType from a string representation
@@ -875,8 +876,8 @@ enum class UpdateStatus {
 
 namespace conversions {
 /// \brief Converts the given UpdateStatus \p e to human readable string
-/// \returns a string representation of the UpdateStatus
-std::string update_status_to_string(UpdateStatus e);
+/// \returns a string representation of the UpdateStatus, which refers to a constant
+std::string_view update_status_to_string(UpdateStatus e);
 
 /// \brief Converts the given std::string \p s to UpdateStatus
 /// \returns a UpdateStatus from a string representation
@@ -896,8 +897,8 @@ enum class ChargingProfileStatus {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfileStatus \p e to human readable string
-/// \returns a string representation of the ChargingProfileStatus
-std::string charging_profile_status_to_string(ChargingProfileStatus e);
+/// \returns a string representation of the ChargingProfileStatus, which refers to a constant
+std::string_view charging_profile_status_to_string(ChargingProfileStatus e);
 
 /// \brief Converts the given std::string \p s to ChargingProfileStatus
 /// \returns a ChargingProfileStatus from a string representation
@@ -916,8 +917,8 @@ enum class GenericStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given GenericStatusEnumType \p e to human readable string
-/// \returns a string representation of the GenericStatusEnumType
-std::string generic_status_enum_type_to_string(GenericStatusEnumType e);
+/// \returns a string representation of the GenericStatusEnumType, which refers to a constant
+std::string_view generic_status_enum_type_to_string(GenericStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to GenericStatusEnumType
 /// \returns a GenericStatusEnumType from a string representation
@@ -948,8 +949,8 @@ enum class FirmwareStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given FirmwareStatusEnumType \p e to human readable string
-/// \returns a string representation of the FirmwareStatusEnumType
-std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e);
+/// \returns a string representation of the FirmwareStatusEnumType, which refers to a constant
+std::string_view firmware_status_enum_type_to_string(FirmwareStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to FirmwareStatusEnumType
 /// \returns a FirmwareStatusEnumType from a string representation
@@ -971,8 +972,8 @@ enum class UpdateFirmwareStatusEnumType {
 
 namespace conversions {
 /// \brief Converts the given UpdateFirmwareStatusEnumType \p e to human readable string
-/// \returns a string representation of the UpdateFirmwareStatusEnumType
-std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e);
+/// \returns a string representation of the UpdateFirmwareStatusEnumType, which refers to a constant
+std::string_view update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e);
 
 /// \brief Converts the given std::string \p s to UpdateFirmwareStatusEnumType
 /// \returns a UpdateFirmwareStatusEnumType from a string representation
@@ -1006,8 +1007,8 @@ enum class ChargePointErrorCode {
 
 namespace conversions {
 /// \brief Converts the given ChargePointErrorCode \p e to human readable string
-/// \returns a string representation of the ChargePointErrorCode
-std::string charge_point_error_code_to_string(ChargePointErrorCode e);
+/// \returns a string representation of the ChargePointErrorCode, which refers to a constant
+std::string_view charge_point_error_code_to_string(ChargePointErrorCode e);
 
 /// \brief Converts the given std::string \p s to ChargePointErrorCode
 /// \returns a ChargePointErrorCode from a string representation
@@ -1033,8 +1034,8 @@ enum class ChargePointStatus {
 
 namespace conversions {
 /// \brief Converts the given ChargePointStatus \p e to human readable string
-/// \returns a string representation of the ChargePointStatus
-std::string charge_point_status_to_string(ChargePointStatus e);
+/// \returns a string representation of the ChargePointStatus, which refers to a constant
+std::string_view charge_point_status_to_string(ChargePointStatus e);
 
 /// \brief Converts the given std::string \p s to ChargePointStatus
 /// \returns a ChargePointStatus from a string representation
@@ -1062,8 +1063,8 @@ enum class Reason {
 
 namespace conversions {
 /// \brief Converts the given Reason \p e to human readable string
-/// \returns a string representation of the Reason
-std::string reason_to_string(Reason e);
+/// \returns a string representation of the Reason, which refers to a constant
+std::string_view reason_to_string(Reason e);
 
 /// \brief Converts the given std::string \p s to Reason
 /// \returns a Reason from a string representation
@@ -1086,8 +1087,8 @@ enum class MessageTrigger {
 
 namespace conversions {
 /// \brief Converts the given MessageTrigger \p e to human readable string
-/// \returns a string representation of the MessageTrigger
-std::string message_trigger_to_string(MessageTrigger e);
+/// \returns a string representation of the MessageTrigger, which refers to a constant
+std::string_view message_trigger_to_string(MessageTrigger e);
 
 /// \brief Converts the given std::string \p s to MessageTrigger
 /// \returns a MessageTrigger from a string representation
@@ -1107,8 +1108,8 @@ enum class TriggerMessageStatus {
 
 namespace conversions {
 /// \brief Converts the given TriggerMessageStatus \p e to human readable string
-/// \returns a string representation of the TriggerMessageStatus
-std::string trigger_message_status_to_string(TriggerMessageStatus e);
+/// \returns a string representation of the TriggerMessageStatus, which refers to a constant
+std::string_view trigger_message_status_to_string(TriggerMessageStatus e);
 
 /// \brief Converts the given std::string \p s to TriggerMessageStatus
 /// \returns a TriggerMessageStatus from a string representation
@@ -1128,8 +1129,8 @@ enum class UnlockStatus {
 
 namespace conversions {
 /// \brief Converts the given UnlockStatus \p e to human readable string
-/// \returns a string representation of the UnlockStatus
-std::string unlock_status_to_string(UnlockStatus e);
+/// \returns a string representation of the UnlockStatus, which refers to a constant
+std::string_view unlock_status_to_string(UnlockStatus e);
 
 /// \brief Converts the given std::string \p s to UnlockStatus
 /// \returns a UnlockStatus from a string representation
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_V16_MESSAGE_VALIDATOR_HPP
+#define OCPP_V16_MESSAGE_VALIDATOR_HPP
+
+#include <ocpp/common/json_validator.hpp>
+#include <ocpp/v16/types.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+/// \brief Validates the next value of the given \p validator against the schema of the payload of a message of the
+/// given \p message_type. Payloads of message types without a schema are skipped.
+/// \throws JsonValidationError if the payload does not match the schema
+void validate_message(MessageType message_type, JsonValidator& validator);
+
+} // namespace v16
+} // namespace ocpp
+
+#endif // OCPP_V16_MESSAGE_VALIDATOR_HPP
@@ -28,6 +28,15 @@ void to_json(json& j, const AuthorizeRequest& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeRequest \p k
 void from_json(const json& j, AuthorizeRequest& k);
 
+/// \brief Writes the given AuthorizeRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizeRequest& k);
+
+/// \brief Reads the given AuthorizeRequest \p k from the given \p reader
+void read_json(JsonReader& reader, AuthorizeRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a AuthorizeRequest
+void validate_authorize_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const AuthorizeResponse& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeResponse \p k
 void from_json(const json& j, AuthorizeResponse& k);
 
+/// \brief Writes the given AuthorizeResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizeResponse& k);
+
+/// \brief Reads the given AuthorizeResponse \p k from the given \p reader
+void read_json(JsonReader& reader, AuthorizeResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a AuthorizeResponse
+void validate_authorize_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k);
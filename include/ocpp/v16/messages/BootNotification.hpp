@@ -36,6 +36,15 @@ void to_json(json& j, const BootNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationRequest \p k
 void from_json(const json& j, BootNotificationRequest& k);
 
+/// \brief Writes the given BootNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const BootNotificationRequest& k);
+
+/// \brief Reads the given BootNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, BootNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a BootNotificationRequest
+void validate_boot_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k);
@@ -57,6 +66,15 @@ void to_json(json& j, const BootNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationResponse \p k
 void from_json(const json& j, BootNotificationResponse& k);
 
+/// \brief Writes the given BootNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const BootNotificationResponse& k);
+
+/// \brief Reads the given BootNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, BootNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a BootNotificationResponse
+void validate_boot_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k);
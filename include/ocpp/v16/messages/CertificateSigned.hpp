@@ -26,6 +26,15 @@ void to_json(json& j, const CertificateSignedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedRequest \p k
 void from_json(const json& j, CertificateSignedRequest& k);
 
+/// \brief Writes the given CertificateSignedRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k);
+
+/// \brief Reads the given CertificateSignedRequest \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateSignedRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateSignedRequest
+void validate_certificate_signed_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k);
@@ -45,6 +54,15 @@ void to_json(json& j, const CertificateSignedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedResponse \p k
 void from_json(const json& j, CertificateSignedResponse& k);
 
+/// \brief Writes the given CertificateSignedResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k);
+
+/// \brief Reads the given CertificateSignedResponse \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateSignedResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateSignedResponse
+void validate_certificate_signed_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k);
@@ -27,6 +27,15 @@ void to_json(json& j, const ChangeAvailabilityRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityRequest \p k
 void from_json(const json& j, ChangeAvailabilityRequest& k);
 
+/// \brief Writes the given ChangeAvailabilityRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k);
+
+/// \brief Reads the given ChangeAvailabilityRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ChangeAvailabilityRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChangeAvailabilityRequest
+void validate_change_availability_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k);
@@ -46,6 +55,15 @@ void to_json(json& j, const ChangeAvailabilityResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityResponse \p k
 void from_json(const json& j, ChangeAvailabilityResponse& k);
 
+/// \brief Writes the given ChangeAvailabilityResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k);
+
+/// \brief Reads the given ChangeAvailabilityResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ChangeAvailabilityResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChangeAvailabilityResponse
+void validate_change_availability_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k);
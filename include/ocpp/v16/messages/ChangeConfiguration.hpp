@@ -28,6 +28,15 @@ void to_json(json& j, const ChangeConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationRequest \p k
 void from_json(const json& j, ChangeConfigurationRequest& k);
 
+/// \brief Writes the given ChangeConfigurationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k);
+
+/// \brief Reads the given ChangeConfigurationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ChangeConfigurationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChangeConfigurationRequest
+void validate_change_configuration_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const ChangeConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationResponse \p k
 void from_json(const json& j, ChangeConfigurationResponse& k);
 
+/// \brief Writes the given ChangeConfigurationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k);
+
+/// \brief Reads the given ChangeConfigurationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ChangeConfigurationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChangeConfigurationResponse
+void validate_change_configuration_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k);
@@ -25,6 +25,15 @@ void to_json(json& j, const ClearCacheRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheRequest \p k
 void from_json(const json& j, ClearCacheRequest& k);
 
+/// \brief Writes the given ClearCacheRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearCacheRequest& k);
+
+/// \brief Reads the given ClearCacheRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ClearCacheRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearCacheRequest
+void validate_clear_cache_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k);
@@ -44,6 +53,15 @@ void to_json(json& j, const ClearCacheResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheResponse \p k
 void from_json(const json& j, ClearCacheResponse& k);
 
+/// \brief Writes the given ClearCacheResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearCacheResponse& k);
+
+/// \brief Reads the given ClearCacheResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ClearCacheResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearCacheResponse
+void validate_clear_cache_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k);
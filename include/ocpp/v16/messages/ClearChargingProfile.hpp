@@ -30,6 +30,15 @@ void to_json(json& j, const ClearChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileRequest \p k
 void from_json(const json& j, ClearChargingProfileRequest& k);
 
+/// \brief Writes the given ClearChargingProfileRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k);
+
+/// \brief Reads the given ClearChargingProfileRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ClearChargingProfileRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearChargingProfileRequest
+void validate_clear_charging_profile_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const ClearChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileResponse \p k
 void from_json(const json& j, ClearChargingProfileResponse& k);
 
+/// \brief Writes the given ClearChargingProfileResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k);
+
+/// \brief Reads the given ClearChargingProfileResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ClearChargingProfileResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearChargingProfileResponse
+void validate_clear_charging_profile_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k);
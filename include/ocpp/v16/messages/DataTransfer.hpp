@@ -30,6 +30,15 @@ void to_json(json& j, const DataTransferRequest& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferRequest \p k
 void from_json(const json& j, DataTransferRequest& k);
 
+/// \brief Writes the given DataTransferRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DataTransferRequest& k);
+
+/// \brief Reads the given DataTransferRequest \p k from the given \p reader
+void read_json(JsonReader& reader, DataTransferRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a DataTransferRequest
+void validate_data_transfer_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const DataTransferResponse& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferResponse \p k
 void from_json(const json& j, DataTransferResponse& k);
 
+/// \brief Writes the given DataTransferResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DataTransferResponse& k);
+
+/// \brief Reads the given DataTransferResponse \p k from the given \p reader
+void read_json(JsonReader& reader, DataTransferResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a DataTransferResponse
+void validate_data_transfer_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k);
@@ -26,6 +26,15 @@ void to_json(json& j, const DeleteCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateRequest \p k
 void from_json(const json& j, DeleteCertificateRequest& k);
 
+/// \brief Writes the given DeleteCertificateRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k);
+
+/// \brief Reads the given DeleteCertificateRequest \p k from the given \p reader
+void read_json(JsonReader& reader, DeleteCertificateRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a DeleteCertificateRequest
+void validate_delete_certificate_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k);
@@ -45,6 +54,15 @@ void to_json(json& j, const DeleteCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateResponse \p k
 void from_json(const json& j, DeleteCertificateResponse& k);
 
+/// \brief Writes the given DeleteCertificateResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k);
+
+/// \brief Reads the given DeleteCertificateResponse \p k from the given \p reader
+void read_json(JsonReader& reader, DeleteCertificateResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a DeleteCertificateResponse
+void validate_delete_certificate_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k);
@@ -26,6 +26,16 @@ void to_json(json& j, const DiagnosticsStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationRequest \p k
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k);
+
+/// \brief Reads the given DiagnosticsStatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, DiagnosticsStatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// DiagnosticsStatusNotificationRequest
+void validate_diagnostics_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k);
@@ -44,6 +54,16 @@ void to_json(json& j, const DiagnosticsStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationResponse \p k
 void from_json(const json& j, DiagnosticsStatusNotificationResponse& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k);
+
+/// \brief Reads the given DiagnosticsStatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, DiagnosticsStatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// DiagnosticsStatusNotificationResponse
+void validate_diagnostics_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k);
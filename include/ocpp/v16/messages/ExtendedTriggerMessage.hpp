@@ -28,6 +28,15 @@ void to_json(json& j, const ExtendedTriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageRequest \p k
 void from_json(const json& j, ExtendedTriggerMessageRequest& k);
 
+/// \brief Writes the given ExtendedTriggerMessageRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k);
+
+/// \brief Reads the given ExtendedTriggerMessageRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ExtendedTriggerMessageRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ExtendedTriggerMessageRequest
+void validate_extended_trigger_message_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const ExtendedTriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageResponse \p k
 void from_json(const json& j, ExtendedTriggerMessageResponse& k);
 
+/// \brief Writes the given ExtendedTriggerMessageResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k);
+
+/// \brief Reads the given ExtendedTriggerMessageResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ExtendedTriggerMessageResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ExtendedTriggerMessageResponse
+void validate_extended_trigger_message_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k);
@@ -26,6 +26,15 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationRequest \p k
 void from_json(const json& j, FirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k);
+
+/// \brief Reads the given FirmwareStatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, FirmwareStatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a FirmwareStatusNotificationRequest
+void validate_firmware_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k);
@@ -44,6 +53,15 @@ void to_json(json& j, const FirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationResponse \p k
 void from_json(const json& j, FirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k);
+
+/// \brief Reads the given FirmwareStatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, FirmwareStatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a FirmwareStatusNotificationResponse
+void validate_firmware_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k);
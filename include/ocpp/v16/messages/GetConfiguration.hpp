@@ -27,6 +27,15 @@ void to_json(json& j, const GetConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationRequest \p k
 void from_json(const json& j, GetConfigurationRequest& k);
 
+/// \brief Writes the given GetConfigurationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k);
+
+/// \brief Reads the given GetConfigurationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetConfigurationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetConfigurationRequest
+void validate_get_configuration_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const GetConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationResponse \p k
 void from_json(const json& j, GetConfigurationResponse& k);
 
+/// \brief Writes the given GetConfigurationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k);
+
+/// \brief Reads the given GetConfigurationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetConfigurationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetConfigurationResponse
+void validate_get_configuration_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k);
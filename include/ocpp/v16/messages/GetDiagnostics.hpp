@@ -31,6 +31,15 @@ void to_json(json& j, const GetDiagnosticsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsRequest \p k
 void from_json(const json& j, GetDiagnosticsRequest& k);
 
+/// \brief Writes the given GetDiagnosticsRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k);
+
+/// \brief Reads the given GetDiagnosticsRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetDiagnosticsRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetDiagnosticsRequest
+void validate_get_diagnostics_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const GetDiagnosticsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsResponse \p k
 void from_json(const json& j, GetDiagnosticsResponse& k);
 
+/// \brief Writes the given GetDiagnosticsResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k);
+
+/// \brief Reads the given GetDiagnosticsResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetDiagnosticsResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetDiagnosticsResponse
+void validate_get_diagnostics_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k);
@@ -24,6 +24,15 @@ void to_json(json& j, const GetLocalListVersionRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionRequest \p k
 void from_json(const json& j, GetLocalListVersionRequest& k);
 
+/// \brief Writes the given GetLocalListVersionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k);
+
+/// \brief Reads the given GetLocalListVersionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetLocalListVersionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetLocalListVersionRequest
+void validate_get_local_list_version_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k);
@@ -43,6 +52,15 @@ void to_json(json& j, const GetLocalListVersionResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionResponse \p k
 void from_json(const json& j, GetLocalListVersionResponse& k);
 
+/// \brief Writes the given GetLocalListVersionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k);
+
+/// \brief Reads the given GetLocalListVersionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetLocalListVersionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetLocalListVersionResponse
+void validate_get_local_list_version_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k);
@@ -24,6 +24,15 @@ void to_json(json& j, const HeartbeatRequest& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatRequest \p k
 void from_json(const json& j, HeartbeatRequest& k);
 
+/// \brief Writes the given HeartbeatRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const HeartbeatRequest& k);
+
+/// \brief Reads the given HeartbeatRequest \p k from the given \p reader
+void read_json(JsonReader& reader, HeartbeatRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a HeartbeatRequest
+void validate_heartbeat_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k);
@@ -43,6 +52,15 @@ void to_json(json& j, const HeartbeatResponse& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatResponse \p k
 void from_json(const json& j, HeartbeatResponse& k);
 
+/// \brief Writes the given HeartbeatResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const HeartbeatResponse& k);
+
+/// \brief Reads the given HeartbeatResponse \p k from the given \p reader
+void read_json(JsonReader& reader, HeartbeatResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a HeartbeatResponse
+void validate_heartbeat_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k);
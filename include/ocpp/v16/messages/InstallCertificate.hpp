@@ -27,6 +27,15 @@ void to_json(json& j, const InstallCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateRequest \p k
 void from_json(const json& j, InstallCertificateRequest& k);
 
+/// \brief Writes the given InstallCertificateRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k);
+
+/// \brief Reads the given InstallCertificateRequest \p k from the given \p reader
+void read_json(JsonReader& reader, InstallCertificateRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a InstallCertificateRequest
+void validate_install_certificate_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k);
@@ -46,6 +55,15 @@ void to_json(json& j, const InstallCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateResponse \p k
 void from_json(const json& j, InstallCertificateResponse& k);
 
+/// \brief Writes the given InstallCertificateResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k);
+
+/// \brief Reads the given InstallCertificateResponse \p k from the given \p reader
+void read_json(JsonReader& reader, InstallCertificateResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a InstallCertificateResponse
+void validate_install_certificate_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k);
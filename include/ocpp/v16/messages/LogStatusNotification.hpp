@@ -28,6 +28,15 @@ void to_json(json& j, const LogStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationRequest \p k
 void from_json(const json& j, LogStatusNotificationRequest& k);
 
+/// \brief Writes the given LogStatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k);
+
+/// \brief Reads the given LogStatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, LogStatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogStatusNotificationRequest
+void validate_log_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k);
@@ -46,6 +55,15 @@ void to_json(json& j, const LogStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationResponse \p k
 void from_json(const json& j, LogStatusNotificationResponse& k);
 
+/// \brief Writes the given LogStatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k);
+
+/// \brief Reads the given LogStatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, LogStatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogStatusNotificationResponse
+void validate_log_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k);
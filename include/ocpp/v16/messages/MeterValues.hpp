@@ -29,6 +29,15 @@ void to_json(json& j, const MeterValuesRequest& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesRequest \p k
 void from_json(const json& j, MeterValuesRequest& k);
 
+/// \brief Writes the given MeterValuesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
+/// \brief Reads the given MeterValuesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValuesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValuesRequest
+void validate_meter_values_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const MeterValuesResponse& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesResponse \p k
 void from_json(const json& j, MeterValuesResponse& k);
 
+/// \brief Writes the given MeterValuesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
+/// \brief Reads the given MeterValuesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValuesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValuesResponse
+void validate_meter_values_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k);
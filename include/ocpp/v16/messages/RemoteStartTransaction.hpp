@@ -30,6 +30,15 @@ void to_json(json& j, const RemoteStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionRequest \p k
 void from_json(const json& j, RemoteStartTransactionRequest& k);
 
+/// \brief Writes the given RemoteStartTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k);
+
+/// \brief Reads the given RemoteStartTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, RemoteStartTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RemoteStartTransactionRequest
+void validate_remote_start_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const RemoteStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionResponse \p k
 void from_json(const json& j, RemoteStartTransactionResponse& k);
 
+/// \brief Writes the given RemoteStartTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k);
+
+/// \brief Reads the given RemoteStartTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, RemoteStartTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RemoteStartTransactionResponse
+void validate_remote_start_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k);
@@ -26,6 +26,15 @@ void to_json(json& j, const RemoteStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionRequest \p k
 void from_json(const json& j, RemoteStopTransactionRequest& k);
 
+/// \brief Writes the given RemoteStopTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k);
+
+/// \brief Reads the given RemoteStopTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, RemoteStopTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RemoteStopTransactionRequest
+void validate_remote_stop_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k);
@@ -45,6 +54,15 @@ void to_json(json& j, const RemoteStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionResponse \p k
 void from_json(const json& j, RemoteStopTransactionResponse& k);
 
+/// \brief Writes the given RemoteStopTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k);
+
+/// \brief Reads the given RemoteStopTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, RemoteStopTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RemoteStopTransactionResponse
+void validate_remote_stop_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k);
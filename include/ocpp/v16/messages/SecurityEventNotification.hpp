@@ -29,6 +29,15 @@ void to_json(json& j, const SecurityEventNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationRequest \p k
 void from_json(const json& j, SecurityEventNotificationRequest& k);
 
+/// \brief Writes the given SecurityEventNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k);
+
+/// \brief Reads the given SecurityEventNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SecurityEventNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SecurityEventNotificationRequest
+void validate_security_event_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const SecurityEventNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationResponse \p k
 void from_json(const json& j, SecurityEventNotificationResponse& k);
 
+/// \brief Writes the given SecurityEventNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k);
+
+/// \brief Reads the given SecurityEventNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SecurityEventNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SecurityEventNotificationResponse
+void validate_security_event_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k);
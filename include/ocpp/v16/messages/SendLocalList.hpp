@@ -30,6 +30,15 @@ void to_json(json& j, const SendLocalListRequest& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListRequest \p k
 void from_json(const json& j, SendLocalListRequest& k);
 
+/// \brief Writes the given SendLocalListRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SendLocalListRequest& k);
+
+/// \brief Reads the given SendLocalListRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SendLocalListRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SendLocalListRequest
+void validate_send_local_list_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const SendLocalListResponse& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListResponse \p k
 void from_json(const json& j, SendLocalListResponse& k);
 
+/// \brief Writes the given SendLocalListResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SendLocalListResponse& k);
+
+/// \brief Reads the given SendLocalListResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SendLocalListResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SendLocalListResponse
+void validate_send_local_list_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k);
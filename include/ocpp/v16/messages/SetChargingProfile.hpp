@@ -28,6 +28,15 @@ void to_json(json& j, const SetChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileRequest \p k
 void from_json(const json& j, SetChargingProfileRequest& k);
 
+/// \brief Writes the given SetChargingProfileRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k);
+
+/// \brief Reads the given SetChargingProfileRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetChargingProfileRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetChargingProfileRequest
+void validate_set_charging_profile_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k);
@@ -47,6 +56,15 @@ void to_json(json& j, const SetChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileResponse \p k
 void from_json(const json& j, SetChargingProfileResponse& k);
 
+/// \brief Writes the given SetChargingProfileResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k);
+
+/// \brief Reads the given SetChargingProfileResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetChargingProfileResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetChargingProfileResponse
+void validate_set_charging_profile_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k);
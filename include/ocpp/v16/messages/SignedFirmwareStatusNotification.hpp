@@ -28,6 +28,16 @@ void to_json(json& j, const SignedFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k);
+
+/// \brief Reads the given SignedFirmwareStatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SignedFirmwareStatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// SignedFirmwareStatusNotificationRequest
+void validate_signed_firmware_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationRequest& k);
@@ -46,6 +56,16 @@ void to_json(json& j, const SignedFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k);
+
+/// \brief Reads the given SignedFirmwareStatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SignedFirmwareStatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// SignedFirmwareStatusNotificationResponse
+void validate_signed_firmware_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationResponse& k);
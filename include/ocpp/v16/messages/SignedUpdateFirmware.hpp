@@ -30,6 +30,15 @@ void to_json(json& j, const SignedUpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareRequest \p k
 void from_json(const json& j, SignedUpdateFirmwareRequest& k);
 
+/// \brief Writes the given SignedUpdateFirmwareRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k);
+
+/// \brief Reads the given SignedUpdateFirmwareRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SignedUpdateFirmwareRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignedUpdateFirmwareRequest
+void validate_signed_update_firmware_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const SignedUpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareResponse \p k
 void from_json(const json& j, SignedUpdateFirmwareResponse& k);
 
+/// \brief Writes the given SignedUpdateFirmwareResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k);
+
+/// \brief Reads the given SignedUpdateFirmwareResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SignedUpdateFirmwareResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignedUpdateFirmwareResponse
+void validate_signed_update_firmware_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k);
@@ -32,6 +32,15 @@ void to_json(json& j, const StartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionRequest \p k
 void from_json(const json& j, StartTransactionRequest& k);
 
+/// \brief Writes the given StartTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StartTransactionRequest& k);
+
+/// \brief Reads the given StartTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, StartTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StartTransactionRequest
+void validate_start_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const StartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionResponse \p k
 void from_json(const json& j, StartTransactionResponse& k);
 
+/// \brief Writes the given StartTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StartTransactionResponse& k);
+
+/// \brief Reads the given StartTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, StartTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StartTransactionResponse
+void validate_start_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k);
@@ -34,6 +34,15 @@ void to_json(json& j, const StatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationRequest \p k
 void from_json(const json& j, StatusNotificationRequest& k);
 
+/// \brief Writes the given StatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k);
+
+/// \brief Reads the given StatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, StatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StatusNotificationRequest
+void validate_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const StatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationResponse \p k
 void from_json(const json& j, StatusNotificationResponse& k);
 
+/// \brief Writes the given StatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k);
+
+/// \brief Reads the given StatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, StatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StatusNotificationResponse
+void validate_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k);
@@ -33,6 +33,15 @@ void to_json(json& j, const StopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionRequest \p k
 void from_json(const json& j, StopTransactionRequest& k);
 
+/// \brief Writes the given StopTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StopTransactionRequest& k);
+
+/// \brief Reads the given StopTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, StopTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StopTransactionRequest
+void validate_stop_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const StopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionResponse \p k
 void from_json(const json& j, StopTransactionResponse& k);
 
+/// \brief Writes the given StopTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StopTransactionResponse& k);
+
+/// \brief Reads the given StopTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, StopTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StopTransactionResponse
+void validate_stop_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k);
@@ -8,6 +8,9 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_reader.hpp>
+#include <ocpp/common/json_validator.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/enums.hpp>
 #include <ocpp/v16/types.hpp>
@@ -26,6 +29,15 @@ void to_json(json& j, const IdTagInfo& k);
 /// \brief Conversion from a given json object \p j to a given IdTagInfo \p k
 void from_json(const json& j, IdTagInfo& k);
 
+/// \brief Writes the given IdTagInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdTagInfo& k);
+
+/// \brief Reads the given IdTagInfo \p k from the given \p reader
+void read_json(JsonReader& reader, IdTagInfo& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdTagInfo
+void validate_id_tag_info(JsonValidator& validator);
+
 // \brief Writes the string representation of the given IdTagInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTagInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTagInfo& k);
@@ -42,6 +54,15 @@ void to_json(json& j, const CertificateHashDataType& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
+/// \brief Reads the given CertificateHashDataType \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataType& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataType
+void validate_certificate_hash_data_type(JsonValidator& validator);
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k);
@@ -57,6 +78,15 @@ void to_json(json& j, const ChargingSchedulePeriod& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
+/// \brief Reads the given ChargingSchedulePeriod \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedulePeriod& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedulePeriod
+void validate_charging_schedule_period(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k);
@@ -74,6 +104,15 @@ void to_json(json& j, const ChargingSchedule& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
+/// \brief Reads the given ChargingSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedule& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedule
+void validate_charging_schedule(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k);
@@ -89,6 +128,15 @@ void to_json(json& j, const KeyValue& k);
 /// \brief Conversion from a given json object \p j to a given KeyValue \p k
 void from_json(const json& j, KeyValue& k);
 
+/// \brief Writes the given KeyValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const KeyValue& k);
+
+/// \brief Reads the given KeyValue \p k from the given \p reader
+void read_json(JsonReader& reader, KeyValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a KeyValue
+void validate_key_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given KeyValue \p k to the given output stream \p os
 /// \returns an output stream with the KeyValue written to
 std::ostream& operator<<(std::ostream& os, const KeyValue& k);
@@ -104,6 +152,15 @@ void to_json(json& j, const LogParametersType& k);
 /// \brief Conversion from a given json object \p j to a given LogParametersType \p k
 void from_json(const json& j, LogParametersType& k);
 
+/// \brief Writes the given LogParametersType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogParametersType& k);
+
+/// \brief Reads the given LogParametersType \p k from the given \p reader
+void read_json(JsonReader& reader, LogParametersType& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogParametersType
+void validate_log_parameters_type(JsonValidator& validator);
+
 // \brief Writes the string representation of the given LogParametersType \p k to the given output stream \p os
 /// \returns an output stream with the LogParametersType written to
 std::ostream& operator<<(std::ostream& os, const LogParametersType& k);
@@ -123,6 +180,15 @@ void to_json(json& j, const SampledValue& k);
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k);
+
+/// \brief Reads the given SampledValue \p k from the given \p reader
+void read_json(JsonReader& reader, SampledValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SampledValue
+void validate_sampled_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k);
@@ -137,6 +203,15 @@ void to_json(json& j, const MeterValue& k);
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k);
+
+/// \brief Reads the given MeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValue
+void validate_meter_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k);
@@ -158,6 +233,15 @@ void to_json(json& j, const ChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
+/// \brief Reads the given ChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfile& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfile
+void validate_charging_profile(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k);
@@ -172,6 +256,15 @@ void to_json(json& j, const LocalAuthorizationList& k);
 /// \brief Conversion from a given json object \p j to a given LocalAuthorizationList \p k
 void from_json(const json& j, LocalAuthorizationList& k);
 
+/// \brief Writes the given LocalAuthorizationList \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k);
+
+/// \brief Reads the given LocalAuthorizationList \p k from the given \p reader
+void read_json(JsonReader& reader, LocalAuthorizationList& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a LocalAuthorizationList
+void validate_local_authorization_list(JsonValidator& validator);
+
 // \brief Writes the string representation of the given LocalAuthorizationList \p k to the given output stream \p os
 /// \returns an output stream with the LocalAuthorizationList written to
 std::ostream& operator<<(std::ostream& os, const LocalAuthorizationList& k);
@@ -189,6 +282,15 @@ void to_json(json& j, const FirmwareType& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareType \p k
 void from_json(const json& j, FirmwareType& k);
 
+/// \brief Writes the given FirmwareType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareType& k);
+
+/// \brief Reads the given FirmwareType \p k from the given \p reader
+void read_json(JsonReader& reader, FirmwareType& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a FirmwareType
+void validate_firmware_type(JsonValidator& validator);
+
 // \brief Writes the string representation of the given FirmwareType \p k to the given output stream \p os
 /// \returns an output stream with the FirmwareType written to
 std::ostream& operator<<(std::ostream& os, const FirmwareType& k);
@@ -203,6 +305,15 @@ void to_json(json& j, const TransactionData& k);
 /// \brief Conversion from a given json object \p j to a given TransactionData \p k
 void from_json(const json& j, TransactionData& k);
 
+/// \brief Writes the given TransactionData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TransactionData& k);
+
+/// \brief Reads the given TransactionData \p k from the given \p reader
+void read_json(JsonReader& reader, TransactionData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a TransactionData
+void validate_transaction_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given TransactionData \p k to the given output stream \p os
 /// \returns an output stream with the TransactionData written to
 std::ostream& operator<<(std::ostream& os, const TransactionData& k);
@@ -104,7 +104,7 @@ enum class MessageType {
 namespace conversions {
 /// \brief Converts the given MessageType \p m to std::string
 /// \returns a string representation of the MessageType
-std::string messagetype_to_string(MessageType m);
+std::string_view messagetype_to_string(MessageType m);
 
 /// \brief Converts the given std::string \p s to MessageType
 /// \returns a MessageType from a string representation
@@ -131,7 +131,7 @@ enum SupportedFeatureProfiles {
 namespace conversions {
 /// \brief Converts the given SupportedFeatureProfiles \p e to std::string
 /// \returns a string representation of the SupportedFeatureProfiles
-std::string supported_feature_profiles_to_string(SupportedFeatureProfiles e);
+std::string_view supported_feature_profiles_to_string(SupportedFeatureProfiles e);
 
 /// \brief Converts the given std::string \p s to SupportedFeatureProfiles
 /// \returns a SupportedFeatureProfiles from a string representation
@@ -153,7 +153,7 @@ enum ChargePointConnectionState {
 namespace conversions {
 /// \brief Converts the given ChargePointConnectionState \p e to std::string
 /// \returns a string representation of the ChargePointConnectionState
-std::string charge_point_connection_state_to_string(ChargePointConnectionState e);
+std::string_view charge_point_connection_state_to_string(ChargePointConnectionState e);
 
 /// \brief Converts the given std::string \p s to ChargePointConnectionState
 /// \returns a ChargePointConnectionState from a string representation
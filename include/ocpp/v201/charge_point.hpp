@@ -15,10 +15,12 @@
 #include <ocpp/v201/device_model_storage.hpp>
 #include <ocpp/v201/enums.hpp>
 #include <ocpp/v201/evse.hpp>
+#include <ocpp/v201/notify_report_requests_splitter.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 #include <ocpp/v201/ocsp_updater.hpp>
 #include <ocpp/v201/types.hpp>
 #include <ocpp/v201/utils.hpp>
+#include <ocpp/v201/variable_monitoring_engine.hpp>
 
 #include "ocpp/v201/messages/Get15118EVCertificate.hpp"
 #include <ocpp/v201/messages/Authorize.hpp>
@@ -183,6 +185,18 @@ struct AvailabilityChange {
     bool persist;
 };
 
+/// \brief Reconfiguration of a subsystem that is required when one of the variables it depends on has changed. They are
+/// applied in the order of this enum and only once, no matter how many of these variables have changed at once
+enum class VariableChangeEffect {
+    RestartHeartbeatTimer,
+    RestartAlignedDataTimer,
+    UpdateWebsocketOptions,
+    UpdateMessageAttemptInterval,
+    UpdateMessageAttempts,
+    UpdateMessageTimeout,
+    ReconnectWebsocket,
+};
+
 /// \brief Interface class for OCPP2.0.1 Charging Station
 class ChargePointInterface {
 public:
@@ -395,6 +409,7 @@ private:
     std::unique_ptr<MessageQueue<v201::MessageType>> message_queue;
     std::unique_ptr<DeviceModel> device_model;
     std::shared_ptr<DatabaseHandler> database_handler;
+    std::unique_ptr<VariableMonitoringEngine> monitoring_engine;
 
     std::map<int32_t, AvailabilityChange> scheduled_change_availability_requests;
 
@@ -406,6 +421,7 @@ private:
     Everest::SteadyTimer client_certificate_expiration_check_timer;
     Everest::SteadyTimer v2g_certificate_expiration_check_timer;
     ClockAlignedTimer aligned_meter_values_timer;
+    Everest::SteadyTimer device_model_flush_timer;
 
     // time keeping
     std::chrono::time_point<std::chrono::steady_clock> heartbeat_request_time;
@@ -503,6 +519,13 @@ private:
     void handle_scheduled_change_availability_requests(const int32_t evse_id);
     void handle_variable_changed(const SetVariableData& set_variable_data);
     void handle_variables_changed(const std::map<SetVariableData, SetVariableResult>& set_variable_results);
+
+    /// \brief Adds the reconfigurations that are required because of the changed \p set_variable_data to \p effects
+    void collect_variable_change_effects(const SetVariableData& set_variable_data,
+                                         std::set<VariableChangeEffect>& effects);
+
+    /// \brief Applies the given \p effects using the current values of the device model
+    void apply_variable_change_effects(const std::set<VariableChangeEffect>& effects);
     bool validate_set_variable(const SetVariableData& set_variable_data);
 
     /// \brief Sets variables specified within \p set_variable_data_vector in the device model and returns the result.
@@ -514,7 +537,7 @@ private:
     set_variables_internal(const std::vector<SetVariableData>& set_variable_data_vector, const bool allow_read_only);
 
     MeterValue get_latest_meter_value_filtered(const MeterValue& meter_value, ReadingContextEnum context,
-                                               const RequiredComponentVariable& component_variable);
+                                               const ComponentVariableHandle<std::string>& measurands);
 
     /// \brief Changes all unoccupied connectors to unavailable. If a transaction is running schedule an availabilty
     /// change
@@ -617,7 +640,11 @@ private:
 
     // Functional Block B: Provisioning
     void boot_notification_req(const BootReasonEnum& reason);
-    void notify_report_req(const int request_id, const std::vector<ReportData>& report_data);
+    /// \brief Creates a splitter that turns the ReportData that is added to it into NotifyReport.req payloads for the
+    /// given \p request_id , which are passed to \p payload_callback as soon as they are full
+    NotifyReportRequestsSplitter
+    create_notify_report_splitter(const int request_id,
+                                  NotifyReportRequestsSplitter::PayloadCallback&& payload_callback);
 
     // Functional Block C: Authorization
     AuthorizeResponse authorize_req(const IdToken id_token, const std::optional<CiString<5500>>& certificate,
@@ -718,8 +745,8 @@ private:
             if (enhanced_response.messageType != expected_response_message_type) {
                 throw UnexpectedMessageTypeFromCSMS(
                     std::string("Got unexpected message type from CSMS, expected: ") +
-                    conversions::messagetype_to_string(expected_response_message_type) +
-                    ", got: " + conversions::messagetype_to_string(enhanced_response.messageType));
+                    std::string(conversions::messagetype_to_string(expected_response_message_type)) +
+                    ", got: " + std::string(conversions::messagetype_to_string(enhanced_response.messageType)));
             }
             ocpp::CallResult<ResponseType> call_result = enhanced_response.message;
             return call_result.msg;
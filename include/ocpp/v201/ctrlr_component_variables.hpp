@@ -55,6 +55,7 @@ extern const RequiredComponentVariable& LogMessagesFormat;
 extern const ComponentVariable& SupportedChargingProfilePurposeTypes;
 extern const ComponentVariable& SupportedCriteria;
 extern const ComponentVariable& RoundClockAlignedTimestamps;
+extern const ComponentVariable& DeviceModelFlushInterval;
 extern const ComponentVariable& MaxCompositeScheduleDuration;
 extern const RequiredComponentVariable& NumberOfConnectors;
 extern const ComponentVariable& UseSslDefaultVerifyPaths;
@@ -62,6 +63,8 @@ extern const ComponentVariable& VerifyCsmsCommonName;
 extern const ComponentVariable& UseTPM;
 extern const ComponentVariable& VerifyCsmsAllowWildcards;
 extern const ComponentVariable& IFace;
+extern const ComponentVariable& WebsocketPerMessageDeflate;
+extern const ComponentVariable& MaxInboundMessageSize;
 extern const ComponentVariable& OcspRequestInterval;
 extern const ComponentVariable& WebsocketPingPayload;
 extern const ComponentVariable& WebsocketPongTimeout;
@@ -71,7 +74,12 @@ extern const ComponentVariable& V2GCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckInitialDelaySeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& MessageQueueSizeThreshold;
+extern const ComponentVariable& TransactionQueueCommitInterval;
+extern const ComponentVariable& StrictMessageValidation;
 extern const ComponentVariable& MaxMessageSize;
+extern const ComponentVariable& NotifyEventCoalescingInterval;
+extern const ComponentVariable& TransactionUpdateCompactionItemsPerMessage;
+extern const ComponentVariable& TransactionUpdateCompactionBytesPerMessage;
 extern const ComponentVariable& AlignedDataCtrlrEnabled;
 extern const ComponentVariable& AlignedDataCtrlrAvailable;
 extern const RequiredComponentVariable& AlignedDataInterval;
@@ -206,6 +214,201 @@ extern const RequiredComponentVariable& TxStartPoint;
 extern const RequiredComponentVariable& TxStopPoint;
 } // namespace ControllerComponentVariables
 
+/// \brief Typed handle to one of the ControllerComponentVariables. The DeviceModel resolves all handles when it is
+/// constructed, so the Actual value of the variable can be accessed by \p index without looking up its component and
+/// variable by name.
+/// \tparam T type of the value of the variable
+template <typename T> struct ComponentVariableHandle {
+    size_t index; ///< index of the ComponentVariable, see ControllerComponentVariableHandles::get_component_variable
+};
+
+// Provides typed handles to the standardized variables of OCPP2.0.1 spec
+namespace ControllerComponentVariableHandles {
+/// \brief Number of handles, their indices range from 0 to COUNT - 1
+constexpr size_t COUNT = 177;
+
+/// \brief Gets the ComponentVariable that the handle with the given \p index refers to
+const ComponentVariable& get_component_variable(const size_t index);
+
+constexpr ComponentVariableHandle<bool> InternalCtrlrEnabled{0};
+constexpr ComponentVariableHandle<std::string> ChargePointId{1};
+constexpr ComponentVariableHandle<std::string> NetworkConnectionProfiles{2};
+constexpr ComponentVariableHandle<std::string> ChargeBoxSerialNumber{3};
+constexpr ComponentVariableHandle<std::string> ChargePointModel{4};
+constexpr ComponentVariableHandle<std::string> ChargePointSerialNumber{5};
+constexpr ComponentVariableHandle<std::string> ChargePointVendor{6};
+constexpr ComponentVariableHandle<std::string> FirmwareVersion{7};
+constexpr ComponentVariableHandle<std::string> ICCID{8};
+constexpr ComponentVariableHandle<std::string> IMSI{9};
+constexpr ComponentVariableHandle<std::string> MeterSerialNumber{10};
+constexpr ComponentVariableHandle<std::string> MeterType{11};
+constexpr ComponentVariableHandle<std::string> SupportedCiphers12{12};
+constexpr ComponentVariableHandle<std::string> SupportedCiphers13{13};
+constexpr ComponentVariableHandle<bool> AuthorizeConnectorZeroOnConnectorOne{14};
+constexpr ComponentVariableHandle<bool> LogMessages{15};
+constexpr ComponentVariableHandle<std::string> LogMessagesFormat{16};
+constexpr ComponentVariableHandle<std::string> SupportedChargingProfilePurposeTypes{17};
+constexpr ComponentVariableHandle<std::string> SupportedCriteria{18};
+constexpr ComponentVariableHandle<bool> RoundClockAlignedTimestamps{19};
+constexpr ComponentVariableHandle<int> DeviceModelFlushInterval{20};
+constexpr ComponentVariableHandle<int> MaxCompositeScheduleDuration{21};
+constexpr ComponentVariableHandle<int> NumberOfConnectors{22};
+constexpr ComponentVariableHandle<bool> UseSslDefaultVerifyPaths{23};
+constexpr ComponentVariableHandle<bool> VerifyCsmsCommonName{24};
+constexpr ComponentVariableHandle<bool> UseTPM{25};
+constexpr ComponentVariableHandle<bool> VerifyCsmsAllowWildcards{26};
+constexpr ComponentVariableHandle<std::string> IFace{27};
+constexpr ComponentVariableHandle<bool> WebsocketPerMessageDeflate{28};
+constexpr ComponentVariableHandle<int> MaxInboundMessageSize{29};
+constexpr ComponentVariableHandle<int> OcspRequestInterval{30};
+constexpr ComponentVariableHandle<std::string> WebsocketPingPayload{31};
+constexpr ComponentVariableHandle<int> WebsocketPongTimeout{32};
+constexpr ComponentVariableHandle<int> MaxCustomerInformationDataLength{33};
+constexpr ComponentVariableHandle<int> V2GCertificateExpireCheckInitialDelaySeconds{34};
+constexpr ComponentVariableHandle<int> V2GCertificateExpireCheckIntervalSeconds{35};
+constexpr ComponentVariableHandle<int> ClientCertificateExpireCheckInitialDelaySeconds{36};
+constexpr ComponentVariableHandle<int> ClientCertificateExpireCheckIntervalSeconds{37};
+constexpr ComponentVariableHandle<int> MessageQueueSizeThreshold{38};
+constexpr ComponentVariableHandle<int> TransactionQueueCommitInterval{39};
+constexpr ComponentVariableHandle<bool> StrictMessageValidation{40};
+constexpr ComponentVariableHandle<int> MaxMessageSize{41};
+constexpr ComponentVariableHandle<int> NotifyEventCoalescingInterval{42};
+constexpr ComponentVariableHandle<int> TransactionUpdateCompactionItemsPerMessage{43};
+constexpr ComponentVariableHandle<int> TransactionUpdateCompactionBytesPerMessage{44};
+constexpr ComponentVariableHandle<bool> AlignedDataCtrlrEnabled{45};
+constexpr ComponentVariableHandle<bool> AlignedDataCtrlrAvailable{46};
+constexpr ComponentVariableHandle<int> AlignedDataInterval{47};
+constexpr ComponentVariableHandle<std::string> AlignedDataMeasurands{48};
+constexpr ComponentVariableHandle<bool> AlignedDataSendDuringIdle{49};
+constexpr ComponentVariableHandle<bool> AlignedDataSignReadings{50};
+constexpr ComponentVariableHandle<int> AlignedDataTxEndedInterval{51};
+constexpr ComponentVariableHandle<std::string> AlignedDataTxEndedMeasurands{52};
+constexpr ComponentVariableHandle<bool> AuthCacheCtrlrAvailable{53};
+constexpr ComponentVariableHandle<bool> AuthCacheCtrlrEnabled{54};
+constexpr ComponentVariableHandle<bool> AuthCacheDisablePostAuthorize{55};
+constexpr ComponentVariableHandle<int> AuthCacheLifeTime{56};
+constexpr ComponentVariableHandle<std::string> AuthCachePolicy{57};
+constexpr ComponentVariableHandle<int> AuthCacheStorage{58};
+constexpr ComponentVariableHandle<bool> AuthCtrlrEnabled{59};
+constexpr ComponentVariableHandle<int> AdditionalInfoItemsPerMessage{60};
+constexpr ComponentVariableHandle<bool> AuthorizeRemoteStart{61};
+constexpr ComponentVariableHandle<bool> LocalAuthorizeOffline{62};
+constexpr ComponentVariableHandle<bool> LocalPreAuthorize{63};
+constexpr ComponentVariableHandle<bool> DisableRemoteAuthorization{64};
+constexpr ComponentVariableHandle<std::string> MasterPassGroupId{65};
+constexpr ComponentVariableHandle<bool> OfflineTxForUnknownIdEnabled{66};
+constexpr ComponentVariableHandle<bool> AllowNewSessionsPendingFirmwareUpdate{67};
+constexpr ComponentVariableHandle<std::string> ChargingStationAvailabilityState{68};
+constexpr ComponentVariableHandle<bool> ChargingStationAvailable{69};
+constexpr ComponentVariableHandle<int> ChargingStationSupplyPhases{70};
+constexpr ComponentVariableHandle<DateTime> ClockCtrlrDateTime{71};
+constexpr ComponentVariableHandle<DateTime> NextTimeOffsetTransitionDateTime{72};
+constexpr ComponentVariableHandle<std::string> NtpServerUri{73};
+constexpr ComponentVariableHandle<std::string> NtpSource{74};
+constexpr ComponentVariableHandle<int> TimeAdjustmentReportingThreshold{75};
+constexpr ComponentVariableHandle<std::string> TimeOffset{76};
+constexpr ComponentVariableHandle<std::string> TimeOffsetNextTransition{77};
+constexpr ComponentVariableHandle<std::string> TimeSource{78};
+constexpr ComponentVariableHandle<std::string> TimeZone{79};
+constexpr ComponentVariableHandle<bool> CustomImplementationEnabled{80};
+constexpr ComponentVariableHandle<int> BytesPerMessageGetReport{81};
+constexpr ComponentVariableHandle<int> BytesPerMessageGetVariables{82};
+constexpr ComponentVariableHandle<int> BytesPerMessageSetVariables{83};
+constexpr ComponentVariableHandle<int> ConfigurationValueSize{84};
+constexpr ComponentVariableHandle<int> ItemsPerMessageGetReport{85};
+constexpr ComponentVariableHandle<int> ItemsPerMessageGetVariables{86};
+constexpr ComponentVariableHandle<int> ItemsPerMessageSetVariables{87};
+constexpr ComponentVariableHandle<int> ReportingValueSize{88};
+constexpr ComponentVariableHandle<bool> DisplayMessageCtrlrAvailable{89};
+constexpr ComponentVariableHandle<int> NumberOfDisplayMessages{90};
+constexpr ComponentVariableHandle<std::string> DisplayMessageSupportedFormats{91};
+constexpr ComponentVariableHandle<std::string> DisplayMessageSupportedPriorities{92};
+constexpr ComponentVariableHandle<bool> CentralContractValidationAllowed{93};
+constexpr ComponentVariableHandle<bool> ContractValidationOffline{94};
+constexpr ComponentVariableHandle<bool> RequestMeteringReceipt{95};
+constexpr ComponentVariableHandle<std::string> ISO15118CtrlrSeccId{96};
+constexpr ComponentVariableHandle<std::string> ISO15118CtrlrCountryName{97};
+constexpr ComponentVariableHandle<std::string> ISO15118CtrlrOrganizationName{98};
+constexpr ComponentVariableHandle<bool> PnCEnabled{99};
+constexpr ComponentVariableHandle<bool> V2GCertificateInstallationEnabled{100};
+constexpr ComponentVariableHandle<bool> ContractCertificateInstallationEnabled{101};
+constexpr ComponentVariableHandle<bool> LocalAuthListCtrlrAvailable{102};
+constexpr ComponentVariableHandle<int> BytesPerMessageSendLocalList{103};
+constexpr ComponentVariableHandle<bool> LocalAuthListCtrlrEnabled{104};
+constexpr ComponentVariableHandle<int> LocalAuthListCtrlrEntries{105};
+constexpr ComponentVariableHandle<int> ItemsPerMessageSendLocalList{106};
+constexpr ComponentVariableHandle<int> LocalAuthListCtrlrStorage{107};
+constexpr ComponentVariableHandle<bool> MonitoringCtrlrAvailable{108};
+constexpr ComponentVariableHandle<int> BytesPerMessageClearVariableMonitoring{109};
+constexpr ComponentVariableHandle<int> BytesPerMessageSetVariableMonitoring{110};
+constexpr ComponentVariableHandle<bool> MonitoringCtrlrEnabled{111};
+constexpr ComponentVariableHandle<int> ItemsPerMessageClearVariableMonitoring{112};
+constexpr ComponentVariableHandle<int> ItemsPerMessageSetVariableMonitoring{113};
+constexpr ComponentVariableHandle<int> OfflineQueuingSeverity{114};
+constexpr ComponentVariableHandle<std::string> ActiveNetworkProfile{115};
+constexpr ComponentVariableHandle<std::string> FileTransferProtocols{116};
+constexpr ComponentVariableHandle<int> HeartbeatInterval{117};
+constexpr ComponentVariableHandle<int> MessageTimeout{118};
+constexpr ComponentVariableHandle<int> MessageAttemptInterval{119};
+constexpr ComponentVariableHandle<int> MessageAttempts{120};
+constexpr ComponentVariableHandle<std::string> NetworkConfigurationPriority{121};
+constexpr ComponentVariableHandle<int> NetworkProfileConnectionAttempts{122};
+constexpr ComponentVariableHandle<int> OfflineThreshold{123};
+constexpr ComponentVariableHandle<bool> QueueAllMessages{124};
+constexpr ComponentVariableHandle<int> ResetRetries{125};
+constexpr ComponentVariableHandle<int> RetryBackOffRandomRange{126};
+constexpr ComponentVariableHandle<int> RetryBackOffRepeatTimes{127};
+constexpr ComponentVariableHandle<int> RetryBackOffWaitMinimum{128};
+constexpr ComponentVariableHandle<bool> UnlockOnEVSideDisconnect{129};
+constexpr ComponentVariableHandle<int> WebSocketPingInterval{130};
+constexpr ComponentVariableHandle<bool> ReservationCtrlrAvailable{131};
+constexpr ComponentVariableHandle<bool> ReservationCtrlrEnabled{132};
+constexpr ComponentVariableHandle<bool> ReservationCtrlrNonEvseSpecific{133};
+constexpr ComponentVariableHandle<bool> SampledDataCtrlrAvailable{134};
+constexpr ComponentVariableHandle<bool> SampledDataCtrlrEnabled{135};
+constexpr ComponentVariableHandle<bool> SampledDataSignReadings{136};
+constexpr ComponentVariableHandle<int> SampledDataTxEndedInterval{137};
+constexpr ComponentVariableHandle<std::string> SampledDataTxEndedMeasurands{138};
+constexpr ComponentVariableHandle<std::string> SampledDataTxStartedMeasurands{139};
+constexpr ComponentVariableHandle<int> SampledDataTxUpdatedInterval{140};
+constexpr ComponentVariableHandle<std::string> SampledDataTxUpdatedMeasurands{141};
+constexpr ComponentVariableHandle<bool> AdditionalRootCertificateCheck{142};
+constexpr ComponentVariableHandle<std::string> BasicAuthPassword{143};
+constexpr ComponentVariableHandle<int> CertificateEntries{144};
+constexpr ComponentVariableHandle<int> CertSigningRepeatTimes{145};
+constexpr ComponentVariableHandle<int> CertSigningWaitMinimum{146};
+constexpr ComponentVariableHandle<std::string> SecurityCtrlrIdentity{147};
+constexpr ComponentVariableHandle<int> MaxCertificateChainSize{148};
+constexpr ComponentVariableHandle<bool> UpdateCertificateSymlinks{149};
+constexpr ComponentVariableHandle<std::string> OrganizationName{150};
+constexpr ComponentVariableHandle<int> SecurityProfile{151};
+constexpr ComponentVariableHandle<bool> ACPhaseSwitchingSupported{152};
+constexpr ComponentVariableHandle<bool> SmartChargingCtrlrAvailable{153};
+constexpr ComponentVariableHandle<bool> SmartChargingCtrlrAvailableEnabled{154};
+constexpr ComponentVariableHandle<int> EntriesChargingProfiles{155};
+constexpr ComponentVariableHandle<bool> ExternalControlSignalsEnabled{156};
+constexpr ComponentVariableHandle<double> LimitChangeSignificance{157};
+constexpr ComponentVariableHandle<bool> NotifyChargingLimitWithSchedules{158};
+constexpr ComponentVariableHandle<int> PeriodsPerSchedule{159};
+constexpr ComponentVariableHandle<bool> Phases3to1{160};
+constexpr ComponentVariableHandle<int> ChargingProfileMaxStackLevel{161};
+constexpr ComponentVariableHandle<std::string> ChargingScheduleChargingRateUnit{162};
+constexpr ComponentVariableHandle<bool> TariffCostCtrlrAvailableTariff{163};
+constexpr ComponentVariableHandle<bool> TariffCostCtrlrAvailableCost{164};
+constexpr ComponentVariableHandle<std::string> TariffCostCtrlrCurrency{165};
+constexpr ComponentVariableHandle<bool> TariffCostCtrlrEnabledTariff{166};
+constexpr ComponentVariableHandle<bool> TariffCostCtrlrEnabledCost{167};
+constexpr ComponentVariableHandle<std::string> TariffFallbackMessage{168};
+constexpr ComponentVariableHandle<std::string> TotalCostFallbackMessage{169};
+constexpr ComponentVariableHandle<int> EVConnectionTimeOut{170};
+constexpr ComponentVariableHandle<int> MaxEnergyOnInvalidId{171};
+constexpr ComponentVariableHandle<bool> StopTxOnEVSideDisconnect{172};
+constexpr ComponentVariableHandle<bool> StopTxOnInvalidId{173};
+constexpr ComponentVariableHandle<bool> TxBeforeAcceptedEnabled{174};
+constexpr ComponentVariableHandle<std::string> TxStartPoint{175};
+constexpr ComponentVariableHandle<std::string> TxStopPoint{176};
+} // namespace ControllerComponentVariableHandles
+
 namespace EvseComponentVariables {
 extern const Variable& Available;
 extern const Variable& AvailabilityState;
@@ -26,7 +26,7 @@ private:
     void init_enum_table_inner(const std::string& table_name, const int begin, const int end,
                                std::function<std::string(int)> conversion);
     template <typename T>
-    void init_enum_table(const std::string& table_name, T begin, T end, std::function<std::string(T)> conversion);
+    void init_enum_table(const std::string& table_name, T begin, T end, std::function<std::string_view(T)> conversion);
 
     // Availability management (internal helpers)
     // Setting evse_id to 0 addresses the whole CS, setting evse_id > 0 and connector_id=0 addresses a whole EVSE
@@ -36,7 +36,8 @@ private:
 
 public:
     DatabaseHandler(std::unique_ptr<common::DatabaseConnectionInterface> database,
-                    const fs::path& sql_migration_files_path);
+                    const fs::path& sql_migration_files_path,
+                    std::unique_ptr<common::DatabaseConnectionInterface> transaction_queue_database = nullptr);
 
     // Authorization cache management
 
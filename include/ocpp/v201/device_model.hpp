@@ -4,10 +4,17 @@
 #ifndef DEVICE_MODEL_HPP
 #define DEVICE_MODEL_HPP
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <variant>
 
 #include <everest/logging.hpp>
 
+#include <ocpp/v201/ctrlr_component_variables.hpp>
 #include <ocpp/v201/device_model_storage.hpp>
 
 namespace ocpp {
@@ -45,6 +52,39 @@ template <typename T> T to_specific_type(const std::string& value) {
     }
 }
 
+/// \brief In-memory representation of a volatile VariableAttribute. Volatile attributes are frequently updated
+/// read-only values that are served from memory and only written to the device model storage on flush
+struct VolatileAttributeValue {
+    VariableAttribute attribute; ///< attribute as present in the storage, with the latest value applied
+    bool dirty;                  ///< true if the value has not yet been written to the storage
+};
+
+using VariableAttributeKey = std::tuple<Component, Variable, AttributeEnum>;
+
+/// \brief Hashes a VariableAttributeKey from the hashes of its CiStrings, which ignore the case of the characters
+struct VariableAttributeKeyHash {
+    size_t operator()(const VariableAttributeKey& key) const noexcept;
+};
+
+/// \brief Result of requesting a VariableAttribute from the device model storage as it is cached for get_value and
+/// get_optional_value
+struct CachedAttributeValue {
+    GetVariableStatusEnum status; ///< status of the request to the device model storage
+    std::string value;            ///< value as present in the storage, only set if the status is Accepted
+    /// value converted to the type it has last been requested as, so it only has to be converted once
+    std::variant<std::monostate, int, double, size_t, DateTime, bool> converted;
+};
+
+/// \brief Is called after the Actual value of a variable that has monitors has been set
+/// \param component
+/// \param variable
+/// \param monitors the VariableMonitoring(s) of the variable
+/// \param previous_value value of the variable before it has been set, if it had one
+/// \param value the new value of the variable
+using MonitoredValueChangedCallback = std::function<void(
+    const Component& component, const Variable& variable, const std::vector<VariableMonitoring>& monitors,
+    const std::optional<std::string>& previous_value, const std::string& value)>;
+
 /// \brief This class manages access to the device model representation and to the device model storage and provides
 /// functionality to support the use cases defined in the functional block Provisioning
 class DeviceModel {
@@ -53,6 +93,47 @@ private:
     DeviceModelMap device_model;
     std::unique_ptr<DeviceModelStorage> storage;
 
+    /// \brief If true, values of volatile attributes are held in memory and only written to the storage on flush
+    std::atomic<bool> volatile_values_enabled;
+    std::map<VariableAttributeKey, VolatileAttributeValue> volatile_values;
+    std::mutex volatile_values_mutex;
+
+    /// \brief If true, values requested by get_value and get_optional_value are cached in memory until they are
+    /// changed using set_value
+    bool value_cache_enabled;
+    std::unordered_map<VariableAttributeKey, CachedAttributeValue, VariableAttributeKeyHash> value_cache;
+    /// \brief Cached Actual values of the variables of the ControllerComponentVariableHandles, indexed by handle
+    std::vector<std::optional<CachedAttributeValue>> handle_values;
+    std::mutex value_cache_mutex;
+
+    /// \brief Index of the ControllerComponentVariableHandle of the Actual attribute of a variable, used to invalidate
+    /// its cached value when it is set without the handle
+    std::unordered_map<VariableAttributeKey, size_t, VariableAttributeKeyHash> handle_indices;
+    /// \brief Meta data of the variables of the ControllerComponentVariableHandles, indexed by handle. nullptr if the
+    /// variable is not part of the device model
+    std::vector<const VariableMetaData*> handle_meta_data;
+
+    /// \brief Called after the Actual value of a variable with monitors has been set, so that the monitors only have
+    /// to be evaluated on writes to monitored variables
+    MonitoredValueChangedCallback monitored_value_changed_callback;
+
+    /// \brief Gets the in-memory VariableAttribute for the given parameters
+    /// \return VariableAttribute or std::nullopt if volatile values are disabled or no value has been set yet
+    std::optional<VariableAttribute> get_volatile_attribute(const Component& component_id, const Variable& variable_id,
+                                                            const AttributeEnum& attribute_enum);
+
+    /// \brief Sets the value of the given \p variable_attribute read from the device model storage to its in-memory
+    /// value if it is a volatile attribute that has been updated
+    void apply_volatile_value(const Component& component_id, const Variable& variable_id,
+                              VariableAttribute& variable_attribute);
+
+    /// \brief Reads the VariableAttribute(s) of all variables, or only of the given \p variables, from the device model
+    /// storage in one pass and calls \p on_variable for every variable of the device model that has attributes, with
+    /// the in-memory values of volatile attributes applied to them. The attributes may be moved from by \p on_variable
+    void for_each_stored_variable(const std::optional<std::vector<std::pair<Component, Variable>>>& variables,
+                                  const std::function<void(const Component&, const Variable&, const VariableMetaData&,
+                                                           std::vector<VariableAttribute>&)>& on_variable);
+
     /// \brief Private helper method that does some checks with the device model representation in memory to evaluate if
     /// a value for the given parameters can be requested. If it can be requested it will be retrieved from the device
     /// model storage and the given \p value will be set to the value that was retrieved
@@ -66,6 +147,118 @@ private:
                                                  const AttributeEnum& attribute_enum, std::string& value,
                                                  bool allow_write_only);
 
+    /// \brief Requests the value for the given parameters like request_value_internal (allowing WriteOnly values) and
+    /// converts it to \p T . If the value cache is enabled, the result is served from the cache if present and cached
+    /// otherwise
+    /// \return GetVariableStatusEnum that indicates the result of the request. \p value is only set if the status is
+    /// GetVariableStatusEnum::Accepted
+    template <typename T>
+    GetVariableStatusEnum request_cached_value(const Component& component_id, const Variable& variable_id,
+                                               const AttributeEnum& attribute_enum, std::optional<T>& value) {
+        std::unique_lock<std::mutex> lk(this->value_cache_mutex);
+        if (!this->value_cache_enabled) {
+            lk.unlock();
+            return this->request_uncached_value(component_id, variable_id, attribute_enum, value);
+        }
+
+        auto it = this->value_cache.find({component_id, variable_id, attribute_enum});
+        if (it == this->value_cache.end()) {
+            CachedAttributeValue cached;
+            cached.status = this->request_value_internal(component_id, variable_id, attribute_enum, cached.value, true);
+            it = this->value_cache.emplace(VariableAttributeKey{component_id, variable_id, attribute_enum},
+                                           std::move(cached))
+                     .first;
+        }
+        return this->get_cached_value(it->second, value);
+    }
+
+    /// \brief Requests the Actual value of the variable the ControllerComponentVariableHandle with the given \p index
+    /// refers to like request_cached_value, but caches it in the slot of the handle
+    template <typename T> GetVariableStatusEnum request_handle_value(const size_t index, std::optional<T>& value) {
+        const auto& component_variable = ControllerComponentVariableHandles::get_component_variable(index);
+        std::unique_lock<std::mutex> lk(this->value_cache_mutex);
+        if (!this->value_cache_enabled) {
+            lk.unlock();
+            return this->request_uncached_value(component_variable.component, component_variable.variable.value(),
+                                                AttributeEnum::Actual, value);
+        }
+
+        auto& cached = this->handle_values.at(index);
+        if (!cached.has_value()) {
+            cached.emplace();
+            cached->status = this->request_value_internal(component_variable.component,
+                                                          component_variable.variable.value(), AttributeEnum::Actual,
+                                                          cached->value, true);
+        }
+        return this->get_cached_value(cached.value(), value);
+    }
+
+    /// \brief Requests the value for the given parameters like request_value_internal (allowing WriteOnly values) and
+    /// converts it to \p T without using the value cache
+    template <typename T>
+    GetVariableStatusEnum request_uncached_value(const Component& component_id, const Variable& variable_id,
+                                                 const AttributeEnum& attribute_enum, std::optional<T>& value) {
+        std::string value_str;
+        const auto status = this->request_value_internal(component_id, variable_id, attribute_enum, value_str, true);
+        if (status == GetVariableStatusEnum::Accepted) {
+            value = to_specific_type<T>(value_str);
+        }
+        return status;
+    }
+
+    /// \brief Sets \p value to the \p cached value converted to \p T , converting it only if it has not yet been
+    /// requested as \p T
+    template <typename T>
+    GetVariableStatusEnum get_cached_value(CachedAttributeValue& cached, std::optional<T>& value) {
+        if (cached.status != GetVariableStatusEnum::Accepted) {
+            return cached.status;
+        }
+        if constexpr (std::is_same<T, std::string>::value) {
+            value = cached.value;
+        } else {
+            if (!std::holds_alternative<T>(cached.converted)) {
+                cached.converted = to_specific_type<T>(cached.value);
+            }
+            value = std::get<T>(cached.converted);
+        }
+        return GetVariableStatusEnum::Accepted;
+    }
+
+    /// \brief Removes the cached value for the given parameters, if any
+    void invalidate_cached_value(const Component& component_id, const Variable& variable_id,
+                                 const AttributeEnum& attribute_enum);
+
+    /// \brief Checks if the \p value may be set for the variable with the given \p meta_data like set_value does
+    /// \param is_volatile is set to true if the attribute is volatile and its value has to be held in memory
+    /// \param attribute is set to the VariableAttribute that is changed
+    /// \return Accepted if the value may be set, else the reason why it is not
+    SetVariableStatusEnum validate_set_value(const Component& component_id, const Variable& variable_id,
+                                             const VariableMetaData& meta_data, const AttributeEnum& attribute_enum,
+                                             const std::string& value, const bool allow_read_only, bool& is_volatile,
+                                             std::optional<VariableAttribute>& attribute);
+
+    /// \brief Writes all volatile values that have changed since the last flush to the device model storage. The
+    /// volatile_values_mutex has to be locked by the caller
+    void flush_volatile_values_locked();
+
+    /// \brief Holds the \p value of the volatile \p attribute in memory until it is flushed
+    /// \return false if volatile values have been disabled in the meantime and the value has to be written to the
+    /// storage
+    bool set_volatile_value(const Component& component_id, const Variable& variable_id,
+                            const AttributeEnum& attribute_enum, const VariableAttribute& attribute,
+                            const std::string& value);
+
+    /// \brief Calls the monitored value changed callback if the Actual \p value of a variable with monitors has been
+    /// set
+    void notify_monitored_value_changed(const Component& component_id, const Variable& variable_id,
+                                        const VariableMetaData& meta_data, const AttributeEnum& attribute_enum,
+                                        const VariableAttribute& previous_attribute, const std::string& value);
+
+    /// \brief Sets the \p value of the variable with the given \p meta_data like set_value
+    SetVariableStatusEnum set_value_internal(const Component& component_id, const Variable& variable_id,
+                                             const VariableMetaData& meta_data, const AttributeEnum& attribute_enum,
+                                             const std::string& value, const bool allow_read_only);
+
     /// \brief Iterates over the given \p component_criteria and converts this to the variable names
     /// (Active,Available,Enabled,Problem). If any of the variables can not be found as part of a component this
     /// function returns false. If any of those variable's value is true, this function returns true (except for
@@ -90,8 +283,12 @@ public:
     /// \param device_model_storage pointer to a device model storage class
     explicit DeviceModel(std::unique_ptr<DeviceModelStorage> device_model_storage);
 
+    /// \brief Writes all pending volatile values to the device model storage
+    ~DeviceModel();
+
     /// \brief Direct access to value of a VariableAttribute for the given component, variable and attribute_enum. This
-    /// should only be called for variables that have a role standardized in the OCPP2.0.1 specification.
+    /// should only be called for variables that have a role standardized in the OCPP2.0.1 specification. The value is
+    /// served from the value cache if it is enabled.
     /// \tparam T datatype of the value that is requested
     /// \param component_variable Combination of Component and Variable that identifies the Variable
     /// \param attribute_enum defaults to AttributeEnum::Actual
@@ -99,14 +296,14 @@ public:
     template <typename T>
     T get_value(const RequiredComponentVariable& component_variable,
                 const AttributeEnum& attribute_enum = AttributeEnum::Actual) {
-        std::string value;
+        std::optional<T> value;
         auto response = GetVariableStatusEnum::UnknownVariable;
         if (component_variable.variable.has_value()) {
-            response = this->request_value_internal(component_variable.component, component_variable.variable.value(),
-                                                    attribute_enum, value, true);
+            response = this->request_cached_value(component_variable.component, component_variable.variable.value(),
+                                                  attribute_enum, value);
         }
         if (response == GetVariableStatusEnum::Accepted) {
-            return to_specific_type<T>(value);
+            return value.value();
         } else {
             EVLOG_critical
                 << "Directly requested value for ComponentVariable that doesn't exist in the device model storage: "
@@ -117,6 +314,7 @@ public:
     }
 
     /// \brief  Access to std::optional of a VariableAttribute for the given component, variable and attribute_enum.
+    /// The value is served from the value cache if it is enabled.
     /// \tparam T Type of the value that is requested
     /// \param component_variable Combination of Component and Variable that identifies the Variable
     /// \param attribute_enum
@@ -125,19 +323,44 @@ public:
     template <typename T>
     std::optional<T> get_optional_value(const ComponentVariable& component_variable,
                                         const AttributeEnum& attribute_enum = AttributeEnum::Actual) {
-        std::string value;
-        auto response = GetVariableStatusEnum::UnknownVariable;
+        std::optional<T> value;
         if (component_variable.variable.has_value()) {
-            response = this->request_value_internal(component_variable.component, component_variable.variable.value(),
-                                                    attribute_enum, value, true);
+            this->request_cached_value(component_variable.component, component_variable.variable.value(),
+                                       attribute_enum, value);
         }
-        if (response == GetVariableStatusEnum::Accepted) {
-            return to_specific_type<T>(value);
+        return value;
+    }
+
+    /// \brief Direct access to the Actual value of the variable the given \p handle refers to. The value is served
+    /// from the value cache if it is enabled, without looking up the component and variable by name.
+    /// \tparam T datatype of the value of the variable
+    /// \param handle One of the ControllerComponentVariableHandles
+    /// \return the requested value from the device model storage
+    template <typename T> T get_value(const ComponentVariableHandle<T>& handle) {
+        std::optional<T> value;
+        if (this->request_handle_value(handle.index, value) == GetVariableStatusEnum::Accepted) {
+            return value.value();
         } else {
-            return std::nullopt;
+            const auto& component_variable = ControllerComponentVariableHandles::get_component_variable(handle.index);
+            EVLOG_critical
+                << "Directly requested value for ComponentVariable that doesn't exist in the device model storage: "
+                << component_variable;
+            EVLOG_AND_THROW(std::runtime_error(
+                "Directly requested value for ComponentVariable that doesn't exist in the device model storage."));
         }
     }
 
+    /// \brief Access to std::optional of the Actual value of the variable the given \p handle refers to. The value is
+    /// served from the value cache if it is enabled, without looking up the component and variable by name.
+    /// \tparam T datatype of the value of the variable
+    /// \param handle One of the ControllerComponentVariableHandles
+    /// \return std::optional<T> if a value is present for the variable, else std::nullopt
+    template <typename T> std::optional<T> get_optional_value(const ComponentVariableHandle<T>& handle) {
+        std::optional<T> value;
+        this->request_handle_value(handle.index, value);
+        return value;
+    }
+
     /// \brief Requests a value of a VariableAttribute specified by combination of \p component_id and \p variable_id
     /// from the device model storage
     /// \tparam T datatype of the value that is requested
@@ -171,6 +394,36 @@ public:
     SetVariableStatusEnum set_value(const Component& component_id, const Variable& variable_id,
                                     const AttributeEnum& attribute_enum, const std::string& value,
                                     const bool allow_read_only = false);
+    /// \brief Sets the Actual \p value of the variable the given \p handle refers to like set_value, without looking
+    /// up the component and variable by name
+    /// \param handle One of the ControllerComponentVariableHandles
+    /// \param value
+    /// \param allow_read_only If this is true, read-only variables can be changed,
+    ///                        otherwise only non read-only variables can be changed. Defaults to false
+    /// \return Result of the requested operation
+    template <typename T>
+    SetVariableStatusEnum set_value(const ComponentVariableHandle<T>& handle, const std::string& value,
+                                    const bool allow_read_only = false) {
+        const auto& component_variable = ControllerComponentVariableHandles::get_component_variable(handle.index);
+        const auto meta_data = this->handle_meta_data.at(handle.index);
+        if (meta_data == nullptr) {
+            return this->set_value(component_variable.component, component_variable.variable.value(),
+                                   AttributeEnum::Actual, value, allow_read_only);
+        }
+        return this->set_value_internal(component_variable.component, component_variable.variable.value(), *meta_data,
+                                        AttributeEnum::Actual, value, allow_read_only);
+    }
+
+    /// \brief Sets the values of all given \p set_variable_data like set_value. All values are validated first and the
+    /// accepted ones are then written to the device model storage at once, which is considerably faster than setting
+    /// them one by one.
+    /// \param set_variable_data
+    /// \param allow_read_only If this is true, read-only variables can be changed,
+    ///                        otherwise only non read-only variables can be changed. Defaults to false
+    /// \return the result for every element of \p set_variable_data in the same order
+    std::vector<SetVariableStatusEnum> set_values(const std::vector<SetVariableData>& set_variable_data,
+                                                  const bool allow_read_only = false);
+
     /// \brief Sets the variable_id attribute \p value specified by \p component_id , \p variable_id and \p
     /// attribute_enum for read only variables only. Only works on certain allowed components.
     /// \param component_id
@@ -181,6 +434,37 @@ public:
     SetVariableStatusEnum set_read_only_value(const Component& component_id, const Variable& variable_id,
                                               const AttributeEnum& attribute_enum, const std::string& value);
 
+    /// \brief Enables or disables holding volatile values in memory. Volatile values are frequently updated read-only
+    /// Actual values like the Power and AvailabilityState of EVSEs and Connectors. If enabled, these values are served
+    /// from memory and only written to the device model storage when flush_volatile_values is called. Disabling
+    /// flushes all pending values.
+    /// \param enabled
+    void set_volatile_values_enabled(const bool enabled);
+
+    /// \brief Writes all volatile values that have changed since the last flush to the device model storage
+    void flush_volatile_values();
+
+    /// \brief Enables or disables caching the values requested by get_value and get_optional_value in memory. The
+    /// cache is enabled by default and updated by set_value, so it has to be disabled if the device model storage is
+    /// modified by anything else than this DeviceModel. Disabling clears the cache.
+    /// \param enabled
+    void set_value_cache_enabled(const bool enabled);
+
+    /// \brief Removes all values from the value cache, so that they are requested from the device model storage again.
+    /// This can be used after the device model storage has been modified externally.
+    void clear_value_cache();
+
+    /// \brief Sets the \p callback that is called after the Actual value of a variable that has monitors has been set
+    /// using set_value, set_values or set_read_only_value
+    /// \param callback
+    void set_monitored_value_changed_callback(MonitoredValueChangedCallback callback);
+
+    /// \brief Calls \p on_monitor for every VariableMonitoring of the device model together with the component and
+    /// variable it monitors
+    /// \param on_monitor
+    void for_each_monitor(
+        const std::function<void(const Component&, const Variable&, const VariableMonitoring&)>& on_monitor) const;
+
     /// \brief Gets the VariableMetaData for the given \p component_id and \p variable_id
     /// \param component_id
     /// \param variable_id
@@ -205,6 +489,23 @@ public:
     get_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables = std::nullopt,
                            const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria = std::nullopt);
 
+    /// \brief Calls \p on_report_data for every ReportData of the report for the given \p report_base , so the report
+    /// can be processed while it is created instead of collecting it first like get_base_report_data
+    /// \param report_base
+    /// \param on_report_data
+    void for_each_base_report_data(const ReportBaseEnum& report_base,
+                                   const std::function<void(const ReportData&)>& on_report_data);
+
+    /// \brief Calls \p on_report_data for every ReportData of the report for the given filter \p component_variables
+    /// and \p component_criteria , so the report can be processed while it is created instead of collecting it first
+    /// like get_custom_report_data
+    /// \param component_variables
+    /// \param component_criteria
+    /// \param on_report_data
+    void for_each_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
+                                     const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria,
+                                     const std::function<void(const ReportData&)>& on_report_data);
+
     /// \brief Check data integrity of the device model provided by the device model data storage:
     /// For "required" variables, assert values exist. Checks might be extended in the future.
     void check_integrity(const std::map<int32_t, int32_t>& evse_connector_structure);
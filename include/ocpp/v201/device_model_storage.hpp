@@ -4,6 +4,7 @@
 #ifndef OCPP_V201_DEVICE_MODEL_STORAGE_HPP
 #define OCPP_V201_DEVICE_MODEL_STORAGE_HPP
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <ocpp/common/support_older_cpp_versions.hpp>
@@ -21,6 +22,14 @@ struct VariableMetaData {
     std::vector<VariableMonitoring> monitors;
 };
 
+/// \brief Helper struct that identifies a VariableAttribute and the value it is set to
+struct VariableAttributeValue {
+    Component component;
+    Variable variable;
+    AttributeEnum attribute_enum;
+    std::string value;
+};
+
 using VariableMap = std::map<Variable, VariableMetaData>;
 using DeviceModelMap = std::map<Component, VariableMap>;
 
@@ -72,6 +81,38 @@ public:
     get_variable_attributes(const Component& component_id, const Variable& variable_id,
                             const std::optional<AttributeEnum>& attribute_enum = std::nullopt) = 0;
 
+    /// \brief Calls \p on_attribute for every VariableAttribute in the storage together with the component and
+    /// variable it belongs to. This provides all VariableAttribute(s) at once, e.g. to create reports, so storages
+    /// should override it to read them in one pass. The VariableAttribute(s) of a variable have to be provided
+    /// consecutively. The default implementation calls get_variable_attributes for every variable of the device model.
+    /// \param on_attribute
+    virtual void for_each_variable_attribute(
+        const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) {
+        for (const auto& [component, variable_map] : this->get_device_model()) {
+            for (const auto& [variable, meta_data] : variable_map) {
+                for (const auto& attribute : this->get_variable_attributes(component, variable)) {
+                    on_attribute(component, variable, attribute);
+                }
+            }
+        }
+    }
+
+    /// \brief Calls \p on_attribute for every VariableAttribute of the given \p variables together with the component
+    /// and variable it belongs to. This provides the VariableAttribute(s) of many variables at once, e.g. for custom
+    /// reports, so storages should override it to read them with one query. The VariableAttribute(s) of a variable have
+    /// to be provided consecutively. The default implementation calls get_variable_attributes for every variable.
+    /// \param variables
+    /// \param on_attribute
+    virtual void for_each_variable_attribute(
+        const std::vector<std::pair<Component, Variable>>& variables,
+        const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) {
+        for (const auto& [component, variable] : variables) {
+            for (const auto& attribute : this->get_variable_attributes(component, variable)) {
+                on_attribute(component, variable, attribute);
+            }
+        }
+    }
+
     /// \brief Sets the value of an VariableAttribute if present
     /// \param component_id
     /// \param variable_id
@@ -81,6 +122,21 @@ public:
     virtual bool set_variable_attribute_value(const Component& component_id, const Variable& variable_id,
                                               const AttributeEnum& attribute_enum, const std::string& value) = 0;
 
+    /// \brief Sets the values of several VariableAttribute(s) if present. This is used to apply many changes at once,
+    /// e.g. of a SetVariables.req, so storages should override it to write all values in one transaction. The default
+    /// implementation calls set_variable_attribute_value for every value.
+    /// \param values
+    /// \return for every element of \p values true if the value could be set in the storage, else false
+    virtual std::vector<bool> set_variable_attribute_values(const std::vector<VariableAttributeValue>& values) {
+        std::vector<bool> results;
+        results.reserve(values.size());
+        for (const auto& value : values) {
+            results.push_back(this->set_variable_attribute_value(value.component, value.variable, value.attribute_enum,
+                                                                 value.value));
+        }
+        return results;
+    }
+
     /// \brief Check data integrity of the stored data:
     /// For "required" variables, assert values exist. Checks might be extended in the future.
     virtual void check_integrity() = 0;
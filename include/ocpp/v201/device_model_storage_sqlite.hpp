@@ -5,9 +5,10 @@
 #define DEVICE_MODEL_STORAGE_SQLITE_HPP
 
 #include <filesystem>
-#include <sqlite3.h>
+#include <mutex>
 
 #include <everest/logging.hpp>
+#include <ocpp/common/database/database_connection.hpp>
 #include <ocpp/v201/device_model_storage.hpp>
 
 namespace ocpp {
@@ -16,10 +17,21 @@ namespace v201 {
 class DeviceModelStorageSqlite : public DeviceModelStorage {
 
 private:
-    sqlite3* db;
+    /// \brief Connection to the device model database, which prepares each of the queries below once and reuses it
+    std::unique_ptr<common::DatabaseConnectionInterface> database;
+
+    /// \brief Serializes all writes, so that a write of one thread never ends up in the transaction of a batch that
+    /// another thread is writing
+    std::mutex write_mutex;
+
+    /// \brief IDs of the variables that have already been looked up, the IDs do not change while the database is open
+    std::map<std::pair<Component, Variable>, int> variable_ids;
+    std::mutex variable_ids_mutex;
 
     int get_component_id(const Component& component_id);
 
+    /// \brief Gets the ID of the given variable, which is only looked up in the database on its first use
+    /// \return the ID or -1 if the variable is not present in the database
     int get_variable_id(const Component& component_id, const Variable& variable_id);
 
 public:
@@ -35,9 +47,18 @@ public:
     std::vector<VariableAttribute> get_variable_attributes(const Component& component_id, const Variable& variable_id,
                                                            const std::optional<AttributeEnum>& attribute_enum) final;
 
+    void for_each_variable_attribute(
+        const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) final;
+
+    void for_each_variable_attribute(
+        const std::vector<std::pair<Component, Variable>>& variables,
+        const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) final;
+
     bool set_variable_attribute_value(const Component& component_id, const Variable& variable_id,
                                       const AttributeEnum& attribute_enum, const std::string& value) final;
 
+    std::vector<bool> set_variable_attribute_values(const std::vector<VariableAttributeValue>& values) final;
+
     void check_integrity() final;
 };
 
@@ -5,6 +5,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v201 {
@@ -23,8 +24,8 @@ enum class IdTokenEnum {
 
 namespace conversions {
 /// \brief Converts the given IdTokenEnum \p e to human readable string
-/// \returns a string representation of the IdTokenEnum
-std::string id_token_enum_to_string(IdTokenEnum e);
+/// \returns a string representation of the IdTokenEnum, which refers to a constant
+std::string_view id_token_enum_to_string(IdTokenEnum e);
 
 /// \brief Converts the given std::string \p s to IdTokenEnum
 /// \returns a IdTokenEnum from a string representation
@@ -44,8 +45,8 @@ enum class HashAlgorithmEnum {
 
 namespace conversions {
 /// \brief Converts the given HashAlgorithmEnum \p e to human readable string
-/// \returns a string representation of the HashAlgorithmEnum
-std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e);
+/// \returns a string representation of the HashAlgorithmEnum, which refers to a constant
+std::string_view hash_algorithm_enum_to_string(HashAlgorithmEnum e);
 
 /// \brief Converts the given std::string \p s to HashAlgorithmEnum
 /// \returns a HashAlgorithmEnum from a string representation
@@ -72,8 +73,8 @@ enum class AuthorizationStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given AuthorizationStatusEnum \p e to human readable string
-/// \returns a string representation of the AuthorizationStatusEnum
-std::string authorization_status_enum_to_string(AuthorizationStatusEnum e);
+/// \returns a string representation of the AuthorizationStatusEnum, which refers to a constant
+std::string_view authorization_status_enum_to_string(AuthorizationStatusEnum e);
 
 /// \brief Converts the given std::string \p s to AuthorizationStatusEnum
 /// \returns a AuthorizationStatusEnum from a string representation
@@ -94,8 +95,8 @@ enum class MessageFormatEnum {
 
 namespace conversions {
 /// \brief Converts the given MessageFormatEnum \p e to human readable string
-/// \returns a string representation of the MessageFormatEnum
-std::string message_format_enum_to_string(MessageFormatEnum e);
+/// \returns a string representation of the MessageFormatEnum, which refers to a constant
+std::string_view message_format_enum_to_string(MessageFormatEnum e);
 
 /// \brief Converts the given std::string \p s to MessageFormatEnum
 /// \returns a MessageFormatEnum from a string representation
@@ -119,8 +120,8 @@ enum class AuthorizeCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given AuthorizeCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the AuthorizeCertificateStatusEnum
-std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e);
+/// \returns a string representation of the AuthorizeCertificateStatusEnum, which refers to a constant
+std::string_view authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to AuthorizeCertificateStatusEnum
 /// \returns a AuthorizeCertificateStatusEnum from a string representation
@@ -147,8 +148,8 @@ enum class BootReasonEnum {
 
 namespace conversions {
 /// \brief Converts the given BootReasonEnum \p e to human readable string
-/// \returns a string representation of the BootReasonEnum
-std::string boot_reason_enum_to_string(BootReasonEnum e);
+/// \returns a string representation of the BootReasonEnum, which refers to a constant
+std::string_view boot_reason_enum_to_string(BootReasonEnum e);
 
 /// \brief Converts the given std::string \p s to BootReasonEnum
 /// \returns a BootReasonEnum from a string representation
@@ -168,8 +169,8 @@ enum class RegistrationStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given RegistrationStatusEnum \p e to human readable string
-/// \returns a string representation of the RegistrationStatusEnum
-std::string registration_status_enum_to_string(RegistrationStatusEnum e);
+/// \returns a string representation of the RegistrationStatusEnum, which refers to a constant
+std::string_view registration_status_enum_to_string(RegistrationStatusEnum e);
 
 /// \brief Converts the given std::string \p s to RegistrationStatusEnum
 /// \returns a RegistrationStatusEnum from a string representation
@@ -188,8 +189,8 @@ enum class CancelReservationStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given CancelReservationStatusEnum \p e to human readable string
-/// \returns a string representation of the CancelReservationStatusEnum
-std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e);
+/// \returns a string representation of the CancelReservationStatusEnum, which refers to a constant
+std::string_view cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e);
 
 /// \brief Converts the given std::string \p s to CancelReservationStatusEnum
 /// \returns a CancelReservationStatusEnum from a string representation
@@ -208,8 +209,8 @@ enum class CertificateSigningUseEnum {
 
 namespace conversions {
 /// \brief Converts the given CertificateSigningUseEnum \p e to human readable string
-/// \returns a string representation of the CertificateSigningUseEnum
-std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e);
+/// \returns a string representation of the CertificateSigningUseEnum, which refers to a constant
+std::string_view certificate_signing_use_enum_to_string(CertificateSigningUseEnum e);
 
 /// \brief Converts the given std::string \p s to CertificateSigningUseEnum
 /// \returns a CertificateSigningUseEnum from a string representation
@@ -228,8 +229,8 @@ enum class CertificateSignedStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given CertificateSignedStatusEnum \p e to human readable string
-/// \returns a string representation of the CertificateSignedStatusEnum
-std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e);
+/// \returns a string representation of the CertificateSignedStatusEnum, which refers to a constant
+std::string_view certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e);
 
 /// \brief Converts the given std::string \p s to CertificateSignedStatusEnum
 /// \returns a CertificateSignedStatusEnum from a string representation
@@ -248,8 +249,8 @@ enum class OperationalStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given OperationalStatusEnum \p e to human readable string
-/// \returns a string representation of the OperationalStatusEnum
-std::string operational_status_enum_to_string(OperationalStatusEnum e);
+/// \returns a string representation of the OperationalStatusEnum, which refers to a constant
+std::string_view operational_status_enum_to_string(OperationalStatusEnum e);
 
 /// \brief Converts the given std::string \p s to OperationalStatusEnum
 /// \returns a OperationalStatusEnum from a string representation
@@ -269,8 +270,8 @@ enum class ChangeAvailabilityStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ChangeAvailabilityStatusEnum \p e to human readable string
-/// \returns a string representation of the ChangeAvailabilityStatusEnum
-std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e);
+/// \returns a string representation of the ChangeAvailabilityStatusEnum, which refers to a constant
+std::string_view change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ChangeAvailabilityStatusEnum
 /// \returns a ChangeAvailabilityStatusEnum from a string representation
@@ -289,8 +290,8 @@ enum class ClearCacheStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ClearCacheStatusEnum \p e to human readable string
-/// \returns a string representation of the ClearCacheStatusEnum
-std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e);
+/// \returns a string representation of the ClearCacheStatusEnum, which refers to a constant
+std::string_view clear_cache_status_enum_to_string(ClearCacheStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ClearCacheStatusEnum
 /// \returns a ClearCacheStatusEnum from a string representation
@@ -311,8 +312,8 @@ enum class ChargingProfilePurposeEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfilePurposeEnum \p e to human readable string
-/// \returns a string representation of the ChargingProfilePurposeEnum
-std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e);
+/// \returns a string representation of the ChargingProfilePurposeEnum, which refers to a constant
+std::string_view charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingProfilePurposeEnum
 /// \returns a ChargingProfilePurposeEnum from a string representation
@@ -331,8 +332,8 @@ enum class ClearChargingProfileStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ClearChargingProfileStatusEnum \p e to human readable string
-/// \returns a string representation of the ClearChargingProfileStatusEnum
-std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e);
+/// \returns a string representation of the ClearChargingProfileStatusEnum, which refers to a constant
+std::string_view clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ClearChargingProfileStatusEnum
 /// \returns a ClearChargingProfileStatusEnum from a string representation
@@ -352,8 +353,8 @@ enum class ClearMessageStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ClearMessageStatusEnum \p e to human readable string
-/// \returns a string representation of the ClearMessageStatusEnum
-std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e);
+/// \returns a string representation of the ClearMessageStatusEnum, which refers to a constant
+std::string_view clear_message_status_enum_to_string(ClearMessageStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ClearMessageStatusEnum
 /// \returns a ClearMessageStatusEnum from a string representation
@@ -373,8 +374,8 @@ enum class ClearMonitoringStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ClearMonitoringStatusEnum \p e to human readable string
-/// \returns a string representation of the ClearMonitoringStatusEnum
-std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e);
+/// \returns a string representation of the ClearMonitoringStatusEnum, which refers to a constant
+std::string_view clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ClearMonitoringStatusEnum
 /// \returns a ClearMonitoringStatusEnum from a string representation
@@ -395,8 +396,8 @@ enum class ChargingLimitSourceEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingLimitSourceEnum \p e to human readable string
-/// \returns a string representation of the ChargingLimitSourceEnum
-std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e);
+/// \returns a string representation of the ChargingLimitSourceEnum, which refers to a constant
+std::string_view charging_limit_source_enum_to_string(ChargingLimitSourceEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingLimitSourceEnum
 /// \returns a ChargingLimitSourceEnum from a string representation
@@ -416,8 +417,8 @@ enum class CustomerInformationStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given CustomerInformationStatusEnum \p e to human readable string
-/// \returns a string representation of the CustomerInformationStatusEnum
-std::string customer_information_status_enum_to_string(CustomerInformationStatusEnum e);
+/// \returns a string representation of the CustomerInformationStatusEnum, which refers to a constant
+std::string_view customer_information_status_enum_to_string(CustomerInformationStatusEnum e);
 
 /// \brief Converts the given std::string \p s to CustomerInformationStatusEnum
 /// \returns a CustomerInformationStatusEnum from a string representation
@@ -439,8 +440,8 @@ enum class DataTransferStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given DataTransferStatusEnum \p e to human readable string
-/// \returns a string representation of the DataTransferStatusEnum
-std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e);
+/// \returns a string representation of the DataTransferStatusEnum, which refers to a constant
+std::string_view data_transfer_status_enum_to_string(DataTransferStatusEnum e);
 
 /// \brief Converts the given std::string \p s to DataTransferStatusEnum
 /// \returns a DataTransferStatusEnum from a string representation
@@ -460,8 +461,8 @@ enum class DeleteCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given DeleteCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the DeleteCertificateStatusEnum
-std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e);
+/// \returns a string representation of the DeleteCertificateStatusEnum, which refers to a constant
+std::string_view delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to DeleteCertificateStatusEnum
 /// \returns a DeleteCertificateStatusEnum from a string representation
@@ -492,8 +493,8 @@ enum class FirmwareStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given FirmwareStatusEnum \p e to human readable string
-/// \returns a string representation of the FirmwareStatusEnum
-std::string firmware_status_enum_to_string(FirmwareStatusEnum e);
+/// \returns a string representation of the FirmwareStatusEnum, which refers to a constant
+std::string_view firmware_status_enum_to_string(FirmwareStatusEnum e);
 
 /// \brief Converts the given std::string \p s to FirmwareStatusEnum
 /// \returns a FirmwareStatusEnum from a string representation
@@ -512,8 +513,8 @@ enum class CertificateActionEnum {
 
 namespace conversions {
 /// \brief Converts the given CertificateActionEnum \p e to human readable string
-/// \returns a string representation of the CertificateActionEnum
-std::string certificate_action_enum_to_string(CertificateActionEnum e);
+/// \returns a string representation of the CertificateActionEnum, which refers to a constant
+std::string_view certificate_action_enum_to_string(CertificateActionEnum e);
 
 /// \brief Converts the given std::string \p s to CertificateActionEnum
 /// \returns a CertificateActionEnum from a string representation
@@ -532,8 +533,8 @@ enum class Iso15118EVCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given Iso15118EVCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the Iso15118EVCertificateStatusEnum
-std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e);
+/// \returns a string representation of the Iso15118EVCertificateStatusEnum, which refers to a constant
+std::string_view iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to Iso15118EVCertificateStatusEnum
 /// \returns a Iso15118EVCertificateStatusEnum from a string representation
@@ -554,8 +555,8 @@ enum class ReportBaseEnum {
 
 namespace conversions {
 /// \brief Converts the given ReportBaseEnum \p e to human readable string
-/// \returns a string representation of the ReportBaseEnum
-std::string report_base_enum_to_string(ReportBaseEnum e);
+/// \returns a string representation of the ReportBaseEnum, which refers to a constant
+std::string_view report_base_enum_to_string(ReportBaseEnum e);
 
 /// \brief Converts the given std::string \p s to ReportBaseEnum
 /// \returns a ReportBaseEnum from a string representation
@@ -576,8 +577,8 @@ enum class GenericDeviceModelStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GenericDeviceModelStatusEnum \p e to human readable string
-/// \returns a string representation of the GenericDeviceModelStatusEnum
-std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e);
+/// \returns a string representation of the GenericDeviceModelStatusEnum, which refers to a constant
+std::string_view generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GenericDeviceModelStatusEnum
 /// \returns a GenericDeviceModelStatusEnum from a string representation
@@ -597,8 +598,8 @@ enum class GetCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GetCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the GetCertificateStatusEnum
-std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e);
+/// \returns a string representation of the GetCertificateStatusEnum, which refers to a constant
+std::string_view get_certificate_status_enum_to_string(GetCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GetCertificateStatusEnum
 /// \returns a GetCertificateStatusEnum from a string representation
@@ -617,8 +618,8 @@ enum class GetChargingProfileStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GetChargingProfileStatusEnum \p e to human readable string
-/// \returns a string representation of the GetChargingProfileStatusEnum
-std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e);
+/// \returns a string representation of the GetChargingProfileStatusEnum, which refers to a constant
+std::string_view get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GetChargingProfileStatusEnum
 /// \returns a GetChargingProfileStatusEnum from a string representation
@@ -638,8 +639,8 @@ enum class ChargingRateUnitEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingRateUnitEnum \p e to human readable string
-/// \returns a string representation of the ChargingRateUnitEnum
-std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e);
+/// \returns a string representation of the ChargingRateUnitEnum, which refers to a constant
+std::string_view charging_rate_unit_enum_to_string(ChargingRateUnitEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingRateUnitEnum
 /// \returns a ChargingRateUnitEnum from a string representation
@@ -658,8 +659,8 @@ enum class GenericStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GenericStatusEnum \p e to human readable string
-/// \returns a string representation of the GenericStatusEnum
-std::string generic_status_enum_to_string(GenericStatusEnum e);
+/// \returns a string representation of the GenericStatusEnum, which refers to a constant
+std::string_view generic_status_enum_to_string(GenericStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GenericStatusEnum
 /// \returns a GenericStatusEnum from a string representation
@@ -679,8 +680,8 @@ enum class MessagePriorityEnum {
 
 namespace conversions {
 /// \brief Converts the given MessagePriorityEnum \p e to human readable string
-/// \returns a string representation of the MessagePriorityEnum
-std::string message_priority_enum_to_string(MessagePriorityEnum e);
+/// \returns a string representation of the MessagePriorityEnum, which refers to a constant
+std::string_view message_priority_enum_to_string(MessagePriorityEnum e);
 
 /// \brief Converts the given std::string \p s to MessagePriorityEnum
 /// \returns a MessagePriorityEnum from a string representation
@@ -701,8 +702,8 @@ enum class MessageStateEnum {
 
 namespace conversions {
 /// \brief Converts the given MessageStateEnum \p e to human readable string
-/// \returns a string representation of the MessageStateEnum
-std::string message_state_enum_to_string(MessageStateEnum e);
+/// \returns a string representation of the MessageStateEnum, which refers to a constant
+std::string_view message_state_enum_to_string(MessageStateEnum e);
 
 /// \brief Converts the given std::string \p s to MessageStateEnum
 /// \returns a MessageStateEnum from a string representation
@@ -721,8 +722,8 @@ enum class GetDisplayMessagesStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GetDisplayMessagesStatusEnum \p e to human readable string
-/// \returns a string representation of the GetDisplayMessagesStatusEnum
-std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e);
+/// \returns a string representation of the GetDisplayMessagesStatusEnum, which refers to a constant
+std::string_view get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GetDisplayMessagesStatusEnum
 /// \returns a GetDisplayMessagesStatusEnum from a string representation
@@ -745,8 +746,8 @@ enum class GetCertificateIdUseEnum {
 
 namespace conversions {
 /// \brief Converts the given GetCertificateIdUseEnum \p e to human readable string
-/// \returns a string representation of the GetCertificateIdUseEnum
-std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e);
+/// \returns a string representation of the GetCertificateIdUseEnum, which refers to a constant
+std::string_view get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e);
 
 /// \brief Converts the given std::string \p s to GetCertificateIdUseEnum
 /// \returns a GetCertificateIdUseEnum from a string representation
@@ -765,8 +766,8 @@ enum class GetInstalledCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GetInstalledCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the GetInstalledCertificateStatusEnum
-std::string get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e);
+/// \returns a string representation of the GetInstalledCertificateStatusEnum, which refers to a constant
+std::string_view get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GetInstalledCertificateStatusEnum
 /// \returns a GetInstalledCertificateStatusEnum from a string representation
@@ -787,8 +788,8 @@ enum class LogEnum {
 
 namespace conversions {
 /// \brief Converts the given LogEnum \p e to human readable string
-/// \returns a string representation of the LogEnum
-std::string log_enum_to_string(LogEnum e);
+/// \returns a string representation of the LogEnum, which refers to a constant
+std::string_view log_enum_to_string(LogEnum e);
 
 /// \brief Converts the given std::string \p s to LogEnum
 /// \returns a LogEnum from a string representation
@@ -808,8 +809,8 @@ enum class LogStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given LogStatusEnum \p e to human readable string
-/// \returns a string representation of the LogStatusEnum
-std::string log_status_enum_to_string(LogStatusEnum e);
+/// \returns a string representation of the LogStatusEnum, which refers to a constant
+std::string_view log_status_enum_to_string(LogStatusEnum e);
 
 /// \brief Converts the given std::string \p s to LogStatusEnum
 /// \returns a LogStatusEnum from a string representation
@@ -829,8 +830,8 @@ enum class MonitoringCriterionEnum {
 
 namespace conversions {
 /// \brief Converts the given MonitoringCriterionEnum \p e to human readable string
-/// \returns a string representation of the MonitoringCriterionEnum
-std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e);
+/// \returns a string representation of the MonitoringCriterionEnum, which refers to a constant
+std::string_view monitoring_criterion_enum_to_string(MonitoringCriterionEnum e);
 
 /// \brief Converts the given std::string \p s to MonitoringCriterionEnum
 /// \returns a MonitoringCriterionEnum from a string representation
@@ -851,8 +852,8 @@ enum class ComponentCriterionEnum {
 
 namespace conversions {
 /// \brief Converts the given ComponentCriterionEnum \p e to human readable string
-/// \returns a string representation of the ComponentCriterionEnum
-std::string component_criterion_enum_to_string(ComponentCriterionEnum e);
+/// \returns a string representation of the ComponentCriterionEnum, which refers to a constant
+std::string_view component_criterion_enum_to_string(ComponentCriterionEnum e);
 
 /// \brief Converts the given std::string \p s to ComponentCriterionEnum
 /// \returns a ComponentCriterionEnum from a string representation
@@ -873,8 +874,8 @@ enum class AttributeEnum {
 
 namespace conversions {
 /// \brief Converts the given AttributeEnum \p e to human readable string
-/// \returns a string representation of the AttributeEnum
-std::string attribute_enum_to_string(AttributeEnum e);
+/// \returns a string representation of the AttributeEnum, which refers to a constant
+std::string_view attribute_enum_to_string(AttributeEnum e);
 
 /// \brief Converts the given std::string \p s to AttributeEnum
 /// \returns a AttributeEnum from a string representation
@@ -896,8 +897,8 @@ enum class GetVariableStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given GetVariableStatusEnum \p e to human readable string
-/// \returns a string representation of the GetVariableStatusEnum
-std::string get_variable_status_enum_to_string(GetVariableStatusEnum e);
+/// \returns a string representation of the GetVariableStatusEnum, which refers to a constant
+std::string_view get_variable_status_enum_to_string(GetVariableStatusEnum e);
 
 /// \brief Converts the given std::string \p s to GetVariableStatusEnum
 /// \returns a GetVariableStatusEnum from a string representation
@@ -918,8 +919,8 @@ enum class InstallCertificateUseEnum {
 
 namespace conversions {
 /// \brief Converts the given InstallCertificateUseEnum \p e to human readable string
-/// \returns a string representation of the InstallCertificateUseEnum
-std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e);
+/// \returns a string representation of the InstallCertificateUseEnum, which refers to a constant
+std::string_view install_certificate_use_enum_to_string(InstallCertificateUseEnum e);
 
 /// \brief Converts the given std::string \p s to InstallCertificateUseEnum
 /// \returns a InstallCertificateUseEnum from a string representation
@@ -939,8 +940,8 @@ enum class InstallCertificateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given InstallCertificateStatusEnum \p e to human readable string
-/// \returns a string representation of the InstallCertificateStatusEnum
-std::string install_certificate_status_enum_to_string(InstallCertificateStatusEnum e);
+/// \returns a string representation of the InstallCertificateStatusEnum, which refers to a constant
+std::string_view install_certificate_status_enum_to_string(InstallCertificateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to InstallCertificateStatusEnum
 /// \returns a InstallCertificateStatusEnum from a string representation
@@ -965,8 +966,8 @@ enum class UploadLogStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given UploadLogStatusEnum \p e to human readable string
-/// \returns a string representation of the UploadLogStatusEnum
-std::string upload_log_status_enum_to_string(UploadLogStatusEnum e);
+/// \returns a string representation of the UploadLogStatusEnum, which refers to a constant
+std::string_view upload_log_status_enum_to_string(UploadLogStatusEnum e);
 
 /// \brief Converts the given std::string \p s to UploadLogStatusEnum
 /// \returns a UploadLogStatusEnum from a string representation
@@ -991,8 +992,8 @@ enum class ReadingContextEnum {
 
 namespace conversions {
 /// \brief Converts the given ReadingContextEnum \p e to human readable string
-/// \returns a string representation of the ReadingContextEnum
-std::string reading_context_enum_to_string(ReadingContextEnum e);
+/// \returns a string representation of the ReadingContextEnum, which refers to a constant
+std::string_view reading_context_enum_to_string(ReadingContextEnum e);
 
 /// \brief Converts the given std::string \p s to ReadingContextEnum
 /// \returns a ReadingContextEnum from a string representation
@@ -1034,8 +1035,8 @@ enum class MeasurandEnum {
 
 namespace conversions {
 /// \brief Converts the given MeasurandEnum \p e to human readable string
-/// \returns a string representation of the MeasurandEnum
-std::string measurand_enum_to_string(MeasurandEnum e);
+/// \returns a string representation of the MeasurandEnum, which refers to a constant
+std::string_view measurand_enum_to_string(MeasurandEnum e);
 
 /// \brief Converts the given std::string \p s to MeasurandEnum
 /// \returns a MeasurandEnum from a string representation
@@ -1062,8 +1063,8 @@ enum class PhaseEnum {
 
 namespace conversions {
 /// \brief Converts the given PhaseEnum \p e to human readable string
-/// \returns a string representation of the PhaseEnum
-std::string phase_enum_to_string(PhaseEnum e);
+/// \returns a string representation of the PhaseEnum, which refers to a constant
+std::string_view phase_enum_to_string(PhaseEnum e);
 
 /// \brief Converts the given std::string \p s to PhaseEnum
 /// \returns a PhaseEnum from a string representation
@@ -1085,8 +1086,8 @@ enum class LocationEnum {
 
 namespace conversions {
 /// \brief Converts the given LocationEnum \p e to human readable string
-/// \returns a string representation of the LocationEnum
-std::string location_enum_to_string(LocationEnum e);
+/// \returns a string representation of the LocationEnum, which refers to a constant
+std::string_view location_enum_to_string(LocationEnum e);
 
 /// \brief Converts the given std::string \p s to LocationEnum
 /// \returns a LocationEnum from a string representation
@@ -1106,8 +1107,8 @@ enum class CostKindEnum {
 
 namespace conversions {
 /// \brief Converts the given CostKindEnum \p e to human readable string
-/// \returns a string representation of the CostKindEnum
-std::string cost_kind_enum_to_string(CostKindEnum e);
+/// \returns a string representation of the CostKindEnum, which refers to a constant
+std::string_view cost_kind_enum_to_string(CostKindEnum e);
 
 /// \brief Converts the given std::string \p s to CostKindEnum
 /// \returns a CostKindEnum from a string representation
@@ -1128,8 +1129,8 @@ enum class EnergyTransferModeEnum {
 
 namespace conversions {
 /// \brief Converts the given EnergyTransferModeEnum \p e to human readable string
-/// \returns a string representation of the EnergyTransferModeEnum
-std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e);
+/// \returns a string representation of the EnergyTransferModeEnum, which refers to a constant
+std::string_view energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e);
 
 /// \brief Converts the given std::string \p s to EnergyTransferModeEnum
 /// \returns a EnergyTransferModeEnum from a string representation
@@ -1149,8 +1150,8 @@ enum class NotifyEVChargingNeedsStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given NotifyEVChargingNeedsStatusEnum \p e to human readable string
-/// \returns a string representation of the NotifyEVChargingNeedsStatusEnum
-std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e);
+/// \returns a string representation of the NotifyEVChargingNeedsStatusEnum, which refers to a constant
+std::string_view notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e);
 
 /// \brief Converts the given std::string \p s to NotifyEVChargingNeedsStatusEnum
 /// \returns a NotifyEVChargingNeedsStatusEnum from a string representation
@@ -1171,8 +1172,8 @@ enum class EventTriggerEnum {
 
 namespace conversions {
 /// \brief Converts the given EventTriggerEnum \p e to human readable string
-/// \returns a string representation of the EventTriggerEnum
-std::string event_trigger_enum_to_string(EventTriggerEnum e);
+/// \returns a string representation of the EventTriggerEnum, which refers to a constant
+std::string_view event_trigger_enum_to_string(EventTriggerEnum e);
 
 /// \brief Converts the given std::string \p s to EventTriggerEnum
 /// \returns a EventTriggerEnum from a string representation
@@ -1193,8 +1194,8 @@ enum class EventNotificationEnum {
 
 namespace conversions {
 /// \brief Converts the given EventNotificationEnum \p e to human readable string
-/// \returns a string representation of the EventNotificationEnum
-std::string event_notification_enum_to_string(EventNotificationEnum e);
+/// \returns a string representation of the EventNotificationEnum, which refers to a constant
+std::string_view event_notification_enum_to_string(EventNotificationEnum e);
 
 /// \brief Converts the given std::string \p s to EventNotificationEnum
 /// \returns a EventNotificationEnum from a string representation
@@ -1216,8 +1217,8 @@ enum class MonitorEnum {
 
 namespace conversions {
 /// \brief Converts the given MonitorEnum \p e to human readable string
-/// \returns a string representation of the MonitorEnum
-std::string monitor_enum_to_string(MonitorEnum e);
+/// \returns a string representation of the MonitorEnum, which refers to a constant
+std::string_view monitor_enum_to_string(MonitorEnum e);
 
 /// \brief Converts the given std::string \p s to MonitorEnum
 /// \returns a MonitorEnum from a string representation
@@ -1237,8 +1238,8 @@ enum class MutabilityEnum {
 
 namespace conversions {
 /// \brief Converts the given MutabilityEnum \p e to human readable string
-/// \returns a string representation of the MutabilityEnum
-std::string mutability_enum_to_string(MutabilityEnum e);
+/// \returns a string representation of the MutabilityEnum, which refers to a constant
+std::string_view mutability_enum_to_string(MutabilityEnum e);
 
 /// \brief Converts the given std::string \p s to MutabilityEnum
 /// \returns a MutabilityEnum from a string representation
@@ -1263,8 +1264,8 @@ enum class DataEnum {
 
 namespace conversions {
 /// \brief Converts the given DataEnum \p e to human readable string
-/// \returns a string representation of the DataEnum
-std::string data_enum_to_string(DataEnum e);
+/// \returns a string representation of the DataEnum, which refers to a constant
+std::string_view data_enum_to_string(DataEnum e);
 
 /// \brief Converts the given std::string \p s to DataEnum
 /// \returns a DataEnum from a string representation
@@ -1291,8 +1292,8 @@ enum class PublishFirmwareStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given PublishFirmwareStatusEnum \p e to human readable string
-/// \returns a string representation of the PublishFirmwareStatusEnum
-std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e);
+/// \returns a string representation of the PublishFirmwareStatusEnum, which refers to a constant
+std::string_view publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e);
 
 /// \brief Converts the given std::string \p s to PublishFirmwareStatusEnum
 /// \returns a PublishFirmwareStatusEnum from a string representation
@@ -1312,8 +1313,8 @@ enum class ChargingProfileKindEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfileKindEnum \p e to human readable string
-/// \returns a string representation of the ChargingProfileKindEnum
-std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e);
+/// \returns a string representation of the ChargingProfileKindEnum, which refers to a constant
+std::string_view charging_profile_kind_enum_to_string(ChargingProfileKindEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingProfileKindEnum
 /// \returns a ChargingProfileKindEnum from a string representation
@@ -1332,8 +1333,8 @@ enum class RecurrencyKindEnum {
 
 namespace conversions {
 /// \brief Converts the given RecurrencyKindEnum \p e to human readable string
-/// \returns a string representation of the RecurrencyKindEnum
-std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e);
+/// \returns a string representation of the RecurrencyKindEnum, which refers to a constant
+std::string_view recurrency_kind_enum_to_string(RecurrencyKindEnum e);
 
 /// \brief Converts the given std::string \p s to RecurrencyKindEnum
 /// \returns a RecurrencyKindEnum from a string representation
@@ -1352,8 +1353,8 @@ enum class RequestStartStopStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given RequestStartStopStatusEnum \p e to human readable string
-/// \returns a string representation of the RequestStartStopStatusEnum
-std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e);
+/// \returns a string representation of the RequestStartStopStatusEnum, which refers to a constant
+std::string_view request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e);
 
 /// \brief Converts the given std::string \p s to RequestStartStopStatusEnum
 /// \returns a RequestStartStopStatusEnum from a string representation
@@ -1372,8 +1373,8 @@ enum class ReservationUpdateStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ReservationUpdateStatusEnum \p e to human readable string
-/// \returns a string representation of the ReservationUpdateStatusEnum
-std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e);
+/// \returns a string representation of the ReservationUpdateStatusEnum, which refers to a constant
+std::string_view reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ReservationUpdateStatusEnum
 /// \returns a ReservationUpdateStatusEnum from a string representation
@@ -1412,8 +1413,8 @@ enum class ConnectorEnum {
 
 namespace conversions {
 /// \brief Converts the given ConnectorEnum \p e to human readable string
-/// \returns a string representation of the ConnectorEnum
-std::string connector_enum_to_string(ConnectorEnum e);
+/// \returns a string representation of the ConnectorEnum, which refers to a constant
+std::string_view connector_enum_to_string(ConnectorEnum e);
 
 /// \brief Converts the given std::string \p s to ConnectorEnum
 /// \returns a ConnectorEnum from a string representation
@@ -1435,8 +1436,8 @@ enum class ReserveNowStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ReserveNowStatusEnum \p e to human readable string
-/// \returns a string representation of the ReserveNowStatusEnum
-std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e);
+/// \returns a string representation of the ReserveNowStatusEnum, which refers to a constant
+std::string_view reserve_now_status_enum_to_string(ReserveNowStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ReserveNowStatusEnum
 /// \returns a ReserveNowStatusEnum from a string representation
@@ -1455,8 +1456,8 @@ enum class ResetEnum {
 
 namespace conversions {
 /// \brief Converts the given ResetEnum \p e to human readable string
-/// \returns a string representation of the ResetEnum
-std::string reset_enum_to_string(ResetEnum e);
+/// \returns a string representation of the ResetEnum, which refers to a constant
+std::string_view reset_enum_to_string(ResetEnum e);
 
 /// \brief Converts the given std::string \p s to ResetEnum
 /// \returns a ResetEnum from a string representation
@@ -1476,8 +1477,8 @@ enum class ResetStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ResetStatusEnum \p e to human readable string
-/// \returns a string representation of the ResetStatusEnum
-std::string reset_status_enum_to_string(ResetStatusEnum e);
+/// \returns a string representation of the ResetStatusEnum, which refers to a constant
+std::string_view reset_status_enum_to_string(ResetStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ResetStatusEnum
 /// \returns a ResetStatusEnum from a string representation
@@ -1496,8 +1497,8 @@ enum class UpdateEnum {
 
 namespace conversions {
 /// \brief Converts the given UpdateEnum \p e to human readable string
-/// \returns a string representation of the UpdateEnum
-std::string update_enum_to_string(UpdateEnum e);
+/// \returns a string representation of the UpdateEnum, which refers to a constant
+std::string_view update_enum_to_string(UpdateEnum e);
 
 /// \brief Converts the given std::string \p s to UpdateEnum
 /// \returns a UpdateEnum from a string representation
@@ -1517,8 +1518,8 @@ enum class SendLocalListStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given SendLocalListStatusEnum \p e to human readable string
-/// \returns a string representation of the SendLocalListStatusEnum
-std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e);
+/// \returns a string representation of the SendLocalListStatusEnum, which refers to a constant
+std::string_view send_local_list_status_enum_to_string(SendLocalListStatusEnum e);
 
 /// \brief Converts the given std::string \p s to SendLocalListStatusEnum
 /// \returns a SendLocalListStatusEnum from a string representation
@@ -1537,8 +1538,8 @@ enum class ChargingProfileStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingProfileStatusEnum \p e to human readable string
-/// \returns a string representation of the ChargingProfileStatusEnum
-std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e);
+/// \returns a string representation of the ChargingProfileStatusEnum, which refers to a constant
+std::string_view charging_profile_status_enum_to_string(ChargingProfileStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingProfileStatusEnum
 /// \returns a ChargingProfileStatusEnum from a string representation
@@ -1561,8 +1562,8 @@ enum class DisplayMessageStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given DisplayMessageStatusEnum \p e to human readable string
-/// \returns a string representation of the DisplayMessageStatusEnum
-std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e);
+/// \returns a string representation of the DisplayMessageStatusEnum, which refers to a constant
+std::string_view display_message_status_enum_to_string(DisplayMessageStatusEnum e);
 
 /// \brief Converts the given std::string \p s to DisplayMessageStatusEnum
 /// \returns a DisplayMessageStatusEnum from a string representation
@@ -1582,8 +1583,8 @@ enum class MonitoringBaseEnum {
 
 namespace conversions {
 /// \brief Converts the given MonitoringBaseEnum \p e to human readable string
-/// \returns a string representation of the MonitoringBaseEnum
-std::string monitoring_base_enum_to_string(MonitoringBaseEnum e);
+/// \returns a string representation of the MonitoringBaseEnum, which refers to a constant
+std::string_view monitoring_base_enum_to_string(MonitoringBaseEnum e);
 
 /// \brief Converts the given std::string \p s to MonitoringBaseEnum
 /// \returns a MonitoringBaseEnum from a string representation
@@ -1604,8 +1605,8 @@ enum class APNAuthenticationEnum {
 
 namespace conversions {
 /// \brief Converts the given APNAuthenticationEnum \p e to human readable string
-/// \returns a string representation of the APNAuthenticationEnum
-std::string apnauthentication_enum_to_string(APNAuthenticationEnum e);
+/// \returns a string representation of the APNAuthenticationEnum, which refers to a constant
+std::string_view apnauthentication_enum_to_string(APNAuthenticationEnum e);
 
 /// \brief Converts the given std::string \p s to APNAuthenticationEnum
 /// \returns a APNAuthenticationEnum from a string representation
@@ -1626,8 +1627,8 @@ enum class OCPPVersionEnum {
 
 namespace conversions {
 /// \brief Converts the given OCPPVersionEnum \p e to human readable string
-/// \returns a string representation of the OCPPVersionEnum
-std::string ocppversion_enum_to_string(OCPPVersionEnum e);
+/// \returns a string representation of the OCPPVersionEnum, which refers to a constant
+std::string_view ocppversion_enum_to_string(OCPPVersionEnum e);
 
 /// \brief Converts the given std::string \p s to OCPPVersionEnum
 /// \returns a OCPPVersionEnum from a string representation
@@ -1646,8 +1647,8 @@ enum class OCPPTransportEnum {
 
 namespace conversions {
 /// \brief Converts the given OCPPTransportEnum \p e to human readable string
-/// \returns a string representation of the OCPPTransportEnum
-std::string ocpptransport_enum_to_string(OCPPTransportEnum e);
+/// \returns a string representation of the OCPPTransportEnum, which refers to a constant
+std::string_view ocpptransport_enum_to_string(OCPPTransportEnum e);
 
 /// \brief Converts the given std::string \p s to OCPPTransportEnum
 /// \returns a OCPPTransportEnum from a string representation
@@ -1672,8 +1673,8 @@ enum class OCPPInterfaceEnum {
 
 namespace conversions {
 /// \brief Converts the given OCPPInterfaceEnum \p e to human readable string
-/// \returns a string representation of the OCPPInterfaceEnum
-std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e);
+/// \returns a string representation of the OCPPInterfaceEnum, which refers to a constant
+std::string_view ocppinterface_enum_to_string(OCPPInterfaceEnum e);
 
 /// \brief Converts the given std::string \p s to OCPPInterfaceEnum
 /// \returns a OCPPInterfaceEnum from a string representation
@@ -1694,8 +1695,8 @@ enum class VPNEnum {
 
 namespace conversions {
 /// \brief Converts the given VPNEnum \p e to human readable string
-/// \returns a string representation of the VPNEnum
-std::string vpnenum_to_string(VPNEnum e);
+/// \returns a string representation of the VPNEnum, which refers to a constant
+std::string_view vpnenum_to_string(VPNEnum e);
 
 /// \brief Converts the given std::string \p s to VPNEnum
 /// \returns a VPNEnum from a string representation
@@ -1715,8 +1716,8 @@ enum class SetNetworkProfileStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given SetNetworkProfileStatusEnum \p e to human readable string
-/// \returns a string representation of the SetNetworkProfileStatusEnum
-std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e);
+/// \returns a string representation of the SetNetworkProfileStatusEnum, which refers to a constant
+std::string_view set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e);
 
 /// \brief Converts the given std::string \p s to SetNetworkProfileStatusEnum
 /// \returns a SetNetworkProfileStatusEnum from a string representation
@@ -1739,8 +1740,8 @@ enum class SetMonitoringStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given SetMonitoringStatusEnum \p e to human readable string
-/// \returns a string representation of the SetMonitoringStatusEnum
-std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e);
+/// \returns a string representation of the SetMonitoringStatusEnum, which refers to a constant
+std::string_view set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e);
 
 /// \brief Converts the given std::string \p s to SetMonitoringStatusEnum
 /// \returns a SetMonitoringStatusEnum from a string representation
@@ -1763,8 +1764,8 @@ enum class SetVariableStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given SetVariableStatusEnum \p e to human readable string
-/// \returns a string representation of the SetVariableStatusEnum
-std::string set_variable_status_enum_to_string(SetVariableStatusEnum e);
+/// \returns a string representation of the SetVariableStatusEnum, which refers to a constant
+std::string_view set_variable_status_enum_to_string(SetVariableStatusEnum e);
 
 /// \brief Converts the given std::string \p s to SetVariableStatusEnum
 /// \returns a SetVariableStatusEnum from a string representation
@@ -1786,8 +1787,8 @@ enum class ConnectorStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given ConnectorStatusEnum \p e to human readable string
-/// \returns a string representation of the ConnectorStatusEnum
-std::string connector_status_enum_to_string(ConnectorStatusEnum e);
+/// \returns a string representation of the ConnectorStatusEnum, which refers to a constant
+std::string_view connector_status_enum_to_string(ConnectorStatusEnum e);
 
 /// \brief Converts the given std::string \p s to ConnectorStatusEnum
 /// \returns a ConnectorStatusEnum from a string representation
@@ -1807,8 +1808,8 @@ enum class TransactionEventEnum {
 
 namespace conversions {
 /// \brief Converts the given TransactionEventEnum \p e to human readable string
-/// \returns a string representation of the TransactionEventEnum
-std::string transaction_event_enum_to_string(TransactionEventEnum e);
+/// \returns a string representation of the TransactionEventEnum, which refers to a constant
+std::string_view transaction_event_enum_to_string(TransactionEventEnum e);
 
 /// \brief Converts the given std::string \p s to TransactionEventEnum
 /// \returns a TransactionEventEnum from a string representation
@@ -1846,8 +1847,8 @@ enum class TriggerReasonEnum {
 
 namespace conversions {
 /// \brief Converts the given TriggerReasonEnum \p e to human readable string
-/// \returns a string representation of the TriggerReasonEnum
-std::string trigger_reason_enum_to_string(TriggerReasonEnum e);
+/// \returns a string representation of the TriggerReasonEnum, which refers to a constant
+std::string_view trigger_reason_enum_to_string(TriggerReasonEnum e);
 
 /// \brief Converts the given std::string \p s to TriggerReasonEnum
 /// \returns a TriggerReasonEnum from a string representation
@@ -1869,8 +1870,8 @@ enum class ChargingStateEnum {
 
 namespace conversions {
 /// \brief Converts the given ChargingStateEnum \p e to human readable string
-/// \returns a string representation of the ChargingStateEnum
-std::string charging_state_enum_to_string(ChargingStateEnum e);
+/// \returns a string representation of the ChargingStateEnum, which refers to a constant
+std::string_view charging_state_enum_to_string(ChargingStateEnum e);
 
 /// \brief Converts the given std::string \p s to ChargingStateEnum
 /// \returns a ChargingStateEnum from a string representation
@@ -1906,8 +1907,8 @@ enum class ReasonEnum {
 
 namespace conversions {
 /// \brief Converts the given ReasonEnum \p e to human readable string
-/// \returns a string representation of the ReasonEnum
-std::string reason_enum_to_string(ReasonEnum e);
+/// \returns a string representation of the ReasonEnum, which refers to a constant
+std::string_view reason_enum_to_string(ReasonEnum e);
 
 /// \brief Converts the given std::string \p s to ReasonEnum
 /// \returns a ReasonEnum from a string representation
@@ -1935,8 +1936,8 @@ enum class MessageTriggerEnum {
 
 namespace conversions {
 /// \brief Converts the given MessageTriggerEnum \p e to human readable string
-/// \returns a string representation of the MessageTriggerEnum
-std::string message_trigger_enum_to_string(MessageTriggerEnum e);
+/// \returns a string representation of the MessageTriggerEnum, which refers to a constant
+std::string_view message_trigger_enum_to_string(MessageTriggerEnum e);
 
 /// \brief Converts the given std::string \p s to MessageTriggerEnum
 /// \returns a MessageTriggerEnum from a string representation
@@ -1956,8 +1957,8 @@ enum class TriggerMessageStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given TriggerMessageStatusEnum \p e to human readable string
-/// \returns a string representation of the TriggerMessageStatusEnum
-std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e);
+/// \returns a string representation of the TriggerMessageStatusEnum, which refers to a constant
+std::string_view trigger_message_status_enum_to_string(TriggerMessageStatusEnum e);
 
 /// \brief Converts the given std::string \p s to TriggerMessageStatusEnum
 /// \returns a TriggerMessageStatusEnum from a string representation
@@ -1978,8 +1979,8 @@ enum class UnlockStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given UnlockStatusEnum \p e to human readable string
-/// \returns a string representation of the UnlockStatusEnum
-std::string unlock_status_enum_to_string(UnlockStatusEnum e);
+/// \returns a string representation of the UnlockStatusEnum, which refers to a constant
+std::string_view unlock_status_enum_to_string(UnlockStatusEnum e);
 
 /// \brief Converts the given std::string \p s to UnlockStatusEnum
 /// \returns a UnlockStatusEnum from a string representation
@@ -1999,8 +2000,8 @@ enum class UnpublishFirmwareStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given UnpublishFirmwareStatusEnum \p e to human readable string
-/// \returns a string representation of the UnpublishFirmwareStatusEnum
-std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e);
+/// \returns a string representation of the UnpublishFirmwareStatusEnum, which refers to a constant
+std::string_view unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e);
 
 /// \brief Converts the given std::string \p s to UnpublishFirmwareStatusEnum
 /// \returns a UnpublishFirmwareStatusEnum from a string representation
@@ -2022,8 +2023,8 @@ enum class UpdateFirmwareStatusEnum {
 
 namespace conversions {
 /// \brief Converts the given UpdateFirmwareStatusEnum \p e to human readable string
-/// \returns a string representation of the UpdateFirmwareStatusEnum
-std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e);
+/// \returns a string representation of the UpdateFirmwareStatusEnum, which refers to a constant
+std::string_view update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e);
 
 /// \brief Converts the given std::string \p s to UpdateFirmwareStatusEnum
 /// \returns a UpdateFirmwareStatusEnum from a string representation
@@ -29,6 +29,15 @@ void to_json(json& j, const CancelReservationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationRequest \p k
 void from_json(const json& j, CancelReservationRequest& k);
 
+/// \brief Writes the given CancelReservationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CancelReservationRequest& k);
+
+/// \brief Reads the given CancelReservationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, CancelReservationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CancelReservationRequest
+void validate_cancel_reservation_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const CancelReservationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationResponse \p k
 void from_json(const json& j, CancelReservationResponse& k);
 
+/// \brief Writes the given CancelReservationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CancelReservationResponse& k);
+
+/// \brief Reads the given CancelReservationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, CancelReservationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CancelReservationResponse
+void validate_cancel_reservation_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k);
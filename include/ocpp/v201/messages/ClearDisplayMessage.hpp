@@ -29,6 +29,15 @@ void to_json(json& j, const ClearDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageRequest \p k
 void from_json(const json& j, ClearDisplayMessageRequest& k);
 
+/// \brief Writes the given ClearDisplayMessageRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k);
+
+/// \brief Reads the given ClearDisplayMessageRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ClearDisplayMessageRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearDisplayMessageRequest
+void validate_clear_display_message_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const ClearDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageResponse \p k
 void from_json(const json& j, ClearDisplayMessageResponse& k);
 
+/// \brief Writes the given ClearDisplayMessageResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k);
+
+/// \brief Reads the given ClearDisplayMessageResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ClearDisplayMessageResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearDisplayMessageResponse
+void validate_clear_display_message_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k);
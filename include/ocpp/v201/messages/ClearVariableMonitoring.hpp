@@ -29,6 +29,15 @@ void to_json(json& j, const ClearVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringRequest \p k
 void from_json(const json& j, ClearVariableMonitoringRequest& k);
 
+/// \brief Writes the given ClearVariableMonitoringRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k);
+
+/// \brief Reads the given ClearVariableMonitoringRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ClearVariableMonitoringRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearVariableMonitoringRequest
+void validate_clear_variable_monitoring_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const ClearVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringResponse \p k
 void from_json(const json& j, ClearVariableMonitoringResponse& k);
 
+/// \brief Writes the given ClearVariableMonitoringResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k);
+
+/// \brief Reads the given ClearVariableMonitoringResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ClearVariableMonitoringResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearVariableMonitoringResponse
+void validate_clear_variable_monitoring_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k);
@@ -30,6 +30,15 @@ void to_json(json& j, const ClearedChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitRequest \p k
 void from_json(const json& j, ClearedChargingLimitRequest& k);
 
+/// \brief Writes the given ClearedChargingLimitRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k);
+
+/// \brief Reads the given ClearedChargingLimitRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ClearedChargingLimitRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearedChargingLimitRequest
+void validate_cleared_charging_limit_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const ClearedChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitResponse \p k
 void from_json(const json& j, ClearedChargingLimitResponse& k);
 
+/// \brief Writes the given ClearedChargingLimitResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k);
+
+/// \brief Reads the given ClearedChargingLimitResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ClearedChargingLimitResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearedChargingLimitResponse
+void validate_cleared_charging_limit_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k);
@@ -29,6 +29,15 @@ void to_json(json& j, const CostUpdatedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedRequest \p k
 void from_json(const json& j, CostUpdatedRequest& k);
 
+/// \brief Writes the given CostUpdatedRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k);
+
+/// \brief Reads the given CostUpdatedRequest \p k from the given \p reader
+void read_json(JsonReader& reader, CostUpdatedRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CostUpdatedRequest
+void validate_cost_updated_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k);
@@ -48,6 +57,15 @@ void to_json(json& j, const CostUpdatedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedResponse \p k
 void from_json(const json& j, CostUpdatedResponse& k);
 
+/// \brief Writes the given CostUpdatedResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k);
+
+/// \brief Reads the given CostUpdatedResponse \p k from the given \p reader
+void read_json(JsonReader& reader, CostUpdatedResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CostUpdatedResponse
+void validate_cost_updated_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k);
@@ -34,6 +34,15 @@ void to_json(json& j, const CustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationRequest \p k
 void from_json(const json& j, CustomerInformationRequest& k);
 
+/// \brief Writes the given CustomerInformationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k);
+
+/// \brief Reads the given CustomerInformationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, CustomerInformationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CustomerInformationRequest
+void validate_customer_information_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k);
@@ -55,6 +64,15 @@ void to_json(json& j, const CustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationResponse \p k
 void from_json(const json& j, CustomerInformationResponse& k);
 
+/// \brief Writes the given CustomerInformationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k);
+
+/// \brief Reads the given CustomerInformationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, CustomerInformationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CustomerInformationResponse
+void validate_customer_information_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k);
@@ -31,6 +31,15 @@ void to_json(json& j, const Get15118EVCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateRequest \p k
 void from_json(const json& j, Get15118EVCertificateRequest& k);
 
+/// \brief Writes the given Get15118EVCertificateRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k);
+
+/// \brief Reads the given Get15118EVCertificateRequest \p k from the given \p reader
+void read_json(JsonReader& reader, Get15118EVCertificateRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Get15118EVCertificateRequest
+void validate_get15118evcertificate_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k);
@@ -53,6 +62,15 @@ void to_json(json& j, const Get15118EVCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateResponse \p k
 void from_json(const json& j, Get15118EVCertificateResponse& k);
 
+/// \brief Writes the given Get15118EVCertificateResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k);
+
+/// \brief Reads the given Get15118EVCertificateResponse \p k from the given \p reader
+void read_json(JsonReader& reader, Get15118EVCertificateResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Get15118EVCertificateResponse
+void validate_get15118evcertificate_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k);
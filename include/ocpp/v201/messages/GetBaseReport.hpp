@@ -30,6 +30,15 @@ void to_json(json& j, const GetBaseReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportRequest \p k
 void from_json(const json& j, GetBaseReportRequest& k);
 
+/// \brief Writes the given GetBaseReportRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k);
+
+/// \brief Reads the given GetBaseReportRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetBaseReportRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetBaseReportRequest
+void validate_get_base_report_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const GetBaseReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportResponse \p k
 void from_json(const json& j, GetBaseReportResponse& k);
 
+/// \brief Writes the given GetBaseReportResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k);
+
+/// \brief Reads the given GetBaseReportResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetBaseReportResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetBaseReportResponse
+void validate_get_base_report_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k);
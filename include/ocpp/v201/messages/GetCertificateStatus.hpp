@@ -29,6 +29,15 @@ void to_json(json& j, const GetCertificateStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusRequest \p k
 void from_json(const json& j, GetCertificateStatusRequest& k);
 
+/// \brief Writes the given GetCertificateStatusRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k);
+
+/// \brief Reads the given GetCertificateStatusRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetCertificateStatusRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetCertificateStatusRequest
+void validate_get_certificate_status_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const GetCertificateStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusResponse \p k
 void from_json(const json& j, GetCertificateStatusResponse& k);
 
+/// \brief Writes the given GetCertificateStatusResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k);
+
+/// \brief Reads the given GetCertificateStatusResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetCertificateStatusResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetCertificateStatusResponse
+void validate_get_certificate_status_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k);
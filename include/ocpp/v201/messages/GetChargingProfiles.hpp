@@ -31,6 +31,15 @@ void to_json(json& j, const GetChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesRequest \p k
 void from_json(const json& j, GetChargingProfilesRequest& k);
 
+/// \brief Writes the given GetChargingProfilesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k);
+
+/// \brief Reads the given GetChargingProfilesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetChargingProfilesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetChargingProfilesRequest
+void validate_get_charging_profiles_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const GetChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesResponse \p k
 void from_json(const json& j, GetChargingProfilesResponse& k);
 
+/// \brief Writes the given GetChargingProfilesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k);
+
+/// \brief Reads the given GetChargingProfilesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetChargingProfilesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetChargingProfilesResponse
+void validate_get_charging_profiles_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k);
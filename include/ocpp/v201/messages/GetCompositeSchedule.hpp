@@ -31,6 +31,15 @@ void to_json(json& j, const GetCompositeScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleRequest \p k
 void from_json(const json& j, GetCompositeScheduleRequest& k);
 
+/// \brief Writes the given GetCompositeScheduleRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k);
+
+/// \brief Reads the given GetCompositeScheduleRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetCompositeScheduleRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetCompositeScheduleRequest
+void validate_get_composite_schedule_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k);
@@ -53,6 +62,15 @@ void to_json(json& j, const GetCompositeScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleResponse \p k
 void from_json(const json& j, GetCompositeScheduleResponse& k);
 
+/// \brief Writes the given GetCompositeScheduleResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k);
+
+/// \brief Reads the given GetCompositeScheduleResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetCompositeScheduleResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetCompositeScheduleResponse
+void validate_get_composite_schedule_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k);
@@ -32,6 +32,15 @@ void to_json(json& j, const GetDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesRequest \p k
 void from_json(const json& j, GetDisplayMessagesRequest& k);
 
+/// \brief Writes the given GetDisplayMessagesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k);
+
+/// \brief Reads the given GetDisplayMessagesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetDisplayMessagesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetDisplayMessagesRequest
+void validate_get_display_messages_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesRequest& k);
@@ -53,6 +62,15 @@ void to_json(json& j, const GetDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesResponse \p k
 void from_json(const json& j, GetDisplayMessagesResponse& k);
 
+/// \brief Writes the given GetDisplayMessagesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k);
+
+/// \brief Reads the given GetDisplayMessagesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetDisplayMessagesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetDisplayMessagesResponse
+void validate_get_display_messages_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k);
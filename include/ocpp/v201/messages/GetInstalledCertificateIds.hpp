@@ -29,6 +29,15 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsRequest \p k
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k);
+
+/// \brief Reads the given GetInstalledCertificateIdsRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetInstalledCertificateIdsRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetInstalledCertificateIdsRequest
+void validate_get_installed_certificate_ids_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsResponse \p k
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k);
+
+/// \brief Reads the given GetInstalledCertificateIdsResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetInstalledCertificateIdsResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetInstalledCertificateIdsResponse
+void validate_get_installed_certificate_ids_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k);
@@ -33,6 +33,15 @@ void to_json(json& j, const GetLogRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLogRequest \p k
 void from_json(const json& j, GetLogRequest& k);
 
+/// \brief Writes the given GetLogRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetLogRequest& k);
+
+/// \brief Reads the given GetLogRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetLogRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetLogRequest
+void validate_get_log_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k);
@@ -55,6 +64,15 @@ void to_json(json& j, const GetLogResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLogResponse \p k
 void from_json(const json& j, GetLogResponse& k);
 
+/// \brief Writes the given GetLogResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetLogResponse& k);
+
+/// \brief Reads the given GetLogResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetLogResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetLogResponse
+void validate_get_log_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k);
@@ -31,6 +31,15 @@ void to_json(json& j, const GetMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportRequest \p k
 void from_json(const json& j, GetMonitoringReportRequest& k);
 
+/// \brief Writes the given GetMonitoringReportRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k);
+
+/// \brief Reads the given GetMonitoringReportRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetMonitoringReportRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetMonitoringReportRequest
+void validate_get_monitoring_report_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const GetMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportResponse \p k
 void from_json(const json& j, GetMonitoringReportResponse& k);
 
+/// \brief Writes the given GetMonitoringReportResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k);
+
+/// \brief Reads the given GetMonitoringReportResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetMonitoringReportResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetMonitoringReportResponse
+void validate_get_monitoring_report_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k);
@@ -31,6 +31,15 @@ void to_json(json& j, const GetReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetReportRequest \p k
 void from_json(const json& j, GetReportRequest& k);
 
+/// \brief Writes the given GetReportRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetReportRequest& k);
+
+/// \brief Reads the given GetReportRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetReportRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetReportRequest
+void validate_get_report_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetReportRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const GetReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetReportResponse \p k
 void from_json(const json& j, GetReportResponse& k);
 
+/// \brief Writes the given GetReportResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetReportResponse& k);
+
+/// \brief Reads the given GetReportResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetReportResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetReportResponse
+void validate_get_report_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetReportResponse& k);
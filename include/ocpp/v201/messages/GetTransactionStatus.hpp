@@ -28,6 +28,15 @@ void to_json(json& j, const GetTransactionStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusRequest \p k
 void from_json(const json& j, GetTransactionStatusRequest& k);
 
+/// \brief Writes the given GetTransactionStatusRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k);
+
+/// \brief Reads the given GetTransactionStatusRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetTransactionStatusRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetTransactionStatusRequest
+void validate_get_transaction_status_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const GetTransactionStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusResponse \p k
 void from_json(const json& j, GetTransactionStatusResponse& k);
 
+/// \brief Writes the given GetTransactionStatusResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k);
+
+/// \brief Reads the given GetTransactionStatusResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetTransactionStatusResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetTransactionStatusResponse
+void validate_get_transaction_status_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k);
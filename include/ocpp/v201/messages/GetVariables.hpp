@@ -29,6 +29,15 @@ void to_json(json& j, const GetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesRequest \p k
 void from_json(const json& j, GetVariablesRequest& k);
 
+/// \brief Writes the given GetVariablesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariablesRequest& k);
+
+/// \brief Reads the given GetVariablesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariablesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariablesRequest
+void validate_get_variables_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const GetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesResponse \p k
 void from_json(const json& j, GetVariablesResponse& k);
 
+/// \brief Writes the given GetVariablesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariablesResponse& k);
+
+/// \brief Reads the given GetVariablesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariablesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariablesResponse
+void validate_get_variables_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k);
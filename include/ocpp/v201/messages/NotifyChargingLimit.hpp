@@ -31,6 +31,15 @@ void to_json(json& j, const NotifyChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitRequest \p k
 void from_json(const json& j, NotifyChargingLimitRequest& k);
 
+/// \brief Writes the given NotifyChargingLimitRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k);
+
+/// \brief Reads the given NotifyChargingLimitRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyChargingLimitRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyChargingLimitRequest
+void validate_notify_charging_limit_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const NotifyChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitResponse \p k
 void from_json(const json& j, NotifyChargingLimitResponse& k);
 
+/// \brief Writes the given NotifyChargingLimitResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k);
+
+/// \brief Reads the given NotifyChargingLimitResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyChargingLimitResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyChargingLimitResponse
+void validate_notify_charging_limit_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k);
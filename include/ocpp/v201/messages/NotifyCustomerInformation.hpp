@@ -32,6 +32,15 @@ void to_json(json& j, const NotifyCustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationRequest \p k
 void from_json(const json& j, NotifyCustomerInformationRequest& k);
 
+/// \brief Writes the given NotifyCustomerInformationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k);
+
+/// \brief Reads the given NotifyCustomerInformationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyCustomerInformationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyCustomerInformationRequest
+void validate_notify_customer_information_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const NotifyCustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationResponse \p k
 void from_json(const json& j, NotifyCustomerInformationResponse& k);
 
+/// \brief Writes the given NotifyCustomerInformationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k);
+
+/// \brief Reads the given NotifyCustomerInformationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyCustomerInformationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyCustomerInformationResponse
+void validate_notify_customer_information_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k);
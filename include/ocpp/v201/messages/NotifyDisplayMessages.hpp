@@ -31,6 +31,15 @@ void to_json(json& j, const NotifyDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesRequest \p k
 void from_json(const json& j, NotifyDisplayMessagesRequest& k);
 
+/// \brief Writes the given NotifyDisplayMessagesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k);
+
+/// \brief Reads the given NotifyDisplayMessagesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyDisplayMessagesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyDisplayMessagesRequest
+void validate_notify_display_messages_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const NotifyDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesResponse \p k
 void from_json(const json& j, NotifyDisplayMessagesResponse& k);
 
+/// \brief Writes the given NotifyDisplayMessagesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k);
+
+/// \brief Reads the given NotifyDisplayMessagesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyDisplayMessagesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyDisplayMessagesResponse
+void validate_notify_display_messages_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k);
@@ -31,6 +31,15 @@ void to_json(json& j, const NotifyEVChargingNeedsRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsRequest \p k
 void from_json(const json& j, NotifyEVChargingNeedsRequest& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k);
+
+/// \brief Reads the given NotifyEVChargingNeedsRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEVChargingNeedsRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEVChargingNeedsRequest
+void validate_notify_evcharging_needs_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const NotifyEVChargingNeedsResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsResponse \p k
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k);
+
+/// \brief Reads the given NotifyEVChargingNeedsResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEVChargingNeedsResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEVChargingNeedsResponse
+void validate_notify_evcharging_needs_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k);
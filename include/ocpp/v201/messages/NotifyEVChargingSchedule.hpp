@@ -31,6 +31,15 @@ void to_json(json& j, const NotifyEVChargingScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleRequest \p k
 void from_json(const json& j, NotifyEVChargingScheduleRequest& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k);
+
+/// \brief Reads the given NotifyEVChargingScheduleRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEVChargingScheduleRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEVChargingScheduleRequest
+void validate_notify_evcharging_schedule_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const NotifyEVChargingScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleResponse \p k
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k);
+
+/// \brief Reads the given NotifyEVChargingScheduleResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEVChargingScheduleResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEVChargingScheduleResponse
+void validate_notify_evcharging_schedule_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k);
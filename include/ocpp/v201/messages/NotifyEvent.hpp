@@ -32,6 +32,15 @@ void to_json(json& j, const NotifyEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventRequest \p k
 void from_json(const json& j, NotifyEventRequest& k);
 
+/// \brief Writes the given NotifyEventRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEventRequest& k);
+
+/// \brief Reads the given NotifyEventRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEventRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEventRequest
+void validate_notify_event_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const NotifyEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventResponse \p k
 void from_json(const json& j, NotifyEventResponse& k);
 
+/// \brief Writes the given NotifyEventResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEventResponse& k);
+
+/// \brief Reads the given NotifyEventResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyEventResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyEventResponse
+void validate_notify_event_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k);
@@ -33,6 +33,15 @@ void to_json(json& j, const NotifyMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportRequest \p k
 void from_json(const json& j, NotifyMonitoringReportRequest& k);
 
+/// \brief Writes the given NotifyMonitoringReportRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k);
+
+/// \brief Reads the given NotifyMonitoringReportRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyMonitoringReportRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyMonitoringReportRequest
+void validate_notify_monitoring_report_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const NotifyMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportResponse \p k
 void from_json(const json& j, NotifyMonitoringReportResponse& k);
 
+/// \brief Writes the given NotifyMonitoringReportResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k);
+
+/// \brief Reads the given NotifyMonitoringReportResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyMonitoringReportResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyMonitoringReportResponse
+void validate_notify_monitoring_report_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k);
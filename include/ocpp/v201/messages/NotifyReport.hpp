@@ -33,6 +33,15 @@ void to_json(json& j, const NotifyReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportRequest \p k
 void from_json(const json& j, NotifyReportRequest& k);
 
+/// \brief Writes the given NotifyReportRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyReportRequest& k);
+
+/// \brief Reads the given NotifyReportRequest \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyReportRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyReportRequest
+void validate_notify_report_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const NotifyReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportResponse \p k
 void from_json(const json& j, NotifyReportResponse& k);
 
+/// \brief Writes the given NotifyReportResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NotifyReportResponse& k);
+
+/// \brief Reads the given NotifyReportResponse \p k from the given \p reader
+void read_json(JsonReader& reader, NotifyReportResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NotifyReportResponse
+void validate_notify_report_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k);
@@ -33,6 +33,15 @@ void to_json(json& j, const PublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareRequest \p k
 void from_json(const json& j, PublishFirmwareRequest& k);
 
+/// \brief Writes the given PublishFirmwareRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k);
+
+/// \brief Reads the given PublishFirmwareRequest \p k from the given \p reader
+void read_json(JsonReader& reader, PublishFirmwareRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a PublishFirmwareRequest
+void validate_publish_firmware_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k);
@@ -54,6 +63,15 @@ void to_json(json& j, const PublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareResponse \p k
 void from_json(const json& j, PublishFirmwareResponse& k);
 
+/// \brief Writes the given PublishFirmwareResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k);
+
+/// \brief Reads the given PublishFirmwareResponse \p k from the given \p reader
+void read_json(JsonReader& reader, PublishFirmwareResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a PublishFirmwareResponse
+void validate_publish_firmware_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k);
@@ -31,6 +31,16 @@ void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k);
+
+/// \brief Reads the given PublishFirmwareStatusNotificationRequest \p k from the given \p reader
+void read_json(JsonReader& reader, PublishFirmwareStatusNotificationRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// PublishFirmwareStatusNotificationRequest
+void validate_publish_firmware_status_notification_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k);
@@ -50,6 +60,16 @@ void to_json(json& j, const PublishFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k);
+
+/// \brief Reads the given PublishFirmwareStatusNotificationResponse \p k from the given \p reader
+void read_json(JsonReader& reader, PublishFirmwareStatusNotificationResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a
+/// PublishFirmwareStatusNotificationResponse
+void validate_publish_firmware_status_notification_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k);
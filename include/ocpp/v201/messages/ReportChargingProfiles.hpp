@@ -33,6 +33,15 @@ void to_json(json& j, const ReportChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesRequest \p k
 void from_json(const json& j, ReportChargingProfilesRequest& k);
 
+/// \brief Writes the given ReportChargingProfilesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k);
+
+/// \brief Reads the given ReportChargingProfilesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ReportChargingProfilesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReportChargingProfilesRequest
+void validate_report_charging_profiles_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k);
@@ -52,6 +61,15 @@ void to_json(json& j, const ReportChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesResponse \p k
 void from_json(const json& j, ReportChargingProfilesResponse& k);
 
+/// \brief Writes the given ReportChargingProfilesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k);
+
+/// \brief Reads the given ReportChargingProfilesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ReportChargingProfilesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReportChargingProfilesResponse
+void validate_report_charging_profiles_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k);
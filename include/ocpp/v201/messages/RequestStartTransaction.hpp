@@ -33,6 +33,15 @@ void to_json(json& j, const RequestStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionRequest \p k
 void from_json(const json& j, RequestStartTransactionRequest& k);
 
+/// \brief Writes the given RequestStartTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k);
+
+/// \brief Reads the given RequestStartTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, RequestStartTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RequestStartTransactionRequest
+void validate_request_start_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k);
@@ -55,6 +64,15 @@ void to_json(json& j, const RequestStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionResponse \p k
 void from_json(const json& j, RequestStartTransactionResponse& k);
 
+/// \brief Writes the given RequestStartTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k);
+
+/// \brief Reads the given RequestStartTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, RequestStartTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RequestStartTransactionResponse
+void validate_request_start_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k);
@@ -29,6 +29,15 @@ void to_json(json& j, const RequestStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionRequest \p k
 void from_json(const json& j, RequestStopTransactionRequest& k);
 
+/// \brief Writes the given RequestStopTransactionRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k);
+
+/// \brief Reads the given RequestStopTransactionRequest \p k from the given \p reader
+void read_json(JsonReader& reader, RequestStopTransactionRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RequestStopTransactionRequest
+void validate_request_stop_transaction_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const RequestStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionResponse \p k
 void from_json(const json& j, RequestStopTransactionResponse& k);
 
+/// \brief Writes the given RequestStopTransactionResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k);
+
+/// \brief Reads the given RequestStopTransactionResponse \p k from the given \p reader
+void read_json(JsonReader& reader, RequestStopTransactionResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RequestStopTransactionResponse
+void validate_request_stop_transaction_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k);
@@ -30,6 +30,15 @@ void to_json(json& j, const ReservationStatusUpdateRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateRequest \p k
 void from_json(const json& j, ReservationStatusUpdateRequest& k);
 
+/// \brief Writes the given ReservationStatusUpdateRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k);
+
+/// \brief Reads the given ReservationStatusUpdateRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ReservationStatusUpdateRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReservationStatusUpdateRequest
+void validate_reservation_status_update_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const ReservationStatusUpdateResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateResponse \p k
 void from_json(const json& j, ReservationStatusUpdateResponse& k);
 
+/// \brief Writes the given ReservationStatusUpdateResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k);
+
+/// \brief Reads the given ReservationStatusUpdateResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ReservationStatusUpdateResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReservationStatusUpdateResponse
+void validate_reservation_status_update_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k);
@@ -34,6 +34,15 @@ void to_json(json& j, const ReserveNowRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowRequest \p k
 void from_json(const json& j, ReserveNowRequest& k);
 
+/// \brief Writes the given ReserveNowRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReserveNowRequest& k);
+
+/// \brief Reads the given ReserveNowRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ReserveNowRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReserveNowRequest
+void validate_reserve_now_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k);
@@ -55,6 +64,15 @@ void to_json(json& j, const ReserveNowResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowResponse \p k
 void from_json(const json& j, ReserveNowResponse& k);
 
+/// \brief Writes the given ReserveNowResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReserveNowResponse& k);
+
+/// \brief Reads the given ReserveNowResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ReserveNowResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReserveNowResponse
+void validate_reserve_now_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k);
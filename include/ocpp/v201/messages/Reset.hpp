@@ -30,6 +30,15 @@ void to_json(json& j, const ResetRequest& k);
 /// \brief Conversion from a given json object \p j to a given ResetRequest \p k
 void from_json(const json& j, ResetRequest& k);
 
+/// \brief Writes the given ResetRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ResetRequest& k);
+
+/// \brief Reads the given ResetRequest \p k from the given \p reader
+void read_json(JsonReader& reader, ResetRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ResetRequest
+void validate_reset_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const ResetResponse& k);
 /// \brief Conversion from a given json object \p j to a given ResetResponse \p k
 void from_json(const json& j, ResetResponse& k);
 
+/// \brief Writes the given ResetResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ResetResponse& k);
+
+/// \brief Reads the given ResetResponse \p k from the given \p reader
+void read_json(JsonReader& reader, ResetResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ResetResponse
+void validate_reset_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k);
@@ -29,6 +29,15 @@ void to_json(json& j, const SetDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageRequest \p k
 void from_json(const json& j, SetDisplayMessageRequest& k);
 
+/// \brief Writes the given SetDisplayMessageRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k);
+
+/// \brief Reads the given SetDisplayMessageRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetDisplayMessageRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetDisplayMessageRequest
+void validate_set_display_message_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const SetDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageResponse \p k
 void from_json(const json& j, SetDisplayMessageResponse& k);
 
+/// \brief Writes the given SetDisplayMessageResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k);
+
+/// \brief Reads the given SetDisplayMessageResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetDisplayMessageResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetDisplayMessageResponse
+void validate_set_display_message_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k);
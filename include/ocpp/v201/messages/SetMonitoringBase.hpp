@@ -29,6 +29,15 @@ void to_json(json& j, const SetMonitoringBaseRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseRequest \p k
 void from_json(const json& j, SetMonitoringBaseRequest& k);
 
+/// \brief Writes the given SetMonitoringBaseRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k);
+
+/// \brief Reads the given SetMonitoringBaseRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringBaseRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringBaseRequest
+void validate_set_monitoring_base_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const SetMonitoringBaseResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseResponse \p k
 void from_json(const json& j, SetMonitoringBaseResponse& k);
 
+/// \brief Writes the given SetMonitoringBaseResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k);
+
+/// \brief Reads the given SetMonitoringBaseResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringBaseResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringBaseResponse
+void validate_set_monitoring_base_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k);
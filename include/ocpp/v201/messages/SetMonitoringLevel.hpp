@@ -29,6 +29,15 @@ void to_json(json& j, const SetMonitoringLevelRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelRequest \p k
 void from_json(const json& j, SetMonitoringLevelRequest& k);
 
+/// \brief Writes the given SetMonitoringLevelRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k);
+
+/// \brief Reads the given SetMonitoringLevelRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringLevelRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringLevelRequest
+void validate_set_monitoring_level_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k);
@@ -50,6 +59,15 @@ void to_json(json& j, const SetMonitoringLevelResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelResponse \p k
 void from_json(const json& j, SetMonitoringLevelResponse& k);
 
+/// \brief Writes the given SetMonitoringLevelResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k);
+
+/// \brief Reads the given SetMonitoringLevelResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringLevelResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringLevelResponse
+void validate_set_monitoring_level_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k);
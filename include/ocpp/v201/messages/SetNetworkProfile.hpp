@@ -30,6 +30,15 @@ void to_json(json& j, const SetNetworkProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileRequest \p k
 void from_json(const json& j, SetNetworkProfileRequest& k);
 
+/// \brief Writes the given SetNetworkProfileRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k);
+
+/// \brief Reads the given SetNetworkProfileRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetNetworkProfileRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetNetworkProfileRequest
+void validate_set_network_profile_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const SetNetworkProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileResponse \p k
 void from_json(const json& j, SetNetworkProfileResponse& k);
 
+/// \brief Writes the given SetNetworkProfileResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k);
+
+/// \brief Reads the given SetNetworkProfileResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetNetworkProfileResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetNetworkProfileResponse
+void validate_set_network_profile_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k);
@@ -29,6 +29,15 @@ void to_json(json& j, const SetVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringRequest \p k
 void from_json(const json& j, SetVariableMonitoringRequest& k);
 
+/// \brief Writes the given SetVariableMonitoringRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k);
+
+/// \brief Reads the given SetVariableMonitoringRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableMonitoringRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableMonitoringRequest
+void validate_set_variable_monitoring_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const SetVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringResponse \p k
 void from_json(const json& j, SetVariableMonitoringResponse& k);
 
+/// \brief Writes the given SetVariableMonitoringResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k);
+
+/// \brief Reads the given SetVariableMonitoringResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableMonitoringResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableMonitoringResponse
+void validate_set_variable_monitoring_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k);
@@ -29,6 +29,15 @@ void to_json(json& j, const SetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesRequest \p k
 void from_json(const json& j, SetVariablesRequest& k);
 
+/// \brief Writes the given SetVariablesRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariablesRequest& k);
+
+/// \brief Reads the given SetVariablesRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariablesRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariablesRequest
+void validate_set_variables_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const SetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesResponse \p k
 void from_json(const json& j, SetVariablesResponse& k);
 
+/// \brief Writes the given SetVariablesResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariablesResponse& k);
+
+/// \brief Reads the given SetVariablesResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariablesResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariablesResponse
+void validate_set_variables_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k);
@@ -30,6 +30,15 @@ void to_json(json& j, const SignCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateRequest \p k
 void from_json(const json& j, SignCertificateRequest& k);
 
+/// \brief Writes the given SignCertificateRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignCertificateRequest& k);
+
+/// \brief Reads the given SignCertificateRequest \p k from the given \p reader
+void read_json(JsonReader& reader, SignCertificateRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignCertificateRequest
+void validate_sign_certificate_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const SignCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateResponse \p k
 void from_json(const json& j, SignCertificateResponse& k);
 
+/// \brief Writes the given SignCertificateResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignCertificateResponse& k);
+
+/// \brief Reads the given SignCertificateResponse \p k from the given \p reader
+void read_json(JsonReader& reader, SignCertificateResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignCertificateResponse
+void validate_sign_certificate_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k);
@@ -40,6 +40,15 @@ void to_json(json& j, const TransactionEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventRequest \p k
 void from_json(const json& j, TransactionEventRequest& k);
 
+/// \brief Writes the given TransactionEventRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TransactionEventRequest& k);
+
+/// \brief Reads the given TransactionEventRequest \p k from the given \p reader
+void read_json(JsonReader& reader, TransactionEventRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a TransactionEventRequest
+void validate_transaction_event_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k);
@@ -63,6 +72,15 @@ void to_json(json& j, const TransactionEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventResponse \p k
 void from_json(const json& j, TransactionEventResponse& k);
 
+/// \brief Writes the given TransactionEventResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TransactionEventResponse& k);
+
+/// \brief Reads the given TransactionEventResponse \p k from the given \p reader
+void read_json(JsonReader& reader, TransactionEventResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a TransactionEventResponse
+void validate_transaction_event_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k);
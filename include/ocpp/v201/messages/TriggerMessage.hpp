@@ -30,6 +30,15 @@ void to_json(json& j, const TriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageRequest \p k
 void from_json(const json& j, TriggerMessageRequest& k);
 
+/// \brief Writes the given TriggerMessageRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k);
+
+/// \brief Reads the given TriggerMessageRequest \p k from the given \p reader
+void read_json(JsonReader& reader, TriggerMessageRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a TriggerMessageRequest
+void validate_trigger_message_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const TriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageResponse \p k
 void from_json(const json& j, TriggerMessageResponse& k);
 
+/// \brief Writes the given TriggerMessageResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k);
+
+/// \brief Reads the given TriggerMessageResponse \p k from the given \p reader
+void read_json(JsonReader& reader, TriggerMessageResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a TriggerMessageResponse
+void validate_trigger_message_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k);
@@ -30,6 +30,15 @@ void to_json(json& j, const UnlockConnectorRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorRequest \p k
 void from_json(const json& j, UnlockConnectorRequest& k);
 
+/// \brief Writes the given UnlockConnectorRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k);
+
+/// \brief Reads the given UnlockConnectorRequest \p k from the given \p reader
+void read_json(JsonReader& reader, UnlockConnectorRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnlockConnectorRequest
+void validate_unlock_connector_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k);
@@ -51,6 +60,15 @@ void to_json(json& j, const UnlockConnectorResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorResponse \p k
 void from_json(const json& j, UnlockConnectorResponse& k);
 
+/// \brief Writes the given UnlockConnectorResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k);
+
+/// \brief Reads the given UnlockConnectorResponse \p k from the given \p reader
+void read_json(JsonReader& reader, UnlockConnectorResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnlockConnectorResponse
+void validate_unlock_connector_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k);
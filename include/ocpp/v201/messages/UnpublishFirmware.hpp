@@ -29,6 +29,15 @@ void to_json(json& j, const UnpublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareRequest \p k
 void from_json(const json& j, UnpublishFirmwareRequest& k);
 
+/// \brief Writes the given UnpublishFirmwareRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k);
+
+/// \brief Reads the given UnpublishFirmwareRequest \p k from the given \p reader
+void read_json(JsonReader& reader, UnpublishFirmwareRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnpublishFirmwareRequest
+void validate_unpublish_firmware_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k);
@@ -49,6 +58,15 @@ void to_json(json& j, const UnpublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareResponse \p k
 void from_json(const json& j, UnpublishFirmwareResponse& k);
 
+/// \brief Writes the given UnpublishFirmwareResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k);
+
+/// \brief Reads the given UnpublishFirmwareResponse \p k from the given \p reader
+void read_json(JsonReader& reader, UnpublishFirmwareResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnpublishFirmwareResponse
+void validate_unpublish_firmware_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k);
@@ -32,6 +32,15 @@ void to_json(json& j, const UpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareRequest \p k
 void from_json(const json& j, UpdateFirmwareRequest& k);
 
+/// \brief Writes the given UpdateFirmwareRequest \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k);
+
+/// \brief Reads the given UpdateFirmwareRequest \p k from the given \p reader
+void read_json(JsonReader& reader, UpdateFirmwareRequest& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UpdateFirmwareRequest
+void validate_update_firmware_request(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k);
@@ -53,6 +62,15 @@ void to_json(json& j, const UpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareResponse \p k
 void from_json(const json& j, UpdateFirmwareResponse& k);
 
+/// \brief Writes the given UpdateFirmwareResponse \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k);
+
+/// \brief Reads the given UpdateFirmwareResponse \p k from the given \p reader
+void read_json(JsonReader& reader, UpdateFirmwareResponse& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UpdateFirmwareResponse
+void validate_update_firmware_response(JsonValidator& validator);
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k);
@@ -12,42 +12,68 @@ namespace ocpp {
 namespace v201 {
 
 /// \brief Utility class that is used to split NotifyReportRequest into several ones in case ReportData is too big.
+///
+/// ReportData can either be split from a complete NotifyReportRequest using create_call_payloads() or be streamed
+/// into the splitter one item at a time using add(). In the latter case every request is handed to the payload
+/// callback as json text as soon as it is full, so only one request is held in memory at a time. Every ReportData is
+/// serialized once, directly into the request it is part of.
 class NotifyReportRequestsSplitter {
+public:
+    /// \brief Receives the \p message_id and the \p payload of a NotifyReport.req as json text
+    using PayloadCallback = std::function<void(const MessageId& message_id, std::string&& payload)>;
 
 private:
     // cppcheck-suppress unusedStructMember
     static const std::string MESSAGE_TYPE; // NotifyReport
-    const NotifyReportRequest& original_request;
+    const NotifyReportRequest* original_request; // only set if the splitter was created for create_call_payloads()
     // cppcheck-suppress unusedStructMember
     size_t max_size;
     const std::function<MessageId()> message_id_generator_callback;
+    PayloadCallback payload_callback;
     json request_json_template; // json that is used  as template for request json
     // cppcheck-suppress unusedStructMember
     const size_t json_skeleton_size; // size of the json skeleton for a call json object which includes everything
                                      // except the requests' reportData and the messageId
 
+    // state of the payload that is currently filled
+    std::optional<MessageId> message_id;
+    std::string payload_buffer; // the payload serialized so far, starting with its reportData
+    size_t report_data_count;
+    size_t payload_size;
+    int seq_no;
+
 public:
     NotifyReportRequestsSplitter(const NotifyReportRequest& originalRequest, size_t max_size,
                                  std::function<MessageId()>&& message_id_generator_callback);
+    /// \brief Creates a splitter that streams the ReportData that is added using add() into call payloads, which are
+    /// passed to the given \p payload_callback . The requestId and generatedAt of the payloads are taken from
+    /// \p request_template
+    NotifyReportRequestsSplitter(const NotifyReportRequest& request_template, size_t max_size,
+                                 std::function<MessageId()>&& message_id_generator_callback,
+                                 PayloadCallback&& payload_callback);
     NotifyReportRequestsSplitter() = delete;
 
     /// \brief Splits the provided NotifyReportRequest into (potentially) several Call payloads
     /// \returns the json messages that serialize the resulting Call<NotifyReportRequest> objects
     std::vector<json> create_call_payloads();
 
+    /// \brief Adds the given \p report_data to the current payload. If it does not fit into the current payload
+    /// anymore, the current payload is passed to the payload callback and a new one is started. Every payload contains
+    /// at least one ReportData, even if it exceeds the size bound.
+    void add(const ReportData& report_data);
+
+    /// \brief Passes the last payload to the payload callback. If no ReportData has been added, this is a payload
+    /// with empty reportData.
+    void finish();
+
 private:
-    size_t create_request_template_json_and_return_skeleton_size();
-
-    // Create next call payload (with as many reportData items as possible)
-    json create_next_payload(const int& seq_no,
-                             std::vector<ocpp::v201::ReportData>::const_iterator& report_data_iterator,
-                             const std::vector<ocpp::v201::ReportData>::const_iterator& report_data_end,
-                             const std::string& message_id);
-
-    // Create next request payload (with as many reportData items as possible) to be contained in next call payload
-    static json create_next_report_data_json(std::vector<ocpp::v201::ReportData>::const_iterator& report_data_iterator,
-                                             const std::vector<ocpp::v201::ReportData>::const_iterator& report_data_end,
-                                             const size_t& remaining_size);
+    size_t create_request_template_json_and_return_skeleton_size(const NotifyReportRequest& request);
+
+    // Start the next call payload
+    void start_payload();
+
+    // Pass the current call payload to the payload callback
+    void complete_payload(bool tbc);
 };
 
 } // namespace v201
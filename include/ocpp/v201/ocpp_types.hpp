@@ -8,6 +8,9 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_reader.hpp>
+#include <ocpp/common/json_validator.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/enums.hpp>
 
@@ -16,6 +19,9 @@ namespace v201 {
 
 using CustomData = nlohmann::json;
 
+/// \brief Validates the next value of the given \p validator against the schema of a CustomData
+void validate_custom_data(JsonValidator& validator);
+
 struct AdditionalInfo {
     CiString<36> additionalIdToken;
     CiString<50> type;
@@ -27,6 +33,15 @@ void to_json(json& j, const AdditionalInfo& k);
 /// \brief Conversion from a given json object \p j to a given AdditionalInfo \p k
 void from_json(const json& j, AdditionalInfo& k);
 
+/// \brief Writes the given AdditionalInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AdditionalInfo& k);
+
+/// \brief Reads the given AdditionalInfo \p k from the given \p reader
+void read_json(JsonReader& reader, AdditionalInfo& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a AdditionalInfo
+void validate_additional_info(JsonValidator& validator);
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k);
@@ -43,6 +58,15 @@ void to_json(json& j, const IdToken& k);
 /// \brief Conversion from a given json object \p j to a given IdToken \p k
 void from_json(const json& j, IdToken& k);
 
+/// \brief Writes the given IdToken \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdToken& k);
+
+/// \brief Reads the given IdToken \p k from the given \p reader
+void read_json(JsonReader& reader, IdToken& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdToken
+void validate_id_token(JsonValidator& validator);
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k);
@@ -61,6 +85,15 @@ void to_json(json& j, const OCSPRequestData& k);
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k);
 
+/// \brief Writes the given OCSPRequestData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const OCSPRequestData& k);
+
+/// \brief Reads the given OCSPRequestData \p k from the given \p reader
+void read_json(JsonReader& reader, OCSPRequestData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a OCSPRequestData
+void validate_ocsprequest_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k);
@@ -77,6 +110,15 @@ void to_json(json& j, const MessageContent& k);
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k);
 
+/// \brief Writes the given MessageContent \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MessageContent& k);
+
+/// \brief Reads the given MessageContent \p k from the given \p reader
+void read_json(JsonReader& reader, MessageContent& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MessageContent
+void validate_message_content(JsonValidator& validator);
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k);
@@ -98,6 +140,15 @@ void to_json(json& j, const IdTokenInfo& k);
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k);
 
+/// \brief Writes the given IdTokenInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdTokenInfo& k);
+
+/// \brief Reads the given IdTokenInfo \p k from the given \p reader
+void read_json(JsonReader& reader, IdTokenInfo& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdTokenInfo
+void validate_id_token_info(JsonValidator& validator);
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k);
@@ -113,6 +164,15 @@ void to_json(json& j, const Modem& k);
 /// \brief Conversion from a given json object \p j to a given Modem \p k
 void from_json(const json& j, Modem& k);
 
+/// \brief Writes the given Modem \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Modem& k);
+
+/// \brief Reads the given Modem \p k from the given \p reader
+void read_json(JsonReader& reader, Modem& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Modem
+void validate_modem(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k);
@@ -131,6 +191,15 @@ void to_json(json& j, const ChargingStation& k);
 /// \brief Conversion from a given json object \p j to a given ChargingStation \p k
 void from_json(const json& j, ChargingStation& k);
 
+/// \brief Writes the given ChargingStation \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingStation& k);
+
+/// \brief Reads the given ChargingStation \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingStation& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingStation
+void validate_charging_station(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k);
@@ -146,6 +215,15 @@ void to_json(json& j, const StatusInfo& k);
 /// \brief Conversion from a given json object \p j to a given StatusInfo \p k
 void from_json(const json& j, StatusInfo& k);
 
+/// \brief Writes the given StatusInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StatusInfo& k);
+
+/// \brief Reads the given StatusInfo \p k from the given \p reader
+void read_json(JsonReader& reader, StatusInfo& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a StatusInfo
+void validate_status_info(JsonValidator& validator);
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k);
@@ -161,6 +239,15 @@ void to_json(json& j, const EVSE& k);
 /// \brief Conversion from a given json object \p j to a given EVSE \p k
 void from_json(const json& j, EVSE& k);
 
+/// \brief Writes the given EVSE \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const EVSE& k);
+
+/// \brief Reads the given EVSE \p k from the given \p reader
+void read_json(JsonReader& reader, EVSE& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a EVSE
+void validate_evse(JsonValidator& validator);
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k);
@@ -177,6 +264,15 @@ void to_json(json& j, const ClearChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfile \p k
 void from_json(const json& j, ClearChargingProfile& k);
 
+/// \brief Writes the given ClearChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfile& k);
+
+/// \brief Reads the given ClearChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ClearChargingProfile& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearChargingProfile
+void validate_clear_charging_profile(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k);
@@ -193,6 +289,15 @@ void to_json(json& j, const ClearMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k);
 
+/// \brief Writes the given ClearMonitoringResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k);
+
+/// \brief Reads the given ClearMonitoringResult \p k from the given \p reader
+void read_json(JsonReader& reader, ClearMonitoringResult& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearMonitoringResult
+void validate_clear_monitoring_result(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k);
@@ -210,6 +315,15 @@ void to_json(json& j, const CertificateHashDataType& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
+/// \brief Reads the given CertificateHashDataType \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataType& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataType
+void validate_certificate_hash_data_type(JsonValidator& validator);
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k);
@@ -227,6 +341,15 @@ void to_json(json& j, const ChargingProfileCriterion& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfileCriterion \p k
 void from_json(const json& j, ChargingProfileCriterion& k);
 
+/// \brief Writes the given ChargingProfileCriterion \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k);
+
+/// \brief Reads the given ChargingProfileCriterion \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfileCriterion& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfileCriterion
+void validate_charging_profile_criterion(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k);
@@ -244,6 +367,15 @@ void to_json(json& j, const ChargingSchedulePeriod& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
+/// \brief Reads the given ChargingSchedulePeriod \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedulePeriod& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedulePeriod
+void validate_charging_schedule_period(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k);
@@ -262,6 +394,15 @@ void to_json(json& j, const CompositeSchedule& k);
 /// \brief Conversion from a given json object \p j to a given CompositeSchedule \p k
 void from_json(const json& j, CompositeSchedule& k);
 
+/// \brief Writes the given CompositeSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CompositeSchedule& k);
+
+/// \brief Reads the given CompositeSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, CompositeSchedule& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CompositeSchedule
+void validate_composite_schedule(JsonValidator& validator);
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k);
@@ -278,6 +419,15 @@ void to_json(json& j, const CertificateHashDataChain& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataChain \p k
 void from_json(const json& j, CertificateHashDataChain& k);
 
+/// \brief Writes the given CertificateHashDataChain \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k);
+
+/// \brief Reads the given CertificateHashDataChain \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataChain& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataChain
+void validate_certificate_hash_data_chain(JsonValidator& validator);
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k);
@@ -294,6 +444,15 @@ void to_json(json& j, const LogParameters& k);
 /// \brief Conversion from a given json object \p j to a given LogParameters \p k
 void from_json(const json& j, LogParameters& k);
 
+/// \brief Writes the given LogParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogParameters& k);
+
+/// \brief Reads the given LogParameters \p k from the given \p reader
+void read_json(JsonReader& reader, LogParameters& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogParameters
+void validate_log_parameters(JsonValidator& validator);
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k);
@@ -310,6 +469,15 @@ void to_json(json& j, const Component& k);
 /// \brief Conversion from a given json object \p j to a given Component \p k
 void from_json(const json& j, Component& k);
 
+/// \brief Writes the given Component \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Component& k);
+
+/// \brief Reads the given Component \p k from the given \p reader
+void read_json(JsonReader& reader, Component& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Component
+void validate_component(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k);
@@ -325,6 +493,15 @@ void to_json(json& j, const Variable& k);
 /// \brief Conversion from a given json object \p j to a given Variable \p k
 void from_json(const json& j, Variable& k);
 
+/// \brief Writes the given Variable \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Variable& k);
+
+/// \brief Reads the given Variable \p k from the given \p reader
+void read_json(JsonReader& reader, Variable& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Variable
+void validate_variable(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k);
@@ -340,6 +517,15 @@ void to_json(json& j, const ComponentVariable& k);
 /// \brief Conversion from a given json object \p j to a given ComponentVariable \p k
 void from_json(const json& j, ComponentVariable& k);
 
+/// \brief Writes the given ComponentVariable \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ComponentVariable& k);
+
+/// \brief Reads the given ComponentVariable \p k from the given \p reader
+void read_json(JsonReader& reader, ComponentVariable& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ComponentVariable
+void validate_component_variable(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k);
@@ -356,6 +542,15 @@ void to_json(json& j, const GetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableData \p k
 void from_json(const json& j, GetVariableData& k);
 
+/// \brief Writes the given GetVariableData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableData& k);
+
+/// \brief Reads the given GetVariableData \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariableData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariableData
+void validate_get_variable_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableData written to
 std::ostream& operator<<(std::ostream& os, const GetVariableData& k);
@@ -375,6 +570,15 @@ void to_json(json& j, const GetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k);
 
+/// \brief Writes the given GetVariableResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableResult& k);
+
+/// \brief Reads the given GetVariableResult \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariableResult& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariableResult
+void validate_get_variable_result(JsonValidator& validator);
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k);
@@ -392,6 +596,15 @@ void to_json(json& j, const SignedMeterValue& k);
 /// \brief Conversion from a given json object \p j to a given SignedMeterValue \p k
 void from_json(const json& j, SignedMeterValue& k);
 
+/// \brief Writes the given SignedMeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedMeterValue& k);
+
+/// \brief Reads the given SignedMeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, SignedMeterValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignedMeterValue
+void validate_signed_meter_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k);
@@ -407,6 +620,15 @@ void to_json(json& j, const UnitOfMeasure& k);
 /// \brief Conversion from a given json object \p j to a given UnitOfMeasure \p k
 void from_json(const json& j, UnitOfMeasure& k);
 
+/// \brief Writes the given UnitOfMeasure \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnitOfMeasure& k);
+
+/// \brief Reads the given UnitOfMeasure \p k from the given \p reader
+void read_json(JsonReader& reader, UnitOfMeasure& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnitOfMeasure
+void validate_unit_of_measure(JsonValidator& validator);
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k);
@@ -427,6 +649,15 @@ void to_json(json& j, const SampledValue& k);
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k);
+
+/// \brief Reads the given SampledValue \p k from the given \p reader
+void read_json(JsonReader& reader, SampledValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SampledValue
+void validate_sampled_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k);
@@ -442,6 +673,15 @@ void to_json(json& j, const MeterValue& k);
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k);
+
+/// \brief Reads the given MeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValue& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValue
+void validate_meter_value(JsonValidator& validator);
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k);
@@ -457,6 +697,15 @@ void to_json(json& j, const RelativeTimeInterval& k);
 /// \brief Conversion from a given json object \p j to a given RelativeTimeInterval \p k
 void from_json(const json& j, RelativeTimeInterval& k);
 
+/// \brief Writes the given RelativeTimeInterval \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k);
+
+/// \brief Reads the given RelativeTimeInterval \p k from the given \p reader
+void read_json(JsonReader& reader, RelativeTimeInterval& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a RelativeTimeInterval
+void validate_relative_time_interval(JsonValidator& validator);
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k);
@@ -473,6 +722,15 @@ void to_json(json& j, const Cost& k);
 /// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k);
 
+/// \brief Writes the given Cost \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Cost& k);
+
+/// \brief Reads the given Cost \p k from the given \p reader
+void read_json(JsonReader& reader, Cost& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Cost
+void validate_cost(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k);
@@ -488,6 +746,15 @@ void to_json(json& j, const ConsumptionCost& k);
 /// \brief Conversion from a given json object \p j to a given ConsumptionCost \p k
 void from_json(const json& j, ConsumptionCost& k);
 
+/// \brief Writes the given ConsumptionCost \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ConsumptionCost& k);
+
+/// \brief Reads the given ConsumptionCost \p k from the given \p reader
+void read_json(JsonReader& reader, ConsumptionCost& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ConsumptionCost
+void validate_consumption_cost(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k);
@@ -504,6 +771,15 @@ void to_json(json& j, const SalesTariffEntry& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariffEntry \p k
 void from_json(const json& j, SalesTariffEntry& k);
 
+/// \brief Writes the given SalesTariffEntry \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariffEntry& k);
+
+/// \brief Reads the given SalesTariffEntry \p k from the given \p reader
+void read_json(JsonReader& reader, SalesTariffEntry& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SalesTariffEntry
+void validate_sales_tariff_entry(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k);
@@ -521,6 +797,15 @@ void to_json(json& j, const SalesTariff& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariff \p k
 void from_json(const json& j, SalesTariff& k);
 
+/// \brief Writes the given SalesTariff \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariff& k);
+
+/// \brief Reads the given SalesTariff \p k from the given \p reader
+void read_json(JsonReader& reader, SalesTariff& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SalesTariff
+void validate_sales_tariff(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k);
@@ -541,6 +826,15 @@ void to_json(json& j, const ChargingSchedule& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
+/// \brief Reads the given ChargingSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedule& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedule
+void validate_charging_schedule(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k);
@@ -556,6 +850,15 @@ void to_json(json& j, const ChargingLimit& k);
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k);
 
+/// \brief Writes the given ChargingLimit \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingLimit& k);
+
+/// \brief Reads the given ChargingLimit \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingLimit& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingLimit
+void validate_charging_limit(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k);
@@ -577,6 +880,15 @@ void to_json(json& j, const MessageInfo& k);
 /// \brief Conversion from a given json object \p j to a given MessageInfo \p k
 void from_json(const json& j, MessageInfo& k);
 
+/// \brief Writes the given MessageInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MessageInfo& k);
+
+/// \brief Reads the given MessageInfo \p k from the given \p reader
+void read_json(JsonReader& reader, MessageInfo& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MessageInfo
+void validate_message_info(JsonValidator& validator);
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k);
@@ -594,6 +906,15 @@ void to_json(json& j, const ACChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given ACChargingParameters \p k
 void from_json(const json& j, ACChargingParameters& k);
 
+/// \brief Writes the given ACChargingParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ACChargingParameters& k);
+
+/// \brief Reads the given ACChargingParameters \p k from the given \p reader
+void read_json(JsonReader& reader, ACChargingParameters& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ACChargingParameters
+void validate_accharging_parameters(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k);
@@ -615,6 +936,15 @@ void to_json(json& j, const DCChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given DCChargingParameters \p k
 void from_json(const json& j, DCChargingParameters& k);
 
+/// \brief Writes the given DCChargingParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DCChargingParameters& k);
+
+/// \brief Reads the given DCChargingParameters \p k from the given \p reader
+void read_json(JsonReader& reader, DCChargingParameters& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a DCChargingParameters
+void validate_dccharging_parameters(JsonValidator& validator);
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k);
@@ -632,6 +962,15 @@ void to_json(json& j, const ChargingNeeds& k);
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k);
 
+/// \brief Writes the given ChargingNeeds \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingNeeds& k);
+
+/// \brief Reads the given ChargingNeeds \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingNeeds& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingNeeds
+void validate_charging_needs(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k);
@@ -658,6 +997,15 @@ void to_json(json& j, const EventData& k);
 /// \brief Conversion from a given json object \p j to a given EventData \p k
 void from_json(const json& j, EventData& k);
 
+/// \brief Writes the given EventData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const EventData& k);
+
+/// \brief Reads the given EventData \p k from the given \p reader
+void read_json(JsonReader& reader, EventData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a EventData
+void validate_event_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k);
@@ -676,6 +1024,15 @@ void to_json(json& j, const VariableMonitoring& k);
 /// \brief Conversion from a given json object \p j to a given VariableMonitoring \p k
 void from_json(const json& j, VariableMonitoring& k);
 
+/// \brief Writes the given VariableMonitoring \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableMonitoring& k);
+
+/// \brief Reads the given VariableMonitoring \p k from the given \p reader
+void read_json(JsonReader& reader, VariableMonitoring& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableMonitoring
+void validate_variable_monitoring(JsonValidator& validator);
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k);
@@ -692,6 +1049,15 @@ void to_json(json& j, const MonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given MonitoringData \p k
 void from_json(const json& j, MonitoringData& k);
 
+/// \brief Writes the given MonitoringData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MonitoringData& k);
+
+/// \brief Reads the given MonitoringData \p k from the given \p reader
+void read_json(JsonReader& reader, MonitoringData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a MonitoringData
+void validate_monitoring_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k);
@@ -710,6 +1076,15 @@ void to_json(json& j, const VariableAttribute& k);
 /// \brief Conversion from a given json object \p j to a given VariableAttribute \p k
 void from_json(const json& j, VariableAttribute& k);
 
+/// \brief Writes the given VariableAttribute \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableAttribute& k);
+
+/// \brief Reads the given VariableAttribute \p k from the given \p reader
+void read_json(JsonReader& reader, VariableAttribute& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableAttribute
+void validate_variable_attribute(JsonValidator& validator);
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k);
@@ -729,6 +1104,15 @@ void to_json(json& j, const VariableCharacteristics& k);
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k);
 
+/// \brief Writes the given VariableCharacteristics \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableCharacteristics& k);
+
+/// \brief Reads the given VariableCharacteristics \p k from the given \p reader
+void read_json(JsonReader& reader, VariableCharacteristics& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableCharacteristics
+void validate_variable_characteristics(JsonValidator& validator);
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k);
@@ -746,6 +1130,15 @@ void to_json(json& j, const ReportData& k);
 /// \brief Conversion from a given json object \p j to a given ReportData \p k
 void from_json(const json& j, ReportData& k);
 
+/// \brief Writes the given ReportData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReportData& k);
+
+/// \brief Reads the given ReportData \p k from the given \p reader
+void read_json(JsonReader& reader, ReportData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReportData
+void validate_report_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k);
@@ -768,6 +1161,15 @@ void to_json(json& j, const ChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
+/// \brief Reads the given ChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfile& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfile
+void validate_charging_profile(JsonValidator& validator);
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k);
@@ -783,6 +1185,15 @@ void to_json(json& j, const AuthorizationData& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizationData \p k
 void from_json(const json& j, AuthorizationData& k);
 
+/// \brief Writes the given AuthorizationData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizationData& k);
+
+/// \brief Reads the given AuthorizationData \p k from the given \p reader
+void read_json(JsonReader& reader, AuthorizationData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a AuthorizationData
+void validate_authorization_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k);
@@ -803,6 +1214,15 @@ void to_json(json& j, const APN& k);
 /// \brief Conversion from a given json object \p j to a given APN \p k
 void from_json(const json& j, APN& k);
 
+/// \brief Writes the given APN \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const APN& k);
+
+/// \brief Reads the given APN \p k from the given \p reader
+void read_json(JsonReader& reader, APN& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a APN
+void validate_apn(JsonValidator& validator);
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k);
@@ -822,6 +1242,15 @@ void to_json(json& j, const VPN& k);
 /// \brief Conversion from a given json object \p j to a given VPN \p k
 void from_json(const json& j, VPN& k);
 
+/// \brief Writes the given VPN \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VPN& k);
+
+/// \brief Reads the given VPN \p k from the given \p reader
+void read_json(JsonReader& reader, VPN& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a VPN
+void validate_vpn(JsonValidator& validator);
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k);
@@ -843,6 +1272,15 @@ void to_json(json& j, const NetworkConnectionProfile& k);
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k);
 
+/// \brief Writes the given NetworkConnectionProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k);
+
+/// \brief Reads the given NetworkConnectionProfile \p k from the given \p reader
+void read_json(JsonReader& reader, NetworkConnectionProfile& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a NetworkConnectionProfile
+void validate_network_connection_profile(JsonValidator& validator);
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k);
@@ -863,6 +1301,15 @@ void to_json(json& j, const SetMonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringData \p k
 void from_json(const json& j, SetMonitoringData& k);
 
+/// \brief Writes the given SetMonitoringData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringData& k);
+
+/// \brief Reads the given SetMonitoringData \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringData
+void validate_set_monitoring_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k);
@@ -883,6 +1330,15 @@ void to_json(json& j, const SetMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k);
 
+/// \brief Writes the given SetMonitoringResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringResult& k);
+
+/// \brief Reads the given SetMonitoringResult \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringResult& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringResult
+void validate_set_monitoring_result(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k);
@@ -900,6 +1356,15 @@ void to_json(json& j, const SetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableData \p k
 void from_json(const json& j, SetVariableData& k);
 
+/// \brief Writes the given SetVariableData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableData& k);
+
+/// \brief Reads the given SetVariableData \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableData& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableData
+void validate_set_variable_data(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k);
@@ -918,6 +1383,15 @@ void to_json(json& j, const SetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k);
 
+/// \brief Writes the given SetVariableResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableResult& k);
+
+/// \brief Reads the given SetVariableResult \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableResult& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableResult
+void validate_set_variable_result(JsonValidator& validator);
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k);
@@ -936,6 +1410,15 @@ void to_json(json& j, const Transaction& k);
 /// \brief Conversion from a given json object \p j to a given Transaction \p k
 void from_json(const json& j, Transaction& k);
 
+/// \brief Writes the given Transaction \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Transaction& k);
+
+/// \brief Reads the given Transaction \p k from the given \p reader
+void read_json(JsonReader& reader, Transaction& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Transaction
+void validate_transaction(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k);
@@ -954,6 +1437,15 @@ void to_json(json& j, const Firmware& k);
 /// \brief Conversion from a given json object \p j to a given Firmware \p k
 void from_json(const json& j, Firmware& k);
 
+/// \brief Writes the given Firmware \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Firmware& k);
+
+/// \brief Reads the given Firmware \p k from the given \p reader
+void read_json(JsonReader& reader, Firmware& k);
+
+/// \brief Validates the next value of the given \p validator against the schema of a Firmware
+void validate_firmware(JsonValidator& validator);
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k);
@@ -3,6 +3,8 @@
 #ifndef OCPP_V201_TRANSACTION_HANDLER_HPP
 #define OCPP_V201_TRANSACTION_HANDLER_HPP
 
+#include <atomic>
+
 #include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 
@@ -16,7 +18,7 @@ struct EnhancedTransaction : public Transaction {
     std::optional<IdToken> group_id_token;
     std::optional<int32_t> reservation_id;
     int32_t connector_id;
-    int32_t seq_no = 0;
+    std::atomic<int32_t> seq_no{0}; ///< next sequence number, atomic since it is taken and released by timer threads
     std::optional<float> active_energy_import_start_value;
     bool check_max_active_import_energy;
 
@@ -26,6 +28,9 @@ struct EnhancedTransaction : public Transaction {
     ClockAlignedTimer aligned_tx_ended_meter_values_timer;
 
     int32_t get_seq_no();
+    /// \brief Takes back \p seq_no so that it is returned by the next call of get_seq_no()
+    /// \returns false if \p seq_no is not the last sequence number returned by get_seq_no()
+    bool release_seq_no(const int32_t seq_no);
     Transaction get_transaction();
 };
 } // namespace v201
@@ -5,6 +5,7 @@
 
 #include <ostream>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v201 {
@@ -145,7 +146,7 @@ enum class MessageType {
 namespace conversions {
 /// \brief Converts the given MessageType \p m to std::string
 /// \returns a string representation of the MessageType
-std::string messagetype_to_string(MessageType m);
+std::string_view messagetype_to_string(MessageType m);
 
 /// \brief Converts the given std::string \p s to MessageType
 /// \returns a MessageType from a string representation
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#ifndef OCPP_V201_VARIABLE_MONITORING_ENGINE_HPP
+#define OCPP_V201_VARIABLE_MONITORING_ENGINE_HPP
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <everest/timer.hpp>
+
+#include <ocpp/v201/device_model.hpp>
+#include <ocpp/v201/ocpp_types.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+/// \brief Evaluates the VariableMonitoring(s) of the device model and reports the events they trigger.
+///
+/// Threshold and Delta monitors are evaluated incrementally when the value of the variable they monitor is set in the
+/// DeviceModel, so only writes to monitored variables have any cost. Periodic and PeriodicClockAligned monitors are
+/// reported by a timer that is armed for the next monitor that is due. The resulting events are collected for the
+/// NotifyEventCoalescingInterval and then passed to the send events callback at once. While the charging station is
+/// offline, events of monitors with a severity above the OfflineQueuingSeverity are discarded.
+class VariableMonitoringEngine {
+public:
+    /// \brief Creates a new VariableMonitoringEngine for the monitors of the given \p device_model
+    /// \param device_model
+    /// \param send_events_callback is called with the events that have been collected
+    /// \param is_offline_callback returns true if the charging station is offline
+    /// \param is_transaction_active_callback returns true if a transaction is active on the given EVSE or, if no EVSE
+    /// is given, on any EVSE. Monitors that are only active during transactions are skipped otherwise
+    VariableMonitoringEngine(DeviceModel& device_model,
+                             std::function<void(const std::vector<EventData>& events)> send_events_callback,
+                             std::function<bool()> is_offline_callback,
+                             std::function<bool(const std::optional<EVSE>& evse)> is_transaction_active_callback);
+
+    /// \brief Starts reporting periodic monitors
+    void start();
+
+    /// \brief Stops reporting periodic monitors and sends all events that have been collected
+    void stop();
+
+    /// \brief Evaluates the threshold and delta \p monitors of the given \p component and \p variable, whose Actual
+    /// value has changed from \p previous_value to \p value
+    void on_value_changed(const Component& component, const Variable& variable,
+                          const std::vector<VariableMonitoring>& monitors,
+                          const std::optional<std::string>& previous_value, const std::string& value);
+
+    /// \brief Sends all events that have been collected
+    void flush_events();
+
+private:
+    /// \brief Evaluation state of a threshold or delta monitor
+    struct MonitorState {
+        /// true if the threshold of the monitor is currently exceeded
+        bool threshold_exceeded = false;
+        /// value the next delta is measured from, the value of the last event or the first value that has been seen
+        std::optional<std::string> reference_value;
+    };
+
+    /// \brief A periodic monitor together with the variable it reports
+    struct PeriodicMonitor {
+        Component component;
+        Variable variable;
+        VariableMonitoring monitor;
+    };
+
+    /// \brief An event that has not been sent yet, together with the severity of the monitor that triggered it
+    struct PendingEvent {
+        EventData event_data;
+        int32_t severity;
+    };
+
+    DeviceModel& device_model;
+    std::function<void(const std::vector<EventData>& events)> send_events_callback;
+    std::function<bool()> is_offline_callback;
+    std::function<bool(const std::optional<EVSE>& evse)> is_transaction_active_callback;
+
+    // guards everything below
+    std::mutex mutex;
+    /// state of the threshold and delta monitors, by monitor id
+    std::map<int32_t, MonitorState> monitor_states;
+    std::vector<PeriodicMonitor> periodic_monitors;
+    /// indices into periodic_monitors ordered by the time they are due next
+    std::multimap<std::chrono::steady_clock::time_point, size_t> periodic_schedule;
+    std::vector<PendingEvent> pending_events;
+    bool flush_scheduled;
+    int32_t next_event_id;
+
+    Everest::SteadyTimer periodic_timer;
+    Everest::SteadyTimer flush_timer;
+
+    /// \brief Returns false if monitoring is disabled by the MonitoringCtrlr
+    bool is_monitoring_enabled();
+
+    /// \brief Creates an event for the given \p monitor . Its eventId is assigned when it is queued
+    EventData create_event(const Component& component, const Variable& variable, const VariableMonitoring& monitor,
+                           const EventTriggerEnum trigger, const std::string& value,
+                           const std::optional<bool>& cleared);
+
+    /// \brief Evaluates a single threshold or delta \p monitor and adds the event it triggers to \p events
+    void evaluate_monitor(const Component& component, const Variable& variable, const VariableMonitoring& monitor,
+                          const std::optional<std::string>& previous_value, const std::string& value,
+                          std::vector<PendingEvent>& events);
+
+    /// \brief Adds the periodic monitor with the given \p index to the schedule
+    void schedule_periodic_monitor(const size_t index, const std::chrono::steady_clock::time_point now);
+
+    /// \brief Arms the periodic timer for the next monitor that is due
+    void arm_periodic_timer();
+
+    /// \brief Reports all periodic monitors that are due
+    void handle_periodic_monitors();
+
+    /// \brief Assigns eventIds to \p events , adds them to the pending events and sends them once the coalescing
+    /// interval has elapsed
+    void queue_events(std::vector<PendingEvent>&& events);
+};
+
+} // namespace v201
+} // namespace ocpp
+
+#endif // OCPP_V201_VARIABLE_MONITORING_ENGINE_HPP
@@ -6,7 +6,7 @@
 namespace ocpp {
 
 bool operator<(const MessageId& lhs, const MessageId& rhs) {
-    return lhs.get() < rhs.get();
+    return lhs.view() < rhs.view();
 }
 
 void to_json(json& j, const MessageId& k) {
@@ -17,4 +17,13 @@ void from_json(const json& j, MessageId& k) {
     k.set(j);
 }
 
+void write_json(JsonWriter& writer, const MessageId& k) {
+    writer.value(k.view());
+}
+
+void read_json(JsonReader& reader, MessageId& k) {
+    std::string buffer;
+    k.set(reader.read_string_view(buffer));
+}
+
 } // namespace ocpp
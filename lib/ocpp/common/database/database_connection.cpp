@@ -10,6 +10,9 @@ using namespace std::string_literals;
 
 namespace ocpp::common {
 
+/// \brief Time a statement waits for a lock held by another connection to the same database file
+constexpr int DATABASE_BUSY_TIMEOUT_MS = 5000;
+
 class DatabaseTransaction : public DatabaseTransactionInterface {
 private:
     DatabaseConnection& database;
@@ -44,8 +47,29 @@ public:
     }
 };
 
-DatabaseConnection::DatabaseConnection(const fs::path& database_file_path) noexcept :
-    db(nullptr), database_file_path(database_file_path), open_count(0) {
+struct DatabaseConnection::StatementCache {
+    /// \brief The most recently used statement is at the front of the list, the least recently used one is finalized
+    /// if the cache is full
+    using List = std::list<std::pair<std::string, sqlite3_stmt*>>;
+    List statements;
+    /// \brief Statements of \ref statements keyed by their SQL text
+    std::unordered_map<std::string, List::iterator> index;
+    const size_t size;
+    StatementCacheStatistics statistics;
+    /// \brief Incremented whenever the connection is closed, so statements prepared before are not put back into the
+    /// cache
+    uint64_t connection_generation = 0;
+    std::mutex mutex;
+
+    explicit StatementCache(const size_t size) : size(size) {
+    }
+};
+
+DatabaseConnection::DatabaseConnection(const fs::path& database_file_path, const size_t statement_cache_size) noexcept :
+    db(nullptr),
+    database_file_path(database_file_path),
+    open_count(0),
+    statement_cache(std::make_shared<StatementCache>(statement_cache_size)) {
 }
 
 DatabaseConnection::~DatabaseConnection() {
@@ -71,6 +95,8 @@ bool DatabaseConnection::open_connection() {
         EVLOG_error << "Error opening database at " << this->database_file_path << ": " << sqlite3_errmsg(db);
         return false;
     }
+    // other connections to the same file hold locks while they write
+    sqlite3_busy_timeout(this->db, DATABASE_BUSY_TIMEOUT_MS);
     EVLOG_info << "Established connection to database: " << this->database_file_path;
     return true;
 }
@@ -90,6 +116,14 @@ bool DatabaseConnection::close_connection_internal(bool force_close) {
         return true;
     }
 
+    {
+        // cached statements are finalized below together with all others
+        std::lock_guard<std::mutex> lk(this->statement_cache->mutex);
+        this->statement_cache->statements.clear();
+        this->statement_cache->index.clear();
+        this->statement_cache->connection_generation++;
+    }
+
     // forcefully finalize all statements before calling sqlite3_close
     sqlite3_stmt* stmt = nullptr;
     while ((stmt = sqlite3_next_stmt(db, stmt)) != nullptr) {
@@ -124,7 +158,73 @@ std::unique_ptr<DatabaseTransactionInterface> DatabaseConnection::begin_transact
 }
 
 std::unique_ptr<SQLiteStatementInterface> DatabaseConnection::new_statement(const std::string& sql) {
-    return std::make_unique<SQLiteStatement>(this->db, sql);
+    auto& cache = *this->statement_cache;
+    if (cache.size == 0) {
+        return std::make_unique<SQLiteStatement>(this->db, sql);
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lk(cache.mutex);
+        generation = cache.connection_generation;
+        const auto it = cache.index.find(sql);
+        if (it != cache.index.end()) {
+            // hand out the cached statement, it is not available to other users until it is released
+            stmt = it->second->second;
+            cache.statements.erase(it->second);
+            cache.index.erase(it);
+            cache.statistics.hits++;
+        } else {
+            cache.statistics.misses++;
+        }
+    }
+
+    if (stmt == nullptr && sqlite3_prepare_v2(this->db, sql.c_str(), sql.size(), &stmt, nullptr) != SQLITE_OK) {
+        EVLOG_error << sqlite3_errmsg(this->db);
+        throw QueryExecutionException("Could not prepare statement for database.");
+    }
+
+    std::weak_ptr<StatementCache> weak_cache = this->statement_cache;
+    return std::make_unique<SQLiteStatement>(this->db, stmt, [weak_cache, sql, generation](sqlite3_stmt* stmt) {
+        if (const auto cache = weak_cache.lock()) {
+            release_statement(*cache, sql, stmt, generation);
+        }
+        // otherwise the connection is gone and closing it has already finalized the statement
+    });
+}
+
+void DatabaseConnection::release_statement(StatementCache& cache, const std::string& sql, sqlite3_stmt* stmt,
+                                           uint64_t generation) {
+    std::lock_guard<std::mutex> lk(cache.mutex);
+    if (generation != cache.connection_generation) {
+        // connection was closed in the meantime, which already finalized the statement
+        return;
+    }
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    if (cache.index.count(sql) != 0) {
+        // an identical statement was released before, no need to keep both
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    cache.statements.emplace_front(sql, stmt);
+    cache.index[sql] = cache.statements.begin();
+
+    if (cache.statements.size() > cache.size) {
+        const auto& [lru_sql, lru_stmt] = cache.statements.back();
+        sqlite3_finalize(lru_stmt);
+        cache.index.erase(lru_sql);
+        cache.statements.pop_back();
+    }
+}
+
+StatementCacheStatistics DatabaseConnection::get_statement_cache_statistics() {
+    std::lock_guard<std::mutex> lk(this->statement_cache->mutex);
+    return this->statement_cache->statistics;
 }
 
 bool DatabaseConnection::clear_table(const std::string& table) {
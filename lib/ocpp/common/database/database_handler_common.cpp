@@ -3,15 +3,20 @@
 
 #include <ocpp/common/database/database_handler_common.hpp>
 
+#include <algorithm>
+#include <limits>
+
 #include <everest/logging.hpp>
 #include <ocpp/common/database/database_schema_updater.hpp>
+#include <ocpp/common/database/json_encoding.hpp>
 
 namespace ocpp::common {
 
-DatabaseHandlerCommon::DatabaseHandlerCommon(std::unique_ptr<DatabaseConnectionInterface> database,
-                                             const fs::path& sql_migration_files_path,
-                                             uint32_t target_schema_version) noexcept :
+DatabaseHandlerCommon::DatabaseHandlerCommon(
+    std::unique_ptr<DatabaseConnectionInterface> database, const fs::path& sql_migration_files_path,
+    uint32_t target_schema_version, std::unique_ptr<DatabaseConnectionInterface> transaction_queue_database) noexcept :
     database(std::move(database)),
+    transaction_queue_database(std::move(transaction_queue_database)),
     sql_migration_files_path(sql_migration_files_path),
     target_schema_version(target_schema_version) {
 }
@@ -27,31 +32,50 @@ void DatabaseHandlerCommon::open_connection() {
         throw DatabaseConnectionException("Could not open database at provided path.");
     }
 
+    if (this->transaction_queue_database != nullptr and !this->transaction_queue_database->open_connection()) {
+        throw DatabaseConnectionException("Could not open transaction queue connection to database at provided path.");
+    }
+
     this->init_sql();
+
+    // messages that have been persisted before binary encodings were added, they can still be read if this fails
+    try {
+        const auto converted =
+            convert_json_text_documents(*this->database, "TRANSACTION_QUEUE", "MESSAGE", "MESSAGE_ENCODING");
+        if (converted > 0) {
+            EVLOG_info << "Converted " << converted << " queued transaction messages to binary encoding";
+        }
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Could not convert queued transaction messages to binary encoding: " << e.what();
+    }
 }
 
 void DatabaseHandlerCommon::close_connection() {
+    if (this->transaction_queue_database != nullptr) {
+        this->transaction_queue_database->close_connection();
+    }
     this->database->close_connection();
 }
 
-std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_transaction_messages() {
-    std::vector<DBTransactionMessage> transaction_messages;
-
-    std::string sql =
-        "SELECT UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP FROM TRANSACTION_QUEUE";
+DatabaseConnectionInterface& DatabaseHandlerCommon::get_transaction_queue_database() {
+    if (this->transaction_queue_database != nullptr) {
+        return *this->transaction_queue_database;
+    }
+    return *this->database;
+}
 
-    auto stmt = this->database->new_statement(sql);
+std::vector<DBTransactionMessage> DatabaseHandlerCommon::read_transaction_messages(SQLiteStatementInterface& stmt) {
+    std::vector<DBTransactionMessage> transaction_messages;
 
     int status;
-    while ((status = stmt->step()) == SQLITE_ROW) {
+    while ((status = stmt.step()) == SQLITE_ROW) {
         try {
-            const std::string message = stmt->column_text(1);
-            const std::string unique_id = stmt->column_text(0);
-            const std::string message_type = stmt->column_text(2);
-            const std::string message_timestamp = stmt->column_text(4);
-            const int message_attempts = stmt->column_int(3);
+            const std::string unique_id = stmt.column_text(0);
+            const std::string message_type = stmt.column_text(2);
+            const std::string message_timestamp = stmt.column_text(4);
+            const int message_attempts = stmt.column_int(3);
 
-            json json_message = json::parse(message);
+            json json_message = column_json(stmt, 1, 6);
 
             DBTransactionMessage control_message;
             control_message.message_attempts = message_attempts;
@@ -59,6 +83,7 @@ std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_transaction_message
             control_message.message_type = message_type;
             control_message.unique_id = unique_id;
             control_message.json_message = json_message;
+            control_message.sequence = stmt.column_int64(5);
             transaction_messages.push_back(std::move(control_message));
         } catch (const json::exception& e) {
             EVLOG_error << "json parse failed because: "
@@ -77,41 +102,131 @@ std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_transaction_message
     return transaction_messages;
 }
 
+std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_transaction_messages() {
+    std::string sql = "SELECT UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP, ROWID, "
+                      "MESSAGE_ENCODING FROM TRANSACTION_QUEUE ORDER BY ROWID";
+
+    auto stmt = this->database->new_statement(sql);
+    return this->read_transaction_messages(*stmt);
+}
+
+std::vector<DBTransactionMessage>
+DatabaseHandlerCommon::get_transaction_messages(int64_t after_sequence, int64_t until_sequence, size_t limit) {
+    // inserted rows get a ROWID larger than that of all rows in the table, so it reflects the order of insertion
+    std::string sql = "SELECT UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP, ROWID, "
+                      "MESSAGE_ENCODING FROM TRANSACTION_QUEUE WHERE ROWID > @after_sequence AND "
+                      "ROWID <= @until_sequence ORDER BY ROWID LIMIT @limit";
+
+    auto stmt = this->database->new_statement(sql);
+    stmt->bind_int64("@after_sequence", after_sequence);
+    stmt->bind_int64("@until_sequence", until_sequence);
+    stmt->bind_int64("@limit", static_cast<int64_t>(std::min<size_t>(limit, std::numeric_limits<int64_t>::max())));
+    return this->read_transaction_messages(*stmt);
+}
+
+std::vector<DBTransactionMessageCounts> DatabaseHandlerCommon::get_transaction_message_counts(int64_t until_sequence) {
+    std::string sql = "SELECT TRANSACTION_ID, COUNT(*), SUM(TRANSACTION_MESSAGE_KIND = @update_kind), "
+                      "SUM(TRANSACTION_MESSAGE_KIND = @end_kind) FROM TRANSACTION_QUEUE WHERE TRANSACTION_ID IS NOT "
+                      "NULL AND ROWID <= @until_sequence GROUP BY TRANSACTION_ID";
+
+    auto stmt = this->database->new_statement(sql);
+    stmt->bind_int("@update_kind", static_cast<int>(TransactionMessageKind::Update));
+    stmt->bind_int("@end_kind", static_cast<int>(TransactionMessageKind::End));
+    stmt->bind_int64("@until_sequence", until_sequence);
+
+    std::vector<DBTransactionMessageCounts> counts;
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        DBTransactionMessageCounts transaction_counts;
+        transaction_counts.transaction_id = stmt->column_text(0);
+        transaction_counts.messages = static_cast<size_t>(stmt->column_int64(1));
+        transaction_counts.update_messages = static_cast<size_t>(stmt->column_int64(2));
+        transaction_counts.end_messages = static_cast<size_t>(stmt->column_int64(3));
+        counts.push_back(std::move(transaction_counts));
+    }
+
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    return counts;
+}
+
+int64_t DatabaseHandlerCommon::get_last_transaction_message_sequence() {
+    auto stmt = this->database->new_statement("SELECT IFNULL(MAX(ROWID), 0) FROM TRANSACTION_QUEUE");
+
+    if (stmt->step() != SQLITE_ROW) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    return stmt->column_int64(0);
+}
+
 void DatabaseHandlerCommon::insert_transaction_message(const DBTransactionMessage& transaction_message) {
     const std::string sql =
-        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP) VALUES "
-        "(@unique_id, @message, @message_type, @message_attempts, @message_timestamp)";
+        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_ENCODING, MESSAGE_TYPE, MESSAGE_ATTEMPTS, "
+        "MESSAGE_TIMESTAMP, TRANSACTION_ID, TRANSACTION_MESSAGE_KIND) VALUES (@unique_id, @message, "
+        "@message_encoding, @message_type, @message_attempts, @message_timestamp, @transaction_id, "
+        "@transaction_message_kind) ON CONFLICT(UNIQUE_ID) DO UPDATE SET MESSAGE = excluded.MESSAGE, "
+        "MESSAGE_ENCODING = excluded.MESSAGE_ENCODING, MESSAGE_TYPE = excluded.MESSAGE_TYPE, "
+        "MESSAGE_ATTEMPTS = excluded.MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP = excluded.MESSAGE_TIMESTAMP, "
+        "TRANSACTION_ID = excluded.TRANSACTION_ID, TRANSACTION_MESSAGE_KIND = excluded.TRANSACTION_MESSAGE_KIND";
 
-    auto stmt = this->database->new_statement(sql);
+    auto& database = this->get_transaction_queue_database();
+    auto stmt = database.new_statement(sql);
 
-    const std::string message = transaction_message.json_message.dump();
     stmt->bind_text("@unique_id", transaction_message.unique_id);
-    stmt->bind_text("@message", message);
+    bind_json(*stmt, "@message", "@message_encoding", transaction_message.json_message);
     stmt->bind_text("@message_type", transaction_message.message_type);
     stmt->bind_int("@message_attempts", transaction_message.message_attempts);
     stmt->bind_text("@message_timestamp", transaction_message.timestamp.to_rfc3339(), SQLiteString::Transient);
+    if (transaction_message.transaction_id.has_value()) {
+        stmt->bind_text("@transaction_id", transaction_message.transaction_id.value());
+    } else {
+        stmt->bind_null("@transaction_id");
+    }
+    stmt->bind_int("@transaction_message_kind", static_cast<int>(transaction_message.kind));
 
     if (stmt->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
+        throw QueryExecutionException(database.get_error_message());
     }
 }
 
 void DatabaseHandlerCommon::remove_transaction_message(const std::string& unique_id) {
     std::string sql = "DELETE FROM TRANSACTION_QUEUE WHERE UNIQUE_ID = @unique_id";
 
-    auto stmt = this->database->new_statement(sql);
+    auto& database = this->get_transaction_queue_database();
+    auto stmt = database.new_statement(sql);
 
     stmt->bind_text("@unique_id", unique_id);
 
     if (stmt->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
+        throw QueryExecutionException(database.get_error_message());
+    }
+}
+
+void DatabaseHandlerCommon::update_transaction_messages(const std::vector<DBTransactionMessage>& inserted_messages,
+                                                        const std::vector<std::string>& removed_unique_ids) {
+    if (inserted_messages.empty() && removed_unique_ids.empty()) {
+        return;
     }
+
+    auto transaction = this->get_transaction_queue_database().begin_transaction();
+
+    for (const auto& unique_id : removed_unique_ids) {
+        this->remove_transaction_message(unique_id);
+    }
+
+    for (const auto& transaction_message : inserted_messages) {
+        this->insert_transaction_message(transaction_message);
+    }
+
+    transaction->commit();
 }
 
 void DatabaseHandlerCommon::clear_transaction_queue() {
-    const auto retval = this->database->clear_table("TRANSACTION_QUEUE");
+    auto& database = this->get_transaction_queue_database();
+    const auto retval = database.clear_table("TRANSACTION_QUEUE");
     if (retval == false) {
-        throw QueryExecutionException(this->database->get_error_message());
+        throw QueryExecutionException(database.get_error_message());
     }
 }
 
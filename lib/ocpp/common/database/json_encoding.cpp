@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/database/json_encoding.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <everest/logging.hpp>
+#include <ocpp/common/database/database_handler_common.hpp>
+
+namespace ocpp::common {
+
+void bind_json(SQLiteStatementInterface& stmt, const std::string& document_param, const std::string& encoding_param,
+               const json& document) {
+    stmt.bind_blob(document_param, json::to_cbor(document));
+    stmt.bind_int(encoding_param, static_cast<int>(CURRENT_JSON_ENCODING));
+}
+
+json column_json(SQLiteStatementInterface& stmt, int document_column, int encoding_column) {
+    const auto encoding = stmt.column_int(encoding_column);
+    switch (static_cast<JsonEncoding>(encoding)) {
+    case JsonEncoding::Text:
+        return json::parse(stmt.column_text(document_column));
+    case JsonEncoding::CborV1:
+        return json::from_cbor(stmt.column_blob(document_column));
+    }
+    throw DatabaseException("Unknown encoding of persisted json document: " + std::to_string(encoding));
+}
+
+size_t convert_json_text_documents(DatabaseConnectionInterface& database, const std::string& table,
+                                   const std::string& document_column, const std::string& encoding_column) {
+    auto transaction = database.begin_transaction();
+
+    // the rows are read before they are updated, since updating a table while it is read is not well-defined
+    std::vector<std::pair<int64_t, std::string>> documents;
+    {
+        const auto select_stmt = database.new_statement("SELECT ROWID, " + document_column + " FROM " + table +
+                                                        " WHERE " + encoding_column + " = " +
+                                                        std::to_string(static_cast<int>(JsonEncoding::Text)));
+        int status;
+        while ((status = select_stmt->step()) == SQLITE_ROW) {
+            documents.emplace_back(select_stmt->column_int64(0), select_stmt->column_text(1));
+        }
+        if (status != SQLITE_DONE) {
+            throw QueryExecutionException(database.get_error_message());
+        }
+    }
+
+    const auto update_stmt = database.new_statement("UPDATE " + table + " SET " + document_column + " = @document, " +
+                                                    encoding_column + " = @encoding WHERE ROWID = @rowid");
+    size_t converted = 0;
+    for (const auto& [rowid, text] : documents) {
+        json document;
+        try {
+            document = json::parse(text);
+        } catch (const json::exception& e) {
+            EVLOG_warning << "Could not convert document in " << table << " because it can not be parsed: "
+                          << e.what();
+            continue;
+        }
+
+        // updating the row in place keeps its ROWID and with it the order of insertion
+        bind_json(*update_stmt, "@document", "@encoding", document);
+        update_stmt->bind_int64("@rowid", rowid);
+        if (update_stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(database.get_error_message());
+        }
+        update_stmt->reset();
+        converted++;
+    }
+
+    transaction->commit();
+    return converted;
+}
+
+} // namespace ocpp::common
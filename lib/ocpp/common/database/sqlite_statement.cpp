@@ -7,15 +7,21 @@
 
 namespace ocpp::common {
 
-SQLiteStatement::SQLiteStatement(sqlite3* db, const std::string& query) : db(db), stmt(nullptr) {
+SQLiteStatement::SQLiteStatement(sqlite3* db, const std::string& query) : stmt(nullptr), db(db) {
     if (sqlite3_prepare_v2(db, query.c_str(), query.size(), &this->stmt, nullptr) != SQLITE_OK) {
         EVLOG_error << sqlite3_errmsg(db);
         throw QueryExecutionException("Could not prepare statement for database.");
     }
 }
 
+SQLiteStatement::SQLiteStatement(sqlite3* db, sqlite3_stmt* stmt, std::function<void(sqlite3_stmt*)> release) :
+    stmt(stmt), db(db), release(std::move(release)) {
+}
+
 SQLiteStatement::~SQLiteStatement() {
-    if (this->stmt != nullptr) {
+    if (this->release != nullptr) {
+        this->release(this->stmt);
+    } else if (this->stmt != nullptr) {
         if (sqlite3_finalize(this->stmt) != SQLITE_OK) {
             EVLOG_error << "Error finalizing statement: " << sqlite3_errmsg(this->db);
         }
@@ -55,6 +61,18 @@ int SQLiteStatement::bind_int(const std::string& param, const int val) {
     return bind_int(index, val);
 }
 
+int SQLiteStatement::bind_int64(const int idx, const int64_t val) {
+    return sqlite3_bind_int64(this->stmt, idx, val);
+}
+
+int SQLiteStatement::bind_int64(const std::string& param, const int64_t val) {
+    int index = sqlite3_bind_parameter_index(this->stmt, param.c_str());
+    if (index <= 0) {
+        throw std::out_of_range("Parameter not found in SQL query");
+    }
+    return bind_int64(index, val);
+}
+
 int SQLiteStatement::bind_datetime(const int idx, const ocpp::DateTime val) {
     return sqlite3_bind_int64(
         this->stmt, idx,
@@ -93,6 +111,18 @@ int SQLiteStatement::bind_null(const std::string& param) {
     return bind_null(index);
 }
 
+int SQLiteStatement::bind_blob(const int idx, const std::vector<uint8_t>& val) {
+    return sqlite3_bind_blob(this->stmt, idx, val.data(), static_cast<int>(val.size()), SQLITE_TRANSIENT);
+}
+
+int SQLiteStatement::bind_blob(const std::string& param, const std::vector<uint8_t>& val) {
+    int index = sqlite3_bind_parameter_index(this->stmt, param.c_str());
+    if (index <= 0) {
+        throw std::out_of_range("Parameter not found in SQL query");
+    }
+    return bind_blob(index, val);
+}
+
 int SQLiteStatement::column_type(const int idx) {
     return sqlite3_column_type(this->stmt, idx);
 }
@@ -114,6 +144,10 @@ int SQLiteStatement::column_int(const int idx) {
     return sqlite3_column_int(this->stmt, idx);
 }
 
+int64_t SQLiteStatement::column_int64(const int idx) {
+    return sqlite3_column_int64(this->stmt, idx);
+}
+
 ocpp::DateTime SQLiteStatement::column_datetime(const int idx) {
     int64_t time = sqlite3_column_int64(this->stmt, idx);
     return DateTime(date::utc_clock::time_point(std::chrono::milliseconds(time)));
@@ -123,4 +157,12 @@ double SQLiteStatement::column_double(const int idx) {
     return sqlite3_column_double(this->stmt, idx);
 }
 
+std::vector<uint8_t> SQLiteStatement::column_blob(const int idx) {
+    const auto data = static_cast<const uint8_t*>(sqlite3_column_blob(this->stmt, idx));
+    if (data == nullptr) {
+        return {};
+    }
+    return std::vector<uint8_t>(data, data + sqlite3_column_bytes(this->stmt, idx));
+}
+
 } // namespace ocpp::common
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/database/transaction_queue_writer.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <everest/logging.hpp>
+
+namespace ocpp::common {
+
+TransactionQueueWriter::TransactionQueueWriter(std::shared_ptr<DatabaseHandlerCommon> database_handler,
+                                               std::chrono::milliseconds commit_interval, size_t batch_size) :
+    database_handler(std::move(database_handler)),
+    commit_interval(std::max(commit_interval, std::chrono::milliseconds(0))),
+    batch_size(std::max(batch_size, size_t{1})) {
+    if (this->commit_interval.count() > 0) {
+        this->worker_thread = std::thread([this]() { this->run(); });
+    }
+}
+
+TransactionQueueWriter::~TransactionQueueWriter() {
+    if (!this->worker_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lk(this->write_mutex);
+        this->running = false;
+    }
+    this->staged_cv.notify_one();
+    this->worker_thread.join();
+}
+
+void TransactionQueueWriter::insert(const DBTransactionMessage& transaction_message) {
+    if (!this->worker_thread.joinable()) {
+        try {
+            this->database_handler->insert_transaction_message(transaction_message);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(this->write_mutex);
+        this->staged_inserts.push_back({transaction_message, false});
+        this->staged_sequence++;
+    }
+    this->staged_cv.notify_one();
+}
+
+void TransactionQueueWriter::remove(const std::string& unique_id) {
+    if (!this->worker_thread.joinable()) {
+        try {
+            this->database_handler->remove_transaction_message(unique_id);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(this->write_mutex);
+        this->stage_removal(unique_id);
+        this->staged_sequence++;
+    }
+    this->staged_cv.notify_one();
+}
+
+void TransactionQueueWriter::replace(const std::vector<std::string>& unique_ids,
+                                     const DBTransactionMessage& transaction_message) {
+    // the replacing message is updated in place, so it keeps its position in the order of insertion
+    std::vector<std::string> removed_unique_ids;
+    std::copy_if(unique_ids.begin(), unique_ids.end(), std::back_inserter(removed_unique_ids),
+                 [&transaction_message](const std::string& unique_id) {
+                     return unique_id != transaction_message.unique_id;
+                 });
+
+    if (!this->worker_thread.joinable()) {
+        try {
+            this->database_handler->update_transaction_messages({transaction_message}, removed_unique_ids);
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not replace messages in transaction queue: " << e.what();
+        }
+        return;
+    }
+
+    {
+        // staged together, so they are taken by the same commit
+        std::lock_guard<std::mutex> lk(this->write_mutex);
+        for (const auto& unique_id : removed_unique_ids) {
+            this->stage_removal(unique_id);
+        }
+        const auto staged = std::find_if(this->staged_inserts.begin(), this->staged_inserts.end(),
+                                         [&transaction_message](const StagedInsert& staged_insert) {
+                                             return staged_insert.transaction_message.unique_id ==
+                                                    transaction_message.unique_id;
+                                         });
+        if (staged != this->staged_inserts.end()) {
+            staged->transaction_message = transaction_message;
+        } else {
+            // the replaced message is not staged anymore, so its row has already been handed over to the database
+            this->staged_inserts.push_back({transaction_message, true});
+        }
+        this->staged_sequence++;
+    }
+    this->staged_cv.notify_one();
+}
+
+void TransactionQueueWriter::stage_removal(const std::string& unique_id) {
+    // a message that is removed before its insertion has been committed never needs to reach the database
+    const auto it = std::find_if(this->staged_inserts.begin(), this->staged_inserts.end(),
+                                 [&unique_id](const StagedInsert& staged_insert) {
+                                     return staged_insert.transaction_message.unique_id == unique_id;
+                                 });
+    if (it == this->staged_inserts.end()) {
+        this->staged_removals.push_back(unique_id);
+        return;
+    }
+    const auto updates_committed_row = it->updates_committed_row;
+    this->staged_inserts.erase(it);
+    if (updates_committed_row) {
+        this->staged_removals.push_back(unique_id);
+    }
+}
+
+void TransactionQueueWriter::flush() {
+    if (!this->worker_thread.joinable()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lk(this->write_mutex);
+    const auto sequence = this->staged_sequence;
+    if (this->committed_sequence >= sequence) {
+        return;
+    }
+    this->flush_requested = true;
+    this->staged_cv.notify_one();
+    this->committed_cv.wait(lk, [this, sequence]() { return this->committed_sequence >= sequence; });
+}
+
+void TransactionQueueWriter::run() {
+    std::unique_lock<std::mutex> lk(this->write_mutex);
+    while (true) {
+        this->staged_cv.wait(lk,
+                             [this]() { return !this->running || this->staged_sequence != this->taken_sequence; });
+        if (this->staged_sequence == this->taken_sequence) {
+            // stopped and nothing left to commit
+            break;
+        }
+
+        // give further changes the chance to join this commit
+        this->staged_cv.wait_for(lk, this->commit_interval, [this]() {
+            return !this->running || this->flush_requested ||
+                   this->staged_inserts.size() + this->staged_removals.size() >= this->batch_size;
+        });
+
+        this->commit_staged(lk);
+    }
+}
+
+void TransactionQueueWriter::commit_staged(std::unique_lock<std::mutex>& lk) {
+    std::vector<DBTransactionMessage> inserts;
+    inserts.reserve(this->staged_inserts.size());
+    for (auto& staged_insert : this->staged_inserts) {
+        inserts.push_back(std::move(staged_insert.transaction_message));
+    }
+    this->staged_inserts.clear();
+    std::vector<std::string> removals;
+    removals.swap(this->staged_removals);
+    const auto sequence = this->staged_sequence;
+    this->taken_sequence = sequence;
+    this->flush_requested = false;
+
+    lk.unlock();
+    try {
+        this->database_handler->update_transaction_messages(inserts, removals);
+    } catch (const std::exception& e) {
+        // the batch has been rolled back, so a single broken change must not cost us the others
+        EVLOG_warning << "Could not commit changes of transaction queue, applying them one by one: " << e.what();
+        for (const auto& unique_id : removals) {
+            try {
+                this->database_handler->remove_transaction_message(unique_id);
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+            }
+        }
+        for (const auto& transaction_message : inserts) {
+            try {
+                this->database_handler->insert_transaction_message(transaction_message);
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
+            }
+        }
+    }
+    lk.lock();
+
+    this->committed_sequence = sequence;
+    this->committed_cv.notify_all();
+}
+
+} // namespace ocpp::common
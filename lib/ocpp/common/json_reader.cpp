@@ -0,0 +1,354 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <charconv>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/json_reader.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+namespace {
+bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+void append_utf8(std::string& buffer, uint32_t code_point) {
+    if (code_point < 0x80) {
+        buffer.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        buffer.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        buffer.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        buffer.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        buffer.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        buffer.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        buffer.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        buffer.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        buffer.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        buffer.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+bool is_integer_text(std::string_view text) {
+    return text.find_first_of(".eE") == std::string_view::npos;
+}
+
+template <typename T> bool parse_integer(std::string_view text, T& number) {
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), number);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+double parse_floating_point(std::string_view text) {
+    double number = 0;
+    std::from_chars(text.data(), text.data() + text.size(), number);
+    return number;
+}
+
+/// \brief Converts the number \p text like nlohmann::json converts a number to an arithmetic type
+template <typename T> T number_from_text(std::string_view text) {
+    if (is_integer_text(text)) {
+        int64_t integer;
+        if (parse_integer(text, integer)) {
+            return static_cast<T>(integer);
+        }
+        uint64_t unsigned_integer;
+        if (parse_integer(text, unsigned_integer)) {
+            return static_cast<T>(unsigned_integer);
+        }
+    }
+    return static_cast<T>(parse_floating_point(text));
+}
+} // namespace
+
+JsonReader::JsonReader(std::string_view input) : input(input) {
+}
+
+void JsonReader::throw_parse_error(const std::string& message) const {
+    throw nlohmann::json::parse_error::create(101, this->pos + 1,
+                                              "syntax error while parsing value - " + message + " at position " +
+                                                  std::to_string(this->pos),
+                                              nullptr);
+}
+
+void JsonReader::throw_type_error(const char* expected) const {
+    throw nlohmann::json::type_error::create(
+        302, std::string("type must be ") + expected + " at position " + std::to_string(this->pos), nullptr);
+}
+
+void JsonReader::skip_whitespace() {
+    while (this->pos < this->input.size()) {
+        const auto c = this->input[this->pos];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            return;
+        }
+        this->pos++;
+    }
+}
+
+char JsonReader::peek() {
+    this->skip_whitespace();
+    if (this->pos >= this->input.size()) {
+        this->throw_parse_error("unexpected end of input");
+    }
+    return this->input[this->pos];
+}
+
+void JsonReader::expect(char c) {
+    if (this->peek() != c) {
+        this->throw_parse_error(std::string("expected '") + c + "'");
+    }
+    this->pos++;
+}
+
+bool JsonReader::consume(char c) {
+    if (this->peek() != c) {
+        return false;
+    }
+    this->pos++;
+    return true;
+}
+
+bool JsonReader::consume_literal(std::string_view literal) {
+    this->skip_whitespace();
+    if (this->input.substr(this->pos, literal.size()) != literal) {
+        return false;
+    }
+    this->pos += literal.size();
+    return true;
+}
+
+std::string_view JsonReader::read_string_view(std::string& buffer) {
+    if (this->peek() != '"') {
+        this->throw_type_error("string");
+    }
+    const auto begin = ++this->pos;
+    // fast path: strings without escape sequences are referenced directly
+    while (this->pos < this->input.size()) {
+        const auto c = this->input[this->pos];
+        if (c == '"') {
+            return this->input.substr(begin, this->pos++ - begin);
+        }
+        if (c == '\\') {
+            break;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            this->throw_parse_error("control character in string");
+        }
+        this->pos++;
+    }
+
+    buffer.assign(this->input.data() + begin, this->pos - begin);
+    while (this->pos < this->input.size()) {
+        const auto c = this->input[this->pos++];
+        if (c == '"') {
+            return buffer;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            this->throw_parse_error("control character in string");
+        }
+        if (c != '\\') {
+            buffer.push_back(c);
+            continue;
+        }
+        if (this->pos >= this->input.size()) {
+            break;
+        }
+        switch (this->input[this->pos++]) {
+        case '"':
+            buffer.push_back('"');
+            break;
+        case '\\':
+            buffer.push_back('\\');
+            break;
+        case '/':
+            buffer.push_back('/');
+            break;
+        case 'b':
+            buffer.push_back('\b');
+            break;
+        case 'f':
+            buffer.push_back('\f');
+            break;
+        case 'n':
+            buffer.push_back('\n');
+            break;
+        case 'r':
+            buffer.push_back('\r');
+            break;
+        case 't':
+            buffer.push_back('\t');
+            break;
+        case 'u': {
+            const auto read_code_unit = [this]() {
+                uint32_t code_unit = 0;
+                for (int i = 0; i < 4; i++) {
+                    const auto value = this->pos < this->input.size() ? hex_value(this->input[this->pos++]) : -1;
+                    if (value < 0) {
+                        this->throw_parse_error("invalid \\u escape sequence");
+                    }
+                    code_unit = (code_unit << 4) | static_cast<uint32_t>(value);
+                }
+                return code_unit;
+            };
+            auto code_point = read_code_unit();
+            if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+                if (!this->consume_literal("\\u")) {
+                    this->throw_parse_error("missing low surrogate");
+                }
+                const auto low = read_code_unit();
+                if (low < 0xDC00 || low > 0xDFFF) {
+                    this->throw_parse_error("invalid low surrogate");
+                }
+                code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+            } else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+                this->throw_parse_error("unexpected low surrogate");
+            }
+            append_utf8(buffer, code_point);
+            break;
+        }
+        default:
+            this->throw_parse_error("invalid escape sequence");
+        }
+    }
+    this->throw_parse_error("unterminated string");
+}
+
+std::string_view JsonReader::read_number_text() {
+    const auto c = this->peek();
+    if (c != '-' && !is_digit(c)) {
+        this->throw_type_error("number");
+    }
+    const auto begin = this->pos;
+    const auto skip_digits = [this]() {
+        const auto digits_begin = this->pos;
+        while (this->pos < this->input.size() && is_digit(this->input[this->pos])) {
+            this->pos++;
+        }
+        if (this->pos == digits_begin) {
+            this->throw_parse_error("invalid number");
+        }
+    };
+    if (this->input[this->pos] == '-') {
+        this->pos++;
+    }
+    skip_digits();
+    if (this->pos < this->input.size() && this->input[this->pos] == '.') {
+        this->pos++;
+        skip_digits();
+    }
+    if (this->pos < this->input.size() && (this->input[this->pos] == 'e' || this->input[this->pos] == 'E')) {
+        this->pos++;
+        if (this->pos < this->input.size() && (this->input[this->pos] == '+' || this->input[this->pos] == '-')) {
+            this->pos++;
+        }
+        skip_digits();
+    }
+    return this->input.substr(begin, this->pos - begin);
+}
+
+void JsonReader::skip() {
+    switch (this->peek()) {
+    case '{':
+        this->read_object([this](std::string_view) { this->skip(); });
+        break;
+    case '[':
+        this->read_array([this]() { this->skip(); });
+        break;
+    case '"':
+        this->read_string_view(this->key_buffer);
+        break;
+    default:
+        if (!this->consume_literal("true") && !this->consume_literal("false") && !this->consume_literal("null")) {
+            this->read_number_text();
+        }
+        break;
+    }
+}
+
+void JsonReader::end() {
+    this->skip_whitespace();
+    if (this->pos != this->input.size()) {
+        this->throw_parse_error("unexpected trailing characters");
+    }
+}
+
+void JsonReader::require_member(bool found, const char* name) const {
+    if (!found) {
+        throw nlohmann::json::out_of_range::create(403, std::string("key '") + name + "' not found", nullptr);
+    }
+}
+
+std::string JsonReader::read_string() {
+    std::string buffer;
+    const auto str = this->read_string_view(buffer);
+    if (str.data() == buffer.data()) {
+        return buffer;
+    }
+    return std::string(str);
+}
+
+void JsonReader::read(std::string& str) {
+    str = this->read_string();
+}
+
+void JsonReader::read(bool& b) {
+    if (this->consume_literal("true")) {
+        b = true;
+    } else if (this->consume_literal("false")) {
+        b = false;
+    } else {
+        this->throw_type_error("boolean");
+    }
+}
+
+void JsonReader::read(int32_t& number) {
+    number = number_from_text<int32_t>(this->read_number_text());
+}
+
+void JsonReader::read(int64_t& number) {
+    number = number_from_text<int64_t>(this->read_number_text());
+}
+
+void JsonReader::read(uint64_t& number) {
+    number = number_from_text<uint64_t>(this->read_number_text());
+}
+
+void JsonReader::read(float& number) {
+    number = number_from_text<float>(this->read_number_text());
+}
+
+void JsonReader::read(double& number) {
+    number = number_from_text<double>(this->read_number_text());
+}
+
+void JsonReader::read(DateTime& date_time) {
+    std::string buffer;
+    date_time = DateTime(this->read_string_view(buffer));
+}
+
+void JsonReader::read(nlohmann::json& j) {
+    // only values that are kept as json anyway (e.g. customData) are parsed into a json object
+    this->skip_whitespace();
+    const auto begin = this->pos;
+    this->skip();
+    j = nlohmann::json::parse(this->input.substr(begin, this->pos - begin));
+}
+
+} // namespace ocpp
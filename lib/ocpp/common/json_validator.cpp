@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <charconv>
+
+#include <ocpp/common/json_validator.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+namespace {
+bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/// \brief Counts the characters of the UTF-8 encoded \p str
+size_t utf8_length(std::string_view str) {
+    size_t length = 0;
+    for (const auto c : str) {
+        if ((static_cast<unsigned char>(c) & 0xC0) != 0x80) {
+            length++;
+        }
+    }
+    return length;
+}
+} // namespace
+
+bool is_rfc3339_date_time(std::string_view str) {
+    DateTimeFields fields;
+    return parse_rfc3339(str, fields, true);
+}
+
+JsonValidator::JsonValidator(std::string_view input) : reader(input) {
+}
+
+void JsonValidator::fail(const std::string& reason) const {
+    std::string message(this->type);
+    if (!this->key.empty()) {
+        message.append(".").append(this->key);
+    }
+    throw JsonValidationError(message.empty() ? reason : message + ": " + reason);
+}
+
+void JsonValidator::expect_value(char first, const char* expected) {
+    if (this->reader.peek() != first) {
+        this->fail(std::string("expected ") + expected);
+    }
+}
+
+std::string_view JsonValidator::string_value() {
+    this->expect_value('"', "string");
+    return this->reader.read_string_view(this->buffer);
+}
+
+JsonReader& JsonValidator::get_reader() {
+    return this->reader;
+}
+
+void JsonValidator::require_member(bool found, const char* member) const {
+    if (!found) {
+        throw JsonValidationError(std::string(member) + ": required member is missing");
+    }
+}
+
+void JsonValidator::unknown_member() const {
+    this->fail("member is not allowed by the schema");
+}
+
+void JsonValidator::string() {
+    this->string_value();
+}
+
+void JsonValidator::string(size_t max_length) {
+    const auto value = this->string_value();
+    // the number of characters is at most the number of bytes, so only long strings have to be counted
+    if (value.size() > max_length && utf8_length(value) > max_length) {
+        this->fail("string exceeds the maximum length of " + std::to_string(max_length));
+    }
+}
+
+void JsonValidator::integer() {
+    const auto c = this->reader.peek();
+    if (c != '-' && !is_digit(c)) {
+        this->fail("expected integer");
+    }
+    const auto text = this->reader.read_number_text();
+    int32_t value;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        this->fail(text.find_first_of(".eE") != std::string_view::npos ? "expected integer"
+                                                                        : "integer is out of range");
+    }
+}
+
+void JsonValidator::number() {
+    const auto c = this->reader.peek();
+    if (c != '-' && !is_digit(c)) {
+        this->fail("expected number");
+    }
+    this->reader.read_number_text();
+}
+
+void JsonValidator::boolean() {
+    const auto c = this->reader.peek();
+    if (c != 't' && c != 'f') {
+        this->fail("expected boolean");
+    }
+    bool value;
+    this->reader.read(value);
+}
+
+void JsonValidator::date_time() {
+    if (!is_rfc3339_date_time(this->string_value())) {
+        this->fail("expected RFC 3339 date-time");
+    }
+}
+
+void JsonValidator::any() {
+    this->reader.skip();
+}
+
+void JsonValidator::end() {
+    this->reader.end();
+}
+
+} // namespace ocpp
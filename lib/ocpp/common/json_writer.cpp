@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+namespace {
+template <typename T> void write_integer(std::string& buffer, T number) {
+    std::array<char, 24> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), number);
+    buffer.append(digits.data(), result.ptr);
+}
+
+// nlohmann::json does not offer a public interface to append to an existing buffer or to format a single number
+// the way json::dump() does, so this is the only place that uses its internals. They are stable within the pinned
+// major and minor version (see dependencies.yaml) and have to be checked when updating nlohmann::json.
+static_assert(NLOHMANN_JSON_VERSION_MAJOR == 3 && NLOHMANN_JSON_VERSION_MINOR == 11,
+              "JsonWriter uses nlohmann::json internals, check them when updating nlohmann::json");
+
+void append_json(std::string& buffer, const nlohmann::json& j) {
+    nlohmann::detail::serializer<nlohmann::json> serializer(nlohmann::detail::output_adapter<char>(buffer), ' ');
+    serializer.dump(j, false, false, 0);
+}
+
+template <typename T> void write_floating_point(std::string& buffer, T number) {
+    if (!std::isfinite(number)) {
+        // same as nlohmann::json
+        buffer.append("null");
+        return;
+    }
+    std::array<char, 64> digits;
+    const auto end = nlohmann::detail::to_chars(digits.data(), digits.data() + digits.size(), number);
+    buffer.append(digits.data(), end);
+}
+} // namespace
+
+JsonWriter::JsonWriter(std::string& buffer) : buffer(buffer) {
+}
+
+void JsonWriter::separate() {
+    if (this->needs_separator) {
+        this->buffer.push_back(',');
+    }
+}
+
+void JsonWriter::write_escaped(std::string_view str) {
+    static constexpr char hex[] = "0123456789abcdef";
+    this->buffer.push_back('"');
+    auto unescaped_begin = str.begin();
+    for (auto it = str.begin(); it != str.end(); ++it) {
+        const auto c = static_cast<unsigned char>(*it);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        this->buffer.append(unescaped_begin, it);
+        unescaped_begin = it + 1;
+        switch (c) {
+        case '"':
+            this->buffer.append("\\\"");
+            break;
+        case '\\':
+            this->buffer.append("\\\\");
+            break;
+        case '\b':
+            this->buffer.append("\\b");
+            break;
+        case '\f':
+            this->buffer.append("\\f");
+            break;
+        case '\n':
+            this->buffer.append("\\n");
+            break;
+        case '\r':
+            this->buffer.append("\\r");
+            break;
+        case '\t':
+            this->buffer.append("\\t");
+            break;
+        default:
+            this->buffer.append("\\u00");
+            this->buffer.push_back(hex[c >> 4]);
+            this->buffer.push_back(hex[c & 0xf]);
+            break;
+        }
+    }
+    this->buffer.append(unescaped_begin, str.end());
+    this->buffer.push_back('"');
+}
+
+void JsonWriter::begin_object() {
+    this->separate();
+    this->buffer.push_back('{');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_object() {
+    this->buffer.push_back('}');
+    this->needs_separator = true;
+}
+
+void JsonWriter::begin_array() {
+    this->separate();
+    this->buffer.push_back('[');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_array() {
+    this->buffer.push_back(']');
+    this->needs_separator = true;
+}
+
+void JsonWriter::key(std::string_view name) {
+    this->separate();
+    this->write_escaped(name);
+    this->buffer.push_back(':');
+    this->needs_separator = false;
+}
+
+void JsonWriter::value(std::string_view str) {
+    this->separate();
+    this->write_escaped(str);
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(const char* str) {
+    this->value(std::string_view(str));
+}
+
+void JsonWriter::value(const std::string& str) {
+    this->value(std::string_view(str));
+}
+
+void JsonWriter::value(bool b) {
+    this->separate();
+    this->buffer.append(b ? "true" : "false");
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(int32_t number) {
+    this->separate();
+    write_integer(this->buffer, number);
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(int64_t number) {
+    this->separate();
+    write_integer(this->buffer, number);
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(uint64_t number) {
+    this->separate();
+    write_integer(this->buffer, number);
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(float number) {
+    // nlohmann::json stores floats as double, so they are written with double precision as well
+    this->separate();
+    write_floating_point(this->buffer, static_cast<double>(number));
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(double number) {
+    this->separate();
+    write_floating_point(this->buffer, number);
+    this->needs_separator = true;
+}
+
+void JsonWriter::value(const DateTime& date_time) {
+    char buffer[DateTime::RFC3339_BUFFER_SIZE];
+    this->value(std::string_view(buffer, date_time.to_rfc3339(buffer)));
+}
+
+void JsonWriter::value(const nlohmann::json& j) {
+    this->separate();
+    append_json(this->buffer, j);
+    this->needs_separator = true;
+}
+
+void JsonWriter::null() {
+    this->separate();
+    this->buffer.append("null");
+    this->needs_separator = true;
+}
+
+void JsonWriter::raw(std::string_view json_text) {
+    this->separate();
+    this->buffer.append(json_text);
+    this->needs_separator = true;
+}
+
+} // namespace ocpp
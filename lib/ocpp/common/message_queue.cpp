@@ -2,11 +2,22 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <ocpp/common/message_queue.hpp>
+#include <ocpp/v16/message_validator.hpp>
+#include <ocpp/v201/message_validator.hpp>
 
 #include <everest/logging.hpp>
 
 namespace ocpp {
 
+namespace {
+/// \brief Checks the eventType of a TransactionEvent \p payload without converting the whole request
+bool has_transaction_event_type(const json& payload, const v201::TransactionEventEnum event_type) {
+    const auto it = payload.find("eventType");
+    return it != payload.end() && it->is_string() &&
+           it->get_ref<const json::string_t&>() == v201::conversions::transaction_event_enum_to_string(event_type);
+}
+} // namespace
+
 template <> ControlMessage<v16::MessageType>::ControlMessage(const json& message) {
     this->message = message.get<json::array_t>();
     this->messageType = v16::conversions::string_to_messagetype(message.at(CALL_ACTION));
@@ -31,6 +42,22 @@ template <> bool ControlMessage<v16::MessageType>::isBootNotificationMessage() c
     return this->messageType == v16::MessageType::BootNotification;
 }
 
+template <> bool ControlMessage<v16::MessageType>::isTransactionEndMessage() const {
+    return this->messageType == v16::MessageType::StopTransaction;
+}
+
+template <> std::optional<std::string> ControlMessage<v16::MessageType>::transactionId() const {
+    if (this->messageType != v16::MessageType::StopTransaction && this->messageType != v16::MessageType::MeterValues) {
+        return std::nullopt;
+    }
+    const auto& payload = this->message.at(CALL_PAYLOAD);
+    const auto transaction_id = payload.find("transactionId");
+    if (transaction_id == payload.end() || !transaction_id->is_number_integer()) {
+        return std::nullopt;
+    }
+    return std::to_string(transaction_id->get<int32_t>());
+}
+
 template <> ControlMessage<v201::MessageType>::ControlMessage(const json& message) {
     this->message = message.get<json::array_t>();
     this->messageType = v201::conversions::string_to_messagetype(message.at(CALL_ACTION));
@@ -48,8 +75,7 @@ template <> bool ControlMessage<v201::MessageType>::isTransactionMessage() const
 
 template <> bool ControlMessage<v201::MessageType>::isTransactionUpdateMessage() const {
     if (this->messageType == v201::MessageType::TransactionEvent) {
-        return v201::TransactionEventRequest{this->message.at(CALL_PAYLOAD)}.eventType ==
-               v201::TransactionEventEnum::Updated;
+        return has_transaction_event_type(this->message.at(CALL_PAYLOAD), v201::TransactionEventEnum::Updated);
     }
     return false;
 }
@@ -58,6 +84,20 @@ template <> bool ControlMessage<v201::MessageType>::isBootNotificationMessage()
     return this->messageType == v201::MessageType::BootNotification;
 }
 
+template <> bool ControlMessage<v201::MessageType>::isTransactionEndMessage() const {
+    if (this->messageType == v201::MessageType::TransactionEvent) {
+        return has_transaction_event_type(this->message.at(CALL_PAYLOAD), v201::TransactionEventEnum::Ended);
+    }
+    return false;
+}
+
+template <> std::optional<std::string> ControlMessage<v201::MessageType>::transactionId() const {
+    if (this->messageType != v201::MessageType::TransactionEvent) {
+        return std::nullopt;
+    }
+    return this->message.at(CALL_PAYLOAD).at("transactionInfo").at("transactionId").get<std::string>();
+}
+
 template <> v16::MessageType MessageQueue<v16::MessageType>::string_to_messagetype(const std::string& s) {
     return v16::conversions::string_to_messagetype(s);
 }
@@ -66,12 +106,22 @@ template <> v201::MessageType MessageQueue<v201::MessageType>::string_to_message
     return v201::conversions::string_to_messagetype(s);
 }
 
-template <> std::string MessageQueue<v16::MessageType>::messagetype_to_string(v16::MessageType m) {
+template <> std::string_view MessageQueue<v16::MessageType>::messagetype_to_string(v16::MessageType m) {
     return v16::conversions::messagetype_to_string(m);
 }
 
-template <> std::string MessageQueue<v201::MessageType>::messagetype_to_string(const v201::MessageType m) {
+template <> std::string_view MessageQueue<v201::MessageType>::messagetype_to_string(const v201::MessageType m) {
     return v201::conversions::messagetype_to_string(m);
 }
 
+template <>
+void MessageQueue<v16::MessageType>::validate_payload(v16::MessageType message_type, JsonValidator& validator) {
+    v16::validate_message(message_type, validator);
+}
+
+template <>
+void MessageQueue<v201::MessageType>::validate_payload(v201::MessageType message_type, JsonValidator& validator) {
+    v201::validate_message(message_type, validator);
+}
+
 } // namespace ocpp
@@ -109,6 +109,12 @@ void MessageLogging::charge_point(const std::string& message_type, const std::st
     }
 }
 
+void MessageLogging::charge_point(const std::string& message_type, std::string_view json_str) {
+    if (this->message_logging_active()) {
+        this->charge_point(message_type, std::string(json_str));
+    }
+}
+
 void MessageLogging::central_system(const std::string& message_type, const std::string& json_str) {
     if (this->message_callback != nullptr) {
         this->message_callback(json_str, MessageDirection::CSMSToChargingStation);
@@ -242,4 +248,8 @@ bool MessageLogging::session_logging_active() {
     return this->session_logging;
 }
 
+bool MessageLogging::message_logging_active() {
+    return this->log_messages || this->message_callback != nullptr || this->session_logging;
+}
+
 } // namespace ocpp
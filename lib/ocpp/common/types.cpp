@@ -1,19 +1,140 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <charconv>
+
 #include <everest/logging.hpp>
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/types.hpp>
 
 namespace ocpp {
 
+namespace {
+constexpr int64_t SECONDS_PER_DAY = 86400;
+
+bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/// \brief Reads the \p count digits starting at \p pos of \p str into \p value
+/// \returns false if \p str does not contain \p count digits at \p pos
+bool read_digits(std::string_view str, size_t pos, size_t count, int& value) {
+    if (pos + count > str.size()) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = pos; i < pos + count; i++) {
+        if (!is_digit(str[i])) {
+            return false;
+        }
+        value = value * 10 + (str[i] - '0');
+    }
+    return true;
+}
+
+bool is_leap_year(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int days_in_month(int year, int month) {
+    static constexpr int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && is_leap_year(year) ? 29 : days[month - 1];
+}
+
+// conversions between civil dates and days since 1970-01-01, see http://howardhinnant.github.io/date_algorithms.html
+int64_t days_from_civil(int64_t year, int month, int day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t year_of_era = year - era * 400;
+    const int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+void civil_from_days(int64_t days, int64_t& year, int& month, int& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t day_of_era = days - era * 146097;
+    const int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const int64_t shifted_month = (5 * day_of_year + 2) / 153;
+    day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+    month = static_cast<int>(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+    year = year_of_era + era * 400 + (month <= 2);
+}
+
+/// \brief Writes \p value with \p count digits to \p out
+/// \returns the position after the written digits
+char* write_digits(char* out, int64_t value, int count) {
+    for (int i = count - 1; i >= 0; i--) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + count;
+}
+} // namespace
+
+bool parse_rfc3339(std::string_view str, DateTimeFields& fields, bool strict) {
+    // full-date "T" partial-time [time-offset], e.g. 2024-01-01T12:00:00.123+01:00
+    if (!read_digits(str, 0, 4, fields.year) || str.size() < 19 || str[4] != '-' ||
+        !read_digits(str, 5, 2, fields.month) || str[7] != '-' || !read_digits(str, 8, 2, fields.day) ||
+        (str[10] != 'T' && (strict || str[10] != 't')) || !read_digits(str, 11, 2, fields.hour) || str[13] != ':' ||
+        !read_digits(str, 14, 2, fields.minute) || str[16] != ':' || !read_digits(str, 17, 2, fields.second)) {
+        return false;
+    }
+    if (fields.month < 1 || fields.month > 12 || fields.day < 1 ||
+        fields.day > days_in_month(fields.year, fields.month) || fields.hour > 23 || fields.minute > 59 ||
+        fields.second > (strict ? 59 : 60)) {
+        return false;
+    }
+
+    size_t pos = 19;
+    fields.nanoseconds = 0;
+    fields.fraction_digits = 0;
+    if (pos < str.size() && str[pos] == '.') {
+        pos++;
+        while (pos < str.size() && is_digit(str[pos])) {
+            if (fields.fraction_digits < 9) {
+                fields.nanoseconds = fields.nanoseconds * 10 + (str[pos] - '0');
+            }
+            fields.fraction_digits++;
+            pos++;
+        }
+        if (fields.fraction_digits == 0 || (strict && fields.fraction_digits > 3)) {
+            return false;
+        }
+        for (int i = fields.fraction_digits; i < 9; i++) {
+            fields.nanoseconds *= 10;
+        }
+    }
+
+    fields.has_offset = pos < str.size();
+    fields.offset_minutes = 0;
+    if (!fields.has_offset) {
+        return !strict;
+    }
+    if (str[pos] == 'Z' || (!strict && str[pos] == 'z')) {
+        return pos + 1 == str.size();
+    }
+    // the colon of the offset is optional, e.g. +01:00 or +0100
+    const size_t minute_pos = pos + 3 < str.size() && str[pos + 3] == ':' ? pos + 4 : pos + 3;
+    int offset_hour, offset_minute;
+    if ((str[pos] != '+' && str[pos] != '-') || minute_pos + 2 != str.size() ||
+        !read_digits(str, pos + 1, 2, offset_hour) || !read_digits(str, minute_pos, 2, offset_minute) ||
+        offset_hour > 23 || offset_minute > 59) {
+        return false;
+    }
+    fields.offset_minutes = (str[pos] == '-' ? -1 : 1) * (offset_hour * 60 + offset_minute);
+    return true;
+}
+
 DateTime::DateTime() : DateTimeImpl() {
 }
 
 DateTime::DateTime(std::chrono::time_point<date::utc_clock> timepoint) : DateTimeImpl(timepoint) {
 }
 
-DateTime::DateTime(const std::string& timepoint_str) : DateTimeImpl(timepoint_str) {
+DateTime::DateTime(std::string_view timepoint_str) : DateTimeImpl(timepoint_str) {
 }
 
 DateTime& DateTime::operator=(const std::string& s) {
@@ -22,7 +143,7 @@ DateTime& DateTime::operator=(const std::string& s) {
 }
 
 DateTime& DateTime::operator=(const char* c) {
-    this->from_rfc3339(std::string(c));
+    this->from_rfc3339(c);
     return *this;
 }
 
@@ -33,31 +154,71 @@ DateTimeImpl::DateTimeImpl() {
 DateTimeImpl::DateTimeImpl(std::chrono::time_point<date::utc_clock> timepoint) : timepoint(timepoint) {
 }
 
-DateTimeImpl::DateTimeImpl(const std::string& timepoint_str) {
+DateTimeImpl::DateTimeImpl(std::string_view timepoint_str) {
     this->from_rfc3339(timepoint_str);
 }
 
 std::string DateTimeImpl::to_rfc3339() const {
-    return date::format("%FT%TZ", std::chrono::time_point_cast<std::chrono::milliseconds>(this->timepoint));
-}
-
-void DateTimeImpl::from_rfc3339(const std::string& timepoint_str) {
-    std::istringstream in{timepoint_str};
-    in >> date::parse("%FT%T%Ez", this->timepoint);
-    if (in.fail()) {
-        in.clear();
-        in.seekg(0);
-        in >> date::parse("%FT%TZ", this->timepoint);
-        if (in.fail()) {
-            in.clear();
-            in.seekg(0);
-            in >> date::parse("%FT%T", this->timepoint);
-            if (in.fail()) {
-                EVLOG_error << "Timepoint string parsing failed. Could not convert: \"" << timepoint_str
-                            << "\" into DateTime.";
-            }
-        }
-    }
+    char buffer[RFC3339_BUFFER_SIZE];
+    return std::string(buffer, this->to_rfc3339(buffer));
+}
+
+size_t DateTimeImpl::to_rfc3339(char* out) const {
+    const auto utc_milliseconds = std::chrono::floor<std::chrono::milliseconds>(this->timepoint);
+    const auto utc_seconds = std::chrono::floor<std::chrono::seconds>(utc_milliseconds);
+    // during a leap second to_sys() returns the last second of the day, which does not convert back
+    const auto sys_seconds = date::utc_clock::to_sys(utc_seconds);
+    const auto leap_second = date::utc_clock::from_sys(sys_seconds) != utc_seconds;
+
+    const int64_t seconds_since_epoch = sys_seconds.time_since_epoch().count();
+    int64_t days = seconds_since_epoch / SECONDS_PER_DAY;
+    if (days * SECONDS_PER_DAY > seconds_since_epoch) {
+        days--;
+    }
+    const int64_t seconds_of_day = seconds_since_epoch - days * SECONDS_PER_DAY;
+    int64_t year;
+    int month, day;
+    civil_from_days(days, year, month, day);
+
+    // YYYY-MM-DDThh:mm:ss.sssZ
+    char* pos = out;
+    if (year >= 0 && year <= 9999) {
+        pos = write_digits(pos, year, 4);
+    } else {
+        pos = std::to_chars(pos, out + RFC3339_BUFFER_SIZE, year).ptr;
+    }
+    *pos++ = '-';
+    pos = write_digits(pos, month, 2);
+    *pos++ = '-';
+    pos = write_digits(pos, day, 2);
+    *pos++ = 'T';
+    pos = write_digits(pos, seconds_of_day / 3600, 2);
+    *pos++ = ':';
+    pos = write_digits(pos, seconds_of_day / 60 % 60, 2);
+    *pos++ = ':';
+    pos = write_digits(pos, seconds_of_day % 60 + (leap_second ? 1 : 0), 2);
+    *pos++ = '.';
+    pos = write_digits(pos, (utc_milliseconds - utc_seconds).count(), 3);
+    *pos++ = 'Z';
+    return pos - out;
+}
+
+void DateTimeImpl::from_rfc3339(std::string_view timepoint_str) {
+    DateTimeFields fields;
+    if (!parse_rfc3339(timepoint_str, fields)) {
+        EVLOG_error << "Timepoint string parsing failed. Could not convert: \"" << timepoint_str
+                    << "\" into DateTime.";
+        return;
+    }
+    // a leap second is read as the last second of the day and then moved into the leap second by the utc_clock
+    const auto leap_second = fields.second == 60;
+    const auto seconds_since_epoch = days_from_civil(fields.year, fields.month, fields.day) * SECONDS_PER_DAY +
+                                     fields.hour * 3600 + fields.minute * 60 + (leap_second ? 59 : fields.second) -
+                                     fields.offset_minutes * 60;
+    const auto sys_time =
+        std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::seconds(seconds_since_epoch) + std::chrono::nanoseconds(fields.nanoseconds)));
+    this->timepoint = date::utc_clock::from_sys(sys_time) + std::chrono::seconds(leap_second ? 1 : 0);
 }
 
 std::chrono::time_point<date::utc_clock> DateTimeImpl::to_time_point() const {
@@ -70,7 +231,8 @@ DateTimeImpl& DateTimeImpl::operator=(const DateTimeImpl& dt) {
 }
 
 std::ostream& operator<<(std::ostream& os, const DateTimeImpl& dt) {
-    os << dt.to_rfc3339();
+    char buffer[DateTimeImpl::RFC3339_BUFFER_SIZE];
+    os.write(buffer, dt.to_rfc3339(buffer));
     return os;
 }
 
@@ -122,6 +284,16 @@ void from_json(const json& j, CallError& c) {
     c.errorDetails = j.at(CALLERROR_ERROR_DETAILS);
 }
 
+void write_json(JsonWriter& writer, const CallError& c) {
+    writer.begin_array();
+    writer.value(static_cast<int32_t>(MessageTypeId::CALLERROR));
+    writer.value(c.uniqueId);
+    writer.value(c.errorCode);
+    writer.value(c.errorDescription);
+    writer.value(c.errorDetails);
+    writer.end_array();
+}
+
 std::ostream& operator<<(std::ostream& os, const CallError& c) {
     os << json(c).dump(4);
     return os;
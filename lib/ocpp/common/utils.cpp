@@ -2,10 +2,9 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <boost/algorithm/string/predicate.hpp>
-#include <mutex>
-#include <regex>
 #include <sstream>
 
+#include <ocpp/common/types.hpp>
 #include <ocpp/common/utils.hpp>
 
 namespace ocpp {
@@ -76,14 +75,8 @@ bool is_decimal_number(const std::string& value) {
 }
 
 bool is_rfc3339_datetime(const std::string& value) {
-    static std::regex datetime_pattern{};
-    static std::once_flag datetime_regex_once;
-    std::call_once(datetime_regex_once, []() {
-        datetime_pattern =
-            std::regex{"\\d{4}-(?:0[1-9]|1[0-2])-(?:0[1-9]|[1-2]\\d|3[0-1])T(?:[0-1]\\d|2[0-3]):[0-5]\\d:["
-                       "0-5]\\d(?:\\.\\d{0,3}|)(?:Z|(?:\\+|\\-)(?:\\d{2}):?(?:\\d{2}))"};
-    });
-    return std::regex_match(value, datetime_pattern);
+    DateTimeFields fields;
+    return parse_rfc3339(value, fields, true);
 }
 
 } // namespace ocpp
@@ -98,6 +98,23 @@ bool Websocket::send(const std::string& message) {
     return this->websocket->send(message);
 }
 
+WebsocketSendResult Websocket::send(const json& message, const std::function<void(bool sent)>& on_sent) {
+    auto frame = WebsocketFrameBuffer::from_json(message);
+    this->logging->charge_point("Unknown", frame.payload());
+    return this->websocket->send_async(std::move(frame), on_sent);
+}
+
+WebsocketSendResult Websocket::send(const JsonWriteFunction& write, const std::function<void(bool sent)>& on_sent) {
+    auto frame = WebsocketFrameBuffer::from_writer(write);
+    this->logging->charge_point("Unknown", frame.payload());
+    return this->websocket->send_async(std::move(frame), on_sent);
+}
+
+WebsocketSendResult Websocket::send_async(const std::string& message, const std::function<void(bool sent)>& on_sent) {
+    this->logging->charge_point("Unknown", message);
+    return this->websocket->send_async(message, on_sent);
+}
+
 void Websocket::set_websocket_ping_interval(int32_t interval_s) {
     this->logging->sys("WebsocketPingInterval changed");
     this->websocket->set_websocket_ping_interval(interval_s);
@@ -107,4 +124,28 @@ void Websocket::set_authorization_key(const std::string& authorization_key) {
     this->websocket->set_authorization_key(authorization_key);
 }
 
+WebsocketSendResult Websocket::send_stream_async(WebsocketPayloadProducer&& producer,
+                                                const std::function<void(bool sent)>& on_sent) {
+    if (!this->logging->message_logging_active()) {
+        return this->websocket->send_stream_async(std::move(producer), on_sent);
+    }
+
+    // the produced payload is only collected for the message logging, it is logged once it has been produced
+    auto logged_producer = [this, producer = std::move(producer), payload = std::string()](
+                               char* buffer, size_t capacity, bool& is_last) mutable {
+        const auto produced = producer(buffer, capacity, is_last);
+        payload.append(buffer, std::min(produced, capacity));
+        if (is_last) {
+            this->logging->charge_point("Unknown", payload);
+            payload = std::string();
+        }
+        return produced;
+    };
+    return this->websocket->send_stream_async(std::move(logged_producer), on_sent);
+}
+
+WebsocketTrafficStatistics Websocket::get_traffic_statistics() const {
+    return this->websocket->get_traffic_statistics();
+}
+
 } // namespace ocpp
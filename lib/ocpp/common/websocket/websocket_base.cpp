@@ -1,12 +1,90 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
 #include <random>
+#include <stdexcept>
+#include <utility>
 
 #include <everest/logging.hpp>
+#include <nlohmann/json.hpp>
 #include <ocpp/common/websocket/websocket_base.hpp>
 #include <websocketpp_utils/base64.hpp>
 namespace ocpp {
 
+WebsocketFrameBuffer::WebsocketFrameBuffer() : buffer(WEBSOCKET_FRAME_HEADROOM, '\0') {
+}
+
+WebsocketFrameBuffer::WebsocketFrameBuffer(std::string_view payload) : WebsocketFrameBuffer() {
+    this->buffer.append(payload);
+}
+
+WebsocketFrameBuffer WebsocketFrameBuffer::from_json(const json& message) {
+    WebsocketFrameBuffer frame;
+    // same as json::dump() but appending to the headroom instead of producing a separate string
+    JsonWriter writer(frame.buffer);
+    writer.value(message);
+    return frame;
+}
+
+WebsocketFrameBuffer WebsocketFrameBuffer::from_writer(const JsonWriteFunction& write) {
+    WebsocketFrameBuffer frame;
+    JsonWriter writer(frame.buffer);
+    write(writer);
+    return frame;
+}
+
+char* WebsocketFrameBuffer::payload_data() {
+    return this->buffer.data() + WEBSOCKET_FRAME_HEADROOM;
+}
+
+std::string_view WebsocketFrameBuffer::payload() const {
+    return std::string_view(this->buffer).substr(WEBSOCKET_FRAME_HEADROOM);
+}
+
+size_t WebsocketFrameBuffer::payload_size() const {
+    return this->buffer.size() - WEBSOCKET_FRAME_HEADROOM;
+}
+
+WebsocketReceiveResult WebsocketReceiveBuffer::append(const char* data, size_t len, size_t remaining_frame_len,
+                                                      bool is_final_fragment, size_t max_message_size) {
+    const size_t expected_len = this->message.size() + len + remaining_frame_len;
+
+    if (max_message_size > 0 && expected_len > max_message_size) {
+        this->clear();
+        return WebsocketReceiveResult::TooLarge;
+    }
+
+    if (this->message.capacity() < expected_len) {
+        auto capacity = std::max(expected_len, this->message.capacity() * 2);
+        if (max_message_size > 0) {
+            capacity = std::min(capacity, max_message_size);
+        }
+        this->message.reserve(capacity);
+    }
+    this->message.append(data, len);
+
+    if (remaining_frame_len == 0 && is_final_fragment) {
+        return WebsocketReceiveResult::Complete;
+    }
+    return WebsocketReceiveResult::Incomplete;
+}
+
+std::string WebsocketReceiveBuffer::take_message() {
+    return std::exchange(this->message, std::string());
+}
+
+void WebsocketReceiveBuffer::clear() {
+    std::string().swap(this->message);
+}
+
+size_t WebsocketReceiveBuffer::size() const {
+    return this->message.size();
+}
+
+size_t WebsocketReceiveBuffer::capacity() const {
+    return this->message.capacity();
+}
+
 WebsocketBase::WebsocketBase() :
     m_is_connected(false),
     connected_callback(nullptr),
@@ -16,7 +94,11 @@ WebsocketBase::WebsocketBase() :
     connection_attempts(1),
     reconnect_backoff_ms(0),
     shutting_down(false),
-    reconnecting(false) {
+    reconnecting(false),
+    raw_bytes_sent(0),
+    wire_bytes_sent(0),
+    raw_bytes_received(0),
+    wire_bytes_received(0) {
 
     set_connection_options_base(connection_options);
 
@@ -56,6 +138,44 @@ void WebsocketBase::register_connection_failed_callback(const std::function<void
     this->connection_failed_callback = callback;
 }
 
+WebsocketSendResult WebsocketBase::send_async(WebsocketFrameBuffer&& frame,
+                                              const std::function<void(bool sent)>& on_sent) {
+    if (!this->send(std::string(frame.payload()))) {
+        return WebsocketSendResult::Failed;
+    }
+    if (on_sent != nullptr) {
+        on_sent(true);
+    }
+    return WebsocketSendResult::Accepted;
+}
+
+WebsocketSendResult WebsocketBase::send_async(const std::string& message,
+                                              const std::function<void(bool sent)>& on_sent) {
+    return this->send_async(WebsocketFrameBuffer(message), on_sent);
+}
+
+WebsocketSendResult WebsocketBase::send_stream_async(WebsocketPayloadProducer&& producer,
+                                                     const std::function<void(bool sent)>& on_sent) {
+    constexpr size_t chunk_size = 4096;
+    std::string payload;
+    bool is_last = false;
+    try {
+        while (!is_last) {
+            const auto offset = payload.size();
+            payload.resize(offset + chunk_size);
+            const auto produced = producer(payload.data() + offset, chunk_size, is_last);
+            if (produced == 0 && !is_last) {
+                throw std::runtime_error("Payload producer returned no data before the end of the payload");
+            }
+            payload.resize(offset + std::min(produced, chunk_size));
+        }
+    } catch (const std::exception& e) {
+        EVLOG_error << "Could not produce websocket message: " << e.what();
+        return WebsocketSendResult::Failed;
+    }
+    return this->send_async(WebsocketFrameBuffer(payload), on_sent);
+}
+
 bool WebsocketBase::initialized() {
     if (this->connected_callback == nullptr) {
         EVLOG_error << "Not properly initialized: please register connected callback.";
@@ -180,4 +300,27 @@ void WebsocketBase::on_pong_timeout(std::string msg) {
     }
 }
 
+void WebsocketBase::reset_traffic_statistics() {
+    this->raw_bytes_sent = 0;
+    this->wire_bytes_sent = 0;
+    this->raw_bytes_received = 0;
+    this->wire_bytes_received = 0;
+}
+
+void WebsocketBase::log_traffic_statistics() {
+    const auto statistics = this->get_traffic_statistics();
+    EVLOG_info << "Websocket traffic of connection: sent " << statistics.raw_bytes_sent << " bytes ("
+               << statistics.wire_bytes_sent << " on the wire), received " << statistics.raw_bytes_received
+               << " bytes (" << statistics.wire_bytes_received << " on the wire)";
+}
+
+WebsocketTrafficStatistics WebsocketBase::get_traffic_statistics() const {
+    WebsocketTrafficStatistics statistics;
+    statistics.raw_bytes_sent = this->raw_bytes_sent;
+    statistics.wire_bytes_sent = this->wire_bytes_sent;
+    statistics.raw_bytes_received = this->raw_bytes_received;
+    statistics.wire_bytes_received = this->wire_bytes_received;
+    return statistics;
+}
+
 } // namespace ocpp
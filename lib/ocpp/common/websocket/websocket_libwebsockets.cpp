@@ -7,10 +7,15 @@
 
 #include <libwebsockets.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <future>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <openssl/opensslv.h>
 #include <openssl/ssl.h>
@@ -54,6 +59,10 @@ enum class EConnectionState {
 /// \brief Message to return in the callback to close the socket connection
 static constexpr int LWS_CLOSE_SOCKET_RESPONSE_MESSAGE = -1;
 
+constexpr auto permessage_deflate_name = "permessage-deflate";
+constexpr int MIN_COMPRESSION_WINDOW_BITS = 9; // zlib does not support raw deflate streams with 8 window bits
+constexpr int MAX_COMPRESSION_WINDOW_BITS = 15;
+
 /// \brief Per thread connection data
 struct ConnectionData {
     ConnectionData() :
@@ -117,6 +126,11 @@ struct ConnectionData {
 
 public:
     // This public block will only be used from client loop thread, no locking needed
+    // Extensions offered to the server, referenced by the lws context
+    std::string compression_offer;
+    std::array<lws_extension, 2> extensions;
+    // If the message that is currently written is passed through the compressor
+    bool compress_message = true;
     // Openssl context, must be destroyed in this order
     std::unique_ptr<SSL_CTX> sec_context;
     // libwebsockets state
@@ -134,23 +148,66 @@ private:
     std::atomic<EConnectionState> state;
 };
 
+static_assert(WEBSOCKET_FRAME_HEADROOM >= LWS_PRE, "Frame headroom too small for the libwebsockets frame header");
+
 struct WebsocketMessage {
-    WebsocketMessage() : sent_bytes(0), message_sent(false) {
+    WebsocketMessage(WebsocketFrameBuffer&& frame, lws_write_protocol protocol) :
+        frame(std::move(frame)),
+        protocol(protocol),
+        producer_done(true),
+        sent_bytes(0),
+        final_fragment_written(false),
+        message_sent(false),
+        completed(false) {
+    }
+
+    WebsocketMessage(WebsocketPayloadProducer&& producer, lws_write_protocol protocol) :
+        frame(std::string_view()),
+        protocol(protocol),
+        producer(std::move(producer)),
+        producer_done(false),
+        sent_bytes(0),
+        final_fragment_written(false),
+        message_sent(false),
+        completed(false) {
     }
 
     virtual ~WebsocketMessage() {
+        // A message that is dropped before it was written counts as failed
+        complete(false);
+    }
+
+    /// \brief Reports the outcome of sending this message, only the first call has an effect
+    void complete(bool sent) {
+        if (!completed.exchange(true)) {
+            message_sent = sent;
+            if (on_sent) {
+                on_sent(sent);
+            }
+        }
     }
 
 public:
-    std::string payload;
+    // Payload with LWS_PRE bytes of headroom for the frame header
+    WebsocketFrameBuffer frame;
     lws_write_protocol protocol;
+    std::function<void(bool sent)> on_sent;
+
+    // Source of the payload of a streamed message, the current fragment is produced into 'fragment'
+    WebsocketPayloadProducer producer;
+    std::vector<char> fragment;
+    bool producer_done;
 
     // How many bytes we have sent to libwebsockets, does not
     // necessarily mean that all bytes have been sent over the wire,
     // just that these were sent to libwebsockets
     size_t sent_bytes;
+    // If the last fragment of the message has been handed to libwebsockets
+    bool final_fragment_written;
     // If libwebsockets has sent all the bytes through the wire
     std::atomic_bool message_sent;
+    // If the outcome has been reported
+    std::atomic_bool completed;
 };
 
 static bool verify_csms_cn(const std::string& hostname, bool preverified, const X509_STORE_CTX* ctx,
@@ -208,7 +265,7 @@ static bool verify_csms_cn(const std::string& hostname, bool preverified, const
 
 WebsocketTlsTPM::WebsocketTlsTPM(const WebsocketConnectionOptions& connection_options,
                                  std::shared_ptr<EvseSecurity> evse_security) :
-    WebsocketBase(), evse_security(evse_security) {
+    WebsocketBase(), evse_security(evse_security), compression_active(false), compression_window_bits(15) {
 
     set_connection_options(connection_options);
 
@@ -267,6 +324,45 @@ static int callback_minimal(struct lws* wsi, enum lws_callback_reasons reason, v
     return 0;
 }
 
+static int callback_permessage_deflate(lws_context* context, const lws_extension* ext, lws* wsi,
+                                       enum lws_extension_callback_reasons reason, void* user, void* in, size_t len) {
+    auto ebufs = reinterpret_cast<lws_ext_pm_deflate_rx_ebufs*>(in);
+    const bool is_payload =
+        (reason == LWS_EXT_CB_PAYLOAD_TX || reason == LWS_EXT_CB_PAYLOAD_RX) && ebufs != nullptr && wsi != nullptr;
+    const int rx_len_before = (is_payload && reason == LWS_EXT_CB_PAYLOAD_RX) ? ebufs->eb_in.len : 0;
+
+    // Messages below the compression threshold bypass the compressor. The extension only sets RSV1 on frames whose
+    // payload it compressed, so they go out as plain frames on the negotiated connection.
+    if (is_payload && reason == LWS_EXT_CB_PAYLOAD_TX) {
+        ConnectionData* data = reinterpret_cast<ConnectionData*>(lws_wsi_user(wsi));
+        if (data != nullptr && !data->compress_message) {
+            ebufs->eb_out = ebufs->eb_in;
+            if (auto owner = data->get_owner()) {
+                owner->on_compressed_traffic(std::max(ebufs->eb_in.len, 0), 0);
+            }
+            return 0;
+        }
+    }
+
+    const int result = lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+
+    // Count what actually went over the connection: the deflate output when sending and the consumed deflate input
+    // when receiving
+    if (is_payload && result >= 0) {
+        if (ConnectionData* data = reinterpret_cast<ConnectionData*>(lws_wsi_user(wsi))) {
+            if (auto owner = data->get_owner()) {
+                if (reason == LWS_EXT_CB_PAYLOAD_TX) {
+                    owner->on_compressed_traffic(std::max(ebufs->eb_out.len, 0), 0);
+                } else {
+                    owner->on_compressed_traffic(0, std::max(rx_len_before - ebufs->eb_in.len, 0));
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 constexpr auto local_protocol_name = "lws-everest-client";
 static const struct lws_protocols protocols[] = {{local_protocol_name, callback_minimal, 0, 0, 0, NULL, 0},
                                                  LWS_PROTOCOL_LIST_TERM};
@@ -441,6 +537,22 @@ void WebsocketTlsTPM::client_loop() {
 
     info.fd_limit_per_thread = 1 + 1 + 1;
 
+    this->compression_active = false;
+    if (this->connection_options.compression.enabled) {
+        const auto window_bits = std::clamp(this->connection_options.compression.window_bits,
+                                            MIN_COMPRESSION_WINDOW_BITS, MAX_COMPRESSION_WINDOW_BITS);
+        local_data->compression_offer = std::string(permessage_deflate_name) + "; client_max_window_bits";
+        if (window_bits < MAX_COMPRESSION_WINDOW_BITS) {
+            // Limits the windows of both sides, so that memory is saved for inflating as well
+            local_data->compression_offer += "=" + std::to_string(window_bits) +
+                                             "; server_max_window_bits=" + std::to_string(window_bits);
+        }
+        local_data->extensions = {{{permessage_deflate_name, callback_permessage_deflate,
+                                    local_data->compression_offer.c_str()},
+                                   {nullptr, nullptr, nullptr}}};
+        info.extensions = local_data->extensions.data();
+    }
+
     if (this->connection_options.security_profile == 2 || this->connection_options.security_profile == 3) {
         // Setup context - need to know the key type first
         std::string path_key;
@@ -634,11 +746,13 @@ bool WebsocketTlsTPM::connect() {
         this->reconnect_timer_tpm.stop();
     }
 
-    // Clear any pending messages on a new connection
+    // Clear any pending messages on a new connection, their senders are notified when they are dropped
     {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        std::queue<std::shared_ptr<WebsocketMessage>> empty;
-        empty.swap(message_queue);
+        std::deque<std::shared_ptr<WebsocketMessage>> empty;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            empty.swap(message_queue);
+        }
     }
 
     {
@@ -740,8 +854,8 @@ void WebsocketTlsTPM::close(const WebsocketCloseReason code, const std::string&
 
     this->m_is_connected = false;
 
-    // Notify any message senders that are waiting, since we can't send messages any more
-    msg_send_cv.notify_all();
+    // Notify any message senders, since we can't send messages any more
+    fail_pending_messages();
 
     // Clear any irrelevant data after a DC
     recv_buffered_message.clear();
@@ -759,6 +873,7 @@ void WebsocketTlsTPM::on_conn_connected() {
     this->connection_attempts = 1; // reset connection attempts
     this->m_is_connected = true;
     this->reconnecting = false;
+    this->reset_traffic_statistics();
 
     // Clear any irrelevant data after a DC
     recv_buffered_message.clear();
@@ -774,9 +889,10 @@ void WebsocketTlsTPM::on_conn_close() {
     this->m_is_connected = false;
     this->disconnected_callback();
     this->cancel_reconnect_timer();
+    this->log_traffic_statistics();
 
-    // Notify any message senders that are waiting, since we can't send messages any more
-    msg_send_cv.notify_all();
+    // Notify any message senders, since we can't send messages any more
+    fail_pending_messages();
 
     // Clear any irrelevant data after a DC
     recv_buffered_message.clear();
@@ -800,6 +916,9 @@ void WebsocketTlsTPM::on_conn_fail() {
     this->m_is_connected = false;
     recv_buffered_message.clear();
 
+    // Notify any message senders, since we can't send messages any more
+    fail_pending_messages();
+
     // -1 indicates to always attempt to reconnect
     if (this->connection_options.max_connection_attempts == -1 or
         this->connection_attempts <= this->connection_options.max_connection_attempts) {
@@ -820,6 +939,11 @@ void WebsocketTlsTPM::on_message(std::string&& message) {
 
     EVLOG_debug << "Received message over TLS websocket polling for process: " << message;
 
+    this->raw_bytes_received += message.size();
+    if (!this->compression_active) {
+        this->wire_bytes_received += message.size();
+    }
+
     {
         std::lock_guard<std::mutex> lock(this->recv_mutex);
         recv_message_queue.push(std::move(message));
@@ -828,75 +952,127 @@ void WebsocketTlsTPM::on_message(std::string&& message) {
     recv_message_cv.notify_one();
 }
 
-static bool send_internal(lws* wsi, WebsocketMessage* msg) {
-    static std::vector<char> buff;
+/// \brief Provides the next fragment of a streamed message \p msg, at most \p max_fragment_size bytes
+/// \returns pointer to the fragment, LWS_PRE bytes of headroom are available in front of it
+/// \throws std::runtime_error if the producer returns no data before the end of the payload
+static unsigned char* produce_fragment(WebsocketMessage* msg, size_t max_fragment_size, size_t& fragment_len) {
+    msg->fragment.resize(LWS_PRE + max_fragment_size);
+    char* fragment = msg->fragment.data() + LWS_PRE;
+
+    fragment_len = 0;
+    while (fragment_len < max_fragment_size && !msg->producer_done) {
+        bool is_last = false;
+        const auto produced = msg->producer(fragment + fragment_len, max_fragment_size - fragment_len, is_last);
+        if (produced == 0 && !is_last) {
+            // the producer must not block, so waiting for more data would spin on the websocket thread
+            throw std::runtime_error("Payload producer returned no data before the end of the payload");
+        }
+        fragment_len += std::min(produced, max_fragment_size - fragment_len);
+        msg->producer_done = is_last;
+    }
+
+    return reinterpret_cast<unsigned char*>(fragment);
+}
+
+bool WebsocketTlsTPM::on_receive(void* wsi_ptr, const char* in, size_t len) {
+    lws* wsi = reinterpret_cast<lws*>(wsi_ptr);
 
-    std::string& message = msg->payload;
-    size_t message_len = message.length();
-    size_t buff_req_size = message_len + LWS_PRE;
+    // The remaining payload of the current frame is known upfront, so an oversized frame is rejected before it is read
+    const size_t remaining_frame_len = lws_remaining_packet_payload(wsi);
+    const size_t expected_len = recv_buffered_message.size() + len + remaining_frame_len;
+    const size_t max_len = this->connection_options.max_inbound_message_size;
 
-    if (buff.size() < buff_req_size)
-        buff.resize(buff_req_size);
+    const auto result =
+        recv_buffered_message.append(in, len, remaining_frame_len, lws_is_final_fragment(wsi) != 0, max_len);
 
-    // Copy data in send buffer
-    memcpy(&buff[LWS_PRE], message.data(), message_len);
+    if (result == WebsocketReceiveResult::TooLarge) {
+        EVLOG_error << "Received message of at least " << expected_len << " bytes exceeds the maximum of " << max_len
+                    << " bytes, closing connection";
 
-    // TODO (ioan): if we require certain sending over the wire,
-    // we'll have to send chunked manually something like this:
+        std::string reason = "Message too big";
+        lws_close_reason(wsi, LWS_CLOSE_STATUS_MESSAGE_TOO_LARGE, reinterpret_cast<unsigned char*>(reason.data()),
+                         reason.size());
+        return false;
+    }
 
-    // Ethernet MTU: ~= 1500bytes
-    // size_t BUFF_SIZE = (MTU * 2);
-    // char *buff = alloca(LWS_PRE + BUFF_SIZE);
-    // memcpy(buff, message.data() + already_written, BUFF_SIZE);
-    // int flags = lws_write_ws_flags(proto, is_start, is_end);
-    // already_written += lws_write(wsi, buff + LWS_PRE, BUFF_SIZE - LWS_PRE, flags);
+    if (result == WebsocketReceiveResult::Complete) {
+        // Handed over without a copy, the receive buffer starts empty for the next message
+        on_message(recv_buffered_message.take_message());
+    }
 
-    auto sent = lws_write(wsi, reinterpret_cast<unsigned char*>(&buff[LWS_PRE]), message_len, msg->protocol);
+    return true;
+}
+
+/// \brief Writes the next fragment of \p msg to libwebsockets. Control frames and messages up to
+/// \p max_fragment_size bytes are written as a single frame.
+/// \returns false if the fragment could not be written
+static bool send_internal(lws* wsi, WebsocketMessage* msg, size_t max_fragment_size) {
+    const bool is_control = msg->protocol == LWS_WRITE_PING;
+    const bool is_start = msg->sent_bytes == 0;
+
+    unsigned char* fragment;
+    size_t fragment_len;
+    bool is_end;
+
+    if (msg->producer) {
+        fragment = produce_fragment(msg, max_fragment_size, fragment_len);
+        is_end = msg->producer_done;
+    } else {
+        // The frame reserves the LWS_PRE bytes libwebsockets needs in front of the payload. Later fragments use the
+        // already written payload in front of them as headroom, so every fragment is written in place.
+        const size_t message_len = msg->frame.payload_size();
+        fragment = reinterpret_cast<unsigned char*>(msg->frame.payload_data() + msg->sent_bytes);
+        fragment_len = is_control ? message_len : std::min(message_len - msg->sent_bytes, max_fragment_size);
+        is_end = msg->sent_bytes + fragment_len >= message_len;
+    }
+
+    const int flags = is_control ? msg->protocol : lws_write_ws_flags(msg->protocol, is_start, is_end);
+    const auto sent = lws_write(wsi, fragment, fragment_len, static_cast<lws_write_protocol>(flags));
 
     if (sent < 0) {
         // Fatal error, conn closed
         EVLOG_error << "Error sending message over TLS websocket, conn closed.";
-        msg->sent_bytes = 0;
         return false;
     }
 
-    // Even if we have written all the bytes to lws, it doesn't mean that it has been sent over
-    // the wire. According to the function comment (lws_write), until everything has been
-    // sent, the 'LWS_CALLBACK_CLIENT_WRITEABLE' callback will be suppressed. When we received
-    // another callback, it means that everything was sent and that we can mark the message
-    // as certainly 'sent' over the wire
-    msg->sent_bytes = sent;
-
-    if (static_cast<size_t>(sent) < message_len) {
+    // libwebsockets buffers what the socket did not accept and suppresses 'LWS_CALLBACK_CLIENT_WRITEABLE'
+    // until everything has been sent, so a fragment is either accepted completely or the connection is broken
+    if (static_cast<size_t>(sent) < fragment_len) {
         EVLOG_error << "Error sending message over TLS websocket. Sent bytes: " << sent
-                    << " Total to send: " << message_len;
+                    << " Total to send: " << fragment_len;
         return false;
     }
 
+    // Even if we have written all the bytes to lws, it doesn't mean that it has been sent over
+    // the wire. When we received another writable callback, it means that everything was sent
+    // and that we can mark the message as certainly 'sent' over the wire
+    msg->sent_bytes += fragment_len;
+    msg->final_fragment_written = is_end;
+
     return true;
 }
 
-void WebsocketTlsTPM::on_writable() {
+bool WebsocketTlsTPM::on_writable() {
     if (!this->initialized() || !this->m_is_connected) {
         EVLOG_error << "Message sending but TLS websocket has not been correctly initialized/connected.";
-        return;
+        return true;
     }
 
     std::shared_ptr<ConnectionData> local_data = conn_data;
 
     if (local_data == nullptr) {
         EVLOG_error << "Message sending TLS websocket with null connection data!";
-        return;
+        return true;
     }
 
     if (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED) {
         EVLOG_error << "Trying to write message to interrupted/finalized state!";
-        return;
+        return true;
     }
 
     // Execute while we have messages that were polled
     while (true) {
-        WebsocketMessage* message = nullptr;
+        std::shared_ptr<WebsocketMessage> message;
 
         {
             std::lock_guard<std::mutex> lock(this->queue_mutex);
@@ -905,7 +1081,7 @@ void WebsocketTlsTPM::on_writable() {
             if (message_queue.empty())
                 break;
 
-            message = message_queue.front().get();
+            message = message_queue.front();
         }
 
         if (message == nullptr) {
@@ -913,30 +1089,35 @@ void WebsocketTlsTPM::on_writable() {
         }
 
         // This message was polled in a previous iteration
-        if (message->sent_bytes >= message->payload.length()) {
+        if (message->final_fragment_written) {
             EVLOG_debug << "Websocket message fully written, popping processing thread from queue!";
 
             // If we have written all bytes to libwebsockets it means that if we received
-            // this writable callback everything is sent over the wire, mark the message
-            // as 'sent' and remove it from the queue
+            // this writable callback everything is sent over the wire, remove the message
+            // from the queue and mark it as 'sent'
             {
                 std::lock_guard<std::mutex> lock(this->queue_mutex);
-                message->message_sent = true;
-                message_queue.pop();
+                message_queue.pop_front();
+            }
+
+            if (message->protocol != LWS_WRITE_PING) {
+                this->raw_bytes_sent += message->sent_bytes;
+                if (!this->compression_active) {
+                    this->wire_bytes_sent += message->sent_bytes;
+                }
             }
 
-            EVLOG_debug << "Notifying waiting thread!";
-            // Notify any waiting thread to check it's state
-            msg_send_cv.notify_all();
+            EVLOG_debug << "Notifying sender!";
+            message->complete(true);
         } else {
             // If the message was not polled, we reached the first unpolled and break
             break;
         }
     }
 
-    // If we still have message ONLY poll a single one that can be processed in the invoke of the function
+    // If we still have message ONLY poll a single fragment that can be processed in the invoke of the function
     // libwebsockets is designed so that when a message is sent to the wire from the internal buffer it
-    // will invoke 'on_writable' again and we can execute the code above
+    // will invoke 'on_writable' again and we can execute the code above or continue with the next fragment
     bool any_message_polled;
     {
         std::lock_guard<std::mutex> lock(this->queue_mutex);
@@ -947,29 +1128,62 @@ void WebsocketTlsTPM::on_writable() {
     if (any_message_polled) {
         EVLOG_debug << "Client writable, sending message part!";
 
-        WebsocketMessage* message = nullptr;
+        std::shared_ptr<WebsocketMessage> message;
 
         {
             std::lock_guard<std::mutex> lock(this->queue_mutex);
-            message = message_queue.front().get();
+            message = message_queue.front();
         }
 
         if (message == nullptr) {
             EVLOG_AND_THROW(std::runtime_error("Null message in queue, fatal error!"));
         }
 
-        if (message->sent_bytes >= message->payload.length()) {
+        if (message->final_fragment_written) {
             EVLOG_AND_THROW(std::runtime_error("Already polled message should be handled above, fatal error!"));
         }
 
+        const auto max_fragment_size =
+            this->connection_options.max_fragment_size > 0
+                ? std::max(static_cast<size_t>(this->connection_options.max_fragment_size), WEBSOCKET_FRAME_HEADROOM)
+                : std::numeric_limits<size_t>::max();
+
+        if (message->sent_bytes == 0 && message->protocol != LWS_WRITE_PING) {
+            // The size of a streamed message is not known up front, those are large enough to be compressed
+            local_data->compress_message =
+                message->producer ||
+                message->frame.payload_size() >= this->connection_options.compression.min_message_size;
+        }
+
         // Continue sending message part, for a single message only
-        bool sent = send_internal(local_data->get_conn(), message);
+        bool sent = false;
+        try {
+            sent = send_internal(local_data->get_conn(), message.get(), max_fragment_size);
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not produce websocket message: " << e.what();
+        }
 
-        // If we failed, attempt again later
         if (!sent) {
-            message->sent_bytes = 0;
+            if (message->sent_bytes > 0) {
+                // A started message can not be retried, since its first fragments are already on the wire
+                EVLOG_error << "Could not write message completely, closing connection";
+                return false;
+            }
+            if (message->producer) {
+                // The producer can not be rewound
+                {
+                    std::lock_guard<std::mutex> lock(this->queue_mutex);
+                    if (!message_queue.empty() && message_queue.front() == message) {
+                        message_queue.pop_front();
+                    }
+                }
+                message->complete(false);
+            }
+            // Otherwise attempt again later
         }
     }
+
+    return true;
 }
 
 void WebsocketTlsTPM::request_write() {
@@ -987,62 +1201,109 @@ void WebsocketTlsTPM::request_write() {
     }
 }
 
-void WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg) {
-    if (this->m_is_connected == false) {
-        EVLOG_debug << "Trying to poll message without being connected!";
-        return;
+void WebsocketTlsTPM::fail_pending_messages() {
+    std::vector<std::shared_ptr<WebsocketMessage>> pending;
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+        pending.assign(message_queue.begin(), message_queue.end());
     }
 
-    std::shared_ptr<ConnectionData> local_data = conn_data;
+    // The messages stay queued until the next connect, their senders are notified right away
+    for (const auto& message : pending) {
+        message->complete(false);
+    }
+}
 
-    if (local_data != nullptr) {
-        auto cd_tid = local_data->get_lws_thread_id();
+WebsocketSendResult WebsocketTlsTPM::queue_message(const std::shared_ptr<WebsocketMessage>& msg) {
+    if (this->m_is_connected == false) {
+        EVLOG_debug << "Trying to queue message without being connected!";
+        return WebsocketSendResult::Failed;
+    }
 
-        if (std::this_thread::get_id() == cd_tid) {
-            EVLOG_AND_THROW(std::runtime_error("Deadlock detected, polling send from client lws thread!"));
-        }
+    std::shared_ptr<ConnectionData> local_data = conn_data;
 
-        // If we are interupted or finalized
-        if (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED) {
-            EVLOG_warning << "Trying to poll message to interrupted/finalized state!";
-            return;
-        }
+    // If we are interupted or finalized
+    if (local_data != nullptr &&
+        (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED)) {
+        EVLOG_warning << "Trying to queue message to interrupted/finalized state!";
+        return WebsocketSendResult::Failed;
     }
 
-    EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload;
+    EVLOG_debug << "Queueing message over TLS websocket: " << msg->frame.payload();
 
     {
         std::lock_guard<std::mutex> lock(this->queue_mutex);
-        message_queue.emplace(msg);
+        if (this->connection_options.max_outbound_queue_size > 0 &&
+            message_queue.size() >= static_cast<size_t>(this->connection_options.max_outbound_queue_size)) {
+            EVLOG_debug << "Outbound queue of TLS websocket is full (" << message_queue.size()
+                        << " messages), rejecting message";
+            return WebsocketSendResult::WouldBlock;
+        }
+        message_queue.push_back(msg);
     }
 
     // Request a write callback
     request_write();
 
-    {
-        std::unique_lock lock(this->msg_send_cv_mutex);
-        if (msg_send_cv.wait_for(lock, std::chrono::seconds(20), [&] { return (true == msg->message_sent); })) {
-            EVLOG_debug << "Successfully sent last message over TLS websocket!";
-        } else {
-            EVLOG_warning << "Could not send last message over TLS websocket!";
-        }
-    }
+    return WebsocketSendResult::Accepted;
 }
 
 // Will be called from external threads
 bool WebsocketTlsTPM::send(const std::string& message) {
+    std::shared_ptr<ConnectionData> local_data = conn_data;
+    if (local_data != nullptr && std::this_thread::get_id() == local_data->get_lws_thread_id()) {
+        EVLOG_AND_THROW(std::runtime_error("Deadlock detected, waiting for send from client lws thread!"));
+    }
+
+    auto sent_promise = std::make_shared<std::promise<bool>>();
+    auto sent_future = sent_promise->get_future();
+
+    if (this->send_async(WebsocketFrameBuffer(message), [sent_promise](bool sent) { sent_promise->set_value(sent); }) !=
+        WebsocketSendResult::Accepted) {
+        EVLOG_warning << "Could not queue last message for TLS websocket!";
+        return false;
+    }
+
+    if (sent_future.wait_for(std::chrono::seconds(20)) == std::future_status::ready && sent_future.get()) {
+        EVLOG_debug << "Successfully sent last message over TLS websocket!";
+        return true;
+    }
+
+    EVLOG_warning << "Could not send last message over TLS websocket!";
+    return false;
+}
+
+WebsocketSendResult WebsocketTlsTPM::send_async(WebsocketFrameBuffer&& frame,
+                                                const std::function<void(bool sent)>& on_sent) {
     if (!this->initialized()) {
         EVLOG_error << "Could not send message because websocket is not properly initialized.";
-        return false;
+        return WebsocketSendResult::Failed;
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = std::move(message);
-    msg->protocol = LWS_WRITE_TEXT;
+    auto msg = std::make_shared<WebsocketMessage>(std::move(frame), LWS_WRITE_TEXT);
+    return this->queue_message_with_callback(msg, on_sent);
+}
+
+WebsocketSendResult WebsocketTlsTPM::send_stream_async(WebsocketPayloadProducer&& producer,
+                                                       const std::function<void(bool sent)>& on_sent) {
+    if (!this->initialized()) {
+        EVLOG_error << "Could not send message because websocket is not properly initialized.";
+        return WebsocketSendResult::Failed;
+    }
 
-    poll_message(msg);
+    auto msg = std::make_shared<WebsocketMessage>(std::move(producer), LWS_WRITE_TEXT);
+    return this->queue_message_with_callback(msg, on_sent);
+}
 
-    return msg->message_sent;
+WebsocketSendResult WebsocketTlsTPM::queue_message_with_callback(const std::shared_ptr<WebsocketMessage>& msg,
+                                                                 const std::function<void(bool sent)>& on_sent) {
+    msg->on_sent = on_sent;
+    const auto result = queue_message(msg);
+    if (result != WebsocketSendResult::Accepted) {
+        // the sender learns about a rejected message from the result, not from the destroyed message
+        msg->on_sent = nullptr;
+    }
+    return result;
 }
 
 void WebsocketTlsTPM::ping() {
@@ -1050,11 +1311,63 @@ void WebsocketTlsTPM::ping() {
         EVLOG_error << "Could not send ping because websocket is not properly initialized.";
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = this->connection_options.ping_payload;
-    msg->protocol = LWS_WRITE_PING;
+    auto msg =
+        std::make_shared<WebsocketMessage>(WebsocketFrameBuffer(this->connection_options.ping_payload), LWS_WRITE_PING);
 
-    poll_message(msg);
+    queue_message(msg);
+}
+
+void WebsocketTlsTPM::on_compressed_traffic(size_t wire_bytes_sent, size_t wire_bytes_received) {
+    this->wire_bytes_sent += wire_bytes_sent;
+    this->wire_bytes_received += wire_bytes_received;
+}
+
+bool WebsocketTlsTPM::read_compression_response(void* wsi_ptr) {
+    lws* wsi = reinterpret_cast<lws*>(wsi_ptr);
+
+    const int length = lws_hdr_total_length(wsi, WSI_TOKEN_EXTENSIONS);
+    if (length <= 0) {
+        EVLOG_info << "Server did not accept websocket compression";
+        return false;
+    }
+
+    std::string extensions(length + 1, '\0');
+    if (lws_hdr_copy(wsi, extensions.data(), length + 1, WSI_TOKEN_EXTENSIONS) < 0) {
+        return false;
+    }
+    extensions.resize(length);
+
+    if (extensions.find(permessage_deflate_name) == std::string::npos) {
+        EVLOG_info << "Server did not accept websocket compression";
+        return false;
+    }
+
+    // The server may restrict our window further than we offered
+    this->compression_window_bits = std::clamp(this->connection_options.compression.window_bits,
+                                               MIN_COMPRESSION_WINDOW_BITS, MAX_COMPRESSION_WINDOW_BITS);
+    const std::string client_window_bits = "client_max_window_bits=";
+    const auto pos = extensions.find(client_window_bits);
+    if (pos != std::string::npos) {
+        const auto server_window_bits = std::atoi(extensions.c_str() + pos + client_window_bits.size());
+        if (server_window_bits >= MIN_COMPRESSION_WINDOW_BITS) {
+            this->compression_window_bits = std::min(this->compression_window_bits, server_window_bits);
+        }
+    }
+
+    EVLOG_info << "Websocket compression negotiated: " << extensions;
+    return true;
+}
+
+void WebsocketTlsTPM::apply_compression_options(void* wsi_ptr) {
+    lws* wsi = reinterpret_cast<lws*>(wsi_ptr);
+
+    const auto window_bits = std::to_string(this->compression_window_bits);
+    const auto memory_level = std::to_string(std::clamp(this->connection_options.compression.memory_level, 1, 9));
+
+    if (lws_set_extension_option(wsi, permessage_deflate_name, "client_max_window_bits", window_bits.c_str()) ||
+        lws_set_extension_option(wsi, permessage_deflate_name, "mem_level", memory_level.c_str())) {
+        EVLOG_warning << "Could not apply websocket compression options, using the defaults of libwebsockets";
+    }
 }
 
 int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len) {
@@ -1162,12 +1475,21 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
         data->update_state(EConnectionState::CONNECTING);
         break;
 
+    case LWS_CALLBACK_CLIENT_FILTER_PRE_ESTABLISH:
+        // Response headers are only available until the connection is established
+        this->compression_active = this->connection_options.compression.enabled && read_compression_response(wsi);
+        break;
+
     case LWS_CALLBACK_CLIENT_ESTABLISHED:
         if (data->get_state() == EConnectionState::CONNECTING) {
             data->update_state(EConnectionState::CONNECTED);
             conn_cv.notify_one();
         }
 
+        if (this->compression_active) {
+            apply_compression_options(wsi);
+        }
+
         on_conn_connected();
 
         // Attempt first write after connection
@@ -1212,7 +1534,9 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
         break;
 
     case LWS_CALLBACK_CLIENT_WRITEABLE:
-        on_writable();
+        if (!on_writable()) {
+            return LWS_CLOSE_SOCKET_RESPONSE_MESSAGE;
+        }
         {
             bool message_queue_empty;
             {
@@ -1237,12 +1561,8 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
     } break;
 
     case LWS_CALLBACK_CLIENT_RECEIVE:
-        recv_buffered_message.append(reinterpret_cast<char*>(in), reinterpret_cast<char*>(in) + len);
-
-        // Message is complete
-        if (lws_remaining_packet_payload(wsi) <= 0) {
-            on_message(std::move(recv_buffered_message));
-            recv_buffered_message.clear();
+        if (!on_receive(wsi, reinterpret_cast<const char*>(in), len)) {
+            return LWS_CLOSE_SOCKET_RESPONSE_MESSAGE;
         }
 
         {
@@ -126,6 +126,8 @@ bool WebsocketPlain::send(const std::string& message) {
     }
 
     EVLOG_debug << "Sent message over plain websocket: " << message;
+    this->raw_bytes_sent += message.size();
+    this->wire_bytes_sent += message.size();
 
     return true;
 }
@@ -173,6 +175,16 @@ void WebsocketPlain::connect_plain() {
         EVLOG_error << "Connection initialization error for plain websocket: " << ec.message();
     }
 
+    if (this->connection_options.max_inbound_message_size > 0) {
+        // websocketpp closes the connection with 1009 (message too big) when a message exceeds this
+        con->set_max_message_size(this->connection_options.max_inbound_message_size);
+    }
+
+    if (this->connection_options.compression.enabled) {
+        // websocketpp only implements the server side of permessage-deflate
+        EVLOG_warning << "Websocket compression is not supported by the plain websocket, connecting without it";
+    }
+
     if (this->connection_options.hostName.has_value()) {
         EVLOG_info << "User-Host is set to " << this->connection_options.hostName.value();
         con->append_header("User-Host", this->connection_options.hostName.value());
@@ -219,6 +231,7 @@ void WebsocketPlain::on_open_plain(client* c, websocketpp::connection_hdl hdl) {
     this->connection_attempts = 1; // reset connection attempts
     this->m_is_connected = true;
     this->reconnecting = false;
+    this->reset_traffic_statistics();
     this->set_websocket_ping_interval(this->connection_options.ping_interval_s);
     this->connected_callback(this->connection_options.security_profile);
 }
@@ -230,6 +243,8 @@ void WebsocketPlain::on_message_plain(websocketpp::connection_hdl hdl, client::m
     }
     try {
         auto message = msg->get_payload();
+        this->raw_bytes_received += message.size();
+        this->wire_bytes_received += message.size();
         this->message_callback(message);
     } catch (websocketpp::exception const& e) {
         EVLOG_error << "Plain websocket exception on receiving message: " << e.what();
@@ -241,6 +256,7 @@ void WebsocketPlain::on_close_plain(client* c, websocketpp::connection_hdl hdl)
     this->m_is_connected = false;
     this->disconnected_callback();
     this->cancel_reconnect_timer();
+    this->log_traffic_statistics();
     client::connection_ptr con = c->get_con_from_hdl(hdl);
     auto error_code = con->get_ec();
     EVLOG_info << "Closed plain websocket connection with code: " << error_code << " ("
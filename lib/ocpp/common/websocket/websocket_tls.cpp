@@ -106,6 +106,8 @@ bool WebsocketTLS::send(const std::string& message) {
     }
 
     EVLOG_debug << "Sent message over TLS websocket: " << message;
+    this->raw_bytes_sent += message.size();
+    this->wire_bytes_sent += message.size();
 
     return true;
 }
@@ -273,6 +275,16 @@ void WebsocketTLS::connect_tls() {
         EVLOG_error << "Connection initialization error for TLS websocket: " << ec.message();
     }
 
+    if (this->connection_options.max_inbound_message_size > 0) {
+        // websocketpp closes the connection with 1009 (message too big) when a message exceeds this
+        con->set_max_message_size(this->connection_options.max_inbound_message_size);
+    }
+
+    if (this->connection_options.compression.enabled) {
+        // websocketpp only implements the server side of permessage-deflate
+        EVLOG_warning << "Websocket compression is not supported by the TLS websocket, connecting without it";
+    }
+
     if (this->connection_options.hostName.has_value()) {
         EVLOG_info << "User-Host is set to " << this->connection_options.hostName.value();
         con->append_header("User-Host", this->connection_options.hostName.value());
@@ -318,6 +330,7 @@ void WebsocketTLS::on_open_tls(tls_client* c, websocketpp::connection_hdl hdl) {
     this->connection_attempts = 1; // reset connection attempts
     this->m_is_connected = true;
     this->reconnecting = false;
+    this->reset_traffic_statistics();
     this->set_websocket_ping_interval(this->connection_options.ping_interval_s);
     this->connected_callback(this->connection_options.security_profile);
 }
@@ -329,6 +342,8 @@ void WebsocketTLS::on_message_tls(websocketpp::connection_hdl hdl, tls_client::m
     }
     try {
         auto message = msg->get_payload();
+        this->raw_bytes_received += message.size();
+        this->wire_bytes_received += message.size();
         this->message_callback(message);
     } catch (websocketpp::exception const& e) {
         EVLOG_error << "TLS websocket exception on receiving message: " << e.what();
@@ -339,6 +354,7 @@ void WebsocketTLS::on_close_tls(tls_client* c, websocketpp::connection_hdl hdl)
     this->m_is_connected = false;
     this->disconnected_callback();
     this->cancel_reconnect_timer();
+    this->log_traffic_statistics();
     tls_client::connection_ptr con = c->get_con_from_hdl(hdl);
     auto error_code = con->get_ec();
 
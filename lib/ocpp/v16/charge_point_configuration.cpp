@@ -508,7 +508,7 @@ KeyValue ChargePointConfiguration::getSupportedChargingProfilePurposeTypesKeyVal
     kv.readonly = true;
     std::vector<std::string> purpose_types;
     for (const auto& entry : this->getSupportedChargingProfilePurposeTypes()) {
-        purpose_types.push_back(conversions::charging_profile_purpose_type_to_string(entry));
+        purpose_types.emplace_back(conversions::charging_profile_purpose_type_to_string(entry));
     }
     kv.value.emplace(to_csl(purpose_types));
     return kv;
@@ -769,6 +769,22 @@ std::optional<std::string> ChargePointConfiguration::getIFace() {
     return iFace_key;
 }
 
+std::optional<bool> ChargePointConfiguration::getWebsocketPerMessageDeflate() {
+    std::optional<bool> per_message_deflate = std::nullopt;
+    if (this->config["Internal"].contains("WebsocketPerMessageDeflate")) {
+        per_message_deflate.emplace(this->config["Internal"]["WebsocketPerMessageDeflate"]);
+    }
+    return per_message_deflate;
+}
+
+std::optional<int> ChargePointConfiguration::getMaxInboundMessageSize() {
+    std::optional<int> max_inbound_message_size = std::nullopt;
+    if (this->config["Internal"].contains("MaxInboundMessageSize")) {
+        max_inbound_message_size.emplace(this->config["Internal"]["MaxInboundMessageSize"]);
+    }
+    return max_inbound_message_size;
+}
+
 std::optional<bool> ChargePointConfiguration::getQueueAllMessages() {
     std::optional<bool> queue_all_messages = std::nullopt;
     if (this->config["Internal"].contains("QueueAllMessages")) {
@@ -811,6 +827,90 @@ std::optional<KeyValue> ChargePointConfiguration::getMessageQueueSizeThresholdKe
     return message_queue_size_threshold_kv;
 }
 
+std::optional<int> ChargePointConfiguration::getTransactionQueueCommitInterval() {
+    std::optional<int> transaction_queue_commit_interval = std::nullopt;
+    if (this->config["Internal"].contains("TransactionQueueCommitInterval")) {
+        transaction_queue_commit_interval.emplace(this->config["Internal"]["TransactionQueueCommitInterval"]);
+    }
+    return transaction_queue_commit_interval;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getTransactionQueueCommitIntervalKeyValue() {
+    std::optional<KeyValue> transaction_queue_commit_interval_kv = std::nullopt;
+    auto transaction_queue_commit_interval = this->getTransactionQueueCommitInterval();
+    if (transaction_queue_commit_interval.has_value()) {
+        KeyValue kv;
+        kv.key = "TransactionQueueCommitInterval";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(transaction_queue_commit_interval.value()));
+        transaction_queue_commit_interval_kv.emplace(kv);
+    }
+    return transaction_queue_commit_interval_kv;
+}
+
+std::optional<bool> ChargePointConfiguration::getStrictMessageValidation() {
+    std::optional<bool> strict_message_validation = std::nullopt;
+    if (this->config["Internal"].contains("StrictMessageValidation")) {
+        strict_message_validation.emplace(this->config["Internal"]["StrictMessageValidation"]);
+    }
+    return strict_message_validation;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getStrictMessageValidationKeyValue() {
+    std::optional<KeyValue> strict_message_validation_kv = std::nullopt;
+    auto strict_message_validation = this->getStrictMessageValidation();
+    if (strict_message_validation.has_value()) {
+        KeyValue kv;
+        kv.key = "StrictMessageValidation";
+        kv.readonly = true;
+        kv.value.emplace(ocpp::conversions::bool_to_string(strict_message_validation.value()));
+        strict_message_validation_kv.emplace(kv);
+    }
+    return strict_message_validation_kv;
+}
+
+std::optional<int> ChargePointConfiguration::getTransactionUpdateCompactionItemsPerMessage() {
+    std::optional<int> items_per_message = std::nullopt;
+    if (this->config["Internal"].contains("TransactionUpdateCompactionItemsPerMessage")) {
+        items_per_message.emplace(this->config["Internal"]["TransactionUpdateCompactionItemsPerMessage"]);
+    }
+    return items_per_message;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getTransactionUpdateCompactionItemsPerMessageKeyValue() {
+    std::optional<KeyValue> items_per_message_kv = std::nullopt;
+    auto items_per_message = this->getTransactionUpdateCompactionItemsPerMessage();
+    if (items_per_message.has_value()) {
+        KeyValue kv;
+        kv.key = "TransactionUpdateCompactionItemsPerMessage";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(items_per_message.value()));
+        items_per_message_kv.emplace(kv);
+    }
+    return items_per_message_kv;
+}
+
+std::optional<int> ChargePointConfiguration::getTransactionUpdateCompactionBytesPerMessage() {
+    std::optional<int> bytes_per_message = std::nullopt;
+    if (this->config["Internal"].contains("TransactionUpdateCompactionBytesPerMessage")) {
+        bytes_per_message.emplace(this->config["Internal"]["TransactionUpdateCompactionBytesPerMessage"]);
+    }
+    return bytes_per_message;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getTransactionUpdateCompactionBytesPerMessageKeyValue() {
+    std::optional<KeyValue> bytes_per_message_kv = std::nullopt;
+    auto bytes_per_message = this->getTransactionUpdateCompactionBytesPerMessage();
+    if (bytes_per_message.has_value()) {
+        KeyValue kv;
+        kv.key = "TransactionUpdateCompactionBytesPerMessage";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(bytes_per_message.value()));
+        bytes_per_message_kv.emplace(kv);
+    }
+    return bytes_per_message_kv;
+}
+
 // Core Profile - optional
 std::optional<bool> ChargePointConfiguration::getAllowOfflineTxForUnknownId() {
     std::optional<bool> unknown_offline_auth = std::nullopt;
@@ -1524,6 +1624,32 @@ std::optional<KeyValue> ChargePointConfiguration::getIFaceKeyValue() {
     return iface_name_kv;
 }
 
+std::optional<KeyValue> ChargePointConfiguration::getWebsocketPerMessageDeflateKeyValue() {
+    std::optional<KeyValue> per_message_deflate_kv = std::nullopt;
+    auto per_message_deflate = this->getWebsocketPerMessageDeflate();
+    if (per_message_deflate.has_value()) {
+        KeyValue kv;
+        kv.key = "WebsocketPerMessageDeflate";
+        kv.readonly = true;
+        kv.value.emplace(ocpp::conversions::bool_to_string(per_message_deflate.value()));
+        per_message_deflate_kv.emplace(kv);
+    }
+    return per_message_deflate_kv;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMaxInboundMessageSizeKeyValue() {
+    std::optional<KeyValue> max_inbound_message_size_kv = std::nullopt;
+    auto max_inbound_message_size = this->getMaxInboundMessageSize();
+    if (max_inbound_message_size.has_value()) {
+        KeyValue kv;
+        kv.key = "MaxInboundMessageSize";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(max_inbound_message_size.value()));
+        max_inbound_message_size_kv.emplace(kv);
+    }
+    return max_inbound_message_size_kv;
+}
+
 // Core Profile end
 
 int32_t ChargePointConfiguration::getChargeProfileMaxStackLevel() {
@@ -2342,6 +2468,12 @@ std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
     if (key == "HostName") {
         return this->getHostNameKeyValue();
     }
+    if (key == "WebsocketPerMessageDeflate") {
+        return this->getWebsocketPerMessageDeflateKeyValue();
+    }
+    if (key == "MaxInboundMessageSize") {
+        return this->getMaxInboundMessageSizeKeyValue();
+    }
     if (key == "SupportedMeasurands") {
         return this->getSupportedMeasurandsKeyValue();
     }
@@ -2351,6 +2483,18 @@ std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
     if (key == "MessageQueueSizeThreshold") {
         return this->getMessageQueueSizeThresholdKeyValue();
     }
+    if (key == "TransactionQueueCommitInterval") {
+        return this->getTransactionQueueCommitIntervalKeyValue();
+    }
+    if (key == "StrictMessageValidation") {
+        return this->getStrictMessageValidationKeyValue();
+    }
+    if (key == "TransactionUpdateCompactionItemsPerMessage") {
+        return this->getTransactionUpdateCompactionItemsPerMessageKeyValue();
+    }
+    if (key == "TransactionUpdateCompactionBytesPerMessage") {
+        return this->getTransactionUpdateCompactionBytesPerMessageKeyValue();
+    }
 
     // Core Profile
     if (key == "AllowOfflineTxForUnknownId") {
@@ -45,10 +45,14 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     this->configuration = std::make_shared<ocpp::v16::ChargePointConfiguration>(config, share_path, user_config_path);
     this->heartbeat_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() { this->heartbeat(); });
     this->heartbeat_interval = this->configuration->getHeartbeatInterval();
-    auto database_connection =
-        std::make_unique<common::DatabaseConnection>(database_path / (this->configuration->getChargePointId() + ".db"));
-    this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path,
-                                                               this->configuration->getNumberOfConnectors());
+    const auto database_file_path = database_path / (this->configuration->getChargePointId() + ".db");
+    auto database_connection = std::make_unique<common::DatabaseConnection>(database_file_path);
+    // the transaction queue is written in batches from its own thread, so it gets its own connection
+    auto transaction_queue_connection = std::make_unique<common::DatabaseConnection>(database_file_path);
+    this->database_handler =
+        std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path,
+                                          this->configuration->getNumberOfConnectors(),
+                                          std::move(transaction_queue_connection));
     this->database_handler->open_connection();
     this->transaction_handler = std::make_unique<TransactionHandler>(this->configuration->getNumberOfConnectors());
     this->external_notify = {v16::MessageType::StartTransactionResponse};
@@ -127,23 +131,28 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
 
     // ISO15118 PnC handlers
     if (this->configuration->getSupportedFeatureProfilesSet().count(SupportedFeatureProfiles::PnC)) {
-        this->data_transfer_pnc_callbacks[conversions::messagetype_to_string(MessageType::TriggerMessage)] =
+        this->data_transfer_pnc_callbacks[std::string(
+            conversions::messagetype_to_string(MessageType::TriggerMessage))] =
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_pnc_trigger_message(call);
             };
-        this->data_transfer_pnc_callbacks[conversions::messagetype_to_string(MessageType::CertificateSigned)] =
+        this->data_transfer_pnc_callbacks[std::string(
+            conversions::messagetype_to_string(MessageType::CertificateSigned))] =
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_pnc_certificate_signed(call);
             };
-        this->data_transfer_pnc_callbacks[conversions::messagetype_to_string(MessageType::GetInstalledCertificateIds)] =
+        this->data_transfer_pnc_callbacks[std::string(
+            conversions::messagetype_to_string(MessageType::GetInstalledCertificateIds))] =
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_pnc_get_installed_certificates(call);
             };
-        this->data_transfer_pnc_callbacks[conversions::messagetype_to_string(MessageType::DeleteCertificate)] =
+        this->data_transfer_pnc_callbacks[std::string(
+            conversions::messagetype_to_string(MessageType::DeleteCertificate))] =
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_delete_certificate(call);
             };
-        this->data_transfer_pnc_callbacks[conversions::messagetype_to_string(MessageType::InstallCertificate)] =
+        this->data_transfer_pnc_callbacks[std::string(
+            conversions::messagetype_to_string(MessageType::InstallCertificate))] =
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_install_certificate(call);
             };
@@ -155,14 +164,40 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
 }
 
 std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_message_queue() {
-    return std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig{
-            this->configuration->getTransactionMessageAttempts(),
-            this->configuration->getTransactionMessageRetryInterval(),
-            this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->configuration->getQueueAllMessages().value_or(false)},
-        this->external_notify, this->database_handler);
+    MessageQueueConfig message_queue_config{
+        this->configuration->getTransactionMessageAttempts(),
+        this->configuration->getTransactionMessageRetryInterval(),
+        this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->configuration->getQueueAllMessages().value_or(false)};
+    message_queue_config.transaction_message_commit_interval_ms =
+        this->configuration->getTransactionQueueCommitInterval().value_or(0);
+    message_queue_config.strict_message_validation = this->configuration->getStrictMessageValidation().value_or(false);
+    message_queue_config.transaction_update_compaction_items_per_message =
+        this->configuration->getTransactionUpdateCompactionItemsPerMessage().value_or(0);
+    message_queue_config.transaction_update_compaction_bytes_per_message =
+        this->configuration->getTransactionUpdateCompactionBytesPerMessage().value_or(0);
+
+    auto message_queue = std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
+        [this](const json& message, const std::function<void(bool sent)>& on_sent) {
+            return this->websocket->send(message, on_sent);
+        },
+        message_queue_config, this->external_notify, this->database_handler);
+    message_queue->set_write_callback(
+        [this](const JsonWriteFunction& write, const std::function<void(bool sent)>& on_sent) {
+            return this->websocket->send(write, on_sent);
+        });
+    // potentially large requests are read directly into their typed representation
+    message_queue->set_raw_message_types({MessageType::SetChargingProfile, MessageType::SendLocalList});
+    // after a reconnect only the latest status of every connector is of interest, and a single queued heartbeat answers
+    // all heartbeats sent meanwhile
+    message_queue->set_coalescing_rule(
+        MessageType::StatusNotification,
+        {CoalescingPolicy::LatestWins,
+         [](const json& payload) -> std::optional<std::string> { return payload.at("connectorId").dump(); }});
+    message_queue->set_coalescing_rule(
+        MessageType::Heartbeat,
+        {CoalescingPolicy::FirstWins, [](const json&) -> std::optional<std::string> { return std::string(); }});
+    return message_queue;
 }
 
 void ChargePointImpl::init_websocket() {
@@ -253,6 +288,9 @@ WebsocketConnectionOptions ChargePointImpl::get_ws_connection_options() {
                                                   this->configuration->getUseTPM(),
                                                   this->configuration->getVerifyCsmsAllowWildcards(),
                                                   this->configuration->getIFace()};
+    connection_options.compression.enabled = this->configuration->getWebsocketPerMessageDeflate().value_or(false);
+    connection_options.max_inbound_message_size =
+        this->configuration->getMaxInboundMessageSize().value_or(DEFAULT_MAX_INBOUND_MESSAGE_SIZE);
     return connection_options;
 }
 
@@ -1016,8 +1054,9 @@ void ChargePointImpl::message_callback(const std::string& message) {
     EVLOG_debug << "Received Message: " << message;
     // EVLOG_debug << "json message: " << json_message;
     auto enhanced_message = this->message_queue->receive(message);
-    auto json_message = enhanced_message.message;
-    this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    const auto& json_message = enhanced_message.message;
+    this->logging->central_system(std::string(conversions::messagetype_to_string(enhanced_message.messageType)),
+                                  message);
     try {
         // reject unsupported messages
         if (this->configuration->getSupportedMessageTypesReceiving().count(enhanced_message.messageType) == 0) {
@@ -1034,6 +1073,16 @@ void ChargePointImpl::message_callback(const std::string& message) {
             return;
         }
 
+        if (enhanced_message.messageTypeId == MessageTypeId::CALL && !enhanced_message.validation_error.empty()) {
+            EVLOG_error << "Received an invalid " << enhanced_message.messageType << ": "
+                        << enhanced_message.validation_error;
+            auto call_error = CallError(enhanced_message.uniqueId, "FormationViolation",
+                                        enhanced_message.validation_error, json({}, true));
+            this->send(call_error);
+            this->securityEventNotification(ocpp::security_events::INVALIDMESSAGES, message, true);
+            return;
+        }
+
         switch (this->connection_state) {
         case ChargePointConnectionState::Disconnected: {
             EVLOG_error << "Received a message in disconnected state, this cannot be correct";
@@ -1092,9 +1141,11 @@ void ChargePointImpl::message_callback(const std::string& message) {
         }
     } catch (json::exception& e) {
         EVLOG_error << "JSON exception during handling of message: " << e.what();
-        if (json_message.is_array() && json_message.size() > MESSAGE_ID) {
-            auto call_error = CallError(MessageId(json_message.at(MESSAGE_ID).get<std::string>()), "FormationViolation",
-                                        e.what(), json({}, true));
+        if (!enhanced_message.raw_message.empty() || (json_message.is_array() && json_message.size() > MESSAGE_ID)) {
+            const auto unique_id = enhanced_message.raw_message.empty()
+                                       ? MessageId(json_message.at(MESSAGE_ID).get<std::string>())
+                                       : enhanced_message.uniqueId;
+            auto call_error = CallError(unique_id, "FormationViolation", e.what(), json({}, true));
             this->send(call_error);
             this->securityEventNotification(ocpp::security_events::INVALIDMESSAGES, message, true);
         }
@@ -1163,7 +1214,8 @@ void ChargePointImpl::handle_message(const EnhancedMessage<v16::MessageType>& me
         break;
 
     case MessageType::SetChargingProfile:
-        this->handleSetChargingProfileRequest(json_message);
+        this->handleSetChargingProfileRequest(
+            from_json_string<ocpp::Call<SetChargingProfileRequest>>(message.raw_message));
         break;
 
     case MessageType::GetCompositeSchedule:
@@ -1219,7 +1271,7 @@ void ChargePointImpl::handle_message(const EnhancedMessage<v16::MessageType>& me
         break;
 
     case MessageType::SendLocalList:
-        this->handleSendLocalListRequest(json_message);
+        this->handleSendLocalListRequest(from_json_string<ocpp::Call<SendLocalListRequest>>(message.raw_message));
         break;
 
     case MessageType::GetLocalListVersion:
@@ -191,7 +191,7 @@ void ChargePointStates::reset(std::map<int, ChargePointStatus> connector_status_
         if (connector_id == 0 and initial_state != ChargePointStatus::Available and
             initial_state != ChargePointStatus::Unavailable and initial_state != ChargePointStatus::Faulted) {
             throw std::runtime_error("Invalid initial status for connector 0: " +
-                                     conversions::charge_point_status_to_string(initial_state));
+                                     std::string(conversions::charge_point_status_to_string(initial_state)));
         } else if (connector_id == 0) {
             state_machine_connector_zero = std::make_unique<ChargePointFSM>(
                 [this](const ChargePointStatus status, const ChargePointErrorCode error_code,
@@ -3,6 +3,7 @@
 
 #include <everest/logging.hpp>
 
+#include <ocpp/common/database/json_encoding.hpp>
 #include <ocpp/v16/database_handler.hpp>
 
 namespace ocpp {
@@ -12,8 +13,10 @@ using namespace common;
 namespace v16 {
 
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
-                                 const fs::path& sql_migration_files_path, int32_t number_of_connectors) :
-    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V16),
+                                 const fs::path& sql_migration_files_path, int32_t number_of_connectors,
+                                 std::unique_ptr<DatabaseConnectionInterface> transaction_queue_database) :
+    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V16,
+                          std::move(transaction_queue_database)),
     number_of_connectors(number_of_connectors) {
 }
 
@@ -24,6 +27,17 @@ void DatabaseHandler::init_sql() {
     } catch (const QueryExecutionException& e) {
         EVLOG_warning << "Could not insert or ignore version into AUTH_LIST_VERSION table: " << e.what();
     }
+
+    // profiles that have been persisted before binary encodings were added, they can still be read if this fails
+    try {
+        const auto converted =
+            convert_json_text_documents(*this->database, "CHARGING_PROFILES", "PROFILE", "PROFILE_ENCODING");
+        if (converted > 0) {
+            EVLOG_info << "Converted " << converted << " charging profiles to binary encoding";
+        }
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Could not convert charging profiles to binary encoding: " << e.what();
+    }
 }
 
 void DatabaseHandler::init_connector_table() {
@@ -111,7 +125,7 @@ void DatabaseHandler::update_transaction(const std::string& session_id, int32_t
         stmt->bind_text("@id_tag_end", id_tag_end.value().get(), SQLiteString::Transient);
     }
     if (stop_reason.has_value()) {
-        stmt->bind_text("@stop_reason", v16::conversions::reason_to_string(stop_reason.value()),
+        stmt->bind_text("@stop_reason", std::string(v16::conversions::reason_to_string(stop_reason.value())),
                         SQLiteString::Transient);
     }
     stmt->bind_text("@last_update", ocpp::DateTime().to_rfc3339(), SQLiteString::Transient);
@@ -220,7 +234,7 @@ void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<
     auto stmt = this->database->new_statement(sql);
 
     stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
-    stmt->bind_text("@auth_status", v16::conversions::authorization_status_to_string(id_tag_info.status),
+    stmt->bind_text("@auth_status", std::string(v16::conversions::authorization_status_to_string(id_tag_info.status)),
                     SQLiteString::Transient);
     if (id_tag_info.expiryDate.has_value()) {
         stmt->bind_text("@expiry_date", id_tag_info.expiryDate.value().to_rfc3339(), SQLiteString::Transient);
@@ -291,7 +305,7 @@ void DatabaseHandler::insert_or_update_connector_availability(int32_t connector,
     auto stmt = this->database->new_statement(sql);
 
     stmt->bind_int("@id", connector);
-    stmt->bind_text("@availability", v16::conversions::availability_type_to_string(availability_type),
+    stmt->bind_text("@availability", std::string(v16::conversions::availability_type_to_string(availability_type)),
                     SQLiteString::Transient);
 
     if (stmt->step() != SQLITE_DONE) {
@@ -391,7 +405,7 @@ void DatabaseHandler::insert_or_update_local_authorization_list_entry(const CiSt
     auto stmt = this->database->new_statement(sql);
 
     stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
-    stmt->bind_text("@auth_status", v16::conversions::authorization_status_to_string(id_tag_info.status),
+    stmt->bind_text("@auth_status", std::string(v16::conversions::authorization_status_to_string(id_tag_info.status)),
                     SQLiteString::Transient);
     if (id_tag_info.expiryDate.has_value()) {
         stmt->bind_text("@expiry_date", id_tag_info.expiryDate.value().to_rfc3339(), SQLiteString::Transient);
@@ -491,15 +505,15 @@ void DatabaseHandler::clear_local_authorization_list() {
 
 void DatabaseHandler::insert_or_update_charging_profile(const int connector_id, const v16::ChargingProfile& profile) {
     // add or replace
-    std::string sql = "INSERT OR REPLACE INTO CHARGING_PROFILES (ID, CONNECTOR_ID, PROFILE) VALUES "
-                      "(@id, @connector_id, @profile)";
+    std::string sql = "INSERT OR REPLACE INTO CHARGING_PROFILES (ID, CONNECTOR_ID, PROFILE, PROFILE_ENCODING) VALUES "
+                      "(@id, @connector_id, @profile, @profile_encoding)";
     auto stmt = this->database->new_statement(sql);
 
     json json_profile(profile);
 
     stmt->bind_int("@id", profile.chargingProfileId);
     stmt->bind_int("@connector_id", connector_id);
-    stmt->bind_text("@profile", json_profile.dump(), SQLiteString::Transient);
+    bind_json(*stmt, "@profile", "@profile_encoding", json_profile);
 
     if (stmt->step() != SQLITE_DONE) {
         throw QueryExecutionException(this->database->get_error_message());
@@ -526,12 +540,12 @@ void DatabaseHandler::delete_charging_profiles() {
 std::vector<v16::ChargingProfile> DatabaseHandler::get_charging_profiles() {
 
     std::vector<v16::ChargingProfile> profiles;
-    std::string sql = "SELECT * FROM CHARGING_PROFILES";
+    std::string sql = "SELECT PROFILE, PROFILE_ENCODING FROM CHARGING_PROFILES";
     auto stmt = this->database->new_statement(sql);
 
     int status;
     while ((status = stmt->step()) == SQLITE_ROW) {
-        profiles.emplace_back(json::parse(stmt->column_text(2)));
+        profiles.emplace_back(column_json(*stmt, 0, 1));
     }
 
     if (status != SQLITE_DONE) {
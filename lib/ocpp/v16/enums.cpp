@@ -9,7 +9,7 @@ namespace v16 {
 
 // from: AuthorizeResponse
 namespace conversions {
-std::string authorization_status_to_string(AuthorizationStatus e) {
+std::string_view authorization_status_to_string(AuthorizationStatus e) {
     switch (e) {
     case AuthorizationStatus::Accepted:
         return "Accepted";
@@ -27,20 +27,36 @@ std::string authorization_status_to_string(AuthorizationStatus e) {
 }
 
 AuthorizationStatus string_to_authorization_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatus::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatus::Blocked;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatus::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatus::Invalid;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatus::ConcurrentTx;
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'B':
+            if (s == "Blocked") {
+                return AuthorizationStatus::Blocked;
+            }
+            break;
+        case 'E':
+            if (s == "Expired") {
+                return AuthorizationStatus::Expired;
+            }
+            break;
+        case 'I':
+            if (s == "Invalid") {
+                return AuthorizationStatus::Invalid;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizationStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatus::ConcurrentTx;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type AuthorizationStatus");
@@ -54,7 +70,7 @@ std::ostream& operator<<(std::ostream& os, const AuthorizationStatus& authorizat
 
 // from: BootNotificationResponse
 namespace conversions {
-std::string registration_status_to_string(RegistrationStatus e) {
+std::string_view registration_status_to_string(RegistrationStatus e) {
     switch (e) {
     case RegistrationStatus::Accepted:
         return "Accepted";
@@ -68,14 +84,26 @@ std::string registration_status_to_string(RegistrationStatus e) {
 }
 
 RegistrationStatus string_to_registration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatus::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatus::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatus::Rejected;
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatus::Pending;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RegistrationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RegistrationStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type RegistrationStatus");
@@ -89,7 +117,7 @@ std::ostream& operator<<(std::ostream& os, const RegistrationStatus& registratio
 
 // from: CancelReservationResponse
 namespace conversions {
-std::string cancel_reservation_status_to_string(CancelReservationStatus e) {
+std::string_view cancel_reservation_status_to_string(CancelReservationStatus e) {
     switch (e) {
     case CancelReservationStatus::Accepted:
         return "Accepted";
@@ -101,11 +129,21 @@ std::string cancel_reservation_status_to_string(CancelReservationStatus e) {
 }
 
 CancelReservationStatus string_to_cancel_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatus::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CancelReservationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CancelReservationStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type CancelReservationStatus");
@@ -119,7 +157,7 @@ std::ostream& operator<<(std::ostream& os, const CancelReservationStatus& cancel
 
 // from: CertificateSignedResponse
 namespace conversions {
-std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e) {
+std::string_view certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e) {
     switch (e) {
     case CertificateSignedStatusEnumType::Accepted:
         return "Accepted";
@@ -131,11 +169,21 @@ std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatu
 }
 
 CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnumType::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CertificateSignedStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CertificateSignedStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -150,7 +198,7 @@ std::ostream& operator<<(std::ostream& os, const CertificateSignedStatusEnumType
 
 // from: ChangeAvailabilityRequest
 namespace conversions {
-std::string availability_type_to_string(AvailabilityType e) {
+std::string_view availability_type_to_string(AvailabilityType e) {
     switch (e) {
     case AvailabilityType::Inoperative:
         return "Inoperative";
@@ -162,11 +210,17 @@ std::string availability_type_to_string(AvailabilityType e) {
 }
 
 AvailabilityType string_to_availability_type(const std::string& s) {
-    if (s == "Inoperative") {
-        return AvailabilityType::Inoperative;
-    }
-    if (s == "Operative") {
-        return AvailabilityType::Operative;
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return AvailabilityType::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return AvailabilityType::Inoperative;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type AvailabilityType");
@@ -180,7 +234,7 @@ std::ostream& operator<<(std::ostream& os, const AvailabilityType& availability_
 
 // from: ChangeAvailabilityResponse
 namespace conversions {
-std::string availability_status_to_string(AvailabilityStatus e) {
+std::string_view availability_status_to_string(AvailabilityStatus e) {
     switch (e) {
     case AvailabilityStatus::Accepted:
         return "Accepted";
@@ -194,14 +248,26 @@ std::string availability_status_to_string(AvailabilityStatus e) {
 }
 
 AvailabilityStatus string_to_availability_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AvailabilityStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return AvailabilityStatus::Rejected;
-    }
-    if (s == "Scheduled") {
-        return AvailabilityStatus::Scheduled;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return AvailabilityStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return AvailabilityStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return AvailabilityStatus::Scheduled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type AvailabilityStatus");
@@ -215,7 +281,7 @@ std::ostream& operator<<(std::ostream& os, const AvailabilityStatus& availabilit
 
 // from: ChangeConfigurationResponse
 namespace conversions {
-std::string configuration_status_to_string(ConfigurationStatus e) {
+std::string_view configuration_status_to_string(ConfigurationStatus e) {
     switch (e) {
     case ConfigurationStatus::Accepted:
         return "Accepted";
@@ -231,17 +297,31 @@ std::string configuration_status_to_string(ConfigurationStatus e) {
 }
 
 ConfigurationStatus string_to_configuration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ConfigurationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ConfigurationStatus::Rejected;
-    }
-    if (s == "RebootRequired") {
-        return ConfigurationStatus::RebootRequired;
-    }
-    if (s == "NotSupported") {
-        return ConfigurationStatus::NotSupported;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ConfigurationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ConfigurationStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ConfigurationStatus::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return ConfigurationStatus::RebootRequired;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ConfigurationStatus");
@@ -255,7 +335,7 @@ std::ostream& operator<<(std::ostream& os, const ConfigurationStatus& configurat
 
 // from: ClearCacheResponse
 namespace conversions {
-std::string clear_cache_status_to_string(ClearCacheStatus e) {
+std::string_view clear_cache_status_to_string(ClearCacheStatus e) {
     switch (e) {
     case ClearCacheStatus::Accepted:
         return "Accepted";
@@ -267,11 +347,21 @@ std::string clear_cache_status_to_string(ClearCacheStatus e) {
 }
 
 ClearCacheStatus string_to_clear_cache_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatus::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearCacheStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearCacheStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ClearCacheStatus");
@@ -285,7 +375,7 @@ std::ostream& operator<<(std::ostream& os, const ClearCacheStatus& clear_cache_s
 
 // from: ClearChargingProfileRequest
 namespace conversions {
-std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e) {
+std::string_view charging_profile_purpose_type_to_string(ChargingProfilePurposeType e) {
     switch (e) {
     case ChargingProfilePurposeType::ChargePointMaxProfile:
         return "ChargePointMaxProfile";
@@ -299,14 +389,22 @@ std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e
 }
 
 ChargingProfilePurposeType string_to_charging_profile_purpose_type(const std::string& s) {
-    if (s == "ChargePointMaxProfile") {
-        return ChargingProfilePurposeType::ChargePointMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeType::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeType::TxProfile;
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeType::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeType::TxDefaultProfile;
+        }
+        break;
+    case 21:
+        if (s == "ChargePointMaxProfile") {
+            return ChargingProfilePurposeType::ChargePointMaxProfile;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -321,7 +419,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfilePurposeType& cha
 
 // from: ClearChargingProfileResponse
 namespace conversions {
-std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e) {
+std::string_view clear_charging_profile_status_to_string(ClearChargingProfileStatus e) {
     switch (e) {
     case ClearChargingProfileStatus::Accepted:
         return "Accepted";
@@ -333,11 +431,17 @@ std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e
 }
 
 ClearChargingProfileStatus string_to_clear_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatus::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatus::Unknown;
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatus::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatus::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -352,7 +456,7 @@ std::ostream& operator<<(std::ostream& os, const ClearChargingProfileStatus& cle
 
 // from: DataTransferResponse
 namespace conversions {
-std::string data_transfer_status_to_string(DataTransferStatus e) {
+std::string_view data_transfer_status_to_string(DataTransferStatus e) {
     switch (e) {
     case DataTransferStatus::Accepted:
         return "Accepted";
@@ -368,17 +472,31 @@ std::string data_transfer_status_to_string(DataTransferStatus e) {
 }
 
 DataTransferStatus string_to_data_transfer_status(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatus::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatus::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatus::UnknownVendorId;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DataTransferStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DataTransferStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatus::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatus::UnknownMessageId;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type DataTransferStatus");
@@ -392,7 +510,7 @@ std::ostream& operator<<(std::ostream& os, const DataTransferStatus& data_transf
 
 // from: DeleteCertificateRequest
 namespace conversions {
-std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e) {
+std::string_view hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e) {
     switch (e) {
     case HashAlgorithmEnumType::SHA256:
         return "SHA256";
@@ -406,14 +524,26 @@ std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e) {
 }
 
 HashAlgorithmEnumType string_to_hash_algorithm_enum_type(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnumType::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnumType::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnumType::SHA512;
+    switch (s.size()) {
+    case 6:
+        switch (s[3]) {
+        case '2':
+            if (s == "SHA256") {
+                return HashAlgorithmEnumType::SHA256;
+            }
+            break;
+        case '3':
+            if (s == "SHA384") {
+                return HashAlgorithmEnumType::SHA384;
+            }
+            break;
+        case '5':
+            if (s == "SHA512") {
+                return HashAlgorithmEnumType::SHA512;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type HashAlgorithmEnumType");
@@ -427,7 +557,7 @@ std::ostream& operator<<(std::ostream& os, const HashAlgorithmEnumType& hash_alg
 
 // from: DeleteCertificateResponse
 namespace conversions {
-std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e) {
+std::string_view delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e) {
     switch (e) {
     case DeleteCertificateStatusEnumType::Accepted:
         return "Accepted";
@@ -441,14 +571,26 @@ std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatu
 }
 
 DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnumType::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnumType::NotFound;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DeleteCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return DeleteCertificateStatusEnumType::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -463,7 +605,7 @@ std::ostream& operator<<(std::ostream& os, const DeleteCertificateStatusEnumType
 
 // from: DiagnosticsStatusNotificationRequest
 namespace conversions {
-std::string diagnostics_status_to_string(DiagnosticsStatus e) {
+std::string_view diagnostics_status_to_string(DiagnosticsStatus e) {
     switch (e) {
     case DiagnosticsStatus::Idle:
         return "Idle";
@@ -479,17 +621,27 @@ std::string diagnostics_status_to_string(DiagnosticsStatus e) {
 }
 
 DiagnosticsStatus string_to_diagnostics_status(const std::string& s) {
-    if (s == "Idle") {
-        return DiagnosticsStatus::Idle;
-    }
-    if (s == "Uploaded") {
-        return DiagnosticsStatus::Uploaded;
-    }
-    if (s == "UploadFailed") {
-        return DiagnosticsStatus::UploadFailed;
-    }
-    if (s == "Uploading") {
-        return DiagnosticsStatus::Uploading;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return DiagnosticsStatus::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return DiagnosticsStatus::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return DiagnosticsStatus::Uploading;
+        }
+        break;
+    case 12:
+        if (s == "UploadFailed") {
+            return DiagnosticsStatus::UploadFailed;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type DiagnosticsStatus");
@@ -503,7 +655,7 @@ std::ostream& operator<<(std::ostream& os, const DiagnosticsStatus& diagnostics_
 
 // from: ExtendedTriggerMessageRequest
 namespace conversions {
-std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e) {
+std::string_view message_trigger_enum_type_to_string(MessageTriggerEnumType e) {
     switch (e) {
     case MessageTriggerEnumType::BootNotification:
         return "BootNotification";
@@ -525,26 +677,46 @@ std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e) {
 }
 
 MessageTriggerEnumType string_to_message_trigger_enum_type(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnumType::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnumType::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnumType::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnumType::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnumType::MeterValues;
-    }
-    if (s == "SignChargePointCertificate") {
-        return MessageTriggerEnumType::SignChargePointCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnumType::StatusNotification;
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnumType::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnumType::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTriggerEnumType::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTriggerEnumType::StatusNotification;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnumType::LogStatusNotification;
+        }
+        break;
+    case 26:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareStatusNotification") {
+                return MessageTriggerEnumType::FirmwareStatusNotification;
+            }
+            break;
+        case 'S':
+            if (s == "SignChargePointCertificate") {
+                return MessageTriggerEnumType::SignChargePointCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageTriggerEnumType");
@@ -558,7 +730,7 @@ std::ostream& operator<<(std::ostream& os, const MessageTriggerEnumType& message
 
 // from: ExtendedTriggerMessageResponse
 namespace conversions {
-std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e) {
+std::string_view trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e) {
     switch (e) {
     case TriggerMessageStatusEnumType::Accepted:
         return "Accepted";
@@ -572,14 +744,26 @@ std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumT
 }
 
 TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnumType::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnumType::NotImplemented;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnumType::NotImplemented;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -594,7 +778,7 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatusEnumType& t
 
 // from: FirmwareStatusNotificationRequest
 namespace conversions {
-std::string firmware_status_to_string(FirmwareStatus e) {
+std::string_view firmware_status_to_string(FirmwareStatus e) {
     switch (e) {
     case FirmwareStatus::Downloaded:
         return "Downloaded";
@@ -616,26 +800,46 @@ std::string firmware_status_to_string(FirmwareStatus e) {
 }
 
 FirmwareStatus string_to_firmware_status(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatus::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatus::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatus::Downloading;
-    }
-    if (s == "Idle") {
-        return FirmwareStatus::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatus::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatus::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatus::Installed;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatus::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatus::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatus::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatus::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatus::Downloading;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return FirmwareStatus::DownloadFailed;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatus::InstallationFailed;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type FirmwareStatus");
@@ -649,7 +853,7 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatus& firmware_status
 
 // from: GetCompositeScheduleRequest
 namespace conversions {
-std::string charging_rate_unit_to_string(ChargingRateUnit e) {
+std::string_view charging_rate_unit_to_string(ChargingRateUnit e) {
     switch (e) {
     case ChargingRateUnit::A:
         return "A";
@@ -661,11 +865,21 @@ std::string charging_rate_unit_to_string(ChargingRateUnit e) {
 }
 
 ChargingRateUnit string_to_charging_rate_unit(const std::string& s) {
-    if (s == "A") {
-        return ChargingRateUnit::A;
-    }
-    if (s == "W") {
-        return ChargingRateUnit::W;
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'A':
+            if (s == "A") {
+                return ChargingRateUnit::A;
+            }
+            break;
+        case 'W':
+            if (s == "W") {
+                return ChargingRateUnit::W;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingRateUnit");
@@ -679,7 +893,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingRateUnit& charging_rate
 
 // from: GetCompositeScheduleResponse
 namespace conversions {
-std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e) {
+std::string_view get_composite_schedule_status_to_string(GetCompositeScheduleStatus e) {
     switch (e) {
     case GetCompositeScheduleStatus::Accepted:
         return "Accepted";
@@ -691,11 +905,21 @@ std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e
 }
 
 GetCompositeScheduleStatus string_to_get_composite_schedule_status(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCompositeScheduleStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetCompositeScheduleStatus::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetCompositeScheduleStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GetCompositeScheduleStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -710,7 +934,7 @@ std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleStatus& get
 
 // from: GetInstalledCertificateIdsRequest
 namespace conversions {
-std::string certificate_use_enum_type_to_string(CertificateUseEnumType e) {
+std::string_view certificate_use_enum_type_to_string(CertificateUseEnumType e) {
     switch (e) {
     case CertificateUseEnumType::CentralSystemRootCertificate:
         return "CentralSystemRootCertificate";
@@ -722,11 +946,17 @@ std::string certificate_use_enum_type_to_string(CertificateUseEnumType e) {
 }
 
 CertificateUseEnumType string_to_certificate_use_enum_type(const std::string& s) {
-    if (s == "CentralSystemRootCertificate") {
-        return CertificateUseEnumType::CentralSystemRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return CertificateUseEnumType::ManufacturerRootCertificate;
+    switch (s.size()) {
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return CertificateUseEnumType::ManufacturerRootCertificate;
+        }
+        break;
+    case 28:
+        if (s == "CentralSystemRootCertificate") {
+            return CertificateUseEnumType::CentralSystemRootCertificate;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type CertificateUseEnumType");
@@ -740,7 +970,7 @@ std::ostream& operator<<(std::ostream& os, const CertificateUseEnumType& certifi
 
 // from: GetInstalledCertificateIdsResponse
 namespace conversions {
-std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e) {
+std::string_view get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e) {
     switch (e) {
     case GetInstalledCertificateStatusEnumType::Accepted:
         return "Accepted";
@@ -753,11 +983,21 @@ std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCer
 }
 
 GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnumType::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnumType::NotFound;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetInstalledCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return GetInstalledCertificateStatusEnumType::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -773,7 +1013,7 @@ std::ostream& operator<<(std::ostream& os,
 
 // from: GetLogRequest
 namespace conversions {
-std::string log_enum_type_to_string(LogEnumType e) {
+std::string_view log_enum_type_to_string(LogEnumType e) {
     switch (e) {
     case LogEnumType::DiagnosticsLog:
         return "DiagnosticsLog";
@@ -785,11 +1025,17 @@ std::string log_enum_type_to_string(LogEnumType e) {
 }
 
 LogEnumType string_to_log_enum_type(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnumType::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnumType::SecurityLog;
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnumType::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnumType::DiagnosticsLog;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type LogEnumType");
@@ -803,7 +1049,7 @@ std::ostream& operator<<(std::ostream& os, const LogEnumType& log_enum_type) {
 
 // from: GetLogResponse
 namespace conversions {
-std::string log_status_enum_type_to_string(LogStatusEnumType e) {
+std::string_view log_status_enum_type_to_string(LogStatusEnumType e) {
     switch (e) {
     case LogStatusEnumType::Accepted:
         return "Accepted";
@@ -817,14 +1063,26 @@ std::string log_status_enum_type_to_string(LogStatusEnumType e) {
 }
 
 LogStatusEnumType string_to_log_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnumType::AcceptedCanceled;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return LogStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return LogStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnumType::AcceptedCanceled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type LogStatusEnumType");
@@ -838,7 +1096,7 @@ std::ostream& operator<<(std::ostream& os, const LogStatusEnumType& log_status_e
 
 // from: InstallCertificateResponse
 namespace conversions {
-std::string install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e) {
+std::string_view install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e) {
     switch (e) {
     case InstallCertificateStatusEnumType::Accepted:
         return "Accepted";
@@ -852,14 +1110,26 @@ std::string install_certificate_status_enum_type_to_string(InstallCertificateSta
 }
 
 InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnumType::Failed;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnumType::Rejected;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return InstallCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return InstallCertificateStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -875,7 +1145,7 @@ std::ostream& operator<<(std::ostream& os,
 
 // from: LogStatusNotificationRequest
 namespace conversions {
-std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e) {
+std::string_view upload_log_status_enum_type_to_string(UploadLogStatusEnumType e) {
     switch (e) {
     case UploadLogStatusEnumType::BadMessage:
         return "BadMessage";
@@ -897,26 +1167,42 @@ std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e) {
 }
 
 UploadLogStatusEnumType string_to_upload_log_status_enum_type(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnumType::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnumType::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnumType::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnumType::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnumType::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnumType::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnumType::Uploading;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnumType::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnumType::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnumType::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnumType::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnumType::UploadFailure;
+        }
+        break;
+    case 16:
+        if (s == "PermissionDenied") {
+            return UploadLogStatusEnumType::PermissionDenied;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnumType::NotSupportedOperation;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UploadLogStatusEnumType");
@@ -930,7 +1216,7 @@ std::ostream& operator<<(std::ostream& os, const UploadLogStatusEnumType& upload
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string reading_context_to_string(ReadingContext e) {
+std::string_view reading_context_to_string(ReadingContext e) {
     switch (e) {
     case ReadingContext::Interruption_Begin:
         return "Interruption.Begin";
@@ -954,29 +1240,51 @@ std::string reading_context_to_string(ReadingContext e) {
 }
 
 ReadingContext string_to_reading_context(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContext::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContext::Interruption_End;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContext::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContext::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContext::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContext::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContext::Trigger;
-    }
-    if (s == "Other") {
-        return ReadingContext::Other;
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContext::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContext::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContext::Sample_Clock;
+        }
+        break;
+    case 15:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Sample.Periodic") {
+                return ReadingContext::Sample_Periodic;
+            }
+            break;
+        case 'T':
+            if (s == "Transaction.End") {
+                return ReadingContext::Transaction_End;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContext::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContext::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContext::Interruption_Begin;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReadingContext");
@@ -990,7 +1298,7 @@ std::ostream& operator<<(std::ostream& os, const ReadingContext& reading_context
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string value_format_to_string(ValueFormat e) {
+std::string_view value_format_to_string(ValueFormat e) {
     switch (e) {
     case ValueFormat::Raw:
         return "Raw";
@@ -1002,11 +1310,17 @@ std::string value_format_to_string(ValueFormat e) {
 }
 
 ValueFormat string_to_value_format(const std::string& s) {
-    if (s == "Raw") {
-        return ValueFormat::Raw;
-    }
-    if (s == "SignedData") {
-        return ValueFormat::SignedData;
+    switch (s.size()) {
+    case 3:
+        if (s == "Raw") {
+            return ValueFormat::Raw;
+        }
+        break;
+    case 10:
+        if (s == "SignedData") {
+            return ValueFormat::SignedData;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ValueFormat");
@@ -1020,7 +1334,7 @@ std::ostream& operator<<(std::ostream& os, const ValueFormat& value_format) {
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string measurand_to_string(Measurand e) {
+std::string_view measurand_to_string(Measurand e) {
     switch (e) {
     case Measurand::Energy_Active_Export_Register:
         return "Energy.Active.Export.Register";
@@ -1072,71 +1386,133 @@ std::string measurand_to_string(Measurand e) {
 }
 
 Measurand string_to_measurand(const std::string& s) {
-    if (s == "Energy.Active.Export.Register") {
-        return Measurand::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return Measurand::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return Measurand::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return Measurand::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return Measurand::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return Measurand::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return Measurand::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return Measurand::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Power.Active.Export") {
-        return Measurand::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return Measurand::Power_Active_Import;
-    }
-    if (s == "Power.Offered") {
-        return Measurand::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return Measurand::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return Measurand::Power_Reactive_Import;
-    }
-    if (s == "Power.Factor") {
-        return Measurand::Power_Factor;
-    }
-    if (s == "Current.Import") {
-        return Measurand::Current_Import;
-    }
-    if (s == "Current.Export") {
-        return Measurand::Current_Export;
-    }
-    if (s == "Current.Offered") {
-        return Measurand::Current_Offered;
-    }
-    if (s == "Voltage") {
-        return Measurand::Voltage;
-    }
-    if (s == "Frequency") {
-        return Measurand::Frequency;
-    }
-    if (s == "Temperature") {
-        return Measurand::Temperature;
-    }
-    if (s == "SoC") {
-        return Measurand::SoC;
-    }
-    if (s == "RPM") {
-        return Measurand::RPM;
+    switch (s.size()) {
+    case 3:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SoC") {
+                return Measurand::SoC;
+            }
+            break;
+        case 'R':
+            if (s == "RPM") {
+                return Measurand::RPM;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return Measurand::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return Measurand::Frequency;
+        }
+        break;
+    case 11:
+        if (s == "Temperature") {
+            return Measurand::Temperature;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return Measurand::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return Measurand::Power_Offered;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'I':
+            if (s == "Current.Import") {
+                return Measurand::Current_Import;
+            }
+            break;
+        case 'E':
+            if (s == "Current.Export") {
+                return Measurand::Current_Export;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return Measurand::Current_Offered;
+        }
+        break;
+    case 19:
+        switch (s[13]) {
+        case 'E':
+            if (s == "Power.Active.Export") {
+                return Measurand::Power_Active_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Active.Import") {
+                return Measurand::Power_Active_Import;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[15]) {
+        case 'E':
+            if (s == "Power.Reactive.Export") {
+                return Measurand::Power_Reactive_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Reactive.Import") {
+                return Measurand::Power_Reactive_Import;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch (s[14]) {
+        case 'E':
+            if (s == "Energy.Active.Export.Register") {
+                return Measurand::Energy_Active_Export_Register;
+            }
+            if (s == "Energy.Active.Export.Interval") {
+                return Measurand::Energy_Active_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Active.Import.Register") {
+                return Measurand::Energy_Active_Import_Register;
+            }
+            if (s == "Energy.Active.Import.Interval") {
+                return Measurand::Energy_Active_Import_Interval;
+            }
+            break;
+        }
+        break;
+    case 31:
+        switch (s[16]) {
+        case 'E':
+            if (s == "Energy.Reactive.Export.Register") {
+                return Measurand::Energy_Reactive_Export_Register;
+            }
+            if (s == "Energy.Reactive.Export.Interval") {
+                return Measurand::Energy_Reactive_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Reactive.Import.Register") {
+                return Measurand::Energy_Reactive_Import_Register;
+            }
+            if (s == "Energy.Reactive.Import.Interval") {
+                return Measurand::Energy_Reactive_Import_Interval;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type Measurand");
@@ -1150,7 +1526,7 @@ std::ostream& operator<<(std::ostream& os, const Measurand& measurand) {
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string phase_to_string(Phase e) {
+std::string_view phase_to_string(Phase e) {
     switch (e) {
     case Phase::L1:
         return "L1";
@@ -1178,35 +1554,69 @@ std::string phase_to_string(Phase e) {
 }
 
 Phase string_to_phase(const std::string& s) {
-    if (s == "L1") {
-        return Phase::L1;
-    }
-    if (s == "L2") {
-        return Phase::L2;
-    }
-    if (s == "L3") {
-        return Phase::L3;
-    }
-    if (s == "N") {
-        return Phase::N;
-    }
-    if (s == "L1-N") {
-        return Phase::L1_N;
-    }
-    if (s == "L2-N") {
-        return Phase::L2_N;
-    }
-    if (s == "L3-N") {
-        return Phase::L3_N;
-    }
-    if (s == "L1-L2") {
-        return Phase::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return Phase::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return Phase::L3_L1;
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return Phase::N;
+        }
+        break;
+    case 2:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1") {
+                return Phase::L1;
+            }
+            break;
+        case '2':
+            if (s == "L2") {
+                return Phase::L2;
+            }
+            break;
+        case '3':
+            if (s == "L3") {
+                return Phase::L3;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-N") {
+                return Phase::L1_N;
+            }
+            break;
+        case '2':
+            if (s == "L2-N") {
+                return Phase::L2_N;
+            }
+            break;
+        case '3':
+            if (s == "L3-N") {
+                return Phase::L3_N;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-L2") {
+                return Phase::L1_L2;
+            }
+            break;
+        case '2':
+            if (s == "L2-L3") {
+                return Phase::L2_L3;
+            }
+            break;
+        case '3':
+            if (s == "L3-L1") {
+                return Phase::L3_L1;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type Phase");
@@ -1220,7 +1630,7 @@ std::ostream& operator<<(std::ostream& os, const Phase& phase) {
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string location_to_string(Location e) {
+std::string_view location_to_string(Location e) {
     switch (e) {
     case Location::Cable:
         return "Cable";
@@ -1238,20 +1648,36 @@ std::string location_to_string(Location e) {
 }
 
 Location string_to_location(const std::string& s) {
-    if (s == "Cable") {
-        return Location::Cable;
-    }
-    if (s == "EV") {
-        return Location::EV;
-    }
-    if (s == "Inlet") {
-        return Location::Inlet;
-    }
-    if (s == "Outlet") {
-        return Location::Outlet;
-    }
-    if (s == "Body") {
-        return Location::Body;
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return Location::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return Location::Body;
+        }
+        break;
+    case 5:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Cable") {
+                return Location::Cable;
+            }
+            break;
+        case 'I':
+            if (s == "Inlet") {
+                return Location::Inlet;
+            }
+            break;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return Location::Outlet;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type Location");
@@ -1265,7 +1691,7 @@ std::ostream& operator<<(std::ostream& os, const Location& location) {
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string unit_of_measure_to_string(UnitOfMeasure e) {
+std::string_view unit_of_measure_to_string(UnitOfMeasure e) {
     switch (e) {
     case UnitOfMeasure::Wh:
         return "Wh";
@@ -1309,59 +1735,115 @@ std::string unit_of_measure_to_string(UnitOfMeasure e) {
 }
 
 UnitOfMeasure string_to_unit_of_measure(const std::string& s) {
-    if (s == "Wh") {
-        return UnitOfMeasure::Wh;
-    }
-    if (s == "kWh") {
-        return UnitOfMeasure::kWh;
-    }
-    if (s == "varh") {
-        return UnitOfMeasure::varh;
-    }
-    if (s == "kvarh") {
-        return UnitOfMeasure::kvarh;
-    }
-    if (s == "W") {
-        return UnitOfMeasure::W;
-    }
-    if (s == "kW") {
-        return UnitOfMeasure::kW;
-    }
-    if (s == "VA") {
-        return UnitOfMeasure::VA;
-    }
-    if (s == "kVA") {
-        return UnitOfMeasure::kVA;
-    }
-    if (s == "var") {
-        return UnitOfMeasure::var;
-    }
-    if (s == "kvar") {
-        return UnitOfMeasure::kvar;
-    }
-    if (s == "A") {
-        return UnitOfMeasure::A;
-    }
-    if (s == "V") {
-        return UnitOfMeasure::V;
-    }
-    if (s == "K") {
-        return UnitOfMeasure::K;
-    }
-    if (s == "Celcius") {
-        return UnitOfMeasure::Celcius;
-    }
-    if (s == "Celsius") {
-        return UnitOfMeasure::Celsius;
-    }
-    if (s == "Fahrenheit") {
-        return UnitOfMeasure::Fahrenheit;
-    }
-    if (s == "Percent") {
-        return UnitOfMeasure::Percent;
-    }
-    if (s == "RevolutionsPerMinute") {
-        return UnitOfMeasure::RevolutionsPerMinute;
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'W':
+            if (s == "W") {
+                return UnitOfMeasure::W;
+            }
+            break;
+        case 'A':
+            if (s == "A") {
+                return UnitOfMeasure::A;
+            }
+            break;
+        case 'V':
+            if (s == "V") {
+                return UnitOfMeasure::V;
+            }
+            break;
+        case 'K':
+            if (s == "K") {
+                return UnitOfMeasure::K;
+            }
+            break;
+        }
+        break;
+    case 2:
+        switch (s[0]) {
+        case 'W':
+            if (s == "Wh") {
+                return UnitOfMeasure::Wh;
+            }
+            break;
+        case 'k':
+            if (s == "kW") {
+                return UnitOfMeasure::kW;
+            }
+            break;
+        case 'V':
+            if (s == "VA") {
+                return UnitOfMeasure::VA;
+            }
+            break;
+        }
+        break;
+    case 3:
+        switch (s[1]) {
+        case 'W':
+            if (s == "kWh") {
+                return UnitOfMeasure::kWh;
+            }
+            break;
+        case 'V':
+            if (s == "kVA") {
+                return UnitOfMeasure::kVA;
+            }
+            break;
+        case 'a':
+            if (s == "var") {
+                return UnitOfMeasure::var;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'v':
+            if (s == "varh") {
+                return UnitOfMeasure::varh;
+            }
+            break;
+        case 'k':
+            if (s == "kvar") {
+                return UnitOfMeasure::kvar;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "kvarh") {
+            return UnitOfMeasure::kvarh;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Celcius") {
+                return UnitOfMeasure::Celcius;
+            }
+            if (s == "Celsius") {
+                return UnitOfMeasure::Celsius;
+            }
+            break;
+        case 'P':
+            if (s == "Percent") {
+                return UnitOfMeasure::Percent;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if (s == "Fahrenheit") {
+            return UnitOfMeasure::Fahrenheit;
+        }
+        break;
+    case 20:
+        if (s == "RevolutionsPerMinute") {
+            return UnitOfMeasure::RevolutionsPerMinute;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UnitOfMeasure");
@@ -1375,7 +1857,7 @@ std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& unit_of_measure)
 
 // from: RemoteStartTransactionRequest
 namespace conversions {
-std::string charging_profile_kind_type_to_string(ChargingProfileKindType e) {
+std::string_view charging_profile_kind_type_to_string(ChargingProfileKindType e) {
     switch (e) {
     case ChargingProfileKindType::Absolute:
         return "Absolute";
@@ -1389,14 +1871,26 @@ std::string charging_profile_kind_type_to_string(ChargingProfileKindType e) {
 }
 
 ChargingProfileKindType string_to_charging_profile_kind_type(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindType::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindType::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindType::Relative;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Absolute") {
+                return ChargingProfileKindType::Absolute;
+            }
+            break;
+        case 'R':
+            if (s == "Relative") {
+                return ChargingProfileKindType::Relative;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindType::Recurring;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingProfileKindType");
@@ -1410,7 +1904,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileKindType& chargi
 
 // from: RemoteStartTransactionRequest
 namespace conversions {
-std::string recurrency_kind_type_to_string(RecurrencyKindType e) {
+std::string_view recurrency_kind_type_to_string(RecurrencyKindType e) {
     switch (e) {
     case RecurrencyKindType::Daily:
         return "Daily";
@@ -1422,11 +1916,17 @@ std::string recurrency_kind_type_to_string(RecurrencyKindType e) {
 }
 
 RecurrencyKindType string_to_recurrency_kind_type(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindType::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindType::Weekly;
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindType::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindType::Weekly;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type RecurrencyKindType");
@@ -1440,7 +1940,7 @@ std::ostream& operator<<(std::ostream& os, const RecurrencyKindType& recurrency_
 
 // from: RemoteStartTransactionResponse
 namespace conversions {
-std::string remote_start_stop_status_to_string(RemoteStartStopStatus e) {
+std::string_view remote_start_stop_status_to_string(RemoteStartStopStatus e) {
     switch (e) {
     case RemoteStartStopStatus::Accepted:
         return "Accepted";
@@ -1452,11 +1952,21 @@ std::string remote_start_stop_status_to_string(RemoteStartStopStatus e) {
 }
 
 RemoteStartStopStatus string_to_remote_start_stop_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RemoteStartStopStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return RemoteStartStopStatus::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RemoteStartStopStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RemoteStartStopStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type RemoteStartStopStatus");
@@ -1470,7 +1980,7 @@ std::ostream& operator<<(std::ostream& os, const RemoteStartStopStatus& remote_s
 
 // from: ReserveNowResponse
 namespace conversions {
-std::string reservation_status_to_string(ReservationStatus e) {
+std::string_view reservation_status_to_string(ReservationStatus e) {
     switch (e) {
     case ReservationStatus::Accepted:
         return "Accepted";
@@ -1488,20 +1998,36 @@ std::string reservation_status_to_string(ReservationStatus e) {
 }
 
 ReservationStatus string_to_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ReservationStatus::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReservationStatus::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReservationStatus::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReservationStatus::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReservationStatus::Unavailable;
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReservationStatus::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ReservationStatus::Accepted;
+            }
+            break;
+        case 'O':
+            if (s == "Occupied") {
+                return ReservationStatus::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ReservationStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReservationStatus::Unavailable;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReservationStatus");
@@ -1515,7 +2041,7 @@ std::ostream& operator<<(std::ostream& os, const ReservationStatus& reservation_
 
 // from: ResetRequest
 namespace conversions {
-std::string reset_type_to_string(ResetType e) {
+std::string_view reset_type_to_string(ResetType e) {
     switch (e) {
     case ResetType::Hard:
         return "Hard";
@@ -1527,11 +2053,21 @@ std::string reset_type_to_string(ResetType e) {
 }
 
 ResetType string_to_reset_type(const std::string& s) {
-    if (s == "Hard") {
-        return ResetType::Hard;
-    }
-    if (s == "Soft") {
-        return ResetType::Soft;
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'H':
+            if (s == "Hard") {
+                return ResetType::Hard;
+            }
+            break;
+        case 'S':
+            if (s == "Soft") {
+                return ResetType::Soft;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ResetType");
@@ -1545,7 +2081,7 @@ std::ostream& operator<<(std::ostream& os, const ResetType& reset_type) {
 
 // from: ResetResponse
 namespace conversions {
-std::string reset_status_to_string(ResetStatus e) {
+std::string_view reset_status_to_string(ResetStatus e) {
     switch (e) {
     case ResetStatus::Accepted:
         return "Accepted";
@@ -1557,11 +2093,21 @@ std::string reset_status_to_string(ResetStatus e) {
 }
 
 ResetStatus string_to_reset_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatus::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ResetStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ResetStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ResetStatus");
@@ -1575,7 +2121,7 @@ std::ostream& operator<<(std::ostream& os, const ResetStatus& reset_status) {
 
 // from: SendLocalListRequest
 namespace conversions {
-std::string update_type_to_string(UpdateType e) {
+std::string_view update_type_to_string(UpdateType e) {
     switch (e) {
     case UpdateType::Differential:
         return "Differential";
@@ -1587,11 +2133,17 @@ std::string update_type_to_string(UpdateType e) {
 }
 
 UpdateType string_to_update_type(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateType::Differential;
-    }
-    if (s == "Full") {
-        return UpdateType::Full;
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateType::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateType::Differential;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UpdateType");
@@ -1605,7 +2157,7 @@ std::ostream& operator<<(std::ostream& os, const UpdateType& update_type) {
 
 // from: SendLocalListResponse
 namespace conversions {
-std::string update_status_to_string(UpdateStatus e) {
+std::string_view update_status_to_string(UpdateStatus e) {
     switch (e) {
     case UpdateStatus::Accepted:
         return "Accepted";
@@ -1621,17 +2173,27 @@ std::string update_status_to_string(UpdateStatus e) {
 }
 
 UpdateStatus string_to_update_status(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateStatus::Accepted;
-    }
-    if (s == "Failed") {
-        return UpdateStatus::Failed;
-    }
-    if (s == "NotSupported") {
-        return UpdateStatus::NotSupported;
-    }
-    if (s == "VersionMismatch") {
-        return UpdateStatus::VersionMismatch;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return UpdateStatus::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return UpdateStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return UpdateStatus::NotSupported;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return UpdateStatus::VersionMismatch;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UpdateStatus");
@@ -1645,7 +2207,7 @@ std::ostream& operator<<(std::ostream& os, const UpdateStatus& update_status) {
 
 // from: SetChargingProfileResponse
 namespace conversions {
-std::string charging_profile_status_to_string(ChargingProfileStatus e) {
+std::string_view charging_profile_status_to_string(ChargingProfileStatus e) {
     switch (e) {
     case ChargingProfileStatus::Accepted:
         return "Accepted";
@@ -1659,14 +2221,26 @@ std::string charging_profile_status_to_string(ChargingProfileStatus e) {
 }
 
 ChargingProfileStatus string_to_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatus::Rejected;
-    }
-    if (s == "NotSupported") {
-        return ChargingProfileStatus::NotSupported;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChargingProfileStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChargingProfileStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ChargingProfileStatus::NotSupported;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingProfileStatus");
@@ -1680,7 +2254,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileStatus& charging
 
 // from: SignCertificateResponse
 namespace conversions {
-std::string generic_status_enum_type_to_string(GenericStatusEnumType e) {
+std::string_view generic_status_enum_type_to_string(GenericStatusEnumType e) {
     switch (e) {
     case GenericStatusEnumType::Accepted:
         return "Accepted";
@@ -1692,11 +2266,21 @@ std::string generic_status_enum_type_to_string(GenericStatusEnumType e) {
 }
 
 GenericStatusEnumType string_to_generic_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnumType::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type GenericStatusEnumType");
@@ -1710,7 +2294,7 @@ std::ostream& operator<<(std::ostream& os, const GenericStatusEnumType& generic_
 
 // from: SignedFirmwareStatusNotificationRequest
 namespace conversions {
-std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e) {
+std::string_view firmware_status_enum_type_to_string(FirmwareStatusEnumType e) {
     switch (e) {
     case FirmwareStatusEnumType::Downloaded:
         return "Downloaded";
@@ -1746,47 +2330,93 @@ std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e) {
 }
 
 FirmwareStatusEnumType string_to_firmware_status_enum_type(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnumType::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnumType::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnumType::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnumType::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnumType::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnumType::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnumType::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnumType::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnumType::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnumType::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnumType::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnumType::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnumType::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnumType::SignatureVerified;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnumType::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnumType::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatusEnumType::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatusEnumType::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnumType::Downloading;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return FirmwareStatusEnumType::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return FirmwareStatusEnumType::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[8]) {
+        case 'e':
+            if (s == "InstallRebooting") {
+                return FirmwareStatusEnumType::InstallRebooting;
+            }
+            break;
+        case 'c':
+            if (s == "InstallScheduled") {
+                return FirmwareStatusEnumType::InstallScheduled;
+            }
+            break;
+        case 'i':
+            if (s == "InvalidSignature") {
+                return FirmwareStatusEnumType::InvalidSignature;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DownloadScheduled") {
+                return FirmwareStatusEnumType::DownloadScheduled;
+            }
+            break;
+        case 'S':
+            if (s == "SignatureVerified") {
+                return FirmwareStatusEnumType::SignatureVerified;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnumType::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnumType::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type FirmwareStatusEnumType");
@@ -1800,7 +2430,7 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatusEnumType& firmwar
 
 // from: SignedUpdateFirmwareResponse
 namespace conversions {
-std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e) {
+std::string_view update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e) {
     switch (e) {
     case UpdateFirmwareStatusEnumType::Accepted:
         return "Accepted";
@@ -1818,20 +2448,40 @@ std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumT
 }
 
 UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnumType::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnumType::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnumType::RevokedCertificate;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return UpdateFirmwareStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return UpdateFirmwareStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnumType::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'I':
+            if (s == "InvalidCertificate") {
+                return UpdateFirmwareStatusEnumType::InvalidCertificate;
+            }
+            break;
+        case 'R':
+            if (s == "RevokedCertificate") {
+                return UpdateFirmwareStatusEnumType::RevokedCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1846,7 +2496,7 @@ std::ostream& operator<<(std::ostream& os, const UpdateFirmwareStatusEnumType& u
 
 // from: StatusNotificationRequest
 namespace conversions {
-std::string charge_point_error_code_to_string(ChargePointErrorCode e) {
+std::string_view charge_point_error_code_to_string(ChargePointErrorCode e) {
     switch (e) {
     case ChargePointErrorCode::ConnectorLockFailure:
         return "ConnectorLockFailure";
@@ -1886,53 +2536,111 @@ std::string charge_point_error_code_to_string(ChargePointErrorCode e) {
 }
 
 ChargePointErrorCode string_to_charge_point_error_code(const std::string& s) {
-    if (s == "ConnectorLockFailure") {
-        return ChargePointErrorCode::ConnectorLockFailure;
-    }
-    if (s == "EVCommunicationError") {
-        return ChargePointErrorCode::EVCommunicationError;
-    }
-    if (s == "GroundFailure") {
-        return ChargePointErrorCode::GroundFailure;
-    }
-    if (s == "HighTemperature") {
-        return ChargePointErrorCode::HighTemperature;
-    }
-    if (s == "InternalError") {
-        return ChargePointErrorCode::InternalError;
-    }
-    if (s == "LocalListConflict") {
-        return ChargePointErrorCode::LocalListConflict;
-    }
-    if (s == "NoError") {
-        return ChargePointErrorCode::NoError;
-    }
-    if (s == "OtherError") {
-        return ChargePointErrorCode::OtherError;
-    }
-    if (s == "OverCurrentFailure") {
-        return ChargePointErrorCode::OverCurrentFailure;
-    }
-    if (s == "PowerMeterFailure") {
-        return ChargePointErrorCode::PowerMeterFailure;
-    }
-    if (s == "PowerSwitchFailure") {
-        return ChargePointErrorCode::PowerSwitchFailure;
-    }
-    if (s == "ReaderFailure") {
-        return ChargePointErrorCode::ReaderFailure;
-    }
-    if (s == "ResetFailure") {
-        return ChargePointErrorCode::ResetFailure;
-    }
-    if (s == "UnderVoltage") {
-        return ChargePointErrorCode::UnderVoltage;
-    }
-    if (s == "OverVoltage") {
-        return ChargePointErrorCode::OverVoltage;
-    }
-    if (s == "WeakSignal") {
-        return ChargePointErrorCode::WeakSignal;
+    switch (s.size()) {
+    case 7:
+        if (s == "NoError") {
+            return ChargePointErrorCode::NoError;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OtherError") {
+                return ChargePointErrorCode::OtherError;
+            }
+            break;
+        case 'W':
+            if (s == "WeakSignal") {
+                return ChargePointErrorCode::WeakSignal;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "OverVoltage") {
+            return ChargePointErrorCode::OverVoltage;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'R':
+            if (s == "ResetFailure") {
+                return ChargePointErrorCode::ResetFailure;
+            }
+            break;
+        case 'U':
+            if (s == "UnderVoltage") {
+                return ChargePointErrorCode::UnderVoltage;
+            }
+            break;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'G':
+            if (s == "GroundFailure") {
+                return ChargePointErrorCode::GroundFailure;
+            }
+            break;
+        case 'I':
+            if (s == "InternalError") {
+                return ChargePointErrorCode::InternalError;
+            }
+            break;
+        case 'R':
+            if (s == "ReaderFailure") {
+                return ChargePointErrorCode::ReaderFailure;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "HighTemperature") {
+            return ChargePointErrorCode::HighTemperature;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LocalListConflict") {
+                return ChargePointErrorCode::LocalListConflict;
+            }
+            break;
+        case 'P':
+            if (s == "PowerMeterFailure") {
+                return ChargePointErrorCode::PowerMeterFailure;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OverCurrentFailure") {
+                return ChargePointErrorCode::OverCurrentFailure;
+            }
+            break;
+        case 'P':
+            if (s == "PowerSwitchFailure") {
+                return ChargePointErrorCode::PowerSwitchFailure;
+            }
+            break;
+        }
+        break;
+    case 20:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ConnectorLockFailure") {
+                return ChargePointErrorCode::ConnectorLockFailure;
+            }
+            break;
+        case 'E':
+            if (s == "EVCommunicationError") {
+                return ChargePointErrorCode::EVCommunicationError;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargePointErrorCode");
@@ -1946,7 +2654,7 @@ std::ostream& operator<<(std::ostream& os, const ChargePointErrorCode& charge_po
 
 // from: StatusNotificationRequest
 namespace conversions {
-std::string charge_point_status_to_string(ChargePointStatus e) {
+std::string_view charge_point_status_to_string(ChargePointStatus e) {
     switch (e) {
     case ChargePointStatus::Available:
         return "Available";
@@ -1972,32 +2680,64 @@ std::string charge_point_status_to_string(ChargePointStatus e) {
 }
 
 ChargePointStatus string_to_charge_point_status(const std::string& s) {
-    if (s == "Available") {
-        return ChargePointStatus::Available;
-    }
-    if (s == "Preparing") {
-        return ChargePointStatus::Preparing;
-    }
-    if (s == "Charging") {
-        return ChargePointStatus::Charging;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargePointStatus::SuspendedEVSE;
-    }
-    if (s == "SuspendedEV") {
-        return ChargePointStatus::SuspendedEV;
-    }
-    if (s == "Finishing") {
-        return ChargePointStatus::Finishing;
-    }
-    if (s == "Reserved") {
-        return ChargePointStatus::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ChargePointStatus::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ChargePointStatus::Faulted;
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ChargePointStatus::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Charging") {
+                return ChargePointStatus::Charging;
+            }
+            break;
+        case 'R':
+            if (s == "Reserved") {
+                return ChargePointStatus::Reserved;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Available") {
+                return ChargePointStatus::Available;
+            }
+            break;
+        case 'P':
+            if (s == "Preparing") {
+                return ChargePointStatus::Preparing;
+            }
+            break;
+        case 'F':
+            if (s == "Finishing") {
+                return ChargePointStatus::Finishing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SuspendedEV") {
+                return ChargePointStatus::SuspendedEV;
+            }
+            break;
+        case 'U':
+            if (s == "Unavailable") {
+                return ChargePointStatus::Unavailable;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargePointStatus::SuspendedEVSE;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargePointStatus");
@@ -2011,7 +2751,7 @@ std::ostream& operator<<(std::ostream& os, const ChargePointStatus& charge_point
 
 // from: StopTransactionRequest
 namespace conversions {
-std::string reason_to_string(Reason e) {
+std::string_view reason_to_string(Reason e) {
     switch (e) {
     case Reason::EmergencyStop:
         return "EmergencyStop";
@@ -2041,38 +2781,78 @@ std::string reason_to_string(Reason e) {
 }
 
 Reason string_to_reason(const std::string& s) {
-    if (s == "EmergencyStop") {
-        return Reason::EmergencyStop;
-    }
-    if (s == "EVDisconnected") {
-        return Reason::EVDisconnected;
-    }
-    if (s == "HardReset") {
-        return Reason::HardReset;
-    }
-    if (s == "Local") {
-        return Reason::Local;
-    }
-    if (s == "Other") {
-        return Reason::Other;
-    }
-    if (s == "PowerLoss") {
-        return Reason::PowerLoss;
-    }
-    if (s == "Reboot") {
-        return Reason::Reboot;
-    }
-    if (s == "Remote") {
-        return Reason::Remote;
-    }
-    if (s == "SoftReset") {
-        return Reason::SoftReset;
-    }
-    if (s == "UnlockCommand") {
-        return Reason::UnlockCommand;
-    }
-    if (s == "DeAuthorized") {
-        return Reason::DeAuthorized;
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'L':
+            if (s == "Local") {
+                return Reason::Local;
+            }
+            break;
+        case 'O':
+            if (s == "Other") {
+                return Reason::Other;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (s[2]) {
+        case 'b':
+            if (s == "Reboot") {
+                return Reason::Reboot;
+            }
+            break;
+        case 'm':
+            if (s == "Remote") {
+                return Reason::Remote;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'H':
+            if (s == "HardReset") {
+                return Reason::HardReset;
+            }
+            break;
+        case 'P':
+            if (s == "PowerLoss") {
+                return Reason::PowerLoss;
+            }
+            break;
+        case 'S':
+            if (s == "SoftReset") {
+                return Reason::SoftReset;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "DeAuthorized") {
+            return Reason::DeAuthorized;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EmergencyStop") {
+                return Reason::EmergencyStop;
+            }
+            break;
+        case 'U':
+            if (s == "UnlockCommand") {
+                return Reason::UnlockCommand;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "EVDisconnected") {
+            return Reason::EVDisconnected;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type Reason");
@@ -2086,7 +2866,7 @@ std::ostream& operator<<(std::ostream& os, const Reason& reason) {
 
 // from: TriggerMessageRequest
 namespace conversions {
-std::string message_trigger_to_string(MessageTrigger e) {
+std::string_view message_trigger_to_string(MessageTrigger e) {
     switch (e) {
     case MessageTrigger::BootNotification:
         return "BootNotification";
@@ -2106,23 +2886,37 @@ std::string message_trigger_to_string(MessageTrigger e) {
 }
 
 MessageTrigger string_to_message_trigger(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTrigger::BootNotification;
-    }
-    if (s == "DiagnosticsStatusNotification") {
-        return MessageTrigger::DiagnosticsStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTrigger::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTrigger::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTrigger::MeterValues;
-    }
-    if (s == "StatusNotification") {
-        return MessageTrigger::StatusNotification;
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTrigger::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTrigger::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTrigger::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTrigger::StatusNotification;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTrigger::FirmwareStatusNotification;
+        }
+        break;
+    case 29:
+        if (s == "DiagnosticsStatusNotification") {
+            return MessageTrigger::DiagnosticsStatusNotification;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageTrigger");
@@ -2136,7 +2930,7 @@ std::ostream& operator<<(std::ostream& os, const MessageTrigger& message_trigger
 
 // from: TriggerMessageResponse
 namespace conversions {
-std::string trigger_message_status_to_string(TriggerMessageStatus e) {
+std::string_view trigger_message_status_to_string(TriggerMessageStatus e) {
     switch (e) {
     case TriggerMessageStatus::Accepted:
         return "Accepted";
@@ -2150,14 +2944,26 @@ std::string trigger_message_status_to_string(TriggerMessageStatus e) {
 }
 
 TriggerMessageStatus string_to_trigger_message_status(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatus::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatus::NotImplemented;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatus::NotImplemented;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type TriggerMessageStatus");
@@ -2171,7 +2977,7 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatus& trigger_m
 
 // from: UnlockConnectorResponse
 namespace conversions {
-std::string unlock_status_to_string(UnlockStatus e) {
+std::string_view unlock_status_to_string(UnlockStatus e) {
     switch (e) {
     case UnlockStatus::Unlocked:
         return "Unlocked";
@@ -2185,14 +2991,26 @@ std::string unlock_status_to_string(UnlockStatus e) {
 }
 
 UnlockStatus string_to_unlock_status(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatus::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatus::UnlockFailed;
-    }
-    if (s == "NotSupported") {
-        return UnlockStatus::NotSupported;
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatus::Unlocked;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'U':
+            if (s == "UnlockFailed") {
+                return UnlockStatus::UnlockFailed;
+            }
+            break;
+        case 'N':
+            if (s == "NotSupported") {
+                return UnlockStatus::NotSupported;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UnlockStatus");
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/v16/message_validator.hpp>
+
+#include <ocpp/v16/messages/Authorize.hpp>
+#include <ocpp/v16/messages/BootNotification.hpp>
+#include <ocpp/v16/messages/CancelReservation.hpp>
+#include <ocpp/v16/messages/CertificateSigned.hpp>
+#include <ocpp/v16/messages/ChangeAvailability.hpp>
+#include <ocpp/v16/messages/ChangeConfiguration.hpp>
+#include <ocpp/v16/messages/ClearCache.hpp>
+#include <ocpp/v16/messages/ClearChargingProfile.hpp>
+#include <ocpp/v16/messages/DataTransfer.hpp>
+#include <ocpp/v16/messages/DeleteCertificate.hpp>
+#include <ocpp/v16/messages/DiagnosticsStatusNotification.hpp>
+#include <ocpp/v16/messages/ExtendedTriggerMessage.hpp>
+#include <ocpp/v16/messages/FirmwareStatusNotification.hpp>
+#include <ocpp/v16/messages/GetCompositeSchedule.hpp>
+#include <ocpp/v16/messages/GetConfiguration.hpp>
+#include <ocpp/v16/messages/GetDiagnostics.hpp>
+#include <ocpp/v16/messages/GetInstalledCertificateIds.hpp>
+#include <ocpp/v16/messages/GetLocalListVersion.hpp>
+#include <ocpp/v16/messages/GetLog.hpp>
+#include <ocpp/v16/messages/Heartbeat.hpp>
+#include <ocpp/v16/messages/InstallCertificate.hpp>
+#include <ocpp/v16/messages/LogStatusNotification.hpp>
+#include <ocpp/v16/messages/MeterValues.hpp>
+#include <ocpp/v16/messages/RemoteStartTransaction.hpp>
+#include <ocpp/v16/messages/RemoteStopTransaction.hpp>
+#include <ocpp/v16/messages/ReserveNow.hpp>
+#include <ocpp/v16/messages/Reset.hpp>
+#include <ocpp/v16/messages/SecurityEventNotification.hpp>
+#include <ocpp/v16/messages/SendLocalList.hpp>
+#include <ocpp/v16/messages/SetChargingProfile.hpp>
+#include <ocpp/v16/messages/SignCertificate.hpp>
+#include <ocpp/v16/messages/SignedFirmwareStatusNotification.hpp>
+#include <ocpp/v16/messages/SignedUpdateFirmware.hpp>
+#include <ocpp/v16/messages/StartTransaction.hpp>
+#include <ocpp/v16/messages/StatusNotification.hpp>
+#include <ocpp/v16/messages/StopTransaction.hpp>
+#include <ocpp/v16/messages/TriggerMessage.hpp>
+#include <ocpp/v16/messages/UnlockConnector.hpp>
+#include <ocpp/v16/messages/UpdateFirmware.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+void validate_message(MessageType message_type, JsonValidator& validator) {
+    switch (message_type) {
+    case MessageType::Authorize:
+        validate_authorize_request(validator);
+        break;
+    case MessageType::AuthorizeResponse:
+        validate_authorize_response(validator);
+        break;
+    case MessageType::BootNotification:
+        validate_boot_notification_request(validator);
+        break;
+    case MessageType::BootNotificationResponse:
+        validate_boot_notification_response(validator);
+        break;
+    case MessageType::CancelReservation:
+        validate_cancel_reservation_request(validator);
+        break;
+    case MessageType::CancelReservationResponse:
+        validate_cancel_reservation_response(validator);
+        break;
+    case MessageType::CertificateSigned:
+        validate_certificate_signed_request(validator);
+        break;
+    case MessageType::CertificateSignedResponse:
+        validate_certificate_signed_response(validator);
+        break;
+    case MessageType::ChangeAvailability:
+        validate_change_availability_request(validator);
+        break;
+    case MessageType::ChangeAvailabilityResponse:
+        validate_change_availability_response(validator);
+        break;
+    case MessageType::ChangeConfiguration:
+        validate_change_configuration_request(validator);
+        break;
+    case MessageType::ChangeConfigurationResponse:
+        validate_change_configuration_response(validator);
+        break;
+    case MessageType::ClearCache:
+        validate_clear_cache_request(validator);
+        break;
+    case MessageType::ClearCacheResponse:
+        validate_clear_cache_response(validator);
+        break;
+    case MessageType::ClearChargingProfile:
+        validate_clear_charging_profile_request(validator);
+        break;
+    case MessageType::ClearChargingProfileResponse:
+        validate_clear_charging_profile_response(validator);
+        break;
+    case MessageType::DataTransfer:
+        validate_data_transfer_request(validator);
+        break;
+    case MessageType::DataTransferResponse:
+        validate_data_transfer_response(validator);
+        break;
+    case MessageType::DeleteCertificate:
+        validate_delete_certificate_request(validator);
+        break;
+    case MessageType::DeleteCertificateResponse:
+        validate_delete_certificate_response(validator);
+        break;
+    case MessageType::DiagnosticsStatusNotification:
+        validate_diagnostics_status_notification_request(validator);
+        break;
+    case MessageType::DiagnosticsStatusNotificationResponse:
+        validate_diagnostics_status_notification_response(validator);
+        break;
+    case MessageType::ExtendedTriggerMessage:
+        validate_extended_trigger_message_request(validator);
+        break;
+    case MessageType::ExtendedTriggerMessageResponse:
+        validate_extended_trigger_message_response(validator);
+        break;
+    case MessageType::FirmwareStatusNotification:
+        validate_firmware_status_notification_request(validator);
+        break;
+    case MessageType::FirmwareStatusNotificationResponse:
+        validate_firmware_status_notification_response(validator);
+        break;
+    case MessageType::GetCompositeSchedule:
+        validate_get_composite_schedule_request(validator);
+        break;
+    case MessageType::GetCompositeScheduleResponse:
+        validate_get_composite_schedule_response(validator);
+        break;
+    case MessageType::GetConfiguration:
+        validate_get_configuration_request(validator);
+        break;
+    case MessageType::GetConfigurationResponse:
+        validate_get_configuration_response(validator);
+        break;
+    case MessageType::GetDiagnostics:
+        validate_get_diagnostics_request(validator);
+        break;
+    case MessageType::GetDiagnosticsResponse:
+        validate_get_diagnostics_response(validator);
+        break;
+    case MessageType::GetInstalledCertificateIds:
+        validate_get_installed_certificate_ids_request(validator);
+        break;
+    case MessageType::GetInstalledCertificateIdsResponse:
+        validate_get_installed_certificate_ids_response(validator);
+        break;
+    case MessageType::GetLocalListVersion:
+        validate_get_local_list_version_request(validator);
+        break;
+    case MessageType::GetLocalListVersionResponse:
+        validate_get_local_list_version_response(validator);
+        break;
+    case MessageType::GetLog:
+        validate_get_log_request(validator);
+        break;
+    case MessageType::GetLogResponse:
+        validate_get_log_response(validator);
+        break;
+    case MessageType::Heartbeat:
+        validate_heartbeat_request(validator);
+        break;
+    case MessageType::HeartbeatResponse:
+        validate_heartbeat_response(validator);
+        break;
+    case MessageType::InstallCertificate:
+        validate_install_certificate_request(validator);
+        break;
+    case MessageType::InstallCertificateResponse:
+        validate_install_certificate_response(validator);
+        break;
+    case MessageType::LogStatusNotification:
+        validate_log_status_notification_request(validator);
+        break;
+    case MessageType::LogStatusNotificationResponse:
+        validate_log_status_notification_response(validator);
+        break;
+    case MessageType::MeterValues:
+        validate_meter_values_request(validator);
+        break;
+    case MessageType::MeterValuesResponse:
+        validate_meter_values_response(validator);
+        break;
+    case MessageType::RemoteStartTransaction:
+        validate_remote_start_transaction_request(validator);
+        break;
+    case MessageType::RemoteStartTransactionResponse:
+        validate_remote_start_transaction_response(validator);
+        break;
+    case MessageType::RemoteStopTransaction:
+        validate_remote_stop_transaction_request(validator);
+        break;
+    case MessageType::RemoteStopTransactionResponse:
+        validate_remote_stop_transaction_response(validator);
+        break;
+    case MessageType::ReserveNow:
+        validate_reserve_now_request(validator);
+        break;
+    case MessageType::ReserveNowResponse:
+        validate_reserve_now_response(validator);
+        break;
+    case MessageType::Reset:
+        validate_reset_request(validator);
+        break;
+    case MessageType::ResetResponse:
+        validate_reset_response(validator);
+        break;
+    case MessageType::SecurityEventNotification:
+        validate_security_event_notification_request(validator);
+        break;
+    case MessageType::SecurityEventNotificationResponse:
+        validate_security_event_notification_response(validator);
+        break;
+    case MessageType::SendLocalList:
+        validate_send_local_list_request(validator);
+        break;
+    case MessageType::SendLocalListResponse:
+        validate_send_local_list_response(validator);
+        break;
+    case MessageType::SetChargingProfile:
+        validate_set_charging_profile_request(validator);
+        break;
+    case MessageType::SetChargingProfileResponse:
+        validate_set_charging_profile_response(validator);
+        break;
+    case MessageType::SignCertificate:
+        validate_sign_certificate_request(validator);
+        break;
+    case MessageType::SignCertificateResponse:
+        validate_sign_certificate_response(validator);
+        break;
+    case MessageType::SignedFirmwareStatusNotification:
+        validate_signed_firmware_status_notification_request(validator);
+        break;
+    case MessageType::SignedFirmwareStatusNotificationResponse:
+        validate_signed_firmware_status_notification_response(validator);
+        break;
+    case MessageType::SignedUpdateFirmware:
+        validate_signed_update_firmware_request(validator);
+        break;
+    case MessageType::SignedUpdateFirmwareResponse:
+        validate_signed_update_firmware_response(validator);
+        break;
+    case MessageType::StartTransaction:
+        validate_start_transaction_request(validator);
+        break;
+    case MessageType::StartTransactionResponse:
+        validate_start_transaction_response(validator);
+        break;
+    case MessageType::StatusNotification:
+        validate_status_notification_request(validator);
+        break;
+    case MessageType::StatusNotificationResponse:
+        validate_status_notification_response(validator);
+        break;
+    case MessageType::StopTransaction:
+        validate_stop_transaction_request(validator);
+        break;
+    case MessageType::StopTransactionResponse:
+        validate_stop_transaction_response(validator);
+        break;
+    case MessageType::TriggerMessage:
+        validate_trigger_message_request(validator);
+        break;
+    case MessageType::TriggerMessageResponse:
+        validate_trigger_message_response(validator);
+        break;
+    case MessageType::UnlockConnector:
+        validate_unlock_connector_request(validator);
+        break;
+    case MessageType::UnlockConnectorResponse:
+        validate_unlock_connector_response(validator);
+        break;
+    case MessageType::UpdateFirmware:
+        validate_update_firmware_request(validator);
+        break;
+    case MessageType::UpdateFirmwareResponse:
+        validate_update_firmware_response(validator);
+        break;
+    default:
+        validator.any();
+        break;
+    }
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -32,6 +32,40 @@ void from_json(const json& j, AuthorizeRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, AuthorizeRequest& k) {
+    bool has_idTag = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTag") {
+            reader.read(k.idTag);
+            has_idTag = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTag, "idTag");
+}
+
+void validate_authorize_request(JsonValidator& validator) {
+    bool has_idTag = false;
+    validator.object("AuthorizeRequest", [&](std::string_view key) {
+        if (key == "idTag") {
+            validator.string(20);
+            has_idTag = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTag, "AuthorizeRequest.idTag");
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -58,6 +92,40 @@ void from_json(const json& j, AuthorizeResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTagInfo", k.idTagInfo);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, AuthorizeResponse& k) {
+    bool has_idTagInfo = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTagInfo") {
+            reader.read(k.idTagInfo);
+            has_idTagInfo = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTagInfo, "idTagInfo");
+}
+
+void validate_authorize_response(JsonValidator& validator) {
+    bool has_idTagInfo = false;
+    validator.object("AuthorizeResponse", [&](std::string_view key) {
+        if (key == "idTagInfo") {
+            validate_id_tag_info(validator);
+            has_idTagInfo = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTagInfo, "AuthorizeResponse.idTagInfo");
+}
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k) {
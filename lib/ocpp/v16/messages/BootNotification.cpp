@@ -76,6 +76,100 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargePointVendor", k.chargePointVendor);
+    writer.member("chargePointModel", k.chargePointModel);
+    // the optional parts of the message
+    if (k.chargePointSerialNumber) {
+        writer.member("chargePointSerialNumber", k.chargePointSerialNumber.value());
+    }
+    if (k.chargeBoxSerialNumber) {
+        writer.member("chargeBoxSerialNumber", k.chargeBoxSerialNumber.value());
+    }
+    if (k.firmwareVersion) {
+        writer.member("firmwareVersion", k.firmwareVersion.value());
+    }
+    if (k.iccid) {
+        writer.member("iccid", k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.member("imsi", k.imsi.value());
+    }
+    if (k.meterType) {
+        writer.member("meterType", k.meterType.value());
+    }
+    if (k.meterSerialNumber) {
+        writer.member("meterSerialNumber", k.meterSerialNumber.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, BootNotificationRequest& k) {
+    bool has_chargePointVendor = false;
+    bool has_chargePointModel = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargePointVendor") {
+            reader.read(k.chargePointVendor);
+            has_chargePointVendor = true;
+        } else if (key == "chargePointModel") {
+            reader.read(k.chargePointModel);
+            has_chargePointModel = true;
+        } else if (key == "chargePointSerialNumber") {
+            reader.read(k.chargePointSerialNumber);
+        } else if (key == "chargeBoxSerialNumber") {
+            reader.read(k.chargeBoxSerialNumber);
+        } else if (key == "firmwareVersion") {
+            reader.read(k.firmwareVersion);
+        } else if (key == "iccid") {
+            reader.read(k.iccid);
+        } else if (key == "imsi") {
+            reader.read(k.imsi);
+        } else if (key == "meterType") {
+            reader.read(k.meterType);
+        } else if (key == "meterSerialNumber") {
+            reader.read(k.meterSerialNumber);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargePointVendor, "chargePointVendor");
+    reader.require_member(has_chargePointModel, "chargePointModel");
+}
+
+void validate_boot_notification_request(JsonValidator& validator) {
+    bool has_chargePointVendor = false;
+    bool has_chargePointModel = false;
+    validator.object("BootNotificationRequest", [&](std::string_view key) {
+        if (key == "chargePointVendor") {
+            validator.string(20);
+            has_chargePointVendor = true;
+        } else if (key == "chargePointModel") {
+            validator.string(20);
+            has_chargePointModel = true;
+        } else if (key == "chargePointSerialNumber") {
+            validator.string(25);
+        } else if (key == "chargeBoxSerialNumber") {
+            validator.string(25);
+        } else if (key == "firmwareVersion") {
+            validator.string(50);
+        } else if (key == "iccid") {
+            validator.string(20);
+        } else if (key == "imsi") {
+            validator.string(20);
+        } else if (key == "meterType") {
+            validator.string(25);
+        } else if (key == "meterSerialNumber") {
+            validator.string(25);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargePointVendor, "BootNotificationRequest.chargePointVendor");
+    validator.require_member(has_chargePointModel, "BootNotificationRequest.chargePointModel");
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -106,6 +200,62 @@ void from_json(const json& j, BootNotificationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::registration_status_to_string(k.status));
+    writer.member("currentTime", k.currentTime);
+    writer.member("interval", k.interval);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, BootNotificationResponse& k) {
+    bool has_status = false;
+    bool has_currentTime = false;
+    bool has_interval = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_registration_status(reader.read_string());
+            has_status = true;
+        } else if (key == "currentTime") {
+            reader.read(k.currentTime);
+            has_currentTime = true;
+        } else if (key == "interval") {
+            reader.read(k.interval);
+            has_interval = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+    reader.require_member(has_currentTime, "currentTime");
+    reader.require_member(has_interval, "interval");
+}
+
+void validate_boot_notification_response(JsonValidator& validator) {
+    bool has_status = false;
+    bool has_currentTime = false;
+    bool has_interval = false;
+    validator.object("BootNotificationResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_registration_status);
+            has_status = true;
+        } else if (key == "currentTime") {
+            validator.date_time();
+            has_currentTime = true;
+        } else if (key == "interval") {
+            validator.integer();
+            has_interval = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "BootNotificationResponse.status");
+    validator.require_member(has_currentTime, "BootNotificationResponse.currentTime");
+    validator.require_member(has_interval, "BootNotificationResponse.interval");
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
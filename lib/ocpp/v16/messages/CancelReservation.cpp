@@ -30,6 +30,40 @@ void from_json(const json& j, CancelReservationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("reservationId", k.reservationId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CancelReservationRequest& k) {
+    bool has_reservationId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "reservationId") {
+            reader.read(k.reservationId);
+            has_reservationId = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_reservationId, "reservationId");
+}
+
+void validate_cancel_reservation_request(JsonValidator& validator) {
+    bool has_reservationId = false;
+    validator.object("CancelReservationRequest", [&](std::string_view key) {
+        if (key == "reservationId") {
+            validator.integer();
+            has_reservationId = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_reservationId, "CancelReservationRequest.reservationId");
+}
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, CancelReservationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::cancel_reservation_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CancelReservationResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_cancel_reservation_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_cancel_reservation_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("CancelReservationResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_cancel_reservation_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "CancelReservationResponse.status");
+}
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k) {
@@ -30,6 +30,40 @@ void from_json(const json& j, CertificateSignedRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateChain", k.certificateChain);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CertificateSignedRequest& k) {
+    bool has_certificateChain = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateChain") {
+            reader.read(k.certificateChain);
+            has_certificateChain = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateChain, "certificateChain");
+}
+
+void validate_certificate_signed_request(JsonValidator& validator) {
+    bool has_certificateChain = false;
+    validator.object("CertificateSignedRequest", [&](std::string_view key) {
+        if (key == "certificateChain") {
+            validator.string(10000);
+            has_certificateChain = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateChain, "CertificateSignedRequest.certificateChain");
+}
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, CertificateSignedResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::certificate_signed_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CertificateSignedResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_certificate_signed_status_enum_type(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_certificate_signed_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("CertificateSignedResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_certificate_signed_status_enum_type);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "CertificateSignedResponse.status");
+}
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k) {
@@ -32,6 +32,51 @@ void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("type", conversions::availability_type_to_string(k.type));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeAvailabilityRequest& k) {
+    bool has_connectorId = false;
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_availability_type(reader.read_string());
+            has_type = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_type, "type");
+}
+
+void validate_change_availability_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_type = false;
+    validator.object("ChangeAvailabilityRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_availability_type);
+            has_type = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "ChangeAvailabilityRequest.connectorId");
+    validator.require_member(has_type, "ChangeAvailabilityRequest.type");
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k) {
@@ -58,6 +103,40 @@ void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::availability_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeAvailabilityResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_availability_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_change_availability_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ChangeAvailabilityResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_availability_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ChangeAvailabilityResponse.status");
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k) {
@@ -32,6 +32,51 @@ void from_json(const json& j, ChangeConfigurationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("key", k.key);
+    writer.member("value", k.value);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeConfigurationRequest& k) {
+    bool has_key = false;
+    bool has_value = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "key") {
+            reader.read(k.key);
+            has_key = true;
+        } else if (key == "value") {
+            reader.read(k.value);
+            has_value = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_key, "key");
+    reader.require_member(has_value, "value");
+}
+
+void validate_change_configuration_request(JsonValidator& validator) {
+    bool has_key = false;
+    bool has_value = false;
+    validator.object("ChangeConfigurationRequest", [&](std::string_view key) {
+        if (key == "key") {
+            validator.string(50);
+            has_key = true;
+        } else if (key == "value") {
+            validator.string(500);
+            has_value = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_key, "ChangeConfigurationRequest.key");
+    validator.require_member(has_value, "ChangeConfigurationRequest.value");
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k) {
@@ -58,6 +103,40 @@ void from_json(const json& j, ChangeConfigurationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::configuration_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeConfigurationResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_configuration_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_change_configuration_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ChangeConfigurationResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_configuration_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ChangeConfigurationResponse.status");
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k) {
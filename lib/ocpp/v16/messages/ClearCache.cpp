@@ -31,6 +31,25 @@ void from_json(const json& j, ClearCacheRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, ClearCacheRequest& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_clear_cache_request(JsonValidator& validator) {
+    validator.object("ClearCacheRequest", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -57,6 +76,40 @@ void from_json(const json& j, ClearCacheResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_cache_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearCacheResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_cache_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_clear_cache_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ClearCacheResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_cache_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearCacheResponse.status");
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
@@ -55,6 +55,59 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearChargingProfileRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else if (key == "chargingProfilePurpose") {
+            k.chargingProfilePurpose.emplace(
+                conversions::string_to_charging_profile_purpose_type(reader.read_string()));
+        } else if (key == "stackLevel") {
+            reader.read(k.stackLevel);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_clear_charging_profile_request(JsonValidator& validator) {
+    validator.object("ClearChargingProfileRequest", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else if (key == "chargingProfilePurpose") {
+            validator.enumeration(conversions::string_to_charging_profile_purpose_type);
+        } else if (key == "stackLevel") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k) {
@@ -81,6 +134,40 @@ void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_charging_profile_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearChargingProfileResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_charging_profile_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_clear_charging_profile_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ClearChargingProfileResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_charging_profile_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearChargingProfileResponse.status");
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k) {
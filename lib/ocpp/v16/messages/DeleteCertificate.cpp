@@ -30,6 +30,40 @@ void from_json(const json& j, DeleteCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateHashData", k.certificateHashData);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, DeleteCertificateRequest& k) {
+    bool has_certificateHashData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateHashData") {
+            reader.read(k.certificateHashData);
+            has_certificateHashData = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateHashData, "certificateHashData");
+}
+
+void validate_delete_certificate_request(JsonValidator& validator) {
+    bool has_certificateHashData = false;
+    validator.object("DeleteCertificateRequest", [&](std::string_view key) {
+        if (key == "certificateHashData") {
+            validate_certificate_hash_data_type(validator);
+            has_certificateHashData = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateHashData, "DeleteCertificateRequest.certificateHashData");
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, DeleteCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::delete_certificate_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, DeleteCertificateResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_delete_certificate_status_enum_type(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_delete_certificate_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("DeleteCertificateResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_delete_certificate_status_enum_type);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "DeleteCertificateResponse.status");
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k) {
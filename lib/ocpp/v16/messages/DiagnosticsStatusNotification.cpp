@@ -30,6 +30,40 @@ void from_json(const json& j, DiagnosticsStatusNotificationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::diagnostics_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, DiagnosticsStatusNotificationRequest& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_diagnostics_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_diagnostics_status_notification_request(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("DiagnosticsStatusNotificationRequest", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_diagnostics_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "DiagnosticsStatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k) {
@@ -57,6 +91,26 @@ void from_json(const json& j, DiagnosticsStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, DiagnosticsStatusNotificationResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_diagnostics_status_notification_response(JsonValidator& validator) {
+    validator.object("DiagnosticsStatusNotificationResponse",
+                     [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k) {
@@ -38,6 +38,47 @@ void from_json(const json& j, ExtendedTriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestedMessage", conversions::message_trigger_enum_type_to_string(k.requestedMessage));
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ExtendedTriggerMessageRequest& k) {
+    bool has_requestedMessage = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestedMessage") {
+            k.requestedMessage = conversions::string_to_message_trigger_enum_type(reader.read_string());
+            has_requestedMessage = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestedMessage, "requestedMessage");
+}
+
+void validate_extended_trigger_message_request(JsonValidator& validator) {
+    bool has_requestedMessage = false;
+    validator.object("ExtendedTriggerMessageRequest", [&](std::string_view key) {
+        if (key == "requestedMessage") {
+            validator.enumeration(conversions::string_to_message_trigger_enum_type);
+            has_requestedMessage = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestedMessage, "ExtendedTriggerMessageRequest.requestedMessage");
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k) {
@@ -64,6 +105,40 @@ void from_json(const json& j, ExtendedTriggerMessageResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::trigger_message_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ExtendedTriggerMessageResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_trigger_message_status_enum_type(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_extended_trigger_message_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ExtendedTriggerMessageResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_trigger_message_status_enum_type);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ExtendedTriggerMessageResponse.status");
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k) {
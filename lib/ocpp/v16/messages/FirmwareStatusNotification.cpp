@@ -30,6 +30,40 @@ void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::firmware_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, FirmwareStatusNotificationRequest& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_firmware_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_firmware_status_notification_request(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("FirmwareStatusNotificationRequest", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_firmware_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "FirmwareStatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k) {
@@ -57,6 +91,26 @@ void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, FirmwareStatusNotificationResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_firmware_status_notification_response(JsonValidator& validator) {
+    validator.object("FirmwareStatusNotificationResponse",
+                     [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k) {
@@ -40,6 +40,58 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("duration", k.duration);
+    // the optional parts of the message
+    if (k.chargingRateUnit) {
+        writer.member("chargingRateUnit", conversions::charging_rate_unit_to_string(k.chargingRateUnit.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCompositeScheduleRequest& k) {
+    bool has_connectorId = false;
+    bool has_duration = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "duration") {
+            reader.read(k.duration);
+            has_duration = true;
+        } else if (key == "chargingRateUnit") {
+            k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_duration, "duration");
+}
+
+void validate_get_composite_schedule_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_duration = false;
+    validator.object("GetCompositeScheduleRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "duration") {
+            validator.integer();
+            has_duration = true;
+        } else if (key == "chargingRateUnit") {
+            validator.enumeration(conversions::string_to_charging_rate_unit);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "GetCompositeScheduleRequest.connectorId");
+    validator.require_member(has_duration, "GetCompositeScheduleRequest.duration");
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k) {
@@ -84,6 +136,61 @@ void from_json(const json& j, GetCompositeScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_composite_schedule_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.scheduleStart) {
+        writer.member("scheduleStart", k.scheduleStart.value());
+    }
+    if (k.chargingSchedule) {
+        writer.member("chargingSchedule", k.chargingSchedule.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCompositeScheduleResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_composite_schedule_status(reader.read_string());
+            has_status = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else if (key == "scheduleStart") {
+            reader.read(k.scheduleStart);
+        } else if (key == "chargingSchedule") {
+            reader.read(k.chargingSchedule);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_composite_schedule_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetCompositeScheduleResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_composite_schedule_status);
+            has_status = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else if (key == "scheduleStart") {
+            validator.date_time();
+        } else if (key == "chargingSchedule") {
+            validate_charging_schedule(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetCompositeScheduleResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k) {
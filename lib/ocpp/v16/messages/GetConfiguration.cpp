@@ -47,6 +47,36 @@ void from_json(const json& j, GetConfigurationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.key) {
+        writer.member("key", k.key.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetConfigurationRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "key") {
+            reader.read(k.key);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_configuration_request(JsonValidator& validator) {
+    validator.object("GetConfigurationRequest", [&](std::string_view key) {
+        if (key == "key") {
+            validator.array([&]() { validator.string(50); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k) {
@@ -106,6 +136,43 @@ void from_json(const json& j, GetConfigurationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.configurationKey) {
+        writer.member("configurationKey", k.configurationKey.value());
+    }
+    if (k.unknownKey) {
+        writer.member("unknownKey", k.unknownKey.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetConfigurationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "configurationKey") {
+            reader.read(k.configurationKey);
+        } else if (key == "unknownKey") {
+            reader.read(k.unknownKey);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_configuration_response(JsonValidator& validator) {
+    validator.object("GetConfigurationResponse", [&](std::string_view key) {
+        if (key == "configurationKey") {
+            validator.array([&]() { validate_key_value(validator); });
+        } else if (key == "unknownKey") {
+            validator.array([&]() { validator.string(50); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k) {
@@ -56,6 +56,68 @@ void from_json(const json& j, GetDiagnosticsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    if (k.startTime) {
+        writer.member("startTime", k.startTime.value());
+    }
+    if (k.stopTime) {
+        writer.member("stopTime", k.stopTime.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetDiagnosticsRequest& k) {
+    bool has_location = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "location") {
+            reader.read(k.location);
+            has_location = true;
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else if (key == "startTime") {
+            reader.read(k.startTime);
+        } else if (key == "stopTime") {
+            reader.read(k.stopTime);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_location, "location");
+}
+
+void validate_get_diagnostics_request(JsonValidator& validator) {
+    bool has_location = false;
+    validator.object("GetDiagnosticsRequest", [&](std::string_view key) {
+        if (key == "location") {
+            validator.string();
+            has_location = true;
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else if (key == "startTime") {
+            validator.date_time();
+        } else if (key == "stopTime") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_location, "GetDiagnosticsRequest.location");
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k) {
@@ -85,6 +147,36 @@ void from_json(const json& j, GetDiagnosticsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.fileName) {
+        writer.member("fileName", k.fileName.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetDiagnosticsResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "fileName") {
+            reader.read(k.fileName);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_diagnostics_response(JsonValidator& validator) {
+    validator.object("GetDiagnosticsResponse", [&](std::string_view key) {
+        if (key == "fileName") {
+            validator.string(255);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k) {
@@ -32,6 +32,40 @@ void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateType", conversions::certificate_use_enum_type_to_string(k.certificateType));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetInstalledCertificateIdsRequest& k) {
+    bool has_certificateType = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateType") {
+            k.certificateType = conversions::string_to_certificate_use_enum_type(reader.read_string());
+            has_certificateType = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateType, "certificateType");
+}
+
+void validate_get_installed_certificate_ids_request(JsonValidator& validator) {
+    bool has_certificateType = false;
+    validator.object("GetInstalledCertificateIdsRequest", [&](std::string_view key) {
+        if (key == "certificateType") {
+            validator.enumeration(conversions::string_to_certificate_use_enum_type);
+            has_certificateType = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateType, "GetInstalledCertificateIdsRequest.certificateType");
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k) {
@@ -72,6 +106,47 @@ void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_installed_certificate_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    if (k.certificateHashData) {
+        writer.member("certificateHashData", k.certificateHashData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetInstalledCertificateIdsResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_installed_certificate_status_enum_type(reader.read_string());
+            has_status = true;
+        } else if (key == "certificateHashData") {
+            reader.read(k.certificateHashData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_installed_certificate_ids_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetInstalledCertificateIdsResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_installed_certificate_status_enum_type);
+            has_status = true;
+        } else if (key == "certificateHashData") {
+            validator.array([&]() { validate_certificate_hash_data_type(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetInstalledCertificateIdsResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k) {
@@ -31,6 +31,25 @@ void from_json(const json& j, GetLocalListVersionRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, GetLocalListVersionRequest& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_get_local_list_version_request(JsonValidator& validator) {
+    validator.object("GetLocalListVersionRequest", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k) {
@@ -57,6 +76,40 @@ void from_json(const json& j, GetLocalListVersionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("listVersion", k.listVersion);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetLocalListVersionResponse& k) {
+    bool has_listVersion = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "listVersion") {
+            reader.read(k.listVersion);
+            has_listVersion = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_listVersion, "listVersion");
+}
+
+void validate_get_local_list_version_response(JsonValidator& validator) {
+    bool has_listVersion = false;
+    validator.object("GetLocalListVersionResponse", [&](std::string_view key) {
+        if (key == "listVersion") {
+            validator.integer();
+            has_listVersion = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_listVersion, "GetLocalListVersionResponse.listVersion");
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k) {
@@ -31,6 +31,25 @@ void from_json(const json& j, HeartbeatRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, HeartbeatRequest& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_heartbeat_request(JsonValidator& validator) {
+    validator.object("HeartbeatRequest", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k) {
@@ -57,6 +76,40 @@ void from_json(const json& j, HeartbeatResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, HeartbeatResponse& k) {
+    bool has_currentTime = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "currentTime") {
+            reader.read(k.currentTime);
+            has_currentTime = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_currentTime, "currentTime");
+}
+
+void validate_heartbeat_response(JsonValidator& validator) {
+    bool has_currentTime = false;
+    validator.object("HeartbeatResponse", [&](std::string_view key) {
+        if (key == "currentTime") {
+            validator.date_time();
+            has_currentTime = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_currentTime, "HeartbeatResponse.currentTime");
+}
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k) {
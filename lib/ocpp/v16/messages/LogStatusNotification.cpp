@@ -38,6 +38,47 @@ void from_json(const json& j, LogStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::upload_log_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, LogStatusNotificationRequest& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_upload_log_status_enum_type(reader.read_string());
+            has_status = true;
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_log_status_notification_request(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("LogStatusNotificationRequest", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_upload_log_status_enum_type);
+            has_status = true;
+        } else if (key == "requestId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "LogStatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k) {
@@ -65,6 +106,25 @@ void from_json(const json& j, LogStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, LogStatusNotificationResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_log_status_notification_response(JsonValidator& validator) {
+    validator.object("LogStatusNotificationResponse", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k) {
@@ -42,6 +42,58 @@ void from_json(const json& j, MeterValuesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("meterValue", k.meterValue);
+    // the optional parts of the message
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesRequest& k) {
+    bool has_connectorId = false;
+    bool has_meterValue = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "meterValue") {
+            reader.read(k.meterValue);
+            has_meterValue = true;
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_meterValue, "meterValue");
+}
+
+void validate_meter_values_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_meterValue = false;
+    validator.object("MeterValuesRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "meterValue") {
+            validator.array([&]() { validate_meter_value(validator); });
+            has_meterValue = true;
+        } else if (key == "transactionId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "MeterValuesRequest.connectorId");
+    validator.require_member(has_meterValue, "MeterValuesRequest.meterValue");
+}
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k) {
@@ -69,6 +121,25 @@ void from_json(const json& j, MeterValuesResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, MeterValuesResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_meter_values_response(JsonValidator& validator) {
+    validator.object("MeterValuesResponse", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k) {
@@ -44,6 +44,54 @@ void from_json(const json& j, RemoteStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.chargingProfile) {
+        writer.member("chargingProfile", k.chargingProfile.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RemoteStartTransactionRequest& k) {
+    bool has_idTag = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTag") {
+            reader.read(k.idTag);
+            has_idTag = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else if (key == "chargingProfile") {
+            reader.read(k.chargingProfile);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTag, "idTag");
+}
+
+void validate_remote_start_transaction_request(JsonValidator& validator) {
+    bool has_idTag = false;
+    validator.object("RemoteStartTransactionRequest", [&](std::string_view key) {
+        if (key == "idTag") {
+            validator.string(20);
+            has_idTag = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else if (key == "chargingProfile") {
+            validate_charging_profile(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTag, "RemoteStartTransactionRequest.idTag");
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k) {
@@ -70,6 +118,40 @@ void from_json(const json& j, RemoteStartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::remote_start_stop_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RemoteStartTransactionResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_remote_start_stop_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_remote_start_transaction_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("RemoteStartTransactionResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_remote_start_stop_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "RemoteStartTransactionResponse.status");
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k) {
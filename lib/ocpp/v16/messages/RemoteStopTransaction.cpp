@@ -30,6 +30,40 @@ void from_json(const json& j, RemoteStopTransactionRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RemoteStopTransactionRequest& k) {
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+void validate_remote_stop_transaction_request(JsonValidator& validator) {
+    bool has_transactionId = false;
+    validator.object("RemoteStopTransactionRequest", [&](std::string_view key) {
+        if (key == "transactionId") {
+            validator.integer();
+            has_transactionId = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_transactionId, "RemoteStopTransactionRequest.transactionId");
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, RemoteStopTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::remote_start_stop_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RemoteStopTransactionResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_remote_start_stop_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_remote_stop_transaction_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("RemoteStopTransactionResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_remote_start_stop_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "RemoteStopTransactionResponse.status");
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k) {
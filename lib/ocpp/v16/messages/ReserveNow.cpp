@@ -44,6 +44,80 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("expiryDate", k.expiryDate);
+    writer.member("idTag", k.idTag);
+    writer.member("reservationId", k.reservationId);
+    // the optional parts of the message
+    if (k.parentIdTag) {
+        writer.member("parentIdTag", k.parentIdTag.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReserveNowRequest& k) {
+    bool has_connectorId = false;
+    bool has_expiryDate = false;
+    bool has_idTag = false;
+    bool has_reservationId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "expiryDate") {
+            reader.read(k.expiryDate);
+            has_expiryDate = true;
+        } else if (key == "idTag") {
+            reader.read(k.idTag);
+            has_idTag = true;
+        } else if (key == "reservationId") {
+            reader.read(k.reservationId);
+            has_reservationId = true;
+        } else if (key == "parentIdTag") {
+            reader.read(k.parentIdTag);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_expiryDate, "expiryDate");
+    reader.require_member(has_idTag, "idTag");
+    reader.require_member(has_reservationId, "reservationId");
+}
+
+void validate_reserve_now_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_expiryDate = false;
+    bool has_idTag = false;
+    bool has_reservationId = false;
+    validator.object("ReserveNowRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "expiryDate") {
+            validator.date_time();
+            has_expiryDate = true;
+        } else if (key == "idTag") {
+            validator.string(20);
+            has_idTag = true;
+        } else if (key == "reservationId") {
+            validator.integer();
+            has_reservationId = true;
+        } else if (key == "parentIdTag") {
+            validator.string(20);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "ReserveNowRequest.connectorId");
+    validator.require_member(has_expiryDate, "ReserveNowRequest.expiryDate");
+    validator.require_member(has_idTag, "ReserveNowRequest.idTag");
+    validator.require_member(has_reservationId, "ReserveNowRequest.reservationId");
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -70,6 +144,40 @@ void from_json(const json& j, ReserveNowResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::reservation_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReserveNowResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_reservation_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_reserve_now_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ReserveNowResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_reservation_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ReserveNowResponse.status");
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
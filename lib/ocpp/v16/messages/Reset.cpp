@@ -30,6 +30,40 @@ void from_json(const json& j, ResetRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("type", conversions::reset_type_to_string(k.type));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ResetRequest& k) {
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "type") {
+            k.type = conversions::string_to_reset_type(reader.read_string());
+            has_type = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_type, "type");
+}
+
+void validate_reset_request(JsonValidator& validator) {
+    bool has_type = false;
+    validator.object("ResetRequest", [&](std::string_view key) {
+        if (key == "type") {
+            validator.enumeration(conversions::string_to_reset_type);
+            has_type = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_type, "ResetRequest.type");
+}
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, ResetResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::reset_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ResetResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_reset_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_reset_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ResetResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_reset_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ResetResponse.status");
+}
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k) {
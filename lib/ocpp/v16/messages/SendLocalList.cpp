@@ -48,6 +48,58 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("listVersion", k.listVersion);
+    writer.member("updateType", conversions::update_type_to_string(k.updateType));
+    // the optional parts of the message
+    if (k.localAuthorizationList) {
+        writer.member("localAuthorizationList", k.localAuthorizationList.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SendLocalListRequest& k) {
+    bool has_listVersion = false;
+    bool has_updateType = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "listVersion") {
+            reader.read(k.listVersion);
+            has_listVersion = true;
+        } else if (key == "updateType") {
+            k.updateType = conversions::string_to_update_type(reader.read_string());
+            has_updateType = true;
+        } else if (key == "localAuthorizationList") {
+            reader.read(k.localAuthorizationList);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_listVersion, "listVersion");
+    reader.require_member(has_updateType, "updateType");
+}
+
+void validate_send_local_list_request(JsonValidator& validator) {
+    bool has_listVersion = false;
+    bool has_updateType = false;
+    validator.object("SendLocalListRequest", [&](std::string_view key) {
+        if (key == "listVersion") {
+            validator.integer();
+            has_listVersion = true;
+        } else if (key == "updateType") {
+            validator.enumeration(conversions::string_to_update_type);
+            has_updateType = true;
+        } else if (key == "localAuthorizationList") {
+            validator.array([&]() { validate_local_authorization_list(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_listVersion, "SendLocalListRequest.listVersion");
+    validator.require_member(has_updateType, "SendLocalListRequest.updateType");
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -74,6 +126,40 @@ void from_json(const json& j, SendLocalListResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SendLocalListResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_update_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_send_local_list_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SendLocalListResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_update_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SendLocalListResponse.status");
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
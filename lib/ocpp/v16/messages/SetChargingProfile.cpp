@@ -34,6 +34,51 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("csChargingProfiles", k.csChargingProfiles);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetChargingProfileRequest& k) {
+    bool has_connectorId = false;
+    bool has_csChargingProfiles = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "csChargingProfiles") {
+            reader.read(k.csChargingProfiles);
+            has_csChargingProfiles = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_csChargingProfiles, "csChargingProfiles");
+}
+
+void validate_set_charging_profile_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_csChargingProfiles = false;
+    validator.object("SetChargingProfileRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "csChargingProfiles") {
+            validate_charging_profile(validator);
+            has_csChargingProfiles = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "SetChargingProfileRequest.connectorId");
+    validator.require_member(has_csChargingProfiles, "SetChargingProfileRequest.csChargingProfiles");
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -60,6 +105,40 @@ void from_json(const json& j, SetChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::charging_profile_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetChargingProfileResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_charging_profile_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_charging_profile_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetChargingProfileResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_charging_profile_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetChargingProfileResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
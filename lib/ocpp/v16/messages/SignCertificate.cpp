@@ -30,6 +30,40 @@ void from_json(const json& j, SignCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("csr", k.csr);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SignCertificateRequest& k) {
+    bool has_csr = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "csr") {
+            reader.read(k.csr);
+            has_csr = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_csr, "csr");
+}
+
+void validate_sign_certificate_request(JsonValidator& validator) {
+    bool has_csr = false;
+    validator.object("SignCertificateRequest", [&](std::string_view key) {
+        if (key == "csr") {
+            validator.string(5500);
+            has_csr = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_csr, "SignCertificateRequest.csr");
+}
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, SignCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SignCertificateResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_status_enum_type(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_sign_certificate_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SignCertificateResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_status_enum_type);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SignCertificateResponse.status");
+}
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k) {
@@ -46,6 +46,65 @@ void from_json(const json& j, SignedUpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("firmware", k.firmware);
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SignedUpdateFirmwareRequest& k) {
+    bool has_requestId = false;
+    bool has_firmware = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "firmware") {
+            reader.read(k.firmware);
+            has_firmware = true;
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_firmware, "firmware");
+}
+
+void validate_signed_update_firmware_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_firmware = false;
+    validator.object("SignedUpdateFirmwareRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "firmware") {
+            validate_firmware_type(validator);
+            has_firmware = true;
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "SignedUpdateFirmwareRequest.requestId");
+    validator.require_member(has_firmware, "SignedUpdateFirmwareRequest.firmware");
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k) {
@@ -72,6 +131,40 @@ void from_json(const json& j, SignedUpdateFirmwareResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_firmware_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SignedUpdateFirmwareResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_update_firmware_status_enum_type(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_signed_update_firmware_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SignedUpdateFirmwareResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_update_firmware_status_enum_type);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SignedUpdateFirmwareResponse.status");
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k) {
@@ -44,6 +44,80 @@ void from_json(const json& j, StartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StartTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("idTag", k.idTag);
+    writer.member("meterStart", k.meterStart);
+    writer.member("timestamp", k.timestamp);
+    // the optional parts of the message
+    if (k.reservationId) {
+        writer.member("reservationId", k.reservationId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StartTransactionRequest& k) {
+    bool has_connectorId = false;
+    bool has_idTag = false;
+    bool has_meterStart = false;
+    bool has_timestamp = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "idTag") {
+            reader.read(k.idTag);
+            has_idTag = true;
+        } else if (key == "meterStart") {
+            reader.read(k.meterStart);
+            has_meterStart = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "reservationId") {
+            reader.read(k.reservationId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_idTag, "idTag");
+    reader.require_member(has_meterStart, "meterStart");
+    reader.require_member(has_timestamp, "timestamp");
+}
+
+void validate_start_transaction_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_idTag = false;
+    bool has_meterStart = false;
+    bool has_timestamp = false;
+    validator.object("StartTransactionRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "idTag") {
+            validator.string(20);
+            has_idTag = true;
+        } else if (key == "meterStart") {
+            validator.integer();
+            has_meterStart = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "reservationId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "StartTransactionRequest.connectorId");
+    validator.require_member(has_idTag, "StartTransactionRequest.idTag");
+    validator.require_member(has_meterStart, "StartTransactionRequest.meterStart");
+    validator.require_member(has_timestamp, "StartTransactionRequest.timestamp");
+}
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k) {
@@ -72,6 +146,51 @@ void from_json(const json& j, StartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const StartTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTagInfo", k.idTagInfo);
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StartTransactionResponse& k) {
+    bool has_idTagInfo = false;
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTagInfo") {
+            reader.read(k.idTagInfo);
+            has_idTagInfo = true;
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTagInfo, "idTagInfo");
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+void validate_start_transaction_response(JsonValidator& validator) {
+    bool has_idTagInfo = false;
+    bool has_transactionId = false;
+    validator.object("StartTransactionResponse", [&](std::string_view key) {
+        if (key == "idTagInfo") {
+            validate_id_tag_info(validator);
+            has_idTagInfo = true;
+        } else if (key == "transactionId") {
+            validator.integer();
+            has_transactionId = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTagInfo, "StartTransactionResponse.idTagInfo");
+    validator.require_member(has_transactionId, "StartTransactionResponse.transactionId");
+}
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k) {
@@ -60,6 +60,90 @@ void from_json(const json& j, StatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("errorCode", conversions::charge_point_error_code_to_string(k.errorCode));
+    writer.member("status", conversions::charge_point_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.info) {
+        writer.member("info", k.info.value());
+    }
+    if (k.timestamp) {
+        writer.member("timestamp", k.timestamp.value());
+    }
+    if (k.vendorId) {
+        writer.member("vendorId", k.vendorId.value());
+    }
+    if (k.vendorErrorCode) {
+        writer.member("vendorErrorCode", k.vendorErrorCode.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StatusNotificationRequest& k) {
+    bool has_connectorId = false;
+    bool has_errorCode = false;
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "errorCode") {
+            k.errorCode = conversions::string_to_charge_point_error_code(reader.read_string());
+            has_errorCode = true;
+        } else if (key == "status") {
+            k.status = conversions::string_to_charge_point_status(reader.read_string());
+            has_status = true;
+        } else if (key == "info") {
+            reader.read(k.info);
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+        } else if (key == "vendorId") {
+            reader.read(k.vendorId);
+        } else if (key == "vendorErrorCode") {
+            reader.read(k.vendorErrorCode);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+    reader.require_member(has_errorCode, "errorCode");
+    reader.require_member(has_status, "status");
+}
+
+void validate_status_notification_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    bool has_errorCode = false;
+    bool has_status = false;
+    validator.object("StatusNotificationRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "errorCode") {
+            validator.enumeration(conversions::string_to_charge_point_error_code);
+            has_errorCode = true;
+        } else if (key == "status") {
+            validator.enumeration(conversions::string_to_charge_point_status);
+            has_status = true;
+        } else if (key == "info") {
+            validator.string(50);
+        } else if (key == "timestamp") {
+            validator.date_time();
+        } else if (key == "vendorId") {
+            validator.string(255);
+        } else if (key == "vendorErrorCode") {
+            validator.string(50);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "StatusNotificationRequest.connectorId");
+    validator.require_member(has_errorCode, "StatusNotificationRequest.errorCode");
+    validator.require_member(has_status, "StatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k) {
@@ -87,6 +171,25 @@ void from_json(const json& j, StatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, StatusNotificationResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_status_notification_response(JsonValidator& validator) {
+    validator.object("StatusNotificationResponse", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k) {
@@ -62,6 +62,83 @@ void from_json(const json& j, StopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("meterStop", k.meterStop);
+    writer.member("timestamp", k.timestamp);
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.idTag) {
+        writer.member("idTag", k.idTag.value());
+    }
+    if (k.reason) {
+        writer.member("reason", conversions::reason_to_string(k.reason.value()));
+    }
+    if (k.transactionData) {
+        writer.member("transactionData", k.transactionData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StopTransactionRequest& k) {
+    bool has_meterStop = false;
+    bool has_timestamp = false;
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "meterStop") {
+            reader.read(k.meterStop);
+            has_meterStop = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else if (key == "idTag") {
+            reader.read(k.idTag);
+        } else if (key == "reason") {
+            k.reason.emplace(conversions::string_to_reason(reader.read_string()));
+        } else if (key == "transactionData") {
+            reader.read(k.transactionData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_meterStop, "meterStop");
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+void validate_stop_transaction_request(JsonValidator& validator) {
+    bool has_meterStop = false;
+    bool has_timestamp = false;
+    bool has_transactionId = false;
+    validator.object("StopTransactionRequest", [&](std::string_view key) {
+        if (key == "meterStop") {
+            validator.integer();
+            has_meterStop = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "transactionId") {
+            validator.integer();
+            has_transactionId = true;
+        } else if (key == "idTag") {
+            validator.string(20);
+        } else if (key == "reason") {
+            validator.enumeration(conversions::string_to_reason);
+        } else if (key == "transactionData") {
+            validator.array([&]() { validate_transaction_data(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_meterStop, "StopTransactionRequest.meterStop");
+    validator.require_member(has_timestamp, "StopTransactionRequest.timestamp");
+    validator.require_member(has_transactionId, "StopTransactionRequest.transactionId");
+}
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k) {
@@ -91,6 +168,36 @@ void from_json(const json& j, StopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.idTagInfo) {
+        writer.member("idTagInfo", k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StopTransactionResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTagInfo") {
+            reader.read(k.idTagInfo);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_stop_transaction_response(JsonValidator& validator) {
+    validator.object("StopTransactionResponse", [&](std::string_view key) {
+        if (key == "idTagInfo") {
+            validate_id_tag_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k) {
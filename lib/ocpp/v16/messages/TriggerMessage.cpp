@@ -38,6 +38,47 @@ void from_json(const json& j, TriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestedMessage", conversions::message_trigger_to_string(k.requestedMessage));
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TriggerMessageRequest& k) {
+    bool has_requestedMessage = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestedMessage") {
+            k.requestedMessage = conversions::string_to_message_trigger(reader.read_string());
+            has_requestedMessage = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestedMessage, "requestedMessage");
+}
+
+void validate_trigger_message_request(JsonValidator& validator) {
+    bool has_requestedMessage = false;
+    validator.object("TriggerMessageRequest", [&](std::string_view key) {
+        if (key == "requestedMessage") {
+            validator.enumeration(conversions::string_to_message_trigger);
+            has_requestedMessage = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestedMessage, "TriggerMessageRequest.requestedMessage");
+}
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k) {
@@ -64,6 +105,40 @@ void from_json(const json& j, TriggerMessageResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::trigger_message_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TriggerMessageResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_trigger_message_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_trigger_message_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("TriggerMessageResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_trigger_message_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "TriggerMessageResponse.status");
+}
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k) {
@@ -30,6 +30,40 @@ void from_json(const json& j, UnlockConnectorRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnlockConnectorRequest& k) {
+    bool has_connectorId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_connectorId, "connectorId");
+}
+
+void validate_unlock_connector_request(JsonValidator& validator) {
+    bool has_connectorId = false;
+    validator.object("UnlockConnectorRequest", [&](std::string_view key) {
+        if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_connectorId, "UnlockConnectorRequest.connectorId");
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k) {
@@ -56,6 +90,40 @@ void from_json(const json& j, UnlockConnectorResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::unlock_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnlockConnectorResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_unlock_status(reader.read_string());
+            has_status = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_unlock_connector_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("UnlockConnectorResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_unlock_status);
+            has_status = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "UnlockConnectorResponse.status");
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k) {
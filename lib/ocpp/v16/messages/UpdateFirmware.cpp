@@ -46,6 +46,65 @@ void from_json(const json& j, UpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDate", k.retrieveDate);
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UpdateFirmwareRequest& k) {
+    bool has_location = false;
+    bool has_retrieveDate = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "location") {
+            reader.read(k.location);
+            has_location = true;
+        } else if (key == "retrieveDate") {
+            reader.read(k.retrieveDate);
+            has_retrieveDate = true;
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_location, "location");
+    reader.require_member(has_retrieveDate, "retrieveDate");
+}
+
+void validate_update_firmware_request(JsonValidator& validator) {
+    bool has_location = false;
+    bool has_retrieveDate = false;
+    validator.object("UpdateFirmwareRequest", [&](std::string_view key) {
+        if (key == "location") {
+            validator.string();
+            has_location = true;
+        } else if (key == "retrieveDate") {
+            validator.date_time();
+            has_retrieveDate = true;
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_location, "UpdateFirmwareRequest.location");
+    validator.require_member(has_retrieveDate, "UpdateFirmwareRequest.retrieveDate");
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k) {
@@ -73,6 +132,25 @@ void from_json(const json& j, UpdateFirmwareResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    // no elements to pack, silence unused parameter warning
+    (void)k;
+}
+
+void read_json(JsonReader& reader, UpdateFirmwareResponse& k) {
+    reader.read_object([&reader](std::string_view) { reader.skip(); });
+    // no elements to unpack, silence unused parameter warning
+    (void)k;
+}
+
+void validate_update_firmware_response(JsonValidator& validator) {
+    validator.object("UpdateFirmwareResponse", [&validator](std::string_view) { validator.unknown_member(); });
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k) {
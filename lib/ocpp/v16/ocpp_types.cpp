@@ -42,6 +42,57 @@ void from_json(const json& j, IdTagInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTagInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdTagInfo& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::authorization_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.expiryDate) {
+        writer.member("expiryDate", k.expiryDate.value());
+    }
+    if (k.parentIdTag) {
+        writer.member("parentIdTag", k.parentIdTag.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given IdTagInfo \p k from the given \p reader
+void read_json(JsonReader& reader, IdTagInfo& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_authorization_status(reader.read_string());
+            has_status = true;
+        } else if (key == "expiryDate") {
+            reader.read(k.expiryDate);
+        } else if (key == "parentIdTag") {
+            reader.read(k.parentIdTag);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdTagInfo
+void validate_id_tag_info(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("IdTagInfo", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_authorization_status);
+            has_status = true;
+        } else if (key == "expiryDate") {
+            validator.date_time();
+        } else if (key == "parentIdTag") {
+            validator.string(20);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "IdTagInfo.status");
+}
+
 // \brief Writes the string representation of the given IdTagInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTagInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTagInfo& k) {
@@ -72,6 +123,76 @@ void from_json(const json& j, CertificateHashDataType& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given CertificateHashDataType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_type_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+/// \brief Reads the given CertificateHashDataType \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataType& k) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            k.hashAlgorithm = conversions::string_to_hash_algorithm_enum_type(reader.read_string());
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            reader.read(k.issuerNameHash);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            reader.read(k.issuerKeyHash);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            reader.read(k.serialNumber);
+            has_serialNumber = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_hashAlgorithm, "hashAlgorithm");
+    reader.require_member(has_issuerNameHash, "issuerNameHash");
+    reader.require_member(has_issuerKeyHash, "issuerKeyHash");
+    reader.require_member(has_serialNumber, "serialNumber");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataType
+void validate_certificate_hash_data_type(JsonValidator& validator) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    validator.object("CertificateHashDataType", [&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            validator.enumeration(conversions::string_to_hash_algorithm_enum_type);
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            validator.string(128);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            validator.string(128);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            validator.string(40);
+            has_serialNumber = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_hashAlgorithm, "CertificateHashDataType.hashAlgorithm");
+    validator.require_member(has_issuerNameHash, "CertificateHashDataType.issuerNameHash");
+    validator.require_member(has_issuerKeyHash, "CertificateHashDataType.issuerKeyHash");
+    validator.require_member(has_serialNumber, "CertificateHashDataType.serialNumber");
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -104,6 +225,61 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("startPeriod", k.startPeriod);
+    writer.member("limit", k.limit);
+    // the optional parts of the message
+    if (k.numberPhases) {
+        writer.member("numberPhases", k.numberPhases.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingSchedulePeriod \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedulePeriod& k) {
+    bool has_startPeriod = false;
+    bool has_limit = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "startPeriod") {
+            reader.read(k.startPeriod);
+            has_startPeriod = true;
+        } else if (key == "limit") {
+            reader.read(k.limit);
+            has_limit = true;
+        } else if (key == "numberPhases") {
+            reader.read(k.numberPhases);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_startPeriod, "startPeriod");
+    reader.require_member(has_limit, "limit");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedulePeriod
+void validate_charging_schedule_period(JsonValidator& validator) {
+    bool has_startPeriod = false;
+    bool has_limit = false;
+    validator.object("ChargingSchedulePeriod", [&](std::string_view key) {
+        if (key == "startPeriod") {
+            validator.integer();
+            has_startPeriod = true;
+        } else if (key == "limit") {
+            validator.number();
+            has_limit = true;
+        } else if (key == "numberPhases") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_startPeriod, "ChargingSchedulePeriod.startPeriod");
+    validator.require_member(has_limit, "ChargingSchedulePeriod.limit");
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -150,6 +326,75 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_to_string(k.chargingRateUnit));
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    // the optional parts of the message
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    if (k.startSchedule) {
+        writer.member("startSchedule", k.startSchedule.value());
+    }
+    if (k.minChargingRate) {
+        writer.member("minChargingRate", k.minChargingRate.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedule& k) {
+    bool has_chargingRateUnit = false;
+    bool has_chargingSchedulePeriod = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingRateUnit") {
+            k.chargingRateUnit = conversions::string_to_charging_rate_unit(reader.read_string());
+            has_chargingRateUnit = true;
+        } else if (key == "chargingSchedulePeriod") {
+            reader.read(k.chargingSchedulePeriod);
+            has_chargingSchedulePeriod = true;
+        } else if (key == "duration") {
+            reader.read(k.duration);
+        } else if (key == "startSchedule") {
+            reader.read(k.startSchedule);
+        } else if (key == "minChargingRate") {
+            reader.read(k.minChargingRate);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingRateUnit, "chargingRateUnit");
+    reader.require_member(has_chargingSchedulePeriod, "chargingSchedulePeriod");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedule
+void validate_charging_schedule(JsonValidator& validator) {
+    bool has_chargingRateUnit = false;
+    bool has_chargingSchedulePeriod = false;
+    validator.object("ChargingSchedule", [&](std::string_view key) {
+        if (key == "chargingRateUnit") {
+            validator.enumeration(conversions::string_to_charging_rate_unit);
+            has_chargingRateUnit = true;
+        } else if (key == "chargingSchedulePeriod") {
+            validator.array([&]() { validate_charging_schedule_period(validator); });
+            has_chargingSchedulePeriod = true;
+        } else if (key == "duration") {
+            validator.integer();
+        } else if (key == "startSchedule") {
+            validator.date_time();
+        } else if (key == "minChargingRate") {
+            validator.number();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingRateUnit, "ChargingSchedule.chargingRateUnit");
+    validator.require_member(has_chargingSchedulePeriod, "ChargingSchedule.chargingSchedulePeriod");
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -182,6 +427,61 @@ void from_json(const json& j, KeyValue& k) {
     }
 }
 
+/// \brief Writes the given KeyValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const KeyValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("key", k.key);
+    writer.member("readonly", k.readonly);
+    // the optional parts of the message
+    if (k.value) {
+        writer.member("value", k.value.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given KeyValue \p k from the given \p reader
+void read_json(JsonReader& reader, KeyValue& k) {
+    bool has_key = false;
+    bool has_readonly = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "key") {
+            reader.read(k.key);
+            has_key = true;
+        } else if (key == "readonly") {
+            reader.read(k.readonly);
+            has_readonly = true;
+        } else if (key == "value") {
+            reader.read(k.value);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_key, "key");
+    reader.require_member(has_readonly, "readonly");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a KeyValue
+void validate_key_value(JsonValidator& validator) {
+    bool has_key = false;
+    bool has_readonly = false;
+    validator.object("KeyValue", [&](std::string_view key) {
+        if (key == "key") {
+            validator.string(50);
+            has_key = true;
+        } else if (key == "readonly") {
+            validator.boolean();
+            has_readonly = true;
+        } else if (key == "value") {
+            validator.string(500);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_key, "KeyValue.key");
+    validator.require_member(has_readonly, "KeyValue.readonly");
+}
+
 // \brief Writes the string representation of the given KeyValue \p k to the given output stream \p os
 /// \returns an output stream with the KeyValue written to
 std::ostream& operator<<(std::ostream& os, const KeyValue& k) {
@@ -218,6 +518,57 @@ void from_json(const json& j, LogParametersType& k) {
     }
 }
 
+/// \brief Writes the given LogParametersType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogParametersType& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("remoteLocation", k.remoteLocation);
+    // the optional parts of the message
+    if (k.oldestTimestamp) {
+        writer.member("oldestTimestamp", k.oldestTimestamp.value());
+    }
+    if (k.latestTimestamp) {
+        writer.member("latestTimestamp", k.latestTimestamp.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given LogParametersType \p k from the given \p reader
+void read_json(JsonReader& reader, LogParametersType& k) {
+    bool has_remoteLocation = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "remoteLocation") {
+            reader.read(k.remoteLocation);
+            has_remoteLocation = true;
+        } else if (key == "oldestTimestamp") {
+            reader.read(k.oldestTimestamp);
+        } else if (key == "latestTimestamp") {
+            reader.read(k.latestTimestamp);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_remoteLocation, "remoteLocation");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogParametersType
+void validate_log_parameters_type(JsonValidator& validator) {
+    bool has_remoteLocation = false;
+    validator.object("LogParametersType", [&](std::string_view key) {
+        if (key == "remoteLocation") {
+            validator.string(512);
+            has_remoteLocation = true;
+        } else if (key == "oldestTimestamp") {
+            validator.date_time();
+        } else if (key == "latestTimestamp") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_remoteLocation, "LogParametersType.remoteLocation");
+}
+
 // \brief Writes the string representation of the given LogParametersType \p k to the given output stream \p os
 /// \returns an output stream with the LogParametersType written to
 std::ostream& operator<<(std::ostream& os, const LogParametersType& k) {
@@ -278,6 +629,85 @@ void from_json(const json& j, SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    // the optional parts of the message
+    if (k.context) {
+        writer.member("context", conversions::reading_context_to_string(k.context.value()));
+    }
+    if (k.format) {
+        writer.member("format", conversions::value_format_to_string(k.format.value()));
+    }
+    if (k.measurand) {
+        writer.member("measurand", conversions::measurand_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.member("phase", conversions::phase_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.member("location", conversions::location_to_string(k.location.value()));
+    }
+    if (k.unit) {
+        writer.member("unit", conversions::unit_of_measure_to_string(k.unit.value()));
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SampledValue \p k from the given \p reader
+void read_json(JsonReader& reader, SampledValue& k) {
+    bool has_value = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "value") {
+            reader.read(k.value);
+            has_value = true;
+        } else if (key == "context") {
+            k.context.emplace(conversions::string_to_reading_context(reader.read_string()));
+        } else if (key == "format") {
+            k.format.emplace(conversions::string_to_value_format(reader.read_string()));
+        } else if (key == "measurand") {
+            k.measurand.emplace(conversions::string_to_measurand(reader.read_string()));
+        } else if (key == "phase") {
+            k.phase.emplace(conversions::string_to_phase(reader.read_string()));
+        } else if (key == "location") {
+            k.location.emplace(conversions::string_to_location(reader.read_string()));
+        } else if (key == "unit") {
+            k.unit.emplace(conversions::string_to_unit_of_measure(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_value, "value");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SampledValue
+void validate_sampled_value(JsonValidator& validator) {
+    bool has_value = false;
+    validator.object("SampledValue", [&](std::string_view key) {
+        if (key == "value") {
+            validator.string();
+            has_value = true;
+        } else if (key == "context") {
+            validator.enumeration(conversions::string_to_reading_context);
+        } else if (key == "format") {
+            validator.enumeration(conversions::string_to_value_format);
+        } else if (key == "measurand") {
+            validator.enumeration(conversions::string_to_measurand);
+        } else if (key == "phase") {
+            validator.enumeration(conversions::string_to_phase);
+        } else if (key == "location") {
+            validator.enumeration(conversions::string_to_location);
+        } else if (key == "unit") {
+            validator.enumeration(conversions::string_to_unit_of_measure);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_value, "SampledValue.value");
+}
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
@@ -307,6 +737,54 @@ void from_json(const json& j, MeterValue& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given MeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp);
+    writer.member("sampledValue", k.sampledValue);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+/// \brief Reads the given MeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValue& k) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            reader.read(k.sampledValue);
+            has_sampledValue = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_sampledValue, "sampledValue");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValue
+void validate_meter_value(JsonValidator& validator) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    validator.object("MeterValue", [&](std::string_view key) {
+        if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            validator.array([&]() { validate_sampled_value(validator); });
+            has_sampledValue = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_timestamp, "MeterValue.timestamp");
+    validator.require_member(has_sampledValue, "MeterValue.sampledValue");
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -363,6 +841,116 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingProfileId", k.chargingProfileId);
+    writer.member("stackLevel", k.stackLevel);
+    writer.member("chargingProfilePurpose",
+                  conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose));
+    writer.member("chargingProfileKind", conversions::charging_profile_kind_type_to_string(k.chargingProfileKind));
+    writer.member("chargingSchedule", k.chargingSchedule);
+    // the optional parts of the message
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    if (k.recurrencyKind) {
+        writer.member("recurrencyKind", conversions::recurrency_kind_type_to_string(k.recurrencyKind.value()));
+    }
+    if (k.validFrom) {
+        writer.member("validFrom", k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.member("validTo", k.validTo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfile& k) {
+    bool has_chargingProfileId = false;
+    bool has_stackLevel = false;
+    bool has_chargingProfilePurpose = false;
+    bool has_chargingProfileKind = false;
+    bool has_chargingSchedule = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingProfileId") {
+            reader.read(k.chargingProfileId);
+            has_chargingProfileId = true;
+        } else if (key == "stackLevel") {
+            reader.read(k.stackLevel);
+            has_stackLevel = true;
+        } else if (key == "chargingProfilePurpose") {
+            k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_type(reader.read_string());
+            has_chargingProfilePurpose = true;
+        } else if (key == "chargingProfileKind") {
+            k.chargingProfileKind = conversions::string_to_charging_profile_kind_type(reader.read_string());
+            has_chargingProfileKind = true;
+        } else if (key == "chargingSchedule") {
+            reader.read(k.chargingSchedule);
+            has_chargingSchedule = true;
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else if (key == "recurrencyKind") {
+            k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_type(reader.read_string()));
+        } else if (key == "validFrom") {
+            reader.read(k.validFrom);
+        } else if (key == "validTo") {
+            reader.read(k.validTo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingProfileId, "chargingProfileId");
+    reader.require_member(has_stackLevel, "stackLevel");
+    reader.require_member(has_chargingProfilePurpose, "chargingProfilePurpose");
+    reader.require_member(has_chargingProfileKind, "chargingProfileKind");
+    reader.require_member(has_chargingSchedule, "chargingSchedule");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfile
+void validate_charging_profile(JsonValidator& validator) {
+    bool has_chargingProfileId = false;
+    bool has_stackLevel = false;
+    bool has_chargingProfilePurpose = false;
+    bool has_chargingProfileKind = false;
+    bool has_chargingSchedule = false;
+    validator.object("ChargingProfile", [&](std::string_view key) {
+        if (key == "chargingProfileId") {
+            validator.integer();
+            has_chargingProfileId = true;
+        } else if (key == "stackLevel") {
+            validator.integer();
+            has_stackLevel = true;
+        } else if (key == "chargingProfilePurpose") {
+            validator.enumeration(conversions::string_to_charging_profile_purpose_type);
+            has_chargingProfilePurpose = true;
+        } else if (key == "chargingProfileKind") {
+            validator.enumeration(conversions::string_to_charging_profile_kind_type);
+            has_chargingProfileKind = true;
+        } else if (key == "chargingSchedule") {
+            validate_charging_schedule(validator);
+            has_chargingSchedule = true;
+        } else if (key == "transactionId") {
+            validator.integer();
+        } else if (key == "recurrencyKind") {
+            validator.enumeration(conversions::string_to_recurrency_kind_type);
+        } else if (key == "validFrom") {
+            validator.date_time();
+        } else if (key == "validTo") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingProfileId, "ChargingProfile.chargingProfileId");
+    validator.require_member(has_stackLevel, "ChargingProfile.stackLevel");
+    validator.require_member(has_chargingProfilePurpose, "ChargingProfile.chargingProfilePurpose");
+    validator.require_member(has_chargingProfileKind, "ChargingProfile.chargingProfileKind");
+    validator.require_member(has_chargingSchedule, "ChargingProfile.chargingSchedule");
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -393,6 +981,50 @@ void from_json(const json& j, LocalAuthorizationList& k) {
     }
 }
 
+/// \brief Writes the given LocalAuthorizationList \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    if (k.idTagInfo) {
+        writer.member("idTagInfo", k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given LocalAuthorizationList \p k from the given \p reader
+void read_json(JsonReader& reader, LocalAuthorizationList& k) {
+    bool has_idTag = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTag") {
+            reader.read(k.idTag);
+            has_idTag = true;
+        } else if (key == "idTagInfo") {
+            reader.read(k.idTagInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTag, "idTag");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a LocalAuthorizationList
+void validate_local_authorization_list(JsonValidator& validator) {
+    bool has_idTag = false;
+    validator.object("LocalAuthorizationList", [&](std::string_view key) {
+        if (key == "idTag") {
+            validator.string(20);
+            has_idTag = true;
+        } else if (key == "idTagInfo") {
+            validate_id_tag_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTag, "LocalAuthorizationList.idTag");
+}
+
 // \brief Writes the string representation of the given LocalAuthorizationList \p k to the given output stream \p os
 /// \returns an output stream with the LocalAuthorizationList written to
 std::ostream& operator<<(std::ostream& os, const LocalAuthorizationList& k) {
@@ -430,6 +1062,83 @@ void from_json(const json& j, FirmwareType& k) {
     }
 }
 
+/// \brief Writes the given FirmwareType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareType& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDateTime", k.retrieveDateTime);
+    writer.member("signingCertificate", k.signingCertificate);
+    writer.member("signature", k.signature);
+    // the optional parts of the message
+    if (k.installDateTime) {
+        writer.member("installDateTime", k.installDateTime.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given FirmwareType \p k from the given \p reader
+void read_json(JsonReader& reader, FirmwareType& k) {
+    bool has_location = false;
+    bool has_retrieveDateTime = false;
+    bool has_signingCertificate = false;
+    bool has_signature = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "location") {
+            reader.read(k.location);
+            has_location = true;
+        } else if (key == "retrieveDateTime") {
+            reader.read(k.retrieveDateTime);
+            has_retrieveDateTime = true;
+        } else if (key == "signingCertificate") {
+            reader.read(k.signingCertificate);
+            has_signingCertificate = true;
+        } else if (key == "signature") {
+            reader.read(k.signature);
+            has_signature = true;
+        } else if (key == "installDateTime") {
+            reader.read(k.installDateTime);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_location, "location");
+    reader.require_member(has_retrieveDateTime, "retrieveDateTime");
+    reader.require_member(has_signingCertificate, "signingCertificate");
+    reader.require_member(has_signature, "signature");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a FirmwareType
+void validate_firmware_type(JsonValidator& validator) {
+    bool has_location = false;
+    bool has_retrieveDateTime = false;
+    bool has_signingCertificate = false;
+    bool has_signature = false;
+    validator.object("FirmwareType", [&](std::string_view key) {
+        if (key == "location") {
+            validator.string(512);
+            has_location = true;
+        } else if (key == "retrieveDateTime") {
+            validator.date_time();
+            has_retrieveDateTime = true;
+        } else if (key == "signingCertificate") {
+            validator.string(5500);
+            has_signingCertificate = true;
+        } else if (key == "signature") {
+            validator.string(800);
+            has_signature = true;
+        } else if (key == "installDateTime") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_location, "FirmwareType.location");
+    validator.require_member(has_retrieveDateTime, "FirmwareType.retrieveDateTime");
+    validator.require_member(has_signingCertificate, "FirmwareType.signingCertificate");
+    validator.require_member(has_signature, "FirmwareType.signature");
+}
+
 // \brief Writes the string representation of the given FirmwareType \p k to the given output stream \p os
 /// \returns an output stream with the FirmwareType written to
 std::ostream& operator<<(std::ostream& os, const FirmwareType& k) {
@@ -459,6 +1168,54 @@ void from_json(const json& j, TransactionData& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given TransactionData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const TransactionData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp);
+    writer.member("sampledValue", k.sampledValue);
+    // the optional parts of the message
+    writer.end_object();
+}
+
+/// \brief Reads the given TransactionData \p k from the given \p reader
+void read_json(JsonReader& reader, TransactionData& k) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            reader.read(k.sampledValue);
+            has_sampledValue = true;
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_sampledValue, "sampledValue");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a TransactionData
+void validate_transaction_data(JsonValidator& validator) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    validator.object("TransactionData", [&](std::string_view key) {
+        if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            validator.array([&]() { validate_sampled_value(validator); });
+            has_sampledValue = true;
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_timestamp, "TransactionData.timestamp");
+    validator.require_member(has_sampledValue, "TransactionData.sampledValue");
+}
+
 // \brief Writes the string representation of the given TransactionData \p k to the given output stream \p os
 /// \returns an output stream with the TransactionData written to
 std::ostream& operator<<(std::ostream& os, const TransactionData& k) {
@@ -14,7 +14,7 @@ namespace ocpp {
 namespace v16 {
 
 namespace conversions {
-std::string messagetype_to_string(MessageType m) {
+std::string_view messagetype_to_string(MessageType m) {
     switch (m) {
     case MessageType::Authorize:
         return "Authorize";
@@ -180,239 +180,481 @@ std::string messagetype_to_string(MessageType m) {
 }
 
 MessageType string_to_messagetype(const std::string& s) {
-    if (s == "Authorize") {
-        return MessageType::Authorize;
-    }
-    if (s == "AuthorizeResponse") {
-        return MessageType::AuthorizeResponse;
-    }
-    if (s == "BootNotification") {
-        return MessageType::BootNotification;
-    }
-    if (s == "BootNotificationResponse") {
-        return MessageType::BootNotificationResponse;
-    }
-    if (s == "CancelReservation") {
-        return MessageType::CancelReservation;
-    }
-    if (s == "CancelReservationResponse") {
-        return MessageType::CancelReservationResponse;
-    }
-    if (s == "CertificateSigned") {
-        return MessageType::CertificateSigned;
-    }
-    if (s == "CertificateSignedResponse") {
-        return MessageType::CertificateSignedResponse;
-    }
-    if (s == "ChangeAvailability") {
-        return MessageType::ChangeAvailability;
-    }
-    if (s == "ChangeAvailabilityResponse") {
-        return MessageType::ChangeAvailabilityResponse;
-    }
-    if (s == "ChangeConfiguration") {
-        return MessageType::ChangeConfiguration;
-    }
-    if (s == "ChangeConfigurationResponse") {
-        return MessageType::ChangeConfigurationResponse;
-    }
-    if (s == "ClearCache") {
-        return MessageType::ClearCache;
-    }
-    if (s == "ClearCacheResponse") {
-        return MessageType::ClearCacheResponse;
-    }
-    if (s == "ClearChargingProfile") {
-        return MessageType::ClearChargingProfile;
-    }
-    if (s == "ClearChargingProfileResponse") {
-        return MessageType::ClearChargingProfileResponse;
-    }
-    if (s == "DataTransfer") {
-        return MessageType::DataTransfer;
-    }
-    if (s == "DataTransferResponse") {
-        return MessageType::DataTransferResponse;
-    }
-    if (s == "DeleteCertificate") {
-        return MessageType::DeleteCertificate;
-    }
-    if (s == "DeleteCertificateResponse") {
-        return MessageType::DeleteCertificateResponse;
-    }
-    if (s == "DiagnosticsStatusNotification") {
-        return MessageType::DiagnosticsStatusNotification;
-    }
-    if (s == "DiagnosticsStatusNotificationResponse") {
-        return MessageType::DiagnosticsStatusNotificationResponse;
-    }
-    if (s == "ExtendedTriggerMessage") {
-        return MessageType::ExtendedTriggerMessage;
-    }
-    if (s == "ExtendedTriggerMessageResponse") {
-        return MessageType::ExtendedTriggerMessageResponse;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageType::FirmwareStatusNotification;
-    }
-    if (s == "FirmwareStatusNotificationResponse") {
-        return MessageType::FirmwareStatusNotificationResponse;
-    }
-    if (s == "GetCompositeSchedule") {
-        return MessageType::GetCompositeSchedule;
-    }
-    if (s == "GetCompositeScheduleResponse") {
-        return MessageType::GetCompositeScheduleResponse;
-    }
-    if (s == "GetConfiguration") {
-        return MessageType::GetConfiguration;
-    }
-    if (s == "GetConfigurationResponse") {
-        return MessageType::GetConfigurationResponse;
-    }
-    if (s == "GetDiagnostics") {
-        return MessageType::GetDiagnostics;
-    }
-    if (s == "GetDiagnosticsResponse") {
-        return MessageType::GetDiagnosticsResponse;
-    }
-    if (s == "GetInstalledCertificateIds") {
-        return MessageType::GetInstalledCertificateIds;
-    }
-    if (s == "GetInstalledCertificateIdsResponse") {
-        return MessageType::GetInstalledCertificateIdsResponse;
-    }
-    if (s == "GetLocalListVersion") {
-        return MessageType::GetLocalListVersion;
-    }
-    if (s == "GetLocalListVersionResponse") {
-        return MessageType::GetLocalListVersionResponse;
-    }
-    if (s == "GetLog") {
-        return MessageType::GetLog;
-    }
-    if (s == "GetLogResponse") {
-        return MessageType::GetLogResponse;
-    }
-    if (s == "Heartbeat") {
-        return MessageType::Heartbeat;
-    }
-    if (s == "HeartbeatResponse") {
-        return MessageType::HeartbeatResponse;
-    }
-    if (s == "InstallCertificate") {
-        return MessageType::InstallCertificate;
-    }
-    if (s == "InstallCertificateResponse") {
-        return MessageType::InstallCertificateResponse;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageType::LogStatusNotification;
-    }
-    if (s == "LogStatusNotificationResponse") {
-        return MessageType::LogStatusNotificationResponse;
-    }
-    if (s == "MeterValues") {
-        return MessageType::MeterValues;
-    }
-    if (s == "MeterValuesResponse") {
-        return MessageType::MeterValuesResponse;
-    }
-    if (s == "RemoteStartTransaction") {
-        return MessageType::RemoteStartTransaction;
-    }
-    if (s == "RemoteStartTransactionResponse") {
-        return MessageType::RemoteStartTransactionResponse;
-    }
-    if (s == "RemoteStopTransaction") {
-        return MessageType::RemoteStopTransaction;
-    }
-    if (s == "RemoteStopTransactionResponse") {
-        return MessageType::RemoteStopTransactionResponse;
-    }
-    if (s == "ReserveNow") {
-        return MessageType::ReserveNow;
-    }
-    if (s == "ReserveNowResponse") {
-        return MessageType::ReserveNowResponse;
-    }
-    if (s == "Reset") {
-        return MessageType::Reset;
-    }
-    if (s == "ResetResponse") {
-        return MessageType::ResetResponse;
-    }
-    if (s == "SecurityEventNotification") {
-        return MessageType::SecurityEventNotification;
-    }
-    if (s == "SecurityEventNotificationResponse") {
-        return MessageType::SecurityEventNotificationResponse;
-    }
-    if (s == "SendLocalList") {
-        return MessageType::SendLocalList;
-    }
-    if (s == "SendLocalListResponse") {
-        return MessageType::SendLocalListResponse;
-    }
-    if (s == "SetChargingProfile") {
-        return MessageType::SetChargingProfile;
-    }
-    if (s == "SetChargingProfileResponse") {
-        return MessageType::SetChargingProfileResponse;
-    }
-    if (s == "SignCertificate") {
-        return MessageType::SignCertificate;
-    }
-    if (s == "SignCertificateResponse") {
-        return MessageType::SignCertificateResponse;
-    }
-    if (s == "SignedFirmwareStatusNotification") {
-        return MessageType::SignedFirmwareStatusNotification;
-    }
-    if (s == "SignedFirmwareStatusNotificationResponse") {
-        return MessageType::SignedFirmwareStatusNotificationResponse;
-    }
-    if (s == "SignedUpdateFirmware") {
-        return MessageType::SignedUpdateFirmware;
-    }
-    if (s == "SignedUpdateFirmwareResponse") {
-        return MessageType::SignedUpdateFirmwareResponse;
-    }
-    if (s == "StartTransaction") {
-        return MessageType::StartTransaction;
-    }
-    if (s == "StartTransactionResponse") {
-        return MessageType::StartTransactionResponse;
-    }
-    if (s == "StatusNotification") {
-        return MessageType::StatusNotification;
-    }
-    if (s == "StatusNotificationResponse") {
-        return MessageType::StatusNotificationResponse;
-    }
-    if (s == "StopTransaction") {
-        return MessageType::StopTransaction;
-    }
-    if (s == "StopTransactionResponse") {
-        return MessageType::StopTransactionResponse;
-    }
-    if (s == "TriggerMessage") {
-        return MessageType::TriggerMessage;
-    }
-    if (s == "TriggerMessageResponse") {
-        return MessageType::TriggerMessageResponse;
-    }
-    if (s == "UnlockConnector") {
-        return MessageType::UnlockConnector;
-    }
-    if (s == "UnlockConnectorResponse") {
-        return MessageType::UnlockConnectorResponse;
-    }
-    if (s == "UpdateFirmware") {
-        return MessageType::UpdateFirmware;
-    }
-    if (s == "UpdateFirmwareResponse") {
-        return MessageType::UpdateFirmwareResponse;
+    switch (s.size()) {
+    case 5:
+        if (s == "Reset") {
+            return MessageType::Reset;
+        }
+        break;
+    case 6:
+        if (s == "GetLog") {
+            return MessageType::GetLog;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Authorize") {
+                return MessageType::Authorize;
+            }
+            break;
+        case 'H':
+            if (s == "Heartbeat") {
+                return MessageType::Heartbeat;
+            }
+            break;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearCache") {
+                return MessageType::ClearCache;
+            }
+            break;
+        case 'R':
+            if (s == "ReserveNow") {
+                return MessageType::ReserveNow;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageType::MeterValues;
+        }
+        break;
+    case 12:
+        if (s == "DataTransfer") {
+            return MessageType::DataTransfer;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'R':
+            if (s == "ResetResponse") {
+                return MessageType::ResetResponse;
+            }
+            break;
+        case 'S':
+            if (s == "SendLocalList") {
+                return MessageType::SendLocalList;
+            }
+            break;
+        }
+        break;
+    case 14:
+        switch (s[3]) {
+        case 'D':
+            if (s == "GetDiagnostics") {
+                return MessageType::GetDiagnostics;
+            }
+            break;
+        case 'L':
+            if (s == "GetLogResponse") {
+                return MessageType::GetLogResponse;
+            }
+            break;
+        case 'g':
+            if (s == "TriggerMessage") {
+                return MessageType::TriggerMessage;
+            }
+            break;
+        case 'a':
+            if (s == "UpdateFirmware") {
+                return MessageType::UpdateFirmware;
+            }
+            break;
+        }
+        break;
+    case 15:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignCertificate") {
+                return MessageType::SignCertificate;
+            }
+            break;
+        case 't':
+            if (s == "StopTransaction") {
+                return MessageType::StopTransaction;
+            }
+            break;
+        case 'n':
+            if (s == "UnlockConnector") {
+                return MessageType::UnlockConnector;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotification") {
+                return MessageType::BootNotification;
+            }
+            break;
+        case 'G':
+            if (s == "GetConfiguration") {
+                return MessageType::GetConfiguration;
+            }
+            break;
+        case 'S':
+            if (s == "StartTransaction") {
+                return MessageType::StartTransaction;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[2]) {
+        case 't':
+            if (s == "AuthorizeResponse") {
+                return MessageType::AuthorizeResponse;
+            }
+            break;
+        case 'n':
+            if (s == "CancelReservation") {
+                return MessageType::CancelReservation;
+            }
+            break;
+        case 'r':
+            if (s == "CertificateSigned") {
+                return MessageType::CertificateSigned;
+            }
+            break;
+        case 'l':
+            if (s == "DeleteCertificate") {
+                return MessageType::DeleteCertificate;
+            }
+            break;
+        case 'a':
+            if (s == "HeartbeatResponse") {
+                return MessageType::HeartbeatResponse;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[5]) {
+        case 'e':
+            if (s == "ChangeAvailability") {
+                return MessageType::ChangeAvailability;
+            }
+            break;
+        case 'C':
+            if (s == "ClearCacheResponse") {
+                return MessageType::ClearCacheResponse;
+            }
+            break;
+        case 'l':
+            if (s == "InstallCertificate") {
+                return MessageType::InstallCertificate;
+            }
+            break;
+        case 'v':
+            if (s == "ReserveNowResponse") {
+                return MessageType::ReserveNowResponse;
+            }
+            break;
+        case 'a':
+            if (s == "SetChargingProfile") {
+                return MessageType::SetChargingProfile;
+            }
+            break;
+        case 's':
+            if (s == "StatusNotification") {
+                return MessageType::StatusNotification;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChangeConfiguration") {
+                return MessageType::ChangeConfiguration;
+            }
+            break;
+        case 'G':
+            if (s == "GetLocalListVersion") {
+                return MessageType::GetLocalListVersion;
+            }
+            break;
+        case 'M':
+            if (s == "MeterValuesResponse") {
+                return MessageType::MeterValuesResponse;
+            }
+            break;
+        }
+        break;
+    case 20:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearChargingProfile") {
+                return MessageType::ClearChargingProfile;
+            }
+            break;
+        case 'D':
+            if (s == "DataTransferResponse") {
+                return MessageType::DataTransferResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetCompositeSchedule") {
+                return MessageType::GetCompositeSchedule;
+            }
+            break;
+        case 'S':
+            if (s == "SignedUpdateFirmware") {
+                return MessageType::SignedUpdateFirmware;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LogStatusNotification") {
+                return MessageType::LogStatusNotification;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStopTransaction") {
+                return MessageType::RemoteStopTransaction;
+            }
+            break;
+        case 'S':
+            if (s == "SendLocalListResponse") {
+                return MessageType::SendLocalListResponse;
+            }
+            break;
+        }
+        break;
+    case 22:
+        switch (s[0]) {
+        case 'E':
+            if (s == "ExtendedTriggerMessage") {
+                return MessageType::ExtendedTriggerMessage;
+            }
+            break;
+        case 'G':
+            if (s == "GetDiagnosticsResponse") {
+                return MessageType::GetDiagnosticsResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStartTransaction") {
+                return MessageType::RemoteStartTransaction;
+            }
+            break;
+        case 'T':
+            if (s == "TriggerMessageResponse") {
+                return MessageType::TriggerMessageResponse;
+            }
+            break;
+        case 'U':
+            if (s == "UpdateFirmwareResponse") {
+                return MessageType::UpdateFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 23:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignCertificateResponse") {
+                return MessageType::SignCertificateResponse;
+            }
+            break;
+        case 't':
+            if (s == "StopTransactionResponse") {
+                return MessageType::StopTransactionResponse;
+            }
+            break;
+        case 'n':
+            if (s == "UnlockConnectorResponse") {
+                return MessageType::UnlockConnectorResponse;
+            }
+            break;
+        }
+        break;
+    case 24:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotificationResponse") {
+                return MessageType::BootNotificationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetConfigurationResponse") {
+                return MessageType::GetConfigurationResponse;
+            }
+            break;
+        case 'S':
+            if (s == "StartTransactionResponse") {
+                return MessageType::StartTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 25:
+        switch (s[2]) {
+        case 'n':
+            if (s == "CancelReservationResponse") {
+                return MessageType::CancelReservationResponse;
+            }
+            break;
+        case 'r':
+            if (s == "CertificateSignedResponse") {
+                return MessageType::CertificateSignedResponse;
+            }
+            break;
+        case 'l':
+            if (s == "DeleteCertificateResponse") {
+                return MessageType::DeleteCertificateResponse;
+            }
+            break;
+        case 'c':
+            if (s == "SecurityEventNotification") {
+                return MessageType::SecurityEventNotification;
+            }
+            break;
+        }
+        break;
+    case 26:
+        switch (s[4]) {
+        case 'g':
+            if (s == "ChangeAvailabilityResponse") {
+                return MessageType::ChangeAvailabilityResponse;
+            }
+            break;
+        case 'w':
+            if (s == "FirmwareStatusNotification") {
+                return MessageType::FirmwareStatusNotification;
+            }
+            break;
+        case 'n':
+            if (s == "GetInstalledCertificateIds") {
+                return MessageType::GetInstalledCertificateIds;
+            }
+            break;
+        case 'a':
+            if (s == "InstallCertificateResponse") {
+                return MessageType::InstallCertificateResponse;
+            }
+            break;
+        case 'h':
+            if (s == "SetChargingProfileResponse") {
+                return MessageType::SetChargingProfileResponse;
+            }
+            break;
+        case 'u':
+            if (s == "StatusNotificationResponse") {
+                return MessageType::StatusNotificationResponse;
+            }
+            break;
+        }
+        break;
+    case 27:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChangeConfigurationResponse") {
+                return MessageType::ChangeConfigurationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetLocalListVersionResponse") {
+                return MessageType::GetLocalListVersionResponse;
+            }
+            break;
+        }
+        break;
+    case 28:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearChargingProfileResponse") {
+                return MessageType::ClearChargingProfileResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetCompositeScheduleResponse") {
+                return MessageType::GetCompositeScheduleResponse;
+            }
+            break;
+        case 'S':
+            if (s == "SignedUpdateFirmwareResponse") {
+                return MessageType::SignedUpdateFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DiagnosticsStatusNotification") {
+                return MessageType::DiagnosticsStatusNotification;
+            }
+            break;
+        case 'L':
+            if (s == "LogStatusNotificationResponse") {
+                return MessageType::LogStatusNotificationResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStopTransactionResponse") {
+                return MessageType::RemoteStopTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 30:
+        switch (s[0]) {
+        case 'E':
+            if (s == "ExtendedTriggerMessageResponse") {
+                return MessageType::ExtendedTriggerMessageResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStartTransactionResponse") {
+                return MessageType::RemoteStartTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 32:
+        if (s == "SignedFirmwareStatusNotification") {
+            return MessageType::SignedFirmwareStatusNotification;
+        }
+        break;
+    case 33:
+        if (s == "SecurityEventNotificationResponse") {
+            return MessageType::SecurityEventNotificationResponse;
+        }
+        break;
+    case 34:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareStatusNotificationResponse") {
+                return MessageType::FirmwareStatusNotificationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetInstalledCertificateIdsResponse") {
+                return MessageType::GetInstalledCertificateIdsResponse;
+            }
+            break;
+        }
+        break;
+    case 37:
+        if (s == "DiagnosticsStatusNotificationResponse") {
+            return MessageType::DiagnosticsStatusNotificationResponse;
+        }
+        break;
+    case 40:
+        if (s == "SignedFirmwareStatusNotificationResponse") {
+            return MessageType::SignedFirmwareStatusNotificationResponse;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageType");
@@ -428,7 +670,7 @@ std::ostream& operator<<(std::ostream& os, const MessageType& message_type) {
 namespace conversions {
 /// \brief Converts the given SupportedFeatureProfiles \p e to std::string
 /// \returns a string representation of the SupportedFeatureProfiles
-std::string supported_feature_profiles_to_string(SupportedFeatureProfiles e) {
+std::string_view supported_feature_profiles_to_string(SupportedFeatureProfiles e) {
     switch (e) {
     case SupportedFeatureProfiles::Internal:
         return "Internal";
@@ -458,35 +700,65 @@ std::string supported_feature_profiles_to_string(SupportedFeatureProfiles e) {
 /// \brief Converts the given std::string \p s to SupportedFeatureProfiles
 /// \returns a SupportedFeatureProfiles from a string representation
 SupportedFeatureProfiles string_to_supported_feature_profiles(const std::string& s) {
-    if (s == "Internal") {
-        return SupportedFeatureProfiles::Internal;
-    }
-    if (s == "Core") {
-        return SupportedFeatureProfiles::Core;
-    }
-    if (s == "FirmwareManagement") {
-        return SupportedFeatureProfiles::FirmwareManagement;
-    }
-    if (s == "LocalAuthListManagement") {
-        return SupportedFeatureProfiles::LocalAuthListManagement;
-    }
-    if (s == "Reservation") {
-        return SupportedFeatureProfiles::Reservation;
-    }
-    if (s == "SmartCharging") {
-        return SupportedFeatureProfiles::SmartCharging;
-    }
-    if (s == "RemoteTrigger") {
-        return SupportedFeatureProfiles::RemoteTrigger;
-    }
-    if (s == "Security") {
-        return SupportedFeatureProfiles::Security;
-    }
-    if (s == "PnC") {
-        return SupportedFeatureProfiles::PnC;
-    }
-    if (s == "Custom") {
-        return SupportedFeatureProfiles::Custom;
+    switch (s.size()) {
+    case 3:
+        if (s == "PnC") {
+            return SupportedFeatureProfiles::PnC;
+        }
+        break;
+    case 4:
+        if (s == "Core") {
+            return SupportedFeatureProfiles::Core;
+        }
+        break;
+    case 6:
+        if (s == "Custom") {
+            return SupportedFeatureProfiles::Custom;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'I':
+            if (s == "Internal") {
+                return SupportedFeatureProfiles::Internal;
+            }
+            break;
+        case 'S':
+            if (s == "Security") {
+                return SupportedFeatureProfiles::Security;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Reservation") {
+            return SupportedFeatureProfiles::Reservation;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SmartCharging") {
+                return SupportedFeatureProfiles::SmartCharging;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteTrigger") {
+                return SupportedFeatureProfiles::RemoteTrigger;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "FirmwareManagement") {
+            return SupportedFeatureProfiles::FirmwareManagement;
+        }
+        break;
+    case 23:
+        if (s == "LocalAuthListManagement") {
+            return SupportedFeatureProfiles::LocalAuthListManagement;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -503,7 +775,7 @@ std::ostream& operator<<(std::ostream& os, const SupportedFeatureProfiles& suppo
 
 namespace conversions {
 
-std::string charge_point_connection_state_to_string(ChargePointConnectionState e) {
+std::string_view charge_point_connection_state_to_string(ChargePointConnectionState e) {
     switch (e) {
     case ChargePointConnectionState::Disconnected:
         return "Disconnected";
@@ -521,20 +793,32 @@ std::string charge_point_connection_state_to_string(ChargePointConnectionState e
 }
 
 ChargePointConnectionState string_to_charge_point_connection_state(const std::string& s) {
-    if (s == "Disconnected") {
-        return ChargePointConnectionState::Disconnected;
-    }
-    if (s == "Connected") {
-        return ChargePointConnectionState::Connected;
-    }
-    if (s == "Booted") {
-        return ChargePointConnectionState::Booted;
-    }
-    if (s == "Pending") {
-        return ChargePointConnectionState::Pending;
-    }
-    if (s == "Rejected") {
-        return ChargePointConnectionState::Rejected;
+    switch (s.size()) {
+    case 6:
+        if (s == "Booted") {
+            return ChargePointConnectionState::Booted;
+        }
+        break;
+    case 7:
+        if (s == "Pending") {
+            return ChargePointConnectionState::Pending;
+        }
+        break;
+    case 8:
+        if (s == "Rejected") {
+            return ChargePointConnectionState::Rejected;
+        }
+        break;
+    case 9:
+        if (s == "Connected") {
+            return ChargePointConnectionState::Connected;
+        }
+        break;
+    case 12:
+        if (s == "Disconnected") {
+            return ChargePointConnectionState::Disconnected;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -7,7 +7,6 @@
 #include <ocpp/v201/device_model_storage_sqlite.hpp>
 #include <ocpp/v201/messages/FirmwareStatusNotification.hpp>
 #include <ocpp/v201/messages/LogStatusNotification.hpp>
-#include <ocpp/v201/notify_report_requests_splitter.hpp>
 
 #include <optional>
 #include <stdexcept>
@@ -83,8 +82,21 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
     this->device_model = std::make_unique<DeviceModel>(std::move(device_model_storage));
     this->device_model->check_integrity(evse_connector_structure);
 
-    auto database_connection = std::make_unique<common::DatabaseConnection>(fs::path(core_database_path) / "cp.db");
-    this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path);
+    const auto device_model_flush_interval =
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::DeviceModelFlushInterval)
+            .value_or(0);
+    if (device_model_flush_interval > 0) {
+        this->device_model->set_volatile_values_enabled(true);
+        this->device_model_flush_timer.interval([this]() { this->device_model->flush_volatile_values(); },
+                                                std::chrono::seconds(device_model_flush_interval));
+    }
+
+    const auto database_file_path = fs::path(core_database_path) / "cp.db";
+    auto database_connection = std::make_unique<common::DatabaseConnection>(database_file_path);
+    // the transaction queue is written in batches from its own thread, so it gets its own connection
+    auto transaction_queue_connection = std::make_unique<common::DatabaseConnection>(database_file_path);
+    this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path,
+                                                               std::move(transaction_queue_connection));
     this->database_handler->open_connection();
 
     // Set up the component state manager
@@ -135,10 +147,10 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
                 return;
             }
 
-            const auto filter_vec = utils::get_measurands_vec(this->device_model->get_value<std::string>(
+            const auto filter_vec = utils::get_measurands_vec(this->device_model->get_value(
                 type == ReadingContextEnum::Sample_Clock
-                    ? ControllerComponentVariables::AlignedDataMeasurands
-                    : ControllerComponentVariables::SampledDataTxUpdatedMeasurands));
+                    ? ControllerComponentVariableHandles::AlignedDataMeasurands
+                    : ControllerComponentVariableHandles::SampledDataTxUpdatedMeasurands));
 
             const auto filtered_meter_value = utils::get_meter_value_with_measurands_applied(_meter_value, filter_vec);
 
@@ -163,17 +175,70 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
     // configure logging
     this->configure_message_logging_format(message_log_path);
 
+    MessageQueueConfig message_queue_config{
+        this->device_model->get_value(ControllerComponentVariableHandles::MessageAttempts),
+        this->device_model->get_value(ControllerComponentVariableHandles::MessageAttemptInterval),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::MessageQueueSizeThreshold)
+            .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::QueueAllMessages).value_or(false),
+        this->device_model->get_value(ControllerComponentVariableHandles::MessageTimeout)};
+    message_queue_config.transaction_message_commit_interval_ms =
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::TransactionQueueCommitInterval)
+            .value_or(0);
+    message_queue_config.strict_message_validation =
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::StrictMessageValidation)
+            .value_or(false);
+    message_queue_config.transaction_update_compaction_items_per_message =
+        this->device_model
+            ->get_optional_value(ControllerComponentVariableHandles::TransactionUpdateCompactionItemsPerMessage)
+            .value_or(0);
+    message_queue_config.transaction_update_compaction_bytes_per_message =
+        this->device_model
+            ->get_optional_value(ControllerComponentVariableHandles::TransactionUpdateCompactionBytesPerMessage)
+            .value_or(0);
+
     this->message_queue = std::make_unique<ocpp::MessageQueue<v201::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig{
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
-                .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
-                .value_or(false),
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)},
-        this->database_handler);
+        [this](const json& message, const std::function<void(bool sent)>& on_sent) {
+            return this->websocket->send(message, on_sent);
+        },
+        message_queue_config, std::vector<v201::MessageType>{}, this->database_handler);
+    this->message_queue->set_write_callback(
+        [this](const JsonWriteFunction& write, const std::function<void(bool sent)>& on_sent) {
+            return this->websocket->send(write, on_sent);
+        });
+    // potentially large requests are read directly into their typed representation
+    this->message_queue->set_raw_message_types({MessageType::SetVariables, MessageType::SendLocalList});
+    // after a reconnect only the latest status of every connector is of interest, and a single queued heartbeat answers
+    // all heartbeats sent meanwhile
+    this->message_queue->set_coalescing_rule(
+        MessageType::StatusNotification,
+        {CoalescingPolicy::LatestWins, [](const json& payload) -> std::optional<std::string> {
+             return payload.at("evseId").dump() + "/" + payload.at("connectorId").dump();
+         }});
+    this->message_queue->set_coalescing_rule(
+        MessageType::Heartbeat,
+        {CoalescingPolicy::FirstWins, [](const json&) -> std::optional<std::string> { return std::string(); }});
+    // a TransactionEvent(Updated) merged into the previous queued event of its transaction gives its seqNo back, so the
+    // next event of the transaction continues without a gap
+    this->message_queue->set_sequence_number_rollback([this](const std::string& transaction_id, int32_t seq_no) {
+        for (const auto& [evse_id, evse] : this->evses) {
+            if (evse->has_active_transaction() && evse->get_transaction()->transactionId.get() == transaction_id) {
+                return evse->get_transaction()->release_seq_no(seq_no);
+            }
+        }
+        return false;
+    });
+
+    // monitors are evaluated when the values of the variables they monitor are set
+    this->monitoring_engine = std::make_unique<VariableMonitoringEngine>(
+        *this->device_model, [this](const std::vector<EventData>& events) { this->notify_event_req(events); },
+        [this]() { return this->websocket == nullptr or this->is_offline(); },
+        [this](const std::optional<EVSE>& evse) { return this->any_transaction_active(evse); });
+    this->device_model->set_monitored_value_changed_callback(
+        [this](const Component& component, const Variable& variable, const std::vector<VariableMonitoring>& monitors,
+               const std::optional<std::string>& previous_value, const std::string& value) {
+            this->monitoring_engine->on_value_changed(component, variable, monitors, previous_value, value);
+        });
 }
 
 void ChargePoint::start(BootReasonEnum bootreason) {
@@ -185,6 +250,7 @@ void ChargePoint::start(BootReasonEnum bootreason) {
     // get transaction messages from db (if there are any) so they can be sent again.
     this->message_queue->get_transaction_messages_from_db();
     this->start_websocket();
+    this->monitoring_engine->start();
 
     if (this->bootreason == BootReasonEnum::RemoteReset) {
         this->security_event_notification_req(
@@ -197,13 +263,13 @@ void ChargePoint::start(BootReasonEnum bootreason) {
     } else if (this->bootreason == BootReasonEnum::PowerUp) {
         std::string startup_message = "Charging Station powered up! Firmware version: ";
         startup_message.append(
-            this->device_model->get_value<std::string>(ControllerComponentVariables::FirmwareVersion));
+            this->device_model->get_value(ControllerComponentVariableHandles::FirmwareVersion));
         this->security_event_notification_req(CiString<50>(ocpp::security_events::STARTUP_OF_THE_DEVICE),
                                               std::optional<CiString<255>>(startup_message), true, true);
     } else {
         std::string startup_message = "Charging station reset or reboot. Firmware version: ";
         startup_message.append(
-            this->device_model->get_value<std::string>(ControllerComponentVariables::FirmwareVersion));
+            this->device_model->get_value(ControllerComponentVariableHandles::FirmwareVersion));
         this->security_event_notification_req(CiString<50>(ocpp::security_events::RESET_OR_REBOOT),
                                               std::optional<CiString<255>>(startup_message), true, true);
     }
@@ -224,8 +290,11 @@ void ChargePoint::stop() {
     this->websocket_timer.stop();
     this->client_certificate_expiration_check_timer.stop();
     this->v2g_certificate_expiration_check_timer.stop();
+    this->monitoring_engine->stop();
     this->disconnect_websocket(WebsocketCloseReason::Normal);
     this->message_queue->stop();
+    this->device_model_flush_timer.stop();
+    this->device_model->flush_volatile_values();
 }
 
 void ChargePoint::connect_websocket() {
@@ -268,7 +337,7 @@ void ChargePoint::on_firmware_update_status_notification(int32_t request_id,
     if (req.status == FirmwareStatusEnum::Installed) {
         std::string firmwareVersionMessage = "New firmware succesfully installed! Version: ";
         firmwareVersionMessage.append(
-            this->device_model->get_value<std::string>(ControllerComponentVariables::FirmwareVersion));
+            this->device_model->get_value(ControllerComponentVariableHandles::FirmwareVersion));
         this->security_event_notification_req(CiString<50>(ocpp::security_events::FIRMWARE_UPDATED),
                                               std::optional<CiString<255>>(firmwareVersionMessage), true,
                                               true); // L01.FR.31
@@ -305,7 +374,7 @@ void ChargePoint::on_session_started(const int32_t evse_id, const int32_t connec
 Get15118EVCertificateResponse
 ChargePoint::on_get_15118_ev_certificate_request(const Get15118EVCertificateRequest& request) {
     if (!this->device_model
-             ->get_optional_value<bool>(ControllerComponentVariables::ContractCertificateInstallationEnabled)
+             ->get_optional_value(ControllerComponentVariableHandles::ContractCertificateInstallationEnabled)
              .value_or(false)) {
         EVLOG_warning << "Can not fulfill Get15118EVCertificateRequest because ContractCertificateInstallationEnabled "
                          "is configured as false!";
@@ -342,17 +411,17 @@ void ChargePoint::on_transaction_started(const int32_t evse_id, const int32_t co
     this->evses.at(evse_id)->open_transaction(
         session_id, connector_id, timestamp, meter_start, id_token, group_id_token, reservation_id,
         std::chrono::seconds(
-            this->device_model->get_value<int>(ControllerComponentVariables::SampledDataTxUpdatedInterval)),
+            this->device_model->get_value(ControllerComponentVariableHandles::SampledDataTxUpdatedInterval)),
         std::chrono::seconds(
-            this->device_model->get_value<int>(ControllerComponentVariables::SampledDataTxEndedInterval)),
-        std::chrono::seconds(this->device_model->get_value<int>(ControllerComponentVariables::AlignedDataInterval)),
+            this->device_model->get_value(ControllerComponentVariableHandles::SampledDataTxEndedInterval)),
+        std::chrono::seconds(this->device_model->get_value(ControllerComponentVariableHandles::AlignedDataInterval)),
         std::chrono::seconds(
-            this->device_model->get_value<int>(ControllerComponentVariables::AlignedDataTxEndedInterval)));
+            this->device_model->get_value(ControllerComponentVariableHandles::AlignedDataTxEndedInterval)));
     const auto& enhanced_transaction = this->evses.at(evse_id)->get_transaction();
     enhanced_transaction->chargingState = charging_state;
     const auto meter_value = utils::get_meter_value_with_measurands_applied(
-        meter_start, utils::get_measurands_vec(this->device_model->get_value<std::string>(
-                         ControllerComponentVariables::SampledDataTxStartedMeasurands)));
+        meter_start, utils::get_measurands_vec(this->device_model->get_value(
+                         ControllerComponentVariableHandles::SampledDataTxStartedMeasurands)));
 
     Transaction transaction{enhanced_transaction->transactionId};
     transaction.chargingState = charging_state;
@@ -395,13 +464,13 @@ void ChargePoint::on_transaction_finished(const int32_t evse_id, const DateTime&
         meter_values = std::make_optional(utils::get_meter_values_with_measurands_applied(
             this->database_handler->transaction_metervalues_get_all(transaction_id),
             utils::get_measurands_vec(
-                this->device_model->get_value<std::string>(ControllerComponentVariables::SampledDataTxEndedMeasurands)),
+                this->device_model->get_value(ControllerComponentVariableHandles::SampledDataTxEndedMeasurands)),
             utils::get_measurands_vec(
-                this->device_model->get_value<std::string>(ControllerComponentVariables::AlignedDataTxEndedMeasurands)),
+                this->device_model->get_value(ControllerComponentVariableHandles::AlignedDataTxEndedMeasurands)),
             timestamp,
-            this->device_model->get_optional_value<bool>(ControllerComponentVariables::SampledDataSignReadings)
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::SampledDataSignReadings)
                 .value_or(false),
-            this->device_model->get_optional_value<bool>(ControllerComponentVariables::AlignedDataSignReadings)
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::AlignedDataSignReadings)
                 .value_or(false)));
 
         if (meter_values.value().empty()) {
@@ -574,7 +643,7 @@ void ChargePoint::clear_customer_information(const std::optional<CertificateHash
 }
 
 void ChargePoint::configure_message_logging_format(const std::string& message_log_path) {
-    auto log_formats = this->device_model->get_value<std::string>(ControllerComponentVariables::LogMessagesFormat);
+    auto log_formats = this->device_model->get_value(ControllerComponentVariableHandles::LogMessagesFormat);
     bool log_to_console = log_formats.find("console") != log_formats.npos;
     bool detailed_log_to_console = log_formats.find("console_detailed") != log_formats.npos;
     bool log_to_file = log_formats.find("log") != log_formats.npos;
@@ -646,7 +715,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
 
     // C03.FR.01 && C05.FR.01: We SHALL NOT send an authorize reqeust for IdTokenType Central
     if (id_token.type == IdTokenEnum::Central or
-        !this->device_model->get_optional_value<bool>(ControllerComponentVariables::AuthCtrlrEnabled).value_or(true)) {
+        !this->device_model->get_optional_value(ControllerComponentVariableHandles::AuthCtrlrEnabled).value_or(true)) {
         response.idTokenInfo.status = AuthorizationStatusEnum::Accepted;
         return response;
     }
@@ -671,13 +740,13 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
 
             bool central_contract_validation_allowed =
                 this->device_model
-                    ->get_optional_value<bool>(ControllerComponentVariables::CentralContractValidationAllowed)
+                    ->get_optional_value(ControllerComponentVariableHandles::CentralContractValidationAllowed)
                     .value_or(true);
             bool contract_validation_offline =
-                this->device_model->get_optional_value<bool>(ControllerComponentVariables::ContractValidationOffline)
+                this->device_model->get_optional_value(ControllerComponentVariableHandles::ContractValidationOffline)
                     .value_or(true);
             bool local_authorize_offline =
-                this->device_model->get_optional_value<bool>(ControllerComponentVariables::LocalAuthorizeOffline)
+                this->device_model->get_optional_value(ControllerComponentVariableHandles::LocalAuthorizeOffline)
                     .value_or(true);
 
             // C07.FR.01: When CS is online, it shall send an AuthorizeRequest
@@ -758,7 +827,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
         }
     }
 
-    if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::LocalAuthListCtrlrEnabled)
+    if (this->device_model->get_optional_value(ControllerComponentVariableHandles::LocalAuthListCtrlrEnabled)
             .value_or(false)) {
         std::optional<IdTokenInfo> id_token_info = std::nullopt;
         try {
@@ -775,7 +844,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
                 EVLOG_info << "Found valid entry in local authorization list";
                 response.idTokenInfo = id_token_info.value();
             } else if (this->device_model
-                           ->get_optional_value<bool>(ControllerComponentVariables::DisableRemoteAuthorization)
+                           ->get_optional_value(ControllerComponentVariableHandles::DisableRemoteAuthorization)
                            .value_or(false)) {
                 EVLOG_info << "Found invalid entry in local authorization list but not sending Authorize.req because "
                               "RemoteAuthorization is disabled";
@@ -795,7 +864,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
 
     const auto hashed_id_token = utils::generate_token_hash(id_token);
     const auto auth_cache_enabled =
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::AuthCacheCtrlrEnabled)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::AuthCacheCtrlrEnabled)
             .value_or(false);
 
     if (auth_cache_enabled) {
@@ -809,13 +878,13 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
                            "new request";
                     this->database_handler->authorization_cache_delete_entry(hashed_id_token);
                     this->update_authorization_cache_size();
-                } else if (this->device_model->get_value<bool>(ControllerComponentVariables::LocalPreAuthorize) and
+                } else if (this->device_model->get_value(ControllerComponentVariableHandles::LocalPreAuthorize) and
                            cache_entry.value().status == AuthorizationStatusEnum::Accepted) {
                     EVLOG_info << "Found valid entry in AuthCache";
                     response.idTokenInfo = cache_entry.value();
                     return response;
                 } else if (this->device_model
-                               ->get_optional_value<bool>(ControllerComponentVariables::AuthCacheDisablePostAuthorize)
+                               ->get_optional_value(ControllerComponentVariableHandles::AuthCacheDisablePostAuthorize)
                                .value_or(false)) {
                     EVLOG_info << "Found invalid entry in AuthCache: Not sending new request because "
                                   "AuthCacheDisablePostAuthorize is enabled";
@@ -835,7 +904,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
     }
 
     if (!this->websocket->is_connected() and
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::OfflineTxForUnknownIdEnabled)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::OfflineTxForUnknownIdEnabled)
             .value_or(false)) {
         EVLOG_info << "Offline authorization due to OfflineTxForUnknownIdEnabled being enabled";
         response.idTokenInfo.status = AuthorizationStatusEnum::Accepted;
@@ -844,7 +913,7 @@ AuthorizeResponse ChargePoint::validate_token(const IdToken id_token, const std:
 
     // When set to true this instructs the Charging Station to not issue any AuthorizationRequests, but only use
     // Authorization Cache and Local Authorization List to determine validity of idTokens.
-    if (!this->device_model->get_optional_value<bool>(ControllerComponentVariables::DisableRemoteAuthorization)
+    if (!this->device_model->get_optional_value(ControllerComponentVariableHandles::DisableRemoteAuthorization)
              .value_or(false)) {
         response = this->authorize_req(id_token, certificate, ocsp_request_data);
 
@@ -899,14 +968,14 @@ bool ChargePoint::send(CallError call_error) {
 
 void ChargePoint::init_websocket() {
 
-    if (this->device_model->get_value<std::string>(ControllerComponentVariables::ChargePointId).find(':') !=
+    if (this->device_model->get_value(ControllerComponentVariableHandles::ChargePointId).find(':') !=
         std::string::npos) {
         EVLOG_AND_THROW(std::runtime_error("ChargePointId must not contain \':\'"));
     }
 
     const auto configuration_slot =
         ocpp::get_vector_from_csv(
-            this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConfigurationPriority))
+            this->device_model->get_value(ControllerComponentVariableHandles::NetworkConfigurationPriority))
             .at(this->network_configuration_priority);
     const auto connection_options = this->get_ws_connection_options(std::stoi(configuration_slot));
     const auto network_connection_profile = this->get_network_connection_profile(std::stoi(configuration_slot));
@@ -960,8 +1029,8 @@ void ChargePoint::init_websocket() {
 
             // B04.FR.01
             // If offline period exceeds offline threshold then send the status notification for all connectors
-            if (offline_duration > std::chrono::seconds(this->device_model->get_value<int>(
-                                       ControllerComponentVariables::OfflineThreshold))) {
+            if (offline_duration > std::chrono::seconds(this->device_model->get_value(
+                                       ControllerComponentVariableHandles::OfflineThreshold))) {
                 EVLOG_debug << "offline for more than offline threshold ";
                 this->component_state_manager->send_status_notification_all_connectors();
             } else {
@@ -983,7 +1052,7 @@ void ChargePoint::init_websocket() {
         this->message_queue->pause();
 
         // check if offline threshold has been defined
-        if (this->device_model->get_value<int>(ControllerComponentVariables::OfflineThreshold) != 0) {
+        if (this->device_model->get_value(ControllerComponentVariableHandles::OfflineThreshold) != 0) {
             // Get the current time point using steady_clock
             this->time_disconnected = std::chrono::steady_clock::now();
         }
@@ -1033,10 +1102,11 @@ void ChargePoint::init_certificate_expiration_check_timers() {
 
     // Client Certificate only needs to be checked for SecurityProfile 3; if SecurityProfile changes, timers get
     // re-initialized at reconnect
-    if (this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile) == 3) {
+    if (this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile) == 3) {
         this->client_certificate_expiration_check_timer.timeout(std::chrono::seconds(
             this->device_model
-                ->get_optional_value<int>(ControllerComponentVariables::ClientCertificateExpireCheckInitialDelaySeconds)
+                ->get_optional_value(
+                    ControllerComponentVariableHandles::ClientCertificateExpireCheckInitialDelaySeconds)
                 .value_or(60)));
     }
 
@@ -1044,7 +1114,7 @@ void ChargePoint::init_certificate_expiration_check_timers() {
     // callback (ChargePoint::scheduled_check_v2g_certificate_expiration)
     this->v2g_certificate_expiration_check_timer.timeout(std::chrono::seconds(
         this->device_model
-            ->get_optional_value<int>(ControllerComponentVariables::V2GCertificateExpireCheckInitialDelaySeconds)
+            ->get_optional_value(ControllerComponentVariableHandles::V2GCertificateExpireCheckInitialDelaySeconds)
             .value_or(60)));
 }
 
@@ -1060,41 +1130,47 @@ WebsocketConnectionOptions ChargePoint::get_ws_connection_options(const int32_t
 
     auto uri = Uri::parse_and_validate(
         network_connection_profile.ocppCsmsUrl.get(),
-        this->device_model->get_value<std::string>(ControllerComponentVariables::SecurityCtrlrIdentity),
+        this->device_model->get_value(ControllerComponentVariableHandles::SecurityCtrlrIdentity),
         network_connection_profile.securityProfile);
 
     WebsocketConnectionOptions connection_options{
         OcppProtocolVersion::v201,
         uri,
         network_connection_profile.securityProfile,
-        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::BasicAuthPassword),
-        this->device_model->get_value<int>(ControllerComponentVariables::RetryBackOffRandomRange),
-        this->device_model->get_value<int>(ControllerComponentVariables::RetryBackOffRepeatTimes),
-        this->device_model->get_value<int>(ControllerComponentVariables::RetryBackOffWaitMinimum),
-        this->device_model->get_value<int>(ControllerComponentVariables::NetworkProfileConnectionAttempts),
-        this->device_model->get_value<std::string>(ControllerComponentVariables::SupportedCiphers12),
-        this->device_model->get_value<std::string>(ControllerComponentVariables::SupportedCiphers13),
-        this->device_model->get_value<int>(ControllerComponentVariables::WebSocketPingInterval),
-        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::WebsocketPingPayload)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::BasicAuthPassword),
+        this->device_model->get_value(ControllerComponentVariableHandles::RetryBackOffRandomRange),
+        this->device_model->get_value(ControllerComponentVariableHandles::RetryBackOffRepeatTimes),
+        this->device_model->get_value(ControllerComponentVariableHandles::RetryBackOffWaitMinimum),
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkProfileConnectionAttempts),
+        this->device_model->get_value(ControllerComponentVariableHandles::SupportedCiphers12),
+        this->device_model->get_value(ControllerComponentVariableHandles::SupportedCiphers13),
+        this->device_model->get_value(ControllerComponentVariableHandles::WebSocketPingInterval),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::WebsocketPingPayload)
             .value_or("payload"),
-        this->device_model->get_optional_value<int>(ControllerComponentVariables::WebsocketPongTimeout).value_or(5),
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::UseSslDefaultVerifyPaths)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::WebsocketPongTimeout).value_or(5),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::UseSslDefaultVerifyPaths)
             .value_or(true),
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::AdditionalRootCertificateCheck)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::AdditionalRootCertificateCheck)
             .value_or(false),
         std::nullopt, // hostName
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::VerifyCsmsCommonName).value_or(true),
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::UseTPM).value_or(false),
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::VerifyCsmsAllowWildcards)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::VerifyCsmsCommonName).value_or(true),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::UseTPM).value_or(false),
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::VerifyCsmsAllowWildcards)
             .value_or(false),
-        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::IFace)};
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::IFace)};
+    connection_options.compression.enabled =
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::WebsocketPerMessageDeflate)
+            .value_or(false);
+    connection_options.max_inbound_message_size = static_cast<size_t>(
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::MaxInboundMessageSize)
+            .value_or(static_cast<int>(DEFAULT_MAX_INBOUND_MESSAGE_SIZE)));
 
     return connection_options;
 }
 
 std::optional<NetworkConnectionProfile> ChargePoint::get_network_connection_profile(const int32_t configuration_slot) {
     std::vector<SetNetworkProfileRequest> network_connection_profiles = json::parse(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConnectionProfiles));
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkConnectionProfiles));
 
     for (const auto& network_profile : network_connection_profiles) {
         if (network_profile.configurationSlot == configuration_slot) {
@@ -1115,7 +1191,7 @@ std::optional<NetworkConnectionProfile> ChargePoint::get_network_connection_prof
 
 void ChargePoint::next_network_configuration_priority() {
     const auto network_connection_priorities = ocpp::get_vector_from_csv(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConfigurationPriority));
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkConfigurationPriority));
     if (network_connection_priorities.size() > 1) {
         EVLOG_info << "Switching to next network configuration priority";
     }
@@ -1125,10 +1201,10 @@ void ChargePoint::next_network_configuration_priority() {
 
 void ChargePoint::remove_network_connection_profiles_below_actual_security_profile() {
     // Remove all the profiles that are a lower security level than security_level
-    const auto security_level = this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile);
+    const auto security_level = this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile);
 
     auto network_connection_profiles = json::parse(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConnectionProfiles));
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkConnectionProfiles));
 
     auto is_lower_security_level = [security_level](const SetNetworkProfileRequest& item) {
         return item.connectionData.securityProfile < security_level;
@@ -1144,7 +1220,7 @@ void ChargePoint::remove_network_connection_profiles_below_actual_security_profi
 
     // Update the NetworkConfigurationPriority so only remaining profiles are in there
     const auto network_priority = ocpp::get_vector_from_csv(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConfigurationPriority));
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkConfigurationPriority));
 
     auto in_network_profiles = [&network_connection_profiles](const std::string& item) {
         auto is_same_slot = [&item](const SetNetworkProfileRequest& profile) {
@@ -1175,7 +1251,7 @@ void ChargePoint::handle_message(const EnhancedMessage<v201::MessageType>& messa
         this->handle_boot_notification_response(json_message);
         break;
     case MessageType::SetVariables:
-        this->handle_set_variables_req(json_message);
+        this->handle_set_variables_req(from_json_string<Call<SetVariablesRequest>>(message.raw_message));
         break;
     case MessageType::GetVariables:
         this->handle_get_variables_req(message);
@@ -1229,7 +1305,8 @@ void ChargePoint::handle_message(const EnhancedMessage<v201::MessageType>& messa
         this->handle_heartbeat_response(json_message);
         break;
     case MessageType::SendLocalList:
-        this->handle_send_local_authorization_list_req(json_message);
+        this->handle_send_local_authorization_list_req(
+            from_json_string<Call<SendLocalListRequest>>(message.raw_message));
         break;
     case MessageType::GetLocalListVersion:
         this->handle_get_local_authorization_list_version_req(json_message);
@@ -1264,9 +1341,19 @@ void ChargePoint::handle_message(const EnhancedMessage<v201::MessageType>& messa
 void ChargePoint::message_callback(const std::string& message) {
     auto enhanced_message = this->message_queue->receive(message);
     enhanced_message.message_size = message.size();
-    auto json_message = enhanced_message.message;
-    this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    const auto& json_message = enhanced_message.message;
+    this->logging->central_system(std::string(conversions::messagetype_to_string(enhanced_message.messageType)),
+                                  message);
     try {
+        if (enhanced_message.messageTypeId == MessageTypeId::CALL && !enhanced_message.validation_error.empty()) {
+            EVLOG_error << "Received an invalid " << enhanced_message.messageType << ": "
+                        << enhanced_message.validation_error;
+            const auto call_error =
+                CallError(enhanced_message.uniqueId, "FormationViolation", enhanced_message.validation_error, json({}));
+            this->send(call_error);
+            return;
+        }
+
         if (this->registration_status == RegistrationStatusEnum::Accepted) {
             this->handle_message(enhanced_message);
         } else if (this->registration_status == RegistrationStatusEnum::Pending) {
@@ -1298,7 +1385,7 @@ void ChargePoint::message_callback(const std::string& message) {
                 } else {
                     std::string const call_error_message =
                         "Received invalid MessageType: " +
-                        conversions::messagetype_to_string(enhanced_message.messageType) +
+                        std::string(conversions::messagetype_to_string(enhanced_message.messageType)) +
                         " from CSMS while in state Pending";
                     EVLOG_warning << call_error_message;
                     // B02.FR.09 send CALLERROR SecurityError
@@ -1332,18 +1419,20 @@ void ChargePoint::message_callback(const std::string& message) {
         }
     } catch (json::exception& e) {
         EVLOG_error << "JSON exception during handling of message: " << e.what();
-        if (json_message.is_array() && json_message.size() > MESSAGE_ID) {
-            auto call_error = CallError(MessageId(json_message.at(MESSAGE_ID).get<std::string>()), "FormationViolation",
-                                        e.what(), json({}));
+        if (!enhanced_message.raw_message.empty() || (json_message.is_array() && json_message.size() > MESSAGE_ID)) {
+            const auto unique_id = enhanced_message.raw_message.empty()
+                                       ? MessageId(json_message.at(MESSAGE_ID).get<std::string>())
+                                       : enhanced_message.uniqueId;
+            auto call_error = CallError(unique_id, "FormationViolation", e.what(), json({}));
             this->send(call_error);
         }
     }
 }
 
 MeterValue ChargePoint::get_latest_meter_value_filtered(const MeterValue& meter_value, ReadingContextEnum context,
-                                                        const RequiredComponentVariable& component_variable) {
+                                                        const ComponentVariableHandle<std::string>& measurands) {
     auto filtered_meter_value = utils::get_meter_value_with_measurands_applied(
-        meter_value, utils::get_measurands_vec(this->device_model->get_value<std::string>(component_variable)));
+        meter_value, utils::get_measurands_vec(this->device_model->get_value(measurands)));
     for (auto& sampled_value : filtered_meter_value.sampledValue) {
         sampled_value.context = context;
     }
@@ -1400,7 +1489,7 @@ void ChargePoint::update_id_token_cache_lifetime(IdTokenInfo& id_token_info) {
     // C10.FR.08
     // when CSMS does not set cacheExpiryDateTime and config variable for AuthCacheLifeTime is present use the
     // configured AuthCacheLifeTime
-    auto lifetime = this->device_model->get_optional_value<int>(ControllerComponentVariables::AuthCacheLifeTime);
+    auto lifetime = this->device_model->get_optional_value(ControllerComponentVariableHandles::AuthCacheLifeTime);
     if (!id_token_info.cacheExpiryDateTime.has_value() and lifetime.has_value()) {
         id_token_info.cacheExpiryDateTime = DateTime(date::utc_clock::now() + std::chrono::seconds(lifetime.value()));
     }
@@ -1489,7 +1578,7 @@ SendLocalListStatusEnum ChargePoint::apply_local_authorization_list(const SendLo
 
 void ChargePoint::update_aligned_data_interval() {
     auto interval =
-        std::chrono::seconds(this->device_model->get_value<int>(ControllerComponentVariables::AlignedDataInterval));
+        std::chrono::seconds(this->device_model->get_value(ControllerComponentVariableHandles::AlignedDataInterval));
     if (interval <= 0s) {
         this->aligned_meter_values_timer.stop();
         return;
@@ -1499,7 +1588,7 @@ void ChargePoint::update_aligned_data_interval() {
         [this, interval]() {
             // J01.FR.20 if AlignedDataSendDuringIdle is true and any transaction is active, don't send clock aligned
             // meter values
-            if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::AlignedDataSendDuringIdle)
+            if (this->device_model->get_optional_value(ControllerComponentVariableHandles::AlignedDataSendDuringIdle)
                     .value_or(false)) {
                 for (auto const& [evse_id, evse] : this->evses) {
                     if (evse->has_active_transaction()) {
@@ -1509,13 +1598,13 @@ void ChargePoint::update_aligned_data_interval() {
             }
 
             const bool align_timestamps =
-                this->device_model->get_optional_value<bool>(ControllerComponentVariables::RoundClockAlignedTimestamps)
+                this->device_model->get_optional_value(ControllerComponentVariableHandles::RoundClockAlignedTimestamps)
                     .value_or(false);
 
             // send evseID = 0 values
-            auto meter_value = get_latest_meter_value_filtered(this->aligned_data_evse0.retrieve_processed_values(),
-                                                               ReadingContextEnum::Sample_Clock,
-                                                               ControllerComponentVariables::AlignedDataMeasurands);
+            auto meter_value = get_latest_meter_value_filtered(
+                this->aligned_data_evse0.retrieve_processed_values(), ReadingContextEnum::Sample_Clock,
+                ControllerComponentVariableHandles::AlignedDataMeasurands);
 
             if (!meter_value.sampledValue.empty()) {
                 if (align_timestamps) {
@@ -1534,7 +1623,7 @@ void ChargePoint::update_aligned_data_interval() {
                 // according to the configuration
                 auto meter_value =
                     get_latest_meter_value_filtered(evse->get_idle_meter_value(), ReadingContextEnum::Sample_Clock,
-                                                    ControllerComponentVariables::AlignedDataMeasurands);
+                                                    ControllerComponentVariableHandles::AlignedDataMeasurands);
 
                 if (align_timestamps) {
                     meter_value.timestamp = utils::align_timestamp(DateTime{}, interval);
@@ -1623,6 +1712,34 @@ static bool component_variable_change_requires_websocket_option_update_without_r
 }
 
 void ChargePoint::handle_variable_changed(const SetVariableData& set_variable_data) {
+    std::set<VariableChangeEffect> effects;
+    this->collect_variable_change_effects(set_variable_data, effects);
+    this->apply_variable_change_effects(effects);
+}
+
+void ChargePoint::handle_variables_changed(const std::map<SetVariableData, SetVariableResult>& set_variable_results) {
+    // subsystems are only reconfigured once after all changes have been handled, e.g. timers are only restarted once
+    std::set<VariableChangeEffect> effects;
+
+    // iterate over set_variable_results
+    for (const auto& [set_variable_data, set_variable_result] : set_variable_results) {
+        if (set_variable_result.attributeStatus == SetVariableStatusEnum::Accepted) {
+            EVLOG_info << set_variable_data.component.name << ":" << set_variable_data.variable.name << " changed to "
+                       << set_variable_data.attributeValue.get();
+            // handles required behavior specified within OCPP2.0.1 (e.g. reconnect when BasicAuthPassword has changed)
+            this->collect_variable_change_effects(set_variable_data, effects);
+            // notifies libocpp user application that a variable has changed
+            if (this->callbacks.variable_changed_callback.has_value()) {
+                this->callbacks.variable_changed_callback.value()(set_variable_data);
+            }
+        }
+    }
+
+    this->apply_variable_change_effects(effects);
+}
+
+void ChargePoint::collect_variable_change_effects(const SetVariableData& set_variable_data,
+                                                  std::set<VariableChangeEffect>& effects) {
 
     ComponentVariable component_variable = {set_variable_data.component, std::nullopt, set_variable_data.variable};
 
@@ -1632,73 +1749,84 @@ void ChargePoint::handle_variable_changed(const SetVariableData& set_variable_da
     }
 
     if (component_variable == ControllerComponentVariables::BasicAuthPassword) {
-        if (this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile) < 3) {
+        if (this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile) < 3) {
             // TODO: A01.FR.11 log the change of BasicAuth in Security Log
             this->websocket->set_authorization_key(set_variable_data.attributeValue.get());
-            this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
+            effects.insert(VariableChangeEffect::ReconnectWebsocket);
         }
     }
     if (component_variable == ControllerComponentVariables::HeartbeatInterval and
         this->registration_status == RegistrationStatusEnum::Accepted) {
-        try {
-            this->heartbeat_timer.interval([this]() { this->heartbeat_req(); },
-                                           std::chrono::seconds(std::stoi(set_variable_data.attributeValue.get())));
-        } catch (const std::invalid_argument& e) {
-            EVLOG_error << "Invalid argument exception while updating the heartbeat interval: " << e.what();
-        } catch (const std::out_of_range& e) {
-            EVLOG_error << "Out of range exception while updating the heartbeat interval: " << e.what();
-        }
+        effects.insert(VariableChangeEffect::RestartHeartbeatTimer);
     }
     if (component_variable == ControllerComponentVariables::AlignedDataInterval) {
-        this->update_aligned_data_interval();
+        effects.insert(VariableChangeEffect::RestartAlignedDataTimer);
     }
 
     if (component_variable_change_requires_websocket_option_update_without_reconnect(component_variable)) {
-        EVLOG_debug << "Reconfigure websocket due to relevant change of ControllerComponentVariable";
-        const auto configuration_slot =
-            ocpp::get_vector_from_csv(
-                this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConfigurationPriority))
-                .at(this->network_configuration_priority);
-        const auto connection_options = this->get_ws_connection_options(std::stoi(configuration_slot));
-        this->websocket->set_connection_options(connection_options);
+        effects.insert(VariableChangeEffect::UpdateWebsocketOptions);
     }
 
     if (component_variable == ControllerComponentVariables::MessageAttemptInterval) {
-        if (component_variable.variable.has_value()) {
-            this->message_queue->update_transaction_message_retry_interval(
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval));
-        }
+        effects.insert(VariableChangeEffect::UpdateMessageAttemptInterval);
     }
 
     if (component_variable == ControllerComponentVariables::MessageAttempts) {
-        if (component_variable.variable.has_value()) {
-            this->message_queue->update_transaction_message_attempts(
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts));
-        }
+        effects.insert(VariableChangeEffect::UpdateMessageAttempts);
     }
 
     if (component_variable == ControllerComponentVariables::MessageTimeout) {
-        if (component_variable.variable.has_value()) {
-            this->message_queue->update_message_timeout(
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout));
-        }
+        effects.insert(VariableChangeEffect::UpdateMessageTimeout);
     }
 
     // TODO(piet): other special handling of changed variables can be added here...
 }
 
-void ChargePoint::handle_variables_changed(const std::map<SetVariableData, SetVariableResult>& set_variable_results) {
-    // iterate over set_variable_results
-    for (const auto& [set_variable_data, set_variable_result] : set_variable_results) {
-        if (set_variable_result.attributeStatus == SetVariableStatusEnum::Accepted) {
-            EVLOG_info << set_variable_data.component.name << ":" << set_variable_data.variable.name << " changed to "
-                       << set_variable_data.attributeValue.get();
-            // handles required behavior specified within OCPP2.0.1 (e.g. reconnect when BasicAuthPassword has changed)
-            this->handle_variable_changed(set_variable_data);
-            // notifies libocpp user application that a variable has changed
-            if (this->callbacks.variable_changed_callback.has_value()) {
-                this->callbacks.variable_changed_callback.value()(set_variable_data);
+void ChargePoint::apply_variable_change_effects(const std::set<VariableChangeEffect>& effects) {
+    for (const auto effect : effects) {
+        switch (effect) {
+        case VariableChangeEffect::RestartHeartbeatTimer:
+            try {
+                const auto heartbeat_interval =
+                    this->device_model->get_optional_value(ControllerComponentVariableHandles::HeartbeatInterval);
+                if (heartbeat_interval.has_value()) {
+                    this->heartbeat_timer.interval([this]() { this->heartbeat_req(); },
+                                                   std::chrono::seconds(heartbeat_interval.value()));
+                }
+            } catch (const std::invalid_argument& e) {
+                EVLOG_error << "Invalid argument exception while updating the heartbeat interval: " << e.what();
+            } catch (const std::out_of_range& e) {
+                EVLOG_error << "Out of range exception while updating the heartbeat interval: " << e.what();
             }
+            break;
+        case VariableChangeEffect::RestartAlignedDataTimer:
+            this->update_aligned_data_interval();
+            break;
+        case VariableChangeEffect::UpdateWebsocketOptions: {
+            EVLOG_debug << "Reconfigure websocket due to relevant change of ControllerComponentVariable";
+            const auto configuration_slot =
+                ocpp::get_vector_from_csv(
+                    this->device_model->get_value(ControllerComponentVariableHandles::NetworkConfigurationPriority))
+                    .at(this->network_configuration_priority);
+            const auto connection_options = this->get_ws_connection_options(std::stoi(configuration_slot));
+            this->websocket->set_connection_options(connection_options);
+            break;
+        }
+        case VariableChangeEffect::UpdateMessageAttemptInterval:
+            this->message_queue->update_transaction_message_retry_interval(
+                this->device_model->get_value(ControllerComponentVariableHandles::MessageAttemptInterval));
+            break;
+        case VariableChangeEffect::UpdateMessageAttempts:
+            this->message_queue->update_transaction_message_attempts(
+                this->device_model->get_value(ControllerComponentVariableHandles::MessageAttempts));
+            break;
+        case VariableChangeEffect::UpdateMessageTimeout:
+            this->message_queue->update_message_timeout(
+                this->device_model->get_value(ControllerComponentVariableHandles::MessageTimeout));
+            break;
+        case VariableChangeEffect::ReconnectWebsocket:
+            this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
+            break;
         }
     }
 }
@@ -1708,7 +1836,7 @@ bool ChargePoint::validate_set_variable(const SetVariableData& set_variable_data
     if (cv == ControllerComponentVariables::NetworkConfigurationPriority) {
         const auto network_configuration_priorities = ocpp::get_vector_from_csv(set_variable_data.attributeValue.get());
         const auto active_security_profile =
-            this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile);
+            this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile);
         for (const auto configuration_slot : network_configuration_priorities) {
             try {
                 auto network_profile_opt = this->get_network_connection_profile(std::stoi(configuration_slot));
@@ -1752,7 +1880,8 @@ ChargePoint::set_variables_internal(const std::vector<SetVariableData>& set_vari
                                     const bool allow_read_only) {
     std::map<SetVariableData, SetVariableResult> response;
 
-    // iterate over the set_variable_data_vector
+    // the variables that pass the business logic validation are set in the device model at once
+    std::vector<SetVariableData> valid_set_variable_data;
     for (const auto& set_variable_data : set_variable_data_vector) {
         SetVariableResult set_variable_result;
         set_variable_result.component = set_variable_data.component;
@@ -1761,17 +1890,19 @@ ChargePoint::set_variables_internal(const std::vector<SetVariableData>& set_vari
 
         // validates variable against business logic of the spec
         if (this->validate_set_variable(set_variable_data)) {
-            // attempt to set the value includes device model validation
-            set_variable_result.attributeStatus =
-                this->device_model->set_value(set_variable_data.component, set_variable_data.variable,
-                                              set_variable_data.attributeType.value_or(AttributeEnum::Actual),
-                                              set_variable_data.attributeValue.get(), allow_read_only);
+            valid_set_variable_data.push_back(set_variable_data);
         } else {
             set_variable_result.attributeStatus = SetVariableStatusEnum::Rejected;
         }
         response[set_variable_data] = set_variable_result;
     }
 
+    // attempt to set the values includes device model validation
+    const auto statuses = this->device_model->set_values(valid_set_variable_data, allow_read_only);
+    for (size_t i = 0; i < valid_set_variable_data.size(); i++) {
+        response[valid_set_variable_data.at(i)].attributeStatus = statuses.at(i);
+    }
+
     return response;
 }
 
@@ -1879,18 +2010,18 @@ void ChargePoint::sign_certificate_req(const ocpp::CertificateSigningUseEnum& ce
     if (certificate_signing_use == ocpp::CertificateSigningUseEnum::ChargingStationCertificate) {
         req.certificateType = ocpp::v201::CertificateSigningUseEnum::ChargingStationCertificate;
         common =
-            this->device_model->get_optional_value<std::string>(ControllerComponentVariables::ChargeBoxSerialNumber);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::ChargeBoxSerialNumber);
         organization =
-            this->device_model->get_optional_value<std::string>(ControllerComponentVariables::OrganizationName);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::OrganizationName);
         country =
-            this->device_model->get_optional_value<std::string>(ControllerComponentVariables::ISO15118CtrlrCountryName);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::ISO15118CtrlrCountryName);
     } else {
         req.certificateType = ocpp::v201::CertificateSigningUseEnum::V2GCertificate;
-        common = this->device_model->get_optional_value<std::string>(ControllerComponentVariables::ISO15118CtrlrSeccId);
-        organization = this->device_model->get_optional_value<std::string>(
-            ControllerComponentVariables::ISO15118CtrlrOrganizationName);
+        common = this->device_model->get_optional_value(ControllerComponentVariableHandles::ISO15118CtrlrSeccId);
+        organization = this->device_model->get_optional_value(
+            ControllerComponentVariableHandles::ISO15118CtrlrOrganizationName);
         country =
-            this->device_model->get_optional_value<std::string>(ControllerComponentVariables::ISO15118CtrlrCountryName);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::ISO15118CtrlrCountryName);
     }
 
     if (!common.has_value() or !country.has_value() or !organization.has_value()) {
@@ -1899,7 +2030,7 @@ void ChargePoint::sign_certificate_req(const ocpp::CertificateSigningUseEnum& ce
     }
 
     bool should_use_tpm =
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::UseTPM).value_or(false);
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::UseTPM).value_or(false);
 
     const auto result = this->evse_security->generate_certificate_signing_request(
         certificate_signing_use, country.value(), organization.value(), common.value(), should_use_tpm);
@@ -1928,13 +2059,13 @@ void ChargePoint::boot_notification_req(const BootReasonEnum& reason) {
     BootNotificationRequest req;
 
     ChargingStation charging_station;
-    charging_station.model = this->device_model->get_value<std::string>(ControllerComponentVariables::ChargePointModel);
+    charging_station.model = this->device_model->get_value(ControllerComponentVariableHandles::ChargePointModel);
     charging_station.vendorName =
-        this->device_model->get_value<std::string>(ControllerComponentVariables::ChargePointVendor);
+        this->device_model->get_value(ControllerComponentVariableHandles::ChargePointVendor);
     charging_station.firmwareVersion.emplace(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::FirmwareVersion));
+        this->device_model->get_value(ControllerComponentVariableHandles::FirmwareVersion));
     charging_station.serialNumber.emplace(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::ChargeBoxSerialNumber));
+        this->device_model->get_value(ControllerComponentVariableHandles::ChargeBoxSerialNumber));
 
     req.reason = reason;
     req.chargingStation = charging_station;
@@ -1943,28 +2074,18 @@ void ChargePoint::boot_notification_req(const BootReasonEnum& reason) {
     this->send<BootNotificationRequest>(call);
 }
 
-void ChargePoint::notify_report_req(const int request_id, const std::vector<ReportData>& report_data) {
-
+NotifyReportRequestsSplitter
+ChargePoint::create_notify_report_splitter(const int request_id,
+                                           NotifyReportRequestsSplitter::PayloadCallback&& payload_callback) {
     NotifyReportRequest req;
     req.requestId = request_id;
-    req.seqNo = 0;
     req.generatedAt = ocpp::DateTime();
-    req.reportData.emplace(report_data);
-    req.tbc = false;
 
-    if (report_data.size() <= 1) {
-        ocpp::Call<NotifyReportRequest> call(req, this->message_queue->createMessageId());
-        this->send<NotifyReportRequest>(call);
-    } else {
-        NotifyReportRequestsSplitter splitter{
-            req,
-            this->device_model->get_optional_value<size_t>(ControllerComponentVariables::MaxMessageSize)
-                .value_or(DEFAULT_MAX_MESSAGE_SIZE),
-            [this]() { return this->message_queue->createMessageId(); }};
-        for (const auto& msg : splitter.create_call_payloads()) {
-            this->message_queue->push(msg);
-        }
-    }
+    return NotifyReportRequestsSplitter{
+        req,
+        static_cast<size_t>(this->device_model->get_optional_value(ControllerComponentVariableHandles::MaxMessageSize)
+                                .value_or(DEFAULT_MAX_MESSAGE_SIZE)),
+        [this]() { return this->message_queue->createMessageId(); }, std::move(payload_callback)};
 }
 
 AuthorizeResponse ChargePoint::authorize_req(const IdToken id_token, const std::optional<CiString<5500>>& certificate,
@@ -2139,7 +2260,7 @@ void ChargePoint::handle_certificate_signed_req(Call<CertificateSignedRequest> c
 
     // Trigger a symlink update for V2G certificates
     if ((cert_signing_use == ocpp::CertificateSigningUseEnum::V2GCertificate) and
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::UpdateCertificateSymlinks)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::UpdateCertificateSymlinks)
             .value_or(false)) {
         this->evse_security->update_certificate_links(cert_signing_use);
     }
@@ -2156,7 +2277,7 @@ void ChargePoint::handle_certificate_signed_req(Call<CertificateSignedRequest> c
     // reconnect with new certificate if valid and security profile is 3
     if (response.status == CertificateSignedStatusEnum::Accepted and
         cert_signing_use == ocpp::CertificateSigningUseEnum::ChargingStationCertificate and
-        this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile) == 3) {
+        this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile) == 3) {
         this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
     }
 }
@@ -2171,9 +2292,9 @@ void ChargePoint::handle_sign_certificate_response(CallResult<SignCertificateRes
     if (call_result.msg.status == GenericStatusEnum::Accepted) {
         // set timer waiting for certificate signed
         const auto cert_signing_wait_minimum =
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::CertSigningWaitMinimum);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::CertSigningWaitMinimum);
         const auto cert_signing_repeat_times =
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::CertSigningRepeatTimes);
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::CertSigningRepeatTimes);
 
         if (!cert_signing_wait_minimum.has_value()) {
             EVLOG_warning << "No CertSigningWaitMinimum is configured, will not attempt to retry SignCertificate.req "
@@ -2228,7 +2349,7 @@ void ChargePoint::handle_boot_notification_response(CallResult<BootNotificationR
     if (this->registration_status == RegistrationStatusEnum::Accepted) {
         // B01.FR.06 Only use boot timestamp if TimeSource contains Heartbeat
         if (this->callbacks.time_sync_callback.has_value() &&
-            this->device_model->get_value<std::string>(ControllerComponentVariables::TimeSource).find("Heartbeat") !=
+            this->device_model->get_value(ControllerComponentVariableHandles::TimeSource).find("Heartbeat") !=
                 std::string::npos) {
             this->callbacks.time_sync_callback.value()(msg.currentTime);
         }
@@ -2284,13 +2405,13 @@ void ChargePoint::handle_set_variables_req(Call<SetVariablesRequest> call) {
 }
 
 void ChargePoint::handle_get_variables_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetVariablesRequest> call = message.call_message;
+    Call<GetVariablesRequest> call = message.message;
     const auto msg = call.msg;
 
     const auto max_variables_per_message =
-        this->device_model->get_value<int>(ControllerComponentVariables::ItemsPerMessageGetVariables);
+        this->device_model->get_value(ControllerComponentVariableHandles::ItemsPerMessageGetVariables);
     const auto max_bytes_per_message =
-        this->device_model->get_value<int>(ControllerComponentVariables::BytesPerMessageGetVariables);
+        this->device_model->get_value(ControllerComponentVariableHandles::BytesPerMessageGetVariables);
 
     // B06.FR.16
     if (msg.getVariableData.size() > max_variables_per_message) {
@@ -2328,21 +2449,27 @@ void ChargePoint::handle_get_base_report_req(Call<GetBaseReportRequest> call) {
     this->send<GetBaseReportResponse>(call_result);
 
     if (response.status == GenericDeviceModelStatusEnum::Accepted) {
-        const auto report_data = this->device_model->get_base_report_data(msg.reportBase);
-        this->notify_report_req(msg.requestId, report_data);
+        // every NotifyReport.req is queued as json text as soon as it is full, so the report is never held in memory
+        // as a whole
+        auto splitter = this->create_notify_report_splitter(
+            msg.requestId, [this](const MessageId& message_id, std::string&& payload) {
+                this->message_queue->push_serialized(MessageType::NotifyReport, message_id, std::move(payload));
+            });
+        this->device_model->for_each_base_report_data(
+            msg.reportBase, [&splitter](const ReportData& report_data) { splitter.add(report_data); });
+        splitter.finish();
     }
 }
 
 void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetReportRequest> call = message.call_message;
+    Call<GetReportRequest> call = message.message;
     const auto msg = call.msg;
-    std::vector<ReportData> report_data;
     GetReportResponse response;
 
     const auto max_items_per_message =
-        this->device_model->get_value<int>(ControllerComponentVariables::ItemsPerMessageGetReport);
+        this->device_model->get_value(ControllerComponentVariableHandles::ItemsPerMessageGetReport);
     const auto max_bytes_per_message =
-        this->device_model->get_value<int>(ControllerComponentVariables::BytesPerMessageGetReport);
+        this->device_model->get_value(ControllerComponentVariableHandles::BytesPerMessageGetReport);
 
     // B08.FR.17
     if (msg.componentVariable.has_value() and msg.componentVariable->size() > max_items_per_message) {
@@ -2362,7 +2489,7 @@ void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>
 
     // if a criteria is not supported then send a not supported response.
     auto sup_criteria =
-        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::SupportedCriteria);
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::SupportedCriteria);
     if (sup_criteria.has_value() and msg.componentCriteria.has_value()) {
         for (const auto& criteria : msg.componentCriteria.value()) {
             const auto variable_ = conversions::component_criterion_enum_to_string(criteria);
@@ -2375,15 +2502,25 @@ void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>
         }
     }
 
-    if (response.status != GenericDeviceModelStatusEnum::NotSupported) {
+    // the NotifyReport.req can only be queued after the response, which depends on the report being empty or not
+    std::vector<std::pair<MessageId, std::string>> notify_report_payloads;
 
-        // TODO(piet): Propably split this up into several NotifyReport.req depending on ItemsPerMessage /
-        // BytesPerMessage
-        report_data = this->device_model->get_custom_report_data(msg.componentVariable, msg.componentCriteria);
-        if (report_data.empty()) {
+    if (response.status != GenericDeviceModelStatusEnum::NotSupported) {
+        auto splitter = this->create_notify_report_splitter(
+            msg.requestId, [&notify_report_payloads](const MessageId& message_id, std::string&& payload) {
+                notify_report_payloads.emplace_back(message_id, std::move(payload));
+            });
+        size_t report_data_count = 0;
+        this->device_model->for_each_custom_report_data(msg.componentVariable, msg.componentCriteria,
+                                                        [&splitter, &report_data_count](const ReportData& report_data) {
+                                                            splitter.add(report_data);
+                                                            report_data_count++;
+                                                        });
+        if (report_data_count == 0) {
             response.status = GenericDeviceModelStatusEnum::EmptyResultSet;
         } else {
             response.status = GenericDeviceModelStatusEnum::Accepted;
+            splitter.finish();
         }
     }
 
@@ -2391,7 +2528,9 @@ void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>
     this->send<GetReportResponse>(call_result);
 
     if (response.status == GenericDeviceModelStatusEnum::Accepted) {
-        this->notify_report_req(msg.requestId, report_data);
+        for (auto& [message_id, payload] : notify_report_payloads) {
+            this->message_queue->push_serialized(MessageType::NotifyReport, message_id, std::move(payload));
+        }
     }
 }
 
@@ -2409,7 +2548,7 @@ void ChargePoint::handle_set_network_profile_req(Call<SetNetworkProfileRequest>
     }
 
     if (msg.connectionData.securityProfile <
-        this->device_model->get_value<int>(ControllerComponentVariables::SecurityProfile)) {
+        this->device_model->get_value(ControllerComponentVariableHandles::SecurityProfile)) {
         EVLOG_warning << "CSMS attempted to set a network profile with a lower securityProfile";
         response.status = SetNetworkProfileStatusEnum::Rejected;
         ocpp::CallResult<SetNetworkProfileResponse> call_result(response, call.uniqueId);
@@ -2427,7 +2566,7 @@ void ChargePoint::handle_set_network_profile_req(Call<SetNetworkProfileRequest>
     }
 
     auto network_connection_profiles = json::parse(
-        this->device_model->get_value<std::string>(ControllerComponentVariables::NetworkConnectionProfiles));
+        this->device_model->get_value(ControllerComponentVariableHandles::NetworkConnectionProfiles));
 
     int index_to_override = -1;
     int index = 0;
@@ -2545,7 +2684,7 @@ void ChargePoint::handle_clear_cache_req(Call<ClearCacheRequest> call) {
     ClearCacheResponse response;
     response.status = ClearCacheStatusEnum::Rejected;
 
-    if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::AuthCacheCtrlrEnabled)
+    if (this->device_model->get_optional_value(ControllerComponentVariableHandles::AuthCacheCtrlrEnabled)
             .value_or(true)) {
         try {
             this->database_handler->authorization_cache_clear();
@@ -2595,7 +2734,7 @@ void ChargePoint::handle_transaction_event_response(const EnhancedMessage<v201::
     // C03.FR.0x and C05.FR.01: We SHALL NOT store central information in the Authorization Cache
     // C10.FR.05
     if (id_token.type != IdTokenEnum::Central and
-        this->device_model->get_optional_value<bool>(ControllerComponentVariables::AuthCacheCtrlrEnabled)
+        this->device_model->get_optional_value(ControllerComponentVariableHandles::AuthCacheCtrlrEnabled)
             .value_or(true)) {
         auto id_token_info = msg.idTokenInfo.value();
         this->update_id_token_cache_lifetime(id_token_info);
@@ -2630,10 +2769,10 @@ void ChargePoint::handle_transaction_event_response(const EnhancedMessage<v201::
 
     // post handling of transactions in case status is not Accepted
     for (const auto evse_id : evse_ids) {
-        if (this->device_model->get_value<bool>(ControllerComponentVariables::StopTxOnInvalidId)) {
+        if (this->device_model->get_value(ControllerComponentVariableHandles::StopTxOnInvalidId)) {
             this->callbacks.stop_transaction_callback(evse_id, ReasonEnum::DeAuthorized);
         } else {
-            if (this->device_model->get_optional_value<int32_t>(ControllerComponentVariables::MaxEnergyOnInvalidId)
+            if (this->device_model->get_optional_value(ControllerComponentVariableHandles::MaxEnergyOnInvalidId)
                     .has_value()) {
                 // Energy delivery to the EV SHALL be allowed until the amount of energy specified in
                 // MaxEnergyOnInvalidId has been reached.
@@ -2709,13 +2848,13 @@ void ChargePoint::handle_trigger_message(Call<TriggerMessageRequest> call) {
         if (msg.evse.has_value()) {
             if (evse_ptr != nullptr and
                 utils::meter_value_has_any_measurand(
-                    evse_ptr->get_meter_value(), utils::get_measurands_vec(this->device_model->get_value<std::string>(
-                                                     ControllerComponentVariables::AlignedDataMeasurands)))) {
+                    evse_ptr->get_meter_value(), utils::get_measurands_vec(this->device_model->get_value(
+                                                     ControllerComponentVariableHandles::AlignedDataMeasurands)))) {
                 response.status = TriggerMessageStatusEnum::Accepted;
             }
         } else {
             const auto measurands = utils::get_measurands_vec(
-                this->device_model->get_value<std::string>(ControllerComponentVariables::AlignedDataMeasurands));
+                this->device_model->get_value(ControllerComponentVariableHandles::AlignedDataMeasurands));
             for (auto const& [evse_id, evse] : this->evses) {
                 if (utils::meter_value_has_any_measurand(evse->get_meter_value(), measurands)) {
                     response.status = TriggerMessageStatusEnum::Accepted;
@@ -2756,7 +2895,7 @@ void ChargePoint::handle_trigger_message(Call<TriggerMessageRequest> call) {
         break;
     case MessageTriggerEnum::SignV2GCertificate:
         if (this->device_model
-                ->get_optional_value<bool>(ControllerComponentVariables::V2GCertificateInstallationEnabled)
+                ->get_optional_value(ControllerComponentVariableHandles::V2GCertificateInstallationEnabled)
                 .value_or(false)) {
             response.status = TriggerMessageStatusEnum::Accepted;
         } else {
@@ -2801,7 +2940,7 @@ void ChargePoint::handle_trigger_message(Call<TriggerMessageRequest> call) {
         auto send_meter_value = [&](int32_t evse_id, EvseInterface& evse) {
             const auto meter_value =
                 get_latest_meter_value_filtered(evse.get_meter_value(), ReadingContextEnum::Trigger,
-                                                ControllerComponentVariables::AlignedDataMeasurands);
+                                                ControllerComponentVariableHandles::AlignedDataMeasurands);
 
             if (!meter_value.sampledValue.empty()) {
                 this->meter_values_req(evse_id, std::vector<ocpp::v201::MeterValue>(1, meter_value));
@@ -2818,7 +2957,7 @@ void ChargePoint::handle_trigger_message(Call<TriggerMessageRequest> call) {
 
             const auto meter_value =
                 get_latest_meter_value_filtered(evse.get_meter_value(), ReadingContextEnum::Trigger,
-                                                ControllerComponentVariables::SampledDataTxUpdatedMeasurands);
+                                                ControllerComponentVariableHandles::SampledDataTxUpdatedMeasurands);
 
             std::optional<std::vector<MeterValue>> opt_meter_value;
             if (!meter_value.sampledValue.empty()) {
@@ -2947,7 +3086,7 @@ void ChargePoint::handle_remote_start_transaction_request(Call<RequestStartTrans
     if (response.status == RequestStartStopStatusEnum::Accepted) {
         // F01.FR.01 and F01.FR.02
         this->callbacks.remote_start_transaction_callback(
-            msg, this->device_model->get_value<bool>(ControllerComponentVariables::AuthorizeRemoteStart));
+            msg, this->device_model->get_value(ControllerComponentVariableHandles::AuthorizeRemoteStart));
     }
 }
 
@@ -3048,7 +3187,7 @@ void ChargePoint::handle_change_availability_req(Call<ChangeAvailabilityRequest>
 
 void ChargePoint::handle_heartbeat_response(CallResult<HeartbeatResponse> call) {
     if (this->callbacks.time_sync_callback.has_value() &&
-        this->device_model->get_value<std::string>(ControllerComponentVariables::TimeSource).find("Heartbeat") !=
+        this->device_model->get_value(ControllerComponentVariableHandles::TimeSource).find("Heartbeat") !=
             std::string::npos) {
         // the received currentTime was the time the CSMS received the heartbeat request
         // to get a system time as accurate as possible keep the time-of-flight into account
@@ -3185,7 +3324,7 @@ void ChargePoint::handle_customer_information_req(Call<CustomerInformationReques
         }
 
         const auto max_customer_information_data_length =
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::MaxCustomerInformationDataLength)
+            this->device_model->get_optional_value(ControllerComponentVariableHandles::MaxCustomerInformationDataLength)
                 .value_or(DEFAULT_MAX_CUSTOMER_INFORMATION_DATA_LENGTH);
         if (data.length() > max_customer_information_data_length) {
             EVLOG_warning << "NotifyCustomerInformation.req data field is too large. Cropping it down to: "
@@ -3243,7 +3382,7 @@ DataTransferResponse ChargePoint::data_transfer_req(const DataTransferRequest& r
 void ChargePoint::handle_send_local_authorization_list_req(Call<SendLocalListRequest> call) {
     SendLocalListResponse response;
 
-    if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::LocalAuthListCtrlrEnabled)
+    if (this->device_model->get_optional_value(ControllerComponentVariableHandles::LocalAuthListCtrlrEnabled)
             .value_or(false)) {
         response.status = apply_local_authorization_list(call.msg);
     } else {
@@ -3279,7 +3418,7 @@ void ChargePoint::handle_send_local_authorization_list_req(Call<SendLocalListReq
 void ChargePoint::handle_get_local_authorization_list_version_req(Call<GetLocalListVersionRequest> call) {
     GetLocalListVersionResponse response;
 
-    if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::LocalAuthListCtrlrEnabled)
+    if (this->device_model->get_optional_value(ControllerComponentVariableHandles::LocalAuthListCtrlrEnabled)
             .value_or(false)) {
         try {
             response.versionNumber = this->database_handler->get_local_authorization_list_version();
@@ -3312,12 +3451,12 @@ void ChargePoint::scheduled_check_client_certificate_expiration() {
 
     this->client_certificate_expiration_check_timer.interval(std::chrono::seconds(
         this->device_model
-            ->get_optional_value<int>(ControllerComponentVariables::ClientCertificateExpireCheckIntervalSeconds)
+            ->get_optional_value(ControllerComponentVariableHandles::ClientCertificateExpireCheckIntervalSeconds)
             .value_or(12 * 60 * 60)));
 }
 
 void ChargePoint::scheduled_check_v2g_certificate_expiration() {
-    if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::V2GCertificateInstallationEnabled)
+    if (this->device_model->get_optional_value(ControllerComponentVariableHandles::V2GCertificateInstallationEnabled)
             .value_or(false)) {
         EVLOG_info << "Checking if V2GCertificate has expired";
         int expiry_days_count =
@@ -3330,7 +3469,7 @@ void ChargePoint::scheduled_check_v2g_certificate_expiration() {
             EVLOG_info << "V2GCertificate is still valid.";
         }
     } else {
-        if (this->device_model->get_optional_value<bool>(ControllerComponentVariables::PnCEnabled).value_or(false)) {
+        if (this->device_model->get_optional_value(ControllerComponentVariableHandles::PnCEnabled).value_or(false)) {
             EVLOG_warning << "PnC is enabled but V2G certificate installation is not, so no certificate expiration "
                              "check is performed.";
         }
@@ -3338,7 +3477,7 @@ void ChargePoint::scheduled_check_v2g_certificate_expiration() {
 
     this->v2g_certificate_expiration_check_timer.interval(std::chrono::seconds(
         this->device_model
-            ->get_optional_value<int>(ControllerComponentVariables::V2GCertificateExpireCheckIntervalSeconds)
+            ->get_optional_value(ControllerComponentVariableHandles::V2GCertificateExpireCheckIntervalSeconds)
             .value_or(12 * 60 * 60)));
 }
 
@@ -3351,12 +3490,12 @@ void ChargePoint::update_dm_availability_state(const int32_t evse_id, const int3
     if (evse_cv.variable.has_value()) {
         this->device_model->set_read_only_value(evse_cv.component, evse_cv.variable.value(),
                                                 ocpp::v201::AttributeEnum::Actual,
-                                                conversions::connector_status_enum_to_string(status));
+                                                std::string(conversions::connector_status_enum_to_string(status)));
     }
     if (connector_cv.variable.has_value()) {
         this->device_model->set_read_only_value(connector_cv.component, connector_cv.variable.value(),
                                                 ocpp::v201::AttributeEnum::Actual,
-                                                conversions::connector_status_enum_to_string(status));
+                                                std::string(conversions::connector_status_enum_to_string(status)));
     }
 }
 
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 -  Pionix GmbH and Contributors to EVerest
 
+#include <array>
+
 #include <ocpp/v201/ctrlr_component_variables.hpp>
 
 namespace ocpp {
@@ -163,6 +165,13 @@ const ComponentVariable& RoundClockAlignedTimestamps = {
         "RoundClockAlignedTimestamps",
     }),
 };
+const ComponentVariable& DeviceModelFlushInterval = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "DeviceModelFlushInterval",
+    }),
+};
 const ComponentVariable& SupportedChargingProfilePurposeTypes = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -219,6 +228,20 @@ const ComponentVariable& IFace = {
         "IFace",
     }),
 };
+const ComponentVariable& WebsocketPerMessageDeflate = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketPerMessageDeflate",
+    }),
+};
+const ComponentVariable& MaxInboundMessageSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MaxInboundMessageSize",
+    }),
+};
 const ComponentVariable& OcspRequestInterval = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -282,6 +305,20 @@ const ComponentVariable& MessageQueueSizeThreshold = {
         "MessageQueueSizeThreshold",
     }),
 };
+const ComponentVariable& TransactionQueueCommitInterval = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TransactionQueueCommitInterval",
+    }),
+};
+const ComponentVariable& StrictMessageValidation = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "StrictMessageValidation",
+    }),
+};
 const ComponentVariable& MaxMessageSize = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -289,6 +326,27 @@ const ComponentVariable& MaxMessageSize = {
         "MaxMessageSize",
     }),
 };
+const ComponentVariable& NotifyEventCoalescingInterval = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "NotifyEventCoalescingInterval",
+    }),
+};
+const ComponentVariable& TransactionUpdateCompactionItemsPerMessage = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TransactionUpdateCompactionItemsPerMessage",
+    }),
+};
+const ComponentVariable& TransactionUpdateCompactionBytesPerMessage = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TransactionUpdateCompactionBytesPerMessage",
+    }),
+};
 const ComponentVariable& AlignedDataCtrlrEnabled = {
     ControllerComponents::AlignedDataCtrlr,
     std::nullopt,
@@ -1176,6 +1234,193 @@ const RequiredComponentVariable& TxStopPoint = {
 
 } // namespace ControllerComponentVariables
 
+namespace ControllerComponentVariableHandles {
+
+const ComponentVariable& get_component_variable(const size_t index) {
+    static const std::array<const ComponentVariable*, COUNT> component_variables = {
+        &ControllerComponentVariables::InternalCtrlrEnabled,
+        &ControllerComponentVariables::ChargePointId,
+        &ControllerComponentVariables::NetworkConnectionProfiles,
+        &ControllerComponentVariables::ChargeBoxSerialNumber,
+        &ControllerComponentVariables::ChargePointModel,
+        &ControllerComponentVariables::ChargePointSerialNumber,
+        &ControllerComponentVariables::ChargePointVendor,
+        &ControllerComponentVariables::FirmwareVersion,
+        &ControllerComponentVariables::ICCID,
+        &ControllerComponentVariables::IMSI,
+        &ControllerComponentVariables::MeterSerialNumber,
+        &ControllerComponentVariables::MeterType,
+        &ControllerComponentVariables::SupportedCiphers12,
+        &ControllerComponentVariables::SupportedCiphers13,
+        &ControllerComponentVariables::AuthorizeConnectorZeroOnConnectorOne,
+        &ControllerComponentVariables::LogMessages,
+        &ControllerComponentVariables::LogMessagesFormat,
+        &ControllerComponentVariables::SupportedChargingProfilePurposeTypes,
+        &ControllerComponentVariables::SupportedCriteria,
+        &ControllerComponentVariables::RoundClockAlignedTimestamps,
+        &ControllerComponentVariables::DeviceModelFlushInterval,
+        &ControllerComponentVariables::MaxCompositeScheduleDuration,
+        &ControllerComponentVariables::NumberOfConnectors,
+        &ControllerComponentVariables::UseSslDefaultVerifyPaths,
+        &ControllerComponentVariables::VerifyCsmsCommonName,
+        &ControllerComponentVariables::UseTPM,
+        &ControllerComponentVariables::VerifyCsmsAllowWildcards,
+        &ControllerComponentVariables::IFace,
+        &ControllerComponentVariables::WebsocketPerMessageDeflate,
+        &ControllerComponentVariables::MaxInboundMessageSize,
+        &ControllerComponentVariables::OcspRequestInterval,
+        &ControllerComponentVariables::WebsocketPingPayload,
+        &ControllerComponentVariables::WebsocketPongTimeout,
+        &ControllerComponentVariables::MaxCustomerInformationDataLength,
+        &ControllerComponentVariables::V2GCertificateExpireCheckInitialDelaySeconds,
+        &ControllerComponentVariables::V2GCertificateExpireCheckIntervalSeconds,
+        &ControllerComponentVariables::ClientCertificateExpireCheckInitialDelaySeconds,
+        &ControllerComponentVariables::ClientCertificateExpireCheckIntervalSeconds,
+        &ControllerComponentVariables::MessageQueueSizeThreshold,
+        &ControllerComponentVariables::TransactionQueueCommitInterval,
+        &ControllerComponentVariables::StrictMessageValidation,
+        &ControllerComponentVariables::MaxMessageSize,
+        &ControllerComponentVariables::NotifyEventCoalescingInterval,
+        &ControllerComponentVariables::TransactionUpdateCompactionItemsPerMessage,
+        &ControllerComponentVariables::TransactionUpdateCompactionBytesPerMessage,
+        &ControllerComponentVariables::AlignedDataCtrlrEnabled,
+        &ControllerComponentVariables::AlignedDataCtrlrAvailable,
+        &ControllerComponentVariables::AlignedDataInterval,
+        &ControllerComponentVariables::AlignedDataMeasurands,
+        &ControllerComponentVariables::AlignedDataSendDuringIdle,
+        &ControllerComponentVariables::AlignedDataSignReadings,
+        &ControllerComponentVariables::AlignedDataTxEndedInterval,
+        &ControllerComponentVariables::AlignedDataTxEndedMeasurands,
+        &ControllerComponentVariables::AuthCacheCtrlrAvailable,
+        &ControllerComponentVariables::AuthCacheCtrlrEnabled,
+        &ControllerComponentVariables::AuthCacheDisablePostAuthorize,
+        &ControllerComponentVariables::AuthCacheLifeTime,
+        &ControllerComponentVariables::AuthCachePolicy,
+        &ControllerComponentVariables::AuthCacheStorage,
+        &ControllerComponentVariables::AuthCtrlrEnabled,
+        &ControllerComponentVariables::AdditionalInfoItemsPerMessage,
+        &ControllerComponentVariables::AuthorizeRemoteStart,
+        &ControllerComponentVariables::LocalAuthorizeOffline,
+        &ControllerComponentVariables::LocalPreAuthorize,
+        &ControllerComponentVariables::DisableRemoteAuthorization,
+        &ControllerComponentVariables::MasterPassGroupId,
+        &ControllerComponentVariables::OfflineTxForUnknownIdEnabled,
+        &ControllerComponentVariables::AllowNewSessionsPendingFirmwareUpdate,
+        &ControllerComponentVariables::ChargingStationAvailabilityState,
+        &ControllerComponentVariables::ChargingStationAvailable,
+        &ControllerComponentVariables::ChargingStationSupplyPhases,
+        &ControllerComponentVariables::ClockCtrlrDateTime,
+        &ControllerComponentVariables::NextTimeOffsetTransitionDateTime,
+        &ControllerComponentVariables::NtpServerUri,
+        &ControllerComponentVariables::NtpSource,
+        &ControllerComponentVariables::TimeAdjustmentReportingThreshold,
+        &ControllerComponentVariables::TimeOffset,
+        &ControllerComponentVariables::TimeOffsetNextTransition,
+        &ControllerComponentVariables::TimeSource,
+        &ControllerComponentVariables::TimeZone,
+        &ControllerComponentVariables::CustomImplementationEnabled,
+        &ControllerComponentVariables::BytesPerMessageGetReport,
+        &ControllerComponentVariables::BytesPerMessageGetVariables,
+        &ControllerComponentVariables::BytesPerMessageSetVariables,
+        &ControllerComponentVariables::ConfigurationValueSize,
+        &ControllerComponentVariables::ItemsPerMessageGetReport,
+        &ControllerComponentVariables::ItemsPerMessageGetVariables,
+        &ControllerComponentVariables::ItemsPerMessageSetVariables,
+        &ControllerComponentVariables::ReportingValueSize,
+        &ControllerComponentVariables::DisplayMessageCtrlrAvailable,
+        &ControllerComponentVariables::NumberOfDisplayMessages,
+        &ControllerComponentVariables::DisplayMessageSupportedFormats,
+        &ControllerComponentVariables::DisplayMessageSupportedPriorities,
+        &ControllerComponentVariables::CentralContractValidationAllowed,
+        &ControllerComponentVariables::ContractValidationOffline,
+        &ControllerComponentVariables::RequestMeteringReceipt,
+        &ControllerComponentVariables::ISO15118CtrlrSeccId,
+        &ControllerComponentVariables::ISO15118CtrlrCountryName,
+        &ControllerComponentVariables::ISO15118CtrlrOrganizationName,
+        &ControllerComponentVariables::PnCEnabled,
+        &ControllerComponentVariables::V2GCertificateInstallationEnabled,
+        &ControllerComponentVariables::ContractCertificateInstallationEnabled,
+        &ControllerComponentVariables::LocalAuthListCtrlrAvailable,
+        &ControllerComponentVariables::BytesPerMessageSendLocalList,
+        &ControllerComponentVariables::LocalAuthListCtrlrEnabled,
+        &ControllerComponentVariables::LocalAuthListCtrlrEntries,
+        &ControllerComponentVariables::ItemsPerMessageSendLocalList,
+        &ControllerComponentVariables::LocalAuthListCtrlrStorage,
+        &ControllerComponentVariables::MonitoringCtrlrAvailable,
+        &ControllerComponentVariables::BytesPerMessageClearVariableMonitoring,
+        &ControllerComponentVariables::BytesPerMessageSetVariableMonitoring,
+        &ControllerComponentVariables::MonitoringCtrlrEnabled,
+        &ControllerComponentVariables::ItemsPerMessageClearVariableMonitoring,
+        &ControllerComponentVariables::ItemsPerMessageSetVariableMonitoring,
+        &ControllerComponentVariables::OfflineQueuingSeverity,
+        &ControllerComponentVariables::ActiveNetworkProfile,
+        &ControllerComponentVariables::FileTransferProtocols,
+        &ControllerComponentVariables::HeartbeatInterval,
+        &ControllerComponentVariables::MessageTimeout,
+        &ControllerComponentVariables::MessageAttemptInterval,
+        &ControllerComponentVariables::MessageAttempts,
+        &ControllerComponentVariables::NetworkConfigurationPriority,
+        &ControllerComponentVariables::NetworkProfileConnectionAttempts,
+        &ControllerComponentVariables::OfflineThreshold,
+        &ControllerComponentVariables::QueueAllMessages,
+        &ControllerComponentVariables::ResetRetries,
+        &ControllerComponentVariables::RetryBackOffRandomRange,
+        &ControllerComponentVariables::RetryBackOffRepeatTimes,
+        &ControllerComponentVariables::RetryBackOffWaitMinimum,
+        &ControllerComponentVariables::UnlockOnEVSideDisconnect,
+        &ControllerComponentVariables::WebSocketPingInterval,
+        &ControllerComponentVariables::ReservationCtrlrAvailable,
+        &ControllerComponentVariables::ReservationCtrlrEnabled,
+        &ControllerComponentVariables::ReservationCtrlrNonEvseSpecific,
+        &ControllerComponentVariables::SampledDataCtrlrAvailable,
+        &ControllerComponentVariables::SampledDataCtrlrEnabled,
+        &ControllerComponentVariables::SampledDataSignReadings,
+        &ControllerComponentVariables::SampledDataTxEndedInterval,
+        &ControllerComponentVariables::SampledDataTxEndedMeasurands,
+        &ControllerComponentVariables::SampledDataTxStartedMeasurands,
+        &ControllerComponentVariables::SampledDataTxUpdatedInterval,
+        &ControllerComponentVariables::SampledDataTxUpdatedMeasurands,
+        &ControllerComponentVariables::AdditionalRootCertificateCheck,
+        &ControllerComponentVariables::BasicAuthPassword,
+        &ControllerComponentVariables::CertificateEntries,
+        &ControllerComponentVariables::CertSigningRepeatTimes,
+        &ControllerComponentVariables::CertSigningWaitMinimum,
+        &ControllerComponentVariables::SecurityCtrlrIdentity,
+        &ControllerComponentVariables::MaxCertificateChainSize,
+        &ControllerComponentVariables::UpdateCertificateSymlinks,
+        &ControllerComponentVariables::OrganizationName,
+        &ControllerComponentVariables::SecurityProfile,
+        &ControllerComponentVariables::ACPhaseSwitchingSupported,
+        &ControllerComponentVariables::SmartChargingCtrlrAvailable,
+        &ControllerComponentVariables::SmartChargingCtrlrAvailableEnabled,
+        &ControllerComponentVariables::EntriesChargingProfiles,
+        &ControllerComponentVariables::ExternalControlSignalsEnabled,
+        &ControllerComponentVariables::LimitChangeSignificance,
+        &ControllerComponentVariables::NotifyChargingLimitWithSchedules,
+        &ControllerComponentVariables::PeriodsPerSchedule,
+        &ControllerComponentVariables::Phases3to1,
+        &ControllerComponentVariables::ChargingProfileMaxStackLevel,
+        &ControllerComponentVariables::ChargingScheduleChargingRateUnit,
+        &ControllerComponentVariables::TariffCostCtrlrAvailableTariff,
+        &ControllerComponentVariables::TariffCostCtrlrAvailableCost,
+        &ControllerComponentVariables::TariffCostCtrlrCurrency,
+        &ControllerComponentVariables::TariffCostCtrlrEnabledTariff,
+        &ControllerComponentVariables::TariffCostCtrlrEnabledCost,
+        &ControllerComponentVariables::TariffFallbackMessage,
+        &ControllerComponentVariables::TotalCostFallbackMessage,
+        &ControllerComponentVariables::EVConnectionTimeOut,
+        &ControllerComponentVariables::MaxEnergyOnInvalidId,
+        &ControllerComponentVariables::StopTxOnEVSideDisconnect,
+        &ControllerComponentVariables::StopTxOnInvalidId,
+        &ControllerComponentVariables::TxBeforeAcceptedEnabled,
+        &ControllerComponentVariables::TxStartPoint,
+        &ControllerComponentVariables::TxStopPoint,
+    };
+    return *component_variables.at(index);
+}
+
+} // namespace ControllerComponentVariableHandles
+
 namespace EvseComponentVariables {
 
 const Variable& Available = {"Available"};
@@ -13,8 +13,10 @@ using namespace common;
 namespace v201 {
 
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
-                                 const fs::path& sql_migration_files_path) :
-    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V201) {
+                                 const fs::path& sql_migration_files_path,
+                                 std::unique_ptr<DatabaseConnectionInterface> transaction_queue_database) :
+    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V201,
+                          std::move(transaction_queue_database)) {
 }
 
 void DatabaseHandler::init_sql() {
@@ -75,8 +77,8 @@ void DatabaseHandler::init_enum_table_inner(const std::string& table_name, const
 
 template <typename T>
 void DatabaseHandler::init_enum_table(const std::string& table_name, T begin, T end,
-                                      std::function<std::string(T)> conversion) {
-    auto conversion_func = [conversion](int value) { return conversion(static_cast<T>(value)); };
+                                      std::function<std::string_view(T)> conversion) {
+    auto conversion_func = [conversion](int value) { return std::string(conversion(static_cast<T>(value))); };
     init_enum_table_inner(table_name, static_cast<int>(begin), static_cast<int>(end), conversion_func);
 }
 
@@ -159,7 +161,8 @@ void DatabaseHandler::insert_availability(int32_t evse_id, int32_t connector_id,
     insert_stmt->bind_int("@evse_id", evse_id);
     insert_stmt->bind_int("@connector_id", connector_id);
 
-    insert_stmt->bind_text("@operational_status", conversions::operational_status_enum_to_string(operational_status),
+    insert_stmt->bind_text("@operational_status",
+                           std::string(conversions::operational_status_enum_to_string(operational_status)),
                            SQLiteString::Transient);
 
     if (insert_stmt->step() != SQLITE_DONE) {
@@ -10,6 +10,30 @@ namespace ocpp {
 
 namespace v201 {
 
+/// \brief Mixes the hash of \p value into \p seed
+template <typename T> static void combine_hash(size_t& seed, const T& value) {
+    seed ^= std::hash<T>{}(value) + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+}
+
+size_t VariableAttributeKeyHash::operator()(const VariableAttributeKey& key) const noexcept {
+    const auto& [component, variable, attribute_enum] = key;
+    size_t seed = 0;
+    combine_hash(seed, component.name);
+    if (component.instance.has_value()) {
+        combine_hash(seed, component.instance.value());
+    }
+    if (component.evse.has_value()) {
+        combine_hash(seed, component.evse->id);
+        combine_hash(seed, component.evse->connectorId.value_or(-1));
+    }
+    combine_hash(seed, variable.name);
+    if (variable.instance.has_value()) {
+        combine_hash(seed, variable.instance.value());
+    }
+    combine_hash(seed, static_cast<int>(attribute_enum));
+    return seed;
+}
+
 /// \brief For AlignedDataInterval, SampledDataTxUpdatedInterval and SampledDataTxEndedInterval, zero is allowed
 static bool allow_zero(const Component& component, const Variable& variable) {
     ComponentVariable component_variable = {component, std::nullopt, variable};
@@ -30,13 +54,26 @@ bool allow_set_read_only_value(const Component& component, const Variable& varia
            variable == ConnectorComponentVariables::AvailabilityState;
 }
 
+/// \brief Frequently updated read-only values that can be held in memory instead of being written to the storage on
+/// every update
+static bool is_volatile_attribute(const Component& component, const Variable& variable,
+                                  const AttributeEnum attribute_enum) {
+    if (attribute_enum != AttributeEnum::Actual) {
+        return false;
+    }
+
+    return (component.name == "EVSE" and
+            (variable == EvseComponentVariables::Power or variable == EvseComponentVariables::AvailabilityState)) or
+           (component.name == "Connector" and variable == ConnectorComponentVariables::AvailabilityState);
+}
+
 bool DeviceModel::component_criteria_match(const Component& component,
                                            const std::vector<ComponentCriterionEnum>& component_criteria) {
     if (component_criteria.empty()) {
         return false;
     }
     for (const auto& criteria : component_criteria) {
-        const Variable variable = {conversions::component_criterion_enum_to_string(criteria)};
+        const Variable variable = {std::string(conversions::component_criterion_enum_to_string(criteria))};
 
         const auto response = this->request_value<bool>(component, variable, AttributeEnum::Actual);
         auto value = response.value;
@@ -161,7 +198,10 @@ GetVariableStatusEnum DeviceModel::request_value_internal(const Component& compo
         return GetVariableStatusEnum::UnknownVariable;
     }
 
-    const auto attribute_opt = this->storage->get_variable_attribute(component_id, variable_id, attribute_enum);
+    auto attribute_opt = this->get_volatile_attribute(component_id, variable_id, attribute_enum);
+    if (!attribute_opt.has_value()) {
+        attribute_opt = this->storage->get_variable_attribute(component_id, variable_id, attribute_enum);
+    }
 
     if ((not attribute_opt) or (not attribute_opt->value)) {
         return GetVariableStatusEnum::NotSupportedAttributeType;
@@ -185,13 +225,22 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
         return SetVariableStatusEnum::UnknownComponent;
     }
 
-    auto variable_map = this->device_model[component];
+    const auto& variable_map = this->device_model.at(component);
+    const auto variable_it = variable_map.find(variable);
 
-    if (variable_map.find(variable) == variable_map.end()) {
+    if (variable_it == variable_map.end()) {
         return SetVariableStatusEnum::UnknownVariable;
     }
 
-    const auto characteristics = variable_map[variable].characteristics;
+    return this->set_value_internal(component, variable, variable_it->second, attribute_enum, value, allow_read_only);
+}
+
+SetVariableStatusEnum DeviceModel::validate_set_value(const Component& component, const Variable& variable,
+                                                      const VariableMetaData& meta_data,
+                                                      const AttributeEnum& attribute_enum, const std::string& value,
+                                                      const bool allow_read_only, bool& is_volatile,
+                                                      std::optional<VariableAttribute>& attribute) {
+    const auto& characteristics = meta_data.characteristics;
     try {
         if (!validate_value(characteristics, value, allow_zero(component, variable))) {
             return SetVariableStatusEnum::Rejected;
@@ -202,7 +251,13 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
         return SetVariableStatusEnum::Rejected;
     }
 
-    const auto attribute = this->storage->get_variable_attribute(component, variable, attribute_enum);
+    is_volatile = this->volatile_values_enabled and is_volatile_attribute(component, variable, attribute_enum);
+
+    // volatile attributes are only looked up in the storage on their first update
+    attribute = is_volatile ? this->get_volatile_attribute(component, variable, attribute_enum) : std::nullopt;
+    if (!attribute.has_value()) {
+        attribute = this->storage->get_variable_attribute(component, variable, attribute_enum);
+    }
 
     if (!attribute.has_value()) {
         return SetVariableStatusEnum::NotSupportedAttributeType;
@@ -214,13 +269,314 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
         return SetVariableStatusEnum::Rejected;
     }
 
+    return SetVariableStatusEnum::Accepted;
+}
+
+bool DeviceModel::set_volatile_value(const Component& component, const Variable& variable,
+                                     const AttributeEnum& attribute_enum, const VariableAttribute& attribute,
+                                     const std::string& value) {
+    std::unique_lock<std::mutex> lk(this->volatile_values_mutex);
+    // checked again under the lock, so no value is added after set_volatile_values_enabled(false) has flushed
+    if (!this->volatile_values_enabled) {
+        return false;
+    }
+    auto& volatile_value = this->volatile_values[{component, variable, attribute_enum}];
+    volatile_value.attribute = attribute;
+    volatile_value.attribute.value = value;
+    volatile_value.dirty = true;
+    lk.unlock();
+    this->invalidate_cached_value(component, variable, attribute_enum);
+    return true;
+}
+
+SetVariableStatusEnum DeviceModel::set_value_internal(const Component& component, const Variable& variable,
+                                                      const VariableMetaData& meta_data,
+                                                      const AttributeEnum& attribute_enum, const std::string& value,
+                                                      const bool allow_read_only) {
+    bool is_volatile = false;
+    std::optional<VariableAttribute> attribute;
+    const auto status = this->validate_set_value(component, variable, meta_data, attribute_enum, value,
+                                                 allow_read_only, is_volatile, attribute);
+    if (status != SetVariableStatusEnum::Accepted) {
+        return status;
+    }
+
+    if (is_volatile and this->set_volatile_value(component, variable, attribute_enum, attribute.value(), value)) {
+        this->notify_monitored_value_changed(component, variable, meta_data, attribute_enum, attribute.value(), value);
+        return SetVariableStatusEnum::Accepted;
+    }
+
     const auto success = this->storage->set_variable_attribute_value(component, variable, attribute_enum, value);
-    return success ? SetVariableStatusEnum::Accepted : SetVariableStatusEnum::Rejected;
+    this->invalidate_cached_value(component, variable, attribute_enum);
+    if (!success) {
+        return SetVariableStatusEnum::Rejected;
+    }
+    this->notify_monitored_value_changed(component, variable, meta_data, attribute_enum, attribute.value(), value);
+    return SetVariableStatusEnum::Accepted;
 };
 
+void DeviceModel::notify_monitored_value_changed(const Component& component, const Variable& variable,
+                                                 const VariableMetaData& meta_data,
+                                                 const AttributeEnum& attribute_enum,
+                                                 const VariableAttribute& previous_attribute,
+                                                 const std::string& value) {
+    if (attribute_enum != AttributeEnum::Actual or meta_data.monitors.empty() or
+        this->monitored_value_changed_callback == nullptr) {
+        return;
+    }
+
+    std::optional<std::string> previous_value;
+    if (previous_attribute.value.has_value()) {
+        previous_value = previous_attribute.value.value().get();
+    }
+    this->monitored_value_changed_callback(component, variable, meta_data.monitors, previous_value, value);
+}
+
+std::vector<SetVariableStatusEnum> DeviceModel::set_values(const std::vector<SetVariableData>& set_variable_data,
+                                                           const bool allow_read_only) {
+    std::vector<SetVariableStatusEnum> results(set_variable_data.size(), SetVariableStatusEnum::Rejected);
+
+    // values that have been validated and are written to the storage at once, with the index of their result and the
+    // information required to notify their monitors
+    std::vector<VariableAttributeValue> storage_values;
+    std::vector<size_t> storage_value_indices;
+    std::vector<std::pair<const VariableMetaData*, VariableAttribute>> storage_value_attributes;
+
+    for (size_t i = 0; i < set_variable_data.size(); i++) {
+        const auto& data = set_variable_data.at(i);
+        const auto attribute_enum = data.attributeType.value_or(AttributeEnum::Actual);
+
+        const auto component_it = this->device_model.find(data.component);
+        if (component_it == this->device_model.end()) {
+            results.at(i) = SetVariableStatusEnum::UnknownComponent;
+            continue;
+        }
+        const auto variable_it = component_it->second.find(data.variable);
+        if (variable_it == component_it->second.end()) {
+            results.at(i) = SetVariableStatusEnum::UnknownVariable;
+            continue;
+        }
+
+        bool is_volatile = false;
+        std::optional<VariableAttribute> attribute;
+        results.at(i) = this->validate_set_value(data.component, data.variable, variable_it->second, attribute_enum,
+                                                 data.attributeValue.get(), allow_read_only, is_volatile, attribute);
+        if (results.at(i) != SetVariableStatusEnum::Accepted) {
+            continue;
+        }
+
+        if (is_volatile and this->set_volatile_value(data.component, data.variable, attribute_enum,
+                                                     attribute.value(), data.attributeValue.get())) {
+            this->notify_monitored_value_changed(data.component, data.variable, variable_it->second, attribute_enum,
+                                                 attribute.value(), data.attributeValue.get());
+            continue;
+        }
+
+        storage_values.push_back({data.component, data.variable, attribute_enum, data.attributeValue.get()});
+        storage_value_indices.push_back(i);
+        storage_value_attributes.emplace_back(&variable_it->second, std::move(attribute.value()));
+    }
+
+    if (storage_values.empty()) {
+        return results;
+    }
+
+    const auto successes = this->storage->set_variable_attribute_values(storage_values);
+    for (size_t i = 0; i < storage_values.size(); i++) {
+        const auto& value = storage_values.at(i);
+        const auto success = i < successes.size() and successes.at(i);
+        results.at(storage_value_indices.at(i)) =
+            success ? SetVariableStatusEnum::Accepted : SetVariableStatusEnum::Rejected;
+        this->invalidate_cached_value(value.component, value.variable, value.attribute_enum);
+        if (success) {
+            const auto& [meta_data, previous_attribute] = storage_value_attributes.at(i);
+            this->notify_monitored_value_changed(value.component, value.variable, *meta_data, value.attribute_enum,
+                                                 previous_attribute, value.value);
+        }
+    }
+    return results;
+}
+
 DeviceModel::DeviceModel(std::unique_ptr<DeviceModelStorage> device_model_storage) :
-    storage{std::move(device_model_storage)} {
+    storage{std::move(device_model_storage)},
+    volatile_values_enabled(false),
+    value_cache_enabled(true),
+    handle_values(ControllerComponentVariableHandles::COUNT),
+    handle_meta_data(ControllerComponentVariableHandles::COUNT, nullptr) {
     this->device_model = this->storage->get_device_model();
+
+    // resolve the ControllerComponentVariableHandles once, so they can be used without looking up names
+    for (size_t index = 0; index < ControllerComponentVariableHandles::COUNT; index++) {
+        const auto& component_variable = ControllerComponentVariableHandles::get_component_variable(index);
+        const auto& component = component_variable.component;
+        const auto& variable = component_variable.variable.value();
+        this->handle_indices.emplace(VariableAttributeKey{component, variable, AttributeEnum::Actual}, index);
+
+        const auto component_it = this->device_model.find(component);
+        if (component_it != this->device_model.end()) {
+            const auto variable_it = component_it->second.find(variable);
+            if (variable_it != component_it->second.end()) {
+                this->handle_meta_data.at(index) = &variable_it->second;
+            }
+        }
+    }
+}
+
+DeviceModel::~DeviceModel() {
+    try {
+        this->flush_volatile_values();
+    } catch (const std::exception& e) {
+        EVLOG_error << "Could not write volatile values to device model storage: " << e.what();
+    }
+}
+
+void DeviceModel::set_volatile_values_enabled(const bool enabled) {
+    // switched under the same lock as the volatile values, so values set concurrently are either flushed here or
+    // written to the storage directly
+    std::lock_guard<std::mutex> lk(this->volatile_values_mutex);
+    const auto was_enabled = this->volatile_values_enabled.exchange(enabled);
+    if (was_enabled and !enabled) {
+        this->flush_volatile_values_locked();
+        this->volatile_values.clear();
+    }
+}
+
+void DeviceModel::flush_volatile_values() {
+    std::lock_guard<std::mutex> lk(this->volatile_values_mutex);
+    this->flush_volatile_values_locked();
+}
+
+void DeviceModel::flush_volatile_values_locked() {
+    std::vector<VariableAttributeValue> values;
+    std::vector<VolatileAttributeValue*> flushed_values;
+    for (auto& [key, volatile_value] : this->volatile_values) {
+        if (!volatile_value.dirty or !volatile_value.attribute.value.has_value()) {
+            continue;
+        }
+        const auto& [component, variable, attribute_enum] = key;
+        values.push_back({component, variable, attribute_enum, volatile_value.attribute.value.value().get()});
+        flushed_values.push_back(&volatile_value);
+    }
+
+    if (values.empty()) {
+        return;
+    }
+
+    const auto successes = this->storage->set_variable_attribute_values(values);
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i < successes.size() and successes.at(i)) {
+            flushed_values.at(i)->dirty = false;
+        } else {
+            EVLOG_warning << "Could not write volatile value for component: " << values.at(i).component
+                          << " and variable: " << values.at(i).variable << " to device model storage";
+        }
+    }
+}
+
+void DeviceModel::set_monitored_value_changed_callback(MonitoredValueChangedCallback callback) {
+    this->monitored_value_changed_callback = std::move(callback);
+}
+
+void DeviceModel::for_each_monitor(
+    const std::function<void(const Component&, const Variable&, const VariableMonitoring&)>& on_monitor) const {
+    for (const auto& [component, variable_map] : this->device_model) {
+        for (const auto& [variable, meta_data] : variable_map) {
+            for (const auto& monitor : meta_data.monitors) {
+                on_monitor(component, variable, monitor);
+            }
+        }
+    }
+}
+
+void DeviceModel::set_value_cache_enabled(const bool enabled) {
+    std::lock_guard<std::mutex> lk(this->value_cache_mutex);
+    this->value_cache_enabled = enabled;
+    this->value_cache.clear();
+    std::fill(this->handle_values.begin(), this->handle_values.end(), std::nullopt);
+}
+
+void DeviceModel::clear_value_cache() {
+    std::lock_guard<std::mutex> lk(this->value_cache_mutex);
+    this->value_cache.clear();
+    std::fill(this->handle_values.begin(), this->handle_values.end(), std::nullopt);
+}
+
+void DeviceModel::invalidate_cached_value(const Component& component_id, const Variable& variable_id,
+                                          const AttributeEnum& attribute_enum) {
+    const VariableAttributeKey key{component_id, variable_id, attribute_enum};
+    std::lock_guard<std::mutex> lk(this->value_cache_mutex);
+    this->value_cache.erase(key);
+    const auto handle_it = this->handle_indices.find(key);
+    if (handle_it != this->handle_indices.end()) {
+        this->handle_values.at(handle_it->second).reset();
+    }
+}
+
+std::optional<VariableAttribute> DeviceModel::get_volatile_attribute(const Component& component_id,
+                                                                     const Variable& variable_id,
+                                                                     const AttributeEnum& attribute_enum) {
+    if (!this->volatile_values_enabled) {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lk(this->volatile_values_mutex);
+    const auto it = this->volatile_values.find({component_id, variable_id, attribute_enum});
+    if (it == this->volatile_values.end()) {
+        return std::nullopt;
+    }
+    return it->second.attribute;
+}
+
+void DeviceModel::apply_volatile_value(const Component& component_id, const Variable& variable_id,
+                                       VariableAttribute& variable_attribute) {
+    const auto volatile_attribute = this->get_volatile_attribute(
+        component_id, variable_id, variable_attribute.type.value_or(AttributeEnum::Actual));
+    if (volatile_attribute.has_value()) {
+        variable_attribute.value = volatile_attribute->value;
+    }
+}
+
+void DeviceModel::for_each_stored_variable(
+    const std::optional<std::vector<std::pair<Component, Variable>>>& variables,
+    const std::function<void(const Component&, const Variable&, const VariableMetaData&,
+                             std::vector<VariableAttribute>&)>& on_variable) {
+    std::optional<Component> component;
+    std::optional<Variable> variable;
+    std::vector<VariableAttribute> variable_attributes;
+
+    const auto complete_variable = [this, &component, &variable, &variable_attributes, &on_variable]() {
+        if (variable_attributes.empty()) {
+            return;
+        }
+        const auto component_it = this->device_model.find(component.value());
+        if (component_it != this->device_model.end()) {
+            const auto variable_it = component_it->second.find(variable.value());
+            if (variable_it != component_it->second.end()) {
+                on_variable(component.value(), variable.value(), variable_it->second, variable_attributes);
+            }
+        }
+        variable_attributes.clear();
+    };
+
+    // the storage provides the attributes of a variable consecutively, so a variable is complete once the next begins
+    const auto on_attribute = [this, &component, &variable, &variable_attributes, &complete_variable](
+                                  const Component& attribute_component, const Variable& attribute_variable,
+                                  const VariableAttribute& variable_attribute) {
+        if (!component.has_value() or !(component.value() == attribute_component) or
+            !(variable.value() == attribute_variable)) {
+            complete_variable();
+            component = attribute_component;
+            variable = attribute_variable;
+        }
+        variable_attributes.push_back(variable_attribute);
+        this->apply_volatile_value(attribute_component, attribute_variable, variable_attributes.back());
+    };
+    if (variables.has_value()) {
+        this->storage->for_each_variable_attribute(variables.value(), on_attribute);
+    } else {
+        this->storage->for_each_variable_attribute(on_attribute);
+    }
+    complete_variable();
 }
 
 SetVariableStatusEnum DeviceModel::set_read_only_value(const Component& component, const Variable& variable,
@@ -244,73 +600,107 @@ std::optional<VariableMetaData> DeviceModel::get_variable_meta_data(const Compon
 
 std::vector<ReportData> DeviceModel::get_base_report_data(const ReportBaseEnum& report_base) {
     std::vector<ReportData> report_data_vec;
+    this->for_each_base_report_data(
+        report_base, [&report_data_vec](const ReportData& report_data) { report_data_vec.push_back(report_data); });
+    return report_data_vec;
+}
 
-    for (auto const& [component, variable_map] : this->device_model) {
-        for (auto const& [variable, variable_meta_data] : variable_map) {
-
-            ReportData report_data;
-            report_data.component = component;
-            report_data.variable = variable;
-
-            // request the variable attribute from the device model storage
-            const auto variable_attributes = this->storage->get_variable_attributes(component, variable);
-
-            // iterate over possibly (Actual, Target, MinSet, MaxSet)
-            for (const auto& variable_attribute : variable_attributes) {
-                // FIXME(piet): Right now this reports only FullInventory (ReadOnly,
-                // ReadWrite or WriteOnly) and ConfigurationInventory (ReadWrite or WriteOnly) correctly
-                // TODO(piet): SummaryInventory
-                if (report_base == ReportBaseEnum::FullInventory or
-                    (report_base == ReportBaseEnum::ConfigurationInventory and
-                     (variable_attribute.mutability == MutabilityEnum::ReadWrite or
-                      variable_attribute.mutability == MutabilityEnum::WriteOnly))) {
-                    report_data.variableAttribute.push_back(variable_attribute);
-                    // scrub WriteOnly value from report
-                    if (variable_attribute.mutability == MutabilityEnum::WriteOnly) {
-                        report_data.variableAttribute.back().value.reset();
-                    }
-                    report_data.variableCharacteristics = variable_map.at(variable).characteristics;
+void DeviceModel::for_each_base_report_data(const ReportBaseEnum& report_base,
+                                            const std::function<void(const ReportData&)>& on_report_data) {
+    this->for_each_stored_variable(std::nullopt, [&report_base, &on_report_data](
+                                       const Component& component, const Variable& variable,
+                                       const VariableMetaData& variable_meta_data,
+                                       std::vector<VariableAttribute>& variable_attributes) {
+        ReportData report_data;
+        report_data.component = component;
+        report_data.variable = variable;
+
+        // iterate over possibly (Actual, Target, MinSet, MaxSet)
+        for (auto& variable_attribute : variable_attributes) {
+            // FIXME(piet): Right now this reports only FullInventory (ReadOnly,
+            // ReadWrite or WriteOnly) and ConfigurationInventory (ReadWrite or WriteOnly) correctly
+            // TODO(piet): SummaryInventory
+            if (report_base == ReportBaseEnum::FullInventory or
+                (report_base == ReportBaseEnum::ConfigurationInventory and
+                 (variable_attribute.mutability == MutabilityEnum::ReadWrite or
+                  variable_attribute.mutability == MutabilityEnum::WriteOnly))) {
+                report_data.variableAttribute.push_back(std::move(variable_attribute));
+                // scrub WriteOnly value from report
+                if (report_data.variableAttribute.back().mutability == MutabilityEnum::WriteOnly) {
+                    report_data.variableAttribute.back().value.reset();
                 }
-            }
-            if (!report_data.variableAttribute.empty()) {
-                report_data_vec.push_back(report_data);
+                report_data.variableCharacteristics = variable_meta_data.characteristics;
             }
         }
-    }
-    return report_data_vec;
+        if (!report_data.variableAttribute.empty()) {
+            on_report_data(report_data);
+        }
+    });
 }
 
 std::vector<ReportData>
 DeviceModel::get_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
                                     const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria) {
     std::vector<ReportData> report_data_vec;
+    this->for_each_custom_report_data(
+        component_variables, component_criteria,
+        [&report_data_vec](const ReportData& report_data) { report_data_vec.push_back(report_data); });
+    return report_data_vec;
+}
 
-    for (auto const& [component, variable_map] : this->device_model) {
-        if (!component_criteria.has_value() or component_criteria_match(component, component_criteria.value())) {
+void DeviceModel::for_each_custom_report_data(
+    const std::optional<std::vector<ComponentVariable>>& component_variables,
+    const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria,
+    const std::function<void(const ReportData&)>& on_report_data) {
+    std::optional<std::vector<std::pair<Component, Variable>>> requested_variables;
+    std::map<Component, bool> criteria_matches;
+    const auto criteria_match = [this, &component_criteria, &criteria_matches](const Component& component) {
+        if (!component_criteria.has_value()) {
+            return true;
+        }
+        auto match = criteria_matches.find(component);
+        if (match == criteria_matches.end()) {
+            match = criteria_matches
+                        .emplace(component, this->component_criteria_match(component, component_criteria.value()))
+                        .first;
+        }
+        return match->second;
+    };
 
+    if (component_variables.has_value()) {
+        // only the attributes of the requested variables are read from the device model storage
+        requested_variables.emplace();
+        for (auto const& [component, variable_map] : this->device_model) {
             for (auto const& [variable, variable_meta_data] : variable_map) {
-                if (!component_variables.has_value() or
-                    component_variables_match(component_variables.value(), component, variable)) {
-                    ReportData report_data;
-                    report_data.component = component;
-                    report_data.variable = variable;
-
-                    //  request the variable attribute from the device model storage
-                    const auto variable_attributes = this->storage->get_variable_attributes(component, variable);
-
-                    for (const auto& variable_attribute : variable_attributes) {
-                        report_data.variableAttribute.push_back(variable_attribute);
-                        report_data.variableCharacteristics = variable_map.at(variable).characteristics;
-                    }
-
-                    if (!report_data.variableAttribute.empty()) {
-                        report_data_vec.push_back(report_data);
-                    }
+                if (!component_variables_match(component_variables.value(), component, variable)) {
+                    continue;
+                }
+                if (!criteria_match(component)) {
+                    break;
                 }
+                requested_variables->emplace_back(component, variable);
             }
         }
+        if (requested_variables->empty()) {
+            return;
+        }
     }
-    return report_data_vec;
+
+    this->for_each_stored_variable(
+        requested_variables, [&criteria_match, &on_report_data](const Component& component, const Variable& variable,
+                                                                const VariableMetaData& variable_meta_data,
+                                                                std::vector<VariableAttribute>& variable_attributes) {
+            if (!criteria_match(component)) {
+                return;
+            }
+
+            ReportData report_data;
+            report_data.component = component;
+            report_data.variable = variable;
+            report_data.variableAttribute = std::move(variable_attributes);
+            report_data.variableCharacteristics = variable_meta_data.characteristics;
+            on_report_data(report_data);
+        });
 }
 
 void DeviceModel::check_integrity(const std::map<int32_t, int32_t>& evse_connector_structure) {
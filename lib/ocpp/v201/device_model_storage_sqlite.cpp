@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <algorithm>
+#include <tuple>
+
 #include <everest/logging.hpp>
 #include <ocpp/common/database/sqlite_statement.hpp>
 #include <ocpp/v201/device_model_storage_sqlite.hpp>
@@ -11,8 +14,9 @@ using namespace common;
 
 namespace v201 {
 
-DeviceModelStorageSqlite::DeviceModelStorageSqlite(const fs::path& db_path) {
-    if (sqlite3_open(db_path.c_str(), &this->db) != SQLITE_OK) {
+DeviceModelStorageSqlite::DeviceModelStorageSqlite(const fs::path& db_path) :
+    database(std::make_unique<DatabaseConnection>(db_path)) {
+    if (!this->database->open_connection()) {
         EVLOG_error << "Could not open database at provided path: " << db_path;
         EVLOG_AND_THROW(std::runtime_error("Could not open device model database at provided path."));
     } else {
@@ -23,55 +27,112 @@ DeviceModelStorageSqlite::DeviceModelStorageSqlite(const fs::path& db_path) {
 int DeviceModelStorageSqlite::get_component_id(const Component& component_id) {
     std::string select_query =
         "SELECT ID FROM COMPONENT WHERE NAME = ? AND INSTANCE IS ? AND EVSE_ID IS ? AND CONNECTOR_ID IS ?";
-    SQLiteStatement select_stmt(this->db, select_query);
+    auto select_stmt = this->database->new_statement(select_query);
 
-    select_stmt.bind_text(1, component_id.name.get(), SQLiteString::Transient);
+    select_stmt->bind_text(1, component_id.name.get(), SQLiteString::Transient);
     if (component_id.instance.has_value()) {
-        select_stmt.bind_text(2, component_id.instance.value().get(), SQLiteString::Transient);
+        select_stmt->bind_text(2, component_id.instance.value().get(), SQLiteString::Transient);
     } else {
-        select_stmt.bind_null(2);
+        select_stmt->bind_null(2);
     }
     if (component_id.evse.has_value()) {
-        select_stmt.bind_int(3, component_id.evse.value().id);
+        select_stmt->bind_int(3, component_id.evse.value().id);
         if (component_id.evse.value().connectorId.has_value()) {
-            select_stmt.bind_int(4, component_id.evse.value().connectorId.value());
+            select_stmt->bind_int(4, component_id.evse.value().connectorId.value());
         } else {
-            select_stmt.bind_null(4);
+            select_stmt->bind_null(4);
         }
     } else {
-        select_stmt.bind_null(3);
+        select_stmt->bind_null(3);
     }
 
-    if (select_stmt.step() == SQLITE_ROW) {
-        return select_stmt.column_int(0);
+    if (select_stmt->step() == SQLITE_ROW) {
+        return select_stmt->column_int(0);
     } else {
         return -1;
     }
 }
 
 int DeviceModelStorageSqlite::get_variable_id(const Component& component_id, const Variable& variable_id) {
+    std::lock_guard<std::mutex> lk(this->variable_ids_mutex);
+    const auto it = this->variable_ids.find({component_id, variable_id});
+    if (it != this->variable_ids.end()) {
+        return it->second;
+    }
+
     const auto _component_id = this->get_component_id(component_id);
     if (_component_id == -1) {
         return -1;
     }
 
     std::string select_query = "SELECT ID FROM VARIABLE WHERE COMPONENT_ID = ? AND NAME = ? AND INSTANCE IS ?";
-    SQLiteStatement select_stmt(this->db, select_query);
+    auto select_stmt = this->database->new_statement(select_query);
 
-    select_stmt.bind_int(1, _component_id);
-    select_stmt.bind_text(2, variable_id.name.get(), SQLiteString::Transient);
+    select_stmt->bind_int(1, _component_id);
+    select_stmt->bind_text(2, variable_id.name.get(), SQLiteString::Transient);
     if (variable_id.instance.has_value()) {
-        select_stmt.bind_text(3, variable_id.instance.value().get(), SQLiteString::Transient);
+        select_stmt->bind_text(3, variable_id.instance.value().get(), SQLiteString::Transient);
     } else {
-        select_stmt.bind_null(3);
+        select_stmt->bind_null(3);
     }
-    if (select_stmt.step() == SQLITE_ROW) {
-        return select_stmt.column_int(0);
+    if (select_stmt->step() == SQLITE_ROW) {
+        const auto id = select_stmt->column_int(0);
+        this->variable_ids.emplace(std::make_pair(component_id, variable_id), id);
+        return id;
     } else {
         return -1;
     }
 }
 
+/// \brief Reads a Component from the columns NAME, EVSE_ID, CONNECTOR_ID and INSTANCE of the COMPONENT table, which
+/// have to be the first four columns of the result of \p stmt
+static Component read_component(SQLiteStatementInterface& stmt) {
+    Component component;
+    component.name = stmt.column_text(0);
+
+    if (stmt.column_type(1) != SQLITE_NULL) {
+        auto evse_id = stmt.column_int(1);
+        EVSE evse;
+        evse.id = evse_id;
+        if (stmt.column_type(2) != SQLITE_NULL) {
+            evse.connectorId = stmt.column_int(2);
+        }
+        component.evse = evse;
+    }
+
+    if (stmt.column_type(3) != SQLITE_NULL) {
+        component.instance = stmt.column_text(3);
+    }
+    return component;
+}
+
+/// \brief Reads a Variable from the columns NAME and INSTANCE of the VARIABLE table, which have to be the fifth and
+/// sixth column of the result of \p stmt
+static Variable read_variable(SQLiteStatementInterface& stmt) {
+    Variable variable;
+    variable.name = stmt.column_text(4);
+
+    if (stmt.column_type(5) != SQLITE_NULL) {
+        variable.instance = stmt.column_text(5);
+    }
+    return variable;
+}
+
+/// \brief Reads a VariableAttribute from the columns VALUE, MUTABILITY_ID, PERSISTENT, CONSTANT and TYPE_ID of the
+/// VARIABLE_ATTRIBUTE table, starting at column \p first
+static VariableAttribute read_variable_attribute(SQLiteStatementInterface& stmt, const int first) {
+    VariableAttribute attribute;
+
+    if (stmt.column_type(first) != SQLITE_NULL) {
+        attribute.value = stmt.column_text(first);
+    }
+    attribute.mutability = static_cast<MutabilityEnum>(stmt.column_int(first + 1));
+    attribute.persistent = static_cast<bool>(stmt.column_int(first + 2));
+    attribute.constant = static_cast<bool>(stmt.column_int(first + 3));
+    attribute.type = static_cast<AttributeEnum>(stmt.column_int(first + 4));
+    return attribute;
+}
+
 DeviceModelMap DeviceModelStorageSqlite::get_device_model() {
     std::map<Component, std::map<Variable, VariableMetaData>> device_model;
 
@@ -82,51 +143,30 @@ DeviceModelMap DeviceModelStorageSqlite::get_device_model() {
         "JOIN VARIABLE v ON c.ID = v.COMPONENT_ID "
         "JOIN VARIABLE_CHARACTERISTICS vc ON v.VARIABLE_CHARACTERISTICS_ID = vc.ID";
 
-    SQLiteStatement select_stmt(this->db, select_query);
-
-    while (select_stmt.step() == SQLITE_ROW) {
-        Component component;
-        component.name = select_stmt.column_text(0);
-
-        if (select_stmt.column_type(1) != SQLITE_NULL) {
-            auto evse_id = select_stmt.column_int(1);
-            EVSE evse;
-            evse.id = evse_id;
-            if (select_stmt.column_type(2) != SQLITE_NULL) {
-                evse.connectorId = select_stmt.column_int(2);
-            }
-            component.evse = evse;
-        }
-
-        if (select_stmt.column_type(3) != SQLITE_NULL) {
-            component.instance = select_stmt.column_text(3);
-        }
+    auto select_stmt = this->database->new_statement(select_query);
 
-        Variable variable;
-        variable.name = select_stmt.column_text(4);
-
-        if (select_stmt.column_type(5) != SQLITE_NULL) {
-            variable.instance = select_stmt.column_text(5);
-        }
+    while (select_stmt->step() == SQLITE_ROW) {
+        const auto component = read_component(*select_stmt);
+        const auto variable = read_variable(*select_stmt);
 
         VariableCharacteristics characteristics;
-        characteristics.dataType = static_cast<DataEnum>(select_stmt.column_int(6));
-        characteristics.supportsMonitoring = select_stmt.column_int(7) != 0;
+        characteristics.dataType = static_cast<DataEnum>(select_stmt->column_int(6));
+        characteristics.supportsMonitoring = select_stmt->column_int(7) != 0;
 
-        if (select_stmt.column_type(8) != SQLITE_NULL) {
-            characteristics.unit = select_stmt.column_text(8);
+        if (select_stmt->column_type(8) != SQLITE_NULL) {
+            characteristics.unit = select_stmt->column_text(8);
         }
 
-        if (select_stmt.column_type(9) != SQLITE_NULL) {
-            characteristics.minLimit = select_stmt.column_double(9);
+        if (select_stmt->column_type(9) != SQLITE_NULL) {
+            characteristics.minLimit = select_stmt->column_double(9);
         }
 
-        if (select_stmt.column_type(10) != SQLITE_NULL) {
-            characteristics.maxLimit = select_stmt.column_double(10);
+        if (select_stmt->column_type(10) != SQLITE_NULL) {
+            characteristics.maxLimit = select_stmt->column_double(10);
         }
 
-        if (select_stmt.column_type(11) != SQLITE_NULL) {
-            characteristics.valuesList = select_stmt.column_text(11);
+        if (select_stmt->column_type(11) != SQLITE_NULL) {
+            characteristics.valuesList = select_stmt->column_text(11);
         }
 
         VariableMetaData meta_data;
@@ -135,6 +175,37 @@ DeviceModelMap DeviceModelStorageSqlite::get_device_model() {
         device_model[component][variable] = meta_data;
     }
 
+    std::string select_monitors_query =
+        "SELECT c.NAME, c.EVSE_ID, c.CONNECTOR_ID, c.INSTANCE, v.NAME, v.INSTANCE, vm.ID, vm.\"TRANSACTION\", "
+        "vm.TYPE_ID, vm.\"VALUE\", vm.SEVERITY "
+        "FROM VARIABLE_MONITORING vm "
+        "JOIN VARIABLE v ON v.ID = vm.VARIABLE_ID "
+        "JOIN COMPONENT c ON c.ID = v.COMPONENT_ID";
+
+    auto select_monitors_stmt = this->database->new_statement(select_monitors_query);
+
+    while (select_monitors_stmt->step() == SQLITE_ROW) {
+        const auto component = read_component(*select_monitors_stmt);
+        const auto variable = read_variable(*select_monitors_stmt);
+
+        const auto component_it = device_model.find(component);
+        if (component_it == device_model.end()) {
+            continue;
+        }
+        const auto variable_it = component_it->second.find(variable);
+        if (variable_it == component_it->second.end()) {
+            continue;
+        }
+
+        VariableMonitoring monitor;
+        monitor.id = select_monitors_stmt->column_int(6);
+        monitor.transaction = select_monitors_stmt->column_int(7) != 0;
+        monitor.type = static_cast<MonitorEnum>(select_monitors_stmt->column_int(8));
+        monitor.value = static_cast<float>(select_monitors_stmt->column_double(9));
+        monitor.severity = select_monitors_stmt->column_int(10);
+        variable_it->second.monitors.push_back(monitor);
+    }
+
     EVLOG_info << "Successfully retrieved Device Model from DeviceModelStorage";
     return device_model;
 }
@@ -169,31 +240,120 @@ DeviceModelStorageSqlite::get_variable_attributes(const Component& component_id,
         select_query = ss.str();
     }
 
-    SQLiteStatement select_stmt(this->db, select_query);
+    auto select_stmt = this->database->new_statement(select_query);
 
-    select_stmt.bind_int(1, _variable_id);
+    select_stmt->bind_int(1, _variable_id);
+
+    while (select_stmt->step() == SQLITE_ROW) {
+        attributes.push_back(read_variable_attribute(*select_stmt, 0));
+    }
 
-    while (select_stmt.step() == SQLITE_ROW) {
-        VariableAttribute attribute;
+    return attributes;
+}
 
-        if (select_stmt.column_type(0) != SQLITE_NULL) {
-            attribute.value = select_stmt.column_text(0);
+void DeviceModelStorageSqlite::for_each_variable_attribute(
+    const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) {
+    const std::string select_query =
+        "SELECT c.NAME, c.EVSE_ID, c.CONNECTOR_ID, c.INSTANCE, v.NAME, v.INSTANCE, "
+        "va.VALUE, va.MUTABILITY_ID, va.PERSISTENT, va.CONSTANT, va.TYPE_ID "
+        "FROM VARIABLE_ATTRIBUTE va "
+        "JOIN VARIABLE v ON v.ID = va.VARIABLE_ID "
+        "JOIN COMPONENT c ON c.ID = v.COMPONENT_ID "
+        "ORDER BY va.VARIABLE_ID, va.ID";
+
+    auto select_stmt = this->database->new_statement(select_query);
+
+    while (select_stmt->step() == SQLITE_ROW) {
+        on_attribute(read_component(*select_stmt), read_variable(*select_stmt),
+                     read_variable_attribute(*select_stmt, 6));
+    }
+}
+
+void DeviceModelStorageSqlite::for_each_variable_attribute(
+    const std::vector<std::pair<Component, Variable>>& variables,
+    const std::function<void(const Component&, const Variable&, const VariableAttribute&)>& on_attribute) {
+    if (variables.empty()) {
+        return;
+    }
+
+    std::vector<std::tuple<Component, Variable, VariableAttribute>> attributes;
+    {
+        // the requested variables are written to a temporary table, so the attributes of all of them are selected
+        // with a single join. The write mutex keeps other threads from changing the table until it has been read
+        std::lock_guard<std::mutex> lk(this->write_mutex);
+        if (!this->database->execute_statement(
+                "CREATE TEMP TABLE IF NOT EXISTS REQUESTED_VARIABLE (COMPONENT_NAME TEXT NOT NULL, COMPONENT_INSTANCE "
+                "TEXT, EVSE_ID INT, CONNECTOR_ID INT, VARIABLE_NAME TEXT NOT NULL, VARIABLE_INSTANCE TEXT)") or
+            !this->database->execute_statement("DELETE FROM REQUESTED_VARIABLE")) {
+            EVLOG_error << "Could not prepare table of requested variables: " << this->database->get_error_message();
+            return;
+        }
+
+        auto transaction = this->database->begin_transaction();
+        std::string insert_query = "INSERT INTO REQUESTED_VARIABLE (COMPONENT_NAME, COMPONENT_INSTANCE, EVSE_ID, "
+                                   "CONNECTOR_ID, VARIABLE_NAME, VARIABLE_INSTANCE) VALUES (?, ?, ?, ?, ?, ?)";
+        auto insert_stmt = this->database->new_statement(insert_query);
+        for (const auto& [component, variable] : variables) {
+            insert_stmt->reset();
+            insert_stmt->bind_text(1, component.name.get(), SQLiteString::Transient);
+            if (component.instance.has_value()) {
+                insert_stmt->bind_text(2, component.instance.value().get(), SQLiteString::Transient);
+            } else {
+                insert_stmt->bind_null(2);
+            }
+            if (component.evse.has_value()) {
+                insert_stmt->bind_int(3, component.evse.value().id);
+            } else {
+                insert_stmt->bind_null(3);
+            }
+            if (component.evse.has_value() and component.evse.value().connectorId.has_value()) {
+                insert_stmt->bind_int(4, component.evse.value().connectorId.value());
+            } else {
+                insert_stmt->bind_null(4);
+            }
+            insert_stmt->bind_text(5, variable.name.get(), SQLiteString::Transient);
+            if (variable.instance.has_value()) {
+                insert_stmt->bind_text(6, variable.instance.value().get(), SQLiteString::Transient);
+            } else {
+                insert_stmt->bind_null(6);
+            }
+            if (insert_stmt->step() != SQLITE_DONE) {
+                EVLOG_error << this->database->get_error_message();
+            }
+        }
+        insert_stmt.reset();
+        transaction->commit();
+
+        const std::string select_query =
+            "SELECT c.NAME, c.EVSE_ID, c.CONNECTOR_ID, c.INSTANCE, v.NAME, v.INSTANCE, "
+            "va.VALUE, va.MUTABILITY_ID, va.PERSISTENT, va.CONSTANT, va.TYPE_ID "
+            "FROM REQUESTED_VARIABLE rv "
+            "JOIN COMPONENT c ON c.NAME = rv.COMPONENT_NAME AND c.INSTANCE IS rv.COMPONENT_INSTANCE "
+            "AND c.EVSE_ID IS rv.EVSE_ID AND c.CONNECTOR_ID IS rv.CONNECTOR_ID "
+            "JOIN VARIABLE v ON v.COMPONENT_ID = c.ID AND v.NAME = rv.VARIABLE_NAME "
+            "AND v.INSTANCE IS rv.VARIABLE_INSTANCE "
+            "JOIN VARIABLE_ATTRIBUTE va ON va.VARIABLE_ID = v.ID "
+            "ORDER BY va.VARIABLE_ID, va.ID";
+
+        auto select_stmt = this->database->new_statement(select_query);
+        while (select_stmt->step() == SQLITE_ROW) {
+            attributes.emplace_back(read_component(*select_stmt), read_variable(*select_stmt),
+                                    read_variable_attribute(*select_stmt, 6));
         }
-        attribute.mutability = static_cast<MutabilityEnum>(select_stmt.column_int(1));
-        attribute.persistent = static_cast<bool>(select_stmt.column_int(2));
-        attribute.constant = static_cast<bool>(select_stmt.column_int(3));
-        attribute.type = static_cast<AttributeEnum>(select_stmt.column_int(4));
-        attributes.push_back(attribute);
     }
 
-    return attributes;
+    // the attributes are only handed out once the lock is released, so on_attribute may write to the storage
+    for (const auto& [component, variable, attribute] : attributes) {
+        on_attribute(component, variable, attribute);
+    }
 }
 
 bool DeviceModelStorageSqlite::set_variable_attribute_value(const Component& component_id, const Variable& variable_id,
                                                             const AttributeEnum& attribute_enum,
                                                             const std::string& value) {
+    std::lock_guard<std::mutex> lk(this->write_mutex);
     std::string insert_query = "UPDATE VARIABLE_ATTRIBUTE SET VALUE = ? WHERE VARIABLE_ID = ? AND TYPE_ID = ?";
-    SQLiteStatement insert_stmt(this->db, insert_query);
+    auto insert_stmt = this->database->new_statement(insert_query);
 
     const auto _variable_id = this->get_variable_id(component_id, variable_id);
 
@@ -201,16 +361,56 @@ bool DeviceModelStorageSqlite::set_variable_attribute_value(const Component& com
         return false;
     }
 
-    insert_stmt.bind_text(1, value);
-    insert_stmt.bind_int(2, _variable_id);
-    insert_stmt.bind_int(3, static_cast<int>(attribute_enum));
-    if (insert_stmt.step() != SQLITE_DONE) {
-        EVLOG_error << sqlite3_errmsg(this->db);
+    insert_stmt->bind_text(1, value);
+    insert_stmt->bind_int(2, _variable_id);
+    insert_stmt->bind_int(3, static_cast<int>(attribute_enum));
+    if (insert_stmt->step() != SQLITE_DONE) {
+        EVLOG_error << this->database->get_error_message();
         return false;
     }
     return true;
 }
 
+std::vector<bool>
+DeviceModelStorageSqlite::set_variable_attribute_values(const std::vector<VariableAttributeValue>& values) {
+    std::vector<bool> results(values.size(), false);
+    if (values.empty()) {
+        return results;
+    }
+
+    std::lock_guard<std::mutex> lk(this->write_mutex);
+    try {
+        // all values are written in one transaction, so they only have to be synced to disk once. The transaction is
+        // rolled back if anything below throws
+        auto transaction = this->database->begin_transaction();
+        std::string update_query = "UPDATE VARIABLE_ATTRIBUTE SET VALUE = ? WHERE VARIABLE_ID = ? AND TYPE_ID = ?";
+        auto update_stmt = this->database->new_statement(update_query);
+        for (size_t i = 0; i < values.size(); i++) {
+            const auto& value = values.at(i);
+            const auto _variable_id = this->get_variable_id(value.component, value.variable);
+            if (_variable_id == -1) {
+                continue;
+            }
+
+            update_stmt->reset();
+            update_stmt->bind_text(1, value.value);
+            update_stmt->bind_int(2, _variable_id);
+            update_stmt->bind_int(3, static_cast<int>(value.attribute_enum));
+            if (update_stmt->step() != SQLITE_DONE) {
+                EVLOG_error << this->database->get_error_message();
+                continue;
+            }
+            results.at(i) = true;
+        }
+        update_stmt.reset();
+        transaction->commit();
+    } catch (const QueryExecutionException& e) {
+        EVLOG_error << "Could not set variable attribute values: " << e.what();
+        std::fill(results.begin(), results.end(), false);
+    }
+    return results;
+}
+
 void DeviceModelStorageSqlite::check_integrity() {
 
     // Check for required variables without actual values
@@ -227,18 +427,18 @@ void DeviceModelStorageSqlite::check_integrity() {
                  << static_cast<int>(AttributeEnum::Actual)
                  << " AND va.VALUE IS NULL"
                     " AND v.REQUIRED = 1";
-    SQLiteStatement select_stmt(this->db, query_stream.str());
+    auto select_stmt = this->database->new_statement(query_stream.str());
 
-    if (select_stmt.step() != SQLITE_DONE) {
+    if (select_stmt->step() != SQLITE_DONE) {
         std::stringstream error;
         error << "Corrupted device model: Missing the following required values for 'Actual' Variable Attributes:"
               << std::endl;
         do {
-            error << "(Component/EvseId/ConnectorId/Variable/Instance: " << select_stmt.column_text(0) << "/"
-                  << select_stmt.column_text_nullable(1).value_or("<null>") << "/"
-                  << select_stmt.column_text_nullable(2).value_or("<null>") << "/" << select_stmt.column_text(3) << "/"
-                  << select_stmt.column_text_nullable(4).value_or("<null>") << ")" << std::endl;
-        } while (select_stmt.step() == SQLITE_ROW);
+            error << "(Component/EvseId/ConnectorId/Variable/Instance: " << select_stmt->column_text(0) << "/"
+                  << select_stmt->column_text_nullable(1).value_or("<null>") << "/"
+                  << select_stmt->column_text_nullable(2).value_or("<null>") << "/" << select_stmt->column_text(3) << "/"
+                  << select_stmt->column_text_nullable(4).value_or("<null>") << ")" << std::endl;
+        } while (select_stmt->step() == SQLITE_ROW);
 
         throw DeviceModelStorageError(error.str());
     }
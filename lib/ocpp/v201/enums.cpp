@@ -9,7 +9,7 @@ namespace v201 {
 
 // from: AuthorizeRequest
 namespace conversions {
-std::string id_token_enum_to_string(IdTokenEnum e) {
+std::string_view id_token_enum_to_string(IdTokenEnum e) {
     switch (e) {
     case IdTokenEnum::Central:
         return "Central";
@@ -33,29 +33,59 @@ std::string id_token_enum_to_string(IdTokenEnum e) {
 }
 
 IdTokenEnum string_to_id_token_enum(const std::string& s) {
-    if (s == "Central") {
-        return IdTokenEnum::Central;
-    }
-    if (s == "eMAID") {
-        return IdTokenEnum::eMAID;
-    }
-    if (s == "ISO14443") {
-        return IdTokenEnum::ISO14443;
-    }
-    if (s == "ISO15693") {
-        return IdTokenEnum::ISO15693;
-    }
-    if (s == "KeyCode") {
-        return IdTokenEnum::KeyCode;
-    }
-    if (s == "Local") {
-        return IdTokenEnum::Local;
-    }
-    if (s == "MacAddress") {
-        return IdTokenEnum::MacAddress;
-    }
-    if (s == "NoAuthorization") {
-        return IdTokenEnum::NoAuthorization;
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'e':
+            if (s == "eMAID") {
+                return IdTokenEnum::eMAID;
+            }
+            break;
+        case 'L':
+            if (s == "Local") {
+                return IdTokenEnum::Local;
+            }
+            break;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Central") {
+                return IdTokenEnum::Central;
+            }
+            break;
+        case 'K':
+            if (s == "KeyCode") {
+                return IdTokenEnum::KeyCode;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[4]) {
+        case '4':
+            if (s == "ISO14443") {
+                return IdTokenEnum::ISO14443;
+            }
+            break;
+        case '5':
+            if (s == "ISO15693") {
+                return IdTokenEnum::ISO15693;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if (s == "MacAddress") {
+            return IdTokenEnum::MacAddress;
+        }
+        break;
+    case 15:
+        if (s == "NoAuthorization") {
+            return IdTokenEnum::NoAuthorization;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type IdTokenEnum");
@@ -69,7 +99,7 @@ std::ostream& operator<<(std::ostream& os, const IdTokenEnum& id_token_enum) {
 
 // from: AuthorizeRequest
 namespace conversions {
-std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e) {
+std::string_view hash_algorithm_enum_to_string(HashAlgorithmEnum e) {
     switch (e) {
     case HashAlgorithmEnum::SHA256:
         return "SHA256";
@@ -83,14 +113,26 @@ std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e) {
 }
 
 HashAlgorithmEnum string_to_hash_algorithm_enum(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnum::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnum::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnum::SHA512;
+    switch (s.size()) {
+    case 6:
+        switch (s[3]) {
+        case '2':
+            if (s == "SHA256") {
+                return HashAlgorithmEnum::SHA256;
+            }
+            break;
+        case '3':
+            if (s == "SHA384") {
+                return HashAlgorithmEnum::SHA384;
+            }
+            break;
+        case '5':
+            if (s == "SHA512") {
+                return HashAlgorithmEnum::SHA512;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type HashAlgorithmEnum");
@@ -104,7 +146,7 @@ std::ostream& operator<<(std::ostream& os, const HashAlgorithmEnum& hash_algorit
 
 // from: AuthorizeResponse
 namespace conversions {
-std::string authorization_status_enum_to_string(AuthorizationStatusEnum e) {
+std::string_view authorization_status_enum_to_string(AuthorizationStatusEnum e) {
     switch (e) {
     case AuthorizationStatusEnum::Accepted:
         return "Accepted";
@@ -132,35 +174,65 @@ std::string authorization_status_enum_to_string(AuthorizationStatusEnum e) {
 }
 
 AuthorizationStatusEnum string_to_authorization_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatusEnum::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatusEnum::Blocked;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatusEnum::ConcurrentTx;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatusEnum::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatusEnum::Invalid;
-    }
-    if (s == "NoCredit") {
-        return AuthorizationStatusEnum::NoCredit;
-    }
-    if (s == "NotAllowedTypeEVSE") {
-        return AuthorizationStatusEnum::NotAllowedTypeEVSE;
-    }
-    if (s == "NotAtThisLocation") {
-        return AuthorizationStatusEnum::NotAtThisLocation;
-    }
-    if (s == "NotAtThisTime") {
-        return AuthorizationStatusEnum::NotAtThisTime;
-    }
-    if (s == "Unknown") {
-        return AuthorizationStatusEnum::Unknown;
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'B':
+            if (s == "Blocked") {
+                return AuthorizationStatusEnum::Blocked;
+            }
+            break;
+        case 'E':
+            if (s == "Expired") {
+                return AuthorizationStatusEnum::Expired;
+            }
+            break;
+        case 'I':
+            if (s == "Invalid") {
+                return AuthorizationStatusEnum::Invalid;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return AuthorizationStatusEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return AuthorizationStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NoCredit") {
+                return AuthorizationStatusEnum::NoCredit;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatusEnum::ConcurrentTx;
+        }
+        break;
+    case 13:
+        if (s == "NotAtThisTime") {
+            return AuthorizationStatusEnum::NotAtThisTime;
+        }
+        break;
+    case 17:
+        if (s == "NotAtThisLocation") {
+            return AuthorizationStatusEnum::NotAtThisLocation;
+        }
+        break;
+    case 18:
+        if (s == "NotAllowedTypeEVSE") {
+            return AuthorizationStatusEnum::NotAllowedTypeEVSE;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type AuthorizationStatusEnum");
@@ -174,7 +246,7 @@ std::ostream& operator<<(std::ostream& os, const AuthorizationStatusEnum& author
 
 // from: AuthorizeResponse
 namespace conversions {
-std::string message_format_enum_to_string(MessageFormatEnum e) {
+std::string_view message_format_enum_to_string(MessageFormatEnum e) {
     switch (e) {
     case MessageFormatEnum::ASCII:
         return "ASCII";
@@ -190,17 +262,31 @@ std::string message_format_enum_to_string(MessageFormatEnum e) {
 }
 
 MessageFormatEnum string_to_message_format_enum(const std::string& s) {
-    if (s == "ASCII") {
-        return MessageFormatEnum::ASCII;
-    }
-    if (s == "HTML") {
-        return MessageFormatEnum::HTML;
-    }
-    if (s == "URI") {
-        return MessageFormatEnum::URI;
-    }
-    if (s == "UTF8") {
-        return MessageFormatEnum::UTF8;
+    switch (s.size()) {
+    case 3:
+        if (s == "URI") {
+            return MessageFormatEnum::URI;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'H':
+            if (s == "HTML") {
+                return MessageFormatEnum::HTML;
+            }
+            break;
+        case 'U':
+            if (s == "UTF8") {
+                return MessageFormatEnum::UTF8;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "ASCII") {
+            return MessageFormatEnum::ASCII;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageFormatEnum");
@@ -214,7 +300,7 @@ std::ostream& operator<<(std::ostream& os, const MessageFormatEnum& message_form
 
 // from: AuthorizeResponse
 namespace conversions {
-std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e) {
+std::string_view authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e) {
     switch (e) {
     case AuthorizeCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -236,26 +322,50 @@ std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStat
 }
 
 AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizeCertificateStatusEnum::Accepted;
-    }
-    if (s == "SignatureError") {
-        return AuthorizeCertificateStatusEnum::SignatureError;
-    }
-    if (s == "CertificateExpired") {
-        return AuthorizeCertificateStatusEnum::CertificateExpired;
-    }
-    if (s == "CertificateRevoked") {
-        return AuthorizeCertificateStatusEnum::CertificateRevoked;
-    }
-    if (s == "NoCertificateAvailable") {
-        return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
-    }
-    if (s == "CertChainError") {
-        return AuthorizeCertificateStatusEnum::CertChainError;
-    }
-    if (s == "ContractCancelled") {
-        return AuthorizeCertificateStatusEnum::ContractCancelled;
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizeCertificateStatusEnum::Accepted;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SignatureError") {
+                return AuthorizeCertificateStatusEnum::SignatureError;
+            }
+            break;
+        case 'C':
+            if (s == "CertChainError") {
+                return AuthorizeCertificateStatusEnum::CertChainError;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "ContractCancelled") {
+            return AuthorizeCertificateStatusEnum::ContractCancelled;
+        }
+        break;
+    case 18:
+        switch (s[11]) {
+        case 'E':
+            if (s == "CertificateExpired") {
+                return AuthorizeCertificateStatusEnum::CertificateExpired;
+            }
+            break;
+        case 'R':
+            if (s == "CertificateRevoked") {
+                return AuthorizeCertificateStatusEnum::CertificateRevoked;
+            }
+            break;
+        }
+        break;
+    case 22:
+        if (s == "NoCertificateAvailable") {
+            return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -270,7 +380,7 @@ std::ostream& operator<<(std::ostream& os, const AuthorizeCertificateStatusEnum&
 
 // from: BootNotificationRequest
 namespace conversions {
-std::string boot_reason_enum_to_string(BootReasonEnum e) {
+std::string_view boot_reason_enum_to_string(BootReasonEnum e) {
     switch (e) {
     case BootReasonEnum::ApplicationReset:
         return "ApplicationReset";
@@ -296,32 +406,60 @@ std::string boot_reason_enum_to_string(BootReasonEnum e) {
 }
 
 BootReasonEnum string_to_boot_reason_enum(const std::string& s) {
-    if (s == "ApplicationReset") {
-        return BootReasonEnum::ApplicationReset;
-    }
-    if (s == "FirmwareUpdate") {
-        return BootReasonEnum::FirmwareUpdate;
-    }
-    if (s == "LocalReset") {
-        return BootReasonEnum::LocalReset;
-    }
-    if (s == "PowerUp") {
-        return BootReasonEnum::PowerUp;
-    }
-    if (s == "RemoteReset") {
-        return BootReasonEnum::RemoteReset;
-    }
-    if (s == "ScheduledReset") {
-        return BootReasonEnum::ScheduledReset;
-    }
-    if (s == "Triggered") {
-        return BootReasonEnum::Triggered;
-    }
-    if (s == "Unknown") {
-        return BootReasonEnum::Unknown;
-    }
-    if (s == "Watchdog") {
-        return BootReasonEnum::Watchdog;
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'P':
+            if (s == "PowerUp") {
+                return BootReasonEnum::PowerUp;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return BootReasonEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "Watchdog") {
+            return BootReasonEnum::Watchdog;
+        }
+        break;
+    case 9:
+        if (s == "Triggered") {
+            return BootReasonEnum::Triggered;
+        }
+        break;
+    case 10:
+        if (s == "LocalReset") {
+            return BootReasonEnum::LocalReset;
+        }
+        break;
+    case 11:
+        if (s == "RemoteReset") {
+            return BootReasonEnum::RemoteReset;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareUpdate") {
+                return BootReasonEnum::FirmwareUpdate;
+            }
+            break;
+        case 'S':
+            if (s == "ScheduledReset") {
+                return BootReasonEnum::ScheduledReset;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "ApplicationReset") {
+            return BootReasonEnum::ApplicationReset;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type BootReasonEnum");
@@ -335,7 +473,7 @@ std::ostream& operator<<(std::ostream& os, const BootReasonEnum& boot_reason_enu
 
 // from: BootNotificationResponse
 namespace conversions {
-std::string registration_status_enum_to_string(RegistrationStatusEnum e) {
+std::string_view registration_status_enum_to_string(RegistrationStatusEnum e) {
     switch (e) {
     case RegistrationStatusEnum::Accepted:
         return "Accepted";
@@ -349,14 +487,26 @@ std::string registration_status_enum_to_string(RegistrationStatusEnum e) {
 }
 
 RegistrationStatusEnum string_to_registration_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatusEnum::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatusEnum::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatusEnum::Rejected;
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatusEnum::Pending;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RegistrationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RegistrationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type RegistrationStatusEnum");
@@ -370,7 +520,7 @@ std::ostream& operator<<(std::ostream& os, const RegistrationStatusEnum& registr
 
 // from: CancelReservationResponse
 namespace conversions {
-std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e) {
+std::string_view cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e) {
     switch (e) {
     case CancelReservationStatusEnum::Accepted:
         return "Accepted";
@@ -382,11 +532,21 @@ std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum
 }
 
 CancelReservationStatusEnum string_to_cancel_reservation_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CancelReservationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CancelReservationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -401,7 +561,7 @@ std::ostream& operator<<(std::ostream& os, const CancelReservationStatusEnum& ca
 
 // from: CertificateSignedRequest
 namespace conversions {
-std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e) {
+std::string_view certificate_signing_use_enum_to_string(CertificateSigningUseEnum e) {
     switch (e) {
     case CertificateSigningUseEnum::ChargingStationCertificate:
         return "ChargingStationCertificate";
@@ -413,11 +573,17 @@ std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e)
 }
 
 CertificateSigningUseEnum string_to_certificate_signing_use_enum(const std::string& s) {
-    if (s == "ChargingStationCertificate") {
-        return CertificateSigningUseEnum::ChargingStationCertificate;
-    }
-    if (s == "V2GCertificate") {
-        return CertificateSigningUseEnum::V2GCertificate;
+    switch (s.size()) {
+    case 14:
+        if (s == "V2GCertificate") {
+            return CertificateSigningUseEnum::V2GCertificate;
+        }
+        break;
+    case 26:
+        if (s == "ChargingStationCertificate") {
+            return CertificateSigningUseEnum::ChargingStationCertificate;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -432,7 +598,7 @@ std::ostream& operator<<(std::ostream& os, const CertificateSigningUseEnum& cert
 
 // from: CertificateSignedResponse
 namespace conversions {
-std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e) {
+std::string_view certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e) {
     switch (e) {
     case CertificateSignedStatusEnum::Accepted:
         return "Accepted";
@@ -444,11 +610,21 @@ std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum
 }
 
 CertificateSignedStatusEnum string_to_certificate_signed_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CertificateSignedStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CertificateSignedStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -463,7 +639,7 @@ std::ostream& operator<<(std::ostream& os, const CertificateSignedStatusEnum& ce
 
 // from: ChangeAvailabilityRequest
 namespace conversions {
-std::string operational_status_enum_to_string(OperationalStatusEnum e) {
+std::string_view operational_status_enum_to_string(OperationalStatusEnum e) {
     switch (e) {
     case OperationalStatusEnum::Inoperative:
         return "Inoperative";
@@ -475,11 +651,17 @@ std::string operational_status_enum_to_string(OperationalStatusEnum e) {
 }
 
 OperationalStatusEnum string_to_operational_status_enum(const std::string& s) {
-    if (s == "Inoperative") {
-        return OperationalStatusEnum::Inoperative;
-    }
-    if (s == "Operative") {
-        return OperationalStatusEnum::Operative;
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return OperationalStatusEnum::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return OperationalStatusEnum::Inoperative;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type OperationalStatusEnum");
@@ -493,7 +675,7 @@ std::ostream& operator<<(std::ostream& os, const OperationalStatusEnum& operatio
 
 // from: ChangeAvailabilityResponse
 namespace conversions {
-std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e) {
+std::string_view change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e) {
     switch (e) {
     case ChangeAvailabilityStatusEnum::Accepted:
         return "Accepted";
@@ -507,14 +689,26 @@ std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEn
 }
 
 ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChangeAvailabilityStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChangeAvailabilityStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ChangeAvailabilityStatusEnum::Scheduled;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChangeAvailabilityStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChangeAvailabilityStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ChangeAvailabilityStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -529,7 +723,7 @@ std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityStatusEnum& c
 
 // from: ClearCacheResponse
 namespace conversions {
-std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e) {
+std::string_view clear_cache_status_enum_to_string(ClearCacheStatusEnum e) {
     switch (e) {
     case ClearCacheStatusEnum::Accepted:
         return "Accepted";
@@ -541,11 +735,21 @@ std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e) {
 }
 
 ClearCacheStatusEnum string_to_clear_cache_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearCacheStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearCacheStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ClearCacheStatusEnum");
@@ -559,7 +763,7 @@ std::ostream& operator<<(std::ostream& os, const ClearCacheStatusEnum& clear_cac
 
 // from: ClearChargingProfileRequest
 namespace conversions {
-std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e) {
+std::string_view charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e) {
     switch (e) {
     case ChargingProfilePurposeEnum::ChargingStationExternalConstraints:
         return "ChargingStationExternalConstraints";
@@ -575,17 +779,27 @@ std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e
 }
 
 ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(const std::string& s) {
-    if (s == "ChargingStationExternalConstraints") {
-        return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
-    }
-    if (s == "ChargingStationMaxProfile") {
-        return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeEnum::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeEnum::TxProfile;
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeEnum::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeEnum::TxDefaultProfile;
+        }
+        break;
+    case 25:
+        if (s == "ChargingStationMaxProfile") {
+            return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
+        }
+        break;
+    case 34:
+        if (s == "ChargingStationExternalConstraints") {
+            return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -600,7 +814,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfilePurposeEnum& cha
 
 // from: ClearChargingProfileResponse
 namespace conversions {
-std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e) {
+std::string_view clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e) {
     switch (e) {
     case ClearChargingProfileStatusEnum::Accepted:
         return "Accepted";
@@ -612,11 +826,17 @@ std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileSta
 }
 
 ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatusEnum::Unknown;
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -631,7 +851,7 @@ std::ostream& operator<<(std::ostream& os, const ClearChargingProfileStatusEnum&
 
 // from: ClearDisplayMessageResponse
 namespace conversions {
-std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e) {
+std::string_view clear_message_status_enum_to_string(ClearMessageStatusEnum e) {
     switch (e) {
     case ClearMessageStatusEnum::Accepted:
         return "Accepted";
@@ -643,11 +863,17 @@ std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e) {
 }
 
 ClearMessageStatusEnum string_to_clear_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMessageStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearMessageStatusEnum::Unknown;
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearMessageStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearMessageStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ClearMessageStatusEnum");
@@ -661,7 +887,7 @@ std::ostream& operator<<(std::ostream& os, const ClearMessageStatusEnum& clear_m
 
 // from: ClearVariableMonitoringResponse
 namespace conversions {
-std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e) {
+std::string_view clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e) {
     switch (e) {
     case ClearMonitoringStatusEnum::Accepted:
         return "Accepted";
@@ -675,14 +901,26 @@ std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e)
 }
 
 ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMonitoringStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearMonitoringStatusEnum::Rejected;
-    }
-    if (s == "NotFound") {
-        return ClearMonitoringStatusEnum::NotFound;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearMonitoringStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearMonitoringStatusEnum::Rejected;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return ClearMonitoringStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -697,7 +935,7 @@ std::ostream& operator<<(std::ostream& os, const ClearMonitoringStatusEnum& clea
 
 // from: ClearedChargingLimitRequest
 namespace conversions {
-std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e) {
+std::string_view charging_limit_source_enum_to_string(ChargingLimitSourceEnum e) {
     switch (e) {
     case ChargingLimitSourceEnum::EMS:
         return "EMS";
@@ -713,17 +951,31 @@ std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e) {
 }
 
 ChargingLimitSourceEnum string_to_charging_limit_source_enum(const std::string& s) {
-    if (s == "EMS") {
-        return ChargingLimitSourceEnum::EMS;
-    }
-    if (s == "Other") {
-        return ChargingLimitSourceEnum::Other;
-    }
-    if (s == "SO") {
-        return ChargingLimitSourceEnum::SO;
-    }
-    if (s == "CSO") {
-        return ChargingLimitSourceEnum::CSO;
+    switch (s.size()) {
+    case 2:
+        if (s == "SO") {
+            return ChargingLimitSourceEnum::SO;
+        }
+        break;
+    case 3:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EMS") {
+                return ChargingLimitSourceEnum::EMS;
+            }
+            break;
+        case 'C':
+            if (s == "CSO") {
+                return ChargingLimitSourceEnum::CSO;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "Other") {
+            return ChargingLimitSourceEnum::Other;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingLimitSourceEnum");
@@ -737,7 +989,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingLimitSourceEnum& chargi
 
 // from: CustomerInformationResponse
 namespace conversions {
-std::string customer_information_status_enum_to_string(CustomerInformationStatusEnum e) {
+std::string_view customer_information_status_enum_to_string(CustomerInformationStatusEnum e) {
     switch (e) {
     case CustomerInformationStatusEnum::Accepted:
         return "Accepted";
@@ -751,14 +1003,26 @@ std::string customer_information_status_enum_to_string(CustomerInformationStatus
 }
 
 CustomerInformationStatusEnum string_to_customer_information_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CustomerInformationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CustomerInformationStatusEnum::Rejected;
-    }
-    if (s == "Invalid") {
-        return CustomerInformationStatusEnum::Invalid;
+    switch (s.size()) {
+    case 7:
+        if (s == "Invalid") {
+            return CustomerInformationStatusEnum::Invalid;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CustomerInformationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CustomerInformationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -773,7 +1037,7 @@ std::ostream& operator<<(std::ostream& os, const CustomerInformationStatusEnum&
 
 // from: DataTransferResponse
 namespace conversions {
-std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e) {
+std::string_view data_transfer_status_enum_to_string(DataTransferStatusEnum e) {
     switch (e) {
     case DataTransferStatusEnum::Accepted:
         return "Accepted";
@@ -789,17 +1053,31 @@ std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e) {
 }
 
 DataTransferStatusEnum string_to_data_transfer_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatusEnum::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatusEnum::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatusEnum::UnknownVendorId;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DataTransferStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DataTransferStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatusEnum::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatusEnum::UnknownMessageId;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type DataTransferStatusEnum");
@@ -813,7 +1091,7 @@ std::ostream& operator<<(std::ostream& os, const DataTransferStatusEnum& data_tr
 
 // from: DeleteCertificateResponse
 namespace conversions {
-std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e) {
+std::string_view delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e) {
     switch (e) {
     case DeleteCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -827,14 +1105,26 @@ std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum
 }
 
 DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnum::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnum::NotFound;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DeleteCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return DeleteCertificateStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -849,7 +1139,7 @@ std::ostream& operator<<(std::ostream& os, const DeleteCertificateStatusEnum& de
 
 // from: FirmwareStatusNotificationRequest
 namespace conversions {
-std::string firmware_status_enum_to_string(FirmwareStatusEnum e) {
+std::string_view firmware_status_enum_to_string(FirmwareStatusEnum e) {
     switch (e) {
     case FirmwareStatusEnum::Downloaded:
         return "Downloaded";
@@ -885,47 +1175,93 @@ std::string firmware_status_enum_to_string(FirmwareStatusEnum e) {
 }
 
 FirmwareStatusEnum string_to_firmware_status_enum(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnum::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnum::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnum::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnum::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnum::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnum::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnum::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnum::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnum::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnum::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnum::SignatureVerified;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnum::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatusEnum::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatusEnum::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return FirmwareStatusEnum::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return FirmwareStatusEnum::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[8]) {
+        case 'e':
+            if (s == "InstallRebooting") {
+                return FirmwareStatusEnum::InstallRebooting;
+            }
+            break;
+        case 'c':
+            if (s == "InstallScheduled") {
+                return FirmwareStatusEnum::InstallScheduled;
+            }
+            break;
+        case 'i':
+            if (s == "InvalidSignature") {
+                return FirmwareStatusEnum::InvalidSignature;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DownloadScheduled") {
+                return FirmwareStatusEnum::DownloadScheduled;
+            }
+            break;
+        case 'S':
+            if (s == "SignatureVerified") {
+                return FirmwareStatusEnum::SignatureVerified;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnum::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnum::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type FirmwareStatusEnum");
@@ -939,7 +1275,7 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatusEnum& firmware_st
 
 // from: Get15118EVCertificateRequest
 namespace conversions {
-std::string certificate_action_enum_to_string(CertificateActionEnum e) {
+std::string_view certificate_action_enum_to_string(CertificateActionEnum e) {
     switch (e) {
     case CertificateActionEnum::Install:
         return "Install";
@@ -951,11 +1287,17 @@ std::string certificate_action_enum_to_string(CertificateActionEnum e) {
 }
 
 CertificateActionEnum string_to_certificate_action_enum(const std::string& s) {
-    if (s == "Install") {
-        return CertificateActionEnum::Install;
-    }
-    if (s == "Update") {
-        return CertificateActionEnum::Update;
+    switch (s.size()) {
+    case 6:
+        if (s == "Update") {
+            return CertificateActionEnum::Update;
+        }
+        break;
+    case 7:
+        if (s == "Install") {
+            return CertificateActionEnum::Install;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type CertificateActionEnum");
@@ -969,7 +1311,7 @@ std::ostream& operator<<(std::ostream& os, const CertificateActionEnum& certific
 
 // from: Get15118EVCertificateResponse
 namespace conversions {
-std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e) {
+std::string_view iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e) {
     switch (e) {
     case Iso15118EVCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -981,11 +1323,17 @@ std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateSta
 }
 
 Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return Iso15118EVCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return Iso15118EVCertificateStatusEnum::Failed;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return Iso15118EVCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return Iso15118EVCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1000,7 +1348,7 @@ std::ostream& operator<<(std::ostream& os, const Iso15118EVCertificateStatusEnum
 
 // from: GetBaseReportRequest
 namespace conversions {
-std::string report_base_enum_to_string(ReportBaseEnum e) {
+std::string_view report_base_enum_to_string(ReportBaseEnum e) {
     switch (e) {
     case ReportBaseEnum::ConfigurationInventory:
         return "ConfigurationInventory";
@@ -1014,14 +1362,22 @@ std::string report_base_enum_to_string(ReportBaseEnum e) {
 }
 
 ReportBaseEnum string_to_report_base_enum(const std::string& s) {
-    if (s == "ConfigurationInventory") {
-        return ReportBaseEnum::ConfigurationInventory;
-    }
-    if (s == "FullInventory") {
-        return ReportBaseEnum::FullInventory;
-    }
-    if (s == "SummaryInventory") {
-        return ReportBaseEnum::SummaryInventory;
+    switch (s.size()) {
+    case 13:
+        if (s == "FullInventory") {
+            return ReportBaseEnum::FullInventory;
+        }
+        break;
+    case 16:
+        if (s == "SummaryInventory") {
+            return ReportBaseEnum::SummaryInventory;
+        }
+        break;
+    case 22:
+        if (s == "ConfigurationInventory") {
+            return ReportBaseEnum::ConfigurationInventory;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReportBaseEnum");
@@ -1035,7 +1391,7 @@ std::ostream& operator<<(std::ostream& os, const ReportBaseEnum& report_base_enu
 
 // from: GetBaseReportResponse
 namespace conversions {
-std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e) {
+std::string_view generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e) {
     switch (e) {
     case GenericDeviceModelStatusEnum::Accepted:
         return "Accepted";
@@ -1051,17 +1407,31 @@ std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusE
 }
 
 GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericDeviceModelStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericDeviceModelStatusEnum::Rejected;
-    }
-    if (s == "NotSupported") {
-        return GenericDeviceModelStatusEnum::NotSupported;
-    }
-    if (s == "EmptyResultSet") {
-        return GenericDeviceModelStatusEnum::EmptyResultSet;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericDeviceModelStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericDeviceModelStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return GenericDeviceModelStatusEnum::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "EmptyResultSet") {
+            return GenericDeviceModelStatusEnum::EmptyResultSet;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1076,7 +1446,7 @@ std::ostream& operator<<(std::ostream& os, const GenericDeviceModelStatusEnum& g
 
 // from: GetCertificateStatusResponse
 namespace conversions {
-std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e) {
+std::string_view get_certificate_status_enum_to_string(GetCertificateStatusEnum e) {
     switch (e) {
     case GetCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -1088,11 +1458,17 @@ std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e) {
 }
 
 GetCertificateStatusEnum string_to_get_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return GetCertificateStatusEnum::Failed;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return GetCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1107,7 +1483,7 @@ std::ostream& operator<<(std::ostream& os, const GetCertificateStatusEnum& get_c
 
 // from: GetChargingProfilesResponse
 namespace conversions {
-std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e) {
+std::string_view get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e) {
     switch (e) {
     case GetChargingProfileStatusEnum::Accepted:
         return "Accepted";
@@ -1119,11 +1495,17 @@ std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusE
 }
 
 GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "NoProfiles") {
-        return GetChargingProfileStatusEnum::NoProfiles;
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetChargingProfileStatusEnum::Accepted;
+        }
+        break;
+    case 10:
+        if (s == "NoProfiles") {
+            return GetChargingProfileStatusEnum::NoProfiles;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1138,7 +1520,7 @@ std::ostream& operator<<(std::ostream& os, const GetChargingProfileStatusEnum& g
 
 // from: GetCompositeScheduleRequest
 namespace conversions {
-std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e) {
+std::string_view charging_rate_unit_enum_to_string(ChargingRateUnitEnum e) {
     switch (e) {
     case ChargingRateUnitEnum::W:
         return "W";
@@ -1150,11 +1532,21 @@ std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e) {
 }
 
 ChargingRateUnitEnum string_to_charging_rate_unit_enum(const std::string& s) {
-    if (s == "W") {
-        return ChargingRateUnitEnum::W;
-    }
-    if (s == "A") {
-        return ChargingRateUnitEnum::A;
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'W':
+            if (s == "W") {
+                return ChargingRateUnitEnum::W;
+            }
+            break;
+        case 'A':
+            if (s == "A") {
+                return ChargingRateUnitEnum::A;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingRateUnitEnum");
@@ -1168,7 +1560,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingRateUnitEnum& charging_
 
 // from: GetCompositeScheduleResponse
 namespace conversions {
-std::string generic_status_enum_to_string(GenericStatusEnum e) {
+std::string_view generic_status_enum_to_string(GenericStatusEnum e) {
     switch (e) {
     case GenericStatusEnum::Accepted:
         return "Accepted";
@@ -1180,11 +1572,21 @@ std::string generic_status_enum_to_string(GenericStatusEnum e) {
 }
 
 GenericStatusEnum string_to_generic_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type GenericStatusEnum");
@@ -1198,7 +1600,7 @@ std::ostream& operator<<(std::ostream& os, const GenericStatusEnum& generic_stat
 
 // from: GetDisplayMessagesRequest
 namespace conversions {
-std::string message_priority_enum_to_string(MessagePriorityEnum e) {
+std::string_view message_priority_enum_to_string(MessagePriorityEnum e) {
     switch (e) {
     case MessagePriorityEnum::AlwaysFront:
         return "AlwaysFront";
@@ -1212,14 +1614,26 @@ std::string message_priority_enum_to_string(MessagePriorityEnum e) {
 }
 
 MessagePriorityEnum string_to_message_priority_enum(const std::string& s) {
-    if (s == "AlwaysFront") {
-        return MessagePriorityEnum::AlwaysFront;
-    }
-    if (s == "InFront") {
-        return MessagePriorityEnum::InFront;
-    }
-    if (s == "NormalCycle") {
-        return MessagePriorityEnum::NormalCycle;
+    switch (s.size()) {
+    case 7:
+        if (s == "InFront") {
+            return MessagePriorityEnum::InFront;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'A':
+            if (s == "AlwaysFront") {
+                return MessagePriorityEnum::AlwaysFront;
+            }
+            break;
+        case 'N':
+            if (s == "NormalCycle") {
+                return MessagePriorityEnum::NormalCycle;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessagePriorityEnum");
@@ -1233,7 +1647,7 @@ std::ostream& operator<<(std::ostream& os, const MessagePriorityEnum& message_pr
 
 // from: GetDisplayMessagesRequest
 namespace conversions {
-std::string message_state_enum_to_string(MessageStateEnum e) {
+std::string_view message_state_enum_to_string(MessageStateEnum e) {
     switch (e) {
     case MessageStateEnum::Charging:
         return "Charging";
@@ -1249,17 +1663,27 @@ std::string message_state_enum_to_string(MessageStateEnum e) {
 }
 
 MessageStateEnum string_to_message_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return MessageStateEnum::Charging;
-    }
-    if (s == "Faulted") {
-        return MessageStateEnum::Faulted;
-    }
-    if (s == "Idle") {
-        return MessageStateEnum::Idle;
-    }
-    if (s == "Unavailable") {
-        return MessageStateEnum::Unavailable;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return MessageStateEnum::Idle;
+        }
+        break;
+    case 7:
+        if (s == "Faulted") {
+            return MessageStateEnum::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return MessageStateEnum::Charging;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return MessageStateEnum::Unavailable;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageStateEnum");
@@ -1273,7 +1697,7 @@ std::ostream& operator<<(std::ostream& os, const MessageStateEnum& message_state
 
 // from: GetDisplayMessagesResponse
 namespace conversions {
-std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e) {
+std::string_view get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e) {
     switch (e) {
     case GetDisplayMessagesStatusEnum::Accepted:
         return "Accepted";
@@ -1285,11 +1709,17 @@ std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusE
 }
 
 GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetDisplayMessagesStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return GetDisplayMessagesStatusEnum::Unknown;
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return GetDisplayMessagesStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetDisplayMessagesStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1304,7 +1734,7 @@ std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesStatusEnum& g
 
 // from: GetInstalledCertificateIdsRequest
 namespace conversions {
-std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e) {
+std::string_view get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e) {
     switch (e) {
     case GetCertificateIdUseEnum::V2GRootCertificate:
         return "V2GRootCertificate";
@@ -1322,20 +1752,36 @@ std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e) {
 }
 
 GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return GetCertificateIdUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return GetCertificateIdUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return GetCertificateIdUseEnum::CSMSRootCertificate;
-    }
-    if (s == "V2GCertificateChain") {
-        return GetCertificateIdUseEnum::V2GCertificateChain;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return GetCertificateIdUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return GetCertificateIdUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CSMSRootCertificate") {
+                return GetCertificateIdUseEnum::CSMSRootCertificate;
+            }
+            break;
+        case 'V':
+            if (s == "V2GCertificateChain") {
+                return GetCertificateIdUseEnum::V2GCertificateChain;
+            }
+            break;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type GetCertificateIdUseEnum");
@@ -1349,7 +1795,7 @@ std::ostream& operator<<(std::ostream& os, const GetCertificateIdUseEnum& get_ce
 
 // from: GetInstalledCertificateIdsResponse
 namespace conversions {
-std::string get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e) {
+std::string_view get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e) {
     switch (e) {
     case GetInstalledCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -1361,11 +1807,21 @@ std::string get_installed_certificate_status_enum_to_string(GetInstalledCertific
 }
 
 GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnum::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnum::NotFound;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetInstalledCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return GetInstalledCertificateStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1381,7 +1837,7 @@ std::ostream& operator<<(std::ostream& os,
 
 // from: GetLogRequest
 namespace conversions {
-std::string log_enum_to_string(LogEnum e) {
+std::string_view log_enum_to_string(LogEnum e) {
     switch (e) {
     case LogEnum::DiagnosticsLog:
         return "DiagnosticsLog";
@@ -1393,11 +1849,17 @@ std::string log_enum_to_string(LogEnum e) {
 }
 
 LogEnum string_to_log_enum(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnum::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnum::SecurityLog;
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnum::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnum::DiagnosticsLog;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type LogEnum");
@@ -1411,7 +1873,7 @@ std::ostream& operator<<(std::ostream& os, const LogEnum& log_enum) {
 
 // from: GetLogResponse
 namespace conversions {
-std::string log_status_enum_to_string(LogStatusEnum e) {
+std::string_view log_status_enum_to_string(LogStatusEnum e) {
     switch (e) {
     case LogStatusEnum::Accepted:
         return "Accepted";
@@ -1425,14 +1887,26 @@ std::string log_status_enum_to_string(LogStatusEnum e) {
 }
 
 LogStatusEnum string_to_log_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnum::AcceptedCanceled;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return LogStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return LogStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnum::AcceptedCanceled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type LogStatusEnum");
@@ -1446,7 +1920,7 @@ std::ostream& operator<<(std::ostream& os, const LogStatusEnum& log_status_enum)
 
 // from: GetMonitoringReportRequest
 namespace conversions {
-std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e) {
+std::string_view monitoring_criterion_enum_to_string(MonitoringCriterionEnum e) {
     switch (e) {
     case MonitoringCriterionEnum::ThresholdMonitoring:
         return "ThresholdMonitoring";
@@ -1460,14 +1934,22 @@ std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e) {
 }
 
 MonitoringCriterionEnum string_to_monitoring_criterion_enum(const std::string& s) {
-    if (s == "ThresholdMonitoring") {
-        return MonitoringCriterionEnum::ThresholdMonitoring;
-    }
-    if (s == "DeltaMonitoring") {
-        return MonitoringCriterionEnum::DeltaMonitoring;
-    }
-    if (s == "PeriodicMonitoring") {
-        return MonitoringCriterionEnum::PeriodicMonitoring;
+    switch (s.size()) {
+    case 15:
+        if (s == "DeltaMonitoring") {
+            return MonitoringCriterionEnum::DeltaMonitoring;
+        }
+        break;
+    case 18:
+        if (s == "PeriodicMonitoring") {
+            return MonitoringCriterionEnum::PeriodicMonitoring;
+        }
+        break;
+    case 19:
+        if (s == "ThresholdMonitoring") {
+            return MonitoringCriterionEnum::ThresholdMonitoring;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MonitoringCriterionEnum");
@@ -1481,7 +1963,7 @@ std::ostream& operator<<(std::ostream& os, const MonitoringCriterionEnum& monito
 
 // from: GetReportRequest
 namespace conversions {
-std::string component_criterion_enum_to_string(ComponentCriterionEnum e) {
+std::string_view component_criterion_enum_to_string(ComponentCriterionEnum e) {
     switch (e) {
     case ComponentCriterionEnum::Active:
         return "Active";
@@ -1497,17 +1979,31 @@ std::string component_criterion_enum_to_string(ComponentCriterionEnum e) {
 }
 
 ComponentCriterionEnum string_to_component_criterion_enum(const std::string& s) {
-    if (s == "Active") {
-        return ComponentCriterionEnum::Active;
-    }
-    if (s == "Available") {
-        return ComponentCriterionEnum::Available;
-    }
-    if (s == "Enabled") {
-        return ComponentCriterionEnum::Enabled;
-    }
-    if (s == "Problem") {
-        return ComponentCriterionEnum::Problem;
+    switch (s.size()) {
+    case 6:
+        if (s == "Active") {
+            return ComponentCriterionEnum::Active;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'E':
+            if (s == "Enabled") {
+                return ComponentCriterionEnum::Enabled;
+            }
+            break;
+        case 'P':
+            if (s == "Problem") {
+                return ComponentCriterionEnum::Problem;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ComponentCriterionEnum::Available;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ComponentCriterionEnum");
@@ -1521,7 +2017,7 @@ std::ostream& operator<<(std::ostream& os, const ComponentCriterionEnum& compone
 
 // from: GetVariablesRequest
 namespace conversions {
-std::string attribute_enum_to_string(AttributeEnum e) {
+std::string_view attribute_enum_to_string(AttributeEnum e) {
     switch (e) {
     case AttributeEnum::Actual:
         return "Actual";
@@ -1537,17 +2033,31 @@ std::string attribute_enum_to_string(AttributeEnum e) {
 }
 
 AttributeEnum string_to_attribute_enum(const std::string& s) {
-    if (s == "Actual") {
-        return AttributeEnum::Actual;
-    }
-    if (s == "Target") {
-        return AttributeEnum::Target;
-    }
-    if (s == "MinSet") {
-        return AttributeEnum::MinSet;
-    }
-    if (s == "MaxSet") {
-        return AttributeEnum::MaxSet;
+    switch (s.size()) {
+    case 6:
+        switch (s[2]) {
+        case 't':
+            if (s == "Actual") {
+                return AttributeEnum::Actual;
+            }
+            break;
+        case 'r':
+            if (s == "Target") {
+                return AttributeEnum::Target;
+            }
+            break;
+        case 'n':
+            if (s == "MinSet") {
+                return AttributeEnum::MinSet;
+            }
+            break;
+        case 'x':
+            if (s == "MaxSet") {
+                return AttributeEnum::MaxSet;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type AttributeEnum");
@@ -1561,7 +2071,7 @@ std::ostream& operator<<(std::ostream& os, const AttributeEnum& attribute_enum)
 
 // from: GetVariablesResponse
 namespace conversions {
-std::string get_variable_status_enum_to_string(GetVariableStatusEnum e) {
+std::string_view get_variable_status_enum_to_string(GetVariableStatusEnum e) {
     switch (e) {
     case GetVariableStatusEnum::Accepted:
         return "Accepted";
@@ -1579,20 +2089,36 @@ std::string get_variable_status_enum_to_string(GetVariableStatusEnum e) {
 }
 
 GetVariableStatusEnum string_to_get_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return GetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return GetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return GetVariableStatusEnum::NotSupportedAttributeType;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetVariableStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GetVariableStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return GetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return GetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return GetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type GetVariableStatusEnum");
@@ -1606,7 +2132,7 @@ std::ostream& operator<<(std::ostream& os, const GetVariableStatusEnum& get_vari
 
 // from: InstallCertificateRequest
 namespace conversions {
-std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e) {
+std::string_view install_certificate_use_enum_to_string(InstallCertificateUseEnum e) {
     switch (e) {
     case InstallCertificateUseEnum::V2GRootCertificate:
         return "V2GRootCertificate";
@@ -1622,17 +2148,27 @@ std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e)
 }
 
 InstallCertificateUseEnum string_to_install_certificate_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return InstallCertificateUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return InstallCertificateUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return InstallCertificateUseEnum::CSMSRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return InstallCertificateUseEnum::ManufacturerRootCertificate;
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return InstallCertificateUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return InstallCertificateUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        if (s == "CSMSRootCertificate") {
+            return InstallCertificateUseEnum::CSMSRootCertificate;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return InstallCertificateUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1647,7 +2183,7 @@ std::ostream& operator<<(std::ostream& os, const InstallCertificateUseEnum& inst
 
 // from: InstallCertificateResponse
 namespace conversions {
-std::string install_certificate_status_enum_to_string(InstallCertificateStatusEnum e) {
+std::string_view install_certificate_status_enum_to_string(InstallCertificateStatusEnum e) {
     switch (e) {
     case InstallCertificateStatusEnum::Accepted:
         return "Accepted";
@@ -1661,14 +2197,26 @@ std::string install_certificate_status_enum_to_string(InstallCertificateStatusEn
 }
 
 InstallCertificateStatusEnum string_to_install_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnum::Failed;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return InstallCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return InstallCertificateStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -1683,7 +2231,7 @@ std::ostream& operator<<(std::ostream& os, const InstallCertificateStatusEnum& i
 
 // from: LogStatusNotificationRequest
 namespace conversions {
-std::string upload_log_status_enum_to_string(UploadLogStatusEnum e) {
+std::string_view upload_log_status_enum_to_string(UploadLogStatusEnum e) {
     switch (e) {
     case UploadLogStatusEnum::BadMessage:
         return "BadMessage";
@@ -1707,29 +2255,51 @@ std::string upload_log_status_enum_to_string(UploadLogStatusEnum e) {
 }
 
 UploadLogStatusEnum string_to_upload_log_status_enum(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnum::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnum::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnum::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnum::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnum::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnum::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnum::Uploading;
-    }
-    if (s == "AcceptedCanceled") {
-        return UploadLogStatusEnum::AcceptedCanceled;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnum::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnum::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnum::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnum::UploadFailure;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'P':
+            if (s == "PermissionDenied") {
+                return UploadLogStatusEnum::PermissionDenied;
+            }
+            break;
+        case 'A':
+            if (s == "AcceptedCanceled") {
+                return UploadLogStatusEnum::AcceptedCanceled;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnum::NotSupportedOperation;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UploadLogStatusEnum");
@@ -1743,7 +2313,7 @@ std::ostream& operator<<(std::ostream& os, const UploadLogStatusEnum& upload_log
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string reading_context_enum_to_string(ReadingContextEnum e) {
+std::string_view reading_context_enum_to_string(ReadingContextEnum e) {
     switch (e) {
     case ReadingContextEnum::Interruption_Begin:
         return "Interruption.Begin";
@@ -1767,29 +2337,51 @@ std::string reading_context_enum_to_string(ReadingContextEnum e) {
 }
 
 ReadingContextEnum string_to_reading_context_enum(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContextEnum::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContextEnum::Interruption_End;
-    }
-    if (s == "Other") {
-        return ReadingContextEnum::Other;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContextEnum::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContextEnum::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContextEnum::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContextEnum::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContextEnum::Trigger;
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContextEnum::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContextEnum::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContextEnum::Sample_Clock;
+        }
+        break;
+    case 15:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Sample.Periodic") {
+                return ReadingContextEnum::Sample_Periodic;
+            }
+            break;
+        case 'T':
+            if (s == "Transaction.End") {
+                return ReadingContextEnum::Transaction_End;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContextEnum::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContextEnum::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContextEnum::Interruption_Begin;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReadingContextEnum");
@@ -1803,7 +2395,7 @@ std::ostream& operator<<(std::ostream& os, const ReadingContextEnum& reading_con
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string measurand_enum_to_string(MeasurandEnum e) {
+std::string_view measurand_enum_to_string(MeasurandEnum e) {
     switch (e) {
     case MeasurandEnum::Current_Export:
         return "Current.Export";
@@ -1861,80 +2453,148 @@ std::string measurand_enum_to_string(MeasurandEnum e) {
 }
 
 MeasurandEnum string_to_measurand_enum(const std::string& s) {
-    if (s == "Current.Export") {
-        return MeasurandEnum::Current_Export;
-    }
-    if (s == "Current.Import") {
-        return MeasurandEnum::Current_Import;
-    }
-    if (s == "Current.Offered") {
-        return MeasurandEnum::Current_Offered;
-    }
-    if (s == "Energy.Active.Export.Register") {
-        return MeasurandEnum::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return MeasurandEnum::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return MeasurandEnum::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return MeasurandEnum::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return MeasurandEnum::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return MeasurandEnum::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Active.Net") {
-        return MeasurandEnum::Energy_Active_Net;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return MeasurandEnum::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return MeasurandEnum::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Net") {
-        return MeasurandEnum::Energy_Reactive_Net;
-    }
-    if (s == "Energy.Apparent.Net") {
-        return MeasurandEnum::Energy_Apparent_Net;
-    }
-    if (s == "Energy.Apparent.Import") {
-        return MeasurandEnum::Energy_Apparent_Import;
-    }
-    if (s == "Energy.Apparent.Export") {
-        return MeasurandEnum::Energy_Apparent_Export;
-    }
-    if (s == "Frequency") {
-        return MeasurandEnum::Frequency;
-    }
-    if (s == "Power.Active.Export") {
-        return MeasurandEnum::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return MeasurandEnum::Power_Active_Import;
-    }
-    if (s == "Power.Factor") {
-        return MeasurandEnum::Power_Factor;
-    }
-    if (s == "Power.Offered") {
-        return MeasurandEnum::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return MeasurandEnum::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return MeasurandEnum::Power_Reactive_Import;
-    }
-    if (s == "SoC") {
-        return MeasurandEnum::SoC;
-    }
-    if (s == "Voltage") {
-        return MeasurandEnum::Voltage;
+    switch (s.size()) {
+    case 3:
+        if (s == "SoC") {
+            return MeasurandEnum::SoC;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return MeasurandEnum::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return MeasurandEnum::Frequency;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return MeasurandEnum::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return MeasurandEnum::Power_Offered;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'E':
+            if (s == "Current.Export") {
+                return MeasurandEnum::Current_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Current.Import") {
+                return MeasurandEnum::Current_Import;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return MeasurandEnum::Current_Offered;
+        }
+        break;
+    case 17:
+        if (s == "Energy.Active.Net") {
+            return MeasurandEnum::Energy_Active_Net;
+        }
+        break;
+    case 19:
+        switch (s[13]) {
+        case 'v':
+            if (s == "Energy.Reactive.Net") {
+                return MeasurandEnum::Energy_Reactive_Net;
+            }
+            break;
+        case 'n':
+            if (s == "Energy.Apparent.Net") {
+                return MeasurandEnum::Energy_Apparent_Net;
+            }
+            break;
+        case 'E':
+            if (s == "Power.Active.Export") {
+                return MeasurandEnum::Power_Active_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Active.Import") {
+                return MeasurandEnum::Power_Active_Import;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[15]) {
+        case 'E':
+            if (s == "Power.Reactive.Export") {
+                return MeasurandEnum::Power_Reactive_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Reactive.Import") {
+                return MeasurandEnum::Power_Reactive_Import;
+            }
+            break;
+        }
+        break;
+    case 22:
+        switch (s[16]) {
+        case 'I':
+            if (s == "Energy.Apparent.Import") {
+                return MeasurandEnum::Energy_Apparent_Import;
+            }
+            break;
+        case 'E':
+            if (s == "Energy.Apparent.Export") {
+                return MeasurandEnum::Energy_Apparent_Export;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch (s[14]) {
+        case 'E':
+            if (s == "Energy.Active.Export.Register") {
+                return MeasurandEnum::Energy_Active_Export_Register;
+            }
+            if (s == "Energy.Active.Export.Interval") {
+                return MeasurandEnum::Energy_Active_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Active.Import.Register") {
+                return MeasurandEnum::Energy_Active_Import_Register;
+            }
+            if (s == "Energy.Active.Import.Interval") {
+                return MeasurandEnum::Energy_Active_Import_Interval;
+            }
+            break;
+        }
+        break;
+    case 31:
+        switch (s[16]) {
+        case 'E':
+            if (s == "Energy.Reactive.Export.Register") {
+                return MeasurandEnum::Energy_Reactive_Export_Register;
+            }
+            if (s == "Energy.Reactive.Export.Interval") {
+                return MeasurandEnum::Energy_Reactive_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Reactive.Import.Register") {
+                return MeasurandEnum::Energy_Reactive_Import_Register;
+            }
+            if (s == "Energy.Reactive.Import.Interval") {
+                return MeasurandEnum::Energy_Reactive_Import_Interval;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MeasurandEnum");
@@ -1948,7 +2608,7 @@ std::ostream& operator<<(std::ostream& os, const MeasurandEnum& measurand_enum)
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string phase_enum_to_string(PhaseEnum e) {
+std::string_view phase_enum_to_string(PhaseEnum e) {
     switch (e) {
     case PhaseEnum::L1:
         return "L1";
@@ -1976,35 +2636,69 @@ std::string phase_enum_to_string(PhaseEnum e) {
 }
 
 PhaseEnum string_to_phase_enum(const std::string& s) {
-    if (s == "L1") {
-        return PhaseEnum::L1;
-    }
-    if (s == "L2") {
-        return PhaseEnum::L2;
-    }
-    if (s == "L3") {
-        return PhaseEnum::L3;
-    }
-    if (s == "N") {
-        return PhaseEnum::N;
-    }
-    if (s == "L1-N") {
-        return PhaseEnum::L1_N;
-    }
-    if (s == "L2-N") {
-        return PhaseEnum::L2_N;
-    }
-    if (s == "L3-N") {
-        return PhaseEnum::L3_N;
-    }
-    if (s == "L1-L2") {
-        return PhaseEnum::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return PhaseEnum::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return PhaseEnum::L3_L1;
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return PhaseEnum::N;
+        }
+        break;
+    case 2:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1") {
+                return PhaseEnum::L1;
+            }
+            break;
+        case '2':
+            if (s == "L2") {
+                return PhaseEnum::L2;
+            }
+            break;
+        case '3':
+            if (s == "L3") {
+                return PhaseEnum::L3;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-N") {
+                return PhaseEnum::L1_N;
+            }
+            break;
+        case '2':
+            if (s == "L2-N") {
+                return PhaseEnum::L2_N;
+            }
+            break;
+        case '3':
+            if (s == "L3-N") {
+                return PhaseEnum::L3_N;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-L2") {
+                return PhaseEnum::L1_L2;
+            }
+            break;
+        case '2':
+            if (s == "L2-L3") {
+                return PhaseEnum::L2_L3;
+            }
+            break;
+        case '3':
+            if (s == "L3-L1") {
+                return PhaseEnum::L3_L1;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type PhaseEnum");
@@ -2018,7 +2712,7 @@ std::ostream& operator<<(std::ostream& os, const PhaseEnum& phase_enum) {
 
 // from: MeterValuesRequest
 namespace conversions {
-std::string location_enum_to_string(LocationEnum e) {
+std::string_view location_enum_to_string(LocationEnum e) {
     switch (e) {
     case LocationEnum::Body:
         return "Body";
@@ -2036,20 +2730,36 @@ std::string location_enum_to_string(LocationEnum e) {
 }
 
 LocationEnum string_to_location_enum(const std::string& s) {
-    if (s == "Body") {
-        return LocationEnum::Body;
-    }
-    if (s == "Cable") {
-        return LocationEnum::Cable;
-    }
-    if (s == "EV") {
-        return LocationEnum::EV;
-    }
-    if (s == "Inlet") {
-        return LocationEnum::Inlet;
-    }
-    if (s == "Outlet") {
-        return LocationEnum::Outlet;
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return LocationEnum::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return LocationEnum::Body;
+        }
+        break;
+    case 5:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Cable") {
+                return LocationEnum::Cable;
+            }
+            break;
+        case 'I':
+            if (s == "Inlet") {
+                return LocationEnum::Inlet;
+            }
+            break;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return LocationEnum::Outlet;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type LocationEnum");
@@ -2063,7 +2773,7 @@ std::ostream& operator<<(std::ostream& os, const LocationEnum& location_enum) {
 
 // from: NotifyChargingLimitRequest
 namespace conversions {
-std::string cost_kind_enum_to_string(CostKindEnum e) {
+std::string_view cost_kind_enum_to_string(CostKindEnum e) {
     switch (e) {
     case CostKindEnum::CarbonDioxideEmission:
         return "CarbonDioxideEmission";
@@ -2077,14 +2787,22 @@ std::string cost_kind_enum_to_string(CostKindEnum e) {
 }
 
 CostKindEnum string_to_cost_kind_enum(const std::string& s) {
-    if (s == "CarbonDioxideEmission") {
-        return CostKindEnum::CarbonDioxideEmission;
-    }
-    if (s == "RelativePricePercentage") {
-        return CostKindEnum::RelativePricePercentage;
-    }
-    if (s == "RenewableGenerationPercentage") {
-        return CostKindEnum::RenewableGenerationPercentage;
+    switch (s.size()) {
+    case 21:
+        if (s == "CarbonDioxideEmission") {
+            return CostKindEnum::CarbonDioxideEmission;
+        }
+        break;
+    case 23:
+        if (s == "RelativePricePercentage") {
+            return CostKindEnum::RelativePricePercentage;
+        }
+        break;
+    case 29:
+        if (s == "RenewableGenerationPercentage") {
+            return CostKindEnum::RenewableGenerationPercentage;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type CostKindEnum");
@@ -2098,7 +2816,7 @@ std::ostream& operator<<(std::ostream& os, const CostKindEnum& cost_kind_enum) {
 
 // from: NotifyEVChargingNeedsRequest
 namespace conversions {
-std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e) {
+std::string_view energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e) {
     switch (e) {
     case EnergyTransferModeEnum::DC:
         return "DC";
@@ -2114,17 +2832,27 @@ std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e) {
 }
 
 EnergyTransferModeEnum string_to_energy_transfer_mode_enum(const std::string& s) {
-    if (s == "DC") {
-        return EnergyTransferModeEnum::DC;
-    }
-    if (s == "AC_single_phase") {
-        return EnergyTransferModeEnum::AC_single_phase;
-    }
-    if (s == "AC_two_phase") {
-        return EnergyTransferModeEnum::AC_two_phase;
-    }
-    if (s == "AC_three_phase") {
-        return EnergyTransferModeEnum::AC_three_phase;
+    switch (s.size()) {
+    case 2:
+        if (s == "DC") {
+            return EnergyTransferModeEnum::DC;
+        }
+        break;
+    case 12:
+        if (s == "AC_two_phase") {
+            return EnergyTransferModeEnum::AC_two_phase;
+        }
+        break;
+    case 14:
+        if (s == "AC_three_phase") {
+            return EnergyTransferModeEnum::AC_three_phase;
+        }
+        break;
+    case 15:
+        if (s == "AC_single_phase") {
+            return EnergyTransferModeEnum::AC_single_phase;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type EnergyTransferModeEnum");
@@ -2138,7 +2866,7 @@ std::ostream& operator<<(std::ostream& os, const EnergyTransferModeEnum& energy_
 
 // from: NotifyEVChargingNeedsResponse
 namespace conversions {
-std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e) {
+std::string_view notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e) {
     switch (e) {
     case NotifyEVChargingNeedsStatusEnum::Accepted:
         return "Accepted";
@@ -2152,14 +2880,26 @@ std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsS
 }
 
 NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return NotifyEVChargingNeedsStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return NotifyEVChargingNeedsStatusEnum::Rejected;
-    }
-    if (s == "Processing") {
-        return NotifyEVChargingNeedsStatusEnum::Processing;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return NotifyEVChargingNeedsStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return NotifyEVChargingNeedsStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if (s == "Processing") {
+            return NotifyEVChargingNeedsStatusEnum::Processing;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2174,7 +2914,7 @@ std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsStatusEnum
 
 // from: NotifyEventRequest
 namespace conversions {
-std::string event_trigger_enum_to_string(EventTriggerEnum e) {
+std::string_view event_trigger_enum_to_string(EventTriggerEnum e) {
     switch (e) {
     case EventTriggerEnum::Alerting:
         return "Alerting";
@@ -2188,14 +2928,26 @@ std::string event_trigger_enum_to_string(EventTriggerEnum e) {
 }
 
 EventTriggerEnum string_to_event_trigger_enum(const std::string& s) {
-    if (s == "Alerting") {
-        return EventTriggerEnum::Alerting;
-    }
-    if (s == "Delta") {
-        return EventTriggerEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return EventTriggerEnum::Periodic;
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return EventTriggerEnum::Delta;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Alerting") {
+                return EventTriggerEnum::Alerting;
+            }
+            break;
+        case 'P':
+            if (s == "Periodic") {
+                return EventTriggerEnum::Periodic;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type EventTriggerEnum");
@@ -2209,7 +2961,7 @@ std::ostream& operator<<(std::ostream& os, const EventTriggerEnum& event_trigger
 
 // from: NotifyEventRequest
 namespace conversions {
-std::string event_notification_enum_to_string(EventNotificationEnum e) {
+std::string_view event_notification_enum_to_string(EventNotificationEnum e) {
     switch (e) {
     case EventNotificationEnum::HardWiredNotification:
         return "HardWiredNotification";
@@ -2225,17 +2977,27 @@ std::string event_notification_enum_to_string(EventNotificationEnum e) {
 }
 
 EventNotificationEnum string_to_event_notification_enum(const std::string& s) {
-    if (s == "HardWiredNotification") {
-        return EventNotificationEnum::HardWiredNotification;
-    }
-    if (s == "HardWiredMonitor") {
-        return EventNotificationEnum::HardWiredMonitor;
-    }
-    if (s == "PreconfiguredMonitor") {
-        return EventNotificationEnum::PreconfiguredMonitor;
-    }
-    if (s == "CustomMonitor") {
-        return EventNotificationEnum::CustomMonitor;
+    switch (s.size()) {
+    case 13:
+        if (s == "CustomMonitor") {
+            return EventNotificationEnum::CustomMonitor;
+        }
+        break;
+    case 16:
+        if (s == "HardWiredMonitor") {
+            return EventNotificationEnum::HardWiredMonitor;
+        }
+        break;
+    case 20:
+        if (s == "PreconfiguredMonitor") {
+            return EventNotificationEnum::PreconfiguredMonitor;
+        }
+        break;
+    case 21:
+        if (s == "HardWiredNotification") {
+            return EventNotificationEnum::HardWiredNotification;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type EventNotificationEnum");
@@ -2249,7 +3011,7 @@ std::ostream& operator<<(std::ostream& os, const EventNotificationEnum& event_no
 
 // from: NotifyMonitoringReportRequest
 namespace conversions {
-std::string monitor_enum_to_string(MonitorEnum e) {
+std::string_view monitor_enum_to_string(MonitorEnum e) {
     switch (e) {
     case MonitorEnum::UpperThreshold:
         return "UpperThreshold";
@@ -2267,20 +3029,36 @@ std::string monitor_enum_to_string(MonitorEnum e) {
 }
 
 MonitorEnum string_to_monitor_enum(const std::string& s) {
-    if (s == "UpperThreshold") {
-        return MonitorEnum::UpperThreshold;
-    }
-    if (s == "LowerThreshold") {
-        return MonitorEnum::LowerThreshold;
-    }
-    if (s == "Delta") {
-        return MonitorEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return MonitorEnum::Periodic;
-    }
-    if (s == "PeriodicClockAligned") {
-        return MonitorEnum::PeriodicClockAligned;
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return MonitorEnum::Delta;
+        }
+        break;
+    case 8:
+        if (s == "Periodic") {
+            return MonitorEnum::Periodic;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'U':
+            if (s == "UpperThreshold") {
+                return MonitorEnum::UpperThreshold;
+            }
+            break;
+        case 'L':
+            if (s == "LowerThreshold") {
+                return MonitorEnum::LowerThreshold;
+            }
+            break;
+        }
+        break;
+    case 20:
+        if (s == "PeriodicClockAligned") {
+            return MonitorEnum::PeriodicClockAligned;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MonitorEnum");
@@ -2294,7 +3072,7 @@ std::ostream& operator<<(std::ostream& os, const MonitorEnum& monitor_enum) {
 
 // from: NotifyReportRequest
 namespace conversions {
-std::string mutability_enum_to_string(MutabilityEnum e) {
+std::string_view mutability_enum_to_string(MutabilityEnum e) {
     switch (e) {
     case MutabilityEnum::ReadOnly:
         return "ReadOnly";
@@ -2308,14 +3086,26 @@ std::string mutability_enum_to_string(MutabilityEnum e) {
 }
 
 MutabilityEnum string_to_mutability_enum(const std::string& s) {
-    if (s == "ReadOnly") {
-        return MutabilityEnum::ReadOnly;
-    }
-    if (s == "WriteOnly") {
-        return MutabilityEnum::WriteOnly;
-    }
-    if (s == "ReadWrite") {
-        return MutabilityEnum::ReadWrite;
+    switch (s.size()) {
+    case 8:
+        if (s == "ReadOnly") {
+            return MutabilityEnum::ReadOnly;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'W':
+            if (s == "WriteOnly") {
+                return MutabilityEnum::WriteOnly;
+            }
+            break;
+        case 'R':
+            if (s == "ReadWrite") {
+                return MutabilityEnum::ReadWrite;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MutabilityEnum");
@@ -2329,7 +3119,7 @@ std::ostream& operator<<(std::ostream& os, const MutabilityEnum& mutability_enum
 
 // from: NotifyReportRequest
 namespace conversions {
-std::string data_enum_to_string(DataEnum e) {
+std::string_view data_enum_to_string(DataEnum e) {
     switch (e) {
     case DataEnum::string:
         return "string";
@@ -2353,29 +3143,55 @@ std::string data_enum_to_string(DataEnum e) {
 }
 
 DataEnum string_to_data_enum(const std::string& s) {
-    if (s == "string") {
-        return DataEnum::string;
-    }
-    if (s == "decimal") {
-        return DataEnum::decimal;
-    }
-    if (s == "integer") {
-        return DataEnum::integer;
-    }
-    if (s == "dateTime") {
-        return DataEnum::dateTime;
-    }
-    if (s == "boolean") {
-        return DataEnum::boolean;
-    }
-    if (s == "OptionList") {
-        return DataEnum::OptionList;
-    }
-    if (s == "SequenceList") {
-        return DataEnum::SequenceList;
-    }
-    if (s == "MemberList") {
-        return DataEnum::MemberList;
+    switch (s.size()) {
+    case 6:
+        if (s == "string") {
+            return DataEnum::string;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'd':
+            if (s == "decimal") {
+                return DataEnum::decimal;
+            }
+            break;
+        case 'i':
+            if (s == "integer") {
+                return DataEnum::integer;
+            }
+            break;
+        case 'b':
+            if (s == "boolean") {
+                return DataEnum::boolean;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "dateTime") {
+            return DataEnum::dateTime;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OptionList") {
+                return DataEnum::OptionList;
+            }
+            break;
+        case 'M':
+            if (s == "MemberList") {
+                return DataEnum::MemberList;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "SequenceList") {
+            return DataEnum::SequenceList;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type DataEnum");
@@ -2389,7 +3205,7 @@ std::ostream& operator<<(std::ostream& os, const DataEnum& data_enum) {
 
 // from: PublishFirmwareStatusNotificationRequest
 namespace conversions {
-std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e) {
+std::string_view publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e) {
     switch (e) {
     case PublishFirmwareStatusEnum::Idle:
         return "Idle";
@@ -2417,35 +3233,61 @@ std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e)
 }
 
 PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(const std::string& s) {
-    if (s == "Idle") {
-        return PublishFirmwareStatusEnum::Idle;
-    }
-    if (s == "DownloadScheduled") {
-        return PublishFirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "Downloading") {
-        return PublishFirmwareStatusEnum::Downloading;
-    }
-    if (s == "Downloaded") {
-        return PublishFirmwareStatusEnum::Downloaded;
-    }
-    if (s == "Published") {
-        return PublishFirmwareStatusEnum::Published;
-    }
-    if (s == "DownloadFailed") {
-        return PublishFirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "DownloadPaused") {
-        return PublishFirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "InvalidChecksum") {
-        return PublishFirmwareStatusEnum::InvalidChecksum;
-    }
-    if (s == "ChecksumVerified") {
-        return PublishFirmwareStatusEnum::ChecksumVerified;
-    }
-    if (s == "PublishFailed") {
-        return PublishFirmwareStatusEnum::PublishFailed;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return PublishFirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Published") {
+            return PublishFirmwareStatusEnum::Published;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return PublishFirmwareStatusEnum::Downloaded;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return PublishFirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 13:
+        if (s == "PublishFailed") {
+            return PublishFirmwareStatusEnum::PublishFailed;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return PublishFirmwareStatusEnum::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return PublishFirmwareStatusEnum::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "InvalidChecksum") {
+            return PublishFirmwareStatusEnum::InvalidChecksum;
+        }
+        break;
+    case 16:
+        if (s == "ChecksumVerified") {
+            return PublishFirmwareStatusEnum::ChecksumVerified;
+        }
+        break;
+    case 17:
+        if (s == "DownloadScheduled") {
+            return PublishFirmwareStatusEnum::DownloadScheduled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2460,7 +3302,7 @@ std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusEnum& publ
 
 // from: ReportChargingProfilesRequest
 namespace conversions {
-std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e) {
+std::string_view charging_profile_kind_enum_to_string(ChargingProfileKindEnum e) {
     switch (e) {
     case ChargingProfileKindEnum::Absolute:
         return "Absolute";
@@ -2474,14 +3316,26 @@ std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e) {
 }
 
 ChargingProfileKindEnum string_to_charging_profile_kind_enum(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindEnum::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindEnum::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindEnum::Relative;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Absolute") {
+                return ChargingProfileKindEnum::Absolute;
+            }
+            break;
+        case 'R':
+            if (s == "Relative") {
+                return ChargingProfileKindEnum::Relative;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindEnum::Recurring;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingProfileKindEnum");
@@ -2495,7 +3349,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileKindEnum& chargi
 
 // from: ReportChargingProfilesRequest
 namespace conversions {
-std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e) {
+std::string_view recurrency_kind_enum_to_string(RecurrencyKindEnum e) {
     switch (e) {
     case RecurrencyKindEnum::Daily:
         return "Daily";
@@ -2507,11 +3361,17 @@ std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e) {
 }
 
 RecurrencyKindEnum string_to_recurrency_kind_enum(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindEnum::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindEnum::Weekly;
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindEnum::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindEnum::Weekly;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type RecurrencyKindEnum");
@@ -2525,7 +3385,7 @@ std::ostream& operator<<(std::ostream& os, const RecurrencyKindEnum& recurrency_
 
 // from: RequestStartTransactionResponse
 namespace conversions {
-std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e) {
+std::string_view request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e) {
     switch (e) {
     case RequestStartStopStatusEnum::Accepted:
         return "Accepted";
@@ -2537,11 +3397,21 @@ std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum
 }
 
 RequestStartStopStatusEnum string_to_request_start_stop_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RequestStartStopStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return RequestStartStopStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RequestStartStopStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RequestStartStopStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2556,7 +3426,7 @@ std::ostream& operator<<(std::ostream& os, const RequestStartStopStatusEnum& req
 
 // from: ReservationStatusUpdateRequest
 namespace conversions {
-std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e) {
+std::string_view reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e) {
     switch (e) {
     case ReservationUpdateStatusEnum::Expired:
         return "Expired";
@@ -2568,11 +3438,21 @@ std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum
 }
 
 ReservationUpdateStatusEnum string_to_reservation_update_status_enum(const std::string& s) {
-    if (s == "Expired") {
-        return ReservationUpdateStatusEnum::Expired;
-    }
-    if (s == "Removed") {
-        return ReservationUpdateStatusEnum::Removed;
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'E':
+            if (s == "Expired") {
+                return ReservationUpdateStatusEnum::Expired;
+            }
+            break;
+        case 'R':
+            if (s == "Removed") {
+                return ReservationUpdateStatusEnum::Removed;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2587,7 +3467,7 @@ std::ostream& operator<<(std::ostream& os, const ReservationUpdateStatusEnum& re
 
 // from: ReserveNowRequest
 namespace conversions {
-std::string connector_enum_to_string(ConnectorEnum e) {
+std::string_view connector_enum_to_string(ConnectorEnum e) {
     switch (e) {
     case ConnectorEnum::cCCS1:
         return "cCCS1";
@@ -2639,71 +3519,131 @@ std::string connector_enum_to_string(ConnectorEnum e) {
 }
 
 ConnectorEnum string_to_connector_enum(const std::string& s) {
-    if (s == "cCCS1") {
-        return ConnectorEnum::cCCS1;
-    }
-    if (s == "cCCS2") {
-        return ConnectorEnum::cCCS2;
-    }
-    if (s == "cG105") {
-        return ConnectorEnum::cG105;
-    }
-    if (s == "cTesla") {
-        return ConnectorEnum::cTesla;
-    }
-    if (s == "cType1") {
-        return ConnectorEnum::cType1;
-    }
-    if (s == "cType2") {
-        return ConnectorEnum::cType2;
-    }
-    if (s == "s309-1P-16A") {
-        return ConnectorEnum::s309_1P_16A;
-    }
-    if (s == "s309-1P-32A") {
-        return ConnectorEnum::s309_1P_32A;
-    }
-    if (s == "s309-3P-16A") {
-        return ConnectorEnum::s309_3P_16A;
-    }
-    if (s == "s309-3P-32A") {
-        return ConnectorEnum::s309_3P_32A;
-    }
-    if (s == "sBS1361") {
-        return ConnectorEnum::sBS1361;
-    }
-    if (s == "sCEE-7-7") {
-        return ConnectorEnum::sCEE_7_7;
-    }
-    if (s == "sType2") {
-        return ConnectorEnum::sType2;
-    }
-    if (s == "sType3") {
-        return ConnectorEnum::sType3;
-    }
-    if (s == "Other1PhMax16A") {
-        return ConnectorEnum::Other1PhMax16A;
-    }
-    if (s == "Other1PhOver16A") {
-        return ConnectorEnum::Other1PhOver16A;
-    }
-    if (s == "Other3Ph") {
-        return ConnectorEnum::Other3Ph;
-    }
-    if (s == "Pan") {
-        return ConnectorEnum::Pan;
-    }
-    if (s == "wInductive") {
-        return ConnectorEnum::wInductive;
-    }
-    if (s == "wResonant") {
-        return ConnectorEnum::wResonant;
-    }
-    if (s == "Undetermined") {
-        return ConnectorEnum::Undetermined;
-    }
-    if (s == "Unknown") {
-        return ConnectorEnum::Unknown;
+    switch (s.size()) {
+    case 3:
+        if (s == "Pan") {
+            return ConnectorEnum::Pan;
+        }
+        break;
+    case 5:
+        switch (s[4]) {
+        case '1':
+            if (s == "cCCS1") {
+                return ConnectorEnum::cCCS1;
+            }
+            break;
+        case '2':
+            if (s == "cCCS2") {
+                return ConnectorEnum::cCCS2;
+            }
+            break;
+        case '5':
+            if (s == "cG105") {
+                return ConnectorEnum::cG105;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (s[5]) {
+        case 'a':
+            if (s == "cTesla") {
+                return ConnectorEnum::cTesla;
+            }
+            break;
+        case '1':
+            if (s == "cType1") {
+                return ConnectorEnum::cType1;
+            }
+            break;
+        case '2':
+            if (s == "cType2") {
+                return ConnectorEnum::cType2;
+            }
+            if (s == "sType2") {
+                return ConnectorEnum::sType2;
+            }
+            break;
+        case '3':
+            if (s == "sType3") {
+                return ConnectorEnum::sType3;
+            }
+            break;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 's':
+            if (s == "sBS1361") {
+                return ConnectorEnum::sBS1361;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return ConnectorEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 's':
+            if (s == "sCEE-7-7") {
+                return ConnectorEnum::sCEE_7_7;
+            }
+            break;
+        case 'O':
+            if (s == "Other3Ph") {
+                return ConnectorEnum::Other3Ph;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "wResonant") {
+            return ConnectorEnum::wResonant;
+        }
+        break;
+    case 10:
+        if (s == "wInductive") {
+            return ConnectorEnum::wInductive;
+        }
+        break;
+    case 11:
+        switch (s[5]) {
+        case '1':
+            if (s == "s309-1P-16A") {
+                return ConnectorEnum::s309_1P_16A;
+            }
+            if (s == "s309-1P-32A") {
+                return ConnectorEnum::s309_1P_32A;
+            }
+            break;
+        case '3':
+            if (s == "s309-3P-16A") {
+                return ConnectorEnum::s309_3P_16A;
+            }
+            if (s == "s309-3P-32A") {
+                return ConnectorEnum::s309_3P_32A;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "Undetermined") {
+            return ConnectorEnum::Undetermined;
+        }
+        break;
+    case 14:
+        if (s == "Other1PhMax16A") {
+            return ConnectorEnum::Other1PhMax16A;
+        }
+        break;
+    case 15:
+        if (s == "Other1PhOver16A") {
+            return ConnectorEnum::Other1PhOver16A;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ConnectorEnum");
@@ -2717,7 +3657,7 @@ std::ostream& operator<<(std::ostream& os, const ConnectorEnum& connector_enum)
 
 // from: ReserveNowResponse
 namespace conversions {
-std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e) {
+std::string_view reserve_now_status_enum_to_string(ReserveNowStatusEnum e) {
     switch (e) {
     case ReserveNowStatusEnum::Accepted:
         return "Accepted";
@@ -2735,20 +3675,36 @@ std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e) {
 }
 
 ReserveNowStatusEnum string_to_reserve_now_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ReserveNowStatusEnum::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReserveNowStatusEnum::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReserveNowStatusEnum::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReserveNowStatusEnum::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReserveNowStatusEnum::Unavailable;
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReserveNowStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ReserveNowStatusEnum::Accepted;
+            }
+            break;
+        case 'O':
+            if (s == "Occupied") {
+                return ReserveNowStatusEnum::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ReserveNowStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReserveNowStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReserveNowStatusEnum");
@@ -2762,7 +3718,7 @@ std::ostream& operator<<(std::ostream& os, const ReserveNowStatusEnum& reserve_n
 
 // from: ResetRequest
 namespace conversions {
-std::string reset_enum_to_string(ResetEnum e) {
+std::string_view reset_enum_to_string(ResetEnum e) {
     switch (e) {
     case ResetEnum::Immediate:
         return "Immediate";
@@ -2774,11 +3730,17 @@ std::string reset_enum_to_string(ResetEnum e) {
 }
 
 ResetEnum string_to_reset_enum(const std::string& s) {
-    if (s == "Immediate") {
-        return ResetEnum::Immediate;
-    }
-    if (s == "OnIdle") {
-        return ResetEnum::OnIdle;
+    switch (s.size()) {
+    case 6:
+        if (s == "OnIdle") {
+            return ResetEnum::OnIdle;
+        }
+        break;
+    case 9:
+        if (s == "Immediate") {
+            return ResetEnum::Immediate;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ResetEnum");
@@ -2792,7 +3754,7 @@ std::ostream& operator<<(std::ostream& os, const ResetEnum& reset_enum) {
 
 // from: ResetResponse
 namespace conversions {
-std::string reset_status_enum_to_string(ResetStatusEnum e) {
+std::string_view reset_status_enum_to_string(ResetStatusEnum e) {
     switch (e) {
     case ResetStatusEnum::Accepted:
         return "Accepted";
@@ -2806,14 +3768,26 @@ std::string reset_status_enum_to_string(ResetStatusEnum e) {
 }
 
 ResetStatusEnum string_to_reset_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ResetStatusEnum::Scheduled;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ResetStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ResetStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ResetStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ResetStatusEnum");
@@ -2827,7 +3801,7 @@ std::ostream& operator<<(std::ostream& os, const ResetStatusEnum& reset_status_e
 
 // from: SendLocalListRequest
 namespace conversions {
-std::string update_enum_to_string(UpdateEnum e) {
+std::string_view update_enum_to_string(UpdateEnum e) {
     switch (e) {
     case UpdateEnum::Differential:
         return "Differential";
@@ -2839,11 +3813,17 @@ std::string update_enum_to_string(UpdateEnum e) {
 }
 
 UpdateEnum string_to_update_enum(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateEnum::Differential;
-    }
-    if (s == "Full") {
-        return UpdateEnum::Full;
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateEnum::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateEnum::Differential;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UpdateEnum");
@@ -2857,7 +3837,7 @@ std::ostream& operator<<(std::ostream& os, const UpdateEnum& update_enum) {
 
 // from: SendLocalListResponse
 namespace conversions {
-std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e) {
+std::string_view send_local_list_status_enum_to_string(SendLocalListStatusEnum e) {
     switch (e) {
     case SendLocalListStatusEnum::Accepted:
         return "Accepted";
@@ -2871,14 +3851,22 @@ std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e) {
 }
 
 SendLocalListStatusEnum string_to_send_local_list_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SendLocalListStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return SendLocalListStatusEnum::Failed;
-    }
-    if (s == "VersionMismatch") {
-        return SendLocalListStatusEnum::VersionMismatch;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SendLocalListStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return SendLocalListStatusEnum::Accepted;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return SendLocalListStatusEnum::VersionMismatch;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type SendLocalListStatusEnum");
@@ -2892,7 +3880,7 @@ std::ostream& operator<<(std::ostream& os, const SendLocalListStatusEnum& send_l
 
 // from: SetChargingProfileResponse
 namespace conversions {
-std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e) {
+std::string_view charging_profile_status_enum_to_string(ChargingProfileStatusEnum e) {
     switch (e) {
     case ChargingProfileStatusEnum::Accepted:
         return "Accepted";
@@ -2904,11 +3892,21 @@ std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e)
 }
 
 ChargingProfileStatusEnum string_to_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatusEnum::Rejected;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChargingProfileStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChargingProfileStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2923,7 +3921,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileStatusEnum& char
 
 // from: SetDisplayMessageResponse
 namespace conversions {
-std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e) {
+std::string_view display_message_status_enum_to_string(DisplayMessageStatusEnum e) {
     switch (e) {
     case DisplayMessageStatusEnum::Accepted:
         return "Accepted";
@@ -2943,23 +3941,41 @@ std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e) {
 }
 
 DisplayMessageStatusEnum string_to_display_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DisplayMessageStatusEnum::Accepted;
-    }
-    if (s == "NotSupportedMessageFormat") {
-        return DisplayMessageStatusEnum::NotSupportedMessageFormat;
-    }
-    if (s == "Rejected") {
-        return DisplayMessageStatusEnum::Rejected;
-    }
-    if (s == "NotSupportedPriority") {
-        return DisplayMessageStatusEnum::NotSupportedPriority;
-    }
-    if (s == "NotSupportedState") {
-        return DisplayMessageStatusEnum::NotSupportedState;
-    }
-    if (s == "UnknownTransaction") {
-        return DisplayMessageStatusEnum::UnknownTransaction;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DisplayMessageStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DisplayMessageStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "NotSupportedState") {
+            return DisplayMessageStatusEnum::NotSupportedState;
+        }
+        break;
+    case 18:
+        if (s == "UnknownTransaction") {
+            return DisplayMessageStatusEnum::UnknownTransaction;
+        }
+        break;
+    case 20:
+        if (s == "NotSupportedPriority") {
+            return DisplayMessageStatusEnum::NotSupportedPriority;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedMessageFormat") {
+            return DisplayMessageStatusEnum::NotSupportedMessageFormat;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -2974,7 +3990,7 @@ std::ostream& operator<<(std::ostream& os, const DisplayMessageStatusEnum& displ
 
 // from: SetMonitoringBaseRequest
 namespace conversions {
-std::string monitoring_base_enum_to_string(MonitoringBaseEnum e) {
+std::string_view monitoring_base_enum_to_string(MonitoringBaseEnum e) {
     switch (e) {
     case MonitoringBaseEnum::All:
         return "All";
@@ -2988,14 +4004,22 @@ std::string monitoring_base_enum_to_string(MonitoringBaseEnum e) {
 }
 
 MonitoringBaseEnum string_to_monitoring_base_enum(const std::string& s) {
-    if (s == "All") {
-        return MonitoringBaseEnum::All;
-    }
-    if (s == "FactoryDefault") {
-        return MonitoringBaseEnum::FactoryDefault;
-    }
-    if (s == "HardWiredOnly") {
-        return MonitoringBaseEnum::HardWiredOnly;
+    switch (s.size()) {
+    case 3:
+        if (s == "All") {
+            return MonitoringBaseEnum::All;
+        }
+        break;
+    case 13:
+        if (s == "HardWiredOnly") {
+            return MonitoringBaseEnum::HardWiredOnly;
+        }
+        break;
+    case 14:
+        if (s == "FactoryDefault") {
+            return MonitoringBaseEnum::FactoryDefault;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MonitoringBaseEnum");
@@ -3009,7 +4033,7 @@ std::ostream& operator<<(std::ostream& os, const MonitoringBaseEnum& monitoring_
 
 // from: SetNetworkProfileRequest
 namespace conversions {
-std::string apnauthentication_enum_to_string(APNAuthenticationEnum e) {
+std::string_view apnauthentication_enum_to_string(APNAuthenticationEnum e) {
     switch (e) {
     case APNAuthenticationEnum::CHAP:
         return "CHAP";
@@ -3025,17 +4049,31 @@ std::string apnauthentication_enum_to_string(APNAuthenticationEnum e) {
 }
 
 APNAuthenticationEnum string_to_apnauthentication_enum(const std::string& s) {
-    if (s == "CHAP") {
-        return APNAuthenticationEnum::CHAP;
-    }
-    if (s == "NONE") {
-        return APNAuthenticationEnum::NONE;
-    }
-    if (s == "PAP") {
-        return APNAuthenticationEnum::PAP;
-    }
-    if (s == "AUTO") {
-        return APNAuthenticationEnum::AUTO;
+    switch (s.size()) {
+    case 3:
+        if (s == "PAP") {
+            return APNAuthenticationEnum::PAP;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CHAP") {
+                return APNAuthenticationEnum::CHAP;
+            }
+            break;
+        case 'N':
+            if (s == "NONE") {
+                return APNAuthenticationEnum::NONE;
+            }
+            break;
+        case 'A':
+            if (s == "AUTO") {
+                return APNAuthenticationEnum::AUTO;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type APNAuthenticationEnum");
@@ -3049,7 +4087,7 @@ std::ostream& operator<<(std::ostream& os, const APNAuthenticationEnum& apnauthe
 
 // from: SetNetworkProfileRequest
 namespace conversions {
-std::string ocppversion_enum_to_string(OCPPVersionEnum e) {
+std::string_view ocppversion_enum_to_string(OCPPVersionEnum e) {
     switch (e) {
     case OCPPVersionEnum::OCPP12:
         return "OCPP12";
@@ -3065,17 +4103,31 @@ std::string ocppversion_enum_to_string(OCPPVersionEnum e) {
 }
 
 OCPPVersionEnum string_to_ocppversion_enum(const std::string& s) {
-    if (s == "OCPP12") {
-        return OCPPVersionEnum::OCPP12;
-    }
-    if (s == "OCPP15") {
-        return OCPPVersionEnum::OCPP15;
-    }
-    if (s == "OCPP16") {
-        return OCPPVersionEnum::OCPP16;
-    }
-    if (s == "OCPP20") {
-        return OCPPVersionEnum::OCPP20;
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '2':
+            if (s == "OCPP12") {
+                return OCPPVersionEnum::OCPP12;
+            }
+            break;
+        case '5':
+            if (s == "OCPP15") {
+                return OCPPVersionEnum::OCPP15;
+            }
+            break;
+        case '6':
+            if (s == "OCPP16") {
+                return OCPPVersionEnum::OCPP16;
+            }
+            break;
+        case '0':
+            if (s == "OCPP20") {
+                return OCPPVersionEnum::OCPP20;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type OCPPVersionEnum");
@@ -3089,7 +4141,7 @@ std::ostream& operator<<(std::ostream& os, const OCPPVersionEnum& ocppversion_en
 
 // from: SetNetworkProfileRequest
 namespace conversions {
-std::string ocpptransport_enum_to_string(OCPPTransportEnum e) {
+std::string_view ocpptransport_enum_to_string(OCPPTransportEnum e) {
     switch (e) {
     case OCPPTransportEnum::JSON:
         return "JSON";
@@ -3101,11 +4153,21 @@ std::string ocpptransport_enum_to_string(OCPPTransportEnum e) {
 }
 
 OCPPTransportEnum string_to_ocpptransport_enum(const std::string& s) {
-    if (s == "JSON") {
-        return OCPPTransportEnum::JSON;
-    }
-    if (s == "SOAP") {
-        return OCPPTransportEnum::SOAP;
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'J':
+            if (s == "JSON") {
+                return OCPPTransportEnum::JSON;
+            }
+            break;
+        case 'S':
+            if (s == "SOAP") {
+                return OCPPTransportEnum::SOAP;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type OCPPTransportEnum");
@@ -3119,7 +4181,7 @@ std::ostream& operator<<(std::ostream& os, const OCPPTransportEnum& ocpptranspor
 
 // from: SetNetworkProfileRequest
 namespace conversions {
-std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e) {
+std::string_view ocppinterface_enum_to_string(OCPPInterfaceEnum e) {
     switch (e) {
     case OCPPInterfaceEnum::Wired0:
         return "Wired0";
@@ -3143,29 +4205,55 @@ std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e) {
 }
 
 OCPPInterfaceEnum string_to_ocppinterface_enum(const std::string& s) {
-    if (s == "Wired0") {
-        return OCPPInterfaceEnum::Wired0;
-    }
-    if (s == "Wired1") {
-        return OCPPInterfaceEnum::Wired1;
-    }
-    if (s == "Wired2") {
-        return OCPPInterfaceEnum::Wired2;
-    }
-    if (s == "Wired3") {
-        return OCPPInterfaceEnum::Wired3;
-    }
-    if (s == "Wireless0") {
-        return OCPPInterfaceEnum::Wireless0;
-    }
-    if (s == "Wireless1") {
-        return OCPPInterfaceEnum::Wireless1;
-    }
-    if (s == "Wireless2") {
-        return OCPPInterfaceEnum::Wireless2;
-    }
-    if (s == "Wireless3") {
-        return OCPPInterfaceEnum::Wireless3;
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '0':
+            if (s == "Wired0") {
+                return OCPPInterfaceEnum::Wired0;
+            }
+            break;
+        case '1':
+            if (s == "Wired1") {
+                return OCPPInterfaceEnum::Wired1;
+            }
+            break;
+        case '2':
+            if (s == "Wired2") {
+                return OCPPInterfaceEnum::Wired2;
+            }
+            break;
+        case '3':
+            if (s == "Wired3") {
+                return OCPPInterfaceEnum::Wired3;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[8]) {
+        case '0':
+            if (s == "Wireless0") {
+                return OCPPInterfaceEnum::Wireless0;
+            }
+            break;
+        case '1':
+            if (s == "Wireless1") {
+                return OCPPInterfaceEnum::Wireless1;
+            }
+            break;
+        case '2':
+            if (s == "Wireless2") {
+                return OCPPInterfaceEnum::Wireless2;
+            }
+            break;
+        case '3':
+            if (s == "Wireless3") {
+                return OCPPInterfaceEnum::Wireless3;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type OCPPInterfaceEnum");
@@ -3179,7 +4267,7 @@ std::ostream& operator<<(std::ostream& os, const OCPPInterfaceEnum& ocppinterfac
 
 // from: SetNetworkProfileRequest
 namespace conversions {
-std::string vpnenum_to_string(VPNEnum e) {
+std::string_view vpnenum_to_string(VPNEnum e) {
     switch (e) {
     case VPNEnum::IKEv2:
         return "IKEv2";
@@ -3195,17 +4283,35 @@ std::string vpnenum_to_string(VPNEnum e) {
 }
 
 VPNEnum string_to_vpnenum(const std::string& s) {
-    if (s == "IKEv2") {
-        return VPNEnum::IKEv2;
-    }
-    if (s == "IPSec") {
-        return VPNEnum::IPSec;
-    }
-    if (s == "L2TP") {
-        return VPNEnum::L2TP;
-    }
-    if (s == "PPTP") {
-        return VPNEnum::PPTP;
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'L':
+            if (s == "L2TP") {
+                return VPNEnum::L2TP;
+            }
+            break;
+        case 'P':
+            if (s == "PPTP") {
+                return VPNEnum::PPTP;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case 'K':
+            if (s == "IKEv2") {
+                return VPNEnum::IKEv2;
+            }
+            break;
+        case 'P':
+            if (s == "IPSec") {
+                return VPNEnum::IPSec;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type VPNEnum");
@@ -3219,7 +4325,7 @@ std::ostream& operator<<(std::ostream& os, const VPNEnum& vpnenum) {
 
 // from: SetNetworkProfileResponse
 namespace conversions {
-std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e) {
+std::string_view set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e) {
     switch (e) {
     case SetNetworkProfileStatusEnum::Accepted:
         return "Accepted";
@@ -3233,14 +4339,26 @@ std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnu
 }
 
 SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetNetworkProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetNetworkProfileStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return SetNetworkProfileStatusEnum::Failed;
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SetNetworkProfileStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetNetworkProfileStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetNetworkProfileStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -3255,7 +4373,7 @@ std::ostream& operator<<(std::ostream& os, const SetNetworkProfileStatusEnum& se
 
 // from: SetVariableMonitoringResponse
 namespace conversions {
-std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e) {
+std::string_view set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e) {
     switch (e) {
     case SetMonitoringStatusEnum::Accepted:
         return "Accepted";
@@ -3275,23 +4393,41 @@ std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e) {
 }
 
 SetMonitoringStatusEnum string_to_set_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetMonitoringStatusEnum::Accepted;
-    }
-    if (s == "UnknownComponent") {
-        return SetMonitoringStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetMonitoringStatusEnum::UnknownVariable;
-    }
-    if (s == "UnsupportedMonitorType") {
-        return SetMonitoringStatusEnum::UnsupportedMonitorType;
-    }
-    if (s == "Rejected") {
-        return SetMonitoringStatusEnum::Rejected;
-    }
-    if (s == "Duplicate") {
-        return SetMonitoringStatusEnum::Duplicate;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetMonitoringStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetMonitoringStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Duplicate") {
+            return SetMonitoringStatusEnum::Duplicate;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetMonitoringStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetMonitoringStatusEnum::UnknownComponent;
+        }
+        break;
+    case 22:
+        if (s == "UnsupportedMonitorType") {
+            return SetMonitoringStatusEnum::UnsupportedMonitorType;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type SetMonitoringStatusEnum");
@@ -3305,7 +4441,7 @@ std::ostream& operator<<(std::ostream& os, const SetMonitoringStatusEnum& set_mo
 
 // from: SetVariablesResponse
 namespace conversions {
-std::string set_variable_status_enum_to_string(SetVariableStatusEnum e) {
+std::string_view set_variable_status_enum_to_string(SetVariableStatusEnum e) {
     switch (e) {
     case SetVariableStatusEnum::Accepted:
         return "Accepted";
@@ -3325,23 +4461,41 @@ std::string set_variable_status_enum_to_string(SetVariableStatusEnum e) {
 }
 
 SetVariableStatusEnum string_to_set_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return SetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return SetVariableStatusEnum::NotSupportedAttributeType;
-    }
-    if (s == "RebootRequired") {
-        return SetVariableStatusEnum::RebootRequired;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetVariableStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetVariableStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return SetVariableStatusEnum::RebootRequired;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return SetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type SetVariableStatusEnum");
@@ -3355,7 +4509,7 @@ std::ostream& operator<<(std::ostream& os, const SetVariableStatusEnum& set_vari
 
 // from: StatusNotificationRequest
 namespace conversions {
-std::string connector_status_enum_to_string(ConnectorStatusEnum e) {
+std::string_view connector_status_enum_to_string(ConnectorStatusEnum e) {
     switch (e) {
     case ConnectorStatusEnum::Available:
         return "Available";
@@ -3373,20 +4527,36 @@ std::string connector_status_enum_to_string(ConnectorStatusEnum e) {
 }
 
 ConnectorStatusEnum string_to_connector_status_enum(const std::string& s) {
-    if (s == "Available") {
-        return ConnectorStatusEnum::Available;
-    }
-    if (s == "Occupied") {
-        return ConnectorStatusEnum::Occupied;
-    }
-    if (s == "Reserved") {
-        return ConnectorStatusEnum::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ConnectorStatusEnum::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ConnectorStatusEnum::Faulted;
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ConnectorStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'O':
+            if (s == "Occupied") {
+                return ConnectorStatusEnum::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Reserved") {
+                return ConnectorStatusEnum::Reserved;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ConnectorStatusEnum::Available;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ConnectorStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ConnectorStatusEnum");
@@ -3400,7 +4570,7 @@ std::ostream& operator<<(std::ostream& os, const ConnectorStatusEnum& connector_
 
 // from: TransactionEventRequest
 namespace conversions {
-std::string transaction_event_enum_to_string(TransactionEventEnum e) {
+std::string_view transaction_event_enum_to_string(TransactionEventEnum e) {
     switch (e) {
     case TransactionEventEnum::Ended:
         return "Ended";
@@ -3414,14 +4584,26 @@ std::string transaction_event_enum_to_string(TransactionEventEnum e) {
 }
 
 TransactionEventEnum string_to_transaction_event_enum(const std::string& s) {
-    if (s == "Ended") {
-        return TransactionEventEnum::Ended;
-    }
-    if (s == "Started") {
-        return TransactionEventEnum::Started;
-    }
-    if (s == "Updated") {
-        return TransactionEventEnum::Updated;
+    switch (s.size()) {
+    case 5:
+        if (s == "Ended") {
+            return TransactionEventEnum::Ended;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Started") {
+                return TransactionEventEnum::Started;
+            }
+            break;
+        case 'U':
+            if (s == "Updated") {
+                return TransactionEventEnum::Updated;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type TransactionEventEnum");
@@ -3435,7 +4617,7 @@ std::ostream& operator<<(std::ostream& os, const TransactionEventEnum& transacti
 
 // from: TransactionEventRequest
 namespace conversions {
-std::string trigger_reason_enum_to_string(TriggerReasonEnum e) {
+std::string_view trigger_reason_enum_to_string(TriggerReasonEnum e) {
     switch (e) {
     case TriggerReasonEnum::Authorized:
         return "Authorized";
@@ -3485,68 +4667,136 @@ std::string trigger_reason_enum_to_string(TriggerReasonEnum e) {
 }
 
 TriggerReasonEnum string_to_trigger_reason_enum(const std::string& s) {
-    if (s == "Authorized") {
-        return TriggerReasonEnum::Authorized;
-    }
-    if (s == "CablePluggedIn") {
-        return TriggerReasonEnum::CablePluggedIn;
-    }
-    if (s == "ChargingRateChanged") {
-        return TriggerReasonEnum::ChargingRateChanged;
-    }
-    if (s == "ChargingStateChanged") {
-        return TriggerReasonEnum::ChargingStateChanged;
-    }
-    if (s == "Deauthorized") {
-        return TriggerReasonEnum::Deauthorized;
-    }
-    if (s == "EnergyLimitReached") {
-        return TriggerReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVCommunicationLost") {
-        return TriggerReasonEnum::EVCommunicationLost;
-    }
-    if (s == "EVConnectTimeout") {
-        return TriggerReasonEnum::EVConnectTimeout;
-    }
-    if (s == "MeterValueClock") {
-        return TriggerReasonEnum::MeterValueClock;
-    }
-    if (s == "MeterValuePeriodic") {
-        return TriggerReasonEnum::MeterValuePeriodic;
-    }
-    if (s == "TimeLimitReached") {
-        return TriggerReasonEnum::TimeLimitReached;
-    }
-    if (s == "Trigger") {
-        return TriggerReasonEnum::Trigger;
-    }
-    if (s == "UnlockCommand") {
-        return TriggerReasonEnum::UnlockCommand;
-    }
-    if (s == "StopAuthorized") {
-        return TriggerReasonEnum::StopAuthorized;
-    }
-    if (s == "EVDeparted") {
-        return TriggerReasonEnum::EVDeparted;
-    }
-    if (s == "EVDetected") {
-        return TriggerReasonEnum::EVDetected;
-    }
-    if (s == "RemoteStop") {
-        return TriggerReasonEnum::RemoteStop;
-    }
-    if (s == "RemoteStart") {
-        return TriggerReasonEnum::RemoteStart;
-    }
-    if (s == "AbnormalCondition") {
-        return TriggerReasonEnum::AbnormalCondition;
-    }
-    if (s == "SignedDataReceived") {
-        return TriggerReasonEnum::SignedDataReceived;
-    }
-    if (s == "ResetCommand") {
-        return TriggerReasonEnum::ResetCommand;
+    switch (s.size()) {
+    case 7:
+        if (s == "Trigger") {
+            return TriggerReasonEnum::Trigger;
+        }
+        break;
+    case 10:
+        switch (s[6]) {
+        case 'i':
+            if (s == "Authorized") {
+                return TriggerReasonEnum::Authorized;
+            }
+            break;
+        case 'r':
+            if (s == "EVDeparted") {
+                return TriggerReasonEnum::EVDeparted;
+            }
+            break;
+        case 'c':
+            if (s == "EVDetected") {
+                return TriggerReasonEnum::EVDetected;
+            }
+            break;
+        case 'S':
+            if (s == "RemoteStop") {
+                return TriggerReasonEnum::RemoteStop;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "RemoteStart") {
+            return TriggerReasonEnum::RemoteStart;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Deauthorized") {
+                return TriggerReasonEnum::Deauthorized;
+            }
+            break;
+        case 'R':
+            if (s == "ResetCommand") {
+                return TriggerReasonEnum::ResetCommand;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "UnlockCommand") {
+            return TriggerReasonEnum::UnlockCommand;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CablePluggedIn") {
+                return TriggerReasonEnum::CablePluggedIn;
+            }
+            break;
+        case 'S':
+            if (s == "StopAuthorized") {
+                return TriggerReasonEnum::StopAuthorized;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "MeterValueClock") {
+            return TriggerReasonEnum::MeterValueClock;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVConnectTimeout") {
+                return TriggerReasonEnum::EVConnectTimeout;
+            }
+            break;
+        case 'T':
+            if (s == "TimeLimitReached") {
+                return TriggerReasonEnum::TimeLimitReached;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "AbnormalCondition") {
+            return TriggerReasonEnum::AbnormalCondition;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EnergyLimitReached") {
+                return TriggerReasonEnum::EnergyLimitReached;
+            }
+            break;
+        case 'M':
+            if (s == "MeterValuePeriodic") {
+                return TriggerReasonEnum::MeterValuePeriodic;
+            }
+            break;
+        case 'S':
+            if (s == "SignedDataReceived") {
+                return TriggerReasonEnum::SignedDataReceived;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChargingRateChanged") {
+                return TriggerReasonEnum::ChargingRateChanged;
+            }
+            break;
+        case 'E':
+            if (s == "EVCommunicationLost") {
+                return TriggerReasonEnum::EVCommunicationLost;
+            }
+            break;
+        }
+        break;
+    case 20:
+        if (s == "ChargingStateChanged") {
+            return TriggerReasonEnum::ChargingStateChanged;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type TriggerReasonEnum");
@@ -3560,7 +4810,7 @@ std::ostream& operator<<(std::ostream& os, const TriggerReasonEnum& trigger_reas
 
 // from: TransactionEventRequest
 namespace conversions {
-std::string charging_state_enum_to_string(ChargingStateEnum e) {
+std::string_view charging_state_enum_to_string(ChargingStateEnum e) {
     switch (e) {
     case ChargingStateEnum::Charging:
         return "Charging";
@@ -3578,20 +4828,36 @@ std::string charging_state_enum_to_string(ChargingStateEnum e) {
 }
 
 ChargingStateEnum string_to_charging_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return ChargingStateEnum::Charging;
-    }
-    if (s == "EVConnected") {
-        return ChargingStateEnum::EVConnected;
-    }
-    if (s == "SuspendedEV") {
-        return ChargingStateEnum::SuspendedEV;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargingStateEnum::SuspendedEVSE;
-    }
-    if (s == "Idle") {
-        return ChargingStateEnum::Idle;
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return ChargingStateEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return ChargingStateEnum::Charging;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVConnected") {
+                return ChargingStateEnum::EVConnected;
+            }
+            break;
+        case 'S':
+            if (s == "SuspendedEV") {
+                return ChargingStateEnum::SuspendedEV;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargingStateEnum::SuspendedEVSE;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ChargingStateEnum");
@@ -3605,7 +4871,7 @@ std::ostream& operator<<(std::ostream& os, const ChargingStateEnum& charging_sta
 
 // from: TransactionEventRequest
 namespace conversions {
-std::string reason_enum_to_string(ReasonEnum e) {
+std::string_view reason_enum_to_string(ReasonEnum e) {
     switch (e) {
     case ReasonEnum::DeAuthorized:
         return "DeAuthorized";
@@ -3651,62 +4917,126 @@ std::string reason_enum_to_string(ReasonEnum e) {
 }
 
 ReasonEnum string_to_reason_enum(const std::string& s) {
-    if (s == "DeAuthorized") {
-        return ReasonEnum::DeAuthorized;
-    }
-    if (s == "EmergencyStop") {
-        return ReasonEnum::EmergencyStop;
-    }
-    if (s == "EnergyLimitReached") {
-        return ReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVDisconnected") {
-        return ReasonEnum::EVDisconnected;
-    }
-    if (s == "GroundFault") {
-        return ReasonEnum::GroundFault;
-    }
-    if (s == "ImmediateReset") {
-        return ReasonEnum::ImmediateReset;
-    }
-    if (s == "Local") {
-        return ReasonEnum::Local;
-    }
-    if (s == "LocalOutOfCredit") {
-        return ReasonEnum::LocalOutOfCredit;
-    }
-    if (s == "MasterPass") {
-        return ReasonEnum::MasterPass;
-    }
-    if (s == "Other") {
-        return ReasonEnum::Other;
-    }
-    if (s == "OvercurrentFault") {
-        return ReasonEnum::OvercurrentFault;
-    }
-    if (s == "PowerLoss") {
-        return ReasonEnum::PowerLoss;
-    }
-    if (s == "PowerQuality") {
-        return ReasonEnum::PowerQuality;
-    }
-    if (s == "Reboot") {
-        return ReasonEnum::Reboot;
-    }
-    if (s == "Remote") {
-        return ReasonEnum::Remote;
-    }
-    if (s == "SOCLimitReached") {
-        return ReasonEnum::SOCLimitReached;
-    }
-    if (s == "StoppedByEV") {
-        return ReasonEnum::StoppedByEV;
-    }
-    if (s == "TimeLimitReached") {
-        return ReasonEnum::TimeLimitReached;
-    }
-    if (s == "Timeout") {
-        return ReasonEnum::Timeout;
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'L':
+            if (s == "Local") {
+                return ReasonEnum::Local;
+            }
+            break;
+        case 'O':
+            if (s == "Other") {
+                return ReasonEnum::Other;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (s[2]) {
+        case 'b':
+            if (s == "Reboot") {
+                return ReasonEnum::Reboot;
+            }
+            break;
+        case 'm':
+            if (s == "Remote") {
+                return ReasonEnum::Remote;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if (s == "Timeout") {
+            return ReasonEnum::Timeout;
+        }
+        break;
+    case 9:
+        if (s == "PowerLoss") {
+            return ReasonEnum::PowerLoss;
+        }
+        break;
+    case 10:
+        if (s == "MasterPass") {
+            return ReasonEnum::MasterPass;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'G':
+            if (s == "GroundFault") {
+                return ReasonEnum::GroundFault;
+            }
+            break;
+        case 'S':
+            if (s == "StoppedByEV") {
+                return ReasonEnum::StoppedByEV;
+            }
+            break;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DeAuthorized") {
+                return ReasonEnum::DeAuthorized;
+            }
+            break;
+        case 'P':
+            if (s == "PowerQuality") {
+                return ReasonEnum::PowerQuality;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "EmergencyStop") {
+            return ReasonEnum::EmergencyStop;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVDisconnected") {
+                return ReasonEnum::EVDisconnected;
+            }
+            break;
+        case 'I':
+            if (s == "ImmediateReset") {
+                return ReasonEnum::ImmediateReset;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "SOCLimitReached") {
+            return ReasonEnum::SOCLimitReached;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LocalOutOfCredit") {
+                return ReasonEnum::LocalOutOfCredit;
+            }
+            break;
+        case 'O':
+            if (s == "OvercurrentFault") {
+                return ReasonEnum::OvercurrentFault;
+            }
+            break;
+        case 'T':
+            if (s == "TimeLimitReached") {
+                return ReasonEnum::TimeLimitReached;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "EnergyLimitReached") {
+            return ReasonEnum::EnergyLimitReached;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type ReasonEnum");
@@ -3720,7 +5050,7 @@ std::ostream& operator<<(std::ostream& os, const ReasonEnum& reason_enum) {
 
 // from: TriggerMessageRequest
 namespace conversions {
-std::string message_trigger_enum_to_string(MessageTriggerEnum e) {
+std::string_view message_trigger_enum_to_string(MessageTriggerEnum e) {
     switch (e) {
     case MessageTriggerEnum::BootNotification:
         return "BootNotification";
@@ -3750,38 +5080,70 @@ std::string message_trigger_enum_to_string(MessageTriggerEnum e) {
 }
 
 MessageTriggerEnum string_to_message_trigger_enum(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnum::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnum::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnum::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnum::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnum::MeterValues;
-    }
-    if (s == "SignChargingStationCertificate") {
-        return MessageTriggerEnum::SignChargingStationCertificate;
-    }
-    if (s == "SignV2GCertificate") {
-        return MessageTriggerEnum::SignV2GCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnum::StatusNotification;
-    }
-    if (s == "TransactionEvent") {
-        return MessageTriggerEnum::TransactionEvent;
-    }
-    if (s == "SignCombinedCertificate") {
-        return MessageTriggerEnum::SignCombinedCertificate;
-    }
-    if (s == "PublishFirmwareStatusNotification") {
-        return MessageTriggerEnum::PublishFirmwareStatusNotification;
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnum::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnum::MeterValues;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotification") {
+                return MessageTriggerEnum::BootNotification;
+            }
+            break;
+        case 'T':
+            if (s == "TransactionEvent") {
+                return MessageTriggerEnum::TransactionEvent;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignV2GCertificate") {
+                return MessageTriggerEnum::SignV2GCertificate;
+            }
+            break;
+        case 't':
+            if (s == "StatusNotification") {
+                return MessageTriggerEnum::StatusNotification;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnum::LogStatusNotification;
+        }
+        break;
+    case 23:
+        if (s == "SignCombinedCertificate") {
+            return MessageTriggerEnum::SignCombinedCertificate;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTriggerEnum::FirmwareStatusNotification;
+        }
+        break;
+    case 30:
+        if (s == "SignChargingStationCertificate") {
+            return MessageTriggerEnum::SignChargingStationCertificate;
+        }
+        break;
+    case 33:
+        if (s == "PublishFirmwareStatusNotification") {
+            return MessageTriggerEnum::PublishFirmwareStatusNotification;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type MessageTriggerEnum");
@@ -3795,7 +5157,7 @@ std::ostream& operator<<(std::ostream& os, const MessageTriggerEnum& message_tri
 
 // from: TriggerMessageResponse
 namespace conversions {
-std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e) {
+std::string_view trigger_message_status_enum_to_string(TriggerMessageStatusEnum e) {
     switch (e) {
     case TriggerMessageStatusEnum::Accepted:
         return "Accepted";
@@ -3809,14 +5171,26 @@ std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e) {
 }
 
 TriggerMessageStatusEnum string_to_trigger_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnum::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnum::NotImplemented;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnum::NotImplemented;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -3831,7 +5205,7 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatusEnum& trigg
 
 // from: UnlockConnectorResponse
 namespace conversions {
-std::string unlock_status_enum_to_string(UnlockStatusEnum e) {
+std::string_view unlock_status_enum_to_string(UnlockStatusEnum e) {
     switch (e) {
     case UnlockStatusEnum::Unlocked:
         return "Unlocked";
@@ -3847,17 +5221,27 @@ std::string unlock_status_enum_to_string(UnlockStatusEnum e) {
 }
 
 UnlockStatusEnum string_to_unlock_status_enum(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatusEnum::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatusEnum::UnlockFailed;
-    }
-    if (s == "OngoingAuthorizedTransaction") {
-        return UnlockStatusEnum::OngoingAuthorizedTransaction;
-    }
-    if (s == "UnknownConnector") {
-        return UnlockStatusEnum::UnknownConnector;
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatusEnum::Unlocked;
+        }
+        break;
+    case 12:
+        if (s == "UnlockFailed") {
+            return UnlockStatusEnum::UnlockFailed;
+        }
+        break;
+    case 16:
+        if (s == "UnknownConnector") {
+            return UnlockStatusEnum::UnknownConnector;
+        }
+        break;
+    case 28:
+        if (s == "OngoingAuthorizedTransaction") {
+            return UnlockStatusEnum::OngoingAuthorizedTransaction;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s + " could not be converted to enum of type UnlockStatusEnum");
@@ -3871,7 +5255,7 @@ std::ostream& operator<<(std::ostream& os, const UnlockStatusEnum& unlock_status
 
 // from: UnpublishFirmwareResponse
 namespace conversions {
-std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e) {
+std::string_view unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e) {
     switch (e) {
     case UnpublishFirmwareStatusEnum::DownloadOngoing:
         return "DownloadOngoing";
@@ -3885,14 +5269,22 @@ std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum
 }
 
 UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(const std::string& s) {
-    if (s == "DownloadOngoing") {
-        return UnpublishFirmwareStatusEnum::DownloadOngoing;
-    }
-    if (s == "NoFirmware") {
-        return UnpublishFirmwareStatusEnum::NoFirmware;
-    }
-    if (s == "Unpublished") {
-        return UnpublishFirmwareStatusEnum::Unpublished;
+    switch (s.size()) {
+    case 10:
+        if (s == "NoFirmware") {
+            return UnpublishFirmwareStatusEnum::NoFirmware;
+        }
+        break;
+    case 11:
+        if (s == "Unpublished") {
+            return UnpublishFirmwareStatusEnum::Unpublished;
+        }
+        break;
+    case 15:
+        if (s == "DownloadOngoing") {
+            return UnpublishFirmwareStatusEnum::DownloadOngoing;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
@@ -3907,7 +5299,7 @@ std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareStatusEnum& un
 
 // from: UpdateFirmwareResponse
 namespace conversions {
-std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e) {
+std::string_view update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e) {
     switch (e) {
     case UpdateFirmwareStatusEnum::Accepted:
         return "Accepted";
@@ -3925,20 +5317,40 @@ std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e) {
 }
 
 UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnum::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnum::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnum::RevokedCertificate;
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return UpdateFirmwareStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return UpdateFirmwareStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnum::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'I':
+            if (s == "InvalidCertificate") {
+                return UpdateFirmwareStatusEnum::InvalidCertificate;
+            }
+            break;
+        case 'R':
+            if (s == "RevokedCertificate") {
+                return UpdateFirmwareStatusEnum::RevokedCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw std::out_of_range("Provided string " + s +
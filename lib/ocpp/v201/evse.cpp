@@ -131,7 +131,7 @@ void Evse::open_transaction(const std::string& transaction_id, const int32_t con
     if (aligned_data_tx_updated_interval > 0s) {
         transaction->aligned_tx_updated_meter_values_timer.interval_starting_from(
             [this, aligned_data_tx_updated_interval] {
-                if (this->device_model.get_optional_value<bool>(ControllerComponentVariables::AlignedDataSendDuringIdle)
+                if (this->device_model.get_optional_value(ControllerComponentVariableHandles::AlignedDataSendDuringIdle)
                         .value_or(false)) {
                     return;
                 }
@@ -146,7 +146,7 @@ void Evse::open_transaction(const std::string& transaction_id, const int32_t con
                     item.context = ReadingContextEnum::Sample_Clock;
                 }
                 if (this->device_model
-                        .get_optional_value<bool>(ControllerComponentVariables::RoundClockAlignedTimestamps)
+                        .get_optional_value(ControllerComponentVariableHandles::RoundClockAlignedTimestamps)
                         .value_or(false)) {
                     meter_value.timestamp = utils::align_timestamp(DateTime{}, aligned_data_tx_updated_interval);
                 }
@@ -170,7 +170,7 @@ void Evse::open_transaction(const std::string& transaction_id, const int32_t con
             for (auto& item : meter_value.sampledValue) {
                 item.context = ReadingContextEnum::Sample_Clock;
             }
-            if (this->device_model.get_optional_value<bool>(ControllerComponentVariables::RoundClockAlignedTimestamps)
+            if (this->device_model.get_optional_value(ControllerComponentVariableHandles::RoundClockAlignedTimestamps)
                     .value_or(false)) {
                 meter_value.timestamp = utils::align_timestamp(DateTime{}, aligned_data_tx_ended_interval);
             }
@@ -302,7 +302,7 @@ std::optional<float> Evse::get_active_import_register_meter_value() {
 void Evse::check_max_energy_on_invalid_id() {
     // Handle E05.02
     auto max_energy_on_invalid_id =
-        this->device_model.get_optional_value<int32_t>(ControllerComponentVariables::MaxEnergyOnInvalidId);
+        this->device_model.get_optional_value(ControllerComponentVariableHandles::MaxEnergyOnInvalidId);
     auto& transaction = this->transaction;
     if (transaction != nullptr and max_energy_on_invalid_id.has_value() and
         transaction->check_max_active_import_energy) {
@@ -0,0 +1,467 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/v201/message_validator.hpp>
+
+#include <ocpp/v201/messages/Authorize.hpp>
+#include <ocpp/v201/messages/BootNotification.hpp>
+#include <ocpp/v201/messages/CancelReservation.hpp>
+#include <ocpp/v201/messages/CertificateSigned.hpp>
+#include <ocpp/v201/messages/ChangeAvailability.hpp>
+#include <ocpp/v201/messages/ClearCache.hpp>
+#include <ocpp/v201/messages/ClearChargingProfile.hpp>
+#include <ocpp/v201/messages/ClearDisplayMessage.hpp>
+#include <ocpp/v201/messages/ClearVariableMonitoring.hpp>
+#include <ocpp/v201/messages/ClearedChargingLimit.hpp>
+#include <ocpp/v201/messages/CostUpdated.hpp>
+#include <ocpp/v201/messages/CustomerInformation.hpp>
+#include <ocpp/v201/messages/DataTransfer.hpp>
+#include <ocpp/v201/messages/DeleteCertificate.hpp>
+#include <ocpp/v201/messages/FirmwareStatusNotification.hpp>
+#include <ocpp/v201/messages/Get15118EVCertificate.hpp>
+#include <ocpp/v201/messages/GetBaseReport.hpp>
+#include <ocpp/v201/messages/GetCertificateStatus.hpp>
+#include <ocpp/v201/messages/GetChargingProfiles.hpp>
+#include <ocpp/v201/messages/GetCompositeSchedule.hpp>
+#include <ocpp/v201/messages/GetDisplayMessages.hpp>
+#include <ocpp/v201/messages/GetInstalledCertificateIds.hpp>
+#include <ocpp/v201/messages/GetLocalListVersion.hpp>
+#include <ocpp/v201/messages/GetLog.hpp>
+#include <ocpp/v201/messages/GetMonitoringReport.hpp>
+#include <ocpp/v201/messages/GetReport.hpp>
+#include <ocpp/v201/messages/GetTransactionStatus.hpp>
+#include <ocpp/v201/messages/GetVariables.hpp>
+#include <ocpp/v201/messages/Heartbeat.hpp>
+#include <ocpp/v201/messages/InstallCertificate.hpp>
+#include <ocpp/v201/messages/LogStatusNotification.hpp>
+#include <ocpp/v201/messages/MeterValues.hpp>
+#include <ocpp/v201/messages/NotifyChargingLimit.hpp>
+#include <ocpp/v201/messages/NotifyCustomerInformation.hpp>
+#include <ocpp/v201/messages/NotifyDisplayMessages.hpp>
+#include <ocpp/v201/messages/NotifyEVChargingNeeds.hpp>
+#include <ocpp/v201/messages/NotifyEVChargingSchedule.hpp>
+#include <ocpp/v201/messages/NotifyEvent.hpp>
+#include <ocpp/v201/messages/NotifyMonitoringReport.hpp>
+#include <ocpp/v201/messages/NotifyReport.hpp>
+#include <ocpp/v201/messages/PublishFirmware.hpp>
+#include <ocpp/v201/messages/PublishFirmwareStatusNotification.hpp>
+#include <ocpp/v201/messages/ReportChargingProfiles.hpp>
+#include <ocpp/v201/messages/RequestStartTransaction.hpp>
+#include <ocpp/v201/messages/RequestStopTransaction.hpp>
+#include <ocpp/v201/messages/ReservationStatusUpdate.hpp>
+#include <ocpp/v201/messages/ReserveNow.hpp>
+#include <ocpp/v201/messages/Reset.hpp>
+#include <ocpp/v201/messages/SecurityEventNotification.hpp>
+#include <ocpp/v201/messages/SendLocalList.hpp>
+#include <ocpp/v201/messages/SetChargingProfile.hpp>
+#include <ocpp/v201/messages/SetDisplayMessage.hpp>
+#include <ocpp/v201/messages/SetMonitoringBase.hpp>
+#include <ocpp/v201/messages/SetMonitoringLevel.hpp>
+#include <ocpp/v201/messages/SetNetworkProfile.hpp>
+#include <ocpp/v201/messages/SetVariableMonitoring.hpp>
+#include <ocpp/v201/messages/SetVariables.hpp>
+#include <ocpp/v201/messages/SignCertificate.hpp>
+#include <ocpp/v201/messages/StatusNotification.hpp>
+#include <ocpp/v201/messages/TransactionEvent.hpp>
+#include <ocpp/v201/messages/TriggerMessage.hpp>
+#include <ocpp/v201/messages/UnlockConnector.hpp>
+#include <ocpp/v201/messages/UnpublishFirmware.hpp>
+#include <ocpp/v201/messages/UpdateFirmware.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+void validate_message(MessageType message_type, JsonValidator& validator) {
+    switch (message_type) {
+    case MessageType::Authorize:
+        validate_authorize_request(validator);
+        break;
+    case MessageType::AuthorizeResponse:
+        validate_authorize_response(validator);
+        break;
+    case MessageType::BootNotification:
+        validate_boot_notification_request(validator);
+        break;
+    case MessageType::BootNotificationResponse:
+        validate_boot_notification_response(validator);
+        break;
+    case MessageType::CancelReservation:
+        validate_cancel_reservation_request(validator);
+        break;
+    case MessageType::CancelReservationResponse:
+        validate_cancel_reservation_response(validator);
+        break;
+    case MessageType::CertificateSigned:
+        validate_certificate_signed_request(validator);
+        break;
+    case MessageType::CertificateSignedResponse:
+        validate_certificate_signed_response(validator);
+        break;
+    case MessageType::ChangeAvailability:
+        validate_change_availability_request(validator);
+        break;
+    case MessageType::ChangeAvailabilityResponse:
+        validate_change_availability_response(validator);
+        break;
+    case MessageType::ClearCache:
+        validate_clear_cache_request(validator);
+        break;
+    case MessageType::ClearCacheResponse:
+        validate_clear_cache_response(validator);
+        break;
+    case MessageType::ClearChargingProfile:
+        validate_clear_charging_profile_request(validator);
+        break;
+    case MessageType::ClearChargingProfileResponse:
+        validate_clear_charging_profile_response(validator);
+        break;
+    case MessageType::ClearDisplayMessage:
+        validate_clear_display_message_request(validator);
+        break;
+    case MessageType::ClearDisplayMessageResponse:
+        validate_clear_display_message_response(validator);
+        break;
+    case MessageType::ClearVariableMonitoring:
+        validate_clear_variable_monitoring_request(validator);
+        break;
+    case MessageType::ClearVariableMonitoringResponse:
+        validate_clear_variable_monitoring_response(validator);
+        break;
+    case MessageType::ClearedChargingLimit:
+        validate_cleared_charging_limit_request(validator);
+        break;
+    case MessageType::ClearedChargingLimitResponse:
+        validate_cleared_charging_limit_response(validator);
+        break;
+    case MessageType::CostUpdated:
+        validate_cost_updated_request(validator);
+        break;
+    case MessageType::CostUpdatedResponse:
+        validate_cost_updated_response(validator);
+        break;
+    case MessageType::CustomerInformation:
+        validate_customer_information_request(validator);
+        break;
+    case MessageType::CustomerInformationResponse:
+        validate_customer_information_response(validator);
+        break;
+    case MessageType::DataTransfer:
+        validate_data_transfer_request(validator);
+        break;
+    case MessageType::DataTransferResponse:
+        validate_data_transfer_response(validator);
+        break;
+    case MessageType::DeleteCertificate:
+        validate_delete_certificate_request(validator);
+        break;
+    case MessageType::DeleteCertificateResponse:
+        validate_delete_certificate_response(validator);
+        break;
+    case MessageType::FirmwareStatusNotification:
+        validate_firmware_status_notification_request(validator);
+        break;
+    case MessageType::FirmwareStatusNotificationResponse:
+        validate_firmware_status_notification_response(validator);
+        break;
+    case MessageType::Get15118EVCertificate:
+        validate_get15118evcertificate_request(validator);
+        break;
+    case MessageType::Get15118EVCertificateResponse:
+        validate_get15118evcertificate_response(validator);
+        break;
+    case MessageType::GetBaseReport:
+        validate_get_base_report_request(validator);
+        break;
+    case MessageType::GetBaseReportResponse:
+        validate_get_base_report_response(validator);
+        break;
+    case MessageType::GetCertificateStatus:
+        validate_get_certificate_status_request(validator);
+        break;
+    case MessageType::GetCertificateStatusResponse:
+        validate_get_certificate_status_response(validator);
+        break;
+    case MessageType::GetChargingProfiles:
+        validate_get_charging_profiles_request(validator);
+        break;
+    case MessageType::GetChargingProfilesResponse:
+        validate_get_charging_profiles_response(validator);
+        break;
+    case MessageType::GetCompositeSchedule:
+        validate_get_composite_schedule_request(validator);
+        break;
+    case MessageType::GetCompositeScheduleResponse:
+        validate_get_composite_schedule_response(validator);
+        break;
+    case MessageType::GetDisplayMessages:
+        validate_get_display_messages_request(validator);
+        break;
+    case MessageType::GetDisplayMessagesResponse:
+        validate_get_display_messages_response(validator);
+        break;
+    case MessageType::GetInstalledCertificateIds:
+        validate_get_installed_certificate_ids_request(validator);
+        break;
+    case MessageType::GetInstalledCertificateIdsResponse:
+        validate_get_installed_certificate_ids_response(validator);
+        break;
+    case MessageType::GetLocalListVersion:
+        validate_get_local_list_version_request(validator);
+        break;
+    case MessageType::GetLocalListVersionResponse:
+        validate_get_local_list_version_response(validator);
+        break;
+    case MessageType::GetLog:
+        validate_get_log_request(validator);
+        break;
+    case MessageType::GetLogResponse:
+        validate_get_log_response(validator);
+        break;
+    case MessageType::GetMonitoringReport:
+        validate_get_monitoring_report_request(validator);
+        break;
+    case MessageType::GetMonitoringReportResponse:
+        validate_get_monitoring_report_response(validator);
+        break;
+    case MessageType::GetReport:
+        validate_get_report_request(validator);
+        break;
+    case MessageType::GetReportResponse:
+        validate_get_report_response(validator);
+        break;
+    case MessageType::GetTransactionStatus:
+        validate_get_transaction_status_request(validator);
+        break;
+    case MessageType::GetTransactionStatusResponse:
+        validate_get_transaction_status_response(validator);
+        break;
+    case MessageType::GetVariables:
+        validate_get_variables_request(validator);
+        break;
+    case MessageType::GetVariablesResponse:
+        validate_get_variables_response(validator);
+        break;
+    case MessageType::Heartbeat:
+        validate_heartbeat_request(validator);
+        break;
+    case MessageType::HeartbeatResponse:
+        validate_heartbeat_response(validator);
+        break;
+    case MessageType::InstallCertificate:
+        validate_install_certificate_request(validator);
+        break;
+    case MessageType::InstallCertificateResponse:
+        validate_install_certificate_response(validator);
+        break;
+    case MessageType::LogStatusNotification:
+        validate_log_status_notification_request(validator);
+        break;
+    case MessageType::LogStatusNotificationResponse:
+        validate_log_status_notification_response(validator);
+        break;
+    case MessageType::MeterValues:
+        validate_meter_values_request(validator);
+        break;
+    case MessageType::MeterValuesResponse:
+        validate_meter_values_response(validator);
+        break;
+    case MessageType::NotifyChargingLimit:
+        validate_notify_charging_limit_request(validator);
+        break;
+    case MessageType::NotifyChargingLimitResponse:
+        validate_notify_charging_limit_response(validator);
+        break;
+    case MessageType::NotifyCustomerInformation:
+        validate_notify_customer_information_request(validator);
+        break;
+    case MessageType::NotifyCustomerInformationResponse:
+        validate_notify_customer_information_response(validator);
+        break;
+    case MessageType::NotifyDisplayMessages:
+        validate_notify_display_messages_request(validator);
+        break;
+    case MessageType::NotifyDisplayMessagesResponse:
+        validate_notify_display_messages_response(validator);
+        break;
+    case MessageType::NotifyEVChargingNeeds:
+        validate_notify_evcharging_needs_request(validator);
+        break;
+    case MessageType::NotifyEVChargingNeedsResponse:
+        validate_notify_evcharging_needs_response(validator);
+        break;
+    case MessageType::NotifyEVChargingSchedule:
+        validate_notify_evcharging_schedule_request(validator);
+        break;
+    case MessageType::NotifyEVChargingScheduleResponse:
+        validate_notify_evcharging_schedule_response(validator);
+        break;
+    case MessageType::NotifyEvent:
+        validate_notify_event_request(validator);
+        break;
+    case MessageType::NotifyEventResponse:
+        validate_notify_event_response(validator);
+        break;
+    case MessageType::NotifyMonitoringReport:
+        validate_notify_monitoring_report_request(validator);
+        break;
+    case MessageType::NotifyMonitoringReportResponse:
+        validate_notify_monitoring_report_response(validator);
+        break;
+    case MessageType::NotifyReport:
+        validate_notify_report_request(validator);
+        break;
+    case MessageType::NotifyReportResponse:
+        validate_notify_report_response(validator);
+        break;
+    case MessageType::PublishFirmware:
+        validate_publish_firmware_request(validator);
+        break;
+    case MessageType::PublishFirmwareResponse:
+        validate_publish_firmware_response(validator);
+        break;
+    case MessageType::PublishFirmwareStatusNotification:
+        validate_publish_firmware_status_notification_request(validator);
+        break;
+    case MessageType::PublishFirmwareStatusNotificationResponse:
+        validate_publish_firmware_status_notification_response(validator);
+        break;
+    case MessageType::ReportChargingProfiles:
+        validate_report_charging_profiles_request(validator);
+        break;
+    case MessageType::ReportChargingProfilesResponse:
+        validate_report_charging_profiles_response(validator);
+        break;
+    case MessageType::RequestStartTransaction:
+        validate_request_start_transaction_request(validator);
+        break;
+    case MessageType::RequestStartTransactionResponse:
+        validate_request_start_transaction_response(validator);
+        break;
+    case MessageType::RequestStopTransaction:
+        validate_request_stop_transaction_request(validator);
+        break;
+    case MessageType::RequestStopTransactionResponse:
+        validate_request_stop_transaction_response(validator);
+        break;
+    case MessageType::ReservationStatusUpdate:
+        validate_reservation_status_update_request(validator);
+        break;
+    case MessageType::ReservationStatusUpdateResponse:
+        validate_reservation_status_update_response(validator);
+        break;
+    case MessageType::ReserveNow:
+        validate_reserve_now_request(validator);
+        break;
+    case MessageType::ReserveNowResponse:
+        validate_reserve_now_response(validator);
+        break;
+    case MessageType::Reset:
+        validate_reset_request(validator);
+        break;
+    case MessageType::ResetResponse:
+        validate_reset_response(validator);
+        break;
+    case MessageType::SecurityEventNotification:
+        validate_security_event_notification_request(validator);
+        break;
+    case MessageType::SecurityEventNotificationResponse:
+        validate_security_event_notification_response(validator);
+        break;
+    case MessageType::SendLocalList:
+        validate_send_local_list_request(validator);
+        break;
+    case MessageType::SendLocalListResponse:
+        validate_send_local_list_response(validator);
+        break;
+    case MessageType::SetChargingProfile:
+        validate_set_charging_profile_request(validator);
+        break;
+    case MessageType::SetChargingProfileResponse:
+        validate_set_charging_profile_response(validator);
+        break;
+    case MessageType::SetDisplayMessage:
+        validate_set_display_message_request(validator);
+        break;
+    case MessageType::SetDisplayMessageResponse:
+        validate_set_display_message_response(validator);
+        break;
+    case MessageType::SetMonitoringBase:
+        validate_set_monitoring_base_request(validator);
+        break;
+    case MessageType::SetMonitoringBaseResponse:
+        validate_set_monitoring_base_response(validator);
+        break;
+    case MessageType::SetMonitoringLevel:
+        validate_set_monitoring_level_request(validator);
+        break;
+    case MessageType::SetMonitoringLevelResponse:
+        validate_set_monitoring_level_response(validator);
+        break;
+    case MessageType::SetNetworkProfile:
+        validate_set_network_profile_request(validator);
+        break;
+    case MessageType::SetNetworkProfileResponse:
+        validate_set_network_profile_response(validator);
+        break;
+    case MessageType::SetVariableMonitoring:
+        validate_set_variable_monitoring_request(validator);
+        break;
+    case MessageType::SetVariableMonitoringResponse:
+        validate_set_variable_monitoring_response(validator);
+        break;
+    case MessageType::SetVariables:
+        validate_set_variables_request(validator);
+        break;
+    case MessageType::SetVariablesResponse:
+        validate_set_variables_response(validator);
+        break;
+    case MessageType::SignCertificate:
+        validate_sign_certificate_request(validator);
+        break;
+    case MessageType::SignCertificateResponse:
+        validate_sign_certificate_response(validator);
+        break;
+    case MessageType::StatusNotification:
+        validate_status_notification_request(validator);
+        break;
+    case MessageType::StatusNotificationResponse:
+        validate_status_notification_response(validator);
+        break;
+    case MessageType::TransactionEvent:
+        validate_transaction_event_request(validator);
+        break;
+    case MessageType::TransactionEventResponse:
+        validate_transaction_event_response(validator);
+        break;
+    case MessageType::TriggerMessage:
+        validate_trigger_message_request(validator);
+        break;
+    case MessageType::TriggerMessageResponse:
+        validate_trigger_message_response(validator);
+        break;
+    case MessageType::UnlockConnector:
+        validate_unlock_connector_request(validator);
+        break;
+    case MessageType::UnlockConnectorResponse:
+        validate_unlock_connector_response(validator);
+        break;
+    case MessageType::UnpublishFirmware:
+        validate_unpublish_firmware_request(validator);
+        break;
+    case MessageType::UnpublishFirmwareResponse:
+        validate_unpublish_firmware_response(validator);
+        break;
+    case MessageType::UpdateFirmware:
+        validate_update_firmware_request(validator);
+        break;
+    case MessageType::UpdateFirmwareResponse:
+        validate_update_firmware_response(validator);
+        break;
+    default:
+        validator.any();
+        break;
+    }
+}
+
+} // namespace v201
+} // namespace ocpp
@@ -58,6 +58,61 @@ void from_json(const json& j, AuthorizeRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificate) {
+        writer.member("certificate", k.certificate.value());
+    }
+    if (k.iso15118CertificateHashData) {
+        writer.member("iso15118CertificateHashData", k.iso15118CertificateHashData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, AuthorizeRequest& k) {
+    bool has_idToken = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idToken") {
+            reader.read(k.idToken);
+            has_idToken = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "certificate") {
+            reader.read(k.certificate);
+        } else if (key == "iso15118CertificateHashData") {
+            reader.read(k.iso15118CertificateHashData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idToken, "idToken");
+}
+
+void validate_authorize_request(JsonValidator& validator) {
+    bool has_idToken = false;
+    validator.object("AuthorizeRequest", [&](std::string_view key) {
+        if (key == "idToken") {
+            validate_id_token(validator);
+            has_idToken = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "certificate") {
+            validator.string(5500);
+        } else if (key == "iso15118CertificateHashData") {
+            validator.array(1, 4, [&]() { validate_ocsprequest_data(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idToken, "AuthorizeRequest.idToken");
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -97,6 +152,55 @@ void from_json(const json& j, AuthorizeResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idTokenInfo", k.idTokenInfo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateStatus) {
+        writer.member("certificateStatus",
+                      conversions::authorize_certificate_status_enum_to_string(k.certificateStatus.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, AuthorizeResponse& k) {
+    bool has_idTokenInfo = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idTokenInfo") {
+            reader.read(k.idTokenInfo);
+            has_idTokenInfo = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "certificateStatus") {
+            k.certificateStatus.emplace(conversions::string_to_authorize_certificate_status_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idTokenInfo, "idTokenInfo");
+}
+
+void validate_authorize_response(JsonValidator& validator) {
+    bool has_idTokenInfo = false;
+    validator.object("AuthorizeResponse", [&](std::string_view key) {
+        if (key == "idTokenInfo") {
+            validate_id_token_info(validator);
+            has_idTokenInfo = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "certificateStatus") {
+            validator.enumeration(conversions::string_to_authorize_certificate_status_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idTokenInfo, "AuthorizeResponse.idTokenInfo");
+}
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k) {
@@ -40,6 +40,58 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingStation", k.chargingStation);
+    writer.member("reason", conversions::boot_reason_enum_to_string(k.reason));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, BootNotificationRequest& k) {
+    bool has_chargingStation = false;
+    bool has_reason = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingStation") {
+            reader.read(k.chargingStation);
+            has_chargingStation = true;
+        } else if (key == "reason") {
+            k.reason = conversions::string_to_boot_reason_enum(reader.read_string());
+            has_reason = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingStation, "chargingStation");
+    reader.require_member(has_reason, "reason");
+}
+
+void validate_boot_notification_request(JsonValidator& validator) {
+    bool has_chargingStation = false;
+    bool has_reason = false;
+    validator.object("BootNotificationRequest", [&](std::string_view key) {
+        if (key == "chargingStation") {
+            validate_charging_station(validator);
+            has_chargingStation = true;
+        } else if (key == "reason") {
+            validator.enumeration(conversions::string_to_boot_reason_enum);
+            has_reason = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingStation, "BootNotificationRequest.chargingStation");
+    validator.require_member(has_reason, "BootNotificationRequest.reason");
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -82,6 +134,76 @@ void from_json(const json& j, BootNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime);
+    writer.member("interval", k.interval);
+    writer.member("status", conversions::registration_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, BootNotificationResponse& k) {
+    bool has_currentTime = false;
+    bool has_interval = false;
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "currentTime") {
+            reader.read(k.currentTime);
+            has_currentTime = true;
+        } else if (key == "interval") {
+            reader.read(k.interval);
+            has_interval = true;
+        } else if (key == "status") {
+            k.status = conversions::string_to_registration_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_currentTime, "currentTime");
+    reader.require_member(has_interval, "interval");
+    reader.require_member(has_status, "status");
+}
+
+void validate_boot_notification_response(JsonValidator& validator) {
+    bool has_currentTime = false;
+    bool has_interval = false;
+    bool has_status = false;
+    validator.object("BootNotificationResponse", [&](std::string_view key) {
+        if (key == "currentTime") {
+            validator.date_time();
+            has_currentTime = true;
+        } else if (key == "interval") {
+            validator.integer();
+            has_interval = true;
+        } else if (key == "status") {
+            validator.enumeration(conversions::string_to_registration_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_currentTime, "BootNotificationResponse.currentTime");
+    validator.require_member(has_interval, "BootNotificationResponse.interval");
+    validator.require_member(has_status, "BootNotificationResponse.status");
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
@@ -44,6 +44,55 @@ void from_json(const json& j, CertificateSignedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateChain", k.certificateChain);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateType) {
+        writer.member("certificateType",
+                      conversions::certificate_signing_use_enum_to_string(k.certificateType.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CertificateSignedRequest& k) {
+    bool has_certificateChain = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateChain") {
+            reader.read(k.certificateChain);
+            has_certificateChain = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "certificateType") {
+            k.certificateType.emplace(conversions::string_to_certificate_signing_use_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateChain, "certificateChain");
+}
+
+void validate_certificate_signed_request(JsonValidator& validator) {
+    bool has_certificateChain = false;
+    validator.object("CertificateSignedRequest", [&](std::string_view key) {
+        if (key == "certificateChain") {
+            validator.string(10000);
+            has_certificateChain = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "certificateType") {
+            validator.enumeration(conversions::string_to_certificate_signing_use_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateChain, "CertificateSignedRequest.certificateChain");
+}
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k) {
@@ -82,6 +131,54 @@ void from_json(const json& j, CertificateSignedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::certificate_signed_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CertificateSignedResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_certificate_signed_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_certificate_signed_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("CertificateSignedResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_certificate_signed_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "CertificateSignedResponse.status");
+}
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k) {
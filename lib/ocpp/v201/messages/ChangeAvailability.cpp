@@ -44,6 +44,54 @@ void from_json(const json& j, ChangeAvailabilityRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("operationalStatus", conversions::operational_status_enum_to_string(k.operationalStatus));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeAvailabilityRequest& k) {
+    bool has_operationalStatus = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "operationalStatus") {
+            k.operationalStatus = conversions::string_to_operational_status_enum(reader.read_string());
+            has_operationalStatus = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evse") {
+            reader.read(k.evse);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_operationalStatus, "operationalStatus");
+}
+
+void validate_change_availability_request(JsonValidator& validator) {
+    bool has_operationalStatus = false;
+    validator.object("ChangeAvailabilityRequest", [&](std::string_view key) {
+        if (key == "operationalStatus") {
+            validator.enumeration(conversions::string_to_operational_status_enum);
+            has_operationalStatus = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evse") {
+            validate_evse(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_operationalStatus, "ChangeAvailabilityRequest.operationalStatus");
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k) {
@@ -82,6 +130,54 @@ void from_json(const json& j, ChangeAvailabilityResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::change_availability_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChangeAvailabilityResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_change_availability_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_change_availability_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ChangeAvailabilityResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_change_availability_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ChangeAvailabilityResponse.status");
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k) {
@@ -35,6 +35,36 @@ void from_json(const json& j, ClearCacheRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearCacheRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_clear_cache_request(JsonValidator& validator) {
+    validator.object("ClearCacheRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -73,6 +103,54 @@ void from_json(const json& j, ClearCacheResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_cache_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearCacheResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_cache_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_clear_cache_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ClearCacheResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_cache_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearCacheResponse.status");
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
@@ -47,6 +47,50 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingProfileId) {
+        writer.member("chargingProfileId", k.chargingProfileId.value());
+    }
+    if (k.chargingProfileCriteria) {
+        writer.member("chargingProfileCriteria", k.chargingProfileCriteria.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearChargingProfileRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "chargingProfileId") {
+            reader.read(k.chargingProfileId);
+        } else if (key == "chargingProfileCriteria") {
+            reader.read(k.chargingProfileCriteria);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_clear_charging_profile_request(JsonValidator& validator) {
+    validator.object("ClearChargingProfileRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "chargingProfileId") {
+            validator.integer();
+        } else if (key == "chargingProfileCriteria") {
+            validate_clear_charging_profile(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k) {
@@ -85,6 +129,54 @@ void from_json(const json& j, ClearChargingProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearChargingProfileResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_charging_profile_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_clear_charging_profile_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ClearChargingProfileResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_charging_profile_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearChargingProfileResponse.status");
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k) {
@@ -38,6 +38,47 @@ void from_json(const json& j, ClearDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearDisplayMessageRequest& k) {
+    bool has_id = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+}
+
+void validate_clear_display_message_request(JsonValidator& validator) {
+    bool has_id = false;
+    validator.object("ClearDisplayMessageRequest", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "ClearDisplayMessageRequest.id");
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k) {
@@ -76,6 +117,54 @@ void from_json(const json& j, ClearDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearDisplayMessageResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_message_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_clear_display_message_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ClearDisplayMessageResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_message_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearDisplayMessageResponse.status");
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k) {
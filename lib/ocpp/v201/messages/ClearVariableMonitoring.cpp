@@ -40,6 +40,47 @@ void from_json(const json& j, ClearVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearVariableMonitoringRequest& k) {
+    bool has_id = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+}
+
+void validate_clear_variable_monitoring_request(JsonValidator& validator) {
+    bool has_id = false;
+    validator.object("ClearVariableMonitoringRequest", [&](std::string_view key) {
+        if (key == "id") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validator.integer(); });
+            has_id = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "ClearVariableMonitoringRequest.id");
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k) {
@@ -74,6 +115,47 @@ void from_json(const json& j, ClearVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("clearMonitoringResult", k.clearMonitoringResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearVariableMonitoringResponse& k) {
+    bool has_clearMonitoringResult = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "clearMonitoringResult") {
+            reader.read(k.clearMonitoringResult);
+            has_clearMonitoringResult = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_clearMonitoringResult, "clearMonitoringResult");
+}
+
+void validate_clear_variable_monitoring_response(JsonValidator& validator) {
+    bool has_clearMonitoringResult = false;
+    validator.object("ClearVariableMonitoringResponse", [&](std::string_view key) {
+        if (key == "clearMonitoringResult") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_clear_monitoring_result(validator); });
+            has_clearMonitoringResult = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_clearMonitoringResult, "ClearVariableMonitoringResponse.clearMonitoringResult");
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k) {
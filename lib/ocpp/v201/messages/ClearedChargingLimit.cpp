@@ -44,6 +44,54 @@ void from_json(const json& j, ClearedChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearedChargingLimitRequest& k) {
+    bool has_chargingLimitSource = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingLimitSource") {
+            k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(reader.read_string());
+            has_chargingLimitSource = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingLimitSource, "chargingLimitSource");
+}
+
+void validate_cleared_charging_limit_request(JsonValidator& validator) {
+    bool has_chargingLimitSource = false;
+    validator.object("ClearedChargingLimitRequest", [&](std::string_view key) {
+        if (key == "chargingLimitSource") {
+            validator.enumeration(conversions::string_to_charging_limit_source_enum);
+            has_chargingLimitSource = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingLimitSource, "ClearedChargingLimitRequest.chargingLimitSource");
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k) {
@@ -73,6 +121,36 @@ void from_json(const json& j, ClearedChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ClearedChargingLimitResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_cleared_charging_limit_response(JsonValidator& validator) {
+    validator.object("ClearedChargingLimitResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k) {
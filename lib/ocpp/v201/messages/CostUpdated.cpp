@@ -40,6 +40,58 @@ void from_json(const json& j, CostUpdatedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("totalCost", k.totalCost);
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CostUpdatedRequest& k) {
+    bool has_totalCost = false;
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "totalCost") {
+            reader.read(k.totalCost);
+            has_totalCost = true;
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_totalCost, "totalCost");
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+void validate_cost_updated_request(JsonValidator& validator) {
+    bool has_totalCost = false;
+    bool has_transactionId = false;
+    validator.object("CostUpdatedRequest", [&](std::string_view key) {
+        if (key == "totalCost") {
+            validator.number();
+            has_totalCost = true;
+        } else if (key == "transactionId") {
+            validator.string(36);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_totalCost, "CostUpdatedRequest.totalCost");
+    validator.require_member(has_transactionId, "CostUpdatedRequest.transactionId");
+}
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k) {
@@ -69,6 +121,36 @@ void from_json(const json& j, CostUpdatedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CostUpdatedResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_cost_updated_response(JsonValidator& validator) {
+    validator.object("CostUpdatedResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k) {
@@ -60,6 +60,90 @@ void from_json(const json& j, CustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("report", k.report);
+    writer.member("clear", k.clear);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.customerCertificate) {
+        writer.member("customerCertificate", k.customerCertificate.value());
+    }
+    if (k.idToken) {
+        writer.member("idToken", k.idToken.value());
+    }
+    if (k.customerIdentifier) {
+        writer.member("customerIdentifier", k.customerIdentifier.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CustomerInformationRequest& k) {
+    bool has_requestId = false;
+    bool has_report = false;
+    bool has_clear = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "report") {
+            reader.read(k.report);
+            has_report = true;
+        } else if (key == "clear") {
+            reader.read(k.clear);
+            has_clear = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "customerCertificate") {
+            reader.read(k.customerCertificate);
+        } else if (key == "idToken") {
+            reader.read(k.idToken);
+        } else if (key == "customerIdentifier") {
+            reader.read(k.customerIdentifier);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_report, "report");
+    reader.require_member(has_clear, "clear");
+}
+
+void validate_customer_information_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_report = false;
+    bool has_clear = false;
+    validator.object("CustomerInformationRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "report") {
+            validator.boolean();
+            has_report = true;
+        } else if (key == "clear") {
+            validator.boolean();
+            has_clear = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "customerCertificate") {
+            validate_certificate_hash_data_type(validator);
+        } else if (key == "idToken") {
+            validate_id_token(validator);
+        } else if (key == "customerIdentifier") {
+            validator.string(64);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "CustomerInformationRequest.requestId");
+    validator.require_member(has_report, "CustomerInformationRequest.report");
+    validator.require_member(has_clear, "CustomerInformationRequest.clear");
+}
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k) {
@@ -98,6 +182,54 @@ void from_json(const json& j, CustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::customer_information_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CustomerInformationResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_customer_information_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_customer_information_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("CustomerInformationResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_customer_information_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "CustomerInformationResponse.status");
+}
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k) {
@@ -50,6 +50,61 @@ void from_json(const json& j, DataTransferRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("vendorId", k.vendorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.messageId) {
+        writer.member("messageId", k.messageId.value());
+    }
+    if (k.data) {
+        writer.member("data", k.data.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, DataTransferRequest& k) {
+    bool has_vendorId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "vendorId") {
+            reader.read(k.vendorId);
+            has_vendorId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "messageId") {
+            reader.read(k.messageId);
+        } else if (key == "data") {
+            reader.read(k.data);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_vendorId, "vendorId");
+}
+
+void validate_data_transfer_request(JsonValidator& validator) {
+    bool has_vendorId = false;
+    validator.object("DataTransferRequest", [&](std::string_view key) {
+        if (key == "vendorId") {
+            validator.string(255);
+            has_vendorId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "messageId") {
+            validator.string(50);
+        } else if (key == "data") {
+            validator.any();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_vendorId, "DataTransferRequest.vendorId");
+}
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k) {
@@ -94,6 +149,61 @@ void from_json(const json& j, DataTransferResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::data_transfer_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.data) {
+        writer.member("data", k.data.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, DataTransferResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_data_transfer_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "data") {
+            reader.read(k.data);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_data_transfer_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("DataTransferResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_data_transfer_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "data") {
+            validator.any();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "DataTransferResponse.status");
+}
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k) {
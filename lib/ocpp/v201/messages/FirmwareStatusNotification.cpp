@@ -44,6 +44,54 @@ void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, FirmwareStatusNotificationRequest& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_firmware_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_firmware_status_notification_request(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("FirmwareStatusNotificationRequest", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_firmware_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "requestId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "FirmwareStatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k) {
@@ -73,6 +121,36 @@ void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, FirmwareStatusNotificationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_firmware_status_notification_response(JsonValidator& validator) {
+    validator.object("FirmwareStatusNotificationResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k) {
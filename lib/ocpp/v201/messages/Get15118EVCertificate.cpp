@@ -42,6 +42,69 @@ void from_json(const json& j, Get15118EVCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("iso15118SchemaVersion", k.iso15118SchemaVersion);
+    writer.member("action", conversions::certificate_action_enum_to_string(k.action));
+    writer.member("exiRequest", k.exiRequest);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Get15118EVCertificateRequest& k) {
+    bool has_iso15118SchemaVersion = false;
+    bool has_action = false;
+    bool has_exiRequest = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "iso15118SchemaVersion") {
+            reader.read(k.iso15118SchemaVersion);
+            has_iso15118SchemaVersion = true;
+        } else if (key == "action") {
+            k.action = conversions::string_to_certificate_action_enum(reader.read_string());
+            has_action = true;
+        } else if (key == "exiRequest") {
+            reader.read(k.exiRequest);
+            has_exiRequest = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_iso15118SchemaVersion, "iso15118SchemaVersion");
+    reader.require_member(has_action, "action");
+    reader.require_member(has_exiRequest, "exiRequest");
+}
+
+void validate_get15118evcertificate_request(JsonValidator& validator) {
+    bool has_iso15118SchemaVersion = false;
+    bool has_action = false;
+    bool has_exiRequest = false;
+    validator.object("Get15118EVCertificateRequest", [&](std::string_view key) {
+        if (key == "iso15118SchemaVersion") {
+            validator.string(50);
+            has_iso15118SchemaVersion = true;
+        } else if (key == "action") {
+            validator.enumeration(conversions::string_to_certificate_action_enum);
+            has_action = true;
+        } else if (key == "exiRequest") {
+            validator.string(7500);
+            has_exiRequest = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_iso15118SchemaVersion, "Get15118EVCertificateRequest.iso15118SchemaVersion");
+    validator.require_member(has_action, "Get15118EVCertificateRequest.action");
+    validator.require_member(has_exiRequest, "Get15118EVCertificateRequest.exiRequest");
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k) {
@@ -82,6 +145,65 @@ void from_json(const json& j, Get15118EVCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::iso15118evcertificate_status_enum_to_string(k.status));
+    writer.member("exiResponse", k.exiResponse);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Get15118EVCertificateResponse& k) {
+    bool has_status = false;
+    bool has_exiResponse = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_iso15118evcertificate_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "exiResponse") {
+            reader.read(k.exiResponse);
+            has_exiResponse = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+    reader.require_member(has_exiResponse, "exiResponse");
+}
+
+void validate_get15118evcertificate_response(JsonValidator& validator) {
+    bool has_status = false;
+    bool has_exiResponse = false;
+    validator.object("Get15118EVCertificateResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_iso15118evcertificate_status_enum);
+            has_status = true;
+        } else if (key == "exiResponse") {
+            validator.string(7500);
+            has_exiResponse = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "Get15118EVCertificateResponse.status");
+    validator.require_member(has_exiResponse, "Get15118EVCertificateResponse.exiResponse");
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k) {
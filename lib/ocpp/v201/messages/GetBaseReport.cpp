@@ -40,6 +40,58 @@ void from_json(const json& j, GetBaseReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("reportBase", conversions::report_base_enum_to_string(k.reportBase));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetBaseReportRequest& k) {
+    bool has_requestId = false;
+    bool has_reportBase = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "reportBase") {
+            k.reportBase = conversions::string_to_report_base_enum(reader.read_string());
+            has_reportBase = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_reportBase, "reportBase");
+}
+
+void validate_get_base_report_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_reportBase = false;
+    validator.object("GetBaseReportRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "reportBase") {
+            validator.enumeration(conversions::string_to_report_base_enum);
+            has_reportBase = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "GetBaseReportRequest.requestId");
+    validator.require_member(has_reportBase, "GetBaseReportRequest.reportBase");
+}
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k) {
@@ -78,6 +130,54 @@ void from_json(const json& j, GetBaseReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetBaseReportResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_device_model_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_base_report_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetBaseReportResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_device_model_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetBaseReportResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k) {
@@ -38,6 +38,47 @@ void from_json(const json& j, GetCertificateStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("ocspRequestData", k.ocspRequestData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCertificateStatusRequest& k) {
+    bool has_ocspRequestData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "ocspRequestData") {
+            reader.read(k.ocspRequestData);
+            has_ocspRequestData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_ocspRequestData, "ocspRequestData");
+}
+
+void validate_get_certificate_status_request(JsonValidator& validator) {
+    bool has_ocspRequestData = false;
+    validator.object("GetCertificateStatusRequest", [&](std::string_view key) {
+        if (key == "ocspRequestData") {
+            validate_ocsprequest_data(validator);
+            has_ocspRequestData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_ocspRequestData, "GetCertificateStatusRequest.ocspRequestData");
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k) {
@@ -82,6 +123,61 @@ void from_json(const json& j, GetCertificateStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.ocspResult) {
+        writer.member("ocspResult", k.ocspResult.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCertificateStatusResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_certificate_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "ocspResult") {
+            reader.read(k.ocspResult);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_certificate_status_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetCertificateStatusResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_certificate_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "ocspResult") {
+            validator.string(5500);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetCertificateStatusResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k) {
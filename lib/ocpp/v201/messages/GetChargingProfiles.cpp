@@ -46,6 +46,65 @@ void from_json(const json& j, GetChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("chargingProfile", k.chargingProfile);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetChargingProfilesRequest& k) {
+    bool has_requestId = false;
+    bool has_chargingProfile = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "chargingProfile") {
+            reader.read(k.chargingProfile);
+            has_chargingProfile = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_chargingProfile, "chargingProfile");
+}
+
+void validate_get_charging_profiles_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_chargingProfile = false;
+    validator.object("GetChargingProfilesRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "chargingProfile") {
+            validate_charging_profile_criterion(validator);
+            has_chargingProfile = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "GetChargingProfilesRequest.requestId");
+    validator.require_member(has_chargingProfile, "GetChargingProfilesRequest.chargingProfile");
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k) {
@@ -84,6 +143,54 @@ void from_json(const json& j, GetChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetChargingProfilesResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_charging_profile_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_charging_profiles_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetChargingProfilesResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_charging_profile_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetChargingProfilesResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k) {
@@ -46,6 +46,65 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("duration", k.duration);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingRateUnit) {
+        writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCompositeScheduleRequest& k) {
+    bool has_duration = false;
+    bool has_evseId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "duration") {
+            reader.read(k.duration);
+            has_duration = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "chargingRateUnit") {
+            k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_duration, "duration");
+    reader.require_member(has_evseId, "evseId");
+}
+
+void validate_get_composite_schedule_request(JsonValidator& validator) {
+    bool has_duration = false;
+    bool has_evseId = false;
+    validator.object("GetCompositeScheduleRequest", [&](std::string_view key) {
+        if (key == "duration") {
+            validator.integer();
+            has_duration = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "chargingRateUnit") {
+            validator.enumeration(conversions::string_to_charging_rate_unit_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_duration, "GetCompositeScheduleRequest.duration");
+    validator.require_member(has_evseId, "GetCompositeScheduleRequest.evseId");
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k) {
@@ -90,6 +149,61 @@ void from_json(const json& j, GetCompositeScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.schedule) {
+        writer.member("schedule", k.schedule.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetCompositeScheduleResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "schedule") {
+            reader.read(k.schedule);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_composite_schedule_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetCompositeScheduleResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "schedule") {
+            validate_composite_schedule(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetCompositeScheduleResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k) {
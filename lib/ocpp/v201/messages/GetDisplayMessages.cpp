@@ -64,6 +64,68 @@ void from_json(const json& j, GetDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.priority) {
+        writer.member("priority", conversions::message_priority_enum_to_string(k.priority.value()));
+    }
+    if (k.state) {
+        writer.member("state", conversions::message_state_enum_to_string(k.state.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetDisplayMessagesRequest& k) {
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "id") {
+            reader.read(k.id);
+        } else if (key == "priority") {
+            k.priority.emplace(conversions::string_to_message_priority_enum(reader.read_string()));
+        } else if (key == "state") {
+            k.state.emplace(conversions::string_to_message_state_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_get_display_messages_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    validator.object("GetDisplayMessagesRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "id") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validator.integer(); });
+        } else if (key == "priority") {
+            validator.enumeration(conversions::string_to_message_priority_enum);
+        } else if (key == "state") {
+            validator.enumeration(conversions::string_to_message_state_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "GetDisplayMessagesRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesRequest& k) {
@@ -102,6 +164,54 @@ void from_json(const json& j, GetDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_display_messages_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetDisplayMessagesResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_display_messages_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_display_messages_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetDisplayMessagesResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_display_messages_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetDisplayMessagesResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k) {
@@ -53,6 +53,52 @@ void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.begin_array();
+        for (const auto& val : k.certificateType.value()) {
+            writer.value(conversions::get_certificate_id_use_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetInstalledCertificateIdsRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "certificateType") {
+            k.certificateType.emplace();
+            reader.read_array([&]() {
+                k.certificateType->push_back(conversions::string_to_get_certificate_id_use_enum(reader.read_string()));
+            });
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_installed_certificate_ids_request(JsonValidator& validator) {
+    validator.object("GetInstalledCertificateIdsRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "certificateType") {
+            validator.array(1, JsonValidator::unbounded,
+                            [&]() { validator.enumeration(conversions::string_to_get_certificate_id_use_enum); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k) {
@@ -105,6 +151,61 @@ void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_installed_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.certificateHashDataChain) {
+        writer.member("certificateHashDataChain", k.certificateHashDataChain.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetInstalledCertificateIdsResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_get_installed_certificate_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "certificateHashDataChain") {
+            reader.read(k.certificateHashDataChain);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_installed_certificate_ids_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetInstalledCertificateIdsResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_get_installed_certificate_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "certificateHashDataChain") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_certificate_hash_data_chain(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetInstalledCertificateIdsResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k) {
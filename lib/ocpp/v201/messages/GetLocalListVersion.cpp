@@ -35,6 +35,36 @@ void from_json(const json& j, GetLocalListVersionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetLocalListVersionRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_local_list_version_request(JsonValidator& validator) {
+    validator.object("GetLocalListVersionRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k) {
@@ -67,6 +97,47 @@ void from_json(const json& j, GetLocalListVersionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("versionNumber", k.versionNumber);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetLocalListVersionResponse& k) {
+    bool has_versionNumber = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "versionNumber") {
+            reader.read(k.versionNumber);
+            has_versionNumber = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_versionNumber, "versionNumber");
+}
+
+void validate_get_local_list_version_response(JsonValidator& validator) {
+    bool has_versionNumber = false;
+    validator.object("GetLocalListVersionResponse", [&](std::string_view key) {
+        if (key == "versionNumber") {
+            validator.integer();
+            has_versionNumber = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_versionNumber, "GetLocalListVersionResponse.versionNumber");
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k) {
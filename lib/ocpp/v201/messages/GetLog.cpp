@@ -54,6 +54,83 @@ void from_json(const json& j, GetLogRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("log", k.log);
+    writer.member("logType", conversions::log_enum_to_string(k.logType));
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetLogRequest& k) {
+    bool has_log = false;
+    bool has_logType = false;
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "log") {
+            reader.read(k.log);
+            has_log = true;
+        } else if (key == "logType") {
+            k.logType = conversions::string_to_log_enum(reader.read_string());
+            has_logType = true;
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_log, "log");
+    reader.require_member(has_logType, "logType");
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_get_log_request(JsonValidator& validator) {
+    bool has_log = false;
+    bool has_logType = false;
+    bool has_requestId = false;
+    validator.object("GetLogRequest", [&](std::string_view key) {
+        if (key == "log") {
+            validate_log_parameters(validator);
+            has_log = true;
+        } else if (key == "logType") {
+            validator.enumeration(conversions::string_to_log_enum);
+            has_logType = true;
+        } else if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_log, "GetLogRequest.log");
+    validator.require_member(has_logType, "GetLogRequest.logType");
+    validator.require_member(has_requestId, "GetLogRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k) {
@@ -98,6 +175,61 @@ void from_json(const json& j, GetLogResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::log_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.filename) {
+        writer.member("filename", k.filename.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetLogResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_log_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "filename") {
+            reader.read(k.filename);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_log_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetLogResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_log_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "filename") {
+            validator.string(255);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetLogResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k) {
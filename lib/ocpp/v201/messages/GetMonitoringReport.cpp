@@ -66,6 +66,69 @@ void from_json(const json& j, GetMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.componentVariable) {
+        writer.member("componentVariable", k.componentVariable.value());
+    }
+    if (k.monitoringCriteria) {
+        writer.key("monitoringCriteria");
+        writer.begin_array();
+        for (const auto& val : k.monitoringCriteria.value()) {
+            writer.value(conversions::monitoring_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetMonitoringReportRequest& k) {
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "componentVariable") {
+            reader.read(k.componentVariable);
+        } else if (key == "monitoringCriteria") {
+            k.monitoringCriteria.emplace();
+            reader.read_array([&]() {
+                k.monitoringCriteria->push_back(conversions::string_to_monitoring_criterion_enum(reader.read_string()));
+            });
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_get_monitoring_report_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    validator.object("GetMonitoringReportRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "componentVariable") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_component_variable(validator); });
+        } else if (key == "monitoringCriteria") {
+            validator.array(1, 3, [&]() { validator.enumeration(conversions::string_to_monitoring_criterion_enum); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "GetMonitoringReportRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k) {
@@ -104,6 +167,54 @@ void from_json(const json& j, GetMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetMonitoringReportResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_device_model_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_get_monitoring_report_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("GetMonitoringReportResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_device_model_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "GetMonitoringReportResponse.status");
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k) {
@@ -41,6 +41,43 @@ void from_json(const json& j, GetTransactionStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetTransactionStatusRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_get_transaction_status_request(JsonValidator& validator) {
+    validator.object("GetTransactionStatusRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "transactionId") {
+            validator.string(36);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k) {
@@ -79,6 +116,54 @@ void from_json(const json& j, GetTransactionStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("messagesInQueue", k.messagesInQueue);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.ongoingIndicator) {
+        writer.member("ongoingIndicator", k.ongoingIndicator.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetTransactionStatusResponse& k) {
+    bool has_messagesInQueue = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "messagesInQueue") {
+            reader.read(k.messagesInQueue);
+            has_messagesInQueue = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "ongoingIndicator") {
+            reader.read(k.ongoingIndicator);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_messagesInQueue, "messagesInQueue");
+}
+
+void validate_get_transaction_status_response(JsonValidator& validator) {
+    bool has_messagesInQueue = false;
+    validator.object("GetTransactionStatusResponse", [&](std::string_view key) {
+        if (key == "messagesInQueue") {
+            validator.boolean();
+            has_messagesInQueue = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "ongoingIndicator") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_messagesInQueue, "GetTransactionStatusResponse.messagesInQueue");
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k) {
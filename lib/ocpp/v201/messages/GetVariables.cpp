@@ -40,6 +40,47 @@ void from_json(const json& j, GetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("getVariableData", k.getVariableData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariablesRequest& k) {
+    bool has_getVariableData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "getVariableData") {
+            reader.read(k.getVariableData);
+            has_getVariableData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_getVariableData, "getVariableData");
+}
+
+void validate_get_variables_request(JsonValidator& validator) {
+    bool has_getVariableData = false;
+    validator.object("GetVariablesRequest", [&](std::string_view key) {
+        if (key == "getVariableData") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_get_variable_data(validator); });
+            has_getVariableData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_getVariableData, "GetVariablesRequest.getVariableData");
+}
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k) {
@@ -74,6 +115,47 @@ void from_json(const json& j, GetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("getVariableResult", k.getVariableResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariablesResponse& k) {
+    bool has_getVariableResult = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "getVariableResult") {
+            reader.read(k.getVariableResult);
+            has_getVariableResult = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_getVariableResult, "getVariableResult");
+}
+
+void validate_get_variables_response(JsonValidator& validator) {
+    bool has_getVariableResult = false;
+    validator.object("GetVariablesResponse", [&](std::string_view key) {
+        if (key == "getVariableResult") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_get_variable_result(validator); });
+            has_getVariableResult = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_getVariableResult, "GetVariablesResponse.getVariableResult");
+}
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k) {
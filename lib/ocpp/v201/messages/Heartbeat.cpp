@@ -35,6 +35,36 @@ void from_json(const json& j, HeartbeatRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, HeartbeatRequest& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_heartbeat_request(JsonValidator& validator) {
+    validator.object("HeartbeatRequest", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k) {
@@ -67,6 +97,47 @@ void from_json(const json& j, HeartbeatResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, HeartbeatResponse& k) {
+    bool has_currentTime = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "currentTime") {
+            reader.read(k.currentTime);
+            has_currentTime = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_currentTime, "currentTime");
+}
+
+void validate_heartbeat_response(JsonValidator& validator) {
+    bool has_currentTime = false;
+    validator.object("HeartbeatResponse", [&](std::string_view key) {
+        if (key == "currentTime") {
+            validator.date_time();
+            has_currentTime = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_currentTime, "HeartbeatResponse.currentTime");
+}
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k) {
@@ -40,6 +40,58 @@ void from_json(const json& j, InstallCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateType", conversions::install_certificate_use_enum_to_string(k.certificateType));
+    writer.member("certificate", k.certificate);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, InstallCertificateRequest& k) {
+    bool has_certificateType = false;
+    bool has_certificate = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateType") {
+            k.certificateType = conversions::string_to_install_certificate_use_enum(reader.read_string());
+            has_certificateType = true;
+        } else if (key == "certificate") {
+            reader.read(k.certificate);
+            has_certificate = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateType, "certificateType");
+    reader.require_member(has_certificate, "certificate");
+}
+
+void validate_install_certificate_request(JsonValidator& validator) {
+    bool has_certificateType = false;
+    bool has_certificate = false;
+    validator.object("InstallCertificateRequest", [&](std::string_view key) {
+        if (key == "certificateType") {
+            validator.enumeration(conversions::string_to_install_certificate_use_enum);
+            has_certificateType = true;
+        } else if (key == "certificate") {
+            validator.string(5500);
+            has_certificate = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateType, "InstallCertificateRequest.certificateType");
+    validator.require_member(has_certificate, "InstallCertificateRequest.certificate");
+}
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k) {
@@ -78,6 +130,54 @@ void from_json(const json& j, InstallCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::install_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, InstallCertificateResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_install_certificate_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_install_certificate_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("InstallCertificateResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_install_certificate_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "InstallCertificateResponse.status");
+}
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k) {
@@ -42,6 +42,58 @@ void from_json(const json& j, MeterValuesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("meterValue", k.meterValue);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesRequest& k) {
+    bool has_evseId = false;
+    bool has_meterValue = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "meterValue") {
+            reader.read(k.meterValue);
+            has_meterValue = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_evseId, "evseId");
+    reader.require_member(has_meterValue, "meterValue");
+}
+
+void validate_meter_values_request(JsonValidator& validator) {
+    bool has_evseId = false;
+    bool has_meterValue = false;
+    validator.object("MeterValuesRequest", [&](std::string_view key) {
+        if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "meterValue") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_meter_value(validator); });
+            has_meterValue = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_evseId, "MeterValuesRequest.evseId");
+    validator.require_member(has_meterValue, "MeterValuesRequest.meterValue");
+}
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k) {
@@ -71,6 +123,36 @@ void from_json(const json& j, MeterValuesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_meter_values_response(JsonValidator& validator) {
+    validator.object("MeterValuesResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k) {
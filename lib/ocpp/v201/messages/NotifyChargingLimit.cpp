@@ -58,6 +58,61 @@ void from_json(const json& j, NotifyChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingLimit", k.chargingLimit);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingSchedule) {
+        writer.member("chargingSchedule", k.chargingSchedule.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyChargingLimitRequest& k) {
+    bool has_chargingLimit = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingLimit") {
+            reader.read(k.chargingLimit);
+            has_chargingLimit = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "chargingSchedule") {
+            reader.read(k.chargingSchedule);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingLimit, "chargingLimit");
+}
+
+void validate_notify_charging_limit_request(JsonValidator& validator) {
+    bool has_chargingLimit = false;
+    validator.object("NotifyChargingLimitRequest", [&](std::string_view key) {
+        if (key == "chargingLimit") {
+            validate_charging_limit(validator);
+            has_chargingLimit = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "chargingSchedule") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_charging_schedule(validator); });
+        } else if (key == "evseId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingLimit, "NotifyChargingLimitRequest.chargingLimit");
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k) {
@@ -87,6 +142,36 @@ void from_json(const json& j, NotifyChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyChargingLimitResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_charging_limit_response(JsonValidator& validator) {
+    validator.object("NotifyChargingLimitResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k) {
@@ -50,6 +50,87 @@ void from_json(const json& j, NotifyCustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("data", k.data);
+    writer.member("seqNo", k.seqNo);
+    writer.member("generatedAt", k.generatedAt);
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyCustomerInformationRequest& k) {
+    bool has_data = false;
+    bool has_seqNo = false;
+    bool has_generatedAt = false;
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "data") {
+            reader.read(k.data);
+            has_data = true;
+        } else if (key == "seqNo") {
+            reader.read(k.seqNo);
+            has_seqNo = true;
+        } else if (key == "generatedAt") {
+            reader.read(k.generatedAt);
+            has_generatedAt = true;
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_data, "data");
+    reader.require_member(has_seqNo, "seqNo");
+    reader.require_member(has_generatedAt, "generatedAt");
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_notify_customer_information_request(JsonValidator& validator) {
+    bool has_data = false;
+    bool has_seqNo = false;
+    bool has_generatedAt = false;
+    bool has_requestId = false;
+    validator.object("NotifyCustomerInformationRequest", [&](std::string_view key) {
+        if (key == "data") {
+            validator.string(512);
+            has_data = true;
+        } else if (key == "seqNo") {
+            validator.integer();
+            has_seqNo = true;
+        } else if (key == "generatedAt") {
+            validator.date_time();
+            has_generatedAt = true;
+        } else if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_data, "NotifyCustomerInformationRequest.data");
+    validator.require_member(has_seqNo, "NotifyCustomerInformationRequest.seqNo");
+    validator.require_member(has_generatedAt, "NotifyCustomerInformationRequest.generatedAt");
+    validator.require_member(has_requestId, "NotifyCustomerInformationRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k) {
@@ -79,6 +160,36 @@ void from_json(const json& j, NotifyCustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyCustomerInformationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_customer_information_response(JsonValidator& validator) {
+    validator.object("NotifyCustomerInformationResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k) {
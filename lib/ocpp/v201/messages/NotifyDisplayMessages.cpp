@@ -58,6 +58,61 @@ void from_json(const json& j, NotifyDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.messageInfo) {
+        writer.member("messageInfo", k.messageInfo.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyDisplayMessagesRequest& k) {
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "messageInfo") {
+            reader.read(k.messageInfo);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_notify_display_messages_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    validator.object("NotifyDisplayMessagesRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "messageInfo") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_message_info(validator); });
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "NotifyDisplayMessagesRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k) {
@@ -87,6 +142,36 @@ void from_json(const json& j, NotifyDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyDisplayMessagesResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_display_messages_response(JsonValidator& validator) {
+    validator.object("NotifyDisplayMessagesResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k) {
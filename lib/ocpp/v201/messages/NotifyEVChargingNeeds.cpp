@@ -46,6 +46,65 @@ void from_json(const json& j, NotifyEVChargingNeedsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingNeeds", k.chargingNeeds);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.maxScheduleTuples) {
+        writer.member("maxScheduleTuples", k.maxScheduleTuples.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEVChargingNeedsRequest& k) {
+    bool has_chargingNeeds = false;
+    bool has_evseId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingNeeds") {
+            reader.read(k.chargingNeeds);
+            has_chargingNeeds = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "maxScheduleTuples") {
+            reader.read(k.maxScheduleTuples);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingNeeds, "chargingNeeds");
+    reader.require_member(has_evseId, "evseId");
+}
+
+void validate_notify_evcharging_needs_request(JsonValidator& validator) {
+    bool has_chargingNeeds = false;
+    bool has_evseId = false;
+    validator.object("NotifyEVChargingNeedsRequest", [&](std::string_view key) {
+        if (key == "chargingNeeds") {
+            validate_charging_needs(validator);
+            has_chargingNeeds = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "maxScheduleTuples") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingNeeds, "NotifyEVChargingNeedsRequest.chargingNeeds");
+    validator.require_member(has_evseId, "NotifyEVChargingNeedsRequest.evseId");
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k) {
@@ -84,6 +143,54 @@ void from_json(const json& j, NotifyEVChargingNeedsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::notify_evcharging_needs_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEVChargingNeedsResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_notify_evcharging_needs_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_notify_evcharging_needs_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("NotifyEVChargingNeedsResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_notify_evcharging_needs_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "NotifyEVChargingNeedsResponse.status");
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k) {
@@ -42,6 +42,69 @@ void from_json(const json& j, NotifyEVChargingScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("timeBase", k.timeBase);
+    writer.member("chargingSchedule", k.chargingSchedule);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEVChargingScheduleRequest& k) {
+    bool has_timeBase = false;
+    bool has_chargingSchedule = false;
+    bool has_evseId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "timeBase") {
+            reader.read(k.timeBase);
+            has_timeBase = true;
+        } else if (key == "chargingSchedule") {
+            reader.read(k.chargingSchedule);
+            has_chargingSchedule = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_timeBase, "timeBase");
+    reader.require_member(has_chargingSchedule, "chargingSchedule");
+    reader.require_member(has_evseId, "evseId");
+}
+
+void validate_notify_evcharging_schedule_request(JsonValidator& validator) {
+    bool has_timeBase = false;
+    bool has_chargingSchedule = false;
+    bool has_evseId = false;
+    validator.object("NotifyEVChargingScheduleRequest", [&](std::string_view key) {
+        if (key == "timeBase") {
+            validator.date_time();
+            has_timeBase = true;
+        } else if (key == "chargingSchedule") {
+            validate_charging_schedule(validator);
+            has_chargingSchedule = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_timeBase, "NotifyEVChargingScheduleRequest.timeBase");
+    validator.require_member(has_chargingSchedule, "NotifyEVChargingScheduleRequest.chargingSchedule");
+    validator.require_member(has_evseId, "NotifyEVChargingScheduleRequest.evseId");
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k) {
@@ -80,6 +143,54 @@ void from_json(const json& j, NotifyEVChargingScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEVChargingScheduleResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_notify_evcharging_schedule_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("NotifyEVChargingScheduleResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "NotifyEVChargingScheduleResponse.status");
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k) {
@@ -50,6 +50,76 @@ void from_json(const json& j, NotifyEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("generatedAt", k.generatedAt);
+    writer.member("seqNo", k.seqNo);
+    writer.member("eventData", k.eventData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEventRequest& k) {
+    bool has_generatedAt = false;
+    bool has_seqNo = false;
+    bool has_eventData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "generatedAt") {
+            reader.read(k.generatedAt);
+            has_generatedAt = true;
+        } else if (key == "seqNo") {
+            reader.read(k.seqNo);
+            has_seqNo = true;
+        } else if (key == "eventData") {
+            reader.read(k.eventData);
+            has_eventData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_generatedAt, "generatedAt");
+    reader.require_member(has_seqNo, "seqNo");
+    reader.require_member(has_eventData, "eventData");
+}
+
+void validate_notify_event_request(JsonValidator& validator) {
+    bool has_generatedAt = false;
+    bool has_seqNo = false;
+    bool has_eventData = false;
+    validator.object("NotifyEventRequest", [&](std::string_view key) {
+        if (key == "generatedAt") {
+            validator.date_time();
+            has_generatedAt = true;
+        } else if (key == "seqNo") {
+            validator.integer();
+            has_seqNo = true;
+        } else if (key == "eventData") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_event_data(validator); });
+            has_eventData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_generatedAt, "NotifyEventRequest.generatedAt");
+    validator.require_member(has_seqNo, "NotifyEventRequest.seqNo");
+    validator.require_member(has_eventData, "NotifyEventRequest.eventData");
+}
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k) {
@@ -79,6 +149,36 @@ void from_json(const json& j, NotifyEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyEventResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_event_response(JsonValidator& validator) {
+    validator.object("NotifyEventResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k) {
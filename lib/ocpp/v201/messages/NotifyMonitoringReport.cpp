@@ -62,6 +62,83 @@ void from_json(const json& j, NotifyMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("seqNo", k.seqNo);
+    writer.member("generatedAt", k.generatedAt);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.monitor) {
+        writer.member("monitor", k.monitor.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyMonitoringReportRequest& k) {
+    bool has_requestId = false;
+    bool has_seqNo = false;
+    bool has_generatedAt = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "seqNo") {
+            reader.read(k.seqNo);
+            has_seqNo = true;
+        } else if (key == "generatedAt") {
+            reader.read(k.generatedAt);
+            has_generatedAt = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "monitor") {
+            reader.read(k.monitor);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_seqNo, "seqNo");
+    reader.require_member(has_generatedAt, "generatedAt");
+}
+
+void validate_notify_monitoring_report_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_seqNo = false;
+    bool has_generatedAt = false;
+    validator.object("NotifyMonitoringReportRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "seqNo") {
+            validator.integer();
+            has_seqNo = true;
+        } else if (key == "generatedAt") {
+            validator.date_time();
+            has_generatedAt = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "monitor") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_monitoring_data(validator); });
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "NotifyMonitoringReportRequest.requestId");
+    validator.require_member(has_seqNo, "NotifyMonitoringReportRequest.seqNo");
+    validator.require_member(has_generatedAt, "NotifyMonitoringReportRequest.generatedAt");
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k) {
@@ -91,6 +168,36 @@ void from_json(const json& j, NotifyMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyMonitoringReportResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_monitoring_report_response(JsonValidator& validator) {
+    validator.object("NotifyMonitoringReportResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k) {
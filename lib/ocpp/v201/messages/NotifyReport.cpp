@@ -62,6 +62,83 @@ void from_json(const json& j, NotifyReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("generatedAt", k.generatedAt);
+    writer.member("seqNo", k.seqNo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.reportData) {
+        writer.member("reportData", k.reportData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyReportRequest& k) {
+    bool has_requestId = false;
+    bool has_generatedAt = false;
+    bool has_seqNo = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "generatedAt") {
+            reader.read(k.generatedAt);
+            has_generatedAt = true;
+        } else if (key == "seqNo") {
+            reader.read(k.seqNo);
+            has_seqNo = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "reportData") {
+            reader.read(k.reportData);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_generatedAt, "generatedAt");
+    reader.require_member(has_seqNo, "seqNo");
+}
+
+void validate_notify_report_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_generatedAt = false;
+    bool has_seqNo = false;
+    validator.object("NotifyReportRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "generatedAt") {
+            validator.date_time();
+            has_generatedAt = true;
+        } else if (key == "seqNo") {
+            validator.integer();
+            has_seqNo = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "reportData") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_report_data(validator); });
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "NotifyReportRequest.requestId");
+    validator.require_member(has_generatedAt, "NotifyReportRequest.generatedAt");
+    validator.require_member(has_seqNo, "NotifyReportRequest.seqNo");
+}
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k) {
@@ -91,6 +168,36 @@ void from_json(const json& j, NotifyReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyReportResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_notify_report_response(JsonValidator& validator) {
+    validator.object("NotifyReportResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k) {
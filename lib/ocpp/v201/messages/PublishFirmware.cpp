@@ -54,6 +54,83 @@ void from_json(const json& j, PublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("checksum", k.checksum);
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, PublishFirmwareRequest& k) {
+    bool has_location = false;
+    bool has_checksum = false;
+    bool has_requestId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "location") {
+            reader.read(k.location);
+            has_location = true;
+        } else if (key == "checksum") {
+            reader.read(k.checksum);
+            has_checksum = true;
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_location, "location");
+    reader.require_member(has_checksum, "checksum");
+    reader.require_member(has_requestId, "requestId");
+}
+
+void validate_publish_firmware_request(JsonValidator& validator) {
+    bool has_location = false;
+    bool has_checksum = false;
+    bool has_requestId = false;
+    validator.object("PublishFirmwareRequest", [&](std::string_view key) {
+        if (key == "location") {
+            validator.string(512);
+            has_location = true;
+        } else if (key == "checksum") {
+            validator.string(32);
+            has_checksum = true;
+        } else if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_location, "PublishFirmwareRequest.location");
+    validator.require_member(has_checksum, "PublishFirmwareRequest.checksum");
+    validator.require_member(has_requestId, "PublishFirmwareRequest.requestId");
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k) {
@@ -92,6 +169,54 @@ void from_json(const json& j, PublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, PublishFirmwareResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_publish_firmware_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("PublishFirmwareResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "PublishFirmwareResponse.status");
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k) {
@@ -58,6 +58,61 @@ void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::publish_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.location) {
+        writer.member("location", k.location.value());
+    }
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, PublishFirmwareStatusNotificationRequest& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_publish_firmware_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "location") {
+            reader.read(k.location);
+        } else if (key == "requestId") {
+            reader.read(k.requestId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_publish_firmware_status_notification_request(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("PublishFirmwareStatusNotificationRequest", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_publish_firmware_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "location") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validator.string(512); });
+        } else if (key == "requestId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "PublishFirmwareStatusNotificationRequest.status");
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k) {
@@ -87,6 +142,36 @@ void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, PublishFirmwareStatusNotificationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_publish_firmware_status_notification_response(JsonValidator& validator) {
+    validator.object("PublishFirmwareStatusNotificationResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k) {
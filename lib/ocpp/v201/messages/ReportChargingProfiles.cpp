@@ -52,6 +52,87 @@ void from_json(const json& j, ReportChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    writer.member("chargingProfile", k.chargingProfile);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReportChargingProfilesRequest& k) {
+    bool has_requestId = false;
+    bool has_chargingLimitSource = false;
+    bool has_chargingProfile = false;
+    bool has_evseId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "chargingLimitSource") {
+            k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(reader.read_string());
+            has_chargingLimitSource = true;
+        } else if (key == "chargingProfile") {
+            reader.read(k.chargingProfile);
+            has_chargingProfile = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "tbc") {
+            reader.read(k.tbc);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_chargingLimitSource, "chargingLimitSource");
+    reader.require_member(has_chargingProfile, "chargingProfile");
+    reader.require_member(has_evseId, "evseId");
+}
+
+void validate_report_charging_profiles_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_chargingLimitSource = false;
+    bool has_chargingProfile = false;
+    bool has_evseId = false;
+    validator.object("ReportChargingProfilesRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "chargingLimitSource") {
+            validator.enumeration(conversions::string_to_charging_limit_source_enum);
+            has_chargingLimitSource = true;
+        } else if (key == "chargingProfile") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_charging_profile(validator); });
+            has_chargingProfile = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "tbc") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "ReportChargingProfilesRequest.requestId");
+    validator.require_member(has_chargingLimitSource, "ReportChargingProfilesRequest.chargingLimitSource");
+    validator.require_member(has_chargingProfile, "ReportChargingProfilesRequest.chargingProfile");
+    validator.require_member(has_evseId, "ReportChargingProfilesRequest.evseId");
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k) {
@@ -81,6 +162,36 @@ void from_json(const json& j, ReportChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReportChargingProfilesResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_report_charging_profiles_response(JsonValidator& validator) {
+    validator.object("ReportChargingProfilesResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k) {
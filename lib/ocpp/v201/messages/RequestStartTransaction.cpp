@@ -58,6 +58,79 @@ void from_json(const json& j, RequestStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    writer.member("remoteStartId", k.remoteStartId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    if (k.chargingProfile) {
+        writer.member("chargingProfile", k.chargingProfile.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RequestStartTransactionRequest& k) {
+    bool has_idToken = false;
+    bool has_remoteStartId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idToken") {
+            reader.read(k.idToken);
+            has_idToken = true;
+        } else if (key == "remoteStartId") {
+            reader.read(k.remoteStartId);
+            has_remoteStartId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else if (key == "groupIdToken") {
+            reader.read(k.groupIdToken);
+        } else if (key == "chargingProfile") {
+            reader.read(k.chargingProfile);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idToken, "idToken");
+    reader.require_member(has_remoteStartId, "remoteStartId");
+}
+
+void validate_request_start_transaction_request(JsonValidator& validator) {
+    bool has_idToken = false;
+    bool has_remoteStartId = false;
+    validator.object("RequestStartTransactionRequest", [&](std::string_view key) {
+        if (key == "idToken") {
+            validate_id_token(validator);
+            has_idToken = true;
+        } else if (key == "remoteStartId") {
+            validator.integer();
+            has_remoteStartId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else if (key == "groupIdToken") {
+            validate_id_token(validator);
+        } else if (key == "chargingProfile") {
+            validate_charging_profile(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idToken, "RequestStartTransactionRequest.idToken");
+    validator.require_member(has_remoteStartId, "RequestStartTransactionRequest.remoteStartId");
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k) {
@@ -102,6 +175,61 @@ void from_json(const json& j, RequestStartTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::request_start_stop_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RequestStartTransactionResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_request_start_stop_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_request_start_transaction_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("RequestStartTransactionResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_request_start_stop_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else if (key == "transactionId") {
+            validator.string(36);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "RequestStartTransactionResponse.status");
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k) {
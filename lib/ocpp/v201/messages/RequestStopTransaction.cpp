@@ -38,6 +38,47 @@ void from_json(const json& j, RequestStopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RequestStopTransactionRequest& k) {
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+void validate_request_stop_transaction_request(JsonValidator& validator) {
+    bool has_transactionId = false;
+    validator.object("RequestStopTransactionRequest", [&](std::string_view key) {
+        if (key == "transactionId") {
+            validator.string(36);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_transactionId, "RequestStopTransactionRequest.transactionId");
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k) {
@@ -76,6 +117,54 @@ void from_json(const json& j, RequestStopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::request_start_stop_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, RequestStopTransactionResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_request_start_stop_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_request_stop_transaction_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("RequestStopTransactionResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_request_start_stop_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "RequestStopTransactionResponse.status");
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k) {
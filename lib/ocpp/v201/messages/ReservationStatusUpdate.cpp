@@ -40,6 +40,59 @@ void from_json(const json& j, ReservationStatusUpdateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("reservationId", k.reservationId);
+    writer.member("reservationUpdateStatus",
+                  conversions::reservation_update_status_enum_to_string(k.reservationUpdateStatus));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReservationStatusUpdateRequest& k) {
+    bool has_reservationId = false;
+    bool has_reservationUpdateStatus = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "reservationId") {
+            reader.read(k.reservationId);
+            has_reservationId = true;
+        } else if (key == "reservationUpdateStatus") {
+            k.reservationUpdateStatus = conversions::string_to_reservation_update_status_enum(reader.read_string());
+            has_reservationUpdateStatus = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_reservationId, "reservationId");
+    reader.require_member(has_reservationUpdateStatus, "reservationUpdateStatus");
+}
+
+void validate_reservation_status_update_request(JsonValidator& validator) {
+    bool has_reservationId = false;
+    bool has_reservationUpdateStatus = false;
+    validator.object("ReservationStatusUpdateRequest", [&](std::string_view key) {
+        if (key == "reservationId") {
+            validator.integer();
+            has_reservationId = true;
+        } else if (key == "reservationUpdateStatus") {
+            validator.enumeration(conversions::string_to_reservation_update_status_enum);
+            has_reservationUpdateStatus = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_reservationId, "ReservationStatusUpdateRequest.reservationId");
+    validator.require_member(has_reservationUpdateStatus, "ReservationStatusUpdateRequest.reservationUpdateStatus");
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k) {
@@ -69,6 +122,36 @@ void from_json(const json& j, ReservationStatusUpdateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReservationStatusUpdateResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_reservation_status_update_response(JsonValidator& validator) {
+    validator.object("ReservationStatusUpdateResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k) {
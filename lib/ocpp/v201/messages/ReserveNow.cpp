@@ -60,6 +60,90 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("expiryDateTime", k.expiryDateTime);
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.connectorType) {
+        writer.member("connectorType", conversions::connector_enum_to_string(k.connectorType.value()));
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReserveNowRequest& k) {
+    bool has_id = false;
+    bool has_expiryDateTime = false;
+    bool has_idToken = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "expiryDateTime") {
+            reader.read(k.expiryDateTime);
+            has_expiryDateTime = true;
+        } else if (key == "idToken") {
+            reader.read(k.idToken);
+            has_idToken = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "connectorType") {
+            k.connectorType.emplace(conversions::string_to_connector_enum(reader.read_string()));
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else if (key == "groupIdToken") {
+            reader.read(k.groupIdToken);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_expiryDateTime, "expiryDateTime");
+    reader.require_member(has_idToken, "idToken");
+}
+
+void validate_reserve_now_request(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_expiryDateTime = false;
+    bool has_idToken = false;
+    validator.object("ReserveNowRequest", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "expiryDateTime") {
+            validator.date_time();
+            has_expiryDateTime = true;
+        } else if (key == "idToken") {
+            validate_id_token(validator);
+            has_idToken = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "connectorType") {
+            validator.enumeration(conversions::string_to_connector_enum);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else if (key == "groupIdToken") {
+            validate_id_token(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "ReserveNowRequest.id");
+    validator.require_member(has_expiryDateTime, "ReserveNowRequest.expiryDateTime");
+    validator.require_member(has_idToken, "ReserveNowRequest.idToken");
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -98,6 +182,54 @@ void from_json(const json& j, ReserveNowResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::reserve_now_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReserveNowResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_reserve_now_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_reserve_now_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ReserveNowResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_reserve_now_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ReserveNowResponse.status");
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
@@ -44,6 +44,54 @@ void from_json(const json& j, ResetRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("type", conversions::reset_enum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ResetRequest& k) {
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "type") {
+            k.type = conversions::string_to_reset_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_type, "type");
+}
+
+void validate_reset_request(JsonValidator& validator) {
+    bool has_type = false;
+    validator.object("ResetRequest", [&](std::string_view key) {
+        if (key == "type") {
+            validator.enumeration(conversions::string_to_reset_enum);
+            has_type = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_type, "ResetRequest.type");
+}
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k) {
@@ -82,6 +130,54 @@ void from_json(const json& j, ResetResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::reset_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ResetResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_reset_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_reset_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("ResetResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_reset_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ResetResponse.status");
+}
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k) {
@@ -46,6 +46,65 @@ void from_json(const json& j, SecurityEventNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("type", k.type);
+    writer.member("timestamp", k.timestamp);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.techInfo) {
+        writer.member("techInfo", k.techInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SecurityEventNotificationRequest& k) {
+    bool has_type = false;
+    bool has_timestamp = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "type") {
+            reader.read(k.type);
+            has_type = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "techInfo") {
+            reader.read(k.techInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_type, "type");
+    reader.require_member(has_timestamp, "timestamp");
+}
+
+void validate_security_event_notification_request(JsonValidator& validator) {
+    bool has_type = false;
+    bool has_timestamp = false;
+    validator.object("SecurityEventNotificationRequest", [&](std::string_view key) {
+        if (key == "type") {
+            validator.string(50);
+            has_type = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "techInfo") {
+            validator.string(255);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_type, "SecurityEventNotificationRequest.type");
+    validator.require_member(has_timestamp, "SecurityEventNotificationRequest.timestamp");
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k) {
@@ -75,6 +134,36 @@ void from_json(const json& j, SecurityEventNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SecurityEventNotificationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_security_event_notification_response(JsonValidator& validator) {
+    validator.object("SecurityEventNotificationResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k) {
@@ -54,6 +54,65 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("versionNumber", k.versionNumber);
+    writer.member("updateType", conversions::update_enum_to_string(k.updateType));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.localAuthorizationList) {
+        writer.member("localAuthorizationList", k.localAuthorizationList.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SendLocalListRequest& k) {
+    bool has_versionNumber = false;
+    bool has_updateType = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "versionNumber") {
+            reader.read(k.versionNumber);
+            has_versionNumber = true;
+        } else if (key == "updateType") {
+            k.updateType = conversions::string_to_update_enum(reader.read_string());
+            has_updateType = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "localAuthorizationList") {
+            reader.read(k.localAuthorizationList);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_versionNumber, "versionNumber");
+    reader.require_member(has_updateType, "updateType");
+}
+
+void validate_send_local_list_request(JsonValidator& validator) {
+    bool has_versionNumber = false;
+    bool has_updateType = false;
+    validator.object("SendLocalListRequest", [&](std::string_view key) {
+        if (key == "versionNumber") {
+            validator.integer();
+            has_versionNumber = true;
+        } else if (key == "updateType") {
+            validator.enumeration(conversions::string_to_update_enum);
+            has_updateType = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "localAuthorizationList") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_authorization_data(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_versionNumber, "SendLocalListRequest.versionNumber");
+    validator.require_member(has_updateType, "SendLocalListRequest.updateType");
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -92,6 +151,54 @@ void from_json(const json& j, SendLocalListResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::send_local_list_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SendLocalListResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_send_local_list_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_send_local_list_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SendLocalListResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_send_local_list_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SendLocalListResponse.status");
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
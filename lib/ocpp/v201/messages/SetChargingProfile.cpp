@@ -40,6 +40,58 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("chargingProfile", k.chargingProfile);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetChargingProfileRequest& k) {
+    bool has_evseId = false;
+    bool has_chargingProfile = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "chargingProfile") {
+            reader.read(k.chargingProfile);
+            has_chargingProfile = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_evseId, "evseId");
+    reader.require_member(has_chargingProfile, "chargingProfile");
+}
+
+void validate_set_charging_profile_request(JsonValidator& validator) {
+    bool has_evseId = false;
+    bool has_chargingProfile = false;
+    validator.object("SetChargingProfileRequest", [&](std::string_view key) {
+        if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "chargingProfile") {
+            validate_charging_profile(validator);
+            has_chargingProfile = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_evseId, "SetChargingProfileRequest.evseId");
+    validator.require_member(has_chargingProfile, "SetChargingProfileRequest.chargingProfile");
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -78,6 +130,54 @@ void from_json(const json& j, SetChargingProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetChargingProfileResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_charging_profile_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_charging_profile_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetChargingProfileResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_charging_profile_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetChargingProfileResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
@@ -38,6 +38,47 @@ void from_json(const json& j, SetDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("message", k.message);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetDisplayMessageRequest& k) {
+    bool has_message = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "message") {
+            reader.read(k.message);
+            has_message = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_message, "message");
+}
+
+void validate_set_display_message_request(JsonValidator& validator) {
+    bool has_message = false;
+    validator.object("SetDisplayMessageRequest", [&](std::string_view key) {
+        if (key == "message") {
+            validate_message_info(validator);
+            has_message = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_message, "SetDisplayMessageRequest.message");
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k) {
@@ -76,6 +117,54 @@ void from_json(const json& j, SetDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::display_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetDisplayMessageResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_display_message_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_display_message_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetDisplayMessageResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_display_message_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetDisplayMessageResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k) {
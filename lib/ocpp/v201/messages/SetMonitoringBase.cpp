@@ -38,6 +38,47 @@ void from_json(const json& j, SetMonitoringBaseRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("monitoringBase", conversions::monitoring_base_enum_to_string(k.monitoringBase));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetMonitoringBaseRequest& k) {
+    bool has_monitoringBase = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "monitoringBase") {
+            k.monitoringBase = conversions::string_to_monitoring_base_enum(reader.read_string());
+            has_monitoringBase = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_monitoringBase, "monitoringBase");
+}
+
+void validate_set_monitoring_base_request(JsonValidator& validator) {
+    bool has_monitoringBase = false;
+    validator.object("SetMonitoringBaseRequest", [&](std::string_view key) {
+        if (key == "monitoringBase") {
+            validator.enumeration(conversions::string_to_monitoring_base_enum);
+            has_monitoringBase = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_monitoringBase, "SetMonitoringBaseRequest.monitoringBase");
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k) {
@@ -76,6 +117,54 @@ void from_json(const json& j, SetMonitoringBaseResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetMonitoringBaseResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_device_model_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_monitoring_base_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetMonitoringBaseResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_device_model_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetMonitoringBaseResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k) {
@@ -38,6 +38,47 @@ void from_json(const json& j, SetMonitoringLevelRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetMonitoringLevelRequest& k) {
+    bool has_severity = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "severity") {
+            reader.read(k.severity);
+            has_severity = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_severity, "severity");
+}
+
+void validate_set_monitoring_level_request(JsonValidator& validator) {
+    bool has_severity = false;
+    validator.object("SetMonitoringLevelRequest", [&](std::string_view key) {
+        if (key == "severity") {
+            validator.integer();
+            has_severity = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_severity, "SetMonitoringLevelRequest.severity");
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k) {
@@ -76,6 +117,54 @@ void from_json(const json& j, SetMonitoringLevelResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetMonitoringLevelResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_generic_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_monitoring_level_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetMonitoringLevelResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_generic_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetMonitoringLevelResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k) {
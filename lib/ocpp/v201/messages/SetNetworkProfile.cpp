@@ -40,6 +40,58 @@ void from_json(const json& j, SetNetworkProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("configurationSlot", k.configurationSlot);
+    writer.member("connectionData", k.connectionData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetNetworkProfileRequest& k) {
+    bool has_configurationSlot = false;
+    bool has_connectionData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "configurationSlot") {
+            reader.read(k.configurationSlot);
+            has_configurationSlot = true;
+        } else if (key == "connectionData") {
+            reader.read(k.connectionData);
+            has_connectionData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_configurationSlot, "configurationSlot");
+    reader.require_member(has_connectionData, "connectionData");
+}
+
+void validate_set_network_profile_request(JsonValidator& validator) {
+    bool has_configurationSlot = false;
+    bool has_connectionData = false;
+    validator.object("SetNetworkProfileRequest", [&](std::string_view key) {
+        if (key == "configurationSlot") {
+            validator.integer();
+            has_configurationSlot = true;
+        } else if (key == "connectionData") {
+            validate_network_connection_profile(validator);
+            has_connectionData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_configurationSlot, "SetNetworkProfileRequest.configurationSlot");
+    validator.require_member(has_connectionData, "SetNetworkProfileRequest.connectionData");
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k) {
@@ -78,6 +130,54 @@ void from_json(const json& j, SetNetworkProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::set_network_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetNetworkProfileResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_set_network_profile_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_set_network_profile_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("SetNetworkProfileResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_set_network_profile_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetNetworkProfileResponse.status");
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k) {
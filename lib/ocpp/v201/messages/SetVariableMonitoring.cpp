@@ -40,6 +40,47 @@ void from_json(const json& j, SetVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("setMonitoringData", k.setMonitoringData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariableMonitoringRequest& k) {
+    bool has_setMonitoringData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "setMonitoringData") {
+            reader.read(k.setMonitoringData);
+            has_setMonitoringData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_setMonitoringData, "setMonitoringData");
+}
+
+void validate_set_variable_monitoring_request(JsonValidator& validator) {
+    bool has_setMonitoringData = false;
+    validator.object("SetVariableMonitoringRequest", [&](std::string_view key) {
+        if (key == "setMonitoringData") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_set_monitoring_data(validator); });
+            has_setMonitoringData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_setMonitoringData, "SetVariableMonitoringRequest.setMonitoringData");
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k) {
@@ -74,6 +115,47 @@ void from_json(const json& j, SetVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("setMonitoringResult", k.setMonitoringResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariableMonitoringResponse& k) {
+    bool has_setMonitoringResult = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "setMonitoringResult") {
+            reader.read(k.setMonitoringResult);
+            has_setMonitoringResult = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_setMonitoringResult, "setMonitoringResult");
+}
+
+void validate_set_variable_monitoring_response(JsonValidator& validator) {
+    bool has_setMonitoringResult = false;
+    validator.object("SetVariableMonitoringResponse", [&](std::string_view key) {
+        if (key == "setMonitoringResult") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_set_monitoring_result(validator); });
+            has_setMonitoringResult = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_setMonitoringResult, "SetVariableMonitoringResponse.setMonitoringResult");
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k) {
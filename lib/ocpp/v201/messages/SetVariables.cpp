@@ -40,6 +40,47 @@ void from_json(const json& j, SetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("setVariableData", k.setVariableData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariablesRequest& k) {
+    bool has_setVariableData = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "setVariableData") {
+            reader.read(k.setVariableData);
+            has_setVariableData = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_setVariableData, "setVariableData");
+}
+
+void validate_set_variables_request(JsonValidator& validator) {
+    bool has_setVariableData = false;
+    validator.object("SetVariablesRequest", [&](std::string_view key) {
+        if (key == "setVariableData") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_set_variable_data(validator); });
+            has_setVariableData = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_setVariableData, "SetVariablesRequest.setVariableData");
+}
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k) {
@@ -74,6 +115,47 @@ void from_json(const json& j, SetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("setVariableResult", k.setVariableResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariablesResponse& k) {
+    bool has_setVariableResult = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "setVariableResult") {
+            reader.read(k.setVariableResult);
+            has_setVariableResult = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_setVariableResult, "setVariableResult");
+}
+
+void validate_set_variables_response(JsonValidator& validator) {
+    bool has_setVariableResult = false;
+    validator.object("SetVariablesResponse", [&](std::string_view key) {
+        if (key == "setVariableResult") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_set_variable_result(validator); });
+            has_setVariableResult = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_setVariableResult, "SetVariablesResponse.setVariableResult");
+}
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k) {
@@ -44,6 +44,80 @@ void from_json(const json& j, StatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp);
+    writer.member("connectorStatus", conversions::connector_status_enum_to_string(k.connectorStatus));
+    writer.member("evseId", k.evseId);
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StatusNotificationRequest& k) {
+    bool has_timestamp = false;
+    bool has_connectorStatus = false;
+    bool has_evseId = false;
+    bool has_connectorId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "connectorStatus") {
+            k.connectorStatus = conversions::string_to_connector_status_enum(reader.read_string());
+            has_connectorStatus = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_connectorStatus, "connectorStatus");
+    reader.require_member(has_evseId, "evseId");
+    reader.require_member(has_connectorId, "connectorId");
+}
+
+void validate_status_notification_request(JsonValidator& validator) {
+    bool has_timestamp = false;
+    bool has_connectorStatus = false;
+    bool has_evseId = false;
+    bool has_connectorId = false;
+    validator.object("StatusNotificationRequest", [&](std::string_view key) {
+        if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "connectorStatus") {
+            validator.enumeration(conversions::string_to_connector_status_enum);
+            has_connectorStatus = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_timestamp, "StatusNotificationRequest.timestamp");
+    validator.require_member(has_connectorStatus, "StatusNotificationRequest.connectorStatus");
+    validator.require_member(has_evseId, "StatusNotificationRequest.evseId");
+    validator.require_member(has_connectorId, "StatusNotificationRequest.connectorId");
+}
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k) {
@@ -73,6 +147,36 @@ void from_json(const json& j, StatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StatusNotificationResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_status_notification_response(JsonValidator& validator) {
+    validator.object("StatusNotificationResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k) {
@@ -96,6 +96,140 @@ void from_json(const json& j, TransactionEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("eventType", conversions::transaction_event_enum_to_string(k.eventType));
+    writer.member("timestamp", k.timestamp);
+    writer.member("triggerReason", conversions::trigger_reason_enum_to_string(k.triggerReason));
+    writer.member("seqNo", k.seqNo);
+    writer.member("transactionInfo", k.transactionInfo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.meterValue) {
+        writer.member("meterValue", k.meterValue.value());
+    }
+    if (k.offline) {
+        writer.member("offline", k.offline.value());
+    }
+    if (k.numberOfPhasesUsed) {
+        writer.member("numberOfPhasesUsed", k.numberOfPhasesUsed.value());
+    }
+    if (k.cableMaxCurrent) {
+        writer.member("cableMaxCurrent", k.cableMaxCurrent.value());
+    }
+    if (k.reservationId) {
+        writer.member("reservationId", k.reservationId.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    if (k.idToken) {
+        writer.member("idToken", k.idToken.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionEventRequest& k) {
+    bool has_eventType = false;
+    bool has_timestamp = false;
+    bool has_triggerReason = false;
+    bool has_seqNo = false;
+    bool has_transactionInfo = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "eventType") {
+            k.eventType = conversions::string_to_transaction_event_enum(reader.read_string());
+            has_eventType = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "triggerReason") {
+            k.triggerReason = conversions::string_to_trigger_reason_enum(reader.read_string());
+            has_triggerReason = true;
+        } else if (key == "seqNo") {
+            reader.read(k.seqNo);
+            has_seqNo = true;
+        } else if (key == "transactionInfo") {
+            reader.read(k.transactionInfo);
+            has_transactionInfo = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "meterValue") {
+            reader.read(k.meterValue);
+        } else if (key == "offline") {
+            reader.read(k.offline);
+        } else if (key == "numberOfPhasesUsed") {
+            reader.read(k.numberOfPhasesUsed);
+        } else if (key == "cableMaxCurrent") {
+            reader.read(k.cableMaxCurrent);
+        } else if (key == "reservationId") {
+            reader.read(k.reservationId);
+        } else if (key == "evse") {
+            reader.read(k.evse);
+        } else if (key == "idToken") {
+            reader.read(k.idToken);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_eventType, "eventType");
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_triggerReason, "triggerReason");
+    reader.require_member(has_seqNo, "seqNo");
+    reader.require_member(has_transactionInfo, "transactionInfo");
+}
+
+void validate_transaction_event_request(JsonValidator& validator) {
+    bool has_eventType = false;
+    bool has_timestamp = false;
+    bool has_triggerReason = false;
+    bool has_seqNo = false;
+    bool has_transactionInfo = false;
+    validator.object("TransactionEventRequest", [&](std::string_view key) {
+        if (key == "eventType") {
+            validator.enumeration(conversions::string_to_transaction_event_enum);
+            has_eventType = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "triggerReason") {
+            validator.enumeration(conversions::string_to_trigger_reason_enum);
+            has_triggerReason = true;
+        } else if (key == "seqNo") {
+            validator.integer();
+            has_seqNo = true;
+        } else if (key == "transactionInfo") {
+            validate_transaction(validator);
+            has_transactionInfo = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "meterValue") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_meter_value(validator); });
+        } else if (key == "offline") {
+            validator.boolean();
+        } else if (key == "numberOfPhasesUsed") {
+            validator.integer();
+        } else if (key == "cableMaxCurrent") {
+            validator.integer();
+        } else if (key == "reservationId") {
+            validator.integer();
+        } else if (key == "evse") {
+            validate_evse(validator);
+        } else if (key == "idToken") {
+            validate_id_token(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_eventType, "TransactionEventRequest.eventType");
+    validator.require_member(has_timestamp, "TransactionEventRequest.timestamp");
+    validator.require_member(has_triggerReason, "TransactionEventRequest.triggerReason");
+    validator.require_member(has_seqNo, "TransactionEventRequest.seqNo");
+    validator.require_member(has_transactionInfo, "TransactionEventRequest.transactionInfo");
+}
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k) {
@@ -149,6 +283,64 @@ void from_json(const json& j, TransactionEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.totalCost) {
+        writer.member("totalCost", k.totalCost.value());
+    }
+    if (k.chargingPriority) {
+        writer.member("chargingPriority", k.chargingPriority.value());
+    }
+    if (k.idTokenInfo) {
+        writer.member("idTokenInfo", k.idTokenInfo.value());
+    }
+    if (k.updatedPersonalMessage) {
+        writer.member("updatedPersonalMessage", k.updatedPersonalMessage.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionEventResponse& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "totalCost") {
+            reader.read(k.totalCost);
+        } else if (key == "chargingPriority") {
+            reader.read(k.chargingPriority);
+        } else if (key == "idTokenInfo") {
+            reader.read(k.idTokenInfo);
+        } else if (key == "updatedPersonalMessage") {
+            reader.read(k.updatedPersonalMessage);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+void validate_transaction_event_response(JsonValidator& validator) {
+    validator.object("TransactionEventResponse", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "totalCost") {
+            validator.number();
+        } else if (key == "chargingPriority") {
+            validator.integer();
+        } else if (key == "idTokenInfo") {
+            validate_id_token_info(validator);
+        } else if (key == "updatedPersonalMessage") {
+            validate_message_content(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k) {
@@ -44,6 +44,54 @@ void from_json(const json& j, TriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestedMessage", conversions::message_trigger_enum_to_string(k.requestedMessage));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TriggerMessageRequest& k) {
+    bool has_requestedMessage = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestedMessage") {
+            k.requestedMessage = conversions::string_to_message_trigger_enum(reader.read_string());
+            has_requestedMessage = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evse") {
+            reader.read(k.evse);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestedMessage, "requestedMessage");
+}
+
+void validate_trigger_message_request(JsonValidator& validator) {
+    bool has_requestedMessage = false;
+    validator.object("TriggerMessageRequest", [&](std::string_view key) {
+        if (key == "requestedMessage") {
+            validator.enumeration(conversions::string_to_message_trigger_enum);
+            has_requestedMessage = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evse") {
+            validate_evse(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestedMessage, "TriggerMessageRequest.requestedMessage");
+}
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k) {
@@ -82,6 +130,54 @@ void from_json(const json& j, TriggerMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::trigger_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TriggerMessageResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_trigger_message_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_trigger_message_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("TriggerMessageResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_trigger_message_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "TriggerMessageResponse.status");
+}
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k) {
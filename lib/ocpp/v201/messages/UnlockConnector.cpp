@@ -40,6 +40,58 @@ void from_json(const json& j, UnlockConnectorRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnlockConnectorRequest& k) {
+    bool has_evseId = false;
+    bool has_connectorId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+            has_connectorId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_evseId, "evseId");
+    reader.require_member(has_connectorId, "connectorId");
+}
+
+void validate_unlock_connector_request(JsonValidator& validator) {
+    bool has_evseId = false;
+    bool has_connectorId = false;
+    validator.object("UnlockConnectorRequest", [&](std::string_view key) {
+        if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "connectorId") {
+            validator.integer();
+            has_connectorId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_evseId, "UnlockConnectorRequest.evseId");
+    validator.require_member(has_connectorId, "UnlockConnectorRequest.connectorId");
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k) {
@@ -78,6 +130,54 @@ void from_json(const json& j, UnlockConnectorResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::unlock_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnlockConnectorResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_unlock_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_unlock_connector_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("UnlockConnectorResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_unlock_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "UnlockConnectorResponse.status");
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k) {
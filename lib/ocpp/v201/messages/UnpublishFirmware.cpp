@@ -38,6 +38,47 @@ void from_json(const json& j, UnpublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("checksum", k.checksum);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnpublishFirmwareRequest& k) {
+    bool has_checksum = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "checksum") {
+            reader.read(k.checksum);
+            has_checksum = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_checksum, "checksum");
+}
+
+void validate_unpublish_firmware_request(JsonValidator& validator) {
+    bool has_checksum = false;
+    validator.object("UnpublishFirmwareRequest", [&](std::string_view key) {
+        if (key == "checksum") {
+            validator.string(32);
+            has_checksum = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_checksum, "UnpublishFirmwareRequest.checksum");
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k) {
@@ -70,6 +111,47 @@ void from_json(const json& j, UnpublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::unpublish_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnpublishFirmwareResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_unpublish_firmware_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_unpublish_firmware_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("UnpublishFirmwareResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_unpublish_firmware_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "UnpublishFirmwareResponse.status");
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k) {
@@ -52,6 +52,72 @@ void from_json(const json& j, UpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("firmware", k.firmware);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UpdateFirmwareRequest& k) {
+    bool has_requestId = false;
+    bool has_firmware = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestId") {
+            reader.read(k.requestId);
+            has_requestId = true;
+        } else if (key == "firmware") {
+            reader.read(k.firmware);
+            has_firmware = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "retries") {
+            reader.read(k.retries);
+        } else if (key == "retryInterval") {
+            reader.read(k.retryInterval);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestId, "requestId");
+    reader.require_member(has_firmware, "firmware");
+}
+
+void validate_update_firmware_request(JsonValidator& validator) {
+    bool has_requestId = false;
+    bool has_firmware = false;
+    validator.object("UpdateFirmwareRequest", [&](std::string_view key) {
+        if (key == "requestId") {
+            validator.integer();
+            has_requestId = true;
+        } else if (key == "firmware") {
+            validate_firmware(validator);
+            has_firmware = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "retries") {
+            validator.integer();
+        } else if (key == "retryInterval") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestId, "UpdateFirmwareRequest.requestId");
+    validator.require_member(has_firmware, "UpdateFirmwareRequest.firmware");
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k) {
@@ -90,6 +156,54 @@ void from_json(const json& j, UpdateFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UpdateFirmwareResponse& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_update_firmware_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+void validate_update_firmware_response(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("UpdateFirmwareResponse", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_update_firmware_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "UpdateFirmwareResponse.status");
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k) {
@@ -2,15 +2,20 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <everest/logging.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v201/notify_report_requests_splitter.hpp>
 
 namespace ocpp {
 namespace v201 {
 
-const std::string NotifyReportRequestsSplitter::MESSAGE_TYPE =
-    conversions::messagetype_to_string(MessageType::NotifyReport);
+const std::string NotifyReportRequestsSplitter::MESSAGE_TYPE{
+    conversions::messagetype_to_string(MessageType::NotifyReport)};
 
 std::vector<json> NotifyReportRequestsSplitter::create_call_payloads() {
+    if (this->original_request == nullptr) {
+        throw std::logic_error("NotifyReportRequestsSplitter has been created without a NotifyReportRequest to split");
+    }
+    const auto& original_request = *this->original_request;
 
     // In case there is no report data, fallback to no-splitting call creation
     if (!original_request.reportData.has_value()) {
@@ -20,85 +25,119 @@ std::vector<json> NotifyReportRequestsSplitter::create_call_payloads() {
 
     // Loop along reportData and create payloads
     std::vector<json> payloads{};
-    int seq_no = 0;
-
-    auto report_data_iterator = original_request.reportData->begin();
-    while (seq_no == 0 || report_data_iterator != original_request.reportData->end()) {
-        payloads.emplace_back(create_next_payload(seq_no, report_data_iterator, original_request.reportData->end(),
-                                                  message_id_generator_callback().get()));
-        seq_no++;
-    }
+    this->payload_callback = [&payloads](const MessageId& message_id, std::string&& payload) {
+        payloads.push_back(json{MessageTypeId::CALL, message_id, MESSAGE_TYPE, json::parse(payload)});
+    };
 
-    if (seq_no > 1) {
-        EVLOG_info << "Split NotifyReportRequest '" << original_request.requestId << "' into " << seq_no
-                   << " messages.";
+    for (const auto& report_data : original_request.reportData.value()) {
+        this->add(report_data);
     }
+    this->finish();
 
     return payloads;
 }
 
-json NotifyReportRequestsSplitter::create_next_report_data_json(
-    std::vector<ocpp::v201::ReportData>::const_iterator& report_data_iterator,
-    const std::vector<ocpp::v201::ReportData>::const_iterator& report_data_end, const size_t& remaining_size) {
-
-    if (report_data_iterator == report_data_end) {
-        return json::array();
+void NotifyReportRequestsSplitter::add(const ReportData& report_data) {
+    if (!this->message_id.has_value()) {
+        this->start_payload();
     }
 
-    json report_data_json{*report_data_iterator};
-    report_data_iterator++;
-    if (report_data_iterator == report_data_end) {
-        return report_data_json;
+    // the report data is serialized into the current payload right away, its size is known afterwards
+    const auto previous_size = this->payload_buffer.size();
+    if (this->report_data_count > 0) {
+        this->payload_buffer.push_back(',');
     }
+    JsonWriter writer(this->payload_buffer);
+    writer.value(report_data);
+    const auto report_data_size = this->payload_buffer.size() - previous_size;
+
+    if (this->report_data_count > 0 and this->payload_size + report_data_size > this->max_size) {
+        // the report data does not fit anymore, so it is moved to the next payload without its separating comma
+        std::string serialized_report_data = this->payload_buffer.substr(previous_size + 1);
+        this->payload_buffer.resize(previous_size);
+        this->complete_payload(true);
+        this->start_payload();
+        this->payload_buffer.append(serialized_report_data);
+        this->payload_size += serialized_report_data.size();
+    } else {
+        this->payload_size += report_data_size;
+    }
+    this->report_data_count++;
+}
 
-    auto size = report_data_json.dump().size();
-
-    for (; report_data_iterator != report_data_end; report_data_iterator++) {
-        json current_json = *report_data_iterator;
-        // new report data object will increase payload size by its dump + 1 (caused by the separating comma)
-        auto additional_json_size = current_json.dump().size() + 1;
-        if (size + additional_json_size <= remaining_size) {
-            size += additional_json_size;
-            report_data_json.emplace_back(std::move(current_json));
-        } else {
-            break;
+void NotifyReportRequestsSplitter::finish() {
+    if (!this->message_id.has_value()) {
+        if (this->seq_no > 0) {
+            return;
         }
+        this->start_payload();
     }
+    this->complete_payload(false);
 
-    return report_data_json;
+    if (this->seq_no > 1) {
+        EVLOG_info << "Split NotifyReportRequest '" << this->request_json_template.at("requestId") << "' into "
+                   << this->seq_no << " messages.";
+    }
 }
 
-json NotifyReportRequestsSplitter::create_next_payload(
-    const int& seq_no, std::vector<ocpp::v201::ReportData>::const_iterator& report_data_iterator,
-    const std::vector<ocpp::v201::ReportData>::const_iterator& report_data_end, const std::string& message_id) {
+void NotifyReportRequestsSplitter::start_payload() {
+    this->message_id = this->message_id_generator_callback();
+    // reportData is written first, so the report data can be serialized into the payload before tbc is known
+    this->payload_buffer.clear();
+    this->payload_buffer.append(R"({"reportData":[)");
+    this->report_data_count = 0;
 
-    json call_base{MessageTypeId::CALL, message_id, MESSAGE_TYPE};
-
-    size_t base_json_string_length = this->json_skeleton_size + message_id.size();
-    size_t remaining_size = this->max_size >= base_json_string_length ? this->max_size - base_json_string_length : 0;
+    // the skeleton contains a seqNo of 0 and an empty messageId, reportData is written as [] for now
+    this->payload_size = this->json_skeleton_size + this->message_id->get().size() +
+                         std::to_string(this->seq_no).size() - 1 + std::string{"[]"}.size();
+}
 
-    auto request_json = request_json_template;
-    request_json["reportData"] = create_next_report_data_json(report_data_iterator, report_data_end, remaining_size);
-    request_json["tbc"] = report_data_iterator != report_data_end;
-    request_json["seqNo"] = seq_no;
+void NotifyReportRequestsSplitter::complete_payload(bool tbc) {
+    this->payload_buffer.append("],");
+    JsonWriter writer(this->payload_buffer);
+    for (const auto& [key, value] : this->request_json_template.items()) {
+        if (key != "tbc" and key != "seqNo") {
+            writer.member(key, value);
+        }
+    }
+    writer.member("tbc", tbc);
+    writer.member("seqNo", this->seq_no);
+    this->payload_buffer.push_back('}');
 
-    call_base.emplace_back(request_json);
+    const auto message_id = std::move(this->message_id.value());
+    this->message_id.reset();
+    this->seq_no++;
 
-    return call_base;
+    this->payload_callback(message_id, std::move(this->payload_buffer));
+    this->payload_buffer = std::string();
 }
+
 NotifyReportRequestsSplitter::NotifyReportRequestsSplitter(const NotifyReportRequest& originalRequest, size_t max_size,
                                                            std::function<MessageId()>&& message_id_generator_callback) :
-    original_request(originalRequest),
+    NotifyReportRequestsSplitter(originalRequest, max_size, std::move(message_id_generator_callback), nullptr) {
+    this->original_request = &originalRequest;
+}
+
+NotifyReportRequestsSplitter::NotifyReportRequestsSplitter(const NotifyReportRequest& request_template,
+                                                           size_t max_size,
+                                                           std::function<MessageId()>&& message_id_generator_callback,
+                                                           PayloadCallback&& payload_callback) :
+    original_request(nullptr),
     max_size(max_size),
     message_id_generator_callback{std::move(message_id_generator_callback)},
-    json_skeleton_size(create_request_template_json_and_return_skeleton_size()) {
+    payload_callback{std::move(payload_callback)},
+    json_skeleton_size(create_request_template_json_and_return_skeleton_size(request_template)),
+    report_data_count(0),
+    payload_size(0),
+    seq_no(0) {
 }
 
-size_t NotifyReportRequestsSplitter::create_request_template_json_and_return_skeleton_size() {
+size_t NotifyReportRequestsSplitter::create_request_template_json_and_return_skeleton_size(
+    const NotifyReportRequest& request) {
 
     NotifyReportRequest req{};
-    req.requestId = original_request.requestId;
-    req.generatedAt = original_request.generatedAt;
+    req.requestId = request.requestId;
+    req.generatedAt = request.generatedAt;
     req.tbc = false;
     this->request_json_template = req;
 
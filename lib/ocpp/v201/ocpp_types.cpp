@@ -13,6 +13,20 @@
 namespace ocpp {
 namespace v201 {
 
+/// \brief Validates the next value of the given \p validator against the schema of a CustomData
+void validate_custom_data(JsonValidator& validator) {
+    bool has_vendorId = false;
+    validator.object("CustomData", [&](std::string_view key) {
+        if (key == "vendorId") {
+            validator.string(255);
+            has_vendorId = true;
+        } else {
+            validator.any();
+        }
+    });
+    validator.require_member(has_vendorId, "CustomData.vendorId");
+}
+
 /// \brief Conversion from a given AdditionalInfo \p k to a given json object \p j
 void to_json(json& j, const AdditionalInfo& k) {
     // the required parts of the message
@@ -38,6 +52,61 @@ void from_json(const json& j, AdditionalInfo& k) {
     }
 }
 
+/// \brief Writes the given AdditionalInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AdditionalInfo& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("additionalIdToken", k.additionalIdToken);
+    writer.member("type", k.type);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given AdditionalInfo \p k from the given \p reader
+void read_json(JsonReader& reader, AdditionalInfo& k) {
+    bool has_additionalIdToken = false;
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "additionalIdToken") {
+            reader.read(k.additionalIdToken);
+            has_additionalIdToken = true;
+        } else if (key == "type") {
+            reader.read(k.type);
+            has_type = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_additionalIdToken, "additionalIdToken");
+    reader.require_member(has_type, "type");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a AdditionalInfo
+void validate_additional_info(JsonValidator& validator) {
+    bool has_additionalIdToken = false;
+    bool has_type = false;
+    validator.object("AdditionalInfo", [&](std::string_view key) {
+        if (key == "additionalIdToken") {
+            validator.string(36);
+            has_additionalIdToken = true;
+        } else if (key == "type") {
+            validator.string(50);
+            has_type = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_additionalIdToken, "AdditionalInfo.additionalIdToken");
+    validator.require_member(has_type, "AdditionalInfo.type");
+}
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k) {
@@ -84,6 +153,68 @@ void from_json(const json& j, IdToken& k) {
     }
 }
 
+/// \brief Writes the given IdToken \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdToken& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    writer.member("type", conversions::id_token_enum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.additionalInfo) {
+        writer.member("additionalInfo", k.additionalInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given IdToken \p k from the given \p reader
+void read_json(JsonReader& reader, IdToken& k) {
+    bool has_idToken = false;
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idToken") {
+            reader.read(k.idToken);
+            has_idToken = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_id_token_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "additionalInfo") {
+            reader.read(k.additionalInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idToken, "idToken");
+    reader.require_member(has_type, "type");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdToken
+void validate_id_token(JsonValidator& validator) {
+    bool has_idToken = false;
+    bool has_type = false;
+    validator.object("IdToken", [&](std::string_view key) {
+        if (key == "idToken") {
+            validator.string(36);
+            has_idToken = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_id_token_enum);
+            has_type = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "additionalInfo") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_additional_info(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idToken, "IdToken.idToken");
+    validator.require_member(has_type, "IdToken.type");
+}
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k) {
@@ -122,6 +253,94 @@ void from_json(const json& j, OCSPRequestData& k) {
     }
 }
 
+/// \brief Writes the given OCSPRequestData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const OCSPRequestData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    writer.member("responderURL", k.responderURL);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given OCSPRequestData \p k from the given \p reader
+void read_json(JsonReader& reader, OCSPRequestData& k) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    bool has_responderURL = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(reader.read_string());
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            reader.read(k.issuerNameHash);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            reader.read(k.issuerKeyHash);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            reader.read(k.serialNumber);
+            has_serialNumber = true;
+        } else if (key == "responderURL") {
+            reader.read(k.responderURL);
+            has_responderURL = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_hashAlgorithm, "hashAlgorithm");
+    reader.require_member(has_issuerNameHash, "issuerNameHash");
+    reader.require_member(has_issuerKeyHash, "issuerKeyHash");
+    reader.require_member(has_serialNumber, "serialNumber");
+    reader.require_member(has_responderURL, "responderURL");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a OCSPRequestData
+void validate_ocsprequest_data(JsonValidator& validator) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    bool has_responderURL = false;
+    validator.object("OCSPRequestData", [&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            validator.enumeration(conversions::string_to_hash_algorithm_enum);
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            validator.string(128);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            validator.string(128);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            validator.string(40);
+            has_serialNumber = true;
+        } else if (key == "responderURL") {
+            validator.string(512);
+            has_responderURL = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_hashAlgorithm, "OCSPRequestData.hashAlgorithm");
+    validator.require_member(has_issuerNameHash, "OCSPRequestData.issuerNameHash");
+    validator.require_member(has_issuerKeyHash, "OCSPRequestData.issuerKeyHash");
+    validator.require_member(has_serialNumber, "OCSPRequestData.serialNumber");
+    validator.require_member(has_responderURL, "OCSPRequestData.responderURL");
+}
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k) {
@@ -160,6 +379,68 @@ void from_json(const json& j, MessageContent& k) {
     }
 }
 
+/// \brief Writes the given MessageContent \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MessageContent& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("format", conversions::message_format_enum_to_string(k.format));
+    writer.member("content", k.content);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.language) {
+        writer.member("language", k.language.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given MessageContent \p k from the given \p reader
+void read_json(JsonReader& reader, MessageContent& k) {
+    bool has_format = false;
+    bool has_content = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "format") {
+            k.format = conversions::string_to_message_format_enum(reader.read_string());
+            has_format = true;
+        } else if (key == "content") {
+            reader.read(k.content);
+            has_content = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "language") {
+            reader.read(k.language);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_format, "format");
+    reader.require_member(has_content, "content");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a MessageContent
+void validate_message_content(JsonValidator& validator) {
+    bool has_format = false;
+    bool has_content = false;
+    validator.object("MessageContent", [&](std::string_view key) {
+        if (key == "format") {
+            validator.enumeration(conversions::string_to_message_format_enum);
+            has_format = true;
+        } else if (key == "content") {
+            validator.string(512);
+            has_content = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "language") {
+            validator.string(8);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_format, "MessageContent.format");
+    validator.require_member(has_content, "MessageContent.content");
+}
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k) {
@@ -240,6 +521,99 @@ void from_json(const json& j, IdTokenInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTokenInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const IdTokenInfo& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::authorization_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.cacheExpiryDateTime) {
+        writer.member("cacheExpiryDateTime", k.cacheExpiryDateTime.value());
+    }
+    if (k.chargingPriority) {
+        writer.member("chargingPriority", k.chargingPriority.value());
+    }
+    if (k.language1) {
+        writer.member("language1", k.language1.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    if (k.language2) {
+        writer.member("language2", k.language2.value());
+    }
+    if (k.personalMessage) {
+        writer.member("personalMessage", k.personalMessage.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given IdTokenInfo \p k from the given \p reader
+void read_json(JsonReader& reader, IdTokenInfo& k) {
+    bool has_status = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_authorization_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "cacheExpiryDateTime") {
+            reader.read(k.cacheExpiryDateTime);
+        } else if (key == "chargingPriority") {
+            reader.read(k.chargingPriority);
+        } else if (key == "language1") {
+            reader.read(k.language1);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else if (key == "groupIdToken") {
+            reader.read(k.groupIdToken);
+        } else if (key == "language2") {
+            reader.read(k.language2);
+        } else if (key == "personalMessage") {
+            reader.read(k.personalMessage);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a IdTokenInfo
+void validate_id_token_info(JsonValidator& validator) {
+    bool has_status = false;
+    validator.object("IdTokenInfo", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_authorization_status_enum);
+            has_status = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "cacheExpiryDateTime") {
+            validator.date_time();
+        } else if (key == "chargingPriority") {
+            validator.integer();
+        } else if (key == "language1") {
+            validator.string(8);
+        } else if (key == "evseId") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validator.integer(); });
+        } else if (key == "groupIdToken") {
+            validate_id_token(validator);
+        } else if (key == "language2") {
+            validator.string(8);
+        } else if (key == "personalMessage") {
+            validate_message_content(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "IdTokenInfo.status");
+}
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k) {
@@ -279,6 +653,53 @@ void from_json(const json& j, Modem& k) {
     }
 }
 
+/// \brief Writes the given Modem \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Modem& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.iccid) {
+        writer.member("iccid", k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.member("imsi", k.imsi.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Modem \p k from the given \p reader
+void read_json(JsonReader& reader, Modem& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "iccid") {
+            reader.read(k.iccid);
+        } else if (key == "imsi") {
+            reader.read(k.imsi);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Modem
+void validate_modem(JsonValidator& validator) {
+    validator.object("Modem", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "iccid") {
+            validator.string(20);
+        } else if (key == "imsi") {
+            validator.string(20);
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k) {
@@ -329,6 +750,82 @@ void from_json(const json& j, ChargingStation& k) {
     }
 }
 
+/// \brief Writes the given ChargingStation \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingStation& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("model", k.model);
+    writer.member("vendorName", k.vendorName);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.serialNumber) {
+        writer.member("serialNumber", k.serialNumber.value());
+    }
+    if (k.modem) {
+        writer.member("modem", k.modem.value());
+    }
+    if (k.firmwareVersion) {
+        writer.member("firmwareVersion", k.firmwareVersion.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingStation \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingStation& k) {
+    bool has_model = false;
+    bool has_vendorName = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "model") {
+            reader.read(k.model);
+            has_model = true;
+        } else if (key == "vendorName") {
+            reader.read(k.vendorName);
+            has_vendorName = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "serialNumber") {
+            reader.read(k.serialNumber);
+        } else if (key == "modem") {
+            reader.read(k.modem);
+        } else if (key == "firmwareVersion") {
+            reader.read(k.firmwareVersion);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_model, "model");
+    reader.require_member(has_vendorName, "vendorName");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingStation
+void validate_charging_station(JsonValidator& validator) {
+    bool has_model = false;
+    bool has_vendorName = false;
+    validator.object("ChargingStation", [&](std::string_view key) {
+        if (key == "model") {
+            validator.string(20);
+            has_model = true;
+        } else if (key == "vendorName") {
+            validator.string(50);
+            has_vendorName = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "serialNumber") {
+            validator.string(25);
+        } else if (key == "modem") {
+            validate_modem(validator);
+        } else if (key == "firmwareVersion") {
+            validator.string(50);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_model, "ChargingStation.model");
+    validator.require_member(has_vendorName, "ChargingStation.vendorName");
+}
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k) {
@@ -365,6 +862,57 @@ void from_json(const json& j, StatusInfo& k) {
     }
 }
 
+/// \brief Writes the given StatusInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const StatusInfo& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("reasonCode", k.reasonCode);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.additionalInfo) {
+        writer.member("additionalInfo", k.additionalInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given StatusInfo \p k from the given \p reader
+void read_json(JsonReader& reader, StatusInfo& k) {
+    bool has_reasonCode = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "reasonCode") {
+            reader.read(k.reasonCode);
+            has_reasonCode = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "additionalInfo") {
+            reader.read(k.additionalInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_reasonCode, "reasonCode");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a StatusInfo
+void validate_status_info(JsonValidator& validator) {
+    bool has_reasonCode = false;
+    validator.object("StatusInfo", [&](std::string_view key) {
+        if (key == "reasonCode") {
+            validator.string(20);
+            has_reasonCode = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "additionalInfo") {
+            validator.string(512);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_reasonCode, "StatusInfo.reasonCode");
+}
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k) {
@@ -401,6 +949,57 @@ void from_json(const json& j, EVSE& k) {
     }
 }
 
+/// \brief Writes the given EVSE \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const EVSE& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given EVSE \p k from the given \p reader
+void read_json(JsonReader& reader, EVSE& k) {
+    bool has_id = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "connectorId") {
+            reader.read(k.connectorId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a EVSE
+void validate_evse(JsonValidator& validator) {
+    bool has_id = false;
+    validator.object("EVSE", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "connectorId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "EVSE.id");
+}
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k) {
@@ -448,6 +1047,62 @@ void from_json(const json& j, ClearChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ClearChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfile& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ClearChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ClearChargingProfile& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+        } else if (key == "chargingProfilePurpose") {
+            k.chargingProfilePurpose.emplace(
+                conversions::string_to_charging_profile_purpose_enum(reader.read_string()));
+        } else if (key == "stackLevel") {
+            reader.read(k.stackLevel);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearChargingProfile
+void validate_clear_charging_profile(JsonValidator& validator) {
+    validator.object("ClearChargingProfile", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evseId") {
+            validator.integer();
+        } else if (key == "chargingProfilePurpose") {
+            validator.enumeration(conversions::string_to_charging_profile_purpose_enum);
+        } else if (key == "stackLevel") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k) {
@@ -486,6 +1141,68 @@ void from_json(const json& j, ClearMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given ClearMonitoringResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_monitoring_status_enum_to_string(k.status));
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ClearMonitoringResult \p k from the given \p reader
+void read_json(JsonReader& reader, ClearMonitoringResult& k) {
+    bool has_status = false;
+    bool has_id = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_clear_monitoring_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+    reader.require_member(has_id, "id");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ClearMonitoringResult
+void validate_clear_monitoring_result(JsonValidator& validator) {
+    bool has_status = false;
+    bool has_id = false;
+    validator.object("ClearMonitoringResult", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_clear_monitoring_status_enum);
+            has_status = true;
+        } else if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "ClearMonitoringResult.status");
+    validator.require_member(has_id, "ClearMonitoringResult.id");
+}
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k) {
@@ -522,6 +1239,83 @@ void from_json(const json& j, CertificateHashDataType& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataType \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given CertificateHashDataType \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataType& k) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(reader.read_string());
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            reader.read(k.issuerNameHash);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            reader.read(k.issuerKeyHash);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            reader.read(k.serialNumber);
+            has_serialNumber = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_hashAlgorithm, "hashAlgorithm");
+    reader.require_member(has_issuerNameHash, "issuerNameHash");
+    reader.require_member(has_issuerKeyHash, "issuerKeyHash");
+    reader.require_member(has_serialNumber, "serialNumber");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataType
+void validate_certificate_hash_data_type(JsonValidator& validator) {
+    bool has_hashAlgorithm = false;
+    bool has_issuerNameHash = false;
+    bool has_issuerKeyHash = false;
+    bool has_serialNumber = false;
+    validator.object("CertificateHashDataType", [&](std::string_view key) {
+        if (key == "hashAlgorithm") {
+            validator.enumeration(conversions::string_to_hash_algorithm_enum);
+            has_hashAlgorithm = true;
+        } else if (key == "issuerNameHash") {
+            validator.string(128);
+            has_issuerNameHash = true;
+        } else if (key == "issuerKeyHash") {
+            validator.string(128);
+            has_issuerKeyHash = true;
+        } else if (key == "serialNumber") {
+            validator.string(40);
+            has_serialNumber = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_hashAlgorithm, "CertificateHashDataType.hashAlgorithm");
+    validator.require_member(has_issuerNameHash, "CertificateHashDataType.issuerNameHash");
+    validator.require_member(has_issuerKeyHash, "CertificateHashDataType.issuerKeyHash");
+    validator.require_member(has_serialNumber, "CertificateHashDataType.serialNumber");
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -599,6 +1393,78 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfileCriterion \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    if (k.chargingProfileId) {
+        writer.member("chargingProfileId", k.chargingProfileId.value());
+    }
+    if (k.chargingLimitSource) {
+        writer.key("chargingLimitSource");
+        writer.begin_array();
+        for (const auto& val : k.chargingLimitSource.value()) {
+            writer.value(conversions::charging_limit_source_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingProfileCriterion \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfileCriterion& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "chargingProfilePurpose") {
+            k.chargingProfilePurpose.emplace(
+                conversions::string_to_charging_profile_purpose_enum(reader.read_string()));
+        } else if (key == "stackLevel") {
+            reader.read(k.stackLevel);
+        } else if (key == "chargingProfileId") {
+            reader.read(k.chargingProfileId);
+        } else if (key == "chargingLimitSource") {
+            k.chargingLimitSource.emplace();
+            reader.read_array([&]() {
+                k.chargingLimitSource->push_back(
+                    conversions::string_to_charging_limit_source_enum(reader.read_string()));
+            });
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfileCriterion
+void validate_charging_profile_criterion(JsonValidator& validator) {
+    validator.object("ChargingProfileCriterion", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "chargingProfilePurpose") {
+            validator.enumeration(conversions::string_to_charging_profile_purpose_enum);
+        } else if (key == "stackLevel") {
+            validator.integer();
+        } else if (key == "chargingProfileId") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validator.integer(); });
+        } else if (key == "chargingLimitSource") {
+            validator.array(1, 4, [&]() { validator.enumeration(conversions::string_to_charging_limit_source_enum); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k) {
@@ -643,6 +1509,75 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("startPeriod", k.startPeriod);
+    writer.member("limit", k.limit);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.numberPhases) {
+        writer.member("numberPhases", k.numberPhases.value());
+    }
+    if (k.phaseToUse) {
+        writer.member("phaseToUse", k.phaseToUse.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingSchedulePeriod \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedulePeriod& k) {
+    bool has_startPeriod = false;
+    bool has_limit = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "startPeriod") {
+            reader.read(k.startPeriod);
+            has_startPeriod = true;
+        } else if (key == "limit") {
+            reader.read(k.limit);
+            has_limit = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "numberPhases") {
+            reader.read(k.numberPhases);
+        } else if (key == "phaseToUse") {
+            reader.read(k.phaseToUse);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_startPeriod, "startPeriod");
+    reader.require_member(has_limit, "limit");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedulePeriod
+void validate_charging_schedule_period(JsonValidator& validator) {
+    bool has_startPeriod = false;
+    bool has_limit = false;
+    validator.object("ChargingSchedulePeriod", [&](std::string_view key) {
+        if (key == "startPeriod") {
+            validator.integer();
+            has_startPeriod = true;
+        } else if (key == "limit") {
+            validator.number();
+            has_limit = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "numberPhases") {
+            validator.integer();
+        } else if (key == "phaseToUse") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_startPeriod, "ChargingSchedulePeriod.startPeriod");
+    validator.require_member(has_limit, "ChargingSchedulePeriod.limit");
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -684,6 +1619,94 @@ void from_json(const json& j, CompositeSchedule& k) {
     }
 }
 
+/// \brief Writes the given CompositeSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CompositeSchedule& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    writer.member("evseId", k.evseId);
+    writer.member("duration", k.duration);
+    writer.member("scheduleStart", k.scheduleStart);
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given CompositeSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, CompositeSchedule& k) {
+    bool has_chargingSchedulePeriod = false;
+    bool has_evseId = false;
+    bool has_duration = false;
+    bool has_scheduleStart = false;
+    bool has_chargingRateUnit = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingSchedulePeriod") {
+            reader.read(k.chargingSchedulePeriod);
+            has_chargingSchedulePeriod = true;
+        } else if (key == "evseId") {
+            reader.read(k.evseId);
+            has_evseId = true;
+        } else if (key == "duration") {
+            reader.read(k.duration);
+            has_duration = true;
+        } else if (key == "scheduleStart") {
+            reader.read(k.scheduleStart);
+            has_scheduleStart = true;
+        } else if (key == "chargingRateUnit") {
+            k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(reader.read_string());
+            has_chargingRateUnit = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingSchedulePeriod, "chargingSchedulePeriod");
+    reader.require_member(has_evseId, "evseId");
+    reader.require_member(has_duration, "duration");
+    reader.require_member(has_scheduleStart, "scheduleStart");
+    reader.require_member(has_chargingRateUnit, "chargingRateUnit");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a CompositeSchedule
+void validate_composite_schedule(JsonValidator& validator) {
+    bool has_chargingSchedulePeriod = false;
+    bool has_evseId = false;
+    bool has_duration = false;
+    bool has_scheduleStart = false;
+    bool has_chargingRateUnit = false;
+    validator.object("CompositeSchedule", [&](std::string_view key) {
+        if (key == "chargingSchedulePeriod") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_charging_schedule_period(validator); });
+            has_chargingSchedulePeriod = true;
+        } else if (key == "evseId") {
+            validator.integer();
+            has_evseId = true;
+        } else if (key == "duration") {
+            validator.integer();
+            has_duration = true;
+        } else if (key == "scheduleStart") {
+            validator.date_time();
+            has_scheduleStart = true;
+        } else if (key == "chargingRateUnit") {
+            validator.enumeration(conversions::string_to_charging_rate_unit_enum);
+            has_chargingRateUnit = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingSchedulePeriod, "CompositeSchedule.chargingSchedulePeriod");
+    validator.require_member(has_evseId, "CompositeSchedule.evseId");
+    validator.require_member(has_duration, "CompositeSchedule.duration");
+    validator.require_member(has_scheduleStart, "CompositeSchedule.scheduleStart");
+    validator.require_member(has_chargingRateUnit, "CompositeSchedule.chargingRateUnit");
+}
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k) {
@@ -730,6 +1753,68 @@ void from_json(const json& j, CertificateHashDataChain& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataChain \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("certificateHashData", k.certificateHashData);
+    writer.member("certificateType", conversions::get_certificate_id_use_enum_to_string(k.certificateType));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.childCertificateHashData) {
+        writer.member("childCertificateHashData", k.childCertificateHashData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given CertificateHashDataChain \p k from the given \p reader
+void read_json(JsonReader& reader, CertificateHashDataChain& k) {
+    bool has_certificateHashData = false;
+    bool has_certificateType = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "certificateHashData") {
+            reader.read(k.certificateHashData);
+            has_certificateHashData = true;
+        } else if (key == "certificateType") {
+            k.certificateType = conversions::string_to_get_certificate_id_use_enum(reader.read_string());
+            has_certificateType = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "childCertificateHashData") {
+            reader.read(k.childCertificateHashData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_certificateHashData, "certificateHashData");
+    reader.require_member(has_certificateType, "certificateType");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a CertificateHashDataChain
+void validate_certificate_hash_data_chain(JsonValidator& validator) {
+    bool has_certificateHashData = false;
+    bool has_certificateType = false;
+    validator.object("CertificateHashDataChain", [&](std::string_view key) {
+        if (key == "certificateHashData") {
+            validate_certificate_hash_data_type(validator);
+            has_certificateHashData = true;
+        } else if (key == "certificateType") {
+            validator.enumeration(conversions::string_to_get_certificate_id_use_enum);
+            has_certificateType = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "childCertificateHashData") {
+            validator.array(1, 4, [&]() { validate_certificate_hash_data_type(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_certificateHashData, "CertificateHashDataChain.certificateHashData");
+    validator.require_member(has_certificateType, "CertificateHashDataChain.certificateType");
+}
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k) {
@@ -772,6 +1857,64 @@ void from_json(const json& j, LogParameters& k) {
     }
 }
 
+/// \brief Writes the given LogParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const LogParameters& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("remoteLocation", k.remoteLocation);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.member("oldestTimestamp", k.oldestTimestamp.value());
+    }
+    if (k.latestTimestamp) {
+        writer.member("latestTimestamp", k.latestTimestamp.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given LogParameters \p k from the given \p reader
+void read_json(JsonReader& reader, LogParameters& k) {
+    bool has_remoteLocation = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "remoteLocation") {
+            reader.read(k.remoteLocation);
+            has_remoteLocation = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "oldestTimestamp") {
+            reader.read(k.oldestTimestamp);
+        } else if (key == "latestTimestamp") {
+            reader.read(k.latestTimestamp);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_remoteLocation, "remoteLocation");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a LogParameters
+void validate_log_parameters(JsonValidator& validator) {
+    bool has_remoteLocation = false;
+    validator.object("LogParameters", [&](std::string_view key) {
+        if (key == "remoteLocation") {
+            validator.string(512);
+            has_remoteLocation = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "oldestTimestamp") {
+            validator.date_time();
+        } else if (key == "latestTimestamp") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_remoteLocation, "LogParameters.remoteLocation");
+}
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k) {
@@ -814,6 +1957,64 @@ void from_json(const json& j, Component& k) {
     }
 }
 
+/// \brief Writes the given Component \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Component& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("name", k.name);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    if (k.instance) {
+        writer.member("instance", k.instance.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Component \p k from the given \p reader
+void read_json(JsonReader& reader, Component& k) {
+    bool has_name = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "name") {
+            reader.read(k.name);
+            has_name = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "evse") {
+            reader.read(k.evse);
+        } else if (key == "instance") {
+            reader.read(k.instance);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_name, "name");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Component
+void validate_component(JsonValidator& validator) {
+    bool has_name = false;
+    validator.object("Component", [&](std::string_view key) {
+        if (key == "name") {
+            validator.string(50);
+            has_name = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "evse") {
+            validate_evse(validator);
+        } else if (key == "instance") {
+            validator.string(50);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_name, "Component.name");
+}
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k) {
@@ -850,6 +2051,57 @@ void from_json(const json& j, Variable& k) {
     }
 }
 
+/// \brief Writes the given Variable \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Variable& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("name", k.name);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.instance) {
+        writer.member("instance", k.instance.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Variable \p k from the given \p reader
+void read_json(JsonReader& reader, Variable& k) {
+    bool has_name = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "name") {
+            reader.read(k.name);
+            has_name = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "instance") {
+            reader.read(k.instance);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_name, "name");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Variable
+void validate_variable(JsonValidator& validator) {
+    bool has_name = false;
+    validator.object("Variable", [&](std::string_view key) {
+        if (key == "name") {
+            validator.string(50);
+            has_name = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "instance") {
+            validator.string(50);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_name, "Variable.name");
+}
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k) {
@@ -886,6 +2138,57 @@ void from_json(const json& j, ComponentVariable& k) {
     }
 }
 
+/// \brief Writes the given ComponentVariable \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ComponentVariable& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.variable) {
+        writer.member("variable", k.variable.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ComponentVariable \p k from the given \p reader
+void read_json(JsonReader& reader, ComponentVariable& k) {
+    bool has_component = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "variable") {
+            reader.read(k.variable);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_component, "component");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ComponentVariable
+void validate_component_variable(JsonValidator& validator) {
+    bool has_component = false;
+    validator.object("ComponentVariable", [&](std::string_view key) {
+        if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "variable") {
+            validate_variable(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_component, "ComponentVariable.component");
+}
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k) {
@@ -924,8 +2227,70 @@ void from_json(const json& j, GetVariableData& k) {
     }
 }
 
-// \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
-/// \returns an output stream with the GetVariableData written to
+/// \brief Writes the given GetVariableData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given GetVariableData \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariableData& k) {
+    bool has_component = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariableData
+void validate_get_variable_data(JsonValidator& validator) {
+    bool has_component = false;
+    bool has_variable = false;
+    validator.object("GetVariableData", [&](std::string_view key) {
+        if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "attributeType") {
+            validator.enumeration(conversions::string_to_attribute_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_component, "GetVariableData.component");
+    validator.require_member(has_variable, "GetVariableData.variable");
+}
+
+// \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
+/// \returns an output stream with the GetVariableData written to
 std::ostream& operator<<(std::ostream& os, const GetVariableData& k) {
     os << json(k).dump(4);
     return os;
@@ -976,6 +2341,93 @@ void from_json(const json& j, GetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given GetVariableResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableResult& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("attributeStatus", conversions::get_variable_status_enum_to_string(k.attributeStatus));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeStatusInfo) {
+        writer.member("attributeStatusInfo", k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeValue) {
+        writer.member("attributeValue", k.attributeValue.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given GetVariableResult \p k from the given \p reader
+void read_json(JsonReader& reader, GetVariableResult& k) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "attributeStatus") {
+            k.attributeStatus = conversions::string_to_get_variable_status_enum(reader.read_string());
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "attributeStatusInfo") {
+            reader.read(k.attributeStatusInfo);
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "attributeValue") {
+            reader.read(k.attributeValue);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_attributeStatus, "attributeStatus");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a GetVariableResult
+void validate_get_variable_result(JsonValidator& validator) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    validator.object("GetVariableResult", [&](std::string_view key) {
+        if (key == "attributeStatus") {
+            validator.enumeration(conversions::string_to_get_variable_status_enum);
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "attributeStatusInfo") {
+            validate_status_info(validator);
+        } else if (key == "attributeType") {
+            validator.enumeration(conversions::string_to_attribute_enum);
+        } else if (key == "attributeValue") {
+            validator.string(2500);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_attributeStatus, "GetVariableResult.attributeStatus");
+    validator.require_member(has_component, "GetVariableResult.component");
+    validator.require_member(has_variable, "GetVariableResult.variable");
+}
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k) {
@@ -1012,6 +2464,83 @@ void from_json(const json& j, SignedMeterValue& k) {
     }
 }
 
+/// \brief Writes the given SignedMeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SignedMeterValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("signedMeterData", k.signedMeterData);
+    writer.member("signingMethod", k.signingMethod);
+    writer.member("encodingMethod", k.encodingMethod);
+    writer.member("publicKey", k.publicKey);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SignedMeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, SignedMeterValue& k) {
+    bool has_signedMeterData = false;
+    bool has_signingMethod = false;
+    bool has_encodingMethod = false;
+    bool has_publicKey = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "signedMeterData") {
+            reader.read(k.signedMeterData);
+            has_signedMeterData = true;
+        } else if (key == "signingMethod") {
+            reader.read(k.signingMethod);
+            has_signingMethod = true;
+        } else if (key == "encodingMethod") {
+            reader.read(k.encodingMethod);
+            has_encodingMethod = true;
+        } else if (key == "publicKey") {
+            reader.read(k.publicKey);
+            has_publicKey = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_signedMeterData, "signedMeterData");
+    reader.require_member(has_signingMethod, "signingMethod");
+    reader.require_member(has_encodingMethod, "encodingMethod");
+    reader.require_member(has_publicKey, "publicKey");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SignedMeterValue
+void validate_signed_meter_value(JsonValidator& validator) {
+    bool has_signedMeterData = false;
+    bool has_signingMethod = false;
+    bool has_encodingMethod = false;
+    bool has_publicKey = false;
+    validator.object("SignedMeterValue", [&](std::string_view key) {
+        if (key == "signedMeterData") {
+            validator.string(2500);
+            has_signedMeterData = true;
+        } else if (key == "signingMethod") {
+            validator.string(50);
+            has_signingMethod = true;
+        } else if (key == "encodingMethod") {
+            validator.string(50);
+            has_encodingMethod = true;
+        } else if (key == "publicKey") {
+            validator.string(2500);
+            has_publicKey = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_signedMeterData, "SignedMeterValue.signedMeterData");
+    validator.require_member(has_signingMethod, "SignedMeterValue.signingMethod");
+    validator.require_member(has_encodingMethod, "SignedMeterValue.encodingMethod");
+    validator.require_member(has_publicKey, "SignedMeterValue.publicKey");
+}
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k) {
@@ -1051,6 +2580,53 @@ void from_json(const json& j, UnitOfMeasure& k) {
     }
 }
 
+/// \brief Writes the given UnitOfMeasure \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const UnitOfMeasure& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.unit) {
+        writer.member("unit", k.unit.value());
+    }
+    if (k.multiplier) {
+        writer.member("multiplier", k.multiplier.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given UnitOfMeasure \p k from the given \p reader
+void read_json(JsonReader& reader, UnitOfMeasure& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "unit") {
+            reader.read(k.unit);
+        } else if (key == "multiplier") {
+            reader.read(k.multiplier);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a UnitOfMeasure
+void validate_unit_of_measure(JsonValidator& validator) {
+    validator.object("UnitOfMeasure", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "unit") {
+            validator.string(20);
+        } else if (key == "multiplier") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k) {
@@ -1117,6 +2693,92 @@ void from_json(const json& j, SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.context) {
+        writer.member("context", conversions::reading_context_enum_to_string(k.context.value()));
+    }
+    if (k.measurand) {
+        writer.member("measurand", conversions::measurand_enum_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.member("phase", conversions::phase_enum_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.member("location", conversions::location_enum_to_string(k.location.value()));
+    }
+    if (k.signedMeterValue) {
+        writer.member("signedMeterValue", k.signedMeterValue.value());
+    }
+    if (k.unitOfMeasure) {
+        writer.member("unitOfMeasure", k.unitOfMeasure.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SampledValue \p k from the given \p reader
+void read_json(JsonReader& reader, SampledValue& k) {
+    bool has_value = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "value") {
+            reader.read(k.value);
+            has_value = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "context") {
+            k.context.emplace(conversions::string_to_reading_context_enum(reader.read_string()));
+        } else if (key == "measurand") {
+            k.measurand.emplace(conversions::string_to_measurand_enum(reader.read_string()));
+        } else if (key == "phase") {
+            k.phase.emplace(conversions::string_to_phase_enum(reader.read_string()));
+        } else if (key == "location") {
+            k.location.emplace(conversions::string_to_location_enum(reader.read_string()));
+        } else if (key == "signedMeterValue") {
+            reader.read(k.signedMeterValue);
+        } else if (key == "unitOfMeasure") {
+            reader.read(k.unitOfMeasure);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_value, "value");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SampledValue
+void validate_sampled_value(JsonValidator& validator) {
+    bool has_value = false;
+    validator.object("SampledValue", [&](std::string_view key) {
+        if (key == "value") {
+            validator.number();
+            has_value = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "context") {
+            validator.enumeration(conversions::string_to_reading_context_enum);
+        } else if (key == "measurand") {
+            validator.enumeration(conversions::string_to_measurand_enum);
+        } else if (key == "phase") {
+            validator.enumeration(conversions::string_to_phase_enum);
+        } else if (key == "location") {
+            validator.enumeration(conversions::string_to_location_enum);
+        } else if (key == "signedMeterValue") {
+            validate_signed_meter_value(validator);
+        } else if (key == "unitOfMeasure") {
+            validate_unit_of_measure(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_value, "SampledValue.value");
+}
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
@@ -1152,6 +2814,61 @@ void from_json(const json& j, MeterValue& k) {
     }
 }
 
+/// \brief Writes the given MeterValue \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("sampledValue", k.sampledValue);
+    writer.member("timestamp", k.timestamp);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given MeterValue \p k from the given \p reader
+void read_json(JsonReader& reader, MeterValue& k) {
+    bool has_sampledValue = false;
+    bool has_timestamp = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "sampledValue") {
+            reader.read(k.sampledValue);
+            has_sampledValue = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_sampledValue, "sampledValue");
+    reader.require_member(has_timestamp, "timestamp");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a MeterValue
+void validate_meter_value(JsonValidator& validator) {
+    bool has_sampledValue = false;
+    bool has_timestamp = false;
+    validator.object("MeterValue", [&](std::string_view key) {
+        if (key == "sampledValue") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_sampled_value(validator); });
+            has_sampledValue = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_sampledValue, "MeterValue.sampledValue");
+    validator.require_member(has_timestamp, "MeterValue.timestamp");
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -1188,6 +2905,57 @@ void from_json(const json& j, RelativeTimeInterval& k) {
     }
 }
 
+/// \brief Writes the given RelativeTimeInterval \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("start", k.start);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given RelativeTimeInterval \p k from the given \p reader
+void read_json(JsonReader& reader, RelativeTimeInterval& k) {
+    bool has_start = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "start") {
+            reader.read(k.start);
+            has_start = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "duration") {
+            reader.read(k.duration);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_start, "start");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a RelativeTimeInterval
+void validate_relative_time_interval(JsonValidator& validator) {
+    bool has_start = false;
+    validator.object("RelativeTimeInterval", [&](std::string_view key) {
+        if (key == "start") {
+            validator.integer();
+            has_start = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "duration") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_start, "RelativeTimeInterval.start");
+}
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k) {
@@ -1226,6 +2994,68 @@ void from_json(const json& j, Cost& k) {
     }
 }
 
+/// \brief Writes the given Cost \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Cost& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("costKind", conversions::cost_kind_enum_to_string(k.costKind));
+    writer.member("amount", k.amount);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.amountMultiplier) {
+        writer.member("amountMultiplier", k.amountMultiplier.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Cost \p k from the given \p reader
+void read_json(JsonReader& reader, Cost& k) {
+    bool has_costKind = false;
+    bool has_amount = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "costKind") {
+            k.costKind = conversions::string_to_cost_kind_enum(reader.read_string());
+            has_costKind = true;
+        } else if (key == "amount") {
+            reader.read(k.amount);
+            has_amount = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "amountMultiplier") {
+            reader.read(k.amountMultiplier);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_costKind, "costKind");
+    reader.require_member(has_amount, "amount");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Cost
+void validate_cost(JsonValidator& validator) {
+    bool has_costKind = false;
+    bool has_amount = false;
+    validator.object("Cost", [&](std::string_view key) {
+        if (key == "costKind") {
+            validator.enumeration(conversions::string_to_cost_kind_enum);
+            has_costKind = true;
+        } else if (key == "amount") {
+            validator.integer();
+            has_amount = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "amountMultiplier") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_costKind, "Cost.costKind");
+    validator.require_member(has_amount, "Cost.amount");
+}
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k) {
@@ -1260,6 +3090,61 @@ void from_json(const json& j, ConsumptionCost& k) {
     }
 }
 
+/// \brief Writes the given ConsumptionCost \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ConsumptionCost& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("startValue", k.startValue);
+    writer.member("cost", k.cost);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ConsumptionCost \p k from the given \p reader
+void read_json(JsonReader& reader, ConsumptionCost& k) {
+    bool has_startValue = false;
+    bool has_cost = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "startValue") {
+            reader.read(k.startValue);
+            has_startValue = true;
+        } else if (key == "cost") {
+            reader.read(k.cost);
+            has_cost = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_startValue, "startValue");
+    reader.require_member(has_cost, "cost");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ConsumptionCost
+void validate_consumption_cost(JsonValidator& validator) {
+    bool has_startValue = false;
+    bool has_cost = false;
+    validator.object("ConsumptionCost", [&](std::string_view key) {
+        if (key == "startValue") {
+            validator.number();
+            has_startValue = true;
+        } else if (key == "cost") {
+            validator.array(1, 3, [&]() { validate_cost(validator); });
+            has_cost = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_startValue, "ConsumptionCost.startValue");
+    validator.require_member(has_cost, "ConsumptionCost.cost");
+}
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k) {
@@ -1310,6 +3195,64 @@ void from_json(const json& j, SalesTariffEntry& k) {
     }
 }
 
+/// \brief Writes the given SalesTariffEntry \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariffEntry& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("relativeTimeInterval", k.relativeTimeInterval);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.ePriceLevel) {
+        writer.member("ePriceLevel", k.ePriceLevel.value());
+    }
+    if (k.consumptionCost) {
+        writer.member("consumptionCost", k.consumptionCost.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SalesTariffEntry \p k from the given \p reader
+void read_json(JsonReader& reader, SalesTariffEntry& k) {
+    bool has_relativeTimeInterval = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "relativeTimeInterval") {
+            reader.read(k.relativeTimeInterval);
+            has_relativeTimeInterval = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "ePriceLevel") {
+            reader.read(k.ePriceLevel);
+        } else if (key == "consumptionCost") {
+            reader.read(k.consumptionCost);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_relativeTimeInterval, "relativeTimeInterval");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SalesTariffEntry
+void validate_sales_tariff_entry(JsonValidator& validator) {
+    bool has_relativeTimeInterval = false;
+    validator.object("SalesTariffEntry", [&](std::string_view key) {
+        if (key == "relativeTimeInterval") {
+            validate_relative_time_interval(validator);
+            has_relativeTimeInterval = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "ePriceLevel") {
+            validator.integer();
+        } else if (key == "consumptionCost") {
+            validator.array(1, 3, [&]() { validate_consumption_cost(validator); });
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_relativeTimeInterval, "SalesTariffEntry.relativeTimeInterval");
+}
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k) {
@@ -1356,6 +3299,75 @@ void from_json(const json& j, SalesTariff& k) {
     }
 }
 
+/// \brief Writes the given SalesTariff \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariff& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("salesTariffEntry", k.salesTariffEntry);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.salesTariffDescription) {
+        writer.member("salesTariffDescription", k.salesTariffDescription.value());
+    }
+    if (k.numEPriceLevels) {
+        writer.member("numEPriceLevels", k.numEPriceLevels.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SalesTariff \p k from the given \p reader
+void read_json(JsonReader& reader, SalesTariff& k) {
+    bool has_id = false;
+    bool has_salesTariffEntry = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "salesTariffEntry") {
+            reader.read(k.salesTariffEntry);
+            has_salesTariffEntry = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "salesTariffDescription") {
+            reader.read(k.salesTariffDescription);
+        } else if (key == "numEPriceLevels") {
+            reader.read(k.numEPriceLevels);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_salesTariffEntry, "salesTariffEntry");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SalesTariff
+void validate_sales_tariff(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_salesTariffEntry = false;
+    validator.object("SalesTariff", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "salesTariffEntry") {
+            validator.array(1, 1024, [&]() { validate_sales_tariff_entry(validator); });
+            has_salesTariffEntry = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "salesTariffDescription") {
+            validator.string(32);
+        } else if (key == "numEPriceLevels") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "SalesTariff.id");
+    validator.require_member(has_salesTariffEntry, "SalesTariff.salesTariffEntry");
+}
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k) {
@@ -1416,6 +3428,100 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.startSchedule) {
+        writer.member("startSchedule", k.startSchedule.value());
+    }
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    if (k.minChargingRate) {
+        writer.member("minChargingRate", k.minChargingRate.value());
+    }
+    if (k.salesTariff) {
+        writer.member("salesTariff", k.salesTariff.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingSchedule \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingSchedule& k) {
+    bool has_id = false;
+    bool has_chargingRateUnit = false;
+    bool has_chargingSchedulePeriod = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "chargingRateUnit") {
+            k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(reader.read_string());
+            has_chargingRateUnit = true;
+        } else if (key == "chargingSchedulePeriod") {
+            reader.read(k.chargingSchedulePeriod);
+            has_chargingSchedulePeriod = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "startSchedule") {
+            reader.read(k.startSchedule);
+        } else if (key == "duration") {
+            reader.read(k.duration);
+        } else if (key == "minChargingRate") {
+            reader.read(k.minChargingRate);
+        } else if (key == "salesTariff") {
+            reader.read(k.salesTariff);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_chargingRateUnit, "chargingRateUnit");
+    reader.require_member(has_chargingSchedulePeriod, "chargingSchedulePeriod");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingSchedule
+void validate_charging_schedule(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_chargingRateUnit = false;
+    bool has_chargingSchedulePeriod = false;
+    validator.object("ChargingSchedule", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "chargingRateUnit") {
+            validator.enumeration(conversions::string_to_charging_rate_unit_enum);
+            has_chargingRateUnit = true;
+        } else if (key == "chargingSchedulePeriod") {
+            validator.array(1, 1024, [&]() { validate_charging_schedule_period(validator); });
+            has_chargingSchedulePeriod = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "startSchedule") {
+            validator.date_time();
+        } else if (key == "duration") {
+            validator.integer();
+        } else if (key == "minChargingRate") {
+            validator.number();
+        } else if (key == "salesTariff") {
+            validate_sales_tariff(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "ChargingSchedule.id");
+    validator.require_member(has_chargingRateUnit, "ChargingSchedule.chargingRateUnit");
+    validator.require_member(has_chargingSchedulePeriod, "ChargingSchedule.chargingSchedulePeriod");
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -1452,6 +3558,57 @@ void from_json(const json& j, ChargingLimit& k) {
     }
 }
 
+/// \brief Writes the given ChargingLimit \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingLimit& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.isGridCritical) {
+        writer.member("isGridCritical", k.isGridCritical.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingLimit \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingLimit& k) {
+    bool has_chargingLimitSource = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "chargingLimitSource") {
+            k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(reader.read_string());
+            has_chargingLimitSource = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "isGridCritical") {
+            reader.read(k.isGridCritical);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_chargingLimitSource, "chargingLimitSource");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingLimit
+void validate_charging_limit(JsonValidator& validator) {
+    bool has_chargingLimitSource = false;
+    validator.object("ChargingLimit", [&](std::string_view key) {
+        if (key == "chargingLimitSource") {
+            validator.enumeration(conversions::string_to_charging_limit_source_enum);
+            has_chargingLimitSource = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "isGridCritical") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_chargingLimitSource, "ChargingLimit.chargingLimitSource");
+}
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k) {
@@ -1516,6 +3673,107 @@ void from_json(const json& j, MessageInfo& k) {
     }
 }
 
+/// \brief Writes the given MessageInfo \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MessageInfo& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("priority", conversions::message_priority_enum_to_string(k.priority));
+    writer.member("message", k.message);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.display) {
+        writer.member("display", k.display.value());
+    }
+    if (k.state) {
+        writer.member("state", conversions::message_state_enum_to_string(k.state.value()));
+    }
+    if (k.startDateTime) {
+        writer.member("startDateTime", k.startDateTime.value());
+    }
+    if (k.endDateTime) {
+        writer.member("endDateTime", k.endDateTime.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given MessageInfo \p k from the given \p reader
+void read_json(JsonReader& reader, MessageInfo& k) {
+    bool has_id = false;
+    bool has_priority = false;
+    bool has_message = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "priority") {
+            k.priority = conversions::string_to_message_priority_enum(reader.read_string());
+            has_priority = true;
+        } else if (key == "message") {
+            reader.read(k.message);
+            has_message = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "display") {
+            reader.read(k.display);
+        } else if (key == "state") {
+            k.state.emplace(conversions::string_to_message_state_enum(reader.read_string()));
+        } else if (key == "startDateTime") {
+            reader.read(k.startDateTime);
+        } else if (key == "endDateTime") {
+            reader.read(k.endDateTime);
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_priority, "priority");
+    reader.require_member(has_message, "message");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a MessageInfo
+void validate_message_info(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_priority = false;
+    bool has_message = false;
+    validator.object("MessageInfo", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "priority") {
+            validator.enumeration(conversions::string_to_message_priority_enum);
+            has_priority = true;
+        } else if (key == "message") {
+            validate_message_content(validator);
+            has_message = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "display") {
+            validate_component(validator);
+        } else if (key == "state") {
+            validator.enumeration(conversions::string_to_message_state_enum);
+        } else if (key == "startDateTime") {
+            validator.date_time();
+        } else if (key == "endDateTime") {
+            validator.date_time();
+        } else if (key == "transactionId") {
+            validator.string(36);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "MessageInfo.id");
+    validator.require_member(has_priority, "MessageInfo.priority");
+    validator.require_member(has_message, "MessageInfo.message");
+}
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k) {
@@ -1552,6 +3810,83 @@ void from_json(const json& j, ACChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given ACChargingParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ACChargingParameters& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("energyAmount", k.energyAmount);
+    writer.member("evMinCurrent", k.evMinCurrent);
+    writer.member("evMaxCurrent", k.evMaxCurrent);
+    writer.member("evMaxVoltage", k.evMaxVoltage);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ACChargingParameters \p k from the given \p reader
+void read_json(JsonReader& reader, ACChargingParameters& k) {
+    bool has_energyAmount = false;
+    bool has_evMinCurrent = false;
+    bool has_evMaxCurrent = false;
+    bool has_evMaxVoltage = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "energyAmount") {
+            reader.read(k.energyAmount);
+            has_energyAmount = true;
+        } else if (key == "evMinCurrent") {
+            reader.read(k.evMinCurrent);
+            has_evMinCurrent = true;
+        } else if (key == "evMaxCurrent") {
+            reader.read(k.evMaxCurrent);
+            has_evMaxCurrent = true;
+        } else if (key == "evMaxVoltage") {
+            reader.read(k.evMaxVoltage);
+            has_evMaxVoltage = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_energyAmount, "energyAmount");
+    reader.require_member(has_evMinCurrent, "evMinCurrent");
+    reader.require_member(has_evMaxCurrent, "evMaxCurrent");
+    reader.require_member(has_evMaxVoltage, "evMaxVoltage");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ACChargingParameters
+void validate_accharging_parameters(JsonValidator& validator) {
+    bool has_energyAmount = false;
+    bool has_evMinCurrent = false;
+    bool has_evMaxCurrent = false;
+    bool has_evMaxVoltage = false;
+    validator.object("ACChargingParameters", [&](std::string_view key) {
+        if (key == "energyAmount") {
+            validator.integer();
+            has_energyAmount = true;
+        } else if (key == "evMinCurrent") {
+            validator.integer();
+            has_evMinCurrent = true;
+        } else if (key == "evMaxCurrent") {
+            validator.integer();
+            has_evMaxCurrent = true;
+        } else if (key == "evMaxVoltage") {
+            validator.integer();
+            has_evMaxVoltage = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_energyAmount, "ACChargingParameters.energyAmount");
+    validator.require_member(has_evMinCurrent, "ACChargingParameters.evMinCurrent");
+    validator.require_member(has_evMaxCurrent, "ACChargingParameters.evMaxCurrent");
+    validator.require_member(has_evMaxVoltage, "ACChargingParameters.evMaxVoltage");
+}
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k) {
@@ -1620,6 +3955,103 @@ void from_json(const json& j, DCChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given DCChargingParameters \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const DCChargingParameters& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("evMaxCurrent", k.evMaxCurrent);
+    writer.member("evMaxVoltage", k.evMaxVoltage);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.energyAmount) {
+        writer.member("energyAmount", k.energyAmount.value());
+    }
+    if (k.evMaxPower) {
+        writer.member("evMaxPower", k.evMaxPower.value());
+    }
+    if (k.stateOfCharge) {
+        writer.member("stateOfCharge", k.stateOfCharge.value());
+    }
+    if (k.evEnergyCapacity) {
+        writer.member("evEnergyCapacity", k.evEnergyCapacity.value());
+    }
+    if (k.fullSoC) {
+        writer.member("fullSoC", k.fullSoC.value());
+    }
+    if (k.bulkSoC) {
+        writer.member("bulkSoC", k.bulkSoC.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given DCChargingParameters \p k from the given \p reader
+void read_json(JsonReader& reader, DCChargingParameters& k) {
+    bool has_evMaxCurrent = false;
+    bool has_evMaxVoltage = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "evMaxCurrent") {
+            reader.read(k.evMaxCurrent);
+            has_evMaxCurrent = true;
+        } else if (key == "evMaxVoltage") {
+            reader.read(k.evMaxVoltage);
+            has_evMaxVoltage = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "energyAmount") {
+            reader.read(k.energyAmount);
+        } else if (key == "evMaxPower") {
+            reader.read(k.evMaxPower);
+        } else if (key == "stateOfCharge") {
+            reader.read(k.stateOfCharge);
+        } else if (key == "evEnergyCapacity") {
+            reader.read(k.evEnergyCapacity);
+        } else if (key == "fullSoC") {
+            reader.read(k.fullSoC);
+        } else if (key == "bulkSoC") {
+            reader.read(k.bulkSoC);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_evMaxCurrent, "evMaxCurrent");
+    reader.require_member(has_evMaxVoltage, "evMaxVoltage");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a DCChargingParameters
+void validate_dccharging_parameters(JsonValidator& validator) {
+    bool has_evMaxCurrent = false;
+    bool has_evMaxVoltage = false;
+    validator.object("DCChargingParameters", [&](std::string_view key) {
+        if (key == "evMaxCurrent") {
+            validator.integer();
+            has_evMaxCurrent = true;
+        } else if (key == "evMaxVoltage") {
+            validator.integer();
+            has_evMaxVoltage = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "energyAmount") {
+            validator.integer();
+        } else if (key == "evMaxPower") {
+            validator.integer();
+        } else if (key == "stateOfCharge") {
+            validator.integer();
+        } else if (key == "evEnergyCapacity") {
+            validator.integer();
+        } else if (key == "fullSoC") {
+            validator.integer();
+        } else if (key == "bulkSoC") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_evMaxCurrent, "DCChargingParameters.evMaxCurrent");
+    validator.require_member(has_evMaxVoltage, "DCChargingParameters.evMaxVoltage");
+}
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k) {
@@ -1668,6 +4100,72 @@ void from_json(const json& j, ChargingNeeds& k) {
     }
 }
 
+/// \brief Writes the given ChargingNeeds \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingNeeds& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("requestedEnergyTransfer",
+                  conversions::energy_transfer_mode_enum_to_string(k.requestedEnergyTransfer));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.acChargingParameters) {
+        writer.member("acChargingParameters", k.acChargingParameters.value());
+    }
+    if (k.dcChargingParameters) {
+        writer.member("dcChargingParameters", k.dcChargingParameters.value());
+    }
+    if (k.departureTime) {
+        writer.member("departureTime", k.departureTime.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingNeeds \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingNeeds& k) {
+    bool has_requestedEnergyTransfer = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "requestedEnergyTransfer") {
+            k.requestedEnergyTransfer = conversions::string_to_energy_transfer_mode_enum(reader.read_string());
+            has_requestedEnergyTransfer = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "acChargingParameters") {
+            reader.read(k.acChargingParameters);
+        } else if (key == "dcChargingParameters") {
+            reader.read(k.dcChargingParameters);
+        } else if (key == "departureTime") {
+            reader.read(k.departureTime);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_requestedEnergyTransfer, "requestedEnergyTransfer");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingNeeds
+void validate_charging_needs(JsonValidator& validator) {
+    bool has_requestedEnergyTransfer = false;
+    validator.object("ChargingNeeds", [&](std::string_view key) {
+        if (key == "requestedEnergyTransfer") {
+            validator.enumeration(conversions::string_to_energy_transfer_mode_enum);
+            has_requestedEnergyTransfer = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "acChargingParameters") {
+            validate_accharging_parameters(validator);
+        } else if (key == "dcChargingParameters") {
+            validate_dccharging_parameters(validator);
+        } else if (key == "departureTime") {
+            validator.date_time();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_requestedEnergyTransfer, "ChargingNeeds.requestedEnergyTransfer");
+}
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k) {
@@ -1747,6 +4245,158 @@ void from_json(const json& j, EventData& k) {
     }
 }
 
+/// \brief Writes the given EventData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const EventData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("eventId", k.eventId);
+    writer.member("timestamp", k.timestamp);
+    writer.member("trigger", conversions::event_trigger_enum_to_string(k.trigger));
+    writer.member("actualValue", k.actualValue);
+    writer.member("component", k.component);
+    writer.member("eventNotificationType", conversions::event_notification_enum_to_string(k.eventNotificationType));
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.cause) {
+        writer.member("cause", k.cause.value());
+    }
+    if (k.techCode) {
+        writer.member("techCode", k.techCode.value());
+    }
+    if (k.techInfo) {
+        writer.member("techInfo", k.techInfo.value());
+    }
+    if (k.cleared) {
+        writer.member("cleared", k.cleared.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    if (k.variableMonitoringId) {
+        writer.member("variableMonitoringId", k.variableMonitoringId.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given EventData \p k from the given \p reader
+void read_json(JsonReader& reader, EventData& k) {
+    bool has_eventId = false;
+    bool has_timestamp = false;
+    bool has_trigger = false;
+    bool has_actualValue = false;
+    bool has_component = false;
+    bool has_eventNotificationType = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "eventId") {
+            reader.read(k.eventId);
+            has_eventId = true;
+        } else if (key == "timestamp") {
+            reader.read(k.timestamp);
+            has_timestamp = true;
+        } else if (key == "trigger") {
+            k.trigger = conversions::string_to_event_trigger_enum(reader.read_string());
+            has_trigger = true;
+        } else if (key == "actualValue") {
+            reader.read(k.actualValue);
+            has_actualValue = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "eventNotificationType") {
+            k.eventNotificationType = conversions::string_to_event_notification_enum(reader.read_string());
+            has_eventNotificationType = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "cause") {
+            reader.read(k.cause);
+        } else if (key == "techCode") {
+            reader.read(k.techCode);
+        } else if (key == "techInfo") {
+            reader.read(k.techInfo);
+        } else if (key == "cleared") {
+            reader.read(k.cleared);
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else if (key == "variableMonitoringId") {
+            reader.read(k.variableMonitoringId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_eventId, "eventId");
+    reader.require_member(has_timestamp, "timestamp");
+    reader.require_member(has_trigger, "trigger");
+    reader.require_member(has_actualValue, "actualValue");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_eventNotificationType, "eventNotificationType");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a EventData
+void validate_event_data(JsonValidator& validator) {
+    bool has_eventId = false;
+    bool has_timestamp = false;
+    bool has_trigger = false;
+    bool has_actualValue = false;
+    bool has_component = false;
+    bool has_eventNotificationType = false;
+    bool has_variable = false;
+    validator.object("EventData", [&](std::string_view key) {
+        if (key == "eventId") {
+            validator.integer();
+            has_eventId = true;
+        } else if (key == "timestamp") {
+            validator.date_time();
+            has_timestamp = true;
+        } else if (key == "trigger") {
+            validator.enumeration(conversions::string_to_event_trigger_enum);
+            has_trigger = true;
+        } else if (key == "actualValue") {
+            validator.string(2500);
+            has_actualValue = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "eventNotificationType") {
+            validator.enumeration(conversions::string_to_event_notification_enum);
+            has_eventNotificationType = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "cause") {
+            validator.integer();
+        } else if (key == "techCode") {
+            validator.string(50);
+        } else if (key == "techInfo") {
+            validator.string(500);
+        } else if (key == "cleared") {
+            validator.boolean();
+        } else if (key == "transactionId") {
+            validator.string(36);
+        } else if (key == "variableMonitoringId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_eventId, "EventData.eventId");
+    validator.require_member(has_timestamp, "EventData.timestamp");
+    validator.require_member(has_trigger, "EventData.trigger");
+    validator.require_member(has_actualValue, "EventData.actualValue");
+    validator.require_member(has_component, "EventData.component");
+    validator.require_member(has_eventNotificationType, "EventData.eventNotificationType");
+    validator.require_member(has_variable, "EventData.variable");
+}
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k) {
@@ -1785,6 +4435,94 @@ void from_json(const json& j, VariableMonitoring& k) {
     }
 }
 
+/// \brief Writes the given VariableMonitoring \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableMonitoring& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("transaction", k.transaction);
+    writer.member("value", k.value);
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given VariableMonitoring \p k from the given \p reader
+void read_json(JsonReader& reader, VariableMonitoring& k) {
+    bool has_id = false;
+    bool has_transaction = false;
+    bool has_value = false;
+    bool has_type = false;
+    bool has_severity = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "transaction") {
+            reader.read(k.transaction);
+            has_transaction = true;
+        } else if (key == "value") {
+            reader.read(k.value);
+            has_value = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_monitor_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "severity") {
+            reader.read(k.severity);
+            has_severity = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_transaction, "transaction");
+    reader.require_member(has_value, "value");
+    reader.require_member(has_type, "type");
+    reader.require_member(has_severity, "severity");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableMonitoring
+void validate_variable_monitoring(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_transaction = false;
+    bool has_value = false;
+    bool has_type = false;
+    bool has_severity = false;
+    validator.object("VariableMonitoring", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "transaction") {
+            validator.boolean();
+            has_transaction = true;
+        } else if (key == "value") {
+            validator.number();
+            has_value = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_monitor_enum);
+            has_type = true;
+        } else if (key == "severity") {
+            validator.integer();
+            has_severity = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "VariableMonitoring.id");
+    validator.require_member(has_transaction, "VariableMonitoring.transaction");
+    validator.require_member(has_value, "VariableMonitoring.value");
+    validator.require_member(has_type, "VariableMonitoring.type");
+    validator.require_member(has_severity, "VariableMonitoring.severity");
+}
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k) {
@@ -1821,6 +4559,72 @@ void from_json(const json& j, MonitoringData& k) {
     }
 }
 
+/// \brief Writes the given MonitoringData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const MonitoringData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("variableMonitoring", k.variableMonitoring);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given MonitoringData \p k from the given \p reader
+void read_json(JsonReader& reader, MonitoringData& k) {
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_variableMonitoring = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "variableMonitoring") {
+            reader.read(k.variableMonitoring);
+            has_variableMonitoring = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+    reader.require_member(has_variableMonitoring, "variableMonitoring");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a MonitoringData
+void validate_monitoring_data(JsonValidator& validator) {
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_variableMonitoring = false;
+    validator.object("MonitoringData", [&](std::string_view key) {
+        if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "variableMonitoring") {
+            validator.array(1, JsonValidator::unbounded, [&]() { validate_variable_monitoring(validator); });
+            has_variableMonitoring = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_component, "MonitoringData.component");
+    validator.require_member(has_variable, "MonitoringData.variable");
+    validator.require_member(has_variableMonitoring, "MonitoringData.variableMonitoring");
+}
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k) {
@@ -1878,6 +4682,74 @@ void from_json(const json& j, VariableAttribute& k) {
     }
 }
 
+/// \brief Writes the given VariableAttribute \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableAttribute& k) {
+    writer.begin_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.type) {
+        writer.member("type", conversions::attribute_enum_to_string(k.type.value()));
+    }
+    if (k.value) {
+        writer.member("value", k.value.value());
+    }
+    if (k.mutability) {
+        writer.member("mutability", conversions::mutability_enum_to_string(k.mutability.value()));
+    }
+    if (k.persistent) {
+        writer.member("persistent", k.persistent.value());
+    }
+    if (k.constant) {
+        writer.member("constant", k.constant.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given VariableAttribute \p k from the given \p reader
+void read_json(JsonReader& reader, VariableAttribute& k) {
+    reader.read_object([&](std::string_view key) {
+        if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "type") {
+            k.type.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "value") {
+            reader.read(k.value);
+        } else if (key == "mutability") {
+            k.mutability.emplace(conversions::string_to_mutability_enum(reader.read_string()));
+        } else if (key == "persistent") {
+            reader.read(k.persistent);
+        } else if (key == "constant") {
+            reader.read(k.constant);
+        } else {
+            reader.skip();
+        }
+    });
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableAttribute
+void validate_variable_attribute(JsonValidator& validator) {
+    validator.object("VariableAttribute", [&](std::string_view key) {
+        if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_attribute_enum);
+        } else if (key == "value") {
+            validator.string(2500);
+        } else if (key == "mutability") {
+            validator.enumeration(conversions::string_to_mutability_enum);
+        } else if (key == "persistent") {
+            validator.boolean();
+        } else if (key == "constant") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+}
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k) {
@@ -1934,6 +4806,89 @@ void from_json(const json& j, VariableCharacteristics& k) {
     }
 }
 
+/// \brief Writes the given VariableCharacteristics \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VariableCharacteristics& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("dataType", conversions::data_enum_to_string(k.dataType));
+    writer.member("supportsMonitoring", k.supportsMonitoring);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.unit) {
+        writer.member("unit", k.unit.value());
+    }
+    if (k.minLimit) {
+        writer.member("minLimit", k.minLimit.value());
+    }
+    if (k.maxLimit) {
+        writer.member("maxLimit", k.maxLimit.value());
+    }
+    if (k.valuesList) {
+        writer.member("valuesList", k.valuesList.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given VariableCharacteristics \p k from the given \p reader
+void read_json(JsonReader& reader, VariableCharacteristics& k) {
+    bool has_dataType = false;
+    bool has_supportsMonitoring = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "dataType") {
+            k.dataType = conversions::string_to_data_enum(reader.read_string());
+            has_dataType = true;
+        } else if (key == "supportsMonitoring") {
+            reader.read(k.supportsMonitoring);
+            has_supportsMonitoring = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "unit") {
+            reader.read(k.unit);
+        } else if (key == "minLimit") {
+            reader.read(k.minLimit);
+        } else if (key == "maxLimit") {
+            reader.read(k.maxLimit);
+        } else if (key == "valuesList") {
+            reader.read(k.valuesList);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_dataType, "dataType");
+    reader.require_member(has_supportsMonitoring, "supportsMonitoring");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a VariableCharacteristics
+void validate_variable_characteristics(JsonValidator& validator) {
+    bool has_dataType = false;
+    bool has_supportsMonitoring = false;
+    validator.object("VariableCharacteristics", [&](std::string_view key) {
+        if (key == "dataType") {
+            validator.enumeration(conversions::string_to_data_enum);
+            has_dataType = true;
+        } else if (key == "supportsMonitoring") {
+            validator.boolean();
+            has_supportsMonitoring = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "unit") {
+            validator.string(16);
+        } else if (key == "minLimit") {
+            validator.number();
+        } else if (key == "maxLimit") {
+            validator.number();
+        } else if (key == "valuesList") {
+            validator.string(1000);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_dataType, "VariableCharacteristics.dataType");
+    validator.require_member(has_supportsMonitoring, "VariableCharacteristics.supportsMonitoring");
+}
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k) {
@@ -1976,6 +4931,79 @@ void from_json(const json& j, ReportData& k) {
     }
 }
 
+/// \brief Writes the given ReportData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ReportData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("variableAttribute", k.variableAttribute);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.variableCharacteristics) {
+        writer.member("variableCharacteristics", k.variableCharacteristics.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ReportData \p k from the given \p reader
+void read_json(JsonReader& reader, ReportData& k) {
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_variableAttribute = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "variableAttribute") {
+            reader.read(k.variableAttribute);
+            has_variableAttribute = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "variableCharacteristics") {
+            reader.read(k.variableCharacteristics);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+    reader.require_member(has_variableAttribute, "variableAttribute");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ReportData
+void validate_report_data(JsonValidator& validator) {
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_variableAttribute = false;
+    validator.object("ReportData", [&](std::string_view key) {
+        if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "variableAttribute") {
+            validator.array(1, 4, [&]() { validate_variable_attribute(validator); });
+            has_variableAttribute = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "variableCharacteristics") {
+            validate_variable_characteristics(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_component, "ReportData.component");
+    validator.require_member(has_variable, "ReportData.variable");
+    validator.require_member(has_variableAttribute, "ReportData.variableAttribute");
+}
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k) {
@@ -2040,6 +5068,123 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("stackLevel", k.stackLevel);
+    writer.member("chargingProfilePurpose",
+                  conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose));
+    writer.member("chargingProfileKind", conversions::charging_profile_kind_enum_to_string(k.chargingProfileKind));
+    writer.member("chargingSchedule", k.chargingSchedule);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.recurrencyKind) {
+        writer.member("recurrencyKind", conversions::recurrency_kind_enum_to_string(k.recurrencyKind.value()));
+    }
+    if (k.validFrom) {
+        writer.member("validFrom", k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.member("validTo", k.validTo.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given ChargingProfile \p k from the given \p reader
+void read_json(JsonReader& reader, ChargingProfile& k) {
+    bool has_id = false;
+    bool has_stackLevel = false;
+    bool has_chargingProfilePurpose = false;
+    bool has_chargingProfileKind = false;
+    bool has_chargingSchedule = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "id") {
+            reader.read(k.id);
+            has_id = true;
+        } else if (key == "stackLevel") {
+            reader.read(k.stackLevel);
+            has_stackLevel = true;
+        } else if (key == "chargingProfilePurpose") {
+            k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_enum(reader.read_string());
+            has_chargingProfilePurpose = true;
+        } else if (key == "chargingProfileKind") {
+            k.chargingProfileKind = conversions::string_to_charging_profile_kind_enum(reader.read_string());
+            has_chargingProfileKind = true;
+        } else if (key == "chargingSchedule") {
+            reader.read(k.chargingSchedule);
+            has_chargingSchedule = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "recurrencyKind") {
+            k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_enum(reader.read_string()));
+        } else if (key == "validFrom") {
+            reader.read(k.validFrom);
+        } else if (key == "validTo") {
+            reader.read(k.validTo);
+        } else if (key == "transactionId") {
+            reader.read(k.transactionId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_id, "id");
+    reader.require_member(has_stackLevel, "stackLevel");
+    reader.require_member(has_chargingProfilePurpose, "chargingProfilePurpose");
+    reader.require_member(has_chargingProfileKind, "chargingProfileKind");
+    reader.require_member(has_chargingSchedule, "chargingSchedule");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a ChargingProfile
+void validate_charging_profile(JsonValidator& validator) {
+    bool has_id = false;
+    bool has_stackLevel = false;
+    bool has_chargingProfilePurpose = false;
+    bool has_chargingProfileKind = false;
+    bool has_chargingSchedule = false;
+    validator.object("ChargingProfile", [&](std::string_view key) {
+        if (key == "id") {
+            validator.integer();
+            has_id = true;
+        } else if (key == "stackLevel") {
+            validator.integer();
+            has_stackLevel = true;
+        } else if (key == "chargingProfilePurpose") {
+            validator.enumeration(conversions::string_to_charging_profile_purpose_enum);
+            has_chargingProfilePurpose = true;
+        } else if (key == "chargingProfileKind") {
+            validator.enumeration(conversions::string_to_charging_profile_kind_enum);
+            has_chargingProfileKind = true;
+        } else if (key == "chargingSchedule") {
+            validator.array(1, 3, [&]() { validate_charging_schedule(validator); });
+            has_chargingSchedule = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "recurrencyKind") {
+            validator.enumeration(conversions::string_to_recurrency_kind_enum);
+        } else if (key == "validFrom") {
+            validator.date_time();
+        } else if (key == "validTo") {
+            validator.date_time();
+        } else if (key == "transactionId") {
+            validator.string(36);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_id, "ChargingProfile.id");
+    validator.require_member(has_stackLevel, "ChargingProfile.stackLevel");
+    validator.require_member(has_chargingProfilePurpose, "ChargingProfile.chargingProfilePurpose");
+    validator.require_member(has_chargingProfileKind, "ChargingProfile.chargingProfileKind");
+    validator.require_member(has_chargingSchedule, "ChargingProfile.chargingSchedule");
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -2076,6 +5221,57 @@ void from_json(const json& j, AuthorizationData& k) {
     }
 }
 
+/// \brief Writes the given AuthorizationData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizationData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.idTokenInfo) {
+        writer.member("idTokenInfo", k.idTokenInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given AuthorizationData \p k from the given \p reader
+void read_json(JsonReader& reader, AuthorizationData& k) {
+    bool has_idToken = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "idToken") {
+            reader.read(k.idToken);
+            has_idToken = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "idTokenInfo") {
+            reader.read(k.idTokenInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_idToken, "idToken");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a AuthorizationData
+void validate_authorization_data(JsonValidator& validator) {
+    bool has_idToken = false;
+    validator.object("AuthorizationData", [&](std::string_view key) {
+        if (key == "idToken") {
+            validate_id_token(validator);
+            has_idToken = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "idTokenInfo") {
+            validate_id_token_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_idToken, "AuthorizationData.idToken");
+}
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k) {
@@ -2138,6 +5334,96 @@ void from_json(const json& j, APN& k) {
     }
 }
 
+/// \brief Writes the given APN \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const APN& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("apn", k.apn);
+    writer.member("apnAuthentication", conversions::apnauthentication_enum_to_string(k.apnAuthentication));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.apnUserName) {
+        writer.member("apnUserName", k.apnUserName.value());
+    }
+    if (k.apnPassword) {
+        writer.member("apnPassword", k.apnPassword.value());
+    }
+    if (k.simPin) {
+        writer.member("simPin", k.simPin.value());
+    }
+    if (k.preferredNetwork) {
+        writer.member("preferredNetwork", k.preferredNetwork.value());
+    }
+    if (k.useOnlyPreferredNetwork) {
+        writer.member("useOnlyPreferredNetwork", k.useOnlyPreferredNetwork.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given APN \p k from the given \p reader
+void read_json(JsonReader& reader, APN& k) {
+    bool has_apn = false;
+    bool has_apnAuthentication = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "apn") {
+            reader.read(k.apn);
+            has_apn = true;
+        } else if (key == "apnAuthentication") {
+            k.apnAuthentication = conversions::string_to_apnauthentication_enum(reader.read_string());
+            has_apnAuthentication = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "apnUserName") {
+            reader.read(k.apnUserName);
+        } else if (key == "apnPassword") {
+            reader.read(k.apnPassword);
+        } else if (key == "simPin") {
+            reader.read(k.simPin);
+        } else if (key == "preferredNetwork") {
+            reader.read(k.preferredNetwork);
+        } else if (key == "useOnlyPreferredNetwork") {
+            reader.read(k.useOnlyPreferredNetwork);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_apn, "apn");
+    reader.require_member(has_apnAuthentication, "apnAuthentication");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a APN
+void validate_apn(JsonValidator& validator) {
+    bool has_apn = false;
+    bool has_apnAuthentication = false;
+    validator.object("APN", [&](std::string_view key) {
+        if (key == "apn") {
+            validator.string(512);
+            has_apn = true;
+        } else if (key == "apnAuthentication") {
+            validator.enumeration(conversions::string_to_apnauthentication_enum);
+            has_apnAuthentication = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "apnUserName") {
+            validator.string(20);
+        } else if (key == "apnPassword") {
+            validator.string(20);
+        } else if (key == "simPin") {
+            validator.integer();
+        } else if (key == "preferredNetwork") {
+            validator.string(6);
+        } else if (key == "useOnlyPreferredNetwork") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_apn, "APN.apn");
+    validator.require_member(has_apnAuthentication, "APN.apnAuthentication");
+}
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k) {
@@ -2182,6 +5468,101 @@ void from_json(const json& j, VPN& k) {
     }
 }
 
+/// \brief Writes the given VPN \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const VPN& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("server", k.server);
+    writer.member("user", k.user);
+    writer.member("password", k.password);
+    writer.member("key", k.key);
+    writer.member("type", conversions::vpnenum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.group) {
+        writer.member("group", k.group.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given VPN \p k from the given \p reader
+void read_json(JsonReader& reader, VPN& k) {
+    bool has_server = false;
+    bool has_user = false;
+    bool has_password = false;
+    bool has_key = false;
+    bool has_type = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "server") {
+            reader.read(k.server);
+            has_server = true;
+        } else if (key == "user") {
+            reader.read(k.user);
+            has_user = true;
+        } else if (key == "password") {
+            reader.read(k.password);
+            has_password = true;
+        } else if (key == "key") {
+            reader.read(k.key);
+            has_key = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_vpnenum(reader.read_string());
+            has_type = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "group") {
+            reader.read(k.group);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_server, "server");
+    reader.require_member(has_user, "user");
+    reader.require_member(has_password, "password");
+    reader.require_member(has_key, "key");
+    reader.require_member(has_type, "type");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a VPN
+void validate_vpn(JsonValidator& validator) {
+    bool has_server = false;
+    bool has_user = false;
+    bool has_password = false;
+    bool has_key = false;
+    bool has_type = false;
+    validator.object("VPN", [&](std::string_view key) {
+        if (key == "server") {
+            validator.string(512);
+            has_server = true;
+        } else if (key == "user") {
+            validator.string(20);
+            has_user = true;
+        } else if (key == "password") {
+            validator.string(20);
+            has_password = true;
+        } else if (key == "key") {
+            validator.string(255);
+            has_key = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_vpnenum);
+            has_type = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "group") {
+            validator.string(20);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_server, "VPN.server");
+    validator.require_member(has_user, "VPN.user");
+    validator.require_member(has_password, "VPN.password");
+    validator.require_member(has_key, "VPN.key");
+    validator.require_member(has_type, "VPN.type");
+}
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k) {
@@ -2234,6 +5615,119 @@ void from_json(const json& j, NetworkConnectionProfile& k) {
     }
 }
 
+/// \brief Writes the given NetworkConnectionProfile \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("ocppVersion", conversions::ocppversion_enum_to_string(k.ocppVersion));
+    writer.member("ocppTransport", conversions::ocpptransport_enum_to_string(k.ocppTransport));
+    writer.member("ocppCsmsUrl", k.ocppCsmsUrl);
+    writer.member("messageTimeout", k.messageTimeout);
+    writer.member("securityProfile", k.securityProfile);
+    writer.member("ocppInterface", conversions::ocppinterface_enum_to_string(k.ocppInterface));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.apn) {
+        writer.member("apn", k.apn.value());
+    }
+    if (k.vpn) {
+        writer.member("vpn", k.vpn.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given NetworkConnectionProfile \p k from the given \p reader
+void read_json(JsonReader& reader, NetworkConnectionProfile& k) {
+    bool has_ocppVersion = false;
+    bool has_ocppTransport = false;
+    bool has_ocppCsmsUrl = false;
+    bool has_messageTimeout = false;
+    bool has_securityProfile = false;
+    bool has_ocppInterface = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "ocppVersion") {
+            k.ocppVersion = conversions::string_to_ocppversion_enum(reader.read_string());
+            has_ocppVersion = true;
+        } else if (key == "ocppTransport") {
+            k.ocppTransport = conversions::string_to_ocpptransport_enum(reader.read_string());
+            has_ocppTransport = true;
+        } else if (key == "ocppCsmsUrl") {
+            reader.read(k.ocppCsmsUrl);
+            has_ocppCsmsUrl = true;
+        } else if (key == "messageTimeout") {
+            reader.read(k.messageTimeout);
+            has_messageTimeout = true;
+        } else if (key == "securityProfile") {
+            reader.read(k.securityProfile);
+            has_securityProfile = true;
+        } else if (key == "ocppInterface") {
+            k.ocppInterface = conversions::string_to_ocppinterface_enum(reader.read_string());
+            has_ocppInterface = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "apn") {
+            reader.read(k.apn);
+        } else if (key == "vpn") {
+            reader.read(k.vpn);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_ocppVersion, "ocppVersion");
+    reader.require_member(has_ocppTransport, "ocppTransport");
+    reader.require_member(has_ocppCsmsUrl, "ocppCsmsUrl");
+    reader.require_member(has_messageTimeout, "messageTimeout");
+    reader.require_member(has_securityProfile, "securityProfile");
+    reader.require_member(has_ocppInterface, "ocppInterface");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a NetworkConnectionProfile
+void validate_network_connection_profile(JsonValidator& validator) {
+    bool has_ocppVersion = false;
+    bool has_ocppTransport = false;
+    bool has_ocppCsmsUrl = false;
+    bool has_messageTimeout = false;
+    bool has_securityProfile = false;
+    bool has_ocppInterface = false;
+    validator.object("NetworkConnectionProfile", [&](std::string_view key) {
+        if (key == "ocppVersion") {
+            validator.enumeration(conversions::string_to_ocppversion_enum);
+            has_ocppVersion = true;
+        } else if (key == "ocppTransport") {
+            validator.enumeration(conversions::string_to_ocpptransport_enum);
+            has_ocppTransport = true;
+        } else if (key == "ocppCsmsUrl") {
+            validator.string(512);
+            has_ocppCsmsUrl = true;
+        } else if (key == "messageTimeout") {
+            validator.integer();
+            has_messageTimeout = true;
+        } else if (key == "securityProfile") {
+            validator.integer();
+            has_securityProfile = true;
+        } else if (key == "ocppInterface") {
+            validator.enumeration(conversions::string_to_ocppinterface_enum);
+            has_ocppInterface = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "apn") {
+            validate_apn(validator);
+        } else if (key == "vpn") {
+            validate_vpn(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_ocppVersion, "NetworkConnectionProfile.ocppVersion");
+    validator.require_member(has_ocppTransport, "NetworkConnectionProfile.ocppTransport");
+    validator.require_member(has_ocppCsmsUrl, "NetworkConnectionProfile.ocppCsmsUrl");
+    validator.require_member(has_messageTimeout, "NetworkConnectionProfile.messageTimeout");
+    validator.require_member(has_securityProfile, "NetworkConnectionProfile.securityProfile");
+    validator.require_member(has_ocppInterface, "NetworkConnectionProfile.ocppInterface");
+}
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k) {
@@ -2282,6 +5776,108 @@ void from_json(const json& j, SetMonitoringData& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("severity", k.severity);
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.transaction) {
+        writer.member("transaction", k.transaction.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SetMonitoringData \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringData& k) {
+    bool has_value = false;
+    bool has_type = false;
+    bool has_severity = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "value") {
+            reader.read(k.value);
+            has_value = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_monitor_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "severity") {
+            reader.read(k.severity);
+            has_severity = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "id") {
+            reader.read(k.id);
+        } else if (key == "transaction") {
+            reader.read(k.transaction);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_value, "value");
+    reader.require_member(has_type, "type");
+    reader.require_member(has_severity, "severity");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringData
+void validate_set_monitoring_data(JsonValidator& validator) {
+    bool has_value = false;
+    bool has_type = false;
+    bool has_severity = false;
+    bool has_component = false;
+    bool has_variable = false;
+    validator.object("SetMonitoringData", [&](std::string_view key) {
+        if (key == "value") {
+            validator.number();
+            has_value = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_monitor_enum);
+            has_type = true;
+        } else if (key == "severity") {
+            validator.integer();
+            has_severity = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "id") {
+            validator.integer();
+        } else if (key == "transaction") {
+            validator.boolean();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_value, "SetMonitoringData.value");
+    validator.require_member(has_type, "SetMonitoringData.type");
+    validator.require_member(has_severity, "SetMonitoringData.severity");
+    validator.require_member(has_component, "SetMonitoringData.component");
+    validator.require_member(has_variable, "SetMonitoringData.variable");
+}
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k) {
@@ -2332,6 +5928,108 @@ void from_json(const json& j, SetMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringResult& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("status", conversions::set_monitoring_status_enum_to_string(k.status));
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SetMonitoringResult \p k from the given \p reader
+void read_json(JsonReader& reader, SetMonitoringResult& k) {
+    bool has_status = false;
+    bool has_type = false;
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_severity = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "status") {
+            k.status = conversions::string_to_set_monitoring_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "type") {
+            k.type = conversions::string_to_monitor_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "severity") {
+            reader.read(k.severity);
+            has_severity = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "id") {
+            reader.read(k.id);
+        } else if (key == "statusInfo") {
+            reader.read(k.statusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_status, "status");
+    reader.require_member(has_type, "type");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+    reader.require_member(has_severity, "severity");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetMonitoringResult
+void validate_set_monitoring_result(JsonValidator& validator) {
+    bool has_status = false;
+    bool has_type = false;
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_severity = false;
+    validator.object("SetMonitoringResult", [&](std::string_view key) {
+        if (key == "status") {
+            validator.enumeration(conversions::string_to_set_monitoring_status_enum);
+            has_status = true;
+        } else if (key == "type") {
+            validator.enumeration(conversions::string_to_monitor_enum);
+            has_type = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "severity") {
+            validator.integer();
+            has_severity = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "id") {
+            validator.integer();
+        } else if (key == "statusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_status, "SetMonitoringResult.status");
+    validator.require_member(has_type, "SetMonitoringResult.type");
+    validator.require_member(has_component, "SetMonitoringResult.component");
+    validator.require_member(has_variable, "SetMonitoringResult.variable");
+    validator.require_member(has_severity, "SetMonitoringResult.severity");
+}
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k) {
@@ -2372,6 +6070,79 @@ void from_json(const json& j, SetVariableData& k) {
     }
 }
 
+/// \brief Writes the given SetVariableData \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableData& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("attributeValue", k.attributeValue);
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SetVariableData \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableData& k) {
+    bool has_attributeValue = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "attributeValue") {
+            reader.read(k.attributeValue);
+            has_attributeValue = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_attributeValue, "attributeValue");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableData
+void validate_set_variable_data(JsonValidator& validator) {
+    bool has_attributeValue = false;
+    bool has_component = false;
+    bool has_variable = false;
+    validator.object("SetVariableData", [&](std::string_view key) {
+        if (key == "attributeValue") {
+            validator.string(1000);
+            has_attributeValue = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "attributeType") {
+            validator.enumeration(conversions::string_to_attribute_enum);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_attributeValue, "SetVariableData.attributeValue");
+    validator.require_member(has_component, "SetVariableData.component");
+    validator.require_member(has_variable, "SetVariableData.variable");
+}
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k) {
@@ -2418,6 +6189,86 @@ void from_json(const json& j, SetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given SetVariableResult \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableResult& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("attributeStatus", conversions::set_variable_status_enum_to_string(k.attributeStatus));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeStatusInfo) {
+        writer.member("attributeStatusInfo", k.attributeStatusInfo.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given SetVariableResult \p k from the given \p reader
+void read_json(JsonReader& reader, SetVariableResult& k) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "attributeStatus") {
+            k.attributeStatus = conversions::string_to_set_variable_status_enum(reader.read_string());
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            reader.read(k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            reader.read(k.variable);
+            has_variable = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "attributeStatusInfo") {
+            reader.read(k.attributeStatusInfo);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_attributeStatus, "attributeStatus");
+    reader.require_member(has_component, "component");
+    reader.require_member(has_variable, "variable");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a SetVariableResult
+void validate_set_variable_result(JsonValidator& validator) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    validator.object("SetVariableResult", [&](std::string_view key) {
+        if (key == "attributeStatus") {
+            validator.enumeration(conversions::string_to_set_variable_status_enum);
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            validate_component(validator);
+            has_component = true;
+        } else if (key == "variable") {
+            validate_variable(validator);
+            has_variable = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "attributeType") {
+            validator.enumeration(conversions::string_to_attribute_enum);
+        } else if (key == "attributeStatusInfo") {
+            validate_status_info(validator);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_attributeStatus, "SetVariableResult.attributeStatus");
+    validator.require_member(has_component, "SetVariableResult.component");
+    validator.require_member(has_variable, "SetVariableResult.variable");
+}
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k) {
@@ -2472,6 +6323,78 @@ void from_json(const json& j, Transaction& k) {
     }
 }
 
+/// \brief Writes the given Transaction \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Transaction& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingState) {
+        writer.member("chargingState", conversions::charging_state_enum_to_string(k.chargingState.value()));
+    }
+    if (k.timeSpentCharging) {
+        writer.member("timeSpentCharging", k.timeSpentCharging.value());
+    }
+    if (k.stoppedReason) {
+        writer.member("stoppedReason", conversions::reason_enum_to_string(k.stoppedReason.value()));
+    }
+    if (k.remoteStartId) {
+        writer.member("remoteStartId", k.remoteStartId.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Transaction \p k from the given \p reader
+void read_json(JsonReader& reader, Transaction& k) {
+    bool has_transactionId = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "transactionId") {
+            reader.read(k.transactionId);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "chargingState") {
+            k.chargingState.emplace(conversions::string_to_charging_state_enum(reader.read_string()));
+        } else if (key == "timeSpentCharging") {
+            reader.read(k.timeSpentCharging);
+        } else if (key == "stoppedReason") {
+            k.stoppedReason.emplace(conversions::string_to_reason_enum(reader.read_string()));
+        } else if (key == "remoteStartId") {
+            reader.read(k.remoteStartId);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_transactionId, "transactionId");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Transaction
+void validate_transaction(JsonValidator& validator) {
+    bool has_transactionId = false;
+    validator.object("Transaction", [&](std::string_view key) {
+        if (key == "transactionId") {
+            validator.string(36);
+            has_transactionId = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "chargingState") {
+            validator.enumeration(conversions::string_to_charging_state_enum);
+        } else if (key == "timeSpentCharging") {
+            validator.integer();
+        } else if (key == "stoppedReason") {
+            validator.enumeration(conversions::string_to_reason_enum);
+        } else if (key == "remoteStartId") {
+            validator.integer();
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_transactionId, "Transaction.transactionId");
+}
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k) {
@@ -2523,6 +6446,82 @@ void from_json(const json& j, Firmware& k) {
     }
 }
 
+/// \brief Writes the given Firmware \p k as json to the given \p writer
+void write_json(JsonWriter& writer, const Firmware& k) {
+    writer.begin_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDateTime", k.retrieveDateTime);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.installDateTime) {
+        writer.member("installDateTime", k.installDateTime.value());
+    }
+    if (k.signingCertificate) {
+        writer.member("signingCertificate", k.signingCertificate.value());
+    }
+    if (k.signature) {
+        writer.member("signature", k.signature.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Reads the given Firmware \p k from the given \p reader
+void read_json(JsonReader& reader, Firmware& k) {
+    bool has_location = false;
+    bool has_retrieveDateTime = false;
+    reader.read_object([&](std::string_view key) {
+        if (key == "location") {
+            reader.read(k.location);
+            has_location = true;
+        } else if (key == "retrieveDateTime") {
+            reader.read(k.retrieveDateTime);
+            has_retrieveDateTime = true;
+        } else if (key == "customData") {
+            reader.read(k.customData);
+        } else if (key == "installDateTime") {
+            reader.read(k.installDateTime);
+        } else if (key == "signingCertificate") {
+            reader.read(k.signingCertificate);
+        } else if (key == "signature") {
+            reader.read(k.signature);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.require_member(has_location, "location");
+    reader.require_member(has_retrieveDateTime, "retrieveDateTime");
+}
+
+/// \brief Validates the next value of the given \p validator against the schema of a Firmware
+void validate_firmware(JsonValidator& validator) {
+    bool has_location = false;
+    bool has_retrieveDateTime = false;
+    validator.object("Firmware", [&](std::string_view key) {
+        if (key == "location") {
+            validator.string(512);
+            has_location = true;
+        } else if (key == "retrieveDateTime") {
+            validator.date_time();
+            has_retrieveDateTime = true;
+        } else if (key == "customData") {
+            validate_custom_data(validator);
+        } else if (key == "installDateTime") {
+            validator.date_time();
+        } else if (key == "signingCertificate") {
+            validator.string(5500);
+        } else if (key == "signature") {
+            validator.string(800);
+        } else {
+            validator.unknown_member();
+        }
+    });
+    validator.require_member(has_location, "Firmware.location");
+    validator.require_member(has_retrieveDateTime, "Firmware.retrieveDateTime");
+}
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k) {
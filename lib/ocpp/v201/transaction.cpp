@@ -14,8 +14,13 @@ Transaction EnhancedTransaction::get_transaction() {
 }
 
 int32_t EnhancedTransaction::get_seq_no() {
-    this->seq_no += 1;
-    return this->seq_no - 1;
+    return this->seq_no.fetch_add(1);
+}
+
+bool EnhancedTransaction::release_seq_no(const int32_t seq_no) {
+    // only succeeds if no other sequence number has been taken since seq_no
+    auto next_seq_no = seq_no + 1;
+    return this->seq_no.compare_exchange_strong(next_seq_no, seq_no);
 }
 
 } // namespace v201
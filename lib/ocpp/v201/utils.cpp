@@ -159,7 +159,7 @@ std::string sha256(const std::string& str) {
 }
 
 std::string generate_token_hash(const IdToken& token) {
-    return sha256(conversions::id_token_enum_to_string(token.type) + token.idToken.get());
+    return sha256(std::string(conversions::id_token_enum_to_string(token.type)) + token.idToken.get());
 }
 
 ocpp::DateTime align_timestamp(const DateTime timestamp, std::chrono::seconds align_interval) {
@@ -0,0 +1,325 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include <everest/logging.hpp>
+#include <ocpp/v201/ctrlr_component_variables.hpp>
+#include <ocpp/v201/variable_monitoring_engine.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+/// \brief Maximum length of the actualValue of an EventData
+constexpr size_t MAX_EVENT_ACTUAL_VALUE_LENGTH = 2500;
+
+/// \brief Returns the first eventId after a boot. It is derived from the current time, so ids sent before a reboot are
+/// not repeated unless more than one event per second has been sent on average since then
+static int32_t initial_event_id() {
+    const auto seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    return static_cast<int32_t>(seconds % std::numeric_limits<int32_t>::max());
+}
+
+/// \brief Converts the given \p value to a number if it is one
+static std::optional<double> to_number(const std::string& value) {
+    if (value.empty()) {
+        return std::nullopt;
+    }
+    char* end = nullptr;
+    const auto number = std::strtod(value.c_str(), &end);
+    if (end != value.c_str() + value.size()) {
+        return std::nullopt;
+    }
+    return number;
+}
+
+/// \brief Checks if the given \p value exceeds the threshold of the Upper- or LowerThreshold \p monitor
+static bool exceeds_threshold(const VariableMonitoring& monitor, const double value) {
+    if (monitor.type == MonitorEnum::UpperThreshold) {
+        return value > monitor.value;
+    }
+    return value < monitor.value;
+}
+
+VariableMonitoringEngine::VariableMonitoringEngine(
+    DeviceModel& device_model, std::function<void(const std::vector<EventData>& events)> send_events_callback,
+    std::function<bool()> is_offline_callback,
+    std::function<bool(const std::optional<EVSE>& evse)> is_transaction_active_callback) :
+    device_model(device_model),
+    send_events_callback(std::move(send_events_callback)),
+    is_offline_callback(std::move(is_offline_callback)),
+    is_transaction_active_callback(std::move(is_transaction_active_callback)),
+    flush_scheduled(false),
+    next_event_id(initial_event_id()) {
+    this->device_model.for_each_monitor(
+        [this](const Component& component, const Variable& variable, const VariableMonitoring& monitor) {
+            if (monitor.type == MonitorEnum::Periodic or monitor.type == MonitorEnum::PeriodicClockAligned) {
+                this->periodic_monitors.push_back({component, variable, monitor});
+            }
+        });
+}
+
+void VariableMonitoringEngine::start() {
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        this->periodic_schedule.clear();
+        const auto now = std::chrono::steady_clock::now();
+        for (size_t index = 0; index < this->periodic_monitors.size(); index++) {
+            this->schedule_periodic_monitor(index, now);
+        }
+    }
+    this->arm_periodic_timer();
+}
+
+void VariableMonitoringEngine::stop() {
+    this->periodic_timer.stop();
+    this->flush_timer.stop();
+    this->flush_events();
+}
+
+void VariableMonitoringEngine::on_value_changed(const Component& component, const Variable& variable,
+                                                const std::vector<VariableMonitoring>& monitors,
+                                                const std::optional<std::string>& previous_value,
+                                                const std::string& value) {
+    if (!this->is_monitoring_enabled()) {
+        return;
+    }
+
+    std::vector<PendingEvent> events;
+    std::optional<bool> transaction_active;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        for (const auto& monitor : monitors) {
+            if (monitor.transaction) {
+                if (!transaction_active.has_value()) {
+                    transaction_active = this->is_transaction_active_callback(component.evse);
+                }
+                if (!transaction_active.value()) {
+                    continue;
+                }
+            }
+            this->evaluate_monitor(component, variable, monitor, previous_value, value, events);
+        }
+    }
+    this->queue_events(std::move(events));
+}
+
+void VariableMonitoringEngine::flush_events() {
+    std::vector<PendingEvent> events;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        events.swap(this->pending_events);
+        this->flush_scheduled = false;
+    }
+    if (events.empty()) {
+        return;
+    }
+
+    // while offline only the events of monitors up to the OfflineQueuingSeverity are queued
+    std::optional<int> offline_queuing_severity;
+    if (this->is_offline_callback()) {
+        offline_queuing_severity =
+            this->device_model.get_optional_value(ControllerComponentVariableHandles::OfflineQueuingSeverity);
+    }
+
+    std::vector<EventData> event_data;
+    event_data.reserve(events.size());
+    for (auto& event : events) {
+        if (offline_queuing_severity.has_value() and event.severity > offline_queuing_severity.value()) {
+            continue;
+        }
+        event_data.push_back(std::move(event.event_data));
+    }
+
+    if (event_data.size() < events.size()) {
+        EVLOG_debug << "Discarded " << events.size() - event_data.size()
+                    << " monitoring events because the charging station is offline";
+    }
+    if (!event_data.empty()) {
+        this->send_events_callback(event_data);
+    }
+}
+
+bool VariableMonitoringEngine::is_monitoring_enabled() {
+    return this->device_model.get_optional_value(ControllerComponentVariableHandles::MonitoringCtrlrEnabled)
+        .value_or(true);
+}
+
+EventData VariableMonitoringEngine::create_event(const Component& component, const Variable& variable,
+                                                 const VariableMonitoring& monitor, const EventTriggerEnum trigger,
+                                                 const std::string& value, const std::optional<bool>& cleared) {
+    EventData event_data;
+    event_data.eventId = 0;
+    event_data.timestamp = DateTime();
+    event_data.trigger = trigger;
+    event_data.actualValue = value.substr(0, MAX_EVENT_ACTUAL_VALUE_LENGTH);
+    event_data.component = component;
+    event_data.variable = variable;
+    // monitors are only configured in the device model storage so far
+    event_data.eventNotificationType = EventNotificationEnum::PreconfiguredMonitor;
+    event_data.variableMonitoringId = monitor.id;
+    event_data.cleared = cleared;
+    return event_data;
+}
+
+void VariableMonitoringEngine::evaluate_monitor(const Component& component, const Variable& variable,
+                                                const VariableMonitoring& monitor,
+                                                const std::optional<std::string>& previous_value,
+                                                const std::string& value, std::vector<PendingEvent>& events) {
+    switch (monitor.type) {
+    case MonitorEnum::UpperThreshold:
+    case MonitorEnum::LowerThreshold: {
+        const auto number = to_number(value);
+        if (!number.has_value()) {
+            return;
+        }
+        auto state_it = this->monitor_states.find(monitor.id);
+        if (state_it == this->monitor_states.end()) {
+            // a threshold that has already been exceeded before the first change does not trigger again
+            MonitorState state;
+            const auto previous_number = previous_value.has_value() ? to_number(previous_value.value()) : std::nullopt;
+            state.threshold_exceeded =
+                previous_number.has_value() and exceeds_threshold(monitor, previous_number.value());
+            state_it = this->monitor_states.emplace(monitor.id, state).first;
+        }
+
+        const auto exceeded = exceeds_threshold(monitor, number.value());
+        if (exceeded != state_it->second.threshold_exceeded) {
+            state_it->second.threshold_exceeded = exceeded;
+            events.push_back({this->create_event(component, variable, monitor, EventTriggerEnum::Alerting, value,
+                                                 !exceeded),
+                              monitor.severity});
+        }
+        break;
+    }
+    case MonitorEnum::Delta: {
+        auto& state = this->monitor_states[monitor.id];
+        if (!state.reference_value.has_value()) {
+            state.reference_value = previous_value.value_or(value);
+        }
+
+        // numeric values trigger if they changed by at least the monitor value, all others on every change
+        const auto number = to_number(value);
+        const auto reference = to_number(state.reference_value.value());
+        const auto triggered = (number.has_value() and reference.has_value())
+                                   ? std::abs(number.value() - reference.value()) >= monitor.value
+                                   : value != state.reference_value.value();
+        if (triggered) {
+            state.reference_value = value;
+            events.push_back({this->create_event(component, variable, monitor, EventTriggerEnum::Delta, value,
+                                                 std::nullopt),
+                              monitor.severity});
+        }
+        break;
+    }
+    case MonitorEnum::Periodic:
+    case MonitorEnum::PeriodicClockAligned:
+        // reported by the periodic timer
+        break;
+    }
+}
+
+void VariableMonitoringEngine::schedule_periodic_monitor(const size_t index,
+                                                         const std::chrono::steady_clock::time_point now) {
+    const auto& monitor = this->periodic_monitors.at(index).monitor;
+    const auto interval = std::chrono::milliseconds(static_cast<int64_t>(monitor.value * 1000));
+    if (interval.count() <= 0) {
+        return;
+    }
+
+    auto delay = interval;
+    if (monitor.type == MonitorEnum::PeriodicClockAligned) {
+        const auto since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        delay = interval - since_epoch % interval;
+    }
+    this->periodic_schedule.emplace(now + delay, index);
+}
+
+void VariableMonitoringEngine::arm_periodic_timer() {
+    std::chrono::steady_clock::time_point next_due;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        if (this->periodic_schedule.empty()) {
+            return;
+        }
+        next_due = this->periodic_schedule.begin()->first;
+    }
+    const auto delay = std::max(std::chrono::steady_clock::duration::zero(),
+                                next_due - std::chrono::steady_clock::now());
+    this->periodic_timer.timeout([this]() { this->handle_periodic_monitors(); }, delay);
+}
+
+void VariableMonitoringEngine::handle_periodic_monitors() {
+    std::vector<PeriodicMonitor> due_monitors;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        const auto now = std::chrono::steady_clock::now();
+        while (!this->periodic_schedule.empty() and this->periodic_schedule.begin()->first <= now) {
+            const auto index = this->periodic_schedule.begin()->second;
+            this->periodic_schedule.erase(this->periodic_schedule.begin());
+            due_monitors.push_back(this->periodic_monitors.at(index));
+            this->schedule_periodic_monitor(index, now);
+        }
+    }
+
+    if (this->is_monitoring_enabled()) {
+        std::vector<PendingEvent> events;
+        for (const auto& [component, variable, monitor] : due_monitors) {
+            if (monitor.transaction and !this->is_transaction_active_callback(component.evse)) {
+                continue;
+            }
+            const auto response =
+                this->device_model.request_value<std::string>(component, variable, AttributeEnum::Actual);
+            if (response.status != GetVariableStatusEnum::Accepted or !response.value.has_value()) {
+                continue;
+            }
+            events.push_back({this->create_event(component, variable, monitor, EventTriggerEnum::Periodic,
+                                                 response.value.value(), std::nullopt),
+                              monitor.severity});
+        }
+        this->queue_events(std::move(events));
+    }
+
+    this->arm_periodic_timer();
+}
+
+void VariableMonitoringEngine::queue_events(std::vector<PendingEvent>&& events) {
+    if (events.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        for (auto& event : events) {
+            event.event_data.eventId = this->next_event_id;
+            this->next_event_id =
+                this->next_event_id == std::numeric_limits<int32_t>::max() ? 0 : this->next_event_id + 1;
+            this->pending_events.push_back(std::move(event));
+        }
+    }
+
+    const auto coalescing_interval =
+        this->device_model.get_optional_value(ControllerComponentVariableHandles::NotifyEventCoalescingInterval)
+            .value_or(0);
+    if (coalescing_interval <= 0) {
+        this->flush_events();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        if (this->flush_scheduled) {
+            return;
+        }
+        this->flush_scheduled = true;
+    }
+    this->flush_timer.timeout([this]() { this->flush_events(); }, std::chrono::milliseconds(coalescing_interval));
+}
+
+} // namespace v201
+} // namespace ocpp
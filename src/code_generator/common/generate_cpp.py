@@ -7,7 +7,7 @@
 from jinja2 import Environment, FileSystemLoader, select_autoescape
 import json
 import stringcase
-from typing import Dict, List, Tuple
+from typing import Dict, List, Optional, Tuple
 import keyword
 from datetime import datetime
 import argparse
@@ -53,6 +53,67 @@ def remove_last(input_string: str, search: str) -> str:
     return input_string
 
 
+def string_lookup(strings: List[str]) -> List[Tuple[int, int, Dict[str, List[str]]]]:
+    """Groups the given strings for a lookup that switches on the length of
+    the string first and, if several strings share a length, on the character
+    that distinguishes most of them. Returns a list of (length, index, groups)
+    where groups maps the character at index to the strings having it there.
+    index is -1 if there is only one string of that length.
+    """
+    by_length: Dict[int, List[str]] = dict()
+    for string in strings:
+        by_length.setdefault(len(string), []).append(string)
+
+    lookup = []
+    for length, candidates in sorted(by_length.items()):
+        if len(candidates) == 1:
+            lookup.append((length, -1, {'': candidates}))
+            continue
+        index = max(range(length), key=lambda i: (len({c[i] for c in candidates}), -i))
+        groups: Dict[str, List[str]] = dict()
+        for candidate in candidates:
+            groups.setdefault(candidate[index], []).append(candidate)
+        lookup.append((length, index, groups))
+    return lookup
+
+
+def is_enum_type(type_name: str) -> bool:
+    for el in parsed_enums_unique + parsed_enums:
+        if el['name'] == type_name:
+            return True
+    return False
+
+
+def validate_value(prop_type: str, is_enum: bool = False, min_items: Optional[int] = None,
+                   max_items: Optional[int] = None) -> str:
+    """Returns the JsonValidator calls that check a value of the given
+    C++ type against its schema. The number of elements of an array is
+    checked if the schema gives its min_items or max_items.
+    """
+    if prop_type.startswith('std::vector<'):
+        item_type = prop_type[len('std::vector<'):-1]
+        on_element = '[&]() { ' + validate_value(item_type, is_enum_type(item_type)) + ' }'
+        if min_items is None and max_items is None:
+            return 'validator.array(' + on_element + ');'
+        return 'validator.array({}, {}, {});'.format(
+            min_items or 0, 'JsonValidator::unbounded' if max_items is None else max_items, on_element)
+    if is_enum:
+        return 'validator.enumeration(conversions::string_to_{});'.format(snake_case(prop_type))
+    if prop_type.startswith('CiString<'):
+        return 'validator.string({});'.format(prop_type[len('CiString<'):-1])
+    simple_types = {
+        'std::string': 'validator.string();',
+        'int32_t': 'validator.integer();',
+        'float': 'validator.number();',
+        'bool': 'validator.boolean();',
+        'ocpp::DateTime': 'validator.date_time();',
+        'json': 'validator.any();',
+    }
+    if prop_type in simple_types:
+        return simple_types[prop_type]
+    return 'validate_{}(validator);'.format(snake_case(prop_type))
+
+
 def uses_optional(types):
     for t in types:
         for property in t['properties']:
@@ -89,6 +150,8 @@ env = Environment(
 )
 env.filters['snake_case'] = snake_case
 env.filters['remove_last'] = remove_last
+env.filters['string_lookup'] = string_lookup
+env.filters['validate_value'] = validate_value
 env.globals['timestamp'] = datetime.utcnow
 env.globals['year'] = datetime.utcnow().year
 message_hpp_template = env.get_template('message.hpp.jinja')
@@ -99,6 +162,8 @@ enums_hpp_template = env.get_template('enums.hpp.jinja')
 enums_cpp_template = env.get_template('enums.cpp.jinja')
 ocpp_types_hpp_template = env.get_template('ocpp_types.hpp.jinja')
 ocpp_types_cpp_template = env.get_template('ocpp_types.cpp.jinja')
+message_validator_hpp_template = env.get_template('message_validator.hpp.jinja')
+message_validator_cpp_template = env.get_template('message_validator.cpp.jinja')
 
 # global variables, should go into a class
 parsed_types: List = []
@@ -313,7 +378,8 @@ def parse_object(ob_name: str, json_schema: Dict):
     and puts these information into the global dict parsed_types.
     """
 
-    ob_dict = {'name': ob_name, 'properties': [], 'depends_on': []}
+    ob_dict = {'name': ob_name, 'properties': [], 'depends_on': [],
+               'additional_properties': json_schema.get('additionalProperties', True)}
     parsed_types.insert(0, ob_dict)
     if not 'properties' in json_schema:
         return
@@ -333,7 +399,9 @@ def parse_object(ob_name: str, json_schema: Dict):
             'json_name': prop_name,
             'type': prop_type,
             'enum': is_enum,
-            'required': prop_name in json_schema.get('required', {})
+            'required': prop_name in json_schema.get('required', {}),
+            'min_items': prop.get('minItems'),
+            'max_items': prop.get('maxItems')
         })
 
     ob_dict['properties'].sort(key=lambda x: x.get('required'), reverse=True)
@@ -388,6 +456,8 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
     enums_cpp_fn = Path(generated_source_dir, 'enums.cpp')
     ocpp_types_hpp_fn = Path(generated_header_dir, 'ocpp_types.hpp')
     ocpp_types_cpp_fn = Path(generated_source_dir, 'ocpp_types.cpp')
+    message_validator_hpp_fn = Path(generated_header_dir, 'message_validator.hpp')
+    message_validator_cpp_fn = Path(generated_source_dir, 'message_validator.cpp')
     messages_header_dir = generated_header_dir / 'messages'
     messages_source_dir = generated_source_dir / 'messages'
     messages_cmakelists_txt_fn = Path(messages_source_dir, 'CMakeLists.txt')
@@ -556,6 +626,15 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
                 }))
             first = False
 
+    with open(message_validator_hpp_fn, 'w') as out:
+        out.write(message_validator_hpp_template.render({
+            'namespace': version_path
+        }))
+    with open(message_validator_cpp_fn, 'w') as out:
+        out.write(message_validator_cpp_template.render({
+            'actions': sorted(schemas.keys()),
+            'namespace': version_path
+        }))
     with open(messages_cmakelists_txt_fn, 'w') as out:
         out.write(messages_cmakelists_txt_template.render({
             'messages': sorted(message_files)
@@ -587,9 +666,9 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
     subprocess.run(["sh", "-c", "find {} -regex '.*\\.\\(cpp\\|hpp\\)' -exec clang-format -style=file -i {{}} \\;".format(
         messages_source_dir)], cwd=messages_source_dir)
     subprocess.run(["clang-format", "-style=file",  "-i",
-                   enums_hpp_fn, ocpp_types_hpp_fn], cwd=generated_header_dir)
+                   enums_hpp_fn, ocpp_types_hpp_fn, message_validator_hpp_fn], cwd=generated_header_dir)
     subprocess.run(["clang-format", "-style=file",  "-i",
-                   enums_cpp_fn, ocpp_types_cpp_fn], cwd=generated_source_dir)
+                   enums_cpp_fn, ocpp_types_cpp_fn, message_validator_cpp_fn], cwd=generated_source_dir)
     subprocess.run(["clang-format", "-style=file",  "-i",
                    enums_cpp_fn], cwd=generated_source_dir)
 
@@ -10,6 +10,7 @@ import subprocess
 from pathlib import Path
 from jinja2 import Environment, FileSystemLoader, select_autoescape
 import csv
+import json
 import argparse
 
 JSON_SCHEMA_TYPES = ["string", "number", "integer",
@@ -26,18 +27,45 @@ env = Environment(
 template_hpp = env.get_template('controller_component_variables.hpp.jinja')
 template_cpp = env.get_template('controller_component_variables.cpp.jinja')
 
+# C++ types of the values of the typed handles for the dataType of the VariableCharacteristics, other types are
+# handled as std::string
+HANDLE_TYPES = {
+    "integer": "int",
+    "decimal": "double",
+    "boolean": "bool",
+    "dateTime": "DateTime",
+}
 
-def generate_ctrlr_component_vars(csv_path: Path, libocpp_dir: Path):
-    """Generates JSON schema files using the given csv_path. Writes into given schema_dir
+
+def _load_data_types(schema_dir: Path):
+    """Reads the dataType of every variable from the component schemas in the given schema_dir
+
+    Returns:
+        dict: dataType by unique variable name
+    """
+    data_types = {}
+    for schema_file in sorted(schema_dir.glob("*.json")):
+        with open(schema_file) as f:
+            schema = json.load(f)
+        for unique_variable_name, variable in schema.get("properties", {}).items():
+            data_types[unique_variable_name] = variable.get("characteristics", {}).get("dataType")
+    return data_types
+
+
+def generate_ctrlr_component_vars(csv_path: Path, libocpp_dir: Path, schema_dir: Path):
+    """Generates the ctrlr_component_variables files using the given csv_path. Writes into given libocpp_dir
 
     Args:
         csv_path (Path): csv file path
-        schema_dir (Path): output file directory
+        libocpp_dir (Path): output directory of libocpp
+        schema_dir (Path): directory of the standardized component schemas, used for the types of the typed handles
     """
 
     hpp_file = libocpp_dir / "include/ocpp/v201/ctrlr_component_variables.hpp"
     cpp_file = libocpp_dir / "lib/ocpp/v201/ctrlr_component_variables.cpp"
 
+    data_types = _load_data_types(schema_dir)
+
     with open(csv_path) as csv_file:
         table = csv.DictReader(csv_file, delimiter=';')
         table = [e for e in table if e['specific_component'] != '<generic>']
@@ -57,7 +85,9 @@ def generate_ctrlr_component_vars(csv_path: Path, libocpp_dir: Path):
                     "variable_name": variable_entry["variable_name"],
                     "instance": variable_entry["instance"],
                     "description": f"Schema for {component}",
-                    "required": variable_entry["required"] == '1'
+                    "required": variable_entry["required"] == '1',
+                    "handle_type": HANDLE_TYPES.get(data_types.get(variable_entry["unique_variable_name"]),
+                                                    "std::string")
                 })
 
     with open(hpp_file, 'w') as f:
@@ -90,9 +120,14 @@ if __name__ == "__main__":
                         help="Path to dm_components_vars.csv appendix of OCPP2.0.1 spec", required=True)
     parser.add_argument("--out", metavar='OUT',
                         help="Dir to libocpp", required=True)
+    parser.add_argument("--schemas", metavar='SCHEMAS',
+                        help="Dir of the standardized component schemas, defaults to "
+                        "config/v201/component_schemas/standardized of libocpp", required=False)
 
     args = parser.parse_args()
     csv_path = Path(args.csv).resolve()
     libocpp_dir = Path(args.out).resolve()
+    schema_dir = Path(args.schemas).resolve() if args.schemas else libocpp_dir / \
+        "config/v201/component_schemas/standardized"
 
-    generate_ctrlr_component_vars(csv_path, libocpp_dir)
+    generate_ctrlr_component_vars(csv_path, libocpp_dir, schema_dir)
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+#include <ocpp/common/database/database_connection.hpp>
+
+using namespace ocpp::common;
+
+class DatabaseConnectionTest : public ::testing::Test {
+protected:
+    std::unique_ptr<DatabaseConnectionInterface> database;
+
+    void SetUp() override {
+        this->database = std::make_unique<DatabaseConnection>(":memory:", 2);
+        ASSERT_TRUE(this->database->open_connection());
+        ASSERT_TRUE(this->database->execute_statement("CREATE TABLE TEST_TABLE(FIELD1 INT NOT NULL);"));
+    }
+
+    void TearDown() override {
+        this->database->close_connection();
+    }
+
+    void insert_value(const int value) {
+        auto stmt = this->database->new_statement("INSERT INTO TEST_TABLE (FIELD1) VALUES (@value);");
+        ASSERT_EQ(stmt->bind_int("@value", value), SQLITE_OK);
+        ASSERT_EQ(stmt->step(), SQLITE_DONE);
+    }
+
+    int count_rows() {
+        auto stmt = this->database->new_statement("SELECT COUNT(*) FROM TEST_TABLE;");
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return stmt->column_int(0);
+    }
+};
+
+TEST_F(DatabaseConnectionTest, test_statement_reused_from_cache) {
+    this->insert_value(1);
+    this->insert_value(2);
+    this->insert_value(3);
+
+    const auto statistics = this->database->get_statement_cache_statistics();
+    EXPECT_EQ(statistics.misses, 1);
+    EXPECT_EQ(statistics.hits, 2);
+    EXPECT_EQ(this->count_rows(), 3);
+}
+
+TEST_F(DatabaseConnectionTest, test_statement_in_use_is_not_shared) {
+    const std::string sql = "SELECT FIELD1 FROM TEST_TABLE ORDER BY FIELD1;";
+    this->insert_value(1);
+    this->insert_value(2);
+
+    auto stmt1 = this->database->new_statement(sql);
+    ASSERT_EQ(stmt1->step(), SQLITE_ROW);
+    ASSERT_EQ(stmt1->column_int(0), 1);
+
+    // a second user of the same sql gets its own statement that starts from the first row
+    auto stmt2 = this->database->new_statement(sql);
+    ASSERT_EQ(stmt2->step(), SQLITE_ROW);
+    ASSERT_EQ(stmt2->column_int(0), 1);
+
+    ASSERT_EQ(stmt1->step(), SQLITE_ROW);
+    ASSERT_EQ(stmt1->column_int(0), 2);
+}
+
+TEST_F(DatabaseConnectionTest, test_released_statement_is_reset) {
+    const std::string sql = "SELECT FIELD1 FROM TEST_TABLE WHERE FIELD1 = @value;";
+    this->insert_value(1);
+
+    {
+        auto stmt = this->database->new_statement(sql);
+        stmt->bind_int("@value", 1);
+        ASSERT_EQ(stmt->step(), SQLITE_ROW);
+    }
+
+    // bindings have been cleared, so NULL never matches
+    auto stmt = this->database->new_statement(sql);
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+}
+
+TEST_F(DatabaseConnectionTest, test_least_recently_used_statement_evicted) {
+    this->insert_value(1);
+    this->count_rows();
+    // cache size is 2, so this evicts the insert statement
+    this->database->new_statement("SELECT FIELD1 FROM TEST_TABLE;");
+    this->insert_value(2);
+
+    const auto statistics = this->database->get_statement_cache_statistics();
+    EXPECT_EQ(statistics.misses, 4);
+    EXPECT_EQ(statistics.hits, 0);
+}
+
+TEST_F(DatabaseConnectionTest, test_statement_outlives_connection) {
+    auto stmt = this->database->new_statement("SELECT COUNT(*) FROM TEST_TABLE;");
+
+    // closing the connection finalizes the statement, releasing it afterwards must not touch the destroyed cache
+    this->database.reset();
+    stmt.reset();
+
+    this->database = std::make_unique<DatabaseConnection>(":memory:", 2);
+    ASSERT_TRUE(this->database->open_connection());
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+#include <ocpp/common/database/database_connection.hpp>
+#include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/database/json_encoding.hpp>
+
+using namespace ocpp::common;
+
+class JsonEncodingTest : public ::testing::Test {
+protected:
+    std::unique_ptr<DatabaseConnection> database;
+    const json document = {{"connectorId", 1}, {"meterValue", json::array({{{"timestamp", "2024-01-01T00:00:00Z"}}})}};
+
+    void SetUp() override {
+        this->database = std::make_unique<DatabaseConnection>(":memory:", 2);
+        ASSERT_TRUE(this->database->open_connection());
+        ASSERT_TRUE(this->database->execute_statement(
+            "CREATE TABLE TEST_TABLE(ID INT NOT NULL, DOC TEXT NOT NULL, DOC_ENCODING INT NOT NULL DEFAULT 0);"));
+    }
+
+    void TearDown() override {
+        this->database->close_connection();
+    }
+
+    void insert_text(const int id, const std::string& text) {
+        auto stmt = this->database->new_statement("INSERT INTO TEST_TABLE (ID, DOC) VALUES (@id, @doc);");
+        ASSERT_EQ(stmt->bind_int("@id", id), SQLITE_OK);
+        ASSERT_EQ(stmt->bind_text("@doc", text, SQLiteString::Transient), SQLITE_OK);
+        ASSERT_EQ(stmt->step(), SQLITE_DONE);
+    }
+
+    json read_document(const int id) {
+        auto stmt = this->database->new_statement("SELECT DOC, DOC_ENCODING FROM TEST_TABLE WHERE ID = @id;");
+        EXPECT_EQ(stmt->bind_int("@id", id), SQLITE_OK);
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return column_json(*stmt, 0, 1);
+    }
+
+    int read_encoding(const int id) {
+        auto stmt = this->database->new_statement("SELECT DOC_ENCODING FROM TEST_TABLE WHERE ID = @id;");
+        EXPECT_EQ(stmt->bind_int("@id", id), SQLITE_OK);
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return stmt->column_int(0);
+    }
+};
+
+TEST_F(JsonEncodingTest, test_binary_round_trip) {
+    auto stmt = this->database->new_statement("INSERT INTO TEST_TABLE (ID, DOC, DOC_ENCODING) VALUES (1, @doc, @enc);");
+    bind_json(*stmt, "@doc", "@enc", this->document);
+    ASSERT_EQ(stmt->step(), SQLITE_DONE);
+
+    EXPECT_EQ(this->read_encoding(1), static_cast<int>(CURRENT_JSON_ENCODING));
+    EXPECT_EQ(this->read_document(1), this->document);
+}
+
+TEST_F(JsonEncodingTest, test_read_json_text) {
+    this->insert_text(1, this->document.dump());
+
+    EXPECT_EQ(this->read_encoding(1), static_cast<int>(JsonEncoding::Text));
+    EXPECT_EQ(this->read_document(1), this->document);
+}
+
+TEST_F(JsonEncodingTest, test_unknown_encoding) {
+    ASSERT_TRUE(
+        this->database->execute_statement("INSERT INTO TEST_TABLE (ID, DOC, DOC_ENCODING) VALUES (1, '{}', 99);"));
+
+    EXPECT_THROW(this->read_document(1), DatabaseException);
+}
+
+TEST_F(JsonEncodingTest, test_convert_json_text_documents) {
+    this->insert_text(1, this->document.dump());
+    this->insert_text(2, "not json");
+    this->insert_text(3, "[]");
+
+    EXPECT_EQ(convert_json_text_documents(*this->database, "TEST_TABLE", "DOC", "DOC_ENCODING"), 2);
+
+    EXPECT_EQ(this->read_encoding(1), static_cast<int>(CURRENT_JSON_ENCODING));
+    EXPECT_EQ(this->read_document(1), this->document);
+    EXPECT_EQ(this->read_encoding(2), static_cast<int>(JsonEncoding::Text));
+    EXPECT_EQ(this->read_encoding(3), static_cast<int>(CURRENT_JSON_ENCODING));
+    EXPECT_EQ(this->read_document(3), json::array());
+
+    // converted documents are not converted again
+    EXPECT_EQ(convert_json_text_documents(*this->database, "TEST_TABLE", "DOC", "DOC_ENCODING"), 0);
+}
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/json_reader.hpp>
+#include <ocpp/v16/messages/SendLocalList.hpp>
+#include <ocpp/v16/messages/SetChargingProfile.hpp>
+#include <ocpp/v201/messages/SetVariables.hpp>
+
+namespace ocpp {
+
+TEST(JsonReaderTest, reads_values) {
+    JsonReader reader(R"( {"string": "esc\"aped\\\nä😀", "int": -42, "float": 1.5e2, "bool": false,
+                          "vector": [1, 2.9, 3], "json": {"nested": [null, true]}, "unknown": {"a": [1, "b"]}} )");
+    std::string str;
+    int32_t integer = 0;
+    float floating_point = 0;
+    bool boolean = true;
+    std::vector<int32_t> vector;
+    json j;
+    reader.read_object([&](std::string_view key) {
+        if (key == "string") {
+            reader.read(str);
+        } else if (key == "int") {
+            reader.read(integer);
+        } else if (key == "float") {
+            reader.read(floating_point);
+        } else if (key == "bool") {
+            reader.read(boolean);
+        } else if (key == "vector") {
+            reader.read(vector);
+        } else if (key == "json") {
+            reader.read(j);
+        } else {
+            reader.skip();
+        }
+    });
+    reader.end();
+
+    EXPECT_EQ(str, "esc\"aped\\\n\xc3\xa4\xf0\x9f\x98\x80");
+    EXPECT_EQ(integer, -42);
+    EXPECT_EQ(floating_point, 150.0f);
+    EXPECT_FALSE(boolean);
+    EXPECT_EQ(vector, (std::vector<int32_t>{1, 2, 3}));
+    EXPECT_EQ(j, json::parse(R"({"nested": [null, true]})"));
+}
+
+TEST(JsonReaderTest, reports_errors_like_json) {
+    EXPECT_THROW(from_json_string<v16::SetChargingProfileRequest>(R"({"connectorId": 1)"), json::parse_error);
+    EXPECT_THROW(from_json_string<v16::SetChargingProfileRequest>(R"({"connectorId": "1"})"), json::type_error);
+    EXPECT_THROW(from_json_string<v16::SetChargingProfileRequest>(R"({"connectorId": 1})"), json::out_of_range);
+    EXPECT_THROW(from_json_string<v16::SendLocalListRequest>(R"({"listVersion": 1, "updateType": "Full"} trailing)"),
+                 json::parse_error);
+}
+
+TEST(JsonReaderTest, v16_set_charging_profile_matches_from_json) {
+    const std::string message = R"([2, "1234", "SetChargingProfile", {
+        "connectorId": 1,
+        "csChargingProfiles": {
+            "chargingProfileId": 7,
+            "stackLevel": 0,
+            "chargingProfilePurpose": "TxDefaultProfile",
+            "chargingProfileKind": "Recurring",
+            "recurrencyKind": "Daily",
+            "validFrom": "2024-01-01T00:00:00.000Z",
+            "chargingSchedule": {
+                "duration": 86400,
+                "chargingRateUnit": "A",
+                "chargingSchedulePeriod": [
+                    {"startPeriod": 0, "limit": 16.0},
+                    {"startPeriod": 3600, "limit": 32.5, "numberPhases": 3}
+                ],
+                "minChargingRate": 6.0
+            }
+        }
+    }])";
+
+    const auto call = from_json_string<Call<v16::SetChargingProfileRequest>>(message);
+    const Call<v16::SetChargingProfileRequest> expected = json::parse(message);
+
+    EXPECT_EQ(call.uniqueId.get(), "1234");
+    EXPECT_EQ(json(call), json(expected));
+}
+
+TEST(JsonReaderTest, v16_send_local_list_matches_from_json) {
+    const std::string message = R"([2, "5678", "SendLocalList", {
+        "listVersion": 3,
+        "updateType": "Differential",
+        "localAuthorizationList": [
+            {"idTag": "TAG1", "idTagInfo": {"status": "Accepted", "expiryDate": "2030-01-01T00:00:00.000Z"}},
+            {"idTag": "TAG2"}
+        ]
+    }])";
+
+    const auto call = from_json_string<Call<v16::SendLocalListRequest>>(message);
+    const Call<v16::SendLocalListRequest> expected = json::parse(message);
+
+    EXPECT_EQ(json(call), json(expected));
+}
+
+TEST(JsonReaderTest, v201_set_variables_matches_from_json) {
+    const std::string message = R"([2, "abc", "SetVariables", {
+        "customData": {"vendorId": "vendor", "extra": [1, 2]},
+        "setVariableData": [{
+            "attributeType": "Actual",
+            "attributeValue": "60",
+            "component": {"name": "OCPPCommCtrlr", "evse": {"id": 1, "connectorId": 2}},
+            "variable": {"name": "HeartbeatInterval"}
+        }]
+    }])";
+
+    const auto call = from_json_string<Call<v201::SetVariablesRequest>>(message);
+    const Call<v201::SetVariablesRequest> expected = json::parse(message);
+
+    EXPECT_EQ(json(call), json(expected));
+}
+
+} // namespace ocpp
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/json_validator.hpp>
+#include <ocpp/common/utils.hpp>
+#include <ocpp/v16/message_validator.hpp>
+#include <ocpp/v16/messages/StatusNotification.hpp>
+#include <ocpp/v201/message_validator.hpp>
+
+namespace ocpp {
+
+namespace {
+/// \brief Validates the given v16 StatusNotification.req \p payload
+/// \returns the validation error, or an empty string if the payload is valid
+std::string validate_status_notification(const std::string& payload) {
+    try {
+        JsonValidator validator(payload);
+        v16::validate_status_notification_request(validator);
+        validator.end();
+    } catch (const JsonValidationError& e) {
+        return e.what();
+    }
+    return "";
+}
+} // namespace
+
+TEST(JsonValidatorTest, accepts_valid_message) {
+    EXPECT_EQ(validate_status_notification(
+                  R"({"connectorId": 1, "errorCode": "NoError", "status": "Available", "info": "ä\n",
+                      "timestamp": "2024-02-29T23:59:59.123+01:00"})"),
+              "");
+}
+
+TEST(JsonValidatorTest, reports_schema_violations) {
+    EXPECT_EQ(validate_status_notification(R"({"connectorId": 1, "errorCode": "NoError"})"),
+              "StatusNotificationRequest.status: required member is missing");
+    EXPECT_EQ(validate_status_notification(R"({"connectorId": 1.5, "errorCode": "NoError", "status": "Available"})"),
+              "StatusNotificationRequest.connectorId: expected integer");
+    EXPECT_EQ(validate_status_notification(R"({"connectorId": 1, "errorCode": "NoError", "status": "Unknown"})"),
+              "StatusNotificationRequest.status: \"Unknown\" is not a valid enum value");
+    EXPECT_EQ(validate_status_notification(
+                  R"({"connectorId": 1, "errorCode": "NoError", "status": "Available", "extra": true})"),
+              "StatusNotificationRequest.extra: member is not allowed by the schema");
+    EXPECT_EQ(validate_status_notification(R"({"connectorId": 1, "errorCode": "NoError", "status": "Available",
+                                               "info": "012345678901234567890123456789012345678901234567890"})"),
+              "StatusNotificationRequest.info: string exceeds the maximum length of 50");
+    EXPECT_EQ(validate_status_notification(R"({"connectorId": 1, "errorCode": "NoError", "status": "Available",
+                                               "timestamp": "2023-02-29T00:00:00Z"})"),
+              "StatusNotificationRequest.timestamp: expected RFC 3339 date-time");
+    EXPECT_EQ(validate_status_notification(R"([1])"), "expected object");
+}
+
+TEST(JsonValidatorTest, validates_date_time) {
+    EXPECT_TRUE(is_rfc3339_date_time("2024-01-01T00:00:00Z"));
+    EXPECT_TRUE(is_rfc3339_date_time("2024-01-01T00:00:00.5-05:30"));
+    EXPECT_FALSE(is_rfc3339_date_time("2024-01-01 00:00:00Z"));
+    EXPECT_FALSE(is_rfc3339_date_time("2024-13-01T00:00:00Z"));
+    EXPECT_FALSE(is_rfc3339_date_time("2024-01-01T00:00:00"));
+    EXPECT_FALSE(is_rfc3339_date_time("2024-01-01T00:00:00.Z"));
+
+    // the same strict format as is_rfc3339_datetime of the device model
+    for (const auto& value : {"2024-01-01t00:00:00Z", "2024-01-01T00:00:00z", "2024-01-01T00:00:00.0001Z",
+                              "2024-01-01T23:59:60Z", "2024-02-30T00:00:00Z", "2024-01-01T00:00:00+24:00"}) {
+        EXPECT_FALSE(is_rfc3339_date_time(value)) << value;
+        EXPECT_FALSE(is_rfc3339_datetime(value)) << value;
+    }
+}
+
+TEST(JsonValidatorTest, validates_nested_types_by_message_type) {
+    const std::string valid = R"({
+        "customData": {"vendorId": "vendor", "extra": [1, 2]},
+        "setVariableData": [{
+            "attributeType": "Actual",
+            "attributeValue": "60",
+            "component": {"name": "OCPPCommCtrlr", "evse": {"id": 1, "connectorId": 2}},
+            "variable": {"name": "HeartbeatInterval"}
+        }]
+    })";
+    JsonValidator validator(valid);
+    EXPECT_NO_THROW(v201::validate_message(v201::MessageType::SetVariables, validator));
+
+    const std::string invalid = R"({"setVariableData": [{"attributeValue": "60", "component": {"name": "OCPPCommCtrlr",
+                                    "evse": {"connectorId": 2}}, "variable": {"name": "HeartbeatInterval"}}]})";
+    JsonValidator invalid_validator(invalid);
+    try {
+        v201::validate_message(v201::MessageType::SetVariables, invalid_validator);
+        FAIL() << "expected a JsonValidationError";
+    } catch (const JsonValidationError& e) {
+        EXPECT_STREQ(e.what(), "EVSE.id: required member is missing");
+    }
+
+    JsonValidator response_validator(R"({"status": "Accepted", "currentTime": "2024-01-01T00:00:00Z",
+                                         "interval": 300})");
+    EXPECT_NO_THROW(v16::validate_message(v16::MessageType::BootNotificationResponse, response_validator));
+}
+
+TEST(JsonValidatorTest, validates_number_of_array_items) {
+    const auto validate = [](v201::MessageType message_type, const std::string& payload) -> std::string {
+        try {
+            JsonValidator validator(payload);
+            v201::validate_message(message_type, validator);
+        } catch (const JsonValidationError& e) {
+            return e.what();
+        }
+        return "";
+    };
+
+    EXPECT_EQ(validate(v201::MessageType::SetVariables, R"({"setVariableData": []})"),
+              "SetVariablesRequest.setVariableData: array has less than the minimum of 1 items");
+    EXPECT_EQ(validate(v201::MessageType::GetReport, R"({"requestId": 1, "componentCriteria": []})"),
+              "GetReportRequest.componentCriteria: array has less than the minimum of 1 items");
+    EXPECT_EQ(validate(v201::MessageType::GetReport,
+                       R"({"requestId": 1, "componentCriteria": ["Active", "Available", "Enabled", "Problem"]})"),
+              "");
+    EXPECT_EQ(validate(v201::MessageType::GetReport, R"({"requestId": 1,
+                       "componentCriteria": ["Active", "Available", "Enabled", "Problem", "Active"]})"),
+              "GetReportRequest.componentCriteria: array exceeds the maximum of 4 items");
+}
+
+} // namespace ocpp
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/v16/messages/BootNotification.hpp>
+#include <ocpp/v201/messages/GetReport.hpp>
+#include <ocpp/v201/messages/NotifyReport.hpp>
+
+namespace ocpp {
+
+TEST(JsonWriterTest, writes_values_like_dump) {
+    std::string buffer;
+    JsonWriter writer(buffer);
+    writer.begin_object();
+    writer.member("string", "quote \" backslash \\ newline \n tab \t control \x01");
+    writer.member("int", int32_t{-42});
+    writer.member("uint", uint64_t{18446744073709551615u});
+    writer.member("float", 0.1f);
+    writer.member("double", 1e300);
+    writer.member("nan", std::nan(""));
+    writer.member("bool", true);
+    writer.member("vector", std::vector<int32_t>{1, 2, 3});
+    writer.member("empty", std::vector<int32_t>{});
+    writer.member("json", json{{"nested", json::array({1, "two", nullptr})}});
+    writer.end_object();
+
+    const json expected = {{"string", "quote \" backslash \\ newline \n tab \t control \x01"},
+                           {"int", -42},
+                           {"uint", 18446744073709551615u},
+                           {"float", 0.1f},
+                           {"double", 1e300},
+                           {"bool", true},
+                           {"vector", {1, 2, 3}},
+                           {"empty", json::array()},
+                           {"json", {{"nested", json::array({1, "two", nullptr})}}}};
+
+    auto written = json::parse(buffer);
+    EXPECT_TRUE(written.at("nan").is_null());
+    written.erase("nan");
+    EXPECT_EQ(written, expected);
+    // members are written in order, so compare the serialized values one by one as well
+    EXPECT_NE(buffer.find("\"string\":" + expected.at("string").dump()), std::string::npos);
+    EXPECT_NE(buffer.find("\"float\":" + expected.at("float").dump()), std::string::npos);
+    EXPECT_NE(buffer.find("\"nan\":null"), std::string::npos);
+}
+
+TEST(JsonWriterTest, v16_call_matches_to_json) {
+    v16::BootNotificationRequest request;
+    request.chargePointVendor = "Vendor";
+    request.chargePointModel = "Model";
+    request.firmwareVersion = "1.0.0";
+    const Call<v16::BootNotificationRequest> call(request, MessageId("1234"));
+
+    EXPECT_EQ(json::parse(to_json_string(call)), json(call));
+}
+
+TEST(JsonWriterTest, v201_call_result_matches_to_json) {
+    v201::GetReportRequest request;
+    request.requestId = 1;
+    request.componentCriteria = {v201::ComponentCriterionEnum::Active, v201::ComponentCriterionEnum::Problem};
+    v201::ComponentVariable component_variable;
+    component_variable.component.name = "OCPPCommCtrlr";
+    component_variable.variable = v201::Variable();
+    component_variable.variable->name = "HeartbeatInterval";
+    request.componentVariable = {component_variable};
+    request.customData = json{{"vendorId", "vendor"}};
+    const CallResult<v201::GetReportRequest> call_result(request, MessageId("5678"));
+
+    EXPECT_EQ(json::parse(to_json_string(call_result)), json(call_result));
+}
+
+TEST(JsonWriterTest, v201_nested_message_matches_to_json) {
+    v201::ReportData report_data;
+    report_data.component.name = "EVSE";
+    report_data.component.evse = v201::EVSE();
+    report_data.component.evse->id = 1;
+    report_data.variable.name = "Power";
+    v201::VariableAttribute attribute;
+    attribute.value = "11000.5";
+    attribute.type = v201::AttributeEnum::Actual;
+    attribute.mutability = v201::MutabilityEnum::ReadOnly;
+    report_data.variableAttribute = {attribute};
+    v201::VariableCharacteristics characteristics;
+    characteristics.dataType = v201::DataEnum::decimal;
+    characteristics.supportsMonitoring = true;
+    characteristics.maxLimit = 22000.0f;
+    report_data.variableCharacteristics = characteristics;
+
+    v201::NotifyReportRequest request;
+    request.requestId = 3;
+    request.generatedAt = DateTime();
+    request.seqNo = 0;
+    request.tbc = false;
+    request.reportData = {report_data};
+
+    EXPECT_EQ(json::parse(to_json_string(request)), json(request));
+}
+
+TEST(JsonWriterTest, call_error_matches_to_json) {
+    const CallError call_error(MessageId("abc"), "NotImplemented", "Not \"implemented\"", json({}, true));
+
+    EXPECT_EQ(json::parse(to_json_string(call_error)), json(call_error));
+}
+
+} // namespace ocpp
@@ -9,6 +9,8 @@
 #include <ocpp/v16/messages/SecurityEventNotification.hpp>
 #include <ocpp/v16/messages/StartTransaction.hpp>
 #include <ocpp/v201/messages/Authorize.hpp>
+#include <ocpp/v201/messages/TransactionEvent.hpp>
+#include <ocpp/v201/transaction.hpp>
 
 namespace ocpp {
 
@@ -29,7 +31,7 @@ enum class TestMessageType {
     BootNotification
 };
 
-static std::string to_string(TestMessageType m) {
+static std::string_view to_string(TestMessageType m) {
     switch (m) {
     case TestMessageType::TRANSACTIONAL:
         return "transactional";
@@ -82,8 +84,9 @@ static TestMessageType to_test_message_type(const std::string& s) {
 struct TestRequest : Message {
     TestMessageType type = TestMessageType::NON_TRANSACTIONAL;
     std::optional<std::string> data;
+    std::optional<std::string> transaction_id;
     std::string get_type() const {
-        return to_string(type);
+        return std::string(to_string(type));
     };
 };
 
@@ -92,15 +95,32 @@ void to_json(json& j, const TestRequest& k) {
     if (k.data) {
         j["data"] = k.data.value();
     }
+    if (k.transaction_id) {
+        j["transactionId"] = k.transaction_id.value();
+    }
+}
+
+void write_json(JsonWriter& writer, const TestRequest& k) {
+    writer.begin_object();
+    if (k.data) {
+        writer.member("data", k.data.value());
+    }
+    if (k.transaction_id) {
+        writer.member("transactionId", k.transaction_id.value());
+    }
+    writer.end_object();
 }
 
 void from_json(const json& j, TestRequest& k) {
     if (j.contains("data")) {
         k.data.emplace(j.at("data"));
     }
+    if (j.contains("transactionId")) {
+        k.transaction_id.emplace(j.at("transactionId"));
+    }
 }
 
-template <> std::string MessageQueue<TestMessageType>::messagetype_to_string(TestMessageType m) {
+template <> std::string_view MessageQueue<TestMessageType>::messagetype_to_string(TestMessageType m) {
     return to_string(m);
 }
 
@@ -108,11 +128,16 @@ template <> TestMessageType MessageQueue<TestMessageType>::string_to_messagetype
     return to_test_message_type(s);
 }
 
+template <> void MessageQueue<TestMessageType>::validate_payload(TestMessageType, JsonValidator& validator) {
+    validator.any();
+}
+
 template <> ControlMessage<TestMessageType>::ControlMessage(const json& message) {
     this->message = message.get<json::array_t>();
     EVLOG_info << this->message;
     this->messageType = to_test_message_type(this->message[2]);
     this->message_attempts = 0;
+    this->initial_unique_id = this->message[MESSAGE_ID];
 }
 
 std::ostream& operator<<(std::ostream& os, const TestMessageType& message_type) {
@@ -133,6 +158,19 @@ template <> bool ControlMessage<TestMessageType>::isBootNotificationMessage() co
     return this->messageType == TestMessageType::BootNotification;
 }
 
+template <> bool ControlMessage<TestMessageType>::isTransactionEndMessage() const {
+    return false;
+}
+
+template <> std::optional<std::string> ControlMessage<TestMessageType>::transactionId() const {
+    const auto& payload = this->message.at(CALL_PAYLOAD);
+    if (!payload.contains("transactionId")) {
+        return std::nullopt;
+    }
+    const auto& transaction_id = payload.at("transactionId");
+    return transaction_id.is_string() ? transaction_id.get<std::string>() : transaction_id.dump();
+}
+
 /************************************************************************************************
  * ControlMessage
  *
@@ -179,6 +217,18 @@ TEST_F(ControlMessageV16Test, test_is_transactional_update) {
                      .isTransactionUpdateMessage());
 }
 
+TEST_F(ControlMessageV16Test, test_is_transaction_end) {
+
+    EXPECT_TRUE(
+        (ControlMessage<v16::MessageType>{Call<v16::StopTransactionRequest>{v16::StopTransactionRequest{}, "0"}})
+            .isTransactionEndMessage());
+    EXPECT_TRUE(
+        !(ControlMessage<v16::MessageType>{Call<v16::StartTransactionRequest>{v16::StartTransactionRequest{}, "0"}})
+             .isTransactionEndMessage());
+    EXPECT_TRUE(!(ControlMessage<v16::MessageType>{Call<v16::MeterValuesRequest>{v16::MeterValuesRequest{}, "0"}})
+                     .isTransactionEndMessage());
+}
+
 class ControlMessageV201Test : public ::testing::Test {
 
 protected:
@@ -216,6 +266,23 @@ TEST_F(ControlMessageV201Test, test_is_transactional_update) {
                      .isTransactionUpdateMessage());
 }
 
+TEST_F(ControlMessageV201Test, test_is_transaction_end) {
+
+    v201::TransactionEventRequest transaction_event_request{};
+    transaction_event_request.eventType = v201::TransactionEventEnum::Ended;
+
+    EXPECT_TRUE((ControlMessage<v201::MessageType>{Call<v201::TransactionEventRequest>{transaction_event_request, "0"}})
+                    .isTransactionEndMessage());
+
+    transaction_event_request.eventType = v201::TransactionEventEnum::Updated;
+    EXPECT_TRUE(
+        !(ControlMessage<v201::MessageType>{Call<v201::TransactionEventRequest>{transaction_event_request, "0"}})
+             .isTransactionEndMessage());
+
+    EXPECT_TRUE(!(ControlMessage<v201::MessageType>{Call<v201::AuthorizeRequest>{v201::AuthorizeRequest{}, "0"}})
+                     .isTransactionEndMessage());
+}
+
 /************************************************************************************************
  * MessageQueueTest
  */
@@ -230,8 +297,15 @@ public:
     }
 
     MOCK_METHOD(std::vector<common::DBTransactionMessage>, get_transaction_messages, (), (override));
+    MOCK_METHOD(std::vector<common::DBTransactionMessage>, get_transaction_messages, (int64_t, int64_t, size_t),
+                (override));
+    MOCK_METHOD(int64_t, get_last_transaction_message_sequence, (), (override));
+    MOCK_METHOD(std::vector<common::DBTransactionMessageCounts>, get_transaction_message_counts, (int64_t),
+                (override));
     MOCK_METHOD(void, insert_transaction_message, (const common::DBTransactionMessage&), (override));
     MOCK_METHOD(void, remove_transaction_message, (const std::string&), (override));
+    MOCK_METHOD(void, update_transaction_messages,
+                (const std::vector<common::DBTransactionMessage>&, const std::vector<std::string>&), (override));
 };
 
 class MessageQueueTest : public ::testing::Test {
@@ -282,10 +356,12 @@ protected:
         return push_message_call(message_type, unique_identifier);
     }
 
-    std::string push_message_call(const TestMessageType& message_type, const std::string& identifier) {
+    std::string push_message_call(const TestMessageType& message_type, const std::string& identifier,
+                                  const std::optional<std::string>& transaction_id = std::nullopt) {
         Call<TestRequest> call;
         call.msg.type = message_type;
         call.msg.data = identifier;
+        call.msg.transaction_id = transaction_id;
         call.uniqueId = identifier;
         message_queue->push(call);
         return identifier;
@@ -342,6 +418,42 @@ TEST_F(MessageQueueTest, test_non_transactional_message_is_sent) {
     wait_for_calls();
 }
 
+// \brief Test that a full outbound queue of the websocket neither pauses the queue nor drops replies
+TEST_F(MessageQueueTest, test_full_outbound_queue_is_retried) {
+    testing::MockFunction<WebsocketSendResult(const json&, const std::function<void(bool sent)>&)> send_mock;
+    message_queue->stop();
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_mock.AsStdFunction(), config,
+                                                                    std::vector<TestMessageType>{}, db);
+    message_queue->resume(std::chrono::seconds(0));
+
+    const auto is_reply = testing::Truly([](const json& message) { return message.at(MESSAGE_TYPE_ID) == 4; });
+    const auto is_call = testing::Truly([](const json& message) { return message.at(MESSAGE_TYPE_ID) == 2; });
+    std::promise<void> call_sent;
+    testing::Sequence s;
+
+    // the reply is handed over again before the call, which is handed over again without resuming the queue
+    EXPECT_CALL(send_mock, Call(is_reply, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::Return(WebsocketSendResult::WouldBlock));
+    EXPECT_CALL(send_mock, Call(is_reply, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::Return(WebsocketSendResult::Accepted));
+    EXPECT_CALL(send_mock, Call(is_call, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::Return(WebsocketSendResult::WouldBlock));
+    EXPECT_CALL(send_mock, Call(is_call, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::InvokeWithoutArgs([&call_sent]() {
+            call_sent.set_value();
+            return WebsocketSendResult::Accepted;
+        }));
+
+    message_queue->push(CallError(MessageId("reply"), "GenericError", "", json::object()));
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+
+    EXPECT_EQ(call_sent.get_future().wait_for(std::chrono::seconds(3)), std::future_status::ready);
+}
+
 // \brief Test transactional messages that are sent while being offline are sent afterwards
 TEST_F(MessageQueueTest, test_queuing_up_of_transactional_messages) {
 
@@ -555,4 +667,427 @@ TEST_F(MessageQueueTest, test_clean_up_transactional_queue) {
     wait_for_calls(expected_sent_messages);
 }
 
+// \brief Test that queued transaction messages are found by their transaction id, also after the transaction id of a
+// queued message has been replaced
+TEST_F(MessageQueueTest, test_transaction_message_index) {
+    EXPECT_CALL(*db, insert_transaction_message(testing::_)).Times(3);
+    EXPECT_CALL(*db, remove_transaction_message(testing::_)).WillRepeatedly(testing::Return());
+
+    // go offline
+    message_queue->pause();
+
+    push_message_call(TestMessageType::TRANSACTIONAL, "start_1", "tx_1");
+    push_message_call(TestMessageType::TRANSACTIONAL_UPDATE, "update_1");
+    push_message_call(TestMessageType::TRANSACTIONAL, "start_2", "tx_2");
+
+    EXPECT_TRUE(message_queue->contains_transaction_messages("tx_1"));
+    EXPECT_TRUE(message_queue->contains_transaction_messages("tx_2"));
+    EXPECT_FALSE(message_queue->contains_transaction_messages("42"));
+
+    // the transaction id of the update message becomes known
+    message_queue->add_meter_value_message_id("start_1", "update_1");
+    message_queue->notify_start_transaction_handled("start_1", 42);
+    EXPECT_TRUE(message_queue->contains_transaction_messages("42"));
+
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "start_1", "transactional", json{{"data", "start_1"}, {"transactionId", "tx_1"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "update_1", "transactional_update", json{{"data", "update_1"}, {"transactionId", 42}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "start_2", "transactional", json{{"data", "start_2"}, {"transactionId", "tx_2"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+
+    // Resume & verify
+    message_queue->resume(std::chrono::seconds(0));
+    wait_for_calls(3);
+
+    for (int i = 0; i < 100 && !message_queue->is_transaction_message_queue_empty(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_FALSE(message_queue->contains_transaction_messages("tx_1"));
+    EXPECT_FALSE(message_queue->contains_transaction_messages("42"));
+    EXPECT_FALSE(message_queue->contains_transaction_messages("tx_2"));
+}
+
+// \brief Test that update messages of a transaction are merged into the last queued message of the transaction
+// instead of being queued once the queue size threshold is reached
+TEST_F(MessageQueueTest, test_compaction_of_transactional_update_messages) {
+    config.queues_total_size_threshold = 3;
+    config.transaction_update_compaction_items_per_message = 3;
+    init_message_queue();
+
+    EXPECT_CALL(*db, insert_transaction_message(testing::_)).Times(4);
+    EXPECT_CALL(*db, remove_transaction_message(testing::_)).WillRepeatedly(testing::Return());
+    // the message merged into is updated in place, the merged messages are never persisted
+    EXPECT_CALL(*db, update_transaction_messages(testing::ElementsAre(testing::Field(
+                                                     &common::DBTransactionMessage::unique_id, "update_2")),
+                                                 testing::IsEmpty()))
+        .Times(2);
+
+    // go offline
+    message_queue->pause();
+
+    const auto push_update = [this](const std::string& unique_id, const int meter_value) {
+        message_queue->push(json{2, unique_id, "transactional_update",
+                                 json{{"transactionId", "tx_1"}, {"meterValue", json::array({meter_value})}}});
+    };
+    push_message_call(TestMessageType::TRANSACTIONAL, "start", "tx_1");
+    push_update("update_1", 1);
+    push_update("update_2", 2);
+    // the threshold is reached, the following updates are merged into update_2
+    push_update("update_3", 3);
+    push_update("update_4", 4);
+    // update_2 carries the configured number of meter values, so this one is queued and the threshold is exceeded
+    push_update("update_5", 5);
+
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "start", "transactional", json{{"data", "start"}, {"transactionId", "tx_1"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    // update_1 has been dropped
+    EXPECT_CALL(send_callback_mock, Call(json{2, "update_2", "transactional_update",
+                                              json{{"transactionId", "tx_1"}, {"meterValue", json::array({2, 3, 4})}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(json{2, "update_5", "transactional_update",
+                                              json{{"transactionId", "tx_1"}, {"meterValue", json::array({5})}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+
+    // Resume & verify
+    message_queue->resume(std::chrono::seconds(0));
+    wait_for_calls(3);
+}
+
+// \brief Test that update messages carrying a sequence number are not merged if their sequence number can not be taken
+// back, since merging them would leave a gap in the sequence numbers of their transaction
+TEST_F(MessageQueueTest, test_no_compaction_of_sequenced_update_messages) {
+    config.queues_total_size_threshold = 2;
+    config.transaction_update_compaction_items_per_message = 10;
+    init_message_queue();
+
+    EXPECT_CALL(*db, insert_transaction_message(testing::_)).Times(4);
+    EXPECT_CALL(*db, remove_transaction_message(testing::_)).WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, update_transaction_messages(testing::_, testing::_)).Times(0);
+
+    message_queue->pause();
+
+    const auto push_event = [this](const int seq_no) {
+        message_queue->push(json{2, "event_" + std::to_string(seq_no), "transactional_update",
+                                 json{{"transactionId", "tx_1"}, {"seqNo", seq_no}, {"meterValue", json::array({0})}}});
+    };
+    // no rollback has been set
+    push_event(1);
+    push_event(2);
+    push_event(3);
+
+    // a later sequence number has been handed out already
+    std::vector<std::pair<std::string, int32_t>> rollbacks;
+    message_queue->set_sequence_number_rollback([&rollbacks](const std::string& transaction_id, int32_t seq_no) {
+        rollbacks.emplace_back(transaction_id, seq_no);
+        return false;
+    });
+    push_event(4);
+    EXPECT_EQ(rollbacks, (std::vector<std::pair<std::string, int32_t>>{{"tx_1", 4}}));
+}
+
+// \brief Test that TransactionEvent(Updated) messages of OCPP 2.0.1 are merged and give back their seqNo, so the
+// events of the transaction continue without a gap
+TEST_F(MessageQueueTest, test_compaction_of_v201_transaction_events) {
+    config.queues_total_size_threshold = 2;
+    config.transaction_update_compaction_items_per_message = 10;
+
+    testing::MockFunction<bool(json message)> v201_send_mock;
+    auto v201_queue = std::make_unique<MessageQueue<v201::MessageType>>(v201_send_mock.AsStdFunction(), config, db);
+    v201::EnhancedTransaction transaction{};
+    transaction.transactionId = "tx_1";
+    v201_queue->set_sequence_number_rollback([&transaction](const std::string& transaction_id, int32_t seq_no) {
+        return transaction_id == transaction.transactionId.get() && transaction.release_seq_no(seq_no);
+    });
+
+    std::vector<json> persisted;
+    EXPECT_CALL(*db, insert_transaction_message(testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(
+            [&persisted](const common::DBTransactionMessage& message) { persisted.push_back(message.json_message); }));
+    EXPECT_CALL(*db, remove_transaction_message(testing::_)).WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, update_transaction_messages(testing::_, testing::IsEmpty()))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([&persisted](const std::vector<common::DBTransactionMessage>& messages,
+                                                     const std::vector<std::string>&) {
+            persisted.at(1) = messages.at(0).json_message;
+        }));
+
+    v201_queue->pause();
+
+    int message_id = 0;
+    const auto push_event = [&](v201::TransactionEventEnum event_type, std::optional<float> meter_value) {
+        v201::TransactionEventRequest req;
+        req.eventType = event_type;
+        req.timestamp = DateTime();
+        req.triggerReason = v201::TriggerReasonEnum::MeterValuePeriodic;
+        req.seqNo = transaction.get_seq_no();
+        req.transactionInfo = transaction.get_transaction();
+        if (meter_value.has_value()) {
+            v201::SampledValue sampled_value;
+            sampled_value.value = meter_value.value();
+            req.meterValue = std::vector<v201::MeterValue>{{{sampled_value}, DateTime()}};
+        }
+        v201_queue->push(Call<v201::TransactionEventRequest>(req, std::to_string(message_id++)));
+    };
+    push_event(v201::TransactionEventEnum::Started, std::nullopt);
+    push_event(v201::TransactionEventEnum::Updated, 1);
+    // the threshold is reached, the following events are merged into the first one and give their seqNo back
+    push_event(v201::TransactionEventEnum::Updated, 2);
+    push_event(v201::TransactionEventEnum::Updated, 3);
+
+    ASSERT_EQ(persisted.size(), 2);
+    EXPECT_EQ(persisted.at(0).at(CALL_PAYLOAD).at("seqNo"), 0);
+    const auto& merged = persisted.at(1).at(CALL_PAYLOAD);
+    EXPECT_EQ(merged.at("seqNo"), 1);
+    ASSERT_EQ(merged.at("meterValue").size(), 3);
+    EXPECT_EQ(merged.at("meterValue").at(2).at("sampledValue").at(0).at("value"), 3);
+    // the next event of the transaction directly follows the merged event
+    EXPECT_EQ(transaction.get_seq_no(), 2);
+
+    v201_queue->stop();
+}
+
+// \brief Test that queued non-transactional messages are coalesced according to their coalescing rule
+TEST_F(MessageQueueTest, test_coalescing_of_non_transactional_messages) {
+    config.queues_total_size_threshold = 10;
+    config.queue_all_messages = true;
+    init_message_queue();
+    const auto key_extractor = [](const json& payload) -> std::optional<std::string> {
+        if (!payload.contains("transactionId")) {
+            return std::nullopt;
+        }
+        return payload.at("transactionId").get<std::string>();
+    };
+    message_queue->set_coalescing_rule(TestMessageType::NON_TRANSACTIONAL,
+                                       {CoalescingPolicy::LatestWins, key_extractor});
+
+    // go offline
+    message_queue->pause();
+
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "status_1", "connector_1");
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "status_2", "connector_2");
+    // replaces status_1 at its position in the queue
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "status_3", "connector_1");
+    // no coalescing key
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "other");
+
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock, Call(json{2, "status_3", "non_transactional",
+                                              json{{"data", "status_3"}, {"transactionId", "connector_1"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(json{2, "status_2", "non_transactional",
+                                              json{{"data", "status_2"}, {"transactionId", "connector_2"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(json{2, "other", "non_transactional", json{{"data", "other"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+
+    // Resume & verify
+    message_queue->resume(std::chrono::seconds(0));
+    wait_for_calls(3);
+}
+
+// \brief Test that a message is discarded if a message with the same coalescing key is queued and the first one wins
+TEST_F(MessageQueueTest, test_coalescing_keeps_first_message) {
+    config.queues_total_size_threshold = 10;
+    config.queue_all_messages = true;
+    init_message_queue();
+    message_queue->set_coalescing_rule(
+        TestMessageType::NON_TRANSACTIONAL,
+        {CoalescingPolicy::FirstWins, [](const json&) -> std::optional<std::string> { return std::string(); }});
+
+    // go offline
+    message_queue->pause();
+
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "heartbeat_1");
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "heartbeat_2");
+
+    EXPECT_CALL(send_callback_mock, Call(json{2, "heartbeat_1", "non_transactional", json{{"data", "heartbeat_1"}}}))
+        .WillOnce(MarkAndReturn(true, true));
+
+    // Resume & verify
+    message_queue->resume(std::chrono::seconds(0));
+    wait_for_calls(1);
+
+    // once it has been sent, the next message is queued again. It waits behind a message in flight, so the following
+    // one is coalesced with it and its sender receives the response to the queued one
+    EXPECT_CALL(*db, insert_transaction_message(testing::_));
+    EXPECT_CALL(*db, remove_transaction_message(testing::_));
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "in_flight", "transactional", json{{"data", "in_flight"}, {"transactionId", "tx_1"}}}))
+        .WillOnce(MarkAndReturn(true));
+    push_message_call(TestMessageType::TRANSACTIONAL, "in_flight", "tx_1");
+    wait_for_calls(2);
+
+    const auto push_heartbeat = [this](const std::string& unique_id) {
+        Call<TestRequest> call;
+        call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+        call.msg.data = unique_id;
+        call.uniqueId = unique_id;
+        return message_queue->push_async(call);
+    };
+    auto queued_response = push_heartbeat("heartbeat_3");
+    auto discarded_response = push_heartbeat("heartbeat_4");
+
+    EXPECT_CALL(send_callback_mock, Call(json{2, "heartbeat_3", "non_transactional", json{{"data", "heartbeat_3"}}}))
+        .WillOnce(MarkAndReturn(true, true));
+    message_queue->receive(json{3, "in_flight", ""}.dump());
+    wait_for_calls(3);
+
+    ASSERT_EQ(queued_response.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    ASSERT_EQ(discarded_response.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_EQ(queued_response.get().uniqueId, MessageId("heartbeat_3"));
+    const auto discarded = discarded_response.get();
+    EXPECT_EQ(discarded.uniqueId, MessageId("heartbeat_3"));
+    EXPECT_FALSE(discarded.offline);
+}
+
+// \brief Test that persisted transaction messages are replayed page by page before the messages that are queued
+// during the replay, and that the messages that have not been replayed yet are found by their transaction id
+TEST_F(MessageQueueTest, test_paged_replay_of_transactional_messages) {
+    config.queues_total_size_threshold = 10;
+    config.transaction_message_replay_window = 2;
+    init_message_queue();
+
+    std::vector<common::DBTransactionMessage> persisted_messages;
+    for (int i = 1; i <= 5; i++) {
+        const auto unique_id = "replayed_" + std::to_string(i);
+        const std::string transaction_id = i < 5 ? "tx_1" : "tx_2";
+        common::DBTransactionMessage message{
+            json{2, unique_id, "transactional", json{{"data", unique_id}, {"transactionId", transaction_id}}},
+            "transactional", 0, DateTime(), unique_id};
+        message.sequence = i;
+        persisted_messages.push_back(message);
+    }
+
+    const auto read_page = [&persisted_messages](int64_t after_sequence, int64_t until_sequence, size_t limit) {
+        std::vector<common::DBTransactionMessage> page;
+        for (const auto& message : persisted_messages) {
+            if (message.sequence > after_sequence && message.sequence <= until_sequence && page.size() < limit) {
+                page.push_back(message);
+            }
+        }
+        return page;
+    };
+    EXPECT_CALL(*db, get_last_transaction_message_sequence()).WillOnce(testing::Return(5));
+    // the messages are counted by the database, only the first page is read when the replay starts and never more
+    // messages than the replay window are read at once
+    const std::vector<common::DBTransactionMessageCounts> counts{{"tx_1", 4, 0, 0}, {"tx_2", 1, 0, 0}};
+    EXPECT_CALL(*db, get_transaction_message_counts(5)).WillOnce(testing::Return(counts));
+    EXPECT_CALL(*db, get_transaction_messages(testing::_, 5, testing::Le(2u))).WillOnce(read_page);
+    EXPECT_CALL(*db, insert_transaction_message(testing::_)).Times(1);
+    EXPECT_CALL(*db, remove_transaction_message(testing::_)).WillRepeatedly(testing::Return());
+
+    // go offline
+    message_queue->pause();
+
+    message_queue->get_transaction_messages_from_db();
+    push_message_call(TestMessageType::TRANSACTIONAL, "live_1", "tx_3");
+
+    EXPECT_FALSE(message_queue->is_transaction_message_queue_empty());
+    // only the first page has been replayed yet, the following messages are found without reading the database
+    EXPECT_CALL(*db, get_transaction_messages(testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_TRUE(message_queue->contains_transaction_messages("tx_2"));
+    EXPECT_TRUE(message_queue->contains_transaction_messages("tx_3"));
+    EXPECT_FALSE(message_queue->contains_transaction_messages("tx_4"));
+    EXPECT_CALL(*db, get_transaction_messages(testing::_, 5, testing::Le(2u))).WillRepeatedly(read_page);
+
+    testing::Sequence s;
+    for (int i = 1; i <= 5; i++) {
+        EXPECT_CALL(send_callback_mock, Call(persisted_messages.at(i - 1).json_message))
+            .InSequence(s)
+            .WillOnce(MarkAndReturn(true, true));
+    }
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "live_1", "transactional", json{{"data", "live_1"}, {"transactionId", "tx_3"}}}))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true));
+
+    // Resume & verify
+    message_queue->resume(std::chrono::seconds(0));
+    wait_for_calls(6);
+}
+
+TEST_F(MessageQueueTest, test_raw_message_types_are_not_parsed) {
+    message_queue->set_raw_message_types({TestMessageType::NON_TRANSACTIONAL});
+
+    const std::string raw_call = R"([2, "raw_call", "non_transactional", {"data": "raw"}])";
+    const auto raw_message = message_queue->receive(raw_call);
+    EXPECT_EQ(raw_message.messageTypeId, MessageTypeId::CALL);
+    EXPECT_EQ(raw_message.messageType, TestMessageType::NON_TRANSACTIONAL);
+    EXPECT_EQ(raw_message.uniqueId.get(), "raw_call");
+    EXPECT_EQ(raw_message.raw_message, raw_call);
+    EXPECT_TRUE(raw_message.message.is_null());
+
+    const auto parsed_message = message_queue->receive(R"([2, "parsed_call", "transactional", {"data": "parsed"}])");
+    EXPECT_EQ(parsed_message.messageType, TestMessageType::TRANSACTIONAL);
+    EXPECT_TRUE(parsed_message.raw_message.empty());
+    EXPECT_EQ(parsed_message.message.at(MESSAGE_ID), "parsed_call");
+}
+
+// \brief Test that a serialized payload is written as it is, or parsed again if there is no write callback
+TEST_F(MessageQueueTest, test_serialized_payload_is_sent) {
+    EXPECT_CALL(send_callback_mock, Call(json{2, "0", "non_transactional", json{{"data", "parsed"}}}))
+        .WillOnce(MarkAndReturn(true, true));
+    message_queue->push_serialized(TestMessageType::NON_TRANSACTIONAL, MessageId("0"), R"({"data":"parsed"})");
+    wait_for_calls();
+
+    std::promise<std::string> written;
+    message_queue->set_write_callback([&written](const JsonWriteFunction& write, const std::function<void(bool)>&) {
+        std::string buffer;
+        JsonWriter writer(buffer);
+        write(writer);
+        written.set_value(buffer);
+        return WebsocketSendResult::Accepted;
+    });
+    message_queue->push_serialized(TestMessageType::NON_TRANSACTIONAL, MessageId("1"), R"({"data":"serialized"})");
+
+    auto written_future = written.get_future();
+    ASSERT_EQ(written_future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_EQ(written_future.get(), R"([2,"1","non_transactional",{"data":"serialized"}])");
+}
+
+// \brief Test that the payload of a pushed call is serialized right away unless it is a transaction message
+TEST_F(MessageQueueTest, test_call_payload_is_serialized_when_pushed) {
+    std::promise<std::string> written;
+    message_queue->set_write_callback([&written](const JsonWriteFunction& write, const std::function<void(bool)>&) {
+        std::string buffer;
+        JsonWriter writer(buffer);
+        write(writer);
+        written.set_value(buffer);
+        return WebsocketSendResult::Accepted;
+    });
+
+    // transaction messages keep their payload as json object and are sent using the send callback
+    EXPECT_CALL(send_callback_mock,
+                Call(json{2, "test_call_0", "transactional", json{{"data", "test_call_0"}, {"transactionId", "tx_1"}}}))
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(*db, insert_transaction_message(testing::_));
+    EXPECT_CALL(*db, remove_transaction_message(testing::_));
+    push_message_call(TestMessageType::TRANSACTIONAL, "test_call_0", "tx_1");
+    wait_for_calls();
+
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "test_call_1", "tx_1");
+
+    auto written_future = written.get_future();
+    ASSERT_EQ(written_future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_EQ(written_future.get(),
+              R"([2,"test_call_1","non_transactional",{"data":"test_call_1","transactionId":"tx_1"}])");
+}
+
 } // namespace ocpp
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <future>
+#include <limits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ocpp/common/database/database_connection.hpp>
+#include <ocpp/common/database/transaction_queue_writer.hpp>
+
+namespace ocpp::common {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::IsEmpty;
+
+class DatabaseHandlerWriterMock : public DatabaseHandlerCommon {
+private:
+    void init_sql() override {
+    }
+
+public:
+    DatabaseHandlerWriterMock() : DatabaseHandlerCommon(nullptr, "", 1) {
+    }
+
+    MOCK_METHOD(void, insert_transaction_message, (const DBTransactionMessage&), (override));
+    MOCK_METHOD(void, remove_transaction_message, (const std::string&), (override));
+    MOCK_METHOD(void, update_transaction_messages,
+                (const std::vector<DBTransactionMessage>&, const std::vector<std::string>&), (override));
+};
+
+class TransactionQueueWriterTest : public ::testing::Test {
+protected:
+    std::shared_ptr<DatabaseHandlerWriterMock> db = std::make_shared<testing::StrictMock<DatabaseHandlerWriterMock>>();
+
+    static DBTransactionMessage message(const std::string& unique_id) {
+        return DBTransactionMessage{json::array(), "TransactionEvent", 0, DateTime(), unique_id};
+    }
+};
+
+TEST_F(TransactionQueueWriterTest, zero_commit_interval_writes_immediately) {
+    TransactionQueueWriter writer(db, std::chrono::milliseconds(0));
+
+    EXPECT_CALL(*db, insert_transaction_message(Field(&DBTransactionMessage::unique_id, "1")));
+    writer.insert(message("1"));
+    testing::Mock::VerifyAndClearExpectations(db.get());
+
+    EXPECT_CALL(*db, remove_transaction_message("1"));
+    writer.remove("1");
+}
+
+TEST_F(TransactionQueueWriterTest, flush_commits_staged_changes_in_one_transaction) {
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "2"),
+                                                             Field(&DBTransactionMessage::unique_id, "3")),
+                                                 ElementsAre("1")));
+
+    writer.remove("1");
+    writer.insert(message("2"));
+    writer.insert(message("3"));
+    writer.flush();
+}
+
+TEST_F(TransactionQueueWriterTest, removal_cancels_uncommitted_insertion) {
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "2")), IsEmpty()));
+
+    writer.insert(message("1"));
+    writer.insert(message("2"));
+    writer.remove("1");
+    writer.flush();
+}
+
+TEST_F(TransactionQueueWriterTest, replacement_is_committed_in_one_transaction) {
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+
+    // "1" has been committed before and is updated in place, the insertion of "2" has not been committed
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "1")), IsEmpty()));
+
+    writer.insert(message("2"));
+    writer.replace({"2", "1"}, message("1"));
+    writer.flush();
+}
+
+TEST_F(TransactionQueueWriterTest, removal_deletes_committed_row_of_uncommitted_replacement) {
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "1")), IsEmpty()));
+    writer.insert(message("1"));
+    writer.flush();
+    testing::Mock::VerifyAndClearExpectations(db.get());
+
+    // the update of the committed "1" is cancelled, but its row still has to be deleted
+    EXPECT_CALL(*db, update_transaction_messages(IsEmpty(), ElementsAre("1")));
+    writer.replace({"1"}, message("1"));
+    writer.remove("1");
+    writer.flush();
+}
+
+TEST_F(TransactionQueueWriterTest, batch_size_triggers_commit) {
+    std::promise<void> committed;
+    TransactionQueueWriter writer(db, std::chrono::hours(1), 2);
+
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "1"),
+                                                             Field(&DBTransactionMessage::unique_id, "2")),
+                                                 IsEmpty()))
+        .WillOnce(testing::InvokeWithoutArgs([&committed]() { committed.set_value(); }));
+
+    writer.insert(message("1"));
+    writer.insert(message("2"));
+    EXPECT_EQ(committed.get_future().wait_for(std::chrono::seconds(3)), std::future_status::ready);
+}
+
+TEST_F(TransactionQueueWriterTest, failed_commit_is_applied_one_by_one) {
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+
+    EXPECT_CALL(*db, update_transaction_messages(_, _)).WillOnce(testing::Throw(QueryExecutionException("failed")));
+    EXPECT_CALL(*db, remove_transaction_message("1"));
+    EXPECT_CALL(*db, insert_transaction_message(Field(&DBTransactionMessage::unique_id, "2")))
+        .WillOnce(testing::Throw(QueryExecutionException("failed")));
+    EXPECT_CALL(*db, insert_transaction_message(Field(&DBTransactionMessage::unique_id, "3")));
+
+    writer.remove("1");
+    writer.insert(message("2"));
+    writer.insert(message("3"));
+    writer.flush();
+}
+
+TEST_F(TransactionQueueWriterTest, destructor_commits_staged_changes) {
+    EXPECT_CALL(*db, update_transaction_messages(ElementsAre(Field(&DBTransactionMessage::unique_id, "1")), IsEmpty()));
+
+    TransactionQueueWriter writer(db, std::chrono::hours(1));
+    writer.insert(message("1"));
+}
+
+class DatabaseHandlerWriterTest : public DatabaseHandlerCommon {
+private:
+    void init_sql() override {
+    }
+
+public:
+    using DatabaseHandlerCommon::DatabaseHandlerCommon;
+
+    DatabaseConnectionInterface& get_database() {
+        return *this->database;
+    }
+};
+
+TEST_F(TransactionQueueWriterTest, transaction_queue_is_written_with_its_own_connection) {
+    const auto database_path = fs::temp_directory_path() / "transaction_queue_writer_test.db";
+    fs::remove(database_path);
+    auto handler = std::make_shared<DatabaseHandlerWriterTest>(
+        std::make_unique<DatabaseConnection>(database_path), MIGRATION_FILES_LOCATION_V201,
+        MIGRATION_FILE_VERSION_V201, std::make_unique<DatabaseConnection>(database_path));
+    handler->open_connection();
+
+    {
+        // a transaction another thread has open on the shared connection does not include the queue's batch
+        auto transaction = handler->get_database().begin_transaction();
+        TransactionQueueWriter writer(handler, std::chrono::hours(1));
+        writer.insert(message("1"));
+        writer.flush();
+        transaction->rollback();
+    }
+
+    const auto messages = handler->get_transaction_messages();
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages.at(0).unique_id, "1");
+
+    handler->close_connection();
+    fs::remove(database_path);
+}
+
+TEST_F(TransactionQueueWriterTest, removed_replacement_of_committed_message_is_deleted) {
+    const auto database_path = fs::temp_directory_path() / "transaction_queue_writer_replace_test.db";
+    fs::remove(database_path);
+    auto handler = std::make_shared<DatabaseHandlerWriterTest>(
+        std::make_unique<DatabaseConnection>(database_path), MIGRATION_FILES_LOCATION_V201,
+        MIGRATION_FILE_VERSION_V201, std::make_unique<DatabaseConnection>(database_path));
+    handler->open_connection();
+
+    {
+        TransactionQueueWriter writer(handler, std::chrono::hours(1));
+        writer.insert(message("1"));
+        writer.flush();
+        ASSERT_EQ(handler->get_transaction_messages().size(), 1);
+
+        writer.replace({"1"}, message("1"));
+        writer.remove("1");
+        writer.flush();
+    }
+
+    EXPECT_TRUE(handler->get_transaction_messages().empty());
+
+    handler->close_connection();
+    fs::remove(database_path);
+}
+
+TEST_F(TransactionQueueWriterTest, transaction_messages_are_counted_by_the_database) {
+    const auto database_path = fs::temp_directory_path() / "transaction_queue_counts_test.db";
+    fs::remove(database_path);
+    auto handler = std::make_shared<DatabaseHandlerWriterTest>(
+        std::make_unique<DatabaseConnection>(database_path), MIGRATION_FILES_LOCATION_V201,
+        MIGRATION_FILE_VERSION_V201, std::make_unique<DatabaseConnection>(database_path));
+    handler->open_connection();
+
+    const auto insert = [&handler](const std::string& unique_id, const std::optional<std::string>& transaction_id,
+                                   TransactionMessageKind kind) {
+        auto transaction_message = message(unique_id);
+        transaction_message.transaction_id = transaction_id;
+        transaction_message.kind = kind;
+        handler->insert_transaction_message(transaction_message);
+    };
+    insert("1", "tx_1", TransactionMessageKind::Other);
+    insert("2", std::nullopt, TransactionMessageKind::Other);
+    insert("3", "tx_1", TransactionMessageKind::Update);
+    insert("4", "tx_2", TransactionMessageKind::Update);
+    insert("5", "tx_1", TransactionMessageKind::End);
+
+    auto counts = handler->get_transaction_message_counts(handler->get_last_transaction_message_sequence());
+    std::sort(counts.begin(), counts.end(),
+              [](const auto& a, const auto& b) { return a.transaction_id < b.transaction_id; });
+    ASSERT_EQ(counts.size(), 2);
+    EXPECT_EQ(counts.at(0).transaction_id, "tx_1");
+    EXPECT_EQ(counts.at(0).messages, 3);
+    EXPECT_EQ(counts.at(0).update_messages, 1);
+    EXPECT_EQ(counts.at(0).end_messages, 1);
+    EXPECT_EQ(counts.at(1).transaction_id, "tx_2");
+    EXPECT_EQ(counts.at(1).messages, 1);
+    EXPECT_EQ(counts.at(1).update_messages, 1);
+    EXPECT_EQ(counts.at(1).end_messages, 0);
+
+    // only the messages up to the given sequence are counted
+    const auto first_messages = handler->get_transaction_messages(0, std::numeric_limits<int64_t>::max(), 3);
+    counts = handler->get_transaction_message_counts(first_messages.back().sequence);
+    ASSERT_EQ(counts.size(), 1);
+    EXPECT_EQ(counts.at(0).messages, 2);
+
+    handler->close_connection();
+    fs::remove(database_path);
+}
+
+} // namespace ocpp::common
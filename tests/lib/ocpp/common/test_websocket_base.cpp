@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <ocpp/common/websocket/websocket_base.hpp>
+
+namespace ocpp {
+
+TEST(WebsocketFrameBufferTest, payload_follows_headroom) {
+    WebsocketFrameBuffer frame(std::string_view("[2,\"id\",\"Heartbeat\",{}]"));
+
+    EXPECT_EQ(frame.payload(), "[2,\"id\",\"Heartbeat\",{}]");
+    EXPECT_EQ(frame.payload_size(), frame.payload().size());
+    EXPECT_EQ(frame.payload_data(), frame.payload().data());
+}
+
+TEST(WebsocketFrameBufferTest, headroom_can_be_written_without_touching_payload) {
+    WebsocketFrameBuffer frame(std::string_view("payload"));
+
+    // libwebsockets writes the frame header directly in front of the payload
+    std::memset(frame.payload_data() - WEBSOCKET_FRAME_HEADROOM, 0xff, WEBSOCKET_FRAME_HEADROOM);
+
+    EXPECT_EQ(frame.payload(), "payload");
+    EXPECT_EQ(frame.payload_size(), 7);
+}
+
+TEST(WebsocketFrameBufferTest, empty_payload) {
+    WebsocketFrameBuffer frame(std::string_view{});
+
+    EXPECT_TRUE(frame.payload().empty());
+    EXPECT_EQ(frame.payload_size(), 0);
+}
+
+TEST(WebsocketFrameBufferTest, from_json_matches_dump) {
+    const json message = json::array({2, "id", "BootNotification", {{"reason", "PowerUp"}, {"count", 3}}});
+
+    auto frame = WebsocketFrameBuffer::from_json(message);
+
+    EXPECT_EQ(frame.payload(), message.dump());
+    EXPECT_EQ(frame.payload_size(), message.dump().size());
+}
+
+TEST(WebsocketFrameBufferTest, from_writer_writes_behind_headroom) {
+    auto frame = WebsocketFrameBuffer::from_writer([](JsonWriter& writer) {
+        writer.begin_object();
+        writer.member("status", "Accepted");
+        writer.end_object();
+    });
+
+    EXPECT_EQ(frame.payload(), R"({"status":"Accepted"})");
+    EXPECT_EQ(frame.payload_data(), frame.payload().data());
+}
+
+TEST(WebsocketReceiveBufferTest, message_in_single_frame) {
+    WebsocketReceiveBuffer buffer;
+    const std::string message = "[2,\"id\",\"Reset\",{\"type\":\"Immediate\"}]";
+
+    EXPECT_EQ(buffer.append(message.data(), 10, message.size() - 10, true, 0), WebsocketReceiveResult::Incomplete);
+    // The rest of the frame has been reserved with the first chunk
+    EXPECT_GE(buffer.capacity(), message.size());
+    EXPECT_EQ(buffer.append(message.data() + 10, message.size() - 10, 0, true, 0), WebsocketReceiveResult::Complete);
+
+    EXPECT_EQ(buffer.take_message(), message);
+    EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST(WebsocketReceiveBufferTest, message_completes_with_final_fragment) {
+    WebsocketReceiveBuffer buffer;
+
+    // The end of a frame that is not the final fragment does not complete the message
+    EXPECT_EQ(buffer.append("abc", 3, 0, false, 0), WebsocketReceiveResult::Incomplete);
+    EXPECT_EQ(buffer.append("def", 3, 0, false, 0), WebsocketReceiveResult::Incomplete);
+    EXPECT_EQ(buffer.append("ghi", 3, 0, true, 0), WebsocketReceiveResult::Complete);
+
+    EXPECT_EQ(buffer.take_message(), "abcdefghi");
+
+    EXPECT_EQ(buffer.append("next", 4, 0, true, 0), WebsocketReceiveResult::Complete);
+    EXPECT_EQ(buffer.take_message(), "next");
+}
+
+TEST(WebsocketReceiveBufferTest, reservation_grows_geometrically_up_to_maximum) {
+    WebsocketReceiveBuffer buffer;
+    const std::string chunk(100, 'x');
+
+    EXPECT_EQ(buffer.append(chunk.data(), chunk.size(), 0, false, 250), WebsocketReceiveResult::Incomplete);
+    EXPECT_GE(buffer.capacity(), 100);
+    EXPECT_EQ(buffer.append(chunk.data(), chunk.size(), 0, false, 250), WebsocketReceiveResult::Incomplete);
+    EXPECT_GE(buffer.capacity(), 200);
+    // Doubling would exceed the maximum, so only the maximum is reserved
+    EXPECT_EQ(buffer.append(chunk.data(), 50, 0, true, 250), WebsocketReceiveResult::Complete);
+    EXPECT_EQ(buffer.take_message().size(), 250);
+}
+
+TEST(WebsocketReceiveBufferTest, oversized_frame_rejected_before_it_is_read) {
+    WebsocketReceiveBuffer buffer;
+
+    // The frame header announces more than the maximum, nothing of it is buffered
+    EXPECT_EQ(buffer.append("abc", 3, 1000, true, 100), WebsocketReceiveResult::TooLarge);
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(buffer.capacity(), std::string().capacity());
+}
+
+TEST(WebsocketReceiveBufferTest, oversized_fragmented_message_discarded) {
+    WebsocketReceiveBuffer buffer;
+    const std::string chunk(60, 'x');
+
+    EXPECT_EQ(buffer.append(chunk.data(), chunk.size(), 0, false, 100), WebsocketReceiveResult::Incomplete);
+    EXPECT_EQ(buffer.append(chunk.data(), chunk.size(), 0, true, 100), WebsocketReceiveResult::TooLarge);
+    EXPECT_EQ(buffer.size(), 0);
+
+    // A message of exactly the maximum size is accepted
+    const std::string message(100, 'y');
+    EXPECT_EQ(buffer.append(message.data(), message.size(), 0, true, 100), WebsocketReceiveResult::Complete);
+    EXPECT_EQ(buffer.take_message(), message);
+}
+
+TEST(WebsocketReceiveBufferTest, clear_discards_partial_message) {
+    WebsocketReceiveBuffer buffer;
+
+    EXPECT_EQ(buffer.append("abc", 3, 10, false, 0), WebsocketReceiveResult::Incomplete);
+    buffer.clear();
+    EXPECT_EQ(buffer.size(), 0);
+
+    EXPECT_EQ(buffer.append("def", 3, 0, true, 0), WebsocketReceiveResult::Complete);
+    EXPECT_EQ(buffer.take_message(), "def");
+}
+
+/// \brief Websocket without a connection that records sent messages and counts traffic like the websocketpp
+/// implementations do
+class WebsocketFake : public WebsocketBase {
+public:
+    std::vector<std::string> sent_messages;
+    bool accept_send = true;
+
+    bool connect() override {
+        return true;
+    }
+
+    void set_connection_options(const WebsocketConnectionOptions& connection_options) override {
+        this->set_connection_options_base(connection_options);
+    }
+
+    void reconnect(long delay) override {
+    }
+
+    void close(const WebsocketCloseReason code, const std::string& reason) override {
+    }
+
+    bool send(const std::string& message) override {
+        if (!this->accept_send) {
+            return false;
+        }
+        this->sent_messages.push_back(message);
+        this->raw_bytes_sent += message.size();
+        this->wire_bytes_sent += message.size();
+        return true;
+    }
+
+    /// \brief Counts a received message of \p raw_size bytes that took \p wire_size bytes on the connection
+    void receive(size_t raw_size, size_t wire_size) {
+        this->raw_bytes_received += raw_size;
+        this->wire_bytes_received += wire_size;
+    }
+
+    void new_connection() {
+        this->reset_traffic_statistics();
+    }
+
+protected:
+    void ping() override {
+    }
+};
+
+/// \brief Websocket whose outbound queue is always full
+class WebsocketFullQueueFake : public WebsocketFake {
+public:
+    WebsocketSendResult send_async(WebsocketFrameBuffer&& frame,
+                                   const std::function<void(bool sent)>& on_sent) override {
+        return WebsocketSendResult::WouldBlock;
+    }
+    using WebsocketBase::send_async;
+};
+
+TEST(WebsocketBaseTest, send_async_reports_accepted_message_as_sent) {
+    WebsocketFake websocket;
+    std::vector<bool> results;
+
+    EXPECT_EQ(websocket.send_async("[3,\"id\",{}]", [&results](bool sent) { results.push_back(sent); }),
+              WebsocketSendResult::Accepted);
+
+    ASSERT_EQ(websocket.sent_messages.size(), 1);
+    EXPECT_EQ(websocket.sent_messages.at(0), "[3,\"id\",{}]");
+    EXPECT_EQ(results, std::vector<bool>{true});
+}
+
+TEST(WebsocketBaseTest, send_async_without_callback) {
+    WebsocketFake websocket;
+
+    EXPECT_EQ(websocket.send_async(WebsocketFrameBuffer(std::string_view("message")), nullptr),
+              WebsocketSendResult::Accepted);
+    EXPECT_EQ(websocket.sent_messages, std::vector<std::string>{"message"});
+}
+
+TEST(WebsocketBaseTest, send_async_reports_failed_send_only_through_result) {
+    WebsocketFake websocket;
+    websocket.accept_send = false;
+    std::vector<bool> results;
+
+    EXPECT_EQ(websocket.send_async("message", [&results](bool sent) { results.push_back(sent); }),
+              WebsocketSendResult::Failed);
+
+    // The callback is only called for accepted messages
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(websocket.sent_messages.empty());
+}
+
+TEST(WebsocketBaseTest, send_async_of_string_forwards_would_block) {
+    WebsocketFullQueueFake websocket;
+    std::vector<bool> results;
+
+    EXPECT_EQ(websocket.send_async("message", [&results](bool sent) { results.push_back(sent); }),
+              WebsocketSendResult::WouldBlock);
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(websocket.sent_messages.empty());
+}
+
+/// \brief Creates a producer that writes \p payload in parts of at most \p part_size bytes and records the capacity
+/// it was called with
+static WebsocketPayloadProducer make_producer(const std::string& payload, size_t part_size,
+                                              std::vector<size_t>& capacities) {
+    auto offset = std::make_shared<size_t>(0);
+    return [payload, part_size, offset, &capacities](char* buffer, size_t capacity, bool& is_last) {
+        capacities.push_back(capacity);
+        const auto len = std::min({part_size, capacity, payload.size() - *offset});
+        std::memcpy(buffer, payload.data() + *offset, len);
+        *offset += len;
+        is_last = *offset == payload.size();
+        return len;
+    };
+}
+
+TEST(WebsocketBaseTest, send_stream_async_collects_payload_in_chunks) {
+    WebsocketFake websocket;
+    const std::string payload = std::string(4096, 'a') + std::string(4096, 'b') + std::string(1808, 'c');
+    std::vector<size_t> capacities;
+    std::vector<bool> results;
+
+    EXPECT_EQ(websocket.send_stream_async(make_producer(payload, payload.size(), capacities),
+                                          [&results](bool sent) { results.push_back(sent); }),
+              WebsocketSendResult::Accepted);
+
+    EXPECT_EQ(capacities, (std::vector<size_t>{4096, 4096, 4096}));
+    EXPECT_EQ(websocket.sent_messages, std::vector<std::string>{payload});
+    EXPECT_EQ(results, std::vector<bool>{true});
+}
+
+TEST(WebsocketBaseTest, send_stream_async_accepts_short_parts) {
+    WebsocketFake websocket;
+    const std::string payload = "[2,\"id\",\"NotifyReport\",{\"requestId\":1}]";
+    std::vector<size_t> capacities;
+
+    EXPECT_EQ(websocket.send_stream_async(make_producer(payload, 5, capacities), nullptr),
+              WebsocketSendResult::Accepted);
+
+    // A short part does not end the payload, the producer is called until it sets is_last
+    EXPECT_EQ(capacities.size(), (payload.size() + 4) / 5);
+    EXPECT_EQ(websocket.sent_messages, std::vector<std::string>{payload});
+}
+
+TEST(WebsocketBaseTest, send_stream_async_accepts_empty_last_part) {
+    WebsocketFake websocket;
+    int calls = 0;
+    auto producer = [&calls](char* buffer, size_t capacity, bool& is_last) -> size_t {
+        if (calls++ == 0) {
+            std::memcpy(buffer, "abc", 3);
+            return 3;
+        }
+        is_last = true;
+        return 0;
+    };
+
+    EXPECT_EQ(websocket.send_stream_async(producer, nullptr), WebsocketSendResult::Accepted);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(websocket.sent_messages, std::vector<std::string>{"abc"});
+}
+
+TEST(WebsocketBaseTest, send_stream_async_limits_part_to_capacity) {
+    WebsocketFake websocket;
+    auto producer = [](char* buffer, size_t capacity, bool& is_last) -> size_t {
+        std::memset(buffer, 'x', capacity);
+        is_last = true;
+        // Claims more than fits into the buffer
+        return capacity + 100;
+    };
+
+    EXPECT_EQ(websocket.send_stream_async(producer, nullptr), WebsocketSendResult::Accepted);
+    EXPECT_EQ(websocket.sent_messages, std::vector<std::string>{std::string(4096, 'x')});
+}
+
+TEST(WebsocketBaseTest, send_stream_async_fails_if_producer_stalls) {
+    WebsocketFake websocket;
+    std::vector<bool> results;
+    auto producer = [](char* buffer, size_t capacity, bool& is_last) -> size_t { return 0; };
+
+    EXPECT_EQ(websocket.send_stream_async(producer, [&results](bool sent) { results.push_back(sent); }),
+              WebsocketSendResult::Failed);
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(websocket.sent_messages.empty());
+}
+
+TEST(WebsocketBaseTest, send_stream_async_fails_if_producer_throws) {
+    WebsocketFake websocket;
+    auto producer = [](char* buffer, size_t capacity, bool& is_last) -> size_t {
+        throw std::runtime_error("Could not read the report");
+    };
+
+    EXPECT_EQ(websocket.send_stream_async(producer, nullptr), WebsocketSendResult::Failed);
+    EXPECT_TRUE(websocket.sent_messages.empty());
+}
+
+TEST(WebsocketBaseTest, send_stream_async_forwards_would_block) {
+    WebsocketFullQueueFake websocket;
+    std::vector<size_t> capacities;
+
+    EXPECT_EQ(websocket.send_stream_async(make_producer("message", 7, capacities), nullptr),
+              WebsocketSendResult::WouldBlock);
+}
+
+TEST(WebsocketBaseTest, traffic_statistics_count_sent_and_received_bytes) {
+    WebsocketFake websocket;
+
+    const auto empty = websocket.get_traffic_statistics();
+    EXPECT_EQ(empty.raw_bytes_sent, 0);
+    EXPECT_EQ(empty.wire_bytes_sent, 0);
+    EXPECT_EQ(empty.raw_bytes_received, 0);
+    EXPECT_EQ(empty.wire_bytes_received, 0);
+
+    ASSERT_EQ(websocket.send_async(std::string(100, 'a'), nullptr), WebsocketSendResult::Accepted);
+    ASSERT_EQ(websocket.send_async(std::string(20, 'b'), nullptr), WebsocketSendResult::Accepted);
+    websocket.receive(1000, 150);
+
+    const auto statistics = websocket.get_traffic_statistics();
+    EXPECT_EQ(statistics.raw_bytes_sent, 120);
+    EXPECT_EQ(statistics.wire_bytes_sent, 120);
+    EXPECT_EQ(statistics.raw_bytes_received, 1000);
+    EXPECT_EQ(statistics.wire_bytes_received, 150);
+}
+
+TEST(WebsocketBaseTest, traffic_statistics_reset_on_new_connection) {
+    WebsocketFake websocket;
+    websocket.send_async(std::string(100, 'a'), nullptr);
+    websocket.receive(50, 50);
+
+    websocket.new_connection();
+    websocket.receive(10, 4);
+
+    const auto statistics = websocket.get_traffic_statistics();
+    EXPECT_EQ(statistics.raw_bytes_sent, 0);
+    EXPECT_EQ(statistics.wire_bytes_sent, 0);
+    EXPECT_EQ(statistics.raw_bytes_received, 10);
+    EXPECT_EQ(statistics.wire_bytes_received, 4);
+}
+
+TEST(WebsocketBaseTest, traffic_statistics_ignore_failed_sends) {
+    WebsocketFake websocket;
+    websocket.accept_send = false;
+
+    EXPECT_EQ(websocket.send_async(std::string(100, 'a'), nullptr), WebsocketSendResult::Failed);
+
+    const auto statistics = websocket.get_traffic_statistics();
+    EXPECT_EQ(statistics.raw_bytes_sent, 0);
+    EXPECT_EQ(statistics.wire_bytes_sent, 0);
+}
+
+} // namespace ocpp
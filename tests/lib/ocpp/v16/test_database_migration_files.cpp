@@ -78,4 +78,61 @@ TEST_P(DatabaseMigrationFilesTestV16, V16_MigrationFile2) {
     EXPECT_EQ(stmt->step(), SQLITE_ROW);
     EXPECT_EQ(stmt->column_int(0), 55);
     EXPECT_EQ(stmt->step(), SQLITE_DONE);
-}
\ No newline at end of file
+}
+
+TEST_P(DatabaseMigrationFilesTestV16, V16_MigrationFile3) {
+    DatabaseSchemaUpdater updater{this->database.get()};
+
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 2));
+    this->ExpectUserVersion(2);
+
+    EXPECT_FALSE(this->DoesColumnExist("TRANSACTION_QUEUE", "MESSAGE_ENCODING"));
+    EXPECT_FALSE(this->DoesColumnExist("CHARGING_PROFILES", "PROFILE_ENCODING"));
+
+    // A json text message and profile as they were written before version 3
+    EXPECT_TRUE(this->database->execute_statement(
+        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP) VALUES "
+        "(\"text\", \"[]\", \"MeterValues\", 0, \"\")"));
+    EXPECT_TRUE(this->database->execute_statement(
+        "INSERT INTO CHARGING_PROFILES (ID, CONNECTOR_ID, PROFILE) VALUES (1, 1, \"{}\")"));
+
+    // After applying the migration we expect to be at version 3
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 3));
+    this->ExpectUserVersion(3);
+
+    // The existing rows are marked as json text
+    auto stmt =
+        this->database->new_statement("SELECT MESSAGE_ENCODING FROM TRANSACTION_QUEUE WHERE UNIQUE_ID=\"text\"");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_int(0), 0);
+    stmt = this->database->new_statement("SELECT PROFILE_ENCODING FROM CHARGING_PROFILES WHERE ID=1");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_int(0), 0);
+
+    // A binary encoded message
+    EXPECT_TRUE(this->database->execute_statement(
+        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_ENCODING, MESSAGE_TYPE, MESSAGE_ATTEMPTS, "
+        "MESSAGE_TIMESTAMP) VALUES (\"binary\", x'80', 1, \"MeterValues\", 0, \"\")"));
+
+    // The down migration is refused while there are binary encoded messages, which could not be read anymore
+    EXPECT_FALSE(updater.apply_migration_files(this->migration_files_path, 2));
+    this->ExpectUserVersion(3);
+    stmt = this->database->new_statement("SELECT COUNT(*) FROM TRANSACTION_QUEUE");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_int(0), 2);
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+
+    // After the binary encoded message has been sent, the down migration brings us to version 2
+    EXPECT_TRUE(this->database->execute_statement("DELETE FROM TRANSACTION_QUEUE WHERE UNIQUE_ID=\"binary\""));
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 2));
+    this->ExpectUserVersion(2);
+
+    EXPECT_FALSE(this->DoesColumnExist("TRANSACTION_QUEUE", "MESSAGE_ENCODING"));
+    EXPECT_FALSE(this->DoesColumnExist("CHARGING_PROFILES", "PROFILE_ENCODING"));
+
+    // The json text message is kept
+    stmt = this->database->new_statement("SELECT UNIQUE_ID FROM TRANSACTION_QUEUE");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_text(0), "text");
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+}
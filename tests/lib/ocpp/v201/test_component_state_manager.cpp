@@ -79,19 +79,21 @@ protected:
         ComponentStateManager mgr(evse_connector_structure, database,
                                   [this](int32_t evse_id, int32_t connector_id, ConnectorStatusEnum status) {
                                       return this->callbacks.connector_status_update(
-                                          evse_id, connector_id, conversions::connector_status_enum_to_string(status));
+                                          evse_id, connector_id,
+                                          std::string(conversions::connector_status_enum_to_string(status)));
                                       return true;
                                   });
         mgr.set_cs_effective_availability_changed_callback([this](OperationalStatusEnum status) {
-            this->callbacks.cs_op_state_update(conversions::operational_status_enum_to_string(status));
+            this->callbacks.cs_op_state_update(std::string(conversions::operational_status_enum_to_string(status)));
         });
         mgr.set_evse_effective_availability_changed_callback([this](int32_t evse_id, OperationalStatusEnum status) {
-            this->callbacks.evse_op_state_update(evse_id, conversions::operational_status_enum_to_string(status));
+            this->callbacks.evse_op_state_update(evse_id,
+                                                 std::string(conversions::operational_status_enum_to_string(status)));
         });
         mgr.set_connector_effective_availability_changed_callback(
             [this](int32_t evse_id, int32_t connector_id, OperationalStatusEnum status) {
-                this->callbacks.connector_op_state_update(evse_id, connector_id,
-                                                          conversions::operational_status_enum_to_string(status));
+                this->callbacks.connector_op_state_update(
+                    evse_id, connector_id, std::string(conversions::operational_status_enum_to_string(status)));
             });
 
         return mgr;
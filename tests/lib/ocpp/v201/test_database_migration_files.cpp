@@ -7,3 +7,60 @@
 INSTANTIATE_TEST_SUITE_P(V201, DatabaseMigrationFilesTest,
                          ::testing::Values(std::make_tuple(std::filesystem::path(MIGRATION_FILES_LOCATION_V201),
                                                            MIGRATION_FILE_VERSION_V201)));
+
+// Apply v201 specific test cases to migrations
+using DatabaseMigrationFilesTestV201 = DatabaseMigrationFilesTest;
+
+INSTANTIATE_TEST_SUITE_P(V201, DatabaseMigrationFilesTestV201,
+                         ::testing::Values(std::make_tuple(std::filesystem::path(MIGRATION_FILES_LOCATION_V201),
+                                                           MIGRATION_FILE_VERSION_V201)));
+
+TEST_P(DatabaseMigrationFilesTestV201, V201_MigrationFile2) {
+    DatabaseSchemaUpdater updater{this->database.get()};
+
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 1));
+    this->ExpectUserVersion(1);
+
+    EXPECT_FALSE(this->DoesColumnExist("TRANSACTION_QUEUE", "MESSAGE_ENCODING"));
+
+    // A json text message as it was written before version 2
+    EXPECT_TRUE(this->database->execute_statement(
+        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP) VALUES "
+        "(\"text\", \"[]\", \"TransactionEvent\", 0, \"\")"));
+
+    // After applying the migration we expect to be at version 2
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 2));
+    this->ExpectUserVersion(2);
+
+    // The existing row is marked as json text
+    auto stmt =
+        this->database->new_statement("SELECT MESSAGE_ENCODING FROM TRANSACTION_QUEUE WHERE UNIQUE_ID=\"text\"");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_int(0), 0);
+
+    // A binary encoded message
+    EXPECT_TRUE(this->database->execute_statement(
+        "INSERT INTO TRANSACTION_QUEUE (UNIQUE_ID, MESSAGE, MESSAGE_ENCODING, MESSAGE_TYPE, MESSAGE_ATTEMPTS, "
+        "MESSAGE_TIMESTAMP) VALUES (\"binary\", x'80', 1, \"TransactionEvent\", 0, \"\")"));
+
+    // The down migration is refused while there are binary encoded messages, which could not be read anymore
+    EXPECT_FALSE(updater.apply_migration_files(this->migration_files_path, 1));
+    this->ExpectUserVersion(2);
+    stmt = this->database->new_statement("SELECT COUNT(*) FROM TRANSACTION_QUEUE");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_int(0), 2);
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+
+    // After the binary encoded message has been sent, the down migration brings us to version 1
+    EXPECT_TRUE(this->database->execute_statement("DELETE FROM TRANSACTION_QUEUE WHERE UNIQUE_ID=\"binary\""));
+    EXPECT_TRUE(updater.apply_migration_files(this->migration_files_path, 1));
+    this->ExpectUserVersion(1);
+
+    EXPECT_FALSE(this->DoesColumnExist("TRANSACTION_QUEUE", "MESSAGE_ENCODING"));
+
+    // The json text message is kept
+    stmt = this->database->new_statement("SELECT UNIQUE_ID FROM TRANSACTION_QUEUE");
+    EXPECT_EQ(stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(stmt->column_text(0), "text");
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include "device_model_storage_mock.hpp"
 #include <gtest/gtest.h>
 #include <ocpp/v201/ctrlr_component_variables.hpp>
 #include <ocpp/v201/device_model.hpp>
@@ -45,6 +46,58 @@ TEST_F(DeviceModelTest, test_allow_zero) {
     ASSERT_EQ(r, 0);
 }
 
+/// \brief Test that values of the ControllerComponentVariableHandles are cached in their slot and that the slot is
+/// invalidated if the value is set with or without the handle
+TEST_F(DeviceModelTest, test_handle_values) {
+    const auto handle = ControllerComponentVariableHandles::AlignedDataInterval;
+    ASSERT_EQ(&ControllerComponentVariableHandles::get_component_variable(handle.index),
+              &ControllerComponentVariables::AlignedDataInterval);
+
+    ASSERT_EQ(dm->get_value(handle), 10);
+    ASSERT_EQ(dm->set_value(handle, "20"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(dm->get_value(handle), 20);
+    ASSERT_EQ(dm->get_value<int>(cv), 20);
+
+    ASSERT_EQ(dm->set_value(cv.component, cv.variable.value(), AttributeEnum::Actual, "30"),
+              SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(dm->get_optional_value(handle), 30);
+
+    ASSERT_EQ(dm->set_value(handle, "2"), SetVariableStatusEnum::Rejected);
+    ASSERT_EQ(dm->get_value(handle), 30);
+}
+
+/// \brief Test that set_values validates every entry on its own and returns the results in the order of the request
+TEST_F(DeviceModelTest, test_set_values) {
+    SetVariableData valid;
+    valid.component = cv.component;
+    valid.variable = cv.variable.value();
+    valid.attributeValue = "20";
+
+    SetVariableData invalid_value = valid;
+    invalid_value.attributeValue = "2";
+
+    SetVariableData unknown_component = valid;
+    unknown_component.component.name = "UnknownComponent";
+
+    SetVariableData unknown_variable = valid;
+    unknown_variable.variable.name = "UnknownVariable";
+
+    SetVariableData unsupported_attribute = valid;
+    unsupported_attribute.attributeType = AttributeEnum::MaxSet;
+
+    const auto results =
+        dm->set_values({invalid_value, unknown_component, valid, unknown_variable, unsupported_attribute});
+    ASSERT_EQ(results.size(), 5);
+    EXPECT_EQ(results.at(0), SetVariableStatusEnum::Rejected);
+    EXPECT_EQ(results.at(1), SetVariableStatusEnum::UnknownComponent);
+    EXPECT_EQ(results.at(2), SetVariableStatusEnum::Accepted);
+    EXPECT_EQ(results.at(3), SetVariableStatusEnum::UnknownVariable);
+    EXPECT_EQ(results.at(4), SetVariableStatusEnum::NotSupportedAttributeType);
+
+    ASSERT_EQ(dm->get_value<int>(cv), 20);
+    ASSERT_TRUE(dm->set_values({}).empty());
+}
+
 TEST_F(DeviceModelTest, test_component_as_key_in_map) {
     std::map<Component, int32_t> components_to_ints;
 
@@ -80,5 +133,154 @@ TEST_F(DeviceModelTest, test_component_as_key_in_map) {
     EXPECT_EQ(components_to_ints.find(different_name_comp), components_to_ints.end());
 }
 
+/// \brief Test that volatile values are served from memory and only written to the storage on flush
+TEST(DeviceModelVolatileValuesTest, test_volatile_values_written_on_flush) {
+    const auto evse_power_cv = EvseComponentVariables::get_component_variable(1, EvseComponentVariables::Power);
+    const auto& component = evse_power_cv.component;
+    const auto& variable = evse_power_cv.variable.value();
+
+    VariableCharacteristics characteristics;
+    characteristics.dataType = DataEnum::decimal;
+    characteristics.supportsMonitoring = true;
+    DeviceModelMap device_model_map;
+    device_model_map[component][variable] = VariableMetaData{characteristics, {}};
+
+    VariableAttribute attribute;
+    attribute.type = AttributeEnum::Actual;
+    attribute.value = "0";
+    attribute.mutability = MutabilityEnum::ReadOnly;
+
+    auto storage_mock = std::make_unique<testing::NiceMock<DeviceModelStorageMock>>();
+    auto& storage = *storage_mock;
+    ON_CALL(storage, get_device_model).WillByDefault(testing::Return(device_model_map));
+    ON_CALL(storage, get_variable_attribute).WillByDefault(testing::Return(attribute));
+    ON_CALL(storage, get_variable_attributes).WillByDefault(testing::Return(std::vector<VariableAttribute>{attribute}));
+
+    DeviceModel dm(std::move(storage_mock));
+    dm.set_volatile_values_enabled(true);
+
+    // the storage is only queried for the first update of a volatile value
+    EXPECT_CALL(storage, get_variable_attribute).Times(1);
+    EXPECT_CALL(storage, set_variable_attribute_value).Times(0);
+    ASSERT_EQ(dm.set_read_only_value(component, variable, AttributeEnum::Actual, "1000.0"),
+              SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(dm.set_read_only_value(component, variable, AttributeEnum::Actual, "2000.0"),
+              SetVariableStatusEnum::Accepted);
+
+    const auto response = dm.request_value<std::string>(component, variable, AttributeEnum::Actual);
+    ASSERT_EQ(response.status, GetVariableStatusEnum::Accepted);
+    ASSERT_EQ(response.value.value(), "2000.0");
+
+    const auto report_data = dm.get_custom_report_data();
+    ASSERT_EQ(report_data.size(), 1);
+    ASSERT_EQ(report_data.at(0).variableAttribute.at(0).value.value().get(), "2000.0");
+
+    testing::Mock::VerifyAndClearExpectations(&storage);
+
+    // only the latest value is written and only once
+    EXPECT_CALL(storage, set_variable_attribute_value(component, variable, AttributeEnum::Actual, "2000.0"))
+        .WillOnce(testing::Return(true));
+    dm.flush_volatile_values();
+    dm.flush_volatile_values();
+
+    testing::Mock::VerifyAndClearExpectations(&storage);
+
+    // disabling writes the pending value, later values are written to the storage directly
+    ASSERT_EQ(dm.set_read_only_value(component, variable, AttributeEnum::Actual, "3000.0"),
+              SetVariableStatusEnum::Accepted);
+    EXPECT_CALL(storage, set_variable_attribute_value(component, variable, AttributeEnum::Actual, "3000.0"))
+        .WillOnce(testing::Return(true));
+    dm.set_volatile_values_enabled(false);
+    EXPECT_CALL(storage, set_variable_attribute_value(component, variable, AttributeEnum::Actual, "4000.0"))
+        .WillOnce(testing::Return(true));
+    ASSERT_EQ(dm.set_read_only_value(component, variable, AttributeEnum::Actual, "4000.0"),
+              SetVariableStatusEnum::Accepted);
+}
+
+/// \brief Test that get_value is served from the value cache until the value is changed using set_value
+TEST(DeviceModelValueCacheTest, test_value_cache_invalidated_by_set_value) {
+    const auto& cv = ControllerComponentVariables::AlignedDataInterval;
+    const auto& component = cv.component;
+    const auto& variable = cv.variable.value();
+
+    VariableCharacteristics characteristics;
+    characteristics.dataType = DataEnum::integer;
+    characteristics.supportsMonitoring = true;
+    DeviceModelMap device_model_map;
+    device_model_map[component][variable] = VariableMetaData{characteristics, {}};
+
+    VariableAttribute attribute;
+    attribute.type = AttributeEnum::Actual;
+    attribute.value = "10";
+    attribute.mutability = MutabilityEnum::ReadWrite;
+    VariableAttribute changed_attribute = attribute;
+    changed_attribute.value = "20";
+
+    auto storage_mock = std::make_unique<testing::NiceMock<DeviceModelStorageMock>>();
+    auto& storage = *storage_mock;
+    ON_CALL(storage, get_device_model).WillByDefault(testing::Return(device_model_map));
+
+    DeviceModel dm(std::move(storage_mock));
+
+    EXPECT_CALL(storage, get_variable_attribute).WillOnce(testing::Return(attribute));
+    ASSERT_EQ(dm.get_value<int>(cv), 10);
+    ASSERT_EQ(dm.get_value<int>(cv), 10);
+    ASSERT_EQ(dm.get_optional_value<std::string>(cv), "10");
+    testing::Mock::VerifyAndClearExpectations(&storage);
+
+    // set_value looks up the attribute and the value is requested from the storage again afterwards
+    EXPECT_CALL(storage, get_variable_attribute)
+        .WillOnce(testing::Return(attribute))
+        .WillOnce(testing::Return(changed_attribute));
+    EXPECT_CALL(storage, set_variable_attribute_value(component, variable, AttributeEnum::Actual, "20"))
+        .WillOnce(testing::Return(true));
+    ASSERT_EQ(dm.set_value(component, variable, AttributeEnum::Actual, "20"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(dm.get_value<int>(cv), 20);
+    ASSERT_EQ(dm.get_value<int>(cv), 20);
+    testing::Mock::VerifyAndClearExpectations(&storage);
+
+    // without the cache every request goes to the storage
+    dm.set_value_cache_enabled(false);
+    EXPECT_CALL(storage, get_variable_attribute).Times(2).WillRepeatedly(testing::Return(changed_attribute));
+    ASSERT_EQ(dm.get_value<int>(cv), 20);
+    ASSERT_EQ(dm.get_optional_value<int>(cv), 20);
+}
+
+/// \brief Test that a custom report filtered on component variables only reads the requested variables from the storage
+TEST(DeviceModelReportTest, test_custom_report_reads_requested_variables) {
+    const auto& requested_cv = ControllerComponentVariables::AlignedDataInterval;
+    const auto& other_cv = ControllerComponentVariables::SampledDataTxUpdatedInterval;
+
+    VariableCharacteristics characteristics;
+    characteristics.dataType = DataEnum::integer;
+    characteristics.supportsMonitoring = true;
+    DeviceModelMap device_model_map;
+    device_model_map[requested_cv.component][requested_cv.variable.value()] = VariableMetaData{characteristics, {}};
+    device_model_map[other_cv.component][other_cv.variable.value()] = VariableMetaData{characteristics, {}};
+
+    VariableAttribute attribute;
+    attribute.type = AttributeEnum::Actual;
+    attribute.value = "10";
+    attribute.mutability = MutabilityEnum::ReadWrite;
+
+    auto storage_mock = std::make_unique<testing::NiceMock<DeviceModelStorageMock>>();
+    auto& storage = *storage_mock;
+    ON_CALL(storage, get_device_model).WillByDefault(testing::Return(device_model_map));
+
+    DeviceModel dm(std::move(storage_mock));
+
+    EXPECT_CALL(storage, get_variable_attributes(requested_cv.component, requested_cv.variable.value(), testing::_))
+        .WillOnce(testing::Return(std::vector<VariableAttribute>{attribute}));
+    EXPECT_CALL(storage, get_variable_attributes(other_cv.component, other_cv.variable.value(), testing::_)).Times(0);
+
+    ComponentVariable component_variable;
+    component_variable.component = requested_cv.component;
+    component_variable.variable = requested_cv.variable;
+    const auto report_data = dm.get_custom_report_data(std::vector<ComponentVariable>{component_variable});
+    ASSERT_EQ(report_data.size(), 1);
+    EXPECT_EQ(report_data.at(0).variable, requested_cv.variable.value());
+    EXPECT_EQ(report_data.at(0).variableAttribute.at(0).value.value().get(), "10");
+}
+
 } // namespace v201
 } // namespace ocpp
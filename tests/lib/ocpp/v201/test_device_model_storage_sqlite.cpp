@@ -1,8 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <atomic>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <ocpp/v201/ctrlr_component_variables.hpp>
 #include <ocpp/v201/device_model_storage_sqlite.hpp>
 
 namespace ocpp {
@@ -28,5 +32,155 @@ TEST_F(DeviceModelStorageSQLiteTest, test_check_integrity_invalid) {
     EXPECT_THROW(dm_storage.check_integrity(), DeviceModelStorageError);
 }
 
+/// \brief Tests for_each_variable_attribute provides the same attributes as get_variable_attributes for every variable
+/// and provides the attributes of a variable consecutively
+TEST_F(DeviceModelStorageSQLiteTest, test_for_each_variable_attribute) {
+
+    auto dm_storage = DeviceModelStorageSqlite(DEVICE_MODEL_DATABASE);
+
+    std::map<Component, std::map<Variable, std::vector<VariableAttribute>>> all_attributes;
+    size_t count = 0;
+    std::optional<std::pair<Component, Variable>> previous;
+    dm_storage.for_each_variable_attribute(
+        [&](const Component& component, const Variable& variable, const VariableAttribute& attribute) {
+            const auto is_next_variable =
+                !previous.has_value() or !(previous->first == component) or !(previous->second == variable);
+            if (is_next_variable) {
+                EXPECT_EQ(all_attributes[component].count(variable), 0);
+                previous.emplace(component, variable);
+            }
+            all_attributes[component][variable].push_back(attribute);
+            count++;
+        });
+    ASSERT_GT(count, 0);
+
+    size_t expected_count = 0;
+    for (const auto& [component, variable_map] : dm_storage.get_device_model()) {
+        for (const auto& [variable, meta_data] : variable_map) {
+            const auto attributes = dm_storage.get_variable_attributes(component, variable, std::nullopt);
+            expected_count += attributes.size();
+            if (attributes.empty()) {
+                continue;
+            }
+            const auto& bulk_attributes = all_attributes[component][variable];
+            ASSERT_EQ(bulk_attributes.size(), attributes.size());
+            for (size_t i = 0; i < attributes.size(); i++) {
+                EXPECT_EQ(bulk_attributes.at(i).type, attributes.at(i).type);
+                EXPECT_EQ(bulk_attributes.at(i).mutability, attributes.at(i).mutability);
+                EXPECT_EQ(bulk_attributes.at(i).value.has_value(), attributes.at(i).value.has_value());
+                if (attributes.at(i).value.has_value()) {
+                    EXPECT_EQ(bulk_attributes.at(i).value.value().get(), attributes.at(i).value.value().get());
+                }
+            }
+        }
+    }
+    EXPECT_EQ(count, expected_count);
+}
+
+/// \brief Tests for_each_variable_attribute only provides the attributes of the requested variables, including those of
+/// components of an EVSE or connector, and ignores variables that are not in the storage
+TEST_F(DeviceModelStorageSQLiteTest, test_for_each_variable_attribute_of_requested_variables) {
+
+    auto dm_storage = DeviceModelStorageSqlite(DEVICE_MODEL_DATABASE);
+
+    const auto& cv = ControllerComponentVariables::AlignedDataInterval;
+    std::vector<std::pair<Component, Variable>> requested_variables{{cv.component, cv.variable.value()}};
+    for (const auto& [component, variable_map] : dm_storage.get_device_model()) {
+        if (component.evse.has_value() and !variable_map.empty()) {
+            requested_variables.emplace_back(component, variable_map.begin()->first);
+        }
+    }
+    ASSERT_GT(requested_variables.size(), 1);
+    Variable unknown_variable;
+    unknown_variable.name = "UnknownVariable";
+    requested_variables.emplace_back(cv.component, unknown_variable);
+
+    // the second request must not provide the variables of the first one
+    for (const auto& variables : {requested_variables, std::vector<std::pair<Component, Variable>>{
+                                                           {cv.component, cv.variable.value()}}}) {
+        std::map<std::pair<Component, Variable>, std::vector<VariableAttribute>> attributes;
+        dm_storage.for_each_variable_attribute(
+            variables, [&](const Component& component, const Variable& variable, const VariableAttribute& attribute) {
+                attributes[{component, variable}].push_back(attribute);
+            });
+
+        size_t expected_variables = 0;
+        for (const auto& [component, variable] : variables) {
+            const auto expected = dm_storage.get_variable_attributes(component, variable, std::nullopt);
+            if (expected.empty()) {
+                EXPECT_EQ(attributes.count({component, variable}), 0);
+                continue;
+            }
+            expected_variables++;
+            const auto& provided = attributes[{component, variable}];
+            ASSERT_EQ(provided.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); i++) {
+                EXPECT_EQ(provided.at(i).type, expected.at(i).type);
+                EXPECT_EQ(provided.at(i).mutability, expected.at(i).mutability);
+            }
+        }
+        EXPECT_EQ(attributes.size(), expected_variables);
+    }
+}
+
+/// \brief Tests set_variable_attribute_values sets all values that are present in the storage
+TEST_F(DeviceModelStorageSQLiteTest, test_set_variable_attribute_values) {
+
+    auto dm_storage = DeviceModelStorageSqlite(DEVICE_MODEL_DATABASE);
+
+    const auto& cv = ControllerComponentVariables::AlignedDataInterval;
+    const auto original = dm_storage.get_variable_attribute(cv.component, cv.variable.value(), AttributeEnum::Actual);
+    ASSERT_TRUE(original.has_value());
+
+    Variable unknown_variable;
+    unknown_variable.name = "UnknownVariable";
+
+    const auto results = dm_storage.set_variable_attribute_values(
+        {{cv.component, unknown_variable, AttributeEnum::Actual, "20"},
+         {cv.component, cv.variable.value(), AttributeEnum::Actual, "20"}});
+    ASSERT_EQ(results, std::vector<bool>({false, true}));
+    ASSERT_EQ(dm_storage.get_variable_attribute(cv.component, cv.variable.value(), AttributeEnum::Actual)
+                  .value()
+                  .value.value()
+                  .get(),
+              "20");
+
+    // reset the value
+    ASSERT_TRUE(dm_storage.set_variable_attribute_value(cv.component, cv.variable.value(), AttributeEnum::Actual,
+                                                        original.value().value.value().get()));
+}
+
+/// \brief Tests batches and single values written concurrently from different threads all succeed
+TEST_F(DeviceModelStorageSQLiteTest, test_set_variable_attribute_values_concurrently) {
+
+    auto dm_storage = DeviceModelStorageSqlite(DEVICE_MODEL_DATABASE);
+
+    const auto& cv = ControllerComponentVariables::AlignedDataInterval;
+    const auto original = dm_storage.get_variable_attribute(cv.component, cv.variable.value(), AttributeEnum::Actual);
+    ASSERT_TRUE(original.has_value());
+
+    std::atomic_bool all_succeeded = true;
+    const auto write = [&]() {
+        for (int i = 0; i < 50; i++) {
+            const auto results = dm_storage.set_variable_attribute_values(
+                {{cv.component, cv.variable.value(), AttributeEnum::Actual, "20"},
+                 {cv.component, cv.variable.value(), AttributeEnum::Actual, "30"}});
+            if (results != std::vector<bool>({true, true}) or
+                !dm_storage.set_variable_attribute_value(cv.component, cv.variable.value(), AttributeEnum::Actual,
+                                                         "40")) {
+                all_succeeded = false;
+            }
+        }
+    };
+    std::thread batch_writer(write);
+    write();
+    batch_writer.join();
+    EXPECT_TRUE(all_succeeded);
+
+    // reset the value
+    ASSERT_TRUE(dm_storage.set_variable_attribute_value(cv.component, cv.variable.value(), AttributeEnum::Actual,
+                                                        original.value().value.value().get()));
+}
+
 } // namespace v201
 } // namespace ocpp
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/v201/enums.hpp>
+#include <ocpp/v201/types.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+TEST(EnumConversionsTest, measurand_round_trip) {
+    for (int i = static_cast<int>(MeasurandEnum::Current_Export); i <= static_cast<int>(MeasurandEnum::Voltage); i++) {
+        const auto measurand = static_cast<MeasurandEnum>(i);
+        const std::string str(conversions::measurand_enum_to_string(measurand));
+        EXPECT_EQ(conversions::string_to_measurand_enum(str), measurand) << str;
+    }
+    EXPECT_EQ(conversions::measurand_enum_to_string(MeasurandEnum::Energy_Active_Import_Register),
+              "Energy.Active.Import.Register");
+}
+
+TEST(EnumConversionsTest, message_type_round_trip) {
+    for (int i = static_cast<int>(MessageType::Authorize); i <= static_cast<int>(MessageType::InternalError); i++) {
+        const auto message_type = static_cast<MessageType>(i);
+        const std::string str(conversions::messagetype_to_string(message_type));
+        EXPECT_EQ(conversions::string_to_messagetype(str), message_type) << str;
+    }
+}
+
+TEST(EnumConversionsTest, unknown_strings_throw) {
+    // same length and distinguishing character as existing values, but different otherwise
+    EXPECT_THROW(conversions::string_to_measurand_enum("Current.Exbort"), std::out_of_range);
+    EXPECT_THROW(conversions::string_to_measurand_enum(""), std::out_of_range);
+    EXPECT_THROW(conversions::string_to_messagetype("Authorise"), std::out_of_range);
+    EXPECT_THROW(conversions::string_to_messagetype("authorize"), std::out_of_range);
+    EXPECT_THROW(conversions::string_to_phase_enum("L1-N "), std::out_of_range);
+}
+
+} // namespace v201
+} // namespace ocpp
@@ -157,5 +157,50 @@ TEST_F(NotifyReportRequestsSplitterTest, test_splits_contains_at_least_one_repor
     }
 }
 
+/// \brief Test that streamed report data is passed to the payload callback as soon as a payload is full
+TEST_F(NotifyReportRequestsSplitterTest, test_stream_report_data) {
+    // Setup
+    NotifyReportRequest req{};
+    req.requestId = 42;
+    const std::vector<ReportData> report_data{ReportData{{"component_name"}, {"variable_name"}, {}, {}, {}},
+                                              ReportData{{"component_name2"}, {"variable_name2"}, {}, {}, {}},
+                                              ReportData{{"component_name3"}, {"variable_name3"}, {}, {}, {}}};
+
+    // the size of a payload containing the first two report data objects, which has to fit even if it is the last one
+    NotifyReportRequest first_req = req;
+    first_req.reportData = std::vector<ReportData>{report_data[0], report_data[1]};
+    first_req.tbc = false;
+    first_req.seqNo = 0;
+    size_t first_size = json{2, "test_message_0", "NotifyReport", first_req}.dump().size();
+
+    std::vector<json> payloads;
+    NotifyReportRequestsSplitter splitter{req, first_size, [this]() { return this->generate_message_id(); },
+                                          [&payloads](const MessageId& message_id, std::string&& payload) {
+                                              payloads.push_back(
+                                                  json{2, message_id, "NotifyReport", json::parse(payload)});
+                                          }};
+
+    // Act & verify: the first payload is only passed on once the third report data does not fit anymore
+    splitter.add(report_data[0]);
+    splitter.add(report_data[1]);
+    ASSERT_TRUE(payloads.empty());
+    splitter.add(report_data[2]);
+    ASSERT_EQ(payloads.size(), 1);
+    splitter.finish();
+    ASSERT_EQ(payloads.size(), 2);
+
+    for (int i = 0; i < 2; i++) {
+        auto request = payloads[i];
+        check_valid_call_payload(request);
+        ASSERT_EQ(message_ids[i].get(), request[1]);
+        ASSERT_EQ(request[3]["requestId"], 42);
+        ASSERT_EQ(request[3]["seqNo"], i);
+        ASSERT_EQ(request[3]["tbc"], i == 0);
+    }
+    ASSERT_LE(payloads[0].dump().size(), first_size);
+    ASSERT_EQ(payloads[0][3]["reportData"].size(), 2);
+    ASSERT_EQ(payloads[1][3]["reportData"].dump(), "[" + json(report_data[2]).dump() + "]");
+}
+
 } // namespace v201
 } // namespace ocpp
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include "device_model_storage_mock.hpp"
+#include <gtest/gtest.h>
+#include <ocpp/v201/ctrlr_component_variables.hpp>
+#include <ocpp/v201/variable_monitoring_engine.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+class VariableMonitoringEngineTest : public ::testing::Test {
+protected:
+    const ComponentVariable& monitored_cv = ControllerComponentVariables::HeartbeatInterval;
+    const ComponentVariable& offline_queuing_severity_cv = ControllerComponentVariables::OfflineQueuingSeverity;
+
+    std::map<std::string, std::string> values;
+    std::vector<std::vector<EventData>> sent_events;
+    bool offline = false;
+
+    std::unique_ptr<DeviceModel> dm;
+    std::unique_ptr<VariableMonitoringEngine> engine;
+
+    void SetUp() override {
+        VariableCharacteristics characteristics;
+        characteristics.dataType = DataEnum::integer;
+        characteristics.supportsMonitoring = true;
+
+        // upper threshold of 100 with severity 5 and delta of 10 with severity 8
+        VariableMetaData monitored_meta_data{characteristics, {}};
+        monitored_meta_data.monitors.push_back({1, false, 100, MonitorEnum::UpperThreshold, 5, std::nullopt});
+        monitored_meta_data.monitors.push_back({2, false, 10, MonitorEnum::Delta, 8, std::nullopt});
+
+        DeviceModelMap device_model_map;
+        device_model_map[monitored_cv.component][monitored_cv.variable.value()] = monitored_meta_data;
+        device_model_map[offline_queuing_severity_cv.component][offline_queuing_severity_cv.variable.value()] =
+            VariableMetaData{characteristics, {}};
+
+        values[monitored_cv.variable->name.get()] = "50";
+        values[offline_queuing_severity_cv.variable->name.get()] = "9";
+
+        auto storage_mock = std::make_unique<testing::NiceMock<DeviceModelStorageMock>>();
+        ON_CALL(*storage_mock, get_device_model).WillByDefault(testing::Return(device_model_map));
+        ON_CALL(*storage_mock, get_variable_attribute)
+            .WillByDefault([this](const Component&, const Variable& variable,
+                                  const AttributeEnum&) -> std::optional<VariableAttribute> {
+                const auto it = this->values.find(variable.name.get());
+                if (it == this->values.end()) {
+                    return std::nullopt;
+                }
+                VariableAttribute attribute;
+                attribute.type = AttributeEnum::Actual;
+                attribute.value = it->second;
+                attribute.mutability = MutabilityEnum::ReadWrite;
+                return attribute;
+            });
+        ON_CALL(*storage_mock, set_variable_attribute_value)
+            .WillByDefault(
+                [this](const Component&, const Variable& variable, const AttributeEnum&, const std::string& value) {
+                    this->values[variable.name.get()] = value;
+                    return true;
+                });
+
+        dm = std::make_unique<DeviceModel>(std::move(storage_mock));
+        engine = std::make_unique<VariableMonitoringEngine>(
+            *dm, [this](const std::vector<EventData>& events) { this->sent_events.push_back(events); },
+            [this]() { return this->offline; }, [](const std::optional<EVSE>&) { return false; });
+        dm->set_monitored_value_changed_callback(
+            [this](const Component& component, const Variable& variable,
+                   const std::vector<VariableMonitoring>& monitors, const std::optional<std::string>& previous_value,
+                   const std::string& value) {
+                this->engine->on_value_changed(component, variable, monitors, previous_value, value);
+            });
+    }
+
+    SetVariableStatusEnum set_monitored_value(const std::string& value) {
+        return dm->set_value(monitored_cv.component, monitored_cv.variable.value(), AttributeEnum::Actual, value);
+    }
+};
+
+/// \brief Test that threshold and delta monitors only trigger events when their condition changes
+TEST_F(VariableMonitoringEngineTest, test_threshold_and_delta_monitors) {
+    ASSERT_EQ(set_monitored_value("120"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(sent_events.size(), 1);
+    ASSERT_EQ(sent_events.at(0).size(), 2);
+    const auto& threshold_event = sent_events.at(0).at(0);
+    EXPECT_EQ(threshold_event.trigger, EventTriggerEnum::Alerting);
+    EXPECT_EQ(threshold_event.variableMonitoringId, 1);
+    EXPECT_EQ(threshold_event.cleared, false);
+    EXPECT_EQ(threshold_event.actualValue.get(), "120");
+    const auto& delta_event = sent_events.at(0).at(1);
+    EXPECT_EQ(delta_event.trigger, EventTriggerEnum::Delta);
+    EXPECT_EQ(delta_event.variableMonitoringId, 2);
+    EXPECT_NE(delta_event.eventId, threshold_event.eventId);
+
+    // still above the threshold and less than the delta since the last event
+    ASSERT_EQ(set_monitored_value("125"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(sent_events.size(), 1);
+
+    // not monitored, so no events
+    ASSERT_EQ(dm->set_value(offline_queuing_severity_cv.component, offline_queuing_severity_cv.variable.value(),
+                            AttributeEnum::Actual, "6"),
+              SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(sent_events.size(), 1);
+
+    // while offline the delta event exceeds the OfflineQueuingSeverity and is discarded
+    offline = true;
+    ASSERT_EQ(set_monitored_value("90"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(sent_events.size(), 2);
+    ASSERT_EQ(sent_events.at(1).size(), 1);
+    EXPECT_EQ(sent_events.at(1).at(0).variableMonitoringId, 1);
+    EXPECT_EQ(sent_events.at(1).at(0).cleared, true);
+}
+
+/// \brief Test that event ids do not start at 0 after a boot, which would repeat ids sent before the boot
+TEST_F(VariableMonitoringEngineTest, test_event_ids_seeded_from_time) {
+    const auto seconds_at_boot =
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count() %
+        std::numeric_limits<int32_t>::max();
+    // SetUp created the engine just before
+    ASSERT_EQ(set_monitored_value("120"), SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(sent_events.size(), 1);
+    EXPECT_GE(sent_events.at(0).at(0).eventId, seconds_at_boot - 1);
+    EXPECT_EQ(sent_events.at(0).at(1).eventId, sent_events.at(0).at(0).eventId + 1);
+}
+
+} // namespace v201
+} // namespace ocpp
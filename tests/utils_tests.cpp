@@ -2,6 +2,8 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <gtest/gtest.h>
+#include <ocpp/common/cistring.hpp>
+#include <ocpp/common/types.hpp>
 #include <ocpp/common/utils.hpp>
 
 namespace ocpp {
@@ -23,6 +25,7 @@ TEST_F(UtilsTest, test_valid_datetime) {
     ASSERT_TRUE(is_rfc3339_datetime("2019-04-12T23:20:50.523Z"));
     ASSERT_TRUE(is_rfc3339_datetime("2019-12-19T16:39:57+01:00"));
     ASSERT_TRUE(is_rfc3339_datetime("2019-12-19T16:39:57-01:00"));
+    ASSERT_TRUE(is_rfc3339_datetime("2019-12-19T16:39:57+0100"));
 }
 
 TEST_F(UtilsTest, test_invalid_datetime) {
@@ -33,6 +36,78 @@ TEST_F(UtilsTest, test_invalid_datetime) {
 
     // more than 3 decimal digits are not allowed in OCPP
     ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04.0001Z"));
+
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29t10:21:04Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-32T10:21:04Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:60Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T24:00:00Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04Z "));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04+1:00"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-02-29T10:21:04Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04+24:00"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04.Z"));
+    ASSERT_FALSE(is_rfc3339_datetime("2023-11-29T10:21:04\xb9\xb9Z"));
+}
+
+TEST_F(UtilsTest, test_datetime_round_trip) {
+    EXPECT_EQ(DateTime("2023-11-29T10:21:04Z").to_rfc3339(), "2023-11-29T10:21:04.000Z");
+    EXPECT_EQ(DateTime("2019-04-12T23:20:50.52Z").to_rfc3339(), "2019-04-12T23:20:50.520Z");
+    EXPECT_EQ(DateTime("2024-02-29T23:59:59.123456789Z").to_rfc3339(), "2024-02-29T23:59:59.123Z");
+    EXPECT_EQ(DateTime("2019-12-19T16:39:57+01:00").to_rfc3339(), "2019-12-19T15:39:57.000Z");
+    EXPECT_EQ(DateTime("2019-12-31T23:39:57-01:30").to_rfc3339(), "2020-01-01T01:09:57.000Z");
+    EXPECT_EQ(DateTime("2019-12-19T16:39:57").to_rfc3339(), "2019-12-19T16:39:57.000Z");
+
+    const DateTime epoch(date::utc_clock::time_point{});
+    EXPECT_EQ(epoch.to_rfc3339(), "1970-01-01T00:00:00.000Z");
+
+    char buffer[DateTime::RFC3339_BUFFER_SIZE];
+    const auto length = DateTime("2100-03-01T00:00:00.999Z").to_rfc3339(buffer);
+    EXPECT_EQ(std::string(buffer, length), "2100-03-01T00:00:00.999Z");
+}
+
+TEST_F(UtilsTest, test_datetime_keeps_value_on_invalid_string) {
+    DateTime date_time("2023-11-29T10:21:04Z");
+    date_time.from_rfc3339("2023-11-29 10:21:04Z");
+    EXPECT_EQ(date_time.to_rfc3339(), "2023-11-29T10:21:04.000Z");
+}
+
+TEST_F(UtilsTest, test_cistring_compares_case_insensitive) {
+    const CiString<20> id_tag("AbCdEfGhIjKlMnOp");
+    EXPECT_TRUE(id_tag == CiString<20>("abcdefghijklmnop"));
+    EXPECT_TRUE(id_tag == "ABCDEFGHIJKLMNOP");
+    EXPECT_FALSE(id_tag == CiString<20>("abcdefghijklmnoq"));
+    EXPECT_FALSE(id_tag == CiString<20>("abcdefghijklmno"));
+    EXPECT_FALSE(CiString<20>("@[`{") == "`{@[");
+    EXPECT_EQ(std::hash<CiString<20>>{}(id_tag), std::hash<CiString<20>>{}(CiString<20>("ABCDEFGHIJKLMNOP")));
+}
+
+TEST_F(UtilsTest, test_cistring_length) {
+    CiString<8> str("12345678");
+    EXPECT_EQ(str.view(), "12345678");
+    EXPECT_THROW(str.set("123456789"), std::runtime_error);
+    EXPECT_EQ(str.get(), "12345678");
+
+    const CiString<255> long_str(std::string(255, 'x'));
+    EXPECT_EQ(long_str.get(), std::string(255, 'x'));
+    EXPECT_THROW(CiString<255>(std::string(256, 'x')), std::runtime_error);
+}
+
+TEST_F(UtilsTest, test_cistring_printable_ascii) {
+    CiString<32> str;
+    EXPECT_TRUE(str.is_valid("printable ASCII including ~ and\n"));
+    EXPECT_THROW(str.is_valid("a tab\tin the middle of the text"), std::runtime_error);
+    EXPECT_THROW(str.is_valid("non ASCII \xc3\xa4"), std::runtime_error);
+    EXPECT_THROW(str.is_valid(std::string_view("null\0", 5)), std::runtime_error);
+
+    // constructing or setting a CiString validates its content
+    EXPECT_THROW(CiString<32>("a tab\tin the middle of the text"), std::runtime_error);
+    EXPECT_THROW(CiString<32>(std::string("escape \x1b")), std::runtime_error);
+    EXPECT_THROW(str.set("bell\a"), std::runtime_error);
+    EXPECT_EQ(str.get(), "");
+    str.set("printable");
+    EXPECT_EQ(str.get(), "printable");
 }
 
 } // namespace common